@@ -135,6 +135,30 @@ bgp_configurator_if_multipaths (BgpConfiguratorIf *iface, gint32* _return, const
   return BGP_CONFIGURATOR_IF_GET_INTERFACE (iface)->multipaths (iface, _return, rd, maxPath, error);
 }
 
+gboolean
+bgp_configurator_if_push_routes (BgpConfiguratorIf *iface, GArray ** _return, const GPtrArray * routes, GError **error)
+{
+  return BGP_CONFIGURATOR_IF_GET_INTERFACE (iface)->push_routes (iface, _return, routes, error);
+}
+
+gboolean
+bgp_configurator_if_withdraw_routes (BgpConfiguratorIf *iface, GArray ** _return, const GPtrArray * routes, GError **error)
+{
+  return BGP_CONFIGURATOR_IF_GET_INTERFACE (iface)->withdraw_routes (iface, _return, routes, error);
+}
+
+gboolean
+bgp_configurator_if_resume_notifications (BgpConfiguratorIf *iface, gint32* _return, const gint64 fromSeq, GError **error)
+{
+  return BGP_CONFIGURATOR_IF_GET_INTERFACE (iface)->resume_notifications (iface, _return, fromSeq, error);
+}
+
+gboolean
+bgp_configurator_if_apply_config (BgpConfiguratorIf *iface, gint32* _return, const ConfigSnapshot * snapshot, GError **error)
+{
+  return BGP_CONFIGURATOR_IF_GET_INTERFACE (iface)->apply_config (iface, _return, snapshot, error);
+}
+
 GType
 bgp_configurator_if_get_type (void)
 {
@@ -4166,476 +4190,1308 @@ gboolean bgp_configurator_client_multipaths (BgpConfiguratorIf * iface, gint32*
   return TRUE;
 }
 
-static void
-bgp_configurator_if_interface_init (BgpConfiguratorIfInterface *iface)
-{
-  iface->start_bgp = bgp_configurator_client_start_bgp;
-  iface->stop_bgp = bgp_configurator_client_stop_bgp;
-  iface->create_peer = bgp_configurator_client_create_peer;
-  iface->delete_peer = bgp_configurator_client_delete_peer;
-  iface->add_vrf = bgp_configurator_client_add_vrf;
-  iface->del_vrf = bgp_configurator_client_del_vrf;
-  iface->push_route = bgp_configurator_client_push_route;
-  iface->withdraw_route = bgp_configurator_client_withdraw_route;
-  iface->set_ebgp_multihop = bgp_configurator_client_set_ebgp_multihop;
-  iface->unset_ebgp_multihop = bgp_configurator_client_unset_ebgp_multihop;
-  iface->set_update_source = bgp_configurator_client_set_update_source;
-  iface->unset_update_source = bgp_configurator_client_unset_update_source;
-  iface->enable_address_family = bgp_configurator_client_enable_address_family;
-  iface->disable_address_family = bgp_configurator_client_disable_address_family;
-  iface->set_log_config = bgp_configurator_client_set_log_config;
-  iface->enable_graceful_restart = bgp_configurator_client_enable_graceful_restart;
-  iface->disable_graceful_restart = bgp_configurator_client_disable_graceful_restart;
-  iface->get_routes = bgp_configurator_client_get_routes;
-  iface->enable_multipath = bgp_configurator_client_enable_multipath;
-  iface->disable_multipath = bgp_configurator_client_disable_multipath;
-  iface->multipaths = bgp_configurator_client_multipaths;
-}
-
-static void
-bgp_configurator_client_init (BgpConfiguratorClient *client)
+gboolean bgp_configurator_client_send_push_routes (BgpConfiguratorIf * iface, const GPtrArray * routes, GError ** error)
 {
-  client->input_protocol = NULL;
-  client->output_protocol = NULL;
-}
+  gint32 cseqid = 0;
+  ThriftProtocol * protocol = BGP_CONFIGURATOR_CLIENT (iface)->output_protocol;
 
-static void
-bgp_configurator_client_class_init (BgpConfiguratorClientClass *cls)
-{
-  GObjectClass *gobject_class = G_OBJECT_CLASS (cls);
-  GParamSpec *param_spec;
+  if (thrift_protocol_write_message_begin (protocol, "pushRoutes", T_CALL, cseqid, error) < 0)
+    return FALSE;
 
-  gobject_class->set_property = bgp_configurator_client_set_property;
-  gobject_class->get_property = bgp_configurator_client_get_property;
+  {
+    gint32 ret;
+    gint32 xfer = 0;
 
-  param_spec = g_param_spec_object ("input_protocol",
-                                    "input protocol (construct)",
-                                    "Set the client input protocol",
-                                    THRIFT_TYPE_PROTOCOL,
-                                    G_PARAM_READWRITE);
-  g_object_class_install_property (gobject_class,
-                                   PROP_BGP_CONFIGURATOR_CLIENT_INPUT_PROTOCOL, param_spec);
+    
+    if ((ret = thrift_protocol_write_struct_begin (protocol, "pushRoutes_args", error)) < 0)
+      return 0;
+    xfer += ret;
+    if ((ret = thrift_protocol_write_field_begin (protocol, "routes", T_LIST, 1, error)) < 0)
+      return 0;
+    xfer += ret;
+    {
+      guint i21;
 
-  param_spec = g_param_spec_object ("output_protocol",
-                                    "output protocol (construct)",
-                                    "Set the client output protocol",
-                                    THRIFT_TYPE_PROTOCOL,
-                                    G_PARAM_READWRITE);
-  g_object_class_install_property (gobject_class,
-                                   PROP_BGP_CONFIGURATOR_CLIENT_OUTPUT_PROTOCOL, param_spec);
-}
+      if ((ret = thrift_protocol_write_list_begin (protocol, T_STRUCT, (gint32) (routes ? routes->len : 0), error)) < 0)
+        return 0;
+      xfer += ret;
+      for (i21 = 0; i21 < (routes ? routes->len : 0); i21++)
+      {
+        if ((ret = thrift_struct_write (THRIFT_STRUCT ((g_ptr_array_index ((GPtrArray *) routes, i21))), protocol, error)) < 0)
+          return 0;
+        xfer += ret;
 
-static void
-bgp_configurator_handler_bgp_configurator_if_interface_init (BgpConfiguratorIfInterface *iface);
+      }
+      if ((ret = thrift_protocol_write_list_end (protocol, error)) < 0)
+        return 0;
+      xfer += ret;
+    }
+    if ((ret = thrift_protocol_write_field_end (protocol, error)) < 0)
+      return 0;
+    xfer += ret;
+    if ((ret = thrift_protocol_write_field_stop (protocol, error)) < 0)
+      return 0;
+    xfer += ret;
+    if ((ret = thrift_protocol_write_struct_end (protocol, error)) < 0)
+      return 0;
+    xfer += ret;
 
-G_DEFINE_TYPE_WITH_CODE (BgpConfiguratorHandler, 
-                         bgp_configurator_handler,
-                         G_TYPE_OBJECT,
-                         G_IMPLEMENT_INTERFACE (TYPE_BGP_CONFIGURATOR_IF,
-                                                bgp_configurator_handler_bgp_configurator_if_interface_init))
+  }
 
-gboolean bgp_configurator_handler_start_bgp (BgpConfiguratorIf * iface, gint32* _return, const gint64 asNumber, const gchar * routerId, const gint32 port, const gint32 holdTime, const gint32 keepAliveTime, const gint32 stalepathTime, const gboolean announceFbit, GError ** error)
-{
-  g_return_val_if_fail (IS_BGP_CONFIGURATOR_HANDLER (iface), FALSE);
+  if (thrift_protocol_write_message_end (protocol, error) < 0)
+    return FALSE;
+  if (!thrift_transport_flush (protocol->transport, error))
+    return FALSE;
+  if (!thrift_transport_write_end (protocol->transport, error))
+    return FALSE;
 
-  return BGP_CONFIGURATOR_HANDLER_GET_CLASS (iface)->start_bgp (iface, _return, asNumber, routerId, port, holdTime, keepAliveTime, stalepathTime, announceFbit, error);
+  return TRUE;
 }
 
-gboolean bgp_configurator_handler_stop_bgp (BgpConfiguratorIf * iface, gint32* _return, const gint64 asNumber, GError ** error)
+gboolean bgp_configurator_client_recv_push_routes (BgpConfiguratorIf * iface, GArray ** _return, GError ** error)
 {
-  g_return_val_if_fail (IS_BGP_CONFIGURATOR_HANDLER (iface), FALSE);
+  gint32 rseqid;
+  gchar * fname = NULL;
+  ThriftMessageType mtype;
+  ThriftProtocol * protocol = BGP_CONFIGURATOR_CLIENT (iface)->input_protocol;
+  ThriftApplicationException *xception;
 
-  return BGP_CONFIGURATOR_HANDLER_GET_CLASS (iface)->stop_bgp (iface, _return, asNumber, error);
-}
+  if (thrift_protocol_read_message_begin (protocol, &fname, &mtype, &rseqid, error) < 0) {
+    if (fname) g_free (fname);
+    return FALSE;
+  }
 
-gboolean bgp_configurator_handler_create_peer (BgpConfiguratorIf * iface, gint32* _return, const gchar * ipAddress, const gint64 asNumber, GError ** error)
-{
-  g_return_val_if_fail (IS_BGP_CONFIGURATOR_HANDLER (iface), FALSE);
+  if (mtype == T_EXCEPTION) {
+    if (fname) g_free (fname);
+    xception = g_object_new (THRIFT_TYPE_APPLICATION_EXCEPTION, NULL);
+    thrift_struct_read (THRIFT_STRUCT (xception), protocol, NULL);
+    thrift_protocol_read_message_end (protocol, NULL);
+    thrift_transport_read_end (protocol->transport, NULL);
+    g_set_error (error, THRIFT_APPLICATION_EXCEPTION_ERROR,xception->type, "application error: %s", xception->message);
+    g_object_unref (xception);
+    return FALSE;
+  } else if (mtype != T_REPLY) {
+    if (fname) g_free (fname);
+    thrift_protocol_skip (protocol, T_STRUCT, NULL);
+    thrift_protocol_read_message_end (protocol, NULL);
+    thrift_transport_read_end (protocol->transport, NULL);
+    g_set_error (error, THRIFT_APPLICATION_EXCEPTION_ERROR, THRIFT_APPLICATION_EXCEPTION_ERROR_INVALID_MESSAGE_TYPE, "invalid message type %d, expected T_REPLY", mtype);
+    return FALSE;
+  } else if (strncmp (fname, "pushRoutes", 10) != 0) {
+    thrift_protocol_skip (protocol, T_STRUCT, NULL);
+    thrift_protocol_read_message_end (protocol,error);
+    thrift_transport_read_end (protocol->transport, error);
+    g_set_error (error, THRIFT_APPLICATION_EXCEPTION_ERROR, THRIFT_APPLICATION_EXCEPTION_ERROR_WRONG_METHOD_NAME, "wrong method name %s, expected pushRoutes", fname);
+    if (fname) g_free (fname);
+    return FALSE;
+  }
+  if (fname) g_free (fname);
 
-  return BGP_CONFIGURATOR_HANDLER_GET_CLASS (iface)->create_peer (iface, _return, ipAddress, asNumber, error);
-}
+  {
+    gint32 ret;
+    gint32 xfer = 0;
+    gchar *name = NULL;
+    ThriftType ftype;
+    gint16 fid;
+    guint32 len = 0;
+    gpointer data = NULL;
+    
 
-gboolean bgp_configurator_handler_delete_peer (BgpConfiguratorIf * iface, gint32* _return, const gchar * ipAddress, GError ** error)
-{
-  g_return_val_if_fail (IS_BGP_CONFIGURATOR_HANDLER (iface), FALSE);
+    /* satisfy -Wall in case these aren't used */
+    THRIFT_UNUSED_VAR (len);
+    THRIFT_UNUSED_VAR (data);
 
-  return BGP_CONFIGURATOR_HANDLER_GET_CLASS (iface)->delete_peer (iface, _return, ipAddress, error);
-}
+    /* read the struct begin marker */
+    if ((ret = thrift_protocol_read_struct_begin (protocol, &name, error)) < 0)
+    {
+      if (name) g_free (name);
+      return 0;
+    }
+    xfer += ret;
+    if (name) g_free (name);
+    name = NULL;
 
-gboolean bgp_configurator_handler_add_vrf (BgpConfiguratorIf * iface, gint32* _return, const gchar * rd, const GPtrArray * irts, const GPtrArray * erts, GError ** error)
-{
-  g_return_val_if_fail (IS_BGP_CONFIGURATOR_HANDLER (iface), FALSE);
+    /* read the struct fields */
+    while (1)
+    {
+      /* read the beginning of a field */
+      if ((ret = thrift_protocol_read_field_begin (protocol, &name, &ftype, &fid, error)) < 0)
+      {
+        if (name) g_free (name);
+        return 0;
+      }
+      xfer += ret;
+      if (name) g_free (name);
+      name = NULL;
 
-  return BGP_CONFIGURATOR_HANDLER_GET_CLASS (iface)->add_vrf (iface, _return, rd, irts, erts, error);
-}
+      /* break if we get a STOP field */
+      if (ftype == T_STOP)
+      {
+        break;
+      }
 
-gboolean bgp_configurator_handler_del_vrf (BgpConfiguratorIf * iface, gint32* _return, const gchar * rd, GError ** error)
-{
-  g_return_val_if_fail (IS_BGP_CONFIGURATOR_HANDLER (iface), FALSE);
+      switch (fid)
+      {
+        case 0:
+          if (ftype == T_LIST)
+          {
+            {
+              guint32 size;
+              guint32 i;
+              ThriftType element_type;
+
+              if ((ret = thrift_protocol_read_list_begin (protocol, &element_type,&size, error)) < 0)
+                return 0;
+              xfer += ret;
+
+              /* iterate through list elements */
+              for (i = 0; i < size; i++)
+              {
+                gint32 _elem22 = 0;
+                if ((ret = thrift_protocol_read_i32 (protocol, &_elem22, error)) < 0)
+                  return 0;
+                xfer += ret;
+                g_array_append_vals (*_return, &_elem22, 1);
+              }
+              if ((ret = thrift_protocol_read_list_end (protocol, error)) < 0)
+                return 0;
+              xfer += ret;
+            }
+          } else {
+            if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
+              return 0;
+            xfer += ret;
+          }
+          break;
+        default:
+          if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
+            return 0;
+          xfer += ret;
+          break;
+      }
+      if ((ret = thrift_protocol_read_field_end (protocol, error)) < 0)
+        return 0;
+      xfer += ret;
+    }
 
-  return BGP_CONFIGURATOR_HANDLER_GET_CLASS (iface)->del_vrf (iface, _return, rd, error);
-}
+    if ((ret = thrift_protocol_read_struct_end (protocol, error)) < 0)
+      return 0;
+    xfer += ret;
 
-gboolean bgp_configurator_handler_push_route (BgpConfiguratorIf * iface, gint32* _return, const gchar * prefix, const gchar * nexthop, const gchar * rd, const gint32 label, GError ** error)
-{
-  g_return_val_if_fail (IS_BGP_CONFIGURATOR_HANDLER (iface), FALSE);
+  }
 
-  return BGP_CONFIGURATOR_HANDLER_GET_CLASS (iface)->push_route (iface, _return, prefix, nexthop, rd, label, error);
-}
+  if (thrift_protocol_read_message_end (protocol, error) < 0)
+    return FALSE;
 
-gboolean bgp_configurator_handler_withdraw_route (BgpConfiguratorIf * iface, gint32* _return, const gchar * prefix, const gchar * rd, GError ** error)
-{
-  g_return_val_if_fail (IS_BGP_CONFIGURATOR_HANDLER (iface), FALSE);
+  if (!thrift_transport_read_end (protocol->transport, error))
+    return FALSE;
 
-  return BGP_CONFIGURATOR_HANDLER_GET_CLASS (iface)->withdraw_route (iface, _return, prefix, rd, error);
+  return TRUE;
 }
 
-gboolean bgp_configurator_handler_set_ebgp_multihop (BgpConfiguratorIf * iface, gint32* _return, const gchar * peerIp, const gint32 nHops, GError ** error)
+gboolean bgp_configurator_client_push_routes (BgpConfiguratorIf * iface, GArray ** _return, const GPtrArray * routes, GError ** error)
 {
-  g_return_val_if_fail (IS_BGP_CONFIGURATOR_HANDLER (iface), FALSE);
-
-  return BGP_CONFIGURATOR_HANDLER_GET_CLASS (iface)->set_ebgp_multihop (iface, _return, peerIp, nHops, error);
+  if (!bgp_configurator_client_send_push_routes (iface, routes, error))
+    return FALSE;
+  if (!bgp_configurator_client_recv_push_routes (iface, _return, error))
+    return FALSE;
+  return TRUE;
 }
 
-gboolean bgp_configurator_handler_unset_ebgp_multihop (BgpConfiguratorIf * iface, gint32* _return, const gchar * peerIp, GError ** error)
+gboolean bgp_configurator_client_send_withdraw_routes (BgpConfiguratorIf * iface, const GPtrArray * routes, GError ** error)
 {
-  g_return_val_if_fail (IS_BGP_CONFIGURATOR_HANDLER (iface), FALSE);
-
-  return BGP_CONFIGURATOR_HANDLER_GET_CLASS (iface)->unset_ebgp_multihop (iface, _return, peerIp, error);
-}
+  gint32 cseqid = 0;
+  ThriftProtocol * protocol = BGP_CONFIGURATOR_CLIENT (iface)->output_protocol;
 
-gboolean bgp_configurator_handler_set_update_source (BgpConfiguratorIf * iface, gint32* _return, const gchar * peerIp, const gchar * srcIp, GError ** error)
-{
-  g_return_val_if_fail (IS_BGP_CONFIGURATOR_HANDLER (iface), FALSE);
+  if (thrift_protocol_write_message_begin (protocol, "withdrawRoutes", T_CALL, cseqid, error) < 0)
+    return FALSE;
 
-  return BGP_CONFIGURATOR_HANDLER_GET_CLASS (iface)->set_update_source (iface, _return, peerIp, srcIp, error);
-}
+  {
+    gint32 ret;
+    gint32 xfer = 0;
 
-gboolean bgp_configurator_handler_unset_update_source (BgpConfiguratorIf * iface, gint32* _return, const gchar * peerIp, GError ** error)
-{
-  g_return_val_if_fail (IS_BGP_CONFIGURATOR_HANDLER (iface), FALSE);
+    
+    if ((ret = thrift_protocol_write_struct_begin (protocol, "withdrawRoutes_args", error)) < 0)
+      return 0;
+    xfer += ret;
+    if ((ret = thrift_protocol_write_field_begin (protocol, "routes", T_LIST, 1, error)) < 0)
+      return 0;
+    xfer += ret;
+    {
+      guint i27;
 
-  return BGP_CONFIGURATOR_HANDLER_GET_CLASS (iface)->unset_update_source (iface, _return, peerIp, error);
-}
+      if ((ret = thrift_protocol_write_list_begin (protocol, T_STRUCT, (gint32) (routes ? routes->len : 0), error)) < 0)
+        return 0;
+      xfer += ret;
+      for (i27 = 0; i27 < (routes ? routes->len : 0); i27++)
+      {
+        if ((ret = thrift_struct_write (THRIFT_STRUCT ((g_ptr_array_index ((GPtrArray *) routes, i27))), protocol, error)) < 0)
+          return 0;
+        xfer += ret;
 
-gboolean bgp_configurator_handler_enable_address_family (BgpConfiguratorIf * iface, gint32* _return, const gchar * peerIp, const af_afi afi, const af_safi safi, GError ** error)
-{
-  g_return_val_if_fail (IS_BGP_CONFIGURATOR_HANDLER (iface), FALSE);
+      }
+      if ((ret = thrift_protocol_write_list_end (protocol, error)) < 0)
+        return 0;
+      xfer += ret;
+    }
+    if ((ret = thrift_protocol_write_field_end (protocol, error)) < 0)
+      return 0;
+    xfer += ret;
+    if ((ret = thrift_protocol_write_field_stop (protocol, error)) < 0)
+      return 0;
+    xfer += ret;
+    if ((ret = thrift_protocol_write_struct_end (protocol, error)) < 0)
+      return 0;
+    xfer += ret;
 
-  return BGP_CONFIGURATOR_HANDLER_GET_CLASS (iface)->enable_address_family (iface, _return, peerIp, afi, safi, error);
-}
+  }
 
-gboolean bgp_configurator_handler_disable_address_family (BgpConfiguratorIf * iface, gint32* _return, const gchar * peerIp, const af_afi afi, const af_safi safi, GError ** error)
-{
-  g_return_val_if_fail (IS_BGP_CONFIGURATOR_HANDLER (iface), FALSE);
+  if (thrift_protocol_write_message_end (protocol, error) < 0)
+    return FALSE;
+  if (!thrift_transport_flush (protocol->transport, error))
+    return FALSE;
+  if (!thrift_transport_write_end (protocol->transport, error))
+    return FALSE;
 
-  return BGP_CONFIGURATOR_HANDLER_GET_CLASS (iface)->disable_address_family (iface, _return, peerIp, afi, safi, error);
+  return TRUE;
 }
 
-gboolean bgp_configurator_handler_set_log_config (BgpConfiguratorIf * iface, gint32* _return, const gchar * logFileName, const gchar * logLevel, GError ** error)
+gboolean bgp_configurator_client_recv_withdraw_routes (BgpConfiguratorIf * iface, GArray ** _return, GError ** error)
 {
-  g_return_val_if_fail (IS_BGP_CONFIGURATOR_HANDLER (iface), FALSE);
+  gint32 rseqid;
+  gchar * fname = NULL;
+  ThriftMessageType mtype;
+  ThriftProtocol * protocol = BGP_CONFIGURATOR_CLIENT (iface)->input_protocol;
+  ThriftApplicationException *xception;
 
-  return BGP_CONFIGURATOR_HANDLER_GET_CLASS (iface)->set_log_config (iface, _return, logFileName, logLevel, error);
-}
+  if (thrift_protocol_read_message_begin (protocol, &fname, &mtype, &rseqid, error) < 0) {
+    if (fname) g_free (fname);
+    return FALSE;
+  }
 
-gboolean bgp_configurator_handler_enable_graceful_restart (BgpConfiguratorIf * iface, gint32* _return, const gint32 stalepathTime, GError ** error)
-{
-  g_return_val_if_fail (IS_BGP_CONFIGURATOR_HANDLER (iface), FALSE);
+  if (mtype == T_EXCEPTION) {
+    if (fname) g_free (fname);
+    xception = g_object_new (THRIFT_TYPE_APPLICATION_EXCEPTION, NULL);
+    thrift_struct_read (THRIFT_STRUCT (xception), protocol, NULL);
+    thrift_protocol_read_message_end (protocol, NULL);
+    thrift_transport_read_end (protocol->transport, NULL);
+    g_set_error (error, THRIFT_APPLICATION_EXCEPTION_ERROR,xception->type, "application error: %s", xception->message);
+    g_object_unref (xception);
+    return FALSE;
+  } else if (mtype != T_REPLY) {
+    if (fname) g_free (fname);
+    thrift_protocol_skip (protocol, T_STRUCT, NULL);
+    thrift_protocol_read_message_end (protocol, NULL);
+    thrift_transport_read_end (protocol->transport, NULL);
+    g_set_error (error, THRIFT_APPLICATION_EXCEPTION_ERROR, THRIFT_APPLICATION_EXCEPTION_ERROR_INVALID_MESSAGE_TYPE, "invalid message type %d, expected T_REPLY", mtype);
+    return FALSE;
+  } else if (strncmp (fname, "withdrawRoutes", 14) != 0) {
+    thrift_protocol_skip (protocol, T_STRUCT, NULL);
+    thrift_protocol_read_message_end (protocol,error);
+    thrift_transport_read_end (protocol->transport, error);
+    g_set_error (error, THRIFT_APPLICATION_EXCEPTION_ERROR, THRIFT_APPLICATION_EXCEPTION_ERROR_WRONG_METHOD_NAME, "wrong method name %s, expected withdrawRoutes", fname);
+    if (fname) g_free (fname);
+    return FALSE;
+  }
+  if (fname) g_free (fname);
 
-  return BGP_CONFIGURATOR_HANDLER_GET_CLASS (iface)->enable_graceful_restart (iface, _return, stalepathTime, error);
-}
+  {
+    gint32 ret;
+    gint32 xfer = 0;
+    gchar *name = NULL;
+    ThriftType ftype;
+    gint16 fid;
+    guint32 len = 0;
+    gpointer data = NULL;
+    
 
-gboolean bgp_configurator_handler_disable_graceful_restart (BgpConfiguratorIf * iface, gint32* _return, GError ** error)
-{
-  g_return_val_if_fail (IS_BGP_CONFIGURATOR_HANDLER (iface), FALSE);
+    /* satisfy -Wall in case these aren't used */
+    THRIFT_UNUSED_VAR (len);
+    THRIFT_UNUSED_VAR (data);
 
-  return BGP_CONFIGURATOR_HANDLER_GET_CLASS (iface)->disable_graceful_restart (iface, _return, error);
-}
+    /* read the struct begin marker */
+    if ((ret = thrift_protocol_read_struct_begin (protocol, &name, error)) < 0)
+    {
+      if (name) g_free (name);
+      return 0;
+    }
+    xfer += ret;
+    if (name) g_free (name);
+    name = NULL;
 
-gboolean bgp_configurator_handler_get_routes (BgpConfiguratorIf * iface, Routes ** _return, const gint32 optype, const gint32 winSize, GError ** error)
-{
-  g_return_val_if_fail (IS_BGP_CONFIGURATOR_HANDLER (iface), FALSE);
+    /* read the struct fields */
+    while (1)
+    {
+      /* read the beginning of a field */
+      if ((ret = thrift_protocol_read_field_begin (protocol, &name, &ftype, &fid, error)) < 0)
+      {
+        if (name) g_free (name);
+        return 0;
+      }
+      xfer += ret;
+      if (name) g_free (name);
+      name = NULL;
 
-  return BGP_CONFIGURATOR_HANDLER_GET_CLASS (iface)->get_routes (iface, _return, optype, winSize, error);
-}
+      /* break if we get a STOP field */
+      if (ftype == T_STOP)
+      {
+        break;
+      }
 
-gboolean bgp_configurator_handler_enable_multipath (BgpConfiguratorIf * iface, gint32* _return, const af_afi afi, const af_safi safi, GError ** error)
-{
-  g_return_val_if_fail (IS_BGP_CONFIGURATOR_HANDLER (iface), FALSE);
+      switch (fid)
+      {
+        case 0:
+          if (ftype == T_LIST)
+          {
+            {
+              guint32 size;
+              guint32 i;
+              ThriftType element_type;
+
+              if ((ret = thrift_protocol_read_list_begin (protocol, &element_type,&size, error)) < 0)
+                return 0;
+              xfer += ret;
+
+              /* iterate through list elements */
+              for (i = 0; i < size; i++)
+              {
+                gint32 _elem28 = 0;
+                if ((ret = thrift_protocol_read_i32 (protocol, &_elem28, error)) < 0)
+                  return 0;
+                xfer += ret;
+                g_array_append_vals (*_return, &_elem28, 1);
+              }
+              if ((ret = thrift_protocol_read_list_end (protocol, error)) < 0)
+                return 0;
+              xfer += ret;
+            }
+          } else {
+            if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
+              return 0;
+            xfer += ret;
+          }
+          break;
+        default:
+          if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
+            return 0;
+          xfer += ret;
+          break;
+      }
+      if ((ret = thrift_protocol_read_field_end (protocol, error)) < 0)
+        return 0;
+      xfer += ret;
+    }
 
-  return BGP_CONFIGURATOR_HANDLER_GET_CLASS (iface)->enable_multipath (iface, _return, afi, safi, error);
-}
+    if ((ret = thrift_protocol_read_struct_end (protocol, error)) < 0)
+      return 0;
+    xfer += ret;
 
-gboolean bgp_configurator_handler_disable_multipath (BgpConfiguratorIf * iface, gint32* _return, const af_afi afi, const af_safi safi, GError ** error)
-{
-  g_return_val_if_fail (IS_BGP_CONFIGURATOR_HANDLER (iface), FALSE);
+  }
 
-  return BGP_CONFIGURATOR_HANDLER_GET_CLASS (iface)->disable_multipath (iface, _return, afi, safi, error);
-}
+  if (thrift_protocol_read_message_end (protocol, error) < 0)
+    return FALSE;
 
-gboolean bgp_configurator_handler_multipaths (BgpConfiguratorIf * iface, gint32* _return, const gchar * rd, const gint32 maxPath, GError ** error)
-{
-  g_return_val_if_fail (IS_BGP_CONFIGURATOR_HANDLER (iface), FALSE);
+  if (!thrift_transport_read_end (protocol->transport, error))
+    return FALSE;
 
-  return BGP_CONFIGURATOR_HANDLER_GET_CLASS (iface)->multipaths (iface, _return, rd, maxPath, error);
+  return TRUE;
 }
 
-static void
-bgp_configurator_handler_bgp_configurator_if_interface_init (BgpConfiguratorIfInterface *iface)
+gboolean bgp_configurator_client_withdraw_routes (BgpConfiguratorIf * iface, GArray ** _return, const GPtrArray * routes, GError ** error)
 {
-  iface->start_bgp = bgp_configurator_handler_start_bgp;
-  iface->stop_bgp = bgp_configurator_handler_stop_bgp;
-  iface->create_peer = bgp_configurator_handler_create_peer;
-  iface->delete_peer = bgp_configurator_handler_delete_peer;
-  iface->add_vrf = bgp_configurator_handler_add_vrf;
-  iface->del_vrf = bgp_configurator_handler_del_vrf;
-  iface->push_route = bgp_configurator_handler_push_route;
-  iface->withdraw_route = bgp_configurator_handler_withdraw_route;
-  iface->set_ebgp_multihop = bgp_configurator_handler_set_ebgp_multihop;
-  iface->unset_ebgp_multihop = bgp_configurator_handler_unset_ebgp_multihop;
-  iface->set_update_source = bgp_configurator_handler_set_update_source;
-  iface->unset_update_source = bgp_configurator_handler_unset_update_source;
-  iface->enable_address_family = bgp_configurator_handler_enable_address_family;
-  iface->disable_address_family = bgp_configurator_handler_disable_address_family;
-  iface->set_log_config = bgp_configurator_handler_set_log_config;
-  iface->enable_graceful_restart = bgp_configurator_handler_enable_graceful_restart;
-  iface->disable_graceful_restart = bgp_configurator_handler_disable_graceful_restart;
-  iface->get_routes = bgp_configurator_handler_get_routes;
-  iface->enable_multipath = bgp_configurator_handler_enable_multipath;
-  iface->disable_multipath = bgp_configurator_handler_disable_multipath;
-  iface->multipaths = bgp_configurator_handler_multipaths;
+  if (!bgp_configurator_client_send_withdraw_routes (iface, routes, error))
+    return FALSE;
+  if (!bgp_configurator_client_recv_withdraw_routes (iface, _return, error))
+    return FALSE;
+  return TRUE;
 }
 
-static void
-bgp_configurator_handler_init (BgpConfiguratorHandler *self)
+gboolean bgp_configurator_client_send_resume_notifications (BgpConfiguratorIf * iface, const gint64 fromSeq, GError ** error)
 {
-  THRIFT_UNUSED_VAR (self);
-}
+  gint32 cseqid = 0;
+  ThriftProtocol * protocol = BGP_CONFIGURATOR_CLIENT (iface)->output_protocol;
 
-static void
-bgp_configurator_handler_class_init (BgpConfiguratorHandlerClass *cls)
-{
-  cls->start_bgp = NULL;
-  cls->stop_bgp = NULL;
-  cls->create_peer = NULL;
-  cls->delete_peer = NULL;
-  cls->add_vrf = NULL;
-  cls->del_vrf = NULL;
-  cls->push_route = NULL;
-  cls->withdraw_route = NULL;
-  cls->set_ebgp_multihop = NULL;
-  cls->unset_ebgp_multihop = NULL;
-  cls->set_update_source = NULL;
-  cls->unset_update_source = NULL;
-  cls->enable_address_family = NULL;
-  cls->disable_address_family = NULL;
-  cls->set_log_config = NULL;
-  cls->enable_graceful_restart = NULL;
-  cls->disable_graceful_restart = NULL;
-  cls->get_routes = NULL;
-  cls->enable_multipath = NULL;
-  cls->disable_multipath = NULL;
-  cls->multipaths = NULL;
-}
+  if (thrift_protocol_write_message_begin (protocol, "resumeNotifications", T_CALL, cseqid, error) < 0)
+    return FALSE;
 
-enum _BgpConfiguratorProcessorProperties
-{
-  PROP_BGP_CONFIGURATOR_PROCESSOR_0,
-  PROP_BGP_CONFIGURATOR_PROCESSOR_HANDLER
-};
+  {
+    gint32 ret;
+    gint32 xfer = 0;
 
-G_DEFINE_TYPE (BgpConfiguratorProcessor,
-               bgp_configurator_processor,
-               THRIFT_TYPE_DISPATCH_PROCESSOR)
+    
+    if ((ret = thrift_protocol_write_struct_begin (protocol, "resumeNotifications_args", error)) < 0)
+      return 0;
+    xfer += ret;
+    if ((ret = thrift_protocol_write_field_begin (protocol, "fromSeq", T_I64, 1, error)) < 0)
+      return 0;
+    xfer += ret;
+    if ((ret = thrift_protocol_write_i64 (protocol, fromSeq, error)) < 0)
+      return 0;
+    xfer += ret;
 
-typedef gboolean (* BgpConfiguratorProcessorProcessFunction) (BgpConfiguratorProcessor *, 
-                                                              gint32,
-                                                              ThriftProtocol *,
-                                                              ThriftProtocol *,
-                                                              GError **);
+    if ((ret = thrift_protocol_write_field_end (protocol, error)) < 0)
+      return 0;
+    xfer += ret;
+    if ((ret = thrift_protocol_write_field_stop (protocol, error)) < 0)
+      return 0;
+    xfer += ret;
+    if ((ret = thrift_protocol_write_struct_end (protocol, error)) < 0)
+      return 0;
+    xfer += ret;
 
-typedef struct
+  }
+
+  if (thrift_protocol_write_message_end (protocol, error) < 0)
+    return FALSE;
+  if (!thrift_transport_flush (protocol->transport, error))
+    return FALSE;
+  if (!thrift_transport_write_end (protocol->transport, error))
+    return FALSE;
+
+  return TRUE;
+}
+
+gboolean bgp_configurator_client_recv_resume_notifications (BgpConfiguratorIf * iface, gint32* _return, GError ** error)
 {
-  gchar *name;
-  BgpConfiguratorProcessorProcessFunction function;
-} bgp_configurator_processor_process_function_def;
+  gint32 rseqid;
+  gchar * fname = NULL;
+  ThriftMessageType mtype;
+  ThriftProtocol * protocol = BGP_CONFIGURATOR_CLIENT (iface)->input_protocol;
+  ThriftApplicationException *xception;
 
-static gboolean
-bgp_configurator_processor_process_start_bgp (BgpConfiguratorProcessor *,
-                                              gint32,
-                                              ThriftProtocol *,
-                                              ThriftProtocol *,
-                                              GError **);
-static gboolean
-bgp_configurator_processor_process_stop_bgp (BgpConfiguratorProcessor *,
-                                             gint32,
-                                             ThriftProtocol *,
-                                             ThriftProtocol *,
-                                             GError **);
-static gboolean
-bgp_configurator_processor_process_create_peer (BgpConfiguratorProcessor *,
-                                                gint32,
-                                                ThriftProtocol *,
-                                                ThriftProtocol *,
-                                                GError **);
-static gboolean
-bgp_configurator_processor_process_delete_peer (BgpConfiguratorProcessor *,
-                                                gint32,
-                                                ThriftProtocol *,
-                                                ThriftProtocol *,
-                                                GError **);
-static gboolean
-bgp_configurator_processor_process_add_vrf (BgpConfiguratorProcessor *,
-                                            gint32,
-                                            ThriftProtocol *,
-                                            ThriftProtocol *,
-                                            GError **);
-static gboolean
-bgp_configurator_processor_process_del_vrf (BgpConfiguratorProcessor *,
-                                            gint32,
-                                            ThriftProtocol *,
-                                            ThriftProtocol *,
-                                            GError **);
-static gboolean
-bgp_configurator_processor_process_push_route (BgpConfiguratorProcessor *,
-                                               gint32,
-                                               ThriftProtocol *,
-                                               ThriftProtocol *,
-                                               GError **);
-static gboolean
-bgp_configurator_processor_process_withdraw_route (BgpConfiguratorProcessor *,
-                                                   gint32,
-                                                   ThriftProtocol *,
-                                                   ThriftProtocol *,
-                                                   GError **);
-static gboolean
-bgp_configurator_processor_process_set_ebgp_multihop (BgpConfiguratorProcessor *,
-                                                      gint32,
-                                                      ThriftProtocol *,
-                                                      ThriftProtocol *,
-                                                      GError **);
-static gboolean
-bgp_configurator_processor_process_unset_ebgp_multihop (BgpConfiguratorProcessor *,
-                                                        gint32,
-                                                        ThriftProtocol *,
-                                                        ThriftProtocol *,
-                                                        GError **);
-static gboolean
-bgp_configurator_processor_process_set_update_source (BgpConfiguratorProcessor *,
-                                                      gint32,
-                                                      ThriftProtocol *,
-                                                      ThriftProtocol *,
-                                                      GError **);
-static gboolean
-bgp_configurator_processor_process_unset_update_source (BgpConfiguratorProcessor *,
-                                                        gint32,
-                                                        ThriftProtocol *,
-                                                        ThriftProtocol *,
-                                                        GError **);
-static gboolean
-bgp_configurator_processor_process_enable_address_family (BgpConfiguratorProcessor *,
-                                                          gint32,
-                                                          ThriftProtocol *,
-                                                          ThriftProtocol *,
-                                                          GError **);
-static gboolean
-bgp_configurator_processor_process_disable_address_family (BgpConfiguratorProcessor *,
-                                                           gint32,
-                                                           ThriftProtocol *,
-                                                           ThriftProtocol *,
-                                                           GError **);
-static gboolean
-bgp_configurator_processor_process_set_log_config (BgpConfiguratorProcessor *,
-                                                   gint32,
-                                                   ThriftProtocol *,
-                                                   ThriftProtocol *,
-                                                   GError **);
-static gboolean
-bgp_configurator_processor_process_enable_graceful_restart (BgpConfiguratorProcessor *,
-                                                            gint32,
-                                                            ThriftProtocol *,
-                                                            ThriftProtocol *,
-                                                            GError **);
-static gboolean
-bgp_configurator_processor_process_disable_graceful_restart (BgpConfiguratorProcessor *,
-                                                             gint32,
-                                                             ThriftProtocol *,
-                                                             ThriftProtocol *,
-                                                             GError **);
-static gboolean
-bgp_configurator_processor_process_get_routes (BgpConfiguratorProcessor *,
-                                               gint32,
-                                               ThriftProtocol *,
-                                               ThriftProtocol *,
-                                               GError **);
-static gboolean
-bgp_configurator_processor_process_enable_multipath (BgpConfiguratorProcessor *,
-                                                     gint32,
-                                                     ThriftProtocol *,
-                                                     ThriftProtocol *,
-                                                     GError **);
-static gboolean
-bgp_configurator_processor_process_disable_multipath (BgpConfiguratorProcessor *,
-                                                      gint32,
-                                                      ThriftProtocol *,
-                                                      ThriftProtocol *,
-                                                      GError **);
-static gboolean
-bgp_configurator_processor_process_multipaths (BgpConfiguratorProcessor *,
-                                               gint32,
-                                               ThriftProtocol *,
-                                               ThriftProtocol *,
-                                               GError **);
+  if (thrift_protocol_read_message_begin (protocol, &fname, &mtype, &rseqid, error) < 0) {
+    if (fname) g_free (fname);
+    return FALSE;
+  }
+
+  if (mtype == T_EXCEPTION) {
+    if (fname) g_free (fname);
+    xception = g_object_new (THRIFT_TYPE_APPLICATION_EXCEPTION, NULL);
+    thrift_struct_read (THRIFT_STRUCT (xception), protocol, NULL);
+    thrift_protocol_read_message_end (protocol, NULL);
+    thrift_transport_read_end (protocol->transport, NULL);
+    g_set_error (error, THRIFT_APPLICATION_EXCEPTION_ERROR,xception->type, "application error: %s", xception->message);
+    g_object_unref (xception);
+    return FALSE;
+  } else if (mtype != T_REPLY) {
+    if (fname) g_free (fname);
+    thrift_protocol_skip (protocol, T_STRUCT, NULL);
+    thrift_protocol_read_message_end (protocol, NULL);
+    thrift_transport_read_end (protocol->transport, NULL);
+    g_set_error (error, THRIFT_APPLICATION_EXCEPTION_ERROR, THRIFT_APPLICATION_EXCEPTION_ERROR_INVALID_MESSAGE_TYPE, "invalid message type %d, expected T_REPLY", mtype);
+    return FALSE;
+  } else if (strncmp (fname, "resumeNotifications", 19) != 0) {
+    thrift_protocol_skip (protocol, T_STRUCT, NULL);
+    thrift_protocol_read_message_end (protocol,error);
+    thrift_transport_read_end (protocol->transport, error);
+    g_set_error (error, THRIFT_APPLICATION_EXCEPTION_ERROR, THRIFT_APPLICATION_EXCEPTION_ERROR_WRONG_METHOD_NAME, "wrong method name %s, expected resumeNotifications", fname);
+    if (fname) g_free (fname);
+    return FALSE;
+  }
+  if (fname) g_free (fname);
 
-static bgp_configurator_processor_process_function_def
-bgp_configurator_processor_process_function_defs[21] = {
-  {
-    (gchar *)"startBgp",
-    bgp_configurator_processor_process_start_bgp
-  },
-  {
-    (gchar *)"stopBgp",
-    bgp_configurator_processor_process_stop_bgp
-  },
-  {
-    (gchar *)"createPeer",
-    bgp_configurator_processor_process_create_peer
-  },
-  {
-    (gchar *)"deletePeer",
-    bgp_configurator_processor_process_delete_peer
-  },
-  {
-    (gchar *)"addVrf",
-    bgp_configurator_processor_process_add_vrf
-  },
-  {
-    (gchar *)"delVrf",
-    bgp_configurator_processor_process_del_vrf
-  },
-  {
-    (gchar *)"pushRoute",
-    bgp_configurator_processor_process_push_route
-  },
-  {
-    (gchar *)"withdrawRoute",
-    bgp_configurator_processor_process_withdraw_route
-  },
-  {
-    (gchar *)"setEbgpMultihop",
-    bgp_configurator_processor_process_set_ebgp_multihop
-  },
-  {
-    (gchar *)"unsetEbgpMultihop",
-    bgp_configurator_processor_process_unset_ebgp_multihop
-  },
-  {
-    (gchar *)"setUpdateSource",
-    bgp_configurator_processor_process_set_update_source
-  },
   {
-    (gchar *)"unsetUpdateSource",
+    gint32 ret;
+    gint32 xfer = 0;
+    gchar *name = NULL;
+    ThriftType ftype;
+    gint16 fid;
+    guint32 len = 0;
+    gpointer data = NULL;
+    
+
+    /* satisfy -Wall in case these aren't used */
+    THRIFT_UNUSED_VAR (len);
+    THRIFT_UNUSED_VAR (data);
+
+    /* read the struct begin marker */
+    if ((ret = thrift_protocol_read_struct_begin (protocol, &name, error)) < 0)
+    {
+      if (name) g_free (name);
+      return 0;
+    }
+    xfer += ret;
+    if (name) g_free (name);
+    name = NULL;
+
+    /* read the struct fields */
+    while (1)
+    {
+      /* read the beginning of a field */
+      if ((ret = thrift_protocol_read_field_begin (protocol, &name, &ftype, &fid, error)) < 0)
+      {
+        if (name) g_free (name);
+        return 0;
+      }
+      xfer += ret;
+      if (name) g_free (name);
+      name = NULL;
+
+      /* break if we get a STOP field */
+      if (ftype == T_STOP)
+      {
+        break;
+      }
+
+      switch (fid)
+      {
+        case 0:
+          if (ftype == T_I32)
+          {
+            if ((ret = thrift_protocol_read_i32 (protocol, &*_return, error)) < 0)
+              return 0;
+            xfer += ret;
+          } else {
+            if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
+              return 0;
+            xfer += ret;
+          }
+          break;
+        default:
+          if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
+            return 0;
+          xfer += ret;
+          break;
+      }
+      if ((ret = thrift_protocol_read_field_end (protocol, error)) < 0)
+        return 0;
+      xfer += ret;
+    }
+
+    if ((ret = thrift_protocol_read_struct_end (protocol, error)) < 0)
+      return 0;
+    xfer += ret;
+
+  }
+
+  if (thrift_protocol_read_message_end (protocol, error) < 0)
+    return FALSE;
+
+  if (!thrift_transport_read_end (protocol->transport, error))
+    return FALSE;
+
+  return TRUE;
+}
+
+gboolean bgp_configurator_client_resume_notifications (BgpConfiguratorIf * iface, gint32* _return, const gint64 fromSeq, GError ** error)
+{
+  if (!bgp_configurator_client_send_resume_notifications (iface, fromSeq, error))
+    return FALSE;
+  if (!bgp_configurator_client_recv_resume_notifications (iface, _return, error))
+    return FALSE;
+  return TRUE;
+}
+
+gboolean bgp_configurator_client_send_apply_config (BgpConfiguratorIf * iface, const ConfigSnapshot * snapshot, GError ** error)
+{
+  gint32 cseqid = 0;
+  ThriftProtocol * protocol = BGP_CONFIGURATOR_CLIENT (iface)->output_protocol;
+
+  if (thrift_protocol_write_message_begin (protocol, "applyConfig", T_CALL, cseqid, error) < 0)
+    return FALSE;
+
+  {
+    gint32 ret;
+    gint32 xfer = 0;
+
+    
+    if ((ret = thrift_protocol_write_struct_begin (protocol, "applyConfig_args", error)) < 0)
+      return 0;
+    xfer += ret;
+    if ((ret = thrift_protocol_write_field_begin (protocol, "snapshot", T_STRUCT, 1, error)) < 0)
+      return 0;
+    xfer += ret;
+    if ((ret = thrift_struct_write (THRIFT_STRUCT (snapshot), protocol, error)) < 0)
+      return 0;
+    xfer += ret;
+
+    if ((ret = thrift_protocol_write_field_end (protocol, error)) < 0)
+      return 0;
+    xfer += ret;
+    if ((ret = thrift_protocol_write_field_stop (protocol, error)) < 0)
+      return 0;
+    xfer += ret;
+    if ((ret = thrift_protocol_write_struct_end (protocol, error)) < 0)
+      return 0;
+    xfer += ret;
+
+  }
+
+  if (thrift_protocol_write_message_end (protocol, error) < 0)
+    return FALSE;
+  if (!thrift_transport_flush (protocol->transport, error))
+    return FALSE;
+  if (!thrift_transport_write_end (protocol->transport, error))
+    return FALSE;
+
+  return TRUE;
+}
+
+gboolean bgp_configurator_client_recv_apply_config (BgpConfiguratorIf * iface, gint32* _return, GError ** error)
+{
+  gint32 rseqid;
+  gchar * fname = NULL;
+  ThriftMessageType mtype;
+  ThriftProtocol * protocol = BGP_CONFIGURATOR_CLIENT (iface)->input_protocol;
+  ThriftApplicationException *xception;
+
+  if (thrift_protocol_read_message_begin (protocol, &fname, &mtype, &rseqid, error) < 0) {
+    if (fname) g_free (fname);
+    return FALSE;
+  }
+
+  if (mtype == T_EXCEPTION) {
+    if (fname) g_free (fname);
+    xception = g_object_new (THRIFT_TYPE_APPLICATION_EXCEPTION, NULL);
+    thrift_struct_read (THRIFT_STRUCT (xception), protocol, NULL);
+    thrift_protocol_read_message_end (protocol, NULL);
+    thrift_transport_read_end (protocol->transport, NULL);
+    g_set_error (error, THRIFT_APPLICATION_EXCEPTION_ERROR,xception->type, "application error: %s", xception->message);
+    g_object_unref (xception);
+    return FALSE;
+  } else if (mtype != T_REPLY) {
+    if (fname) g_free (fname);
+    thrift_protocol_skip (protocol, T_STRUCT, NULL);
+    thrift_protocol_read_message_end (protocol, NULL);
+    thrift_transport_read_end (protocol->transport, NULL);
+    g_set_error (error, THRIFT_APPLICATION_EXCEPTION_ERROR, THRIFT_APPLICATION_EXCEPTION_ERROR_INVALID_MESSAGE_TYPE, "invalid message type %d, expected T_REPLY", mtype);
+    return FALSE;
+  } else if (strncmp (fname, "applyConfig", 11) != 0) {
+    thrift_protocol_skip (protocol, T_STRUCT, NULL);
+    thrift_protocol_read_message_end (protocol,error);
+    thrift_transport_read_end (protocol->transport, error);
+    g_set_error (error, THRIFT_APPLICATION_EXCEPTION_ERROR, THRIFT_APPLICATION_EXCEPTION_ERROR_WRONG_METHOD_NAME, "wrong method name %s, expected applyConfig", fname);
+    if (fname) g_free (fname);
+    return FALSE;
+  }
+  if (fname) g_free (fname);
+
+  {
+    gint32 ret;
+    gint32 xfer = 0;
+    gchar *name = NULL;
+    ThriftType ftype;
+    gint16 fid;
+    guint32 len = 0;
+    gpointer data = NULL;
+    
+
+    /* satisfy -Wall in case these aren't used */
+    THRIFT_UNUSED_VAR (len);
+    THRIFT_UNUSED_VAR (data);
+
+    /* read the struct begin marker */
+    if ((ret = thrift_protocol_read_struct_begin (protocol, &name, error)) < 0)
+    {
+      if (name) g_free (name);
+      return 0;
+    }
+    xfer += ret;
+    if (name) g_free (name);
+    name = NULL;
+
+    /* read the struct fields */
+    while (1)
+    {
+      /* read the beginning of a field */
+      if ((ret = thrift_protocol_read_field_begin (protocol, &name, &ftype, &fid, error)) < 0)
+      {
+        if (name) g_free (name);
+        return 0;
+      }
+      xfer += ret;
+      if (name) g_free (name);
+      name = NULL;
+
+      /* break if we get a STOP field */
+      if (ftype == T_STOP)
+      {
+        break;
+      }
+
+      switch (fid)
+      {
+        case 0:
+          if (ftype == T_I32)
+          {
+            if ((ret = thrift_protocol_read_i32 (protocol, &*_return, error)) < 0)
+              return 0;
+            xfer += ret;
+          } else {
+            if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
+              return 0;
+            xfer += ret;
+          }
+          break;
+        default:
+          if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
+            return 0;
+          xfer += ret;
+          break;
+      }
+      if ((ret = thrift_protocol_read_field_end (protocol, error)) < 0)
+        return 0;
+      xfer += ret;
+    }
+
+    if ((ret = thrift_protocol_read_struct_end (protocol, error)) < 0)
+      return 0;
+    xfer += ret;
+
+  }
+
+  if (thrift_protocol_read_message_end (protocol, error) < 0)
+    return FALSE;
+
+  if (!thrift_transport_read_end (protocol->transport, error))
+    return FALSE;
+
+  return TRUE;
+}
+
+gboolean bgp_configurator_client_apply_config (BgpConfiguratorIf * iface, gint32* _return, const ConfigSnapshot * snapshot, GError ** error)
+{
+  if (!bgp_configurator_client_send_apply_config (iface, snapshot, error))
+    return FALSE;
+  if (!bgp_configurator_client_recv_apply_config (iface, _return, error))
+    return FALSE;
+  return TRUE;
+}
+
+static void
+bgp_configurator_if_interface_init (BgpConfiguratorIfInterface *iface)
+{
+  iface->start_bgp = bgp_configurator_client_start_bgp;
+  iface->stop_bgp = bgp_configurator_client_stop_bgp;
+  iface->create_peer = bgp_configurator_client_create_peer;
+  iface->delete_peer = bgp_configurator_client_delete_peer;
+  iface->add_vrf = bgp_configurator_client_add_vrf;
+  iface->del_vrf = bgp_configurator_client_del_vrf;
+  iface->push_route = bgp_configurator_client_push_route;
+  iface->withdraw_route = bgp_configurator_client_withdraw_route;
+  iface->set_ebgp_multihop = bgp_configurator_client_set_ebgp_multihop;
+  iface->unset_ebgp_multihop = bgp_configurator_client_unset_ebgp_multihop;
+  iface->set_update_source = bgp_configurator_client_set_update_source;
+  iface->unset_update_source = bgp_configurator_client_unset_update_source;
+  iface->enable_address_family = bgp_configurator_client_enable_address_family;
+  iface->disable_address_family = bgp_configurator_client_disable_address_family;
+  iface->set_log_config = bgp_configurator_client_set_log_config;
+  iface->enable_graceful_restart = bgp_configurator_client_enable_graceful_restart;
+  iface->disable_graceful_restart = bgp_configurator_client_disable_graceful_restart;
+  iface->get_routes = bgp_configurator_client_get_routes;
+  iface->enable_multipath = bgp_configurator_client_enable_multipath;
+  iface->disable_multipath = bgp_configurator_client_disable_multipath;
+  iface->multipaths = bgp_configurator_client_multipaths;
+  iface->push_routes = bgp_configurator_client_push_routes;
+  iface->withdraw_routes = bgp_configurator_client_withdraw_routes;
+  iface->resume_notifications = bgp_configurator_client_resume_notifications;
+  iface->apply_config = bgp_configurator_client_apply_config;
+}
+
+static void
+bgp_configurator_client_init (BgpConfiguratorClient *client)
+{
+  client->input_protocol = NULL;
+  client->output_protocol = NULL;
+}
+
+static void
+bgp_configurator_client_class_init (BgpConfiguratorClientClass *cls)
+{
+  GObjectClass *gobject_class = G_OBJECT_CLASS (cls);
+  GParamSpec *param_spec;
+
+  gobject_class->set_property = bgp_configurator_client_set_property;
+  gobject_class->get_property = bgp_configurator_client_get_property;
+
+  param_spec = g_param_spec_object ("input_protocol",
+                                    "input protocol (construct)",
+                                    "Set the client input protocol",
+                                    THRIFT_TYPE_PROTOCOL,
+                                    G_PARAM_READWRITE);
+  g_object_class_install_property (gobject_class,
+                                   PROP_BGP_CONFIGURATOR_CLIENT_INPUT_PROTOCOL, param_spec);
+
+  param_spec = g_param_spec_object ("output_protocol",
+                                    "output protocol (construct)",
+                                    "Set the client output protocol",
+                                    THRIFT_TYPE_PROTOCOL,
+                                    G_PARAM_READWRITE);
+  g_object_class_install_property (gobject_class,
+                                   PROP_BGP_CONFIGURATOR_CLIENT_OUTPUT_PROTOCOL, param_spec);
+}
+
+static void
+bgp_configurator_handler_bgp_configurator_if_interface_init (BgpConfiguratorIfInterface *iface);
+
+G_DEFINE_TYPE_WITH_CODE (BgpConfiguratorHandler, 
+                         bgp_configurator_handler,
+                         G_TYPE_OBJECT,
+                         G_IMPLEMENT_INTERFACE (TYPE_BGP_CONFIGURATOR_IF,
+                                                bgp_configurator_handler_bgp_configurator_if_interface_init))
+
+gboolean bgp_configurator_handler_start_bgp (BgpConfiguratorIf * iface, gint32* _return, const gint64 asNumber, const gchar * routerId, const gint32 port, const gint32 holdTime, const gint32 keepAliveTime, const gint32 stalepathTime, const gboolean announceFbit, GError ** error)
+{
+  g_return_val_if_fail (IS_BGP_CONFIGURATOR_HANDLER (iface), FALSE);
+
+  return BGP_CONFIGURATOR_HANDLER_GET_CLASS (iface)->start_bgp (iface, _return, asNumber, routerId, port, holdTime, keepAliveTime, stalepathTime, announceFbit, error);
+}
+
+gboolean bgp_configurator_handler_stop_bgp (BgpConfiguratorIf * iface, gint32* _return, const gint64 asNumber, GError ** error)
+{
+  g_return_val_if_fail (IS_BGP_CONFIGURATOR_HANDLER (iface), FALSE);
+
+  return BGP_CONFIGURATOR_HANDLER_GET_CLASS (iface)->stop_bgp (iface, _return, asNumber, error);
+}
+
+gboolean bgp_configurator_handler_create_peer (BgpConfiguratorIf * iface, gint32* _return, const gchar * ipAddress, const gint64 asNumber, GError ** error)
+{
+  g_return_val_if_fail (IS_BGP_CONFIGURATOR_HANDLER (iface), FALSE);
+
+  return BGP_CONFIGURATOR_HANDLER_GET_CLASS (iface)->create_peer (iface, _return, ipAddress, asNumber, error);
+}
+
+gboolean bgp_configurator_handler_delete_peer (BgpConfiguratorIf * iface, gint32* _return, const gchar * ipAddress, GError ** error)
+{
+  g_return_val_if_fail (IS_BGP_CONFIGURATOR_HANDLER (iface), FALSE);
+
+  return BGP_CONFIGURATOR_HANDLER_GET_CLASS (iface)->delete_peer (iface, _return, ipAddress, error);
+}
+
+gboolean bgp_configurator_handler_add_vrf (BgpConfiguratorIf * iface, gint32* _return, const gchar * rd, const GPtrArray * irts, const GPtrArray * erts, GError ** error)
+{
+  g_return_val_if_fail (IS_BGP_CONFIGURATOR_HANDLER (iface), FALSE);
+
+  return BGP_CONFIGURATOR_HANDLER_GET_CLASS (iface)->add_vrf (iface, _return, rd, irts, erts, error);
+}
+
+gboolean bgp_configurator_handler_del_vrf (BgpConfiguratorIf * iface, gint32* _return, const gchar * rd, GError ** error)
+{
+  g_return_val_if_fail (IS_BGP_CONFIGURATOR_HANDLER (iface), FALSE);
+
+  return BGP_CONFIGURATOR_HANDLER_GET_CLASS (iface)->del_vrf (iface, _return, rd, error);
+}
+
+gboolean bgp_configurator_handler_push_route (BgpConfiguratorIf * iface, gint32* _return, const gchar * prefix, const gchar * nexthop, const gchar * rd, const gint32 label, GError ** error)
+{
+  g_return_val_if_fail (IS_BGP_CONFIGURATOR_HANDLER (iface), FALSE);
+
+  return BGP_CONFIGURATOR_HANDLER_GET_CLASS (iface)->push_route (iface, _return, prefix, nexthop, rd, label, error);
+}
+
+gboolean bgp_configurator_handler_withdraw_route (BgpConfiguratorIf * iface, gint32* _return, const gchar * prefix, const gchar * rd, GError ** error)
+{
+  g_return_val_if_fail (IS_BGP_CONFIGURATOR_HANDLER (iface), FALSE);
+
+  return BGP_CONFIGURATOR_HANDLER_GET_CLASS (iface)->withdraw_route (iface, _return, prefix, rd, error);
+}
+
+gboolean bgp_configurator_handler_set_ebgp_multihop (BgpConfiguratorIf * iface, gint32* _return, const gchar * peerIp, const gint32 nHops, GError ** error)
+{
+  g_return_val_if_fail (IS_BGP_CONFIGURATOR_HANDLER (iface), FALSE);
+
+  return BGP_CONFIGURATOR_HANDLER_GET_CLASS (iface)->set_ebgp_multihop (iface, _return, peerIp, nHops, error);
+}
+
+gboolean bgp_configurator_handler_unset_ebgp_multihop (BgpConfiguratorIf * iface, gint32* _return, const gchar * peerIp, GError ** error)
+{
+  g_return_val_if_fail (IS_BGP_CONFIGURATOR_HANDLER (iface), FALSE);
+
+  return BGP_CONFIGURATOR_HANDLER_GET_CLASS (iface)->unset_ebgp_multihop (iface, _return, peerIp, error);
+}
+
+gboolean bgp_configurator_handler_set_update_source (BgpConfiguratorIf * iface, gint32* _return, const gchar * peerIp, const gchar * srcIp, GError ** error)
+{
+  g_return_val_if_fail (IS_BGP_CONFIGURATOR_HANDLER (iface), FALSE);
+
+  return BGP_CONFIGURATOR_HANDLER_GET_CLASS (iface)->set_update_source (iface, _return, peerIp, srcIp, error);
+}
+
+gboolean bgp_configurator_handler_unset_update_source (BgpConfiguratorIf * iface, gint32* _return, const gchar * peerIp, GError ** error)
+{
+  g_return_val_if_fail (IS_BGP_CONFIGURATOR_HANDLER (iface), FALSE);
+
+  return BGP_CONFIGURATOR_HANDLER_GET_CLASS (iface)->unset_update_source (iface, _return, peerIp, error);
+}
+
+gboolean bgp_configurator_handler_enable_address_family (BgpConfiguratorIf * iface, gint32* _return, const gchar * peerIp, const af_afi afi, const af_safi safi, GError ** error)
+{
+  g_return_val_if_fail (IS_BGP_CONFIGURATOR_HANDLER (iface), FALSE);
+
+  return BGP_CONFIGURATOR_HANDLER_GET_CLASS (iface)->enable_address_family (iface, _return, peerIp, afi, safi, error);
+}
+
+gboolean bgp_configurator_handler_disable_address_family (BgpConfiguratorIf * iface, gint32* _return, const gchar * peerIp, const af_afi afi, const af_safi safi, GError ** error)
+{
+  g_return_val_if_fail (IS_BGP_CONFIGURATOR_HANDLER (iface), FALSE);
+
+  return BGP_CONFIGURATOR_HANDLER_GET_CLASS (iface)->disable_address_family (iface, _return, peerIp, afi, safi, error);
+}
+
+gboolean bgp_configurator_handler_set_log_config (BgpConfiguratorIf * iface, gint32* _return, const gchar * logFileName, const gchar * logLevel, GError ** error)
+{
+  g_return_val_if_fail (IS_BGP_CONFIGURATOR_HANDLER (iface), FALSE);
+
+  return BGP_CONFIGURATOR_HANDLER_GET_CLASS (iface)->set_log_config (iface, _return, logFileName, logLevel, error);
+}
+
+gboolean bgp_configurator_handler_enable_graceful_restart (BgpConfiguratorIf * iface, gint32* _return, const gint32 stalepathTime, GError ** error)
+{
+  g_return_val_if_fail (IS_BGP_CONFIGURATOR_HANDLER (iface), FALSE);
+
+  return BGP_CONFIGURATOR_HANDLER_GET_CLASS (iface)->enable_graceful_restart (iface, _return, stalepathTime, error);
+}
+
+gboolean bgp_configurator_handler_disable_graceful_restart (BgpConfiguratorIf * iface, gint32* _return, GError ** error)
+{
+  g_return_val_if_fail (IS_BGP_CONFIGURATOR_HANDLER (iface), FALSE);
+
+  return BGP_CONFIGURATOR_HANDLER_GET_CLASS (iface)->disable_graceful_restart (iface, _return, error);
+}
+
+gboolean bgp_configurator_handler_get_routes (BgpConfiguratorIf * iface, Routes ** _return, const gint32 optype, const gint32 winSize, GError ** error)
+{
+  g_return_val_if_fail (IS_BGP_CONFIGURATOR_HANDLER (iface), FALSE);
+
+  return BGP_CONFIGURATOR_HANDLER_GET_CLASS (iface)->get_routes (iface, _return, optype, winSize, error);
+}
+
+gboolean bgp_configurator_handler_enable_multipath (BgpConfiguratorIf * iface, gint32* _return, const af_afi afi, const af_safi safi, GError ** error)
+{
+  g_return_val_if_fail (IS_BGP_CONFIGURATOR_HANDLER (iface), FALSE);
+
+  return BGP_CONFIGURATOR_HANDLER_GET_CLASS (iface)->enable_multipath (iface, _return, afi, safi, error);
+}
+
+gboolean bgp_configurator_handler_disable_multipath (BgpConfiguratorIf * iface, gint32* _return, const af_afi afi, const af_safi safi, GError ** error)
+{
+  g_return_val_if_fail (IS_BGP_CONFIGURATOR_HANDLER (iface), FALSE);
+
+  return BGP_CONFIGURATOR_HANDLER_GET_CLASS (iface)->disable_multipath (iface, _return, afi, safi, error);
+}
+
+gboolean bgp_configurator_handler_multipaths (BgpConfiguratorIf * iface, gint32* _return, const gchar * rd, const gint32 maxPath, GError ** error)
+{
+  g_return_val_if_fail (IS_BGP_CONFIGURATOR_HANDLER (iface), FALSE);
+
+  return BGP_CONFIGURATOR_HANDLER_GET_CLASS (iface)->multipaths (iface, _return, rd, maxPath, error);
+}
+
+gboolean bgp_configurator_handler_push_routes (BgpConfiguratorIf * iface, GArray ** _return, const GPtrArray * routes, GError ** error)
+{
+  g_return_val_if_fail (IS_BGP_CONFIGURATOR_HANDLER (iface), FALSE);
+
+  return BGP_CONFIGURATOR_HANDLER_GET_CLASS (iface)->push_routes (iface, _return, routes, error);
+}
+
+gboolean bgp_configurator_handler_withdraw_routes (BgpConfiguratorIf * iface, GArray ** _return, const GPtrArray * routes, GError ** error)
+{
+  g_return_val_if_fail (IS_BGP_CONFIGURATOR_HANDLER (iface), FALSE);
+
+  return BGP_CONFIGURATOR_HANDLER_GET_CLASS (iface)->withdraw_routes (iface, _return, routes, error);
+}
+
+gboolean bgp_configurator_handler_resume_notifications (BgpConfiguratorIf * iface, gint32* _return, const gint64 fromSeq, GError ** error)
+{
+  g_return_val_if_fail (IS_BGP_CONFIGURATOR_HANDLER (iface), FALSE);
+
+  return BGP_CONFIGURATOR_HANDLER_GET_CLASS (iface)->resume_notifications (iface, _return, fromSeq, error);
+}
+
+gboolean bgp_configurator_handler_apply_config (BgpConfiguratorIf * iface, gint32* _return, const ConfigSnapshot * snapshot, GError ** error)
+{
+  g_return_val_if_fail (IS_BGP_CONFIGURATOR_HANDLER (iface), FALSE);
+
+  return BGP_CONFIGURATOR_HANDLER_GET_CLASS (iface)->apply_config (iface, _return, snapshot, error);
+}
+
+static void
+bgp_configurator_handler_bgp_configurator_if_interface_init (BgpConfiguratorIfInterface *iface)
+{
+  iface->start_bgp = bgp_configurator_handler_start_bgp;
+  iface->stop_bgp = bgp_configurator_handler_stop_bgp;
+  iface->create_peer = bgp_configurator_handler_create_peer;
+  iface->delete_peer = bgp_configurator_handler_delete_peer;
+  iface->add_vrf = bgp_configurator_handler_add_vrf;
+  iface->del_vrf = bgp_configurator_handler_del_vrf;
+  iface->push_route = bgp_configurator_handler_push_route;
+  iface->withdraw_route = bgp_configurator_handler_withdraw_route;
+  iface->set_ebgp_multihop = bgp_configurator_handler_set_ebgp_multihop;
+  iface->unset_ebgp_multihop = bgp_configurator_handler_unset_ebgp_multihop;
+  iface->set_update_source = bgp_configurator_handler_set_update_source;
+  iface->unset_update_source = bgp_configurator_handler_unset_update_source;
+  iface->enable_address_family = bgp_configurator_handler_enable_address_family;
+  iface->disable_address_family = bgp_configurator_handler_disable_address_family;
+  iface->set_log_config = bgp_configurator_handler_set_log_config;
+  iface->enable_graceful_restart = bgp_configurator_handler_enable_graceful_restart;
+  iface->disable_graceful_restart = bgp_configurator_handler_disable_graceful_restart;
+  iface->get_routes = bgp_configurator_handler_get_routes;
+  iface->enable_multipath = bgp_configurator_handler_enable_multipath;
+  iface->disable_multipath = bgp_configurator_handler_disable_multipath;
+  iface->multipaths = bgp_configurator_handler_multipaths;
+  iface->push_routes = bgp_configurator_handler_push_routes;
+  iface->withdraw_routes = bgp_configurator_handler_withdraw_routes;
+  iface->resume_notifications = bgp_configurator_handler_resume_notifications;
+  iface->apply_config = bgp_configurator_handler_apply_config;
+}
+
+static void
+bgp_configurator_handler_init (BgpConfiguratorHandler *self)
+{
+  THRIFT_UNUSED_VAR (self);
+}
+
+static void
+bgp_configurator_handler_class_init (BgpConfiguratorHandlerClass *cls)
+{
+  cls->start_bgp = NULL;
+  cls->stop_bgp = NULL;
+  cls->create_peer = NULL;
+  cls->delete_peer = NULL;
+  cls->add_vrf = NULL;
+  cls->del_vrf = NULL;
+  cls->push_route = NULL;
+  cls->withdraw_route = NULL;
+  cls->set_ebgp_multihop = NULL;
+  cls->unset_ebgp_multihop = NULL;
+  cls->set_update_source = NULL;
+  cls->unset_update_source = NULL;
+  cls->enable_address_family = NULL;
+  cls->disable_address_family = NULL;
+  cls->set_log_config = NULL;
+  cls->enable_graceful_restart = NULL;
+  cls->disable_graceful_restart = NULL;
+  cls->get_routes = NULL;
+  cls->enable_multipath = NULL;
+  cls->disable_multipath = NULL;
+  cls->multipaths = NULL;
+  cls->push_routes = NULL;
+  cls->withdraw_routes = NULL;
+  cls->resume_notifications = NULL;
+  cls->apply_config = NULL;
+}
+
+enum _BgpConfiguratorProcessorProperties
+{
+  PROP_BGP_CONFIGURATOR_PROCESSOR_0,
+  PROP_BGP_CONFIGURATOR_PROCESSOR_HANDLER
+};
+
+G_DEFINE_TYPE (BgpConfiguratorProcessor,
+               bgp_configurator_processor,
+               THRIFT_TYPE_DISPATCH_PROCESSOR)
+
+typedef gboolean (* BgpConfiguratorProcessorProcessFunction) (BgpConfiguratorProcessor *, 
+                                                              gint32,
+                                                              ThriftProtocol *,
+                                                              ThriftProtocol *,
+                                                              GError **);
+
+typedef struct
+{
+  gchar *name;
+  BgpConfiguratorProcessorProcessFunction function;
+} bgp_configurator_processor_process_function_def;
+
+static gboolean
+bgp_configurator_processor_process_start_bgp (BgpConfiguratorProcessor *,
+                                              gint32,
+                                              ThriftProtocol *,
+                                              ThriftProtocol *,
+                                              GError **);
+static gboolean
+bgp_configurator_processor_process_stop_bgp (BgpConfiguratorProcessor *,
+                                             gint32,
+                                             ThriftProtocol *,
+                                             ThriftProtocol *,
+                                             GError **);
+static gboolean
+bgp_configurator_processor_process_create_peer (BgpConfiguratorProcessor *,
+                                                gint32,
+                                                ThriftProtocol *,
+                                                ThriftProtocol *,
+                                                GError **);
+static gboolean
+bgp_configurator_processor_process_delete_peer (BgpConfiguratorProcessor *,
+                                                gint32,
+                                                ThriftProtocol *,
+                                                ThriftProtocol *,
+                                                GError **);
+static gboolean
+bgp_configurator_processor_process_add_vrf (BgpConfiguratorProcessor *,
+                                            gint32,
+                                            ThriftProtocol *,
+                                            ThriftProtocol *,
+                                            GError **);
+static gboolean
+bgp_configurator_processor_process_del_vrf (BgpConfiguratorProcessor *,
+                                            gint32,
+                                            ThriftProtocol *,
+                                            ThriftProtocol *,
+                                            GError **);
+static gboolean
+bgp_configurator_processor_process_push_route (BgpConfiguratorProcessor *,
+                                               gint32,
+                                               ThriftProtocol *,
+                                               ThriftProtocol *,
+                                               GError **);
+static gboolean
+bgp_configurator_processor_process_withdraw_route (BgpConfiguratorProcessor *,
+                                                   gint32,
+                                                   ThriftProtocol *,
+                                                   ThriftProtocol *,
+                                                   GError **);
+static gboolean
+bgp_configurator_processor_process_set_ebgp_multihop (BgpConfiguratorProcessor *,
+                                                      gint32,
+                                                      ThriftProtocol *,
+                                                      ThriftProtocol *,
+                                                      GError **);
+static gboolean
+bgp_configurator_processor_process_unset_ebgp_multihop (BgpConfiguratorProcessor *,
+                                                        gint32,
+                                                        ThriftProtocol *,
+                                                        ThriftProtocol *,
+                                                        GError **);
+static gboolean
+bgp_configurator_processor_process_set_update_source (BgpConfiguratorProcessor *,
+                                                      gint32,
+                                                      ThriftProtocol *,
+                                                      ThriftProtocol *,
+                                                      GError **);
+static gboolean
+bgp_configurator_processor_process_unset_update_source (BgpConfiguratorProcessor *,
+                                                        gint32,
+                                                        ThriftProtocol *,
+                                                        ThriftProtocol *,
+                                                        GError **);
+static gboolean
+bgp_configurator_processor_process_enable_address_family (BgpConfiguratorProcessor *,
+                                                          gint32,
+                                                          ThriftProtocol *,
+                                                          ThriftProtocol *,
+                                                          GError **);
+static gboolean
+bgp_configurator_processor_process_disable_address_family (BgpConfiguratorProcessor *,
+                                                           gint32,
+                                                           ThriftProtocol *,
+                                                           ThriftProtocol *,
+                                                           GError **);
+static gboolean
+bgp_configurator_processor_process_set_log_config (BgpConfiguratorProcessor *,
+                                                   gint32,
+                                                   ThriftProtocol *,
+                                                   ThriftProtocol *,
+                                                   GError **);
+static gboolean
+bgp_configurator_processor_process_enable_graceful_restart (BgpConfiguratorProcessor *,
+                                                            gint32,
+                                                            ThriftProtocol *,
+                                                            ThriftProtocol *,
+                                                            GError **);
+static gboolean
+bgp_configurator_processor_process_disable_graceful_restart (BgpConfiguratorProcessor *,
+                                                             gint32,
+                                                             ThriftProtocol *,
+                                                             ThriftProtocol *,
+                                                             GError **);
+static gboolean
+bgp_configurator_processor_process_get_routes (BgpConfiguratorProcessor *,
+                                               gint32,
+                                               ThriftProtocol *,
+                                               ThriftProtocol *,
+                                               GError **);
+static gboolean
+bgp_configurator_processor_process_enable_multipath (BgpConfiguratorProcessor *,
+                                                     gint32,
+                                                     ThriftProtocol *,
+                                                     ThriftProtocol *,
+                                                     GError **);
+static gboolean
+bgp_configurator_processor_process_disable_multipath (BgpConfiguratorProcessor *,
+                                                      gint32,
+                                                      ThriftProtocol *,
+                                                      ThriftProtocol *,
+                                                      GError **);
+static gboolean
+bgp_configurator_processor_process_multipaths (BgpConfiguratorProcessor *,
+                                               gint32,
+                                               ThriftProtocol *,
+                                               ThriftProtocol *,
+                                               GError **);
+static gboolean
+bgp_configurator_processor_process_push_routes (BgpConfiguratorProcessor *,
+                                                gint32,
+                                                ThriftProtocol *,
+                                                ThriftProtocol *,
+                                                GError **);
+static gboolean
+bgp_configurator_processor_process_withdraw_routes (BgpConfiguratorProcessor *,
+                                                    gint32,
+                                                    ThriftProtocol *,
+                                                    ThriftProtocol *,
+                                                    GError **);
+static gboolean
+bgp_configurator_processor_process_resume_notifications (BgpConfiguratorProcessor *,
+                                                         gint32,
+                                                         ThriftProtocol *,
+                                                         ThriftProtocol *,
+                                                         GError **);
+static gboolean
+bgp_configurator_processor_process_apply_config (BgpConfiguratorProcessor *,
+                                                 gint32,
+                                                 ThriftProtocol *,
+                                                 ThriftProtocol *,
+                                                 GError **);
+
+static bgp_configurator_processor_process_function_def
+bgp_configurator_processor_process_function_defs[25] = {
+  {
+    (gchar *)"startBgp",
+    bgp_configurator_processor_process_start_bgp
+  },
+  {
+    (gchar *)"stopBgp",
+    bgp_configurator_processor_process_stop_bgp
+  },
+  {
+    (gchar *)"createPeer",
+    bgp_configurator_processor_process_create_peer
+  },
+  {
+    (gchar *)"deletePeer",
+    bgp_configurator_processor_process_delete_peer
+  },
+  {
+    (gchar *)"addVrf",
+    bgp_configurator_processor_process_add_vrf
+  },
+  {
+    (gchar *)"delVrf",
+    bgp_configurator_processor_process_del_vrf
+  },
+  {
+    (gchar *)"pushRoute",
+    bgp_configurator_processor_process_push_route
+  },
+  {
+    (gchar *)"withdrawRoute",
+    bgp_configurator_processor_process_withdraw_route
+  },
+  {
+    (gchar *)"setEbgpMultihop",
+    bgp_configurator_processor_process_set_ebgp_multihop
+  },
+  {
+    (gchar *)"unsetEbgpMultihop",
+    bgp_configurator_processor_process_unset_ebgp_multihop
+  },
+  {
+    (gchar *)"setUpdateSource",
+    bgp_configurator_processor_process_set_update_source
+  },
+  {
+    (gchar *)"unsetUpdateSource",
     bgp_configurator_processor_process_unset_update_source
   },
   {
@@ -4663,31 +5519,450 @@ bgp_configurator_processor_process_function_defs[21] = {
     bgp_configurator_processor_process_get_routes
   },
   {
-    (gchar *)"enableMultipath",
-    bgp_configurator_processor_process_enable_multipath
-  },
+    (gchar *)"enableMultipath",
+    bgp_configurator_processor_process_enable_multipath
+  },
+  {
+    (gchar *)"disableMultipath",
+    bgp_configurator_processor_process_disable_multipath
+  },
+  {
+    (gchar *)"multipaths",
+    bgp_configurator_processor_process_multipaths
+  },
+  {
+    (gchar *)"pushRoutes",
+    bgp_configurator_processor_process_push_routes
+  },
+  {
+    (gchar *)"withdrawRoutes",
+    bgp_configurator_processor_process_withdraw_routes
+  },
+  {
+    (gchar *)"resumeNotifications",
+    bgp_configurator_processor_process_resume_notifications
+  },
+  {
+    (gchar *)"applyConfig",
+    bgp_configurator_processor_process_apply_config
+  }
+};
+
+static gboolean
+bgp_configurator_processor_process_start_bgp (BgpConfiguratorProcessor *self,
+                                              gint32 sequence_id,
+                                              ThriftProtocol *input_protocol,
+                                              ThriftProtocol *output_protocol,
+                                              GError **error)
+{
+  gboolean result = TRUE;
+  ThriftTransport * transport;
+  ThriftApplicationException *xception;
+  BgpConfiguratorStartBgpArgs * args =
+    g_object_new (TYPE_BGP_CONFIGURATOR_START_BGP_ARGS, NULL);
+
+  g_object_get (input_protocol, "transport", &transport, NULL);
+
+  if ((thrift_struct_read (THRIFT_STRUCT (args), input_protocol, error) != -1) &&
+      (thrift_protocol_read_message_end (input_protocol, error) != -1) &&
+      (thrift_transport_read_end (transport, error) != FALSE))
+  {
+    gint64 asNumber;
+    gchar * routerId;
+    gint port;
+    gint holdTime;
+    gint keepAliveTime;
+    gint stalepathTime;
+    gboolean announceFbit;
+    gint return_value;
+    BgpConfiguratorStartBgpResult * result_struct;
+
+    g_object_get (args,
+                  "asNumber", &asNumber,
+                  "routerId", &routerId,
+                  "port", &port,
+                  "holdTime", &holdTime,
+                  "keepAliveTime", &keepAliveTime,
+                  "stalepathTime", &stalepathTime,
+                  "announceFbit", &announceFbit,
+                  NULL);
+
+    g_object_unref (transport);
+    g_object_get (output_protocol, "transport", &transport, NULL);
+
+    result_struct = g_object_new (TYPE_BGP_CONFIGURATOR_START_BGP_RESULT, NULL);
+    g_object_get (result_struct, "success", &return_value, NULL);
+
+    if (bgp_configurator_handler_start_bgp (BGP_CONFIGURATOR_IF (self->handler),
+                                            (gint32 *)&return_value,
+                                            asNumber,
+                                            routerId,
+                                            port,
+                                            holdTime,
+                                            keepAliveTime,
+                                            stalepathTime,
+                                            announceFbit,
+                                            error) == TRUE)
+    {
+      g_object_set (result_struct, "success", (gint)(gint32)return_value, NULL);
+
+      result =
+        ((thrift_protocol_write_message_begin (output_protocol,
+                                               "startBgp",
+                                               T_REPLY,
+                                               sequence_id,
+                                               error) != -1) &&
+         (thrift_struct_write (THRIFT_STRUCT (result_struct),
+                               output_protocol,
+                               error) != -1));
+    }
+    else
+    {
+      if (*error == NULL)
+        g_warning ("BgpConfigurator.startBgp implementation returned FALSE "
+                   "but did not set an error");
+
+      xception =
+        g_object_new (THRIFT_TYPE_APPLICATION_EXCEPTION,
+                      "type",    *error != NULL ? (*error)->code :
+                                 THRIFT_APPLICATION_EXCEPTION_ERROR_UNKNOWN,
+                      "message", *error != NULL ? (*error)->message : NULL,
+                      NULL);
+      g_clear_error (error);
+
+      result =
+        ((thrift_protocol_write_message_begin (output_protocol,
+                                               "startBgp",
+                                               T_EXCEPTION,
+                                               sequence_id,
+                                               error) != -1) &&
+         (thrift_struct_write (THRIFT_STRUCT (xception),
+                               output_protocol,
+                               error) != -1));
+
+      g_object_unref (xception);
+    }
+
+    if (routerId != NULL)
+      g_free (routerId);
+    g_object_unref (result_struct);
+
+    if (result == TRUE)
+      result =
+        ((thrift_protocol_write_message_end (output_protocol, error) != -1) &&
+         (thrift_transport_write_end (transport, error) != FALSE) &&
+         (thrift_transport_flush (transport, error) != FALSE));
+  }
+  else
+    result = FALSE;
+
+  g_object_unref (transport);
+  g_object_unref (args);
+
+  return result;
+}
+
+static gboolean
+bgp_configurator_processor_process_stop_bgp (BgpConfiguratorProcessor *self,
+                                             gint32 sequence_id,
+                                             ThriftProtocol *input_protocol,
+                                             ThriftProtocol *output_protocol,
+                                             GError **error)
+{
+  gboolean result = TRUE;
+  ThriftTransport * transport;
+  ThriftApplicationException *xception;
+  BgpConfiguratorStopBgpArgs * args =
+    g_object_new (TYPE_BGP_CONFIGURATOR_STOP_BGP_ARGS, NULL);
+
+  g_object_get (input_protocol, "transport", &transport, NULL);
+
+  if ((thrift_struct_read (THRIFT_STRUCT (args), input_protocol, error) != -1) &&
+      (thrift_protocol_read_message_end (input_protocol, error) != -1) &&
+      (thrift_transport_read_end (transport, error) != FALSE))
+  {
+    gint64 asNumber;
+    gint return_value;
+    BgpConfiguratorStopBgpResult * result_struct;
+
+    g_object_get (args,
+                  "asNumber", &asNumber,
+                  NULL);
+
+    g_object_unref (transport);
+    g_object_get (output_protocol, "transport", &transport, NULL);
+
+    result_struct = g_object_new (TYPE_BGP_CONFIGURATOR_STOP_BGP_RESULT, NULL);
+    g_object_get (result_struct, "success", &return_value, NULL);
+
+    if (bgp_configurator_handler_stop_bgp (BGP_CONFIGURATOR_IF (self->handler),
+                                           (gint32 *)&return_value,
+                                           asNumber,
+                                           error) == TRUE)
+    {
+      g_object_set (result_struct, "success", (gint)(gint32)return_value, NULL);
+
+      result =
+        ((thrift_protocol_write_message_begin (output_protocol,
+                                               "stopBgp",
+                                               T_REPLY,
+                                               sequence_id,
+                                               error) != -1) &&
+         (thrift_struct_write (THRIFT_STRUCT (result_struct),
+                               output_protocol,
+                               error) != -1));
+    }
+    else
+    {
+      if (*error == NULL)
+        g_warning ("BgpConfigurator.stopBgp implementation returned FALSE "
+                   "but did not set an error");
+
+      xception =
+        g_object_new (THRIFT_TYPE_APPLICATION_EXCEPTION,
+                      "type",    *error != NULL ? (*error)->code :
+                                 THRIFT_APPLICATION_EXCEPTION_ERROR_UNKNOWN,
+                      "message", *error != NULL ? (*error)->message : NULL,
+                      NULL);
+      g_clear_error (error);
+
+      result =
+        ((thrift_protocol_write_message_begin (output_protocol,
+                                               "stopBgp",
+                                               T_EXCEPTION,
+                                               sequence_id,
+                                               error) != -1) &&
+         (thrift_struct_write (THRIFT_STRUCT (xception),
+                               output_protocol,
+                               error) != -1));
+
+      g_object_unref (xception);
+    }
+
+    g_object_unref (result_struct);
+
+    if (result == TRUE)
+      result =
+        ((thrift_protocol_write_message_end (output_protocol, error) != -1) &&
+         (thrift_transport_write_end (transport, error) != FALSE) &&
+         (thrift_transport_flush (transport, error) != FALSE));
+  }
+  else
+    result = FALSE;
+
+  g_object_unref (transport);
+  g_object_unref (args);
+
+  return result;
+}
+
+static gboolean
+bgp_configurator_processor_process_create_peer (BgpConfiguratorProcessor *self,
+                                                gint32 sequence_id,
+                                                ThriftProtocol *input_protocol,
+                                                ThriftProtocol *output_protocol,
+                                                GError **error)
+{
+  gboolean result = TRUE;
+  ThriftTransport * transport;
+  ThriftApplicationException *xception;
+  BgpConfiguratorCreatePeerArgs * args =
+    g_object_new (TYPE_BGP_CONFIGURATOR_CREATE_PEER_ARGS, NULL);
+
+  g_object_get (input_protocol, "transport", &transport, NULL);
+
+  if ((thrift_struct_read (THRIFT_STRUCT (args), input_protocol, error) != -1) &&
+      (thrift_protocol_read_message_end (input_protocol, error) != -1) &&
+      (thrift_transport_read_end (transport, error) != FALSE))
   {
-    (gchar *)"disableMultipath",
-    bgp_configurator_processor_process_disable_multipath
-  },
+    gchar * ipAddress;
+    gint64 asNumber;
+    gint return_value;
+    BgpConfiguratorCreatePeerResult * result_struct;
+
+    g_object_get (args,
+                  "ipAddress", &ipAddress,
+                  "asNumber", &asNumber,
+                  NULL);
+
+    g_object_unref (transport);
+    g_object_get (output_protocol, "transport", &transport, NULL);
+
+    result_struct = g_object_new (TYPE_BGP_CONFIGURATOR_CREATE_PEER_RESULT, NULL);
+    g_object_get (result_struct, "success", &return_value, NULL);
+
+    if (bgp_configurator_handler_create_peer (BGP_CONFIGURATOR_IF (self->handler),
+                                              (gint32 *)&return_value,
+                                              ipAddress,
+                                              asNumber,
+                                              error) == TRUE)
+    {
+      g_object_set (result_struct, "success", (gint)(gint32)return_value, NULL);
+
+      result =
+        ((thrift_protocol_write_message_begin (output_protocol,
+                                               "createPeer",
+                                               T_REPLY,
+                                               sequence_id,
+                                               error) != -1) &&
+         (thrift_struct_write (THRIFT_STRUCT (result_struct),
+                               output_protocol,
+                               error) != -1));
+    }
+    else
+    {
+      if (*error == NULL)
+        g_warning ("BgpConfigurator.createPeer implementation returned FALSE "
+                   "but did not set an error");
+
+      xception =
+        g_object_new (THRIFT_TYPE_APPLICATION_EXCEPTION,
+                      "type",    *error != NULL ? (*error)->code :
+                                 THRIFT_APPLICATION_EXCEPTION_ERROR_UNKNOWN,
+                      "message", *error != NULL ? (*error)->message : NULL,
+                      NULL);
+      g_clear_error (error);
+
+      result =
+        ((thrift_protocol_write_message_begin (output_protocol,
+                                               "createPeer",
+                                               T_EXCEPTION,
+                                               sequence_id,
+                                               error) != -1) &&
+         (thrift_struct_write (THRIFT_STRUCT (xception),
+                               output_protocol,
+                               error) != -1));
+
+      g_object_unref (xception);
+    }
+
+    if (ipAddress != NULL)
+      g_free (ipAddress);
+    g_object_unref (result_struct);
+
+    if (result == TRUE)
+      result =
+        ((thrift_protocol_write_message_end (output_protocol, error) != -1) &&
+         (thrift_transport_write_end (transport, error) != FALSE) &&
+         (thrift_transport_flush (transport, error) != FALSE));
+  }
+  else
+    result = FALSE;
+
+  g_object_unref (transport);
+  g_object_unref (args);
+
+  return result;
+}
+
+static gboolean
+bgp_configurator_processor_process_delete_peer (BgpConfiguratorProcessor *self,
+                                                gint32 sequence_id,
+                                                ThriftProtocol *input_protocol,
+                                                ThriftProtocol *output_protocol,
+                                                GError **error)
+{
+  gboolean result = TRUE;
+  ThriftTransport * transport;
+  ThriftApplicationException *xception;
+  BgpConfiguratorDeletePeerArgs * args =
+    g_object_new (TYPE_BGP_CONFIGURATOR_DELETE_PEER_ARGS, NULL);
+
+  g_object_get (input_protocol, "transport", &transport, NULL);
+
+  if ((thrift_struct_read (THRIFT_STRUCT (args), input_protocol, error) != -1) &&
+      (thrift_protocol_read_message_end (input_protocol, error) != -1) &&
+      (thrift_transport_read_end (transport, error) != FALSE))
   {
-    (gchar *)"multipaths",
-    bgp_configurator_processor_process_multipaths
+    gchar * ipAddress;
+    gint return_value;
+    BgpConfiguratorDeletePeerResult * result_struct;
+
+    g_object_get (args,
+                  "ipAddress", &ipAddress,
+                  NULL);
+
+    g_object_unref (transport);
+    g_object_get (output_protocol, "transport", &transport, NULL);
+
+    result_struct = g_object_new (TYPE_BGP_CONFIGURATOR_DELETE_PEER_RESULT, NULL);
+    g_object_get (result_struct, "success", &return_value, NULL);
+
+    if (bgp_configurator_handler_delete_peer (BGP_CONFIGURATOR_IF (self->handler),
+                                              (gint32 *)&return_value,
+                                              ipAddress,
+                                              error) == TRUE)
+    {
+      g_object_set (result_struct, "success", (gint)(gint32)return_value, NULL);
+
+      result =
+        ((thrift_protocol_write_message_begin (output_protocol,
+                                               "deletePeer",
+                                               T_REPLY,
+                                               sequence_id,
+                                               error) != -1) &&
+         (thrift_struct_write (THRIFT_STRUCT (result_struct),
+                               output_protocol,
+                               error) != -1));
+    }
+    else
+    {
+      if (*error == NULL)
+        g_warning ("BgpConfigurator.deletePeer implementation returned FALSE "
+                   "but did not set an error");
+
+      xception =
+        g_object_new (THRIFT_TYPE_APPLICATION_EXCEPTION,
+                      "type",    *error != NULL ? (*error)->code :
+                                 THRIFT_APPLICATION_EXCEPTION_ERROR_UNKNOWN,
+                      "message", *error != NULL ? (*error)->message : NULL,
+                      NULL);
+      g_clear_error (error);
+
+      result =
+        ((thrift_protocol_write_message_begin (output_protocol,
+                                               "deletePeer",
+                                               T_EXCEPTION,
+                                               sequence_id,
+                                               error) != -1) &&
+         (thrift_struct_write (THRIFT_STRUCT (xception),
+                               output_protocol,
+                               error) != -1));
+
+      g_object_unref (xception);
+    }
+
+    if (ipAddress != NULL)
+      g_free (ipAddress);
+    g_object_unref (result_struct);
+
+    if (result == TRUE)
+      result =
+        ((thrift_protocol_write_message_end (output_protocol, error) != -1) &&
+         (thrift_transport_write_end (transport, error) != FALSE) &&
+         (thrift_transport_flush (transport, error) != FALSE));
   }
-};
+  else
+    result = FALSE;
+
+  g_object_unref (transport);
+  g_object_unref (args);
+
+  return result;
+}
 
 static gboolean
-bgp_configurator_processor_process_start_bgp (BgpConfiguratorProcessor *self,
-                                              gint32 sequence_id,
-                                              ThriftProtocol *input_protocol,
-                                              ThriftProtocol *output_protocol,
-                                              GError **error)
+bgp_configurator_processor_process_add_vrf (BgpConfiguratorProcessor *self,
+                                            gint32 sequence_id,
+                                            ThriftProtocol *input_protocol,
+                                            ThriftProtocol *output_protocol,
+                                            GError **error)
 {
   gboolean result = TRUE;
   ThriftTransport * transport;
   ThriftApplicationException *xception;
-  BgpConfiguratorStartBgpArgs * args =
-    g_object_new (TYPE_BGP_CONFIGURATOR_START_BGP_ARGS, NULL);
+  BgpConfiguratorAddVrfArgs * args =
+    g_object_new (TYPE_BGP_CONFIGURATOR_ADD_VRF_ARGS, NULL);
 
   g_object_get (input_protocol, "transport", &transport, NULL);
 
@@ -4695,48 +5970,36 @@ bgp_configurator_processor_process_start_bgp (BgpConfiguratorProcessor *self,
       (thrift_protocol_read_message_end (input_protocol, error) != -1) &&
       (thrift_transport_read_end (transport, error) != FALSE))
   {
-    gint64 asNumber;
-    gchar * routerId;
-    gint port;
-    gint holdTime;
-    gint keepAliveTime;
-    gint stalepathTime;
-    gboolean announceFbit;
+    gchar * rd;
+    GPtrArray * irts;
+    GPtrArray * erts;
     gint return_value;
-    BgpConfiguratorStartBgpResult * result_struct;
+    BgpConfiguratorAddVrfResult * result_struct;
 
     g_object_get (args,
-                  "asNumber", &asNumber,
-                  "routerId", &routerId,
-                  "port", &port,
-                  "holdTime", &holdTime,
-                  "keepAliveTime", &keepAliveTime,
-                  "stalepathTime", &stalepathTime,
-                  "announceFbit", &announceFbit,
+                  "rd", &rd,
+                  "irts", &irts,
+                  "erts", &erts,
                   NULL);
 
     g_object_unref (transport);
     g_object_get (output_protocol, "transport", &transport, NULL);
 
-    result_struct = g_object_new (TYPE_BGP_CONFIGURATOR_START_BGP_RESULT, NULL);
+    result_struct = g_object_new (TYPE_BGP_CONFIGURATOR_ADD_VRF_RESULT, NULL);
     g_object_get (result_struct, "success", &return_value, NULL);
 
-    if (bgp_configurator_handler_start_bgp (BGP_CONFIGURATOR_IF (self->handler),
-                                            (gint32 *)&return_value,
-                                            asNumber,
-                                            routerId,
-                                            port,
-                                            holdTime,
-                                            keepAliveTime,
-                                            stalepathTime,
-                                            announceFbit,
-                                            error) == TRUE)
+    if (bgp_configurator_handler_add_vrf (BGP_CONFIGURATOR_IF (self->handler),
+                                          (gint32 *)&return_value,
+                                          rd,
+                                          irts,
+                                          erts,
+                                          error) == TRUE)
     {
       g_object_set (result_struct, "success", (gint)(gint32)return_value, NULL);
 
       result =
         ((thrift_protocol_write_message_begin (output_protocol,
-                                               "startBgp",
+                                               "addVrf",
                                                T_REPLY,
                                                sequence_id,
                                                error) != -1) &&
@@ -4747,7 +6010,7 @@ bgp_configurator_processor_process_start_bgp (BgpConfiguratorProcessor *self,
     else
     {
       if (*error == NULL)
-        g_warning ("BgpConfigurator.startBgp implementation returned FALSE "
+        g_warning ("BgpConfigurator.addVrf implementation returned FALSE "
                    "but did not set an error");
 
       xception =
@@ -4760,7 +6023,7 @@ bgp_configurator_processor_process_start_bgp (BgpConfiguratorProcessor *self,
 
       result =
         ((thrift_protocol_write_message_begin (output_protocol,
-                                               "startBgp",
+                                               "addVrf",
                                                T_EXCEPTION,
                                                sequence_id,
                                                error) != -1) &&
@@ -4771,8 +6034,12 @@ bgp_configurator_processor_process_start_bgp (BgpConfiguratorProcessor *self,
       g_object_unref (xception);
     }
 
-    if (routerId != NULL)
-      g_free (routerId);
+    if (rd != NULL)
+      g_free (rd);
+    if (irts != NULL)
+      g_ptr_array_unref (irts);
+    if (erts != NULL)
+      g_ptr_array_unref (erts);
     g_object_unref (result_struct);
 
     if (result == TRUE)
@@ -4791,17 +6058,17 @@ bgp_configurator_processor_process_start_bgp (BgpConfiguratorProcessor *self,
 }
 
 static gboolean
-bgp_configurator_processor_process_stop_bgp (BgpConfiguratorProcessor *self,
-                                             gint32 sequence_id,
-                                             ThriftProtocol *input_protocol,
-                                             ThriftProtocol *output_protocol,
-                                             GError **error)
+bgp_configurator_processor_process_del_vrf (BgpConfiguratorProcessor *self,
+                                            gint32 sequence_id,
+                                            ThriftProtocol *input_protocol,
+                                            ThriftProtocol *output_protocol,
+                                            GError **error)
 {
   gboolean result = TRUE;
   ThriftTransport * transport;
   ThriftApplicationException *xception;
-  BgpConfiguratorStopBgpArgs * args =
-    g_object_new (TYPE_BGP_CONFIGURATOR_STOP_BGP_ARGS, NULL);
+  BgpConfiguratorDelVrfArgs * args =
+    g_object_new (TYPE_BGP_CONFIGURATOR_DEL_VRF_ARGS, NULL);
 
   g_object_get (input_protocol, "transport", &transport, NULL);
 
@@ -4809,30 +6076,30 @@ bgp_configurator_processor_process_stop_bgp (BgpConfiguratorProcessor *self,
       (thrift_protocol_read_message_end (input_protocol, error) != -1) &&
       (thrift_transport_read_end (transport, error) != FALSE))
   {
-    gint64 asNumber;
+    gchar * rd;
     gint return_value;
-    BgpConfiguratorStopBgpResult * result_struct;
+    BgpConfiguratorDelVrfResult * result_struct;
 
     g_object_get (args,
-                  "asNumber", &asNumber,
+                  "rd", &rd,
                   NULL);
 
     g_object_unref (transport);
     g_object_get (output_protocol, "transport", &transport, NULL);
 
-    result_struct = g_object_new (TYPE_BGP_CONFIGURATOR_STOP_BGP_RESULT, NULL);
+    result_struct = g_object_new (TYPE_BGP_CONFIGURATOR_DEL_VRF_RESULT, NULL);
     g_object_get (result_struct, "success", &return_value, NULL);
 
-    if (bgp_configurator_handler_stop_bgp (BGP_CONFIGURATOR_IF (self->handler),
-                                           (gint32 *)&return_value,
-                                           asNumber,
-                                           error) == TRUE)
+    if (bgp_configurator_handler_del_vrf (BGP_CONFIGURATOR_IF (self->handler),
+                                          (gint32 *)&return_value,
+                                          rd,
+                                          error) == TRUE)
     {
       g_object_set (result_struct, "success", (gint)(gint32)return_value, NULL);
 
       result =
         ((thrift_protocol_write_message_begin (output_protocol,
-                                               "stopBgp",
+                                               "delVrf",
                                                T_REPLY,
                                                sequence_id,
                                                error) != -1) &&
@@ -4843,7 +6110,7 @@ bgp_configurator_processor_process_stop_bgp (BgpConfiguratorProcessor *self,
     else
     {
       if (*error == NULL)
-        g_warning ("BgpConfigurator.stopBgp implementation returned FALSE "
+        g_warning ("BgpConfigurator.delVrf implementation returned FALSE "
                    "but did not set an error");
 
       xception =
@@ -4856,7 +6123,7 @@ bgp_configurator_processor_process_stop_bgp (BgpConfiguratorProcessor *self,
 
       result =
         ((thrift_protocol_write_message_begin (output_protocol,
-                                               "stopBgp",
+                                               "delVrf",
                                                T_EXCEPTION,
                                                sequence_id,
                                                error) != -1) &&
@@ -4867,6 +6134,8 @@ bgp_configurator_processor_process_stop_bgp (BgpConfiguratorProcessor *self,
       g_object_unref (xception);
     }
 
+    if (rd != NULL)
+      g_free (rd);
     g_object_unref (result_struct);
 
     if (result == TRUE)
@@ -4885,17 +6154,17 @@ bgp_configurator_processor_process_stop_bgp (BgpConfiguratorProcessor *self,
 }
 
 static gboolean
-bgp_configurator_processor_process_create_peer (BgpConfiguratorProcessor *self,
-                                                gint32 sequence_id,
-                                                ThriftProtocol *input_protocol,
-                                                ThriftProtocol *output_protocol,
-                                                GError **error)
+bgp_configurator_processor_process_push_route (BgpConfiguratorProcessor *self,
+                                               gint32 sequence_id,
+                                               ThriftProtocol *input_protocol,
+                                               ThriftProtocol *output_protocol,
+                                               GError **error)
 {
   gboolean result = TRUE;
   ThriftTransport * transport;
   ThriftApplicationException *xception;
-  BgpConfiguratorCreatePeerArgs * args =
-    g_object_new (TYPE_BGP_CONFIGURATOR_CREATE_PEER_ARGS, NULL);
+  BgpConfiguratorPushRouteArgs * args =
+    g_object_new (TYPE_BGP_CONFIGURATOR_PUSH_ROUTE_ARGS, NULL);
 
   g_object_get (input_protocol, "transport", &transport, NULL);
 
@@ -4903,33 +6172,39 @@ bgp_configurator_processor_process_create_peer (BgpConfiguratorProcessor *self,
       (thrift_protocol_read_message_end (input_protocol, error) != -1) &&
       (thrift_transport_read_end (transport, error) != FALSE))
   {
-    gchar * ipAddress;
-    gint64 asNumber;
+    gchar * prefix;
+    gchar * nexthop;
+    gchar * rd;
+    gint label;
     gint return_value;
-    BgpConfiguratorCreatePeerResult * result_struct;
+    BgpConfiguratorPushRouteResult * result_struct;
 
     g_object_get (args,
-                  "ipAddress", &ipAddress,
-                  "asNumber", &asNumber,
+                  "prefix", &prefix,
+                  "nexthop", &nexthop,
+                  "rd", &rd,
+                  "label", &label,
                   NULL);
 
     g_object_unref (transport);
     g_object_get (output_protocol, "transport", &transport, NULL);
 
-    result_struct = g_object_new (TYPE_BGP_CONFIGURATOR_CREATE_PEER_RESULT, NULL);
+    result_struct = g_object_new (TYPE_BGP_CONFIGURATOR_PUSH_ROUTE_RESULT, NULL);
     g_object_get (result_struct, "success", &return_value, NULL);
 
-    if (bgp_configurator_handler_create_peer (BGP_CONFIGURATOR_IF (self->handler),
-                                              (gint32 *)&return_value,
-                                              ipAddress,
-                                              asNumber,
-                                              error) == TRUE)
+    if (bgp_configurator_handler_push_route (BGP_CONFIGURATOR_IF (self->handler),
+                                             (gint32 *)&return_value,
+                                             prefix,
+                                             nexthop,
+                                             rd,
+                                             label,
+                                             error) == TRUE)
     {
       g_object_set (result_struct, "success", (gint)(gint32)return_value, NULL);
 
       result =
         ((thrift_protocol_write_message_begin (output_protocol,
-                                               "createPeer",
+                                               "pushRoute",
                                                T_REPLY,
                                                sequence_id,
                                                error) != -1) &&
@@ -4940,7 +6215,7 @@ bgp_configurator_processor_process_create_peer (BgpConfiguratorProcessor *self,
     else
     {
       if (*error == NULL)
-        g_warning ("BgpConfigurator.createPeer implementation returned FALSE "
+        g_warning ("BgpConfigurator.pushRoute implementation returned FALSE "
                    "but did not set an error");
 
       xception =
@@ -4953,7 +6228,7 @@ bgp_configurator_processor_process_create_peer (BgpConfiguratorProcessor *self,
 
       result =
         ((thrift_protocol_write_message_begin (output_protocol,
-                                               "createPeer",
+                                               "pushRoute",
                                                T_EXCEPTION,
                                                sequence_id,
                                                error) != -1) &&
@@ -4964,8 +6239,12 @@ bgp_configurator_processor_process_create_peer (BgpConfiguratorProcessor *self,
       g_object_unref (xception);
     }
 
-    if (ipAddress != NULL)
-      g_free (ipAddress);
+    if (prefix != NULL)
+      g_free (prefix);
+    if (nexthop != NULL)
+      g_free (nexthop);
+    if (rd != NULL)
+      g_free (rd);
     g_object_unref (result_struct);
 
     if (result == TRUE)
@@ -4984,17 +6263,17 @@ bgp_configurator_processor_process_create_peer (BgpConfiguratorProcessor *self,
 }
 
 static gboolean
-bgp_configurator_processor_process_delete_peer (BgpConfiguratorProcessor *self,
-                                                gint32 sequence_id,
-                                                ThriftProtocol *input_protocol,
-                                                ThriftProtocol *output_protocol,
-                                                GError **error)
+bgp_configurator_processor_process_withdraw_route (BgpConfiguratorProcessor *self,
+                                                   gint32 sequence_id,
+                                                   ThriftProtocol *input_protocol,
+                                                   ThriftProtocol *output_protocol,
+                                                   GError **error)
 {
   gboolean result = TRUE;
   ThriftTransport * transport;
   ThriftApplicationException *xception;
-  BgpConfiguratorDeletePeerArgs * args =
-    g_object_new (TYPE_BGP_CONFIGURATOR_DELETE_PEER_ARGS, NULL);
+  BgpConfiguratorWithdrawRouteArgs * args =
+    g_object_new (TYPE_BGP_CONFIGURATOR_WITHDRAW_ROUTE_ARGS, NULL);
 
   g_object_get (input_protocol, "transport", &transport, NULL);
 
@@ -5002,30 +6281,33 @@ bgp_configurator_processor_process_delete_peer (BgpConfiguratorProcessor *self,
       (thrift_protocol_read_message_end (input_protocol, error) != -1) &&
       (thrift_transport_read_end (transport, error) != FALSE))
   {
-    gchar * ipAddress;
+    gchar * prefix;
+    gchar * rd;
     gint return_value;
-    BgpConfiguratorDeletePeerResult * result_struct;
+    BgpConfiguratorWithdrawRouteResult * result_struct;
 
     g_object_get (args,
-                  "ipAddress", &ipAddress,
+                  "prefix", &prefix,
+                  "rd", &rd,
                   NULL);
 
     g_object_unref (transport);
     g_object_get (output_protocol, "transport", &transport, NULL);
 
-    result_struct = g_object_new (TYPE_BGP_CONFIGURATOR_DELETE_PEER_RESULT, NULL);
+    result_struct = g_object_new (TYPE_BGP_CONFIGURATOR_WITHDRAW_ROUTE_RESULT, NULL);
     g_object_get (result_struct, "success", &return_value, NULL);
 
-    if (bgp_configurator_handler_delete_peer (BGP_CONFIGURATOR_IF (self->handler),
-                                              (gint32 *)&return_value,
-                                              ipAddress,
-                                              error) == TRUE)
+    if (bgp_configurator_handler_withdraw_route (BGP_CONFIGURATOR_IF (self->handler),
+                                                 (gint32 *)&return_value,
+                                                 prefix,
+                                                 rd,
+                                                 error) == TRUE)
     {
       g_object_set (result_struct, "success", (gint)(gint32)return_value, NULL);
 
       result =
         ((thrift_protocol_write_message_begin (output_protocol,
-                                               "deletePeer",
+                                               "withdrawRoute",
                                                T_REPLY,
                                                sequence_id,
                                                error) != -1) &&
@@ -5036,7 +6318,7 @@ bgp_configurator_processor_process_delete_peer (BgpConfiguratorProcessor *self,
     else
     {
       if (*error == NULL)
-        g_warning ("BgpConfigurator.deletePeer implementation returned FALSE "
+        g_warning ("BgpConfigurator.withdrawRoute implementation returned FALSE "
                    "but did not set an error");
 
       xception =
@@ -5049,7 +6331,7 @@ bgp_configurator_processor_process_delete_peer (BgpConfiguratorProcessor *self,
 
       result =
         ((thrift_protocol_write_message_begin (output_protocol,
-                                               "deletePeer",
+                                               "withdrawRoute",
                                                T_EXCEPTION,
                                                sequence_id,
                                                error) != -1) &&
@@ -5060,8 +6342,10 @@ bgp_configurator_processor_process_delete_peer (BgpConfiguratorProcessor *self,
       g_object_unref (xception);
     }
 
-    if (ipAddress != NULL)
-      g_free (ipAddress);
+    if (prefix != NULL)
+      g_free (prefix);
+    if (rd != NULL)
+      g_free (rd);
     g_object_unref (result_struct);
 
     if (result == TRUE)
@@ -5080,17 +6364,17 @@ bgp_configurator_processor_process_delete_peer (BgpConfiguratorProcessor *self,
 }
 
 static gboolean
-bgp_configurator_processor_process_add_vrf (BgpConfiguratorProcessor *self,
-                                            gint32 sequence_id,
-                                            ThriftProtocol *input_protocol,
-                                            ThriftProtocol *output_protocol,
-                                            GError **error)
+bgp_configurator_processor_process_set_ebgp_multihop (BgpConfiguratorProcessor *self,
+                                                      gint32 sequence_id,
+                                                      ThriftProtocol *input_protocol,
+                                                      ThriftProtocol *output_protocol,
+                                                      GError **error)
 {
   gboolean result = TRUE;
   ThriftTransport * transport;
   ThriftApplicationException *xception;
-  BgpConfiguratorAddVrfArgs * args =
-    g_object_new (TYPE_BGP_CONFIGURATOR_ADD_VRF_ARGS, NULL);
+  BgpConfiguratorSetEbgpMultihopArgs * args =
+    g_object_new (TYPE_BGP_CONFIGURATOR_SET_EBGP_MULTIHOP_ARGS, NULL);
 
   g_object_get (input_protocol, "transport", &transport, NULL);
 
@@ -5098,36 +6382,33 @@ bgp_configurator_processor_process_add_vrf (BgpConfiguratorProcessor *self,
       (thrift_protocol_read_message_end (input_protocol, error) != -1) &&
       (thrift_transport_read_end (transport, error) != FALSE))
   {
-    gchar * rd;
-    GPtrArray * irts;
-    GPtrArray * erts;
+    gchar * peerIp;
+    gint nHops;
     gint return_value;
-    BgpConfiguratorAddVrfResult * result_struct;
+    BgpConfiguratorSetEbgpMultihopResult * result_struct;
 
     g_object_get (args,
-                  "rd", &rd,
-                  "irts", &irts,
-                  "erts", &erts,
+                  "peerIp", &peerIp,
+                  "nHops", &nHops,
                   NULL);
 
     g_object_unref (transport);
     g_object_get (output_protocol, "transport", &transport, NULL);
 
-    result_struct = g_object_new (TYPE_BGP_CONFIGURATOR_ADD_VRF_RESULT, NULL);
+    result_struct = g_object_new (TYPE_BGP_CONFIGURATOR_SET_EBGP_MULTIHOP_RESULT, NULL);
     g_object_get (result_struct, "success", &return_value, NULL);
 
-    if (bgp_configurator_handler_add_vrf (BGP_CONFIGURATOR_IF (self->handler),
-                                          (gint32 *)&return_value,
-                                          rd,
-                                          irts,
-                                          erts,
-                                          error) == TRUE)
+    if (bgp_configurator_handler_set_ebgp_multihop (BGP_CONFIGURATOR_IF (self->handler),
+                                                    (gint32 *)&return_value,
+                                                    peerIp,
+                                                    nHops,
+                                                    error) == TRUE)
     {
       g_object_set (result_struct, "success", (gint)(gint32)return_value, NULL);
 
       result =
         ((thrift_protocol_write_message_begin (output_protocol,
-                                               "addVrf",
+                                               "setEbgpMultihop",
                                                T_REPLY,
                                                sequence_id,
                                                error) != -1) &&
@@ -5138,7 +6419,7 @@ bgp_configurator_processor_process_add_vrf (BgpConfiguratorProcessor *self,
     else
     {
       if (*error == NULL)
-        g_warning ("BgpConfigurator.addVrf implementation returned FALSE "
+        g_warning ("BgpConfigurator.setEbgpMultihop implementation returned FALSE "
                    "but did not set an error");
 
       xception =
@@ -5151,7 +6432,7 @@ bgp_configurator_processor_process_add_vrf (BgpConfiguratorProcessor *self,
 
       result =
         ((thrift_protocol_write_message_begin (output_protocol,
-                                               "addVrf",
+                                               "setEbgpMultihop",
                                                T_EXCEPTION,
                                                sequence_id,
                                                error) != -1) &&
@@ -5162,12 +6443,8 @@ bgp_configurator_processor_process_add_vrf (BgpConfiguratorProcessor *self,
       g_object_unref (xception);
     }
 
-    if (rd != NULL)
-      g_free (rd);
-    if (irts != NULL)
-      g_ptr_array_unref (irts);
-    if (erts != NULL)
-      g_ptr_array_unref (erts);
+    if (peerIp != NULL)
+      g_free (peerIp);
     g_object_unref (result_struct);
 
     if (result == TRUE)
@@ -5186,17 +6463,17 @@ bgp_configurator_processor_process_add_vrf (BgpConfiguratorProcessor *self,
 }
 
 static gboolean
-bgp_configurator_processor_process_del_vrf (BgpConfiguratorProcessor *self,
-                                            gint32 sequence_id,
-                                            ThriftProtocol *input_protocol,
-                                            ThriftProtocol *output_protocol,
-                                            GError **error)
+bgp_configurator_processor_process_unset_ebgp_multihop (BgpConfiguratorProcessor *self,
+                                                        gint32 sequence_id,
+                                                        ThriftProtocol *input_protocol,
+                                                        ThriftProtocol *output_protocol,
+                                                        GError **error)
 {
   gboolean result = TRUE;
   ThriftTransport * transport;
   ThriftApplicationException *xception;
-  BgpConfiguratorDelVrfArgs * args =
-    g_object_new (TYPE_BGP_CONFIGURATOR_DEL_VRF_ARGS, NULL);
+  BgpConfiguratorUnsetEbgpMultihopArgs * args =
+    g_object_new (TYPE_BGP_CONFIGURATOR_UNSET_EBGP_MULTIHOP_ARGS, NULL);
 
   g_object_get (input_protocol, "transport", &transport, NULL);
 
@@ -5204,30 +6481,30 @@ bgp_configurator_processor_process_del_vrf (BgpConfiguratorProcessor *self,
       (thrift_protocol_read_message_end (input_protocol, error) != -1) &&
       (thrift_transport_read_end (transport, error) != FALSE))
   {
-    gchar * rd;
+    gchar * peerIp;
     gint return_value;
-    BgpConfiguratorDelVrfResult * result_struct;
+    BgpConfiguratorUnsetEbgpMultihopResult * result_struct;
 
     g_object_get (args,
-                  "rd", &rd,
+                  "peerIp", &peerIp,
                   NULL);
 
     g_object_unref (transport);
     g_object_get (output_protocol, "transport", &transport, NULL);
 
-    result_struct = g_object_new (TYPE_BGP_CONFIGURATOR_DEL_VRF_RESULT, NULL);
+    result_struct = g_object_new (TYPE_BGP_CONFIGURATOR_UNSET_EBGP_MULTIHOP_RESULT, NULL);
     g_object_get (result_struct, "success", &return_value, NULL);
 
-    if (bgp_configurator_handler_del_vrf (BGP_CONFIGURATOR_IF (self->handler),
-                                          (gint32 *)&return_value,
-                                          rd,
-                                          error) == TRUE)
+    if (bgp_configurator_handler_unset_ebgp_multihop (BGP_CONFIGURATOR_IF (self->handler),
+                                                      (gint32 *)&return_value,
+                                                      peerIp,
+                                                      error) == TRUE)
     {
       g_object_set (result_struct, "success", (gint)(gint32)return_value, NULL);
 
       result =
         ((thrift_protocol_write_message_begin (output_protocol,
-                                               "delVrf",
+                                               "unsetEbgpMultihop",
                                                T_REPLY,
                                                sequence_id,
                                                error) != -1) &&
@@ -5238,7 +6515,7 @@ bgp_configurator_processor_process_del_vrf (BgpConfiguratorProcessor *self,
     else
     {
       if (*error == NULL)
-        g_warning ("BgpConfigurator.delVrf implementation returned FALSE "
+        g_warning ("BgpConfigurator.unsetEbgpMultihop implementation returned FALSE "
                    "but did not set an error");
 
       xception =
@@ -5251,7 +6528,7 @@ bgp_configurator_processor_process_del_vrf (BgpConfiguratorProcessor *self,
 
       result =
         ((thrift_protocol_write_message_begin (output_protocol,
-                                               "delVrf",
+                                               "unsetEbgpMultihop",
                                                T_EXCEPTION,
                                                sequence_id,
                                                error) != -1) &&
@@ -5262,8 +6539,8 @@ bgp_configurator_processor_process_del_vrf (BgpConfiguratorProcessor *self,
       g_object_unref (xception);
     }
 
-    if (rd != NULL)
-      g_free (rd);
+    if (peerIp != NULL)
+      g_free (peerIp);
     g_object_unref (result_struct);
 
     if (result == TRUE)
@@ -5282,17 +6559,17 @@ bgp_configurator_processor_process_del_vrf (BgpConfiguratorProcessor *self,
 }
 
 static gboolean
-bgp_configurator_processor_process_push_route (BgpConfiguratorProcessor *self,
-                                               gint32 sequence_id,
-                                               ThriftProtocol *input_protocol,
-                                               ThriftProtocol *output_protocol,
-                                               GError **error)
+bgp_configurator_processor_process_set_update_source (BgpConfiguratorProcessor *self,
+                                                      gint32 sequence_id,
+                                                      ThriftProtocol *input_protocol,
+                                                      ThriftProtocol *output_protocol,
+                                                      GError **error)
 {
   gboolean result = TRUE;
   ThriftTransport * transport;
   ThriftApplicationException *xception;
-  BgpConfiguratorPushRouteArgs * args =
-    g_object_new (TYPE_BGP_CONFIGURATOR_PUSH_ROUTE_ARGS, NULL);
+  BgpConfiguratorSetUpdateSourceArgs * args =
+    g_object_new (TYPE_BGP_CONFIGURATOR_SET_UPDATE_SOURCE_ARGS, NULL);
 
   g_object_get (input_protocol, "transport", &transport, NULL);
 
@@ -5300,39 +6577,33 @@ bgp_configurator_processor_process_push_route (BgpConfiguratorProcessor *self,
       (thrift_protocol_read_message_end (input_protocol, error) != -1) &&
       (thrift_transport_read_end (transport, error) != FALSE))
   {
-    gchar * prefix;
-    gchar * nexthop;
-    gchar * rd;
-    gint label;
+    gchar * peerIp;
+    gchar * srcIp;
     gint return_value;
-    BgpConfiguratorPushRouteResult * result_struct;
+    BgpConfiguratorSetUpdateSourceResult * result_struct;
 
     g_object_get (args,
-                  "prefix", &prefix,
-                  "nexthop", &nexthop,
-                  "rd", &rd,
-                  "label", &label,
+                  "peerIp", &peerIp,
+                  "srcIp", &srcIp,
                   NULL);
 
     g_object_unref (transport);
     g_object_get (output_protocol, "transport", &transport, NULL);
 
-    result_struct = g_object_new (TYPE_BGP_CONFIGURATOR_PUSH_ROUTE_RESULT, NULL);
+    result_struct = g_object_new (TYPE_BGP_CONFIGURATOR_SET_UPDATE_SOURCE_RESULT, NULL);
     g_object_get (result_struct, "success", &return_value, NULL);
 
-    if (bgp_configurator_handler_push_route (BGP_CONFIGURATOR_IF (self->handler),
-                                             (gint32 *)&return_value,
-                                             prefix,
-                                             nexthop,
-                                             rd,
-                                             label,
-                                             error) == TRUE)
+    if (bgp_configurator_handler_set_update_source (BGP_CONFIGURATOR_IF (self->handler),
+                                                    (gint32 *)&return_value,
+                                                    peerIp,
+                                                    srcIp,
+                                                    error) == TRUE)
     {
       g_object_set (result_struct, "success", (gint)(gint32)return_value, NULL);
 
       result =
         ((thrift_protocol_write_message_begin (output_protocol,
-                                               "pushRoute",
+                                               "setUpdateSource",
                                                T_REPLY,
                                                sequence_id,
                                                error) != -1) &&
@@ -5343,7 +6614,7 @@ bgp_configurator_processor_process_push_route (BgpConfiguratorProcessor *self,
     else
     {
       if (*error == NULL)
-        g_warning ("BgpConfigurator.pushRoute implementation returned FALSE "
+        g_warning ("BgpConfigurator.setUpdateSource implementation returned FALSE "
                    "but did not set an error");
 
       xception =
@@ -5356,7 +6627,7 @@ bgp_configurator_processor_process_push_route (BgpConfiguratorProcessor *self,
 
       result =
         ((thrift_protocol_write_message_begin (output_protocol,
-                                               "pushRoute",
+                                               "setUpdateSource",
                                                T_EXCEPTION,
                                                sequence_id,
                                                error) != -1) &&
@@ -5367,12 +6638,10 @@ bgp_configurator_processor_process_push_route (BgpConfiguratorProcessor *self,
       g_object_unref (xception);
     }
 
-    if (prefix != NULL)
-      g_free (prefix);
-    if (nexthop != NULL)
-      g_free (nexthop);
-    if (rd != NULL)
-      g_free (rd);
+    if (peerIp != NULL)
+      g_free (peerIp);
+    if (srcIp != NULL)
+      g_free (srcIp);
     g_object_unref (result_struct);
 
     if (result == TRUE)
@@ -5391,17 +6660,17 @@ bgp_configurator_processor_process_push_route (BgpConfiguratorProcessor *self,
 }
 
 static gboolean
-bgp_configurator_processor_process_withdraw_route (BgpConfiguratorProcessor *self,
-                                                   gint32 sequence_id,
-                                                   ThriftProtocol *input_protocol,
-                                                   ThriftProtocol *output_protocol,
-                                                   GError **error)
+bgp_configurator_processor_process_unset_update_source (BgpConfiguratorProcessor *self,
+                                                        gint32 sequence_id,
+                                                        ThriftProtocol *input_protocol,
+                                                        ThriftProtocol *output_protocol,
+                                                        GError **error)
 {
   gboolean result = TRUE;
   ThriftTransport * transport;
   ThriftApplicationException *xception;
-  BgpConfiguratorWithdrawRouteArgs * args =
-    g_object_new (TYPE_BGP_CONFIGURATOR_WITHDRAW_ROUTE_ARGS, NULL);
+  BgpConfiguratorUnsetUpdateSourceArgs * args =
+    g_object_new (TYPE_BGP_CONFIGURATOR_UNSET_UPDATE_SOURCE_ARGS, NULL);
 
   g_object_get (input_protocol, "transport", &transport, NULL);
 
@@ -5409,33 +6678,30 @@ bgp_configurator_processor_process_withdraw_route (BgpConfiguratorProcessor *sel
       (thrift_protocol_read_message_end (input_protocol, error) != -1) &&
       (thrift_transport_read_end (transport, error) != FALSE))
   {
-    gchar * prefix;
-    gchar * rd;
+    gchar * peerIp;
     gint return_value;
-    BgpConfiguratorWithdrawRouteResult * result_struct;
+    BgpConfiguratorUnsetUpdateSourceResult * result_struct;
 
-    g_object_get (args,
-                  "prefix", &prefix,
-                  "rd", &rd,
+    g_object_get (args,
+                  "peerIp", &peerIp,
                   NULL);
 
     g_object_unref (transport);
     g_object_get (output_protocol, "transport", &transport, NULL);
 
-    result_struct = g_object_new (TYPE_BGP_CONFIGURATOR_WITHDRAW_ROUTE_RESULT, NULL);
+    result_struct = g_object_new (TYPE_BGP_CONFIGURATOR_UNSET_UPDATE_SOURCE_RESULT, NULL);
     g_object_get (result_struct, "success", &return_value, NULL);
 
-    if (bgp_configurator_handler_withdraw_route (BGP_CONFIGURATOR_IF (self->handler),
-                                                 (gint32 *)&return_value,
-                                                 prefix,
-                                                 rd,
-                                                 error) == TRUE)
+    if (bgp_configurator_handler_unset_update_source (BGP_CONFIGURATOR_IF (self->handler),
+                                                      (gint32 *)&return_value,
+                                                      peerIp,
+                                                      error) == TRUE)
     {
       g_object_set (result_struct, "success", (gint)(gint32)return_value, NULL);
 
       result =
         ((thrift_protocol_write_message_begin (output_protocol,
-                                               "withdrawRoute",
+                                               "unsetUpdateSource",
                                                T_REPLY,
                                                sequence_id,
                                                error) != -1) &&
@@ -5446,7 +6712,7 @@ bgp_configurator_processor_process_withdraw_route (BgpConfiguratorProcessor *sel
     else
     {
       if (*error == NULL)
-        g_warning ("BgpConfigurator.withdrawRoute implementation returned FALSE "
+        g_warning ("BgpConfigurator.unsetUpdateSource implementation returned FALSE "
                    "but did not set an error");
 
       xception =
@@ -5459,7 +6725,7 @@ bgp_configurator_processor_process_withdraw_route (BgpConfiguratorProcessor *sel
 
       result =
         ((thrift_protocol_write_message_begin (output_protocol,
-                                               "withdrawRoute",
+                                               "unsetUpdateSource",
                                                T_EXCEPTION,
                                                sequence_id,
                                                error) != -1) &&
@@ -5470,10 +6736,8 @@ bgp_configurator_processor_process_withdraw_route (BgpConfiguratorProcessor *sel
       g_object_unref (xception);
     }
 
-    if (prefix != NULL)
-      g_free (prefix);
-    if (rd != NULL)
-      g_free (rd);
+    if (peerIp != NULL)
+      g_free (peerIp);
     g_object_unref (result_struct);
 
     if (result == TRUE)
@@ -5492,17 +6756,17 @@ bgp_configurator_processor_process_withdraw_route (BgpConfiguratorProcessor *sel
 }
 
 static gboolean
-bgp_configurator_processor_process_set_ebgp_multihop (BgpConfiguratorProcessor *self,
-                                                      gint32 sequence_id,
-                                                      ThriftProtocol *input_protocol,
-                                                      ThriftProtocol *output_protocol,
-                                                      GError **error)
+bgp_configurator_processor_process_enable_address_family (BgpConfiguratorProcessor *self,
+                                                          gint32 sequence_id,
+                                                          ThriftProtocol *input_protocol,
+                                                          ThriftProtocol *output_protocol,
+                                                          GError **error)
 {
   gboolean result = TRUE;
   ThriftTransport * transport;
   ThriftApplicationException *xception;
-  BgpConfiguratorSetEbgpMultihopArgs * args =
-    g_object_new (TYPE_BGP_CONFIGURATOR_SET_EBGP_MULTIHOP_ARGS, NULL);
+  BgpConfiguratorEnableAddressFamilyArgs * args =
+    g_object_new (TYPE_BGP_CONFIGURATOR_ENABLE_ADDRESS_FAMILY_ARGS, NULL);
 
   g_object_get (input_protocol, "transport", &transport, NULL);
 
@@ -5511,32 +6775,35 @@ bgp_configurator_processor_process_set_ebgp_multihop (BgpConfiguratorProcessor *
       (thrift_transport_read_end (transport, error) != FALSE))
   {
     gchar * peerIp;
-    gint nHops;
+    af_afi afi;
+    af_safi safi;
     gint return_value;
-    BgpConfiguratorSetEbgpMultihopResult * result_struct;
+    BgpConfiguratorEnableAddressFamilyResult * result_struct;
 
     g_object_get (args,
                   "peerIp", &peerIp,
-                  "nHops", &nHops,
+                  "afi", &afi,
+                  "safi", &safi,
                   NULL);
 
     g_object_unref (transport);
     g_object_get (output_protocol, "transport", &transport, NULL);
 
-    result_struct = g_object_new (TYPE_BGP_CONFIGURATOR_SET_EBGP_MULTIHOP_RESULT, NULL);
+    result_struct = g_object_new (TYPE_BGP_CONFIGURATOR_ENABLE_ADDRESS_FAMILY_RESULT, NULL);
     g_object_get (result_struct, "success", &return_value, NULL);
 
-    if (bgp_configurator_handler_set_ebgp_multihop (BGP_CONFIGURATOR_IF (self->handler),
-                                                    (gint32 *)&return_value,
-                                                    peerIp,
-                                                    nHops,
-                                                    error) == TRUE)
+    if (bgp_configurator_handler_enable_address_family (BGP_CONFIGURATOR_IF (self->handler),
+                                                        (gint32 *)&return_value,
+                                                        peerIp,
+                                                        afi,
+                                                        safi,
+                                                        error) == TRUE)
     {
       g_object_set (result_struct, "success", (gint)(gint32)return_value, NULL);
 
       result =
         ((thrift_protocol_write_message_begin (output_protocol,
-                                               "setEbgpMultihop",
+                                               "enableAddressFamily",
                                                T_REPLY,
                                                sequence_id,
                                                error) != -1) &&
@@ -5547,7 +6814,7 @@ bgp_configurator_processor_process_set_ebgp_multihop (BgpConfiguratorProcessor *
     else
     {
       if (*error == NULL)
-        g_warning ("BgpConfigurator.setEbgpMultihop implementation returned FALSE "
+        g_warning ("BgpConfigurator.enableAddressFamily implementation returned FALSE "
                    "but did not set an error");
 
       xception =
@@ -5560,7 +6827,7 @@ bgp_configurator_processor_process_set_ebgp_multihop (BgpConfiguratorProcessor *
 
       result =
         ((thrift_protocol_write_message_begin (output_protocol,
-                                               "setEbgpMultihop",
+                                               "enableAddressFamily",
                                                T_EXCEPTION,
                                                sequence_id,
                                                error) != -1) &&
@@ -5591,17 +6858,17 @@ bgp_configurator_processor_process_set_ebgp_multihop (BgpConfiguratorProcessor *
 }
 
 static gboolean
-bgp_configurator_processor_process_unset_ebgp_multihop (BgpConfiguratorProcessor *self,
-                                                        gint32 sequence_id,
-                                                        ThriftProtocol *input_protocol,
-                                                        ThriftProtocol *output_protocol,
-                                                        GError **error)
+bgp_configurator_processor_process_disable_address_family (BgpConfiguratorProcessor *self,
+                                                           gint32 sequence_id,
+                                                           ThriftProtocol *input_protocol,
+                                                           ThriftProtocol *output_protocol,
+                                                           GError **error)
 {
   gboolean result = TRUE;
   ThriftTransport * transport;
   ThriftApplicationException *xception;
-  BgpConfiguratorUnsetEbgpMultihopArgs * args =
-    g_object_new (TYPE_BGP_CONFIGURATOR_UNSET_EBGP_MULTIHOP_ARGS, NULL);
+  BgpConfiguratorDisableAddressFamilyArgs * args =
+    g_object_new (TYPE_BGP_CONFIGURATOR_DISABLE_ADDRESS_FAMILY_ARGS, NULL);
 
   g_object_get (input_protocol, "transport", &transport, NULL);
 
@@ -5610,29 +6877,35 @@ bgp_configurator_processor_process_unset_ebgp_multihop (BgpConfiguratorProcessor
       (thrift_transport_read_end (transport, error) != FALSE))
   {
     gchar * peerIp;
+    af_afi afi;
+    af_safi safi;
     gint return_value;
-    BgpConfiguratorUnsetEbgpMultihopResult * result_struct;
+    BgpConfiguratorDisableAddressFamilyResult * result_struct;
 
     g_object_get (args,
                   "peerIp", &peerIp,
+                  "afi", &afi,
+                  "safi", &safi,
                   NULL);
 
     g_object_unref (transport);
     g_object_get (output_protocol, "transport", &transport, NULL);
 
-    result_struct = g_object_new (TYPE_BGP_CONFIGURATOR_UNSET_EBGP_MULTIHOP_RESULT, NULL);
+    result_struct = g_object_new (TYPE_BGP_CONFIGURATOR_DISABLE_ADDRESS_FAMILY_RESULT, NULL);
     g_object_get (result_struct, "success", &return_value, NULL);
 
-    if (bgp_configurator_handler_unset_ebgp_multihop (BGP_CONFIGURATOR_IF (self->handler),
-                                                      (gint32 *)&return_value,
-                                                      peerIp,
-                                                      error) == TRUE)
+    if (bgp_configurator_handler_disable_address_family (BGP_CONFIGURATOR_IF (self->handler),
+                                                         (gint32 *)&return_value,
+                                                         peerIp,
+                                                         afi,
+                                                         safi,
+                                                         error) == TRUE)
     {
       g_object_set (result_struct, "success", (gint)(gint32)return_value, NULL);
 
       result =
         ((thrift_protocol_write_message_begin (output_protocol,
-                                               "unsetEbgpMultihop",
+                                               "disableAddressFamily",
                                                T_REPLY,
                                                sequence_id,
                                                error) != -1) &&
@@ -5643,7 +6916,7 @@ bgp_configurator_processor_process_unset_ebgp_multihop (BgpConfiguratorProcessor
     else
     {
       if (*error == NULL)
-        g_warning ("BgpConfigurator.unsetEbgpMultihop implementation returned FALSE "
+        g_warning ("BgpConfigurator.disableAddressFamily implementation returned FALSE "
                    "but did not set an error");
 
       xception =
@@ -5656,7 +6929,7 @@ bgp_configurator_processor_process_unset_ebgp_multihop (BgpConfiguratorProcessor
 
       result =
         ((thrift_protocol_write_message_begin (output_protocol,
-                                               "unsetEbgpMultihop",
+                                               "disableAddressFamily",
                                                T_EXCEPTION,
                                                sequence_id,
                                                error) != -1) &&
@@ -5687,17 +6960,17 @@ bgp_configurator_processor_process_unset_ebgp_multihop (BgpConfiguratorProcessor
 }
 
 static gboolean
-bgp_configurator_processor_process_set_update_source (BgpConfiguratorProcessor *self,
-                                                      gint32 sequence_id,
-                                                      ThriftProtocol *input_protocol,
-                                                      ThriftProtocol *output_protocol,
-                                                      GError **error)
+bgp_configurator_processor_process_set_log_config (BgpConfiguratorProcessor *self,
+                                                   gint32 sequence_id,
+                                                   ThriftProtocol *input_protocol,
+                                                   ThriftProtocol *output_protocol,
+                                                   GError **error)
 {
   gboolean result = TRUE;
   ThriftTransport * transport;
   ThriftApplicationException *xception;
-  BgpConfiguratorSetUpdateSourceArgs * args =
-    g_object_new (TYPE_BGP_CONFIGURATOR_SET_UPDATE_SOURCE_ARGS, NULL);
+  BgpConfiguratorSetLogConfigArgs * args =
+    g_object_new (TYPE_BGP_CONFIGURATOR_SET_LOG_CONFIG_ARGS, NULL);
 
   g_object_get (input_protocol, "transport", &transport, NULL);
 
@@ -5705,33 +6978,33 @@ bgp_configurator_processor_process_set_update_source (BgpConfiguratorProcessor *
       (thrift_protocol_read_message_end (input_protocol, error) != -1) &&
       (thrift_transport_read_end (transport, error) != FALSE))
   {
-    gchar * peerIp;
-    gchar * srcIp;
+    gchar * logFileName;
+    gchar * logLevel;
     gint return_value;
-    BgpConfiguratorSetUpdateSourceResult * result_struct;
+    BgpConfiguratorSetLogConfigResult * result_struct;
 
     g_object_get (args,
-                  "peerIp", &peerIp,
-                  "srcIp", &srcIp,
+                  "logFileName", &logFileName,
+                  "logLevel", &logLevel,
                   NULL);
 
     g_object_unref (transport);
     g_object_get (output_protocol, "transport", &transport, NULL);
 
-    result_struct = g_object_new (TYPE_BGP_CONFIGURATOR_SET_UPDATE_SOURCE_RESULT, NULL);
+    result_struct = g_object_new (TYPE_BGP_CONFIGURATOR_SET_LOG_CONFIG_RESULT, NULL);
     g_object_get (result_struct, "success", &return_value, NULL);
 
-    if (bgp_configurator_handler_set_update_source (BGP_CONFIGURATOR_IF (self->handler),
-                                                    (gint32 *)&return_value,
-                                                    peerIp,
-                                                    srcIp,
-                                                    error) == TRUE)
+    if (bgp_configurator_handler_set_log_config (BGP_CONFIGURATOR_IF (self->handler),
+                                                 (gint32 *)&return_value,
+                                                 logFileName,
+                                                 logLevel,
+                                                 error) == TRUE)
     {
       g_object_set (result_struct, "success", (gint)(gint32)return_value, NULL);
 
       result =
         ((thrift_protocol_write_message_begin (output_protocol,
-                                               "setUpdateSource",
+                                               "setLogConfig",
                                                T_REPLY,
                                                sequence_id,
                                                error) != -1) &&
@@ -5742,7 +7015,7 @@ bgp_configurator_processor_process_set_update_source (BgpConfiguratorProcessor *
     else
     {
       if (*error == NULL)
-        g_warning ("BgpConfigurator.setUpdateSource implementation returned FALSE "
+        g_warning ("BgpConfigurator.setLogConfig implementation returned FALSE "
                    "but did not set an error");
 
       xception =
@@ -5755,7 +7028,7 @@ bgp_configurator_processor_process_set_update_source (BgpConfiguratorProcessor *
 
       result =
         ((thrift_protocol_write_message_begin (output_protocol,
-                                               "setUpdateSource",
+                                               "setLogConfig",
                                                T_EXCEPTION,
                                                sequence_id,
                                                error) != -1) &&
@@ -5766,10 +7039,10 @@ bgp_configurator_processor_process_set_update_source (BgpConfiguratorProcessor *
       g_object_unref (xception);
     }
 
-    if (peerIp != NULL)
-      g_free (peerIp);
-    if (srcIp != NULL)
-      g_free (srcIp);
+    if (logFileName != NULL)
+      g_free (logFileName);
+    if (logLevel != NULL)
+      g_free (logLevel);
     g_object_unref (result_struct);
 
     if (result == TRUE)
@@ -5788,17 +7061,17 @@ bgp_configurator_processor_process_set_update_source (BgpConfiguratorProcessor *
 }
 
 static gboolean
-bgp_configurator_processor_process_unset_update_source (BgpConfiguratorProcessor *self,
-                                                        gint32 sequence_id,
-                                                        ThriftProtocol *input_protocol,
-                                                        ThriftProtocol *output_protocol,
-                                                        GError **error)
+bgp_configurator_processor_process_enable_graceful_restart (BgpConfiguratorProcessor *self,
+                                                            gint32 sequence_id,
+                                                            ThriftProtocol *input_protocol,
+                                                            ThriftProtocol *output_protocol,
+                                                            GError **error)
 {
   gboolean result = TRUE;
   ThriftTransport * transport;
   ThriftApplicationException *xception;
-  BgpConfiguratorUnsetUpdateSourceArgs * args =
-    g_object_new (TYPE_BGP_CONFIGURATOR_UNSET_UPDATE_SOURCE_ARGS, NULL);
+  BgpConfiguratorEnableGracefulRestartArgs * args =
+    g_object_new (TYPE_BGP_CONFIGURATOR_ENABLE_GRACEFUL_RESTART_ARGS, NULL);
 
   g_object_get (input_protocol, "transport", &transport, NULL);
 
@@ -5806,30 +7079,30 @@ bgp_configurator_processor_process_unset_update_source (BgpConfiguratorProcessor
       (thrift_protocol_read_message_end (input_protocol, error) != -1) &&
       (thrift_transport_read_end (transport, error) != FALSE))
   {
-    gchar * peerIp;
+    gint stalepathTime;
     gint return_value;
-    BgpConfiguratorUnsetUpdateSourceResult * result_struct;
+    BgpConfiguratorEnableGracefulRestartResult * result_struct;
 
     g_object_get (args,
-                  "peerIp", &peerIp,
+                  "stalepathTime", &stalepathTime,
                   NULL);
 
     g_object_unref (transport);
     g_object_get (output_protocol, "transport", &transport, NULL);
 
-    result_struct = g_object_new (TYPE_BGP_CONFIGURATOR_UNSET_UPDATE_SOURCE_RESULT, NULL);
+    result_struct = g_object_new (TYPE_BGP_CONFIGURATOR_ENABLE_GRACEFUL_RESTART_RESULT, NULL);
     g_object_get (result_struct, "success", &return_value, NULL);
 
-    if (bgp_configurator_handler_unset_update_source (BGP_CONFIGURATOR_IF (self->handler),
-                                                      (gint32 *)&return_value,
-                                                      peerIp,
-                                                      error) == TRUE)
+    if (bgp_configurator_handler_enable_graceful_restart (BGP_CONFIGURATOR_IF (self->handler),
+                                                          (gint32 *)&return_value,
+                                                          stalepathTime,
+                                                          error) == TRUE)
     {
       g_object_set (result_struct, "success", (gint)(gint32)return_value, NULL);
 
       result =
         ((thrift_protocol_write_message_begin (output_protocol,
-                                               "unsetUpdateSource",
+                                               "enableGracefulRestart",
                                                T_REPLY,
                                                sequence_id,
                                                error) != -1) &&
@@ -5840,7 +7113,7 @@ bgp_configurator_processor_process_unset_update_source (BgpConfiguratorProcessor
     else
     {
       if (*error == NULL)
-        g_warning ("BgpConfigurator.unsetUpdateSource implementation returned FALSE "
+        g_warning ("BgpConfigurator.enableGracefulRestart implementation returned FALSE "
                    "but did not set an error");
 
       xception =
@@ -5853,7 +7126,7 @@ bgp_configurator_processor_process_unset_update_source (BgpConfiguratorProcessor
 
       result =
         ((thrift_protocol_write_message_begin (output_protocol,
-                                               "unsetUpdateSource",
+                                               "enableGracefulRestart",
                                                T_EXCEPTION,
                                                sequence_id,
                                                error) != -1) &&
@@ -5864,8 +7137,6 @@ bgp_configurator_processor_process_unset_update_source (BgpConfiguratorProcessor
       g_object_unref (xception);
     }
 
-    if (peerIp != NULL)
-      g_free (peerIp);
     g_object_unref (result_struct);
 
     if (result == TRUE)
@@ -5884,17 +7155,17 @@ bgp_configurator_processor_process_unset_update_source (BgpConfiguratorProcessor
 }
 
 static gboolean
-bgp_configurator_processor_process_enable_address_family (BgpConfiguratorProcessor *self,
-                                                          gint32 sequence_id,
-                                                          ThriftProtocol *input_protocol,
-                                                          ThriftProtocol *output_protocol,
-                                                          GError **error)
+bgp_configurator_processor_process_disable_graceful_restart (BgpConfiguratorProcessor *self,
+                                                             gint32 sequence_id,
+                                                             ThriftProtocol *input_protocol,
+                                                             ThriftProtocol *output_protocol,
+                                                             GError **error)
 {
   gboolean result = TRUE;
   ThriftTransport * transport;
   ThriftApplicationException *xception;
-  BgpConfiguratorEnableAddressFamilyArgs * args =
-    g_object_new (TYPE_BGP_CONFIGURATOR_ENABLE_ADDRESS_FAMILY_ARGS, NULL);
+  BgpConfiguratorDisableGracefulRestartArgs * args =
+    g_object_new (TYPE_BGP_CONFIGURATOR_DISABLE_GRACEFUL_RESTART_ARGS, NULL);
 
   g_object_get (input_protocol, "transport", &transport, NULL);
 
@@ -5902,36 +7173,24 @@ bgp_configurator_processor_process_enable_address_family (BgpConfiguratorProcess
       (thrift_protocol_read_message_end (input_protocol, error) != -1) &&
       (thrift_transport_read_end (transport, error) != FALSE))
   {
-    gchar * peerIp;
-    af_afi afi;
-    af_safi safi;
     gint return_value;
-    BgpConfiguratorEnableAddressFamilyResult * result_struct;
-
-    g_object_get (args,
-                  "peerIp", &peerIp,
-                  "afi", &afi,
-                  "safi", &safi,
-                  NULL);
+    BgpConfiguratorDisableGracefulRestartResult * result_struct;
 
     g_object_unref (transport);
     g_object_get (output_protocol, "transport", &transport, NULL);
 
-    result_struct = g_object_new (TYPE_BGP_CONFIGURATOR_ENABLE_ADDRESS_FAMILY_RESULT, NULL);
+    result_struct = g_object_new (TYPE_BGP_CONFIGURATOR_DISABLE_GRACEFUL_RESTART_RESULT, NULL);
     g_object_get (result_struct, "success", &return_value, NULL);
 
-    if (bgp_configurator_handler_enable_address_family (BGP_CONFIGURATOR_IF (self->handler),
-                                                        (gint32 *)&return_value,
-                                                        peerIp,
-                                                        afi,
-                                                        safi,
-                                                        error) == TRUE)
+    if (bgp_configurator_handler_disable_graceful_restart (BGP_CONFIGURATOR_IF (self->handler),
+                                                           (gint32 *)&return_value,
+                                                           error) == TRUE)
     {
       g_object_set (result_struct, "success", (gint)(gint32)return_value, NULL);
 
       result =
         ((thrift_protocol_write_message_begin (output_protocol,
-                                               "enableAddressFamily",
+                                               "disableGracefulRestart",
                                                T_REPLY,
                                                sequence_id,
                                                error) != -1) &&
@@ -5942,7 +7201,7 @@ bgp_configurator_processor_process_enable_address_family (BgpConfiguratorProcess
     else
     {
       if (*error == NULL)
-        g_warning ("BgpConfigurator.enableAddressFamily implementation returned FALSE "
+        g_warning ("BgpConfigurator.disableGracefulRestart implementation returned FALSE "
                    "but did not set an error");
 
       xception =
@@ -5955,7 +7214,7 @@ bgp_configurator_processor_process_enable_address_family (BgpConfiguratorProcess
 
       result =
         ((thrift_protocol_write_message_begin (output_protocol,
-                                               "enableAddressFamily",
+                                               "disableGracefulRestart",
                                                T_EXCEPTION,
                                                sequence_id,
                                                error) != -1) &&
@@ -5966,8 +7225,6 @@ bgp_configurator_processor_process_enable_address_family (BgpConfiguratorProcess
       g_object_unref (xception);
     }
 
-    if (peerIp != NULL)
-      g_free (peerIp);
     g_object_unref (result_struct);
 
     if (result == TRUE)
@@ -5986,17 +7243,17 @@ bgp_configurator_processor_process_enable_address_family (BgpConfiguratorProcess
 }
 
 static gboolean
-bgp_configurator_processor_process_disable_address_family (BgpConfiguratorProcessor *self,
-                                                           gint32 sequence_id,
-                                                           ThriftProtocol *input_protocol,
-                                                           ThriftProtocol *output_protocol,
-                                                           GError **error)
+bgp_configurator_processor_process_get_routes (BgpConfiguratorProcessor *self,
+                                               gint32 sequence_id,
+                                               ThriftProtocol *input_protocol,
+                                               ThriftProtocol *output_protocol,
+                                               GError **error)
 {
   gboolean result = TRUE;
   ThriftTransport * transport;
   ThriftApplicationException *xception;
-  BgpConfiguratorDisableAddressFamilyArgs * args =
-    g_object_new (TYPE_BGP_CONFIGURATOR_DISABLE_ADDRESS_FAMILY_ARGS, NULL);
+  BgpConfiguratorGetRoutesArgs * args =
+    g_object_new (TYPE_BGP_CONFIGURATOR_GET_ROUTES_ARGS, NULL);
 
   g_object_get (input_protocol, "transport", &transport, NULL);
 
@@ -6004,36 +7261,35 @@ bgp_configurator_processor_process_disable_address_family (BgpConfiguratorProces
       (thrift_protocol_read_message_end (input_protocol, error) != -1) &&
       (thrift_transport_read_end (transport, error) != FALSE))
   {
-    gchar * peerIp;
-    af_afi afi;
-    af_safi safi;
-    gint return_value;
-    BgpConfiguratorDisableAddressFamilyResult * result_struct;
+    gint optype;
+    gint winSize;
+    Routes * return_value;
+    BgpConfiguratorGetRoutesResult * result_struct;
 
     g_object_get (args,
-                  "peerIp", &peerIp,
-                  "afi", &afi,
-                  "safi", &safi,
+                  "optype", &optype,
+                  "winSize", &winSize,
                   NULL);
 
     g_object_unref (transport);
     g_object_get (output_protocol, "transport", &transport, NULL);
 
-    result_struct = g_object_new (TYPE_BGP_CONFIGURATOR_DISABLE_ADDRESS_FAMILY_RESULT, NULL);
+    result_struct = g_object_new (TYPE_BGP_CONFIGURATOR_GET_ROUTES_RESULT, NULL);
     g_object_get (result_struct, "success", &return_value, NULL);
 
-    if (bgp_configurator_handler_disable_address_family (BGP_CONFIGURATOR_IF (self->handler),
-                                                         (gint32 *)&return_value,
-                                                         peerIp,
-                                                         afi,
-                                                         safi,
-                                                         error) == TRUE)
+    if (bgp_configurator_handler_get_routes (BGP_CONFIGURATOR_IF (self->handler),
+                                             &return_value,
+                                             optype,
+                                             winSize,
+                                             error) == TRUE)
     {
-      g_object_set (result_struct, "success", (gint)(gint32)return_value, NULL);
+      g_object_set (result_struct, "success", return_value, NULL);
+      if (return_value != NULL)
+        g_object_unref (return_value);
 
       result =
         ((thrift_protocol_write_message_begin (output_protocol,
-                                               "disableAddressFamily",
+                                               "getRoutes",
                                                T_REPLY,
                                                sequence_id,
                                                error) != -1) &&
@@ -6044,7 +7300,7 @@ bgp_configurator_processor_process_disable_address_family (BgpConfiguratorProces
     else
     {
       if (*error == NULL)
-        g_warning ("BgpConfigurator.disableAddressFamily implementation returned FALSE "
+        g_warning ("BgpConfigurator.getRoutes implementation returned FALSE "
                    "but did not set an error");
 
       xception =
@@ -6057,7 +7313,7 @@ bgp_configurator_processor_process_disable_address_family (BgpConfiguratorProces
 
       result =
         ((thrift_protocol_write_message_begin (output_protocol,
-                                               "disableAddressFamily",
+                                               "getRoutes",
                                                T_EXCEPTION,
                                                sequence_id,
                                                error) != -1) &&
@@ -6068,8 +7324,6 @@ bgp_configurator_processor_process_disable_address_family (BgpConfiguratorProces
       g_object_unref (xception);
     }
 
-    if (peerIp != NULL)
-      g_free (peerIp);
     g_object_unref (result_struct);
 
     if (result == TRUE)
@@ -6088,17 +7342,17 @@ bgp_configurator_processor_process_disable_address_family (BgpConfiguratorProces
 }
 
 static gboolean
-bgp_configurator_processor_process_set_log_config (BgpConfiguratorProcessor *self,
-                                                   gint32 sequence_id,
-                                                   ThriftProtocol *input_protocol,
-                                                   ThriftProtocol *output_protocol,
-                                                   GError **error)
+bgp_configurator_processor_process_enable_multipath (BgpConfiguratorProcessor *self,
+                                                     gint32 sequence_id,
+                                                     ThriftProtocol *input_protocol,
+                                                     ThriftProtocol *output_protocol,
+                                                     GError **error)
 {
   gboolean result = TRUE;
   ThriftTransport * transport;
   ThriftApplicationException *xception;
-  BgpConfiguratorSetLogConfigArgs * args =
-    g_object_new (TYPE_BGP_CONFIGURATOR_SET_LOG_CONFIG_ARGS, NULL);
+  BgpConfiguratorEnableMultipathArgs * args =
+    g_object_new (TYPE_BGP_CONFIGURATOR_ENABLE_MULTIPATH_ARGS, NULL);
 
   g_object_get (input_protocol, "transport", &transport, NULL);
 
@@ -6106,33 +7360,33 @@ bgp_configurator_processor_process_set_log_config (BgpConfiguratorProcessor *sel
       (thrift_protocol_read_message_end (input_protocol, error) != -1) &&
       (thrift_transport_read_end (transport, error) != FALSE))
   {
-    gchar * logFileName;
-    gchar * logLevel;
+    af_afi afi;
+    af_safi safi;
     gint return_value;
-    BgpConfiguratorSetLogConfigResult * result_struct;
+    BgpConfiguratorEnableMultipathResult * result_struct;
 
     g_object_get (args,
-                  "logFileName", &logFileName,
-                  "logLevel", &logLevel,
+                  "afi", &afi,
+                  "safi", &safi,
                   NULL);
 
     g_object_unref (transport);
     g_object_get (output_protocol, "transport", &transport, NULL);
 
-    result_struct = g_object_new (TYPE_BGP_CONFIGURATOR_SET_LOG_CONFIG_RESULT, NULL);
+    result_struct = g_object_new (TYPE_BGP_CONFIGURATOR_ENABLE_MULTIPATH_RESULT, NULL);
     g_object_get (result_struct, "success", &return_value, NULL);
 
-    if (bgp_configurator_handler_set_log_config (BGP_CONFIGURATOR_IF (self->handler),
-                                                 (gint32 *)&return_value,
-                                                 logFileName,
-                                                 logLevel,
-                                                 error) == TRUE)
+    if (bgp_configurator_handler_enable_multipath (BGP_CONFIGURATOR_IF (self->handler),
+                                                   (gint32 *)&return_value,
+                                                   afi,
+                                                   safi,
+                                                   error) == TRUE)
     {
       g_object_set (result_struct, "success", (gint)(gint32)return_value, NULL);
 
       result =
         ((thrift_protocol_write_message_begin (output_protocol,
-                                               "setLogConfig",
+                                               "enableMultipath",
                                                T_REPLY,
                                                sequence_id,
                                                error) != -1) &&
@@ -6143,7 +7397,7 @@ bgp_configurator_processor_process_set_log_config (BgpConfiguratorProcessor *sel
     else
     {
       if (*error == NULL)
-        g_warning ("BgpConfigurator.setLogConfig implementation returned FALSE "
+        g_warning ("BgpConfigurator.enableMultipath implementation returned FALSE "
                    "but did not set an error");
 
       xception =
@@ -6156,7 +7410,7 @@ bgp_configurator_processor_process_set_log_config (BgpConfiguratorProcessor *sel
 
       result =
         ((thrift_protocol_write_message_begin (output_protocol,
-                                               "setLogConfig",
+                                               "enableMultipath",
                                                T_EXCEPTION,
                                                sequence_id,
                                                error) != -1) &&
@@ -6167,10 +7421,6 @@ bgp_configurator_processor_process_set_log_config (BgpConfiguratorProcessor *sel
       g_object_unref (xception);
     }
 
-    if (logFileName != NULL)
-      g_free (logFileName);
-    if (logLevel != NULL)
-      g_free (logLevel);
     g_object_unref (result_struct);
 
     if (result == TRUE)
@@ -6189,17 +7439,17 @@ bgp_configurator_processor_process_set_log_config (BgpConfiguratorProcessor *sel
 }
 
 static gboolean
-bgp_configurator_processor_process_enable_graceful_restart (BgpConfiguratorProcessor *self,
-                                                            gint32 sequence_id,
-                                                            ThriftProtocol *input_protocol,
-                                                            ThriftProtocol *output_protocol,
-                                                            GError **error)
+bgp_configurator_processor_process_disable_multipath (BgpConfiguratorProcessor *self,
+                                                      gint32 sequence_id,
+                                                      ThriftProtocol *input_protocol,
+                                                      ThriftProtocol *output_protocol,
+                                                      GError **error)
 {
   gboolean result = TRUE;
   ThriftTransport * transport;
   ThriftApplicationException *xception;
-  BgpConfiguratorEnableGracefulRestartArgs * args =
-    g_object_new (TYPE_BGP_CONFIGURATOR_ENABLE_GRACEFUL_RESTART_ARGS, NULL);
+  BgpConfiguratorDisableMultipathArgs * args =
+    g_object_new (TYPE_BGP_CONFIGURATOR_DISABLE_MULTIPATH_ARGS, NULL);
 
   g_object_get (input_protocol, "transport", &transport, NULL);
 
@@ -6207,30 +7457,33 @@ bgp_configurator_processor_process_enable_graceful_restart (BgpConfiguratorProce
       (thrift_protocol_read_message_end (input_protocol, error) != -1) &&
       (thrift_transport_read_end (transport, error) != FALSE))
   {
-    gint stalepathTime;
+    af_afi afi;
+    af_safi safi;
     gint return_value;
-    BgpConfiguratorEnableGracefulRestartResult * result_struct;
+    BgpConfiguratorDisableMultipathResult * result_struct;
 
     g_object_get (args,
-                  "stalepathTime", &stalepathTime,
+                  "afi", &afi,
+                  "safi", &safi,
                   NULL);
 
     g_object_unref (transport);
     g_object_get (output_protocol, "transport", &transport, NULL);
 
-    result_struct = g_object_new (TYPE_BGP_CONFIGURATOR_ENABLE_GRACEFUL_RESTART_RESULT, NULL);
+    result_struct = g_object_new (TYPE_BGP_CONFIGURATOR_DISABLE_MULTIPATH_RESULT, NULL);
     g_object_get (result_struct, "success", &return_value, NULL);
 
-    if (bgp_configurator_handler_enable_graceful_restart (BGP_CONFIGURATOR_IF (self->handler),
-                                                          (gint32 *)&return_value,
-                                                          stalepathTime,
-                                                          error) == TRUE)
+    if (bgp_configurator_handler_disable_multipath (BGP_CONFIGURATOR_IF (self->handler),
+                                                    (gint32 *)&return_value,
+                                                    afi,
+                                                    safi,
+                                                    error) == TRUE)
     {
       g_object_set (result_struct, "success", (gint)(gint32)return_value, NULL);
 
       result =
         ((thrift_protocol_write_message_begin (output_protocol,
-                                               "enableGracefulRestart",
+                                               "disableMultipath",
                                                T_REPLY,
                                                sequence_id,
                                                error) != -1) &&
@@ -6241,7 +7494,7 @@ bgp_configurator_processor_process_enable_graceful_restart (BgpConfiguratorProce
     else
     {
       if (*error == NULL)
-        g_warning ("BgpConfigurator.enableGracefulRestart implementation returned FALSE "
+        g_warning ("BgpConfigurator.disableMultipath implementation returned FALSE "
                    "but did not set an error");
 
       xception =
@@ -6254,7 +7507,7 @@ bgp_configurator_processor_process_enable_graceful_restart (BgpConfiguratorProce
 
       result =
         ((thrift_protocol_write_message_begin (output_protocol,
-                                               "enableGracefulRestart",
+                                               "disableMultipath",
                                                T_EXCEPTION,
                                                sequence_id,
                                                error) != -1) &&
@@ -6283,17 +7536,17 @@ bgp_configurator_processor_process_enable_graceful_restart (BgpConfiguratorProce
 }
 
 static gboolean
-bgp_configurator_processor_process_disable_graceful_restart (BgpConfiguratorProcessor *self,
-                                                             gint32 sequence_id,
-                                                             ThriftProtocol *input_protocol,
-                                                             ThriftProtocol *output_protocol,
-                                                             GError **error)
+bgp_configurator_processor_process_multipaths (BgpConfiguratorProcessor *self,
+                                               gint32 sequence_id,
+                                               ThriftProtocol *input_protocol,
+                                               ThriftProtocol *output_protocol,
+                                               GError **error)
 {
   gboolean result = TRUE;
   ThriftTransport * transport;
   ThriftApplicationException *xception;
-  BgpConfiguratorDisableGracefulRestartArgs * args =
-    g_object_new (TYPE_BGP_CONFIGURATOR_DISABLE_GRACEFUL_RESTART_ARGS, NULL);
+  BgpConfiguratorMultipathsArgs * args =
+    g_object_new (TYPE_BGP_CONFIGURATOR_MULTIPATHS_ARGS, NULL);
 
   g_object_get (input_protocol, "transport", &transport, NULL);
 
@@ -6301,24 +7554,33 @@ bgp_configurator_processor_process_disable_graceful_restart (BgpConfiguratorProc
       (thrift_protocol_read_message_end (input_protocol, error) != -1) &&
       (thrift_transport_read_end (transport, error) != FALSE))
   {
+    gchar * rd;
+    gint maxPath;
     gint return_value;
-    BgpConfiguratorDisableGracefulRestartResult * result_struct;
+    BgpConfiguratorMultipathsResult * result_struct;
+
+    g_object_get (args,
+                  "rd", &rd,
+                  "maxPath", &maxPath,
+                  NULL);
 
     g_object_unref (transport);
     g_object_get (output_protocol, "transport", &transport, NULL);
 
-    result_struct = g_object_new (TYPE_BGP_CONFIGURATOR_DISABLE_GRACEFUL_RESTART_RESULT, NULL);
+    result_struct = g_object_new (TYPE_BGP_CONFIGURATOR_MULTIPATHS_RESULT, NULL);
     g_object_get (result_struct, "success", &return_value, NULL);
 
-    if (bgp_configurator_handler_disable_graceful_restart (BGP_CONFIGURATOR_IF (self->handler),
-                                                           (gint32 *)&return_value,
-                                                           error) == TRUE)
+    if (bgp_configurator_handler_multipaths (BGP_CONFIGURATOR_IF (self->handler),
+                                             (gint32 *)&return_value,
+                                             rd,
+                                             maxPath,
+                                             error) == TRUE)
     {
       g_object_set (result_struct, "success", (gint)(gint32)return_value, NULL);
 
       result =
         ((thrift_protocol_write_message_begin (output_protocol,
-                                               "disableGracefulRestart",
+                                               "multipaths",
                                                T_REPLY,
                                                sequence_id,
                                                error) != -1) &&
@@ -6329,7 +7591,7 @@ bgp_configurator_processor_process_disable_graceful_restart (BgpConfiguratorProc
     else
     {
       if (*error == NULL)
-        g_warning ("BgpConfigurator.disableGracefulRestart implementation returned FALSE "
+        g_warning ("BgpConfigurator.multipaths implementation returned FALSE "
                    "but did not set an error");
 
       xception =
@@ -6342,7 +7604,7 @@ bgp_configurator_processor_process_disable_graceful_restart (BgpConfiguratorProc
 
       result =
         ((thrift_protocol_write_message_begin (output_protocol,
-                                               "disableGracefulRestart",
+                                               "multipaths",
                                                T_EXCEPTION,
                                                sequence_id,
                                                error) != -1) &&
@@ -6353,6 +7615,8 @@ bgp_configurator_processor_process_disable_graceful_restart (BgpConfiguratorProc
       g_object_unref (xception);
     }
 
+    if (rd != NULL)
+      g_free (rd);
     g_object_unref (result_struct);
 
     if (result == TRUE)
@@ -6371,17 +7635,17 @@ bgp_configurator_processor_process_disable_graceful_restart (BgpConfiguratorProc
 }
 
 static gboolean
-bgp_configurator_processor_process_get_routes (BgpConfiguratorProcessor *self,
-                                               gint32 sequence_id,
-                                               ThriftProtocol *input_protocol,
-                                               ThriftProtocol *output_protocol,
-                                               GError **error)
+bgp_configurator_processor_process_push_routes (BgpConfiguratorProcessor *self,
+                                                gint32 sequence_id,
+                                                ThriftProtocol *input_protocol,
+                                                ThriftProtocol *output_protocol,
+                                                GError **error)
 {
   gboolean result = TRUE;
   ThriftTransport * transport;
   ThriftApplicationException *xception;
-  BgpConfiguratorGetRoutesArgs * args =
-    g_object_new (TYPE_BGP_CONFIGURATOR_GET_ROUTES_ARGS, NULL);
+  BgpConfiguratorPushRoutesArgs * args =
+    g_object_new (TYPE_BGP_CONFIGURATOR_PUSH_ROUTES_ARGS, NULL);
 
   g_object_get (input_protocol, "transport", &transport, NULL);
 
@@ -6389,35 +7653,32 @@ bgp_configurator_processor_process_get_routes (BgpConfiguratorProcessor *self,
       (thrift_protocol_read_message_end (input_protocol, error) != -1) &&
       (thrift_transport_read_end (transport, error) != FALSE))
   {
-    gint optype;
-    gint winSize;
-    Routes * return_value;
-    BgpConfiguratorGetRoutesResult * result_struct;
+    GPtrArray * routes;
+    GArray * return_value;
+    BgpConfiguratorPushRoutesResult * result_struct;
 
     g_object_get (args,
-                  "optype", &optype,
-                  "winSize", &winSize,
+                  "routes", &routes,
                   NULL);
 
     g_object_unref (transport);
     g_object_get (output_protocol, "transport", &transport, NULL);
 
-    result_struct = g_object_new (TYPE_BGP_CONFIGURATOR_GET_ROUTES_RESULT, NULL);
+    result_struct = g_object_new (TYPE_BGP_CONFIGURATOR_PUSH_ROUTES_RESULT, NULL);
     g_object_get (result_struct, "success", &return_value, NULL);
 
-    if (bgp_configurator_handler_get_routes (BGP_CONFIGURATOR_IF (self->handler),
-                                             &return_value,
-                                             optype,
-                                             winSize,
-                                             error) == TRUE)
+    if (bgp_configurator_handler_push_routes (BGP_CONFIGURATOR_IF (self->handler),
+                                              &return_value,
+                                              routes,
+                                              error) == TRUE)
     {
       g_object_set (result_struct, "success", return_value, NULL);
       if (return_value != NULL)
-        g_object_unref (return_value);
+        g_array_unref (return_value);
 
       result =
         ((thrift_protocol_write_message_begin (output_protocol,
-                                               "getRoutes",
+                                               "pushRoutes",
                                                T_REPLY,
                                                sequence_id,
                                                error) != -1) &&
@@ -6428,7 +7689,7 @@ bgp_configurator_processor_process_get_routes (BgpConfiguratorProcessor *self,
     else
     {
       if (*error == NULL)
-        g_warning ("BgpConfigurator.getRoutes implementation returned FALSE "
+        g_warning ("BgpConfigurator.pushRoutes implementation returned FALSE "
                    "but did not set an error");
 
       xception =
@@ -6441,7 +7702,7 @@ bgp_configurator_processor_process_get_routes (BgpConfiguratorProcessor *self,
 
       result =
         ((thrift_protocol_write_message_begin (output_protocol,
-                                               "getRoutes",
+                                               "pushRoutes",
                                                T_EXCEPTION,
                                                sequence_id,
                                                error) != -1) &&
@@ -6452,6 +7713,8 @@ bgp_configurator_processor_process_get_routes (BgpConfiguratorProcessor *self,
       g_object_unref (xception);
     }
 
+    if (routes != NULL)
+      g_ptr_array_unref (routes);
     g_object_unref (result_struct);
 
     if (result == TRUE)
@@ -6470,17 +7733,17 @@ bgp_configurator_processor_process_get_routes (BgpConfiguratorProcessor *self,
 }
 
 static gboolean
-bgp_configurator_processor_process_enable_multipath (BgpConfiguratorProcessor *self,
-                                                     gint32 sequence_id,
-                                                     ThriftProtocol *input_protocol,
-                                                     ThriftProtocol *output_protocol,
-                                                     GError **error)
+bgp_configurator_processor_process_withdraw_routes (BgpConfiguratorProcessor *self,
+                                                    gint32 sequence_id,
+                                                    ThriftProtocol *input_protocol,
+                                                    ThriftProtocol *output_protocol,
+                                                    GError **error)
 {
   gboolean result = TRUE;
   ThriftTransport * transport;
   ThriftApplicationException *xception;
-  BgpConfiguratorEnableMultipathArgs * args =
-    g_object_new (TYPE_BGP_CONFIGURATOR_ENABLE_MULTIPATH_ARGS, NULL);
+  BgpConfiguratorWithdrawRoutesArgs * args =
+    g_object_new (TYPE_BGP_CONFIGURATOR_WITHDRAW_ROUTES_ARGS, NULL);
 
   g_object_get (input_protocol, "transport", &transport, NULL);
 
@@ -6488,33 +7751,32 @@ bgp_configurator_processor_process_enable_multipath (BgpConfiguratorProcessor *s
       (thrift_protocol_read_message_end (input_protocol, error) != -1) &&
       (thrift_transport_read_end (transport, error) != FALSE))
   {
-    af_afi afi;
-    af_safi safi;
-    gint return_value;
-    BgpConfiguratorEnableMultipathResult * result_struct;
+    GPtrArray * routes;
+    GArray * return_value;
+    BgpConfiguratorWithdrawRoutesResult * result_struct;
 
     g_object_get (args,
-                  "afi", &afi,
-                  "safi", &safi,
+                  "routes", &routes,
                   NULL);
 
     g_object_unref (transport);
     g_object_get (output_protocol, "transport", &transport, NULL);
 
-    result_struct = g_object_new (TYPE_BGP_CONFIGURATOR_ENABLE_MULTIPATH_RESULT, NULL);
+    result_struct = g_object_new (TYPE_BGP_CONFIGURATOR_WITHDRAW_ROUTES_RESULT, NULL);
     g_object_get (result_struct, "success", &return_value, NULL);
 
-    if (bgp_configurator_handler_enable_multipath (BGP_CONFIGURATOR_IF (self->handler),
-                                                   (gint32 *)&return_value,
-                                                   afi,
-                                                   safi,
-                                                   error) == TRUE)
+    if (bgp_configurator_handler_withdraw_routes (BGP_CONFIGURATOR_IF (self->handler),
+                                                  &return_value,
+                                                  routes,
+                                                  error) == TRUE)
     {
-      g_object_set (result_struct, "success", (gint)(gint32)return_value, NULL);
+      g_object_set (result_struct, "success", return_value, NULL);
+      if (return_value != NULL)
+        g_array_unref (return_value);
 
       result =
         ((thrift_protocol_write_message_begin (output_protocol,
-                                               "enableMultipath",
+                                               "withdrawRoutes",
                                                T_REPLY,
                                                sequence_id,
                                                error) != -1) &&
@@ -6525,7 +7787,7 @@ bgp_configurator_processor_process_enable_multipath (BgpConfiguratorProcessor *s
     else
     {
       if (*error == NULL)
-        g_warning ("BgpConfigurator.enableMultipath implementation returned FALSE "
+        g_warning ("BgpConfigurator.withdrawRoutes implementation returned FALSE "
                    "but did not set an error");
 
       xception =
@@ -6538,7 +7800,7 @@ bgp_configurator_processor_process_enable_multipath (BgpConfiguratorProcessor *s
 
       result =
         ((thrift_protocol_write_message_begin (output_protocol,
-                                               "enableMultipath",
+                                               "withdrawRoutes",
                                                T_EXCEPTION,
                                                sequence_id,
                                                error) != -1) &&
@@ -6549,6 +7811,8 @@ bgp_configurator_processor_process_enable_multipath (BgpConfiguratorProcessor *s
       g_object_unref (xception);
     }
 
+    if (routes != NULL)
+      g_ptr_array_unref (routes);
     g_object_unref (result_struct);
 
     if (result == TRUE)
@@ -6567,17 +7831,17 @@ bgp_configurator_processor_process_enable_multipath (BgpConfiguratorProcessor *s
 }
 
 static gboolean
-bgp_configurator_processor_process_disable_multipath (BgpConfiguratorProcessor *self,
-                                                      gint32 sequence_id,
-                                                      ThriftProtocol *input_protocol,
-                                                      ThriftProtocol *output_protocol,
-                                                      GError **error)
+bgp_configurator_processor_process_resume_notifications (BgpConfiguratorProcessor *self,
+                                                         gint32 sequence_id,
+                                                         ThriftProtocol *input_protocol,
+                                                         ThriftProtocol *output_protocol,
+                                                         GError **error)
 {
   gboolean result = TRUE;
   ThriftTransport * transport;
   ThriftApplicationException *xception;
-  BgpConfiguratorDisableMultipathArgs * args =
-    g_object_new (TYPE_BGP_CONFIGURATOR_DISABLE_MULTIPATH_ARGS, NULL);
+  BgpConfiguratorResumeNotificationsArgs * args =
+    g_object_new (TYPE_BGP_CONFIGURATOR_RESUME_NOTIFICATIONS_ARGS, NULL);
 
   g_object_get (input_protocol, "transport", &transport, NULL);
 
@@ -6585,33 +7849,30 @@ bgp_configurator_processor_process_disable_multipath (BgpConfiguratorProcessor *
       (thrift_protocol_read_message_end (input_protocol, error) != -1) &&
       (thrift_transport_read_end (transport, error) != FALSE))
   {
-    af_afi afi;
-    af_safi safi;
+    gint64 fromSeq;
     gint return_value;
-    BgpConfiguratorDisableMultipathResult * result_struct;
+    BgpConfiguratorResumeNotificationsResult * result_struct;
 
     g_object_get (args,
-                  "afi", &afi,
-                  "safi", &safi,
+                  "fromSeq", &fromSeq,
                   NULL);
 
     g_object_unref (transport);
     g_object_get (output_protocol, "transport", &transport, NULL);
 
-    result_struct = g_object_new (TYPE_BGP_CONFIGURATOR_DISABLE_MULTIPATH_RESULT, NULL);
+    result_struct = g_object_new (TYPE_BGP_CONFIGURATOR_RESUME_NOTIFICATIONS_RESULT, NULL);
     g_object_get (result_struct, "success", &return_value, NULL);
 
-    if (bgp_configurator_handler_disable_multipath (BGP_CONFIGURATOR_IF (self->handler),
-                                                    (gint32 *)&return_value,
-                                                    afi,
-                                                    safi,
-                                                    error) == TRUE)
+    if (bgp_configurator_handler_resume_notifications (BGP_CONFIGURATOR_IF (self->handler),
+                                                       (gint32 *)&return_value,
+                                                       fromSeq,
+                                                       error) == TRUE)
     {
       g_object_set (result_struct, "success", (gint)(gint32)return_value, NULL);
 
       result =
         ((thrift_protocol_write_message_begin (output_protocol,
-                                               "disableMultipath",
+                                               "resumeNotifications",
                                                T_REPLY,
                                                sequence_id,
                                                error) != -1) &&
@@ -6622,7 +7883,7 @@ bgp_configurator_processor_process_disable_multipath (BgpConfiguratorProcessor *
     else
     {
       if (*error == NULL)
-        g_warning ("BgpConfigurator.disableMultipath implementation returned FALSE "
+        g_warning ("BgpConfigurator.resumeNotifications implementation returned FALSE "
                    "but did not set an error");
 
       xception =
@@ -6635,7 +7896,7 @@ bgp_configurator_processor_process_disable_multipath (BgpConfiguratorProcessor *
 
       result =
         ((thrift_protocol_write_message_begin (output_protocol,
-                                               "disableMultipath",
+                                               "resumeNotifications",
                                                T_EXCEPTION,
                                                sequence_id,
                                                error) != -1) &&
@@ -6664,17 +7925,17 @@ bgp_configurator_processor_process_disable_multipath (BgpConfiguratorProcessor *
 }
 
 static gboolean
-bgp_configurator_processor_process_multipaths (BgpConfiguratorProcessor *self,
-                                               gint32 sequence_id,
-                                               ThriftProtocol *input_protocol,
-                                               ThriftProtocol *output_protocol,
-                                               GError **error)
+bgp_configurator_processor_process_apply_config (BgpConfiguratorProcessor *self,
+                                                 gint32 sequence_id,
+                                                 ThriftProtocol *input_protocol,
+                                                 ThriftProtocol *output_protocol,
+                                                 GError **error)
 {
   gboolean result = TRUE;
   ThriftTransport * transport;
   ThriftApplicationException *xception;
-  BgpConfiguratorMultipathsArgs * args =
-    g_object_new (TYPE_BGP_CONFIGURATOR_MULTIPATHS_ARGS, NULL);
+  BgpConfiguratorApplyConfigArgs * args =
+    g_object_new (TYPE_BGP_CONFIGURATOR_APPLY_CONFIG_ARGS, NULL);
 
   g_object_get (input_protocol, "transport", &transport, NULL);
 
@@ -6682,33 +7943,30 @@ bgp_configurator_processor_process_multipaths (BgpConfiguratorProcessor *self,
       (thrift_protocol_read_message_end (input_protocol, error) != -1) &&
       (thrift_transport_read_end (transport, error) != FALSE))
   {
-    gchar * rd;
-    gint maxPath;
+    ConfigSnapshot * snapshot;
     gint return_value;
-    BgpConfiguratorMultipathsResult * result_struct;
+    BgpConfiguratorApplyConfigResult * result_struct;
 
     g_object_get (args,
-                  "rd", &rd,
-                  "maxPath", &maxPath,
+                  "snapshot", &snapshot,
                   NULL);
 
     g_object_unref (transport);
     g_object_get (output_protocol, "transport", &transport, NULL);
 
-    result_struct = g_object_new (TYPE_BGP_CONFIGURATOR_MULTIPATHS_RESULT, NULL);
+    result_struct = g_object_new (TYPE_BGP_CONFIGURATOR_APPLY_CONFIG_RESULT, NULL);
     g_object_get (result_struct, "success", &return_value, NULL);
 
-    if (bgp_configurator_handler_multipaths (BGP_CONFIGURATOR_IF (self->handler),
-                                             (gint32 *)&return_value,
-                                             rd,
-                                             maxPath,
-                                             error) == TRUE)
+    if (bgp_configurator_handler_apply_config (BGP_CONFIGURATOR_IF (self->handler),
+                                               (gint32 *)&return_value,
+                                               snapshot,
+                                               error) == TRUE)
     {
       g_object_set (result_struct, "success", (gint)(gint32)return_value, NULL);
 
       result =
         ((thrift_protocol_write_message_begin (output_protocol,
-                                               "multipaths",
+                                               "applyConfig",
                                                T_REPLY,
                                                sequence_id,
                                                error) != -1) &&
@@ -6719,7 +7977,7 @@ bgp_configurator_processor_process_multipaths (BgpConfiguratorProcessor *self,
     else
     {
       if (*error == NULL)
-        g_warning ("BgpConfigurator.multipaths implementation returned FALSE "
+        g_warning ("BgpConfigurator.applyConfig implementation returned FALSE "
                    "but did not set an error");
 
       xception =
@@ -6732,7 +7990,7 @@ bgp_configurator_processor_process_multipaths (BgpConfiguratorProcessor *self,
 
       result =
         ((thrift_protocol_write_message_begin (output_protocol,
-                                               "multipaths",
+                                               "applyConfig",
                                                T_EXCEPTION,
                                                sequence_id,
                                                error) != -1) &&
@@ -6743,8 +8001,8 @@ bgp_configurator_processor_process_multipaths (BgpConfiguratorProcessor *self,
       g_object_unref (xception);
     }
 
-    if (rd != NULL)
-      g_free (rd);
+    if (snapshot != NULL)
+      g_object_unref (snapshot);
     g_object_unref (result_struct);
 
     if (result == TRUE)
@@ -6873,7 +8131,7 @@ bgp_configurator_processor_init (BgpConfiguratorProcessor *self)
   self->handler = NULL;
   self->process_map = g_hash_table_new (g_str_hash, g_str_equal);
 
-  for (index = 0; index < 21; index += 1)
+  for (index = 0; index < 25; index += 1)
     g_hash_table_insert (self->process_map,
                          bgp_configurator_processor_process_function_defs[index].name,
                          &bgp_configurator_processor_process_function_defs[index]);
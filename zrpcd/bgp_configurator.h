@@ -39,6 +39,10 @@ struct _BgpConfiguratorIfInterface
   gboolean (*enable_multipath) (BgpConfiguratorIf *iface, gint32* _return, const af_afi afi, const af_safi safi, GError **error);
   gboolean (*disable_multipath) (BgpConfiguratorIf *iface, gint32* _return, const af_afi afi, const af_safi safi, GError **error);
   gboolean (*multipaths) (BgpConfiguratorIf *iface, gint32* _return, const gchar * rd, const gint32 maxPath, GError **error);
+  gboolean (*push_routes) (BgpConfiguratorIf *iface, GArray ** _return, const GPtrArray * routes, GError **error);
+  gboolean (*withdraw_routes) (BgpConfiguratorIf *iface, GArray ** _return, const GPtrArray * routes, GError **error);
+  gboolean (*resume_notifications) (BgpConfiguratorIf *iface, gint32* _return, const gint64 fromSeq, GError **error);
+  gboolean (*apply_config) (BgpConfiguratorIf *iface, gint32* _return, const ConfigSnapshot * snapshot, GError **error);
 };
 typedef struct _BgpConfiguratorIfInterface BgpConfiguratorIfInterface;
 
@@ -69,6 +73,10 @@ gboolean bgp_configurator_if_get_routes (BgpConfiguratorIf *iface, Routes ** _re
 gboolean bgp_configurator_if_enable_multipath (BgpConfiguratorIf *iface, gint32* _return, const af_afi afi, const af_safi safi, GError **error);
 gboolean bgp_configurator_if_disable_multipath (BgpConfiguratorIf *iface, gint32* _return, const af_afi afi, const af_safi safi, GError **error);
 gboolean bgp_configurator_if_multipaths (BgpConfiguratorIf *iface, gint32* _return, const gchar * rd, const gint32 maxPath, GError **error);
+gboolean bgp_configurator_if_push_routes (BgpConfiguratorIf *iface, GArray ** _return, const GPtrArray * routes, GError **error);
+gboolean bgp_configurator_if_withdraw_routes (BgpConfiguratorIf *iface, GArray ** _return, const GPtrArray * routes, GError **error);
+gboolean bgp_configurator_if_resume_notifications (BgpConfiguratorIf *iface, gint32* _return, const gint64 fromSeq, GError **error);
+gboolean bgp_configurator_if_apply_config (BgpConfiguratorIf *iface, gint32* _return, const ConfigSnapshot * snapshot, GError **error);
 
 /* BgpConfigurator service client */
 struct _BgpConfiguratorClient
@@ -157,6 +165,18 @@ gboolean bgp_configurator_client_recv_disable_multipath (BgpConfiguratorIf * ifa
 gboolean bgp_configurator_client_multipaths (BgpConfiguratorIf * iface, gint32* _return, const gchar * rd, const gint32 maxPath, GError ** error);
 gboolean bgp_configurator_client_send_multipaths (BgpConfiguratorIf * iface, const gchar * rd, const gint32 maxPath, GError ** error);
 gboolean bgp_configurator_client_recv_multipaths (BgpConfiguratorIf * iface, gint32* _return, GError ** error);
+gboolean bgp_configurator_client_push_routes (BgpConfiguratorIf * iface, GArray ** _return, const GPtrArray * routes, GError ** error);
+gboolean bgp_configurator_client_send_push_routes (BgpConfiguratorIf * iface, const GPtrArray * routes, GError ** error);
+gboolean bgp_configurator_client_recv_push_routes (BgpConfiguratorIf * iface, GArray ** _return, GError ** error);
+gboolean bgp_configurator_client_withdraw_routes (BgpConfiguratorIf * iface, GArray ** _return, const GPtrArray * routes, GError ** error);
+gboolean bgp_configurator_client_send_withdraw_routes (BgpConfiguratorIf * iface, const GPtrArray * routes, GError ** error);
+gboolean bgp_configurator_client_recv_withdraw_routes (BgpConfiguratorIf * iface, GArray ** _return, GError ** error);
+gboolean bgp_configurator_client_resume_notifications (BgpConfiguratorIf * iface, gint32* _return, const gint64 fromSeq, GError ** error);
+gboolean bgp_configurator_client_send_resume_notifications (BgpConfiguratorIf * iface, const gint64 fromSeq, GError ** error);
+gboolean bgp_configurator_client_recv_resume_notifications (BgpConfiguratorIf * iface, gint32* _return, GError ** error);
+gboolean bgp_configurator_client_apply_config (BgpConfiguratorIf * iface, gint32* _return, const ConfigSnapshot * snapshot, GError ** error);
+gboolean bgp_configurator_client_send_apply_config (BgpConfiguratorIf * iface, const ConfigSnapshot * snapshot, GError ** error);
+gboolean bgp_configurator_client_recv_apply_config (BgpConfiguratorIf * iface, gint32* _return, GError ** error);
 void bgp_configurator_client_set_property (GObject *object, guint property_id, const GValue *value, GParamSpec *pspec);
 void bgp_configurator_client_get_property (GObject *object, guint property_id, GValue *value, GParamSpec *pspec);
 
@@ -192,6 +212,10 @@ struct _BgpConfiguratorHandlerClass
   gboolean (*enable_multipath) (BgpConfiguratorIf *iface, gint32* _return, const af_afi afi, const af_safi safi, GError **error);
   gboolean (*disable_multipath) (BgpConfiguratorIf *iface, gint32* _return, const af_afi afi, const af_safi safi, GError **error);
   gboolean (*multipaths) (BgpConfiguratorIf *iface, gint32* _return, const gchar * rd, const gint32 maxPath, GError **error);
+  gboolean (*push_routes) (BgpConfiguratorIf *iface, GArray ** _return, const GPtrArray * routes, GError **error);
+  gboolean (*withdraw_routes) (BgpConfiguratorIf *iface, GArray ** _return, const GPtrArray * routes, GError **error);
+  gboolean (*resume_notifications) (BgpConfiguratorIf *iface, gint32* _return, const gint64 fromSeq, GError **error);
+  gboolean (*apply_config) (BgpConfiguratorIf *iface, gint32* _return, const ConfigSnapshot * snapshot, GError **error);
 };
 typedef struct _BgpConfiguratorHandlerClass BgpConfiguratorHandlerClass;
 
@@ -224,6 +248,10 @@ gboolean bgp_configurator_handler_get_routes (BgpConfiguratorIf *iface, Routes *
 gboolean bgp_configurator_handler_enable_multipath (BgpConfiguratorIf *iface, gint32* _return, const af_afi afi, const af_safi safi, GError **error);
 gboolean bgp_configurator_handler_disable_multipath (BgpConfiguratorIf *iface, gint32* _return, const af_afi afi, const af_safi safi, GError **error);
 gboolean bgp_configurator_handler_multipaths (BgpConfiguratorIf *iface, gint32* _return, const gchar * rd, const gint32 maxPath, GError **error);
+gboolean bgp_configurator_handler_push_routes (BgpConfiguratorIf *iface, GArray ** _return, const GPtrArray * routes, GError **error);
+gboolean bgp_configurator_handler_withdraw_routes (BgpConfiguratorIf *iface, GArray ** _return, const GPtrArray * routes, GError **error);
+gboolean bgp_configurator_handler_resume_notifications (BgpConfiguratorIf *iface, gint32* _return, const gint64 fromSeq, GError **error);
+gboolean bgp_configurator_handler_apply_config (BgpConfiguratorIf *iface, gint32* _return, const ConfigSnapshot * snapshot, GError **error);
 
 /* BgpConfigurator processor */
 struct _BgpConfiguratorProcessor
@@ -33,6 +33,12 @@ bgp_updater_if_on_notification_send_event (BgpUpdaterIf *iface, const gchar * pr
   return BGP_UPDATER_IF_GET_INTERFACE (iface)->on_notification_send_event (iface, prefix, errCode, errSubcode, error);
 }
 
+gboolean
+bgp_updater_if_on_update_batch (BgpUpdaterIf *iface, const GPtrArray * updates, GError **error)
+{
+  return BGP_UPDATER_IF_GET_INTERFACE (iface)->on_update_batch (iface, updates, error);
+}
+
 GType
 bgp_updater_if_get_type (void)
 {
@@ -408,6 +414,71 @@ gboolean bgp_updater_client_on_notification_send_event (BgpUpdaterIf * iface, co
   return TRUE;
 }
 
+gboolean bgp_updater_client_send_on_update_batch (BgpUpdaterIf * iface, const GPtrArray * updates, GError ** error)
+{
+  gint32 cseqid = 0;
+  ThriftProtocol * protocol = BGP_UPDATER_CLIENT (iface)->output_protocol;
+
+  if (thrift_protocol_write_message_begin (protocol, "onUpdateBatch", T_ONEWAY, cseqid, error) < 0)
+    return FALSE;
+
+  {
+    gint32 ret;
+    gint32 xfer = 0;
+
+    
+    if ((ret = thrift_protocol_write_struct_begin (protocol, "onUpdateBatch_args", error)) < 0)
+      return 0;
+    xfer += ret;
+    if ((ret = thrift_protocol_write_field_begin (protocol, "updates", T_LIST, 1, error)) < 0)
+      return 0;
+    xfer += ret;
+    {
+      guint i19;
+
+      if ((ret = thrift_protocol_write_list_begin (protocol, T_STRUCT, (gint32) (updates ? updates->len : 0), error)) < 0)
+        return 0;
+      xfer += ret;
+      for (i19 = 0; i19 < (updates ? updates->len : 0); i19++)
+      {
+        if ((ret = thrift_struct_write (THRIFT_STRUCT ((g_ptr_array_index ((GPtrArray *) updates, i19))), protocol, error)) < 0)
+          return 0;
+        xfer += ret;
+
+      }
+      if ((ret = thrift_protocol_write_list_end (protocol, error)) < 0)
+        return 0;
+      xfer += ret;
+    }
+    if ((ret = thrift_protocol_write_field_end (protocol, error)) < 0)
+      return 0;
+    xfer += ret;
+    if ((ret = thrift_protocol_write_field_stop (protocol, error)) < 0)
+      return 0;
+    xfer += ret;
+    if ((ret = thrift_protocol_write_struct_end (protocol, error)) < 0)
+      return 0;
+    xfer += ret;
+
+  }
+
+  if (thrift_protocol_write_message_end (protocol, error) < 0)
+    return FALSE;
+  if (!thrift_transport_flush (protocol->transport, error))
+    return FALSE;
+  if (!thrift_transport_write_end (protocol->transport, error))
+    return FALSE;
+
+  return TRUE;
+}
+
+gboolean bgp_updater_client_on_update_batch (BgpUpdaterIf * iface, const GPtrArray * updates, GError ** error)
+{
+  if (!bgp_updater_client_send_on_update_batch (iface, updates, error))
+    return FALSE;
+  return TRUE;
+}
+
 static void
 bgp_updater_if_interface_init (BgpUpdaterIfInterface *iface)
 {
@@ -415,6 +486,7 @@ bgp_updater_if_interface_init (BgpUpdaterIfInterface *iface)
   iface->on_update_withdraw_route = bgp_updater_client_on_update_withdraw_route;
   iface->on_start_config_resync_notification = bgp_updater_client_on_start_config_resync_notification;
   iface->on_notification_send_event = bgp_updater_client_on_notification_send_event;
+  iface->on_update_batch = bgp_updater_client_on_update_batch;
 }
 
 static void
@@ -487,6 +559,13 @@ gboolean bgp_updater_handler_on_notification_send_event (BgpUpdaterIf * iface, c
   return BGP_UPDATER_HANDLER_GET_CLASS (iface)->on_notification_send_event (iface, prefix, errCode, errSubcode, error);
 }
 
+gboolean bgp_updater_handler_on_update_batch (BgpUpdaterIf * iface, const GPtrArray * updates, GError ** error)
+{
+  g_return_val_if_fail (IS_BGP_UPDATER_HANDLER (iface), FALSE);
+
+  return BGP_UPDATER_HANDLER_GET_CLASS (iface)->on_update_batch (iface, updates, error);
+}
+
 static void
 bgp_updater_handler_bgp_updater_if_interface_init (BgpUpdaterIfInterface *iface)
 {
@@ -494,6 +573,7 @@ bgp_updater_handler_bgp_updater_if_interface_init (BgpUpdaterIfInterface *iface)
   iface->on_update_withdraw_route = bgp_updater_handler_on_update_withdraw_route;
   iface->on_start_config_resync_notification = bgp_updater_handler_on_start_config_resync_notification;
   iface->on_notification_send_event = bgp_updater_handler_on_notification_send_event;
+  iface->on_update_batch = bgp_updater_handler_on_update_batch;
 }
 
 static void
@@ -509,6 +589,7 @@ bgp_updater_handler_class_init (BgpUpdaterHandlerClass *cls)
   cls->on_update_withdraw_route = NULL;
   cls->on_start_config_resync_notification = NULL;
   cls->on_notification_send_event = NULL;
+  cls->on_update_batch = NULL;
 }
 
 enum _BgpUpdaterProcessorProperties
@@ -557,9 +638,15 @@ bgp_updater_processor_process_on_notification_send_event (BgpUpdaterProcessor *,
                                                           ThriftProtocol *,
                                                           ThriftProtocol *,
                                                           GError **);
+static gboolean
+bgp_updater_processor_process_on_update_batch (BgpUpdaterProcessor *,
+                                               gint32,
+                                               ThriftProtocol *,
+                                               ThriftProtocol *,
+                                               GError **);
 
 static bgp_updater_processor_process_function_def
-bgp_updater_processor_process_function_defs[4] = {
+bgp_updater_processor_process_function_defs[5] = {
   {
     (gchar *)"onUpdatePushRoute",
     bgp_updater_processor_process_on_update_push_route
@@ -575,6 +662,10 @@ bgp_updater_processor_process_function_defs[4] = {
   {
     (gchar *)"onNotificationSendEvent",
     bgp_updater_processor_process_on_notification_send_event
+  },
+  {
+    (gchar *)"onUpdateBatch",
+    bgp_updater_processor_process_on_update_batch
   }
 };
 
@@ -896,6 +987,78 @@ bgp_updater_processor_process_on_notification_send_event (BgpUpdaterProcessor *s
   return result;
 }
 
+static gboolean
+bgp_updater_processor_process_on_update_batch (BgpUpdaterProcessor *self,
+                                               gint32 sequence_id,
+                                               ThriftProtocol *input_protocol,
+                                               ThriftProtocol *output_protocol,
+                                               GError **error)
+{
+  gboolean result = TRUE;
+  ThriftTransport * transport;
+  ThriftApplicationException *xception;
+  BgpUpdaterOnUpdateBatchArgs * args =
+    g_object_new (TYPE_BGP_UPDATER_ON_UPDATE_BATCH_ARGS, NULL);
+
+  THRIFT_UNUSED_VAR (sequence_id);
+  THRIFT_UNUSED_VAR (output_protocol);
+
+  g_object_get (input_protocol, "transport", &transport, NULL);
+
+  if ((thrift_struct_read (THRIFT_STRUCT (args), input_protocol, error) != -1) &&
+      (thrift_protocol_read_message_end (input_protocol, error) != -1) &&
+      (thrift_transport_read_end (transport, error) != FALSE))
+  {
+    GPtrArray * updates;
+
+    g_object_get (args,
+                  "updates", &updates,
+                  NULL);
+
+    if (bgp_updater_handler_on_update_batch (BGP_UPDATER_IF (self->handler),
+                                             updates,
+                                             error) == TRUE)
+    {
+    }
+    else
+    {
+      if (*error == NULL)
+        g_warning ("BgpUpdater.onUpdateBatch implementation returned FALSE "
+                   "but did not set an error");
+
+      xception =
+        g_object_new (THRIFT_TYPE_APPLICATION_EXCEPTION,
+                      "type",    *error != NULL ? (*error)->code :
+                                 THRIFT_APPLICATION_EXCEPTION_ERROR_UNKNOWN,
+                      "message", *error != NULL ? (*error)->message : NULL,
+                      NULL);
+      g_clear_error (error);
+
+      result =
+        ((thrift_protocol_write_message_begin (output_protocol,
+                                               "onUpdateBatch",
+                                               T_EXCEPTION,
+                                               sequence_id,
+                                               error) != -1) &&
+         (thrift_struct_write (THRIFT_STRUCT (xception),
+                               output_protocol,
+                               error) != -1));
+
+      g_object_unref (xception);
+    }
+
+    if (updates != NULL)
+      g_ptr_array_unref (updates);
+  }
+  else
+    result = FALSE;
+
+  g_object_unref (transport);
+  g_object_unref (args);
+
+  return result;
+}
+
 static gboolean
 bgp_updater_processor_dispatch_call (ThriftDispatchProcessor *dispatch_processor,
                                      ThriftProtocol *input_protocol,
@@ -1007,7 +1170,7 @@ bgp_updater_processor_init (BgpUpdaterProcessor *self)
   self->handler = NULL;
   self->process_map = g_hash_table_new (g_str_hash, g_str_equal);
 
-  for (index = 0; index < 4; index += 1)
+  for (index = 0; index < 5; index += 1)
     g_hash_table_insert (self->process_map,
                          bgp_updater_processor_process_function_defs[index].name,
                          &bgp_updater_processor_process_function_defs[index]);
@@ -22,6 +22,7 @@ struct _BgpUpdaterIfInterface
   gboolean (*on_update_withdraw_route) (BgpUpdaterIf *iface, const gchar * rd, const gchar * prefix, const gint32 prefixlen, const gchar * nexthop, const gint32 label, GError **error);
   gboolean (*on_start_config_resync_notification) (BgpUpdaterIf *iface, GError **error);
   gboolean (*on_notification_send_event) (BgpUpdaterIf *iface, const gchar * prefix, const gint8 errCode, const gint8 errSubcode, GError **error);
+  gboolean (*on_update_batch) (BgpUpdaterIf *iface, const GPtrArray * updates, GError **error);
 };
 typedef struct _BgpUpdaterIfInterface BgpUpdaterIfInterface;
 
@@ -35,6 +36,7 @@ gboolean bgp_updater_if_on_update_push_route (BgpUpdaterIf *iface, const gchar *
 gboolean bgp_updater_if_on_update_withdraw_route (BgpUpdaterIf *iface, const gchar * rd, const gchar * prefix, const gint32 prefixlen, const gchar * nexthop, const gint32 label, GError **error);
 gboolean bgp_updater_if_on_start_config_resync_notification (BgpUpdaterIf *iface, GError **error);
 gboolean bgp_updater_if_on_notification_send_event (BgpUpdaterIf *iface, const gchar * prefix, const gint8 errCode, const gint8 errSubcode, GError **error);
+gboolean bgp_updater_if_on_update_batch (BgpUpdaterIf *iface, const GPtrArray * updates, GError **error);
 
 /* BgpUpdater service client */
 struct _BgpUpdaterClient
@@ -68,6 +70,8 @@ gboolean bgp_updater_client_on_start_config_resync_notification (BgpUpdaterIf *
 gboolean bgp_updater_client_send_on_start_config_resync_notification (BgpUpdaterIf * iface, GError ** error);
 gboolean bgp_updater_client_on_notification_send_event (BgpUpdaterIf * iface, const gchar * prefix, const gint8 errCode, const gint8 errSubcode, GError ** error);
 gboolean bgp_updater_client_send_on_notification_send_event (BgpUpdaterIf * iface, const gchar * prefix, const gint8 errCode, const gint8 errSubcode, GError ** error);
+gboolean bgp_updater_client_on_update_batch (BgpUpdaterIf * iface, const GPtrArray * updates, GError ** error);
+gboolean bgp_updater_client_send_on_update_batch (BgpUpdaterIf * iface, const GPtrArray * updates, GError ** error);
 void bgp_updater_client_set_property (GObject *object, guint property_id, const GValue *value, GParamSpec *pspec);
 void bgp_updater_client_get_property (GObject *object, guint property_id, GValue *value, GParamSpec *pspec);
 
@@ -86,6 +90,7 @@ struct _BgpUpdaterHandlerClass
   gboolean (*on_update_withdraw_route) (BgpUpdaterIf *iface, const gchar * rd, const gchar * prefix, const gint32 prefixlen, const gchar * nexthop, const gint32 label, GError **error);
   gboolean (*on_start_config_resync_notification) (BgpUpdaterIf *iface, GError **error);
   gboolean (*on_notification_send_event) (BgpUpdaterIf *iface, const gchar * prefix, const gint8 errCode, const gint8 errSubcode, GError **error);
+  gboolean (*on_update_batch) (BgpUpdaterIf *iface, const GPtrArray * updates, GError **error);
 };
 typedef struct _BgpUpdaterHandlerClass BgpUpdaterHandlerClass;
 
@@ -101,6 +106,7 @@ gboolean bgp_updater_handler_on_update_push_route (BgpUpdaterIf *iface, const gc
 gboolean bgp_updater_handler_on_update_withdraw_route (BgpUpdaterIf *iface, const gchar * rd, const gchar * prefix, const gint32 prefixlen, const gchar * nexthop, const gint32 label, GError **error);
 gboolean bgp_updater_handler_on_start_config_resync_notification (BgpUpdaterIf *iface, GError **error);
 gboolean bgp_updater_handler_on_notification_send_event (BgpUpdaterIf *iface, const gchar * prefix, const gint8 errCode, const gint8 errSubcode, GError **error);
+gboolean bgp_updater_handler_on_update_batch (BgpUpdaterIf *iface, const GPtrArray * updates, GError **error);
 
 /* BgpUpdater processor */
 struct _BgpUpdaterProcessor
@@ -5,11 +5,16 @@
  *
  * See the LICENSE file.
  */
+#include <pthread.h>
+#include <poll.h>
+#include <fcntl.h>
+#include <unistd.h>
 #include "zrpcd/qzmqclient.h"
 #include "thread.h"
 
 #include "zrpcd/zrpc_debug.h"
 #include "zrpcd/zrpc_memory.h"
+#include "zrpcd/zrpc_stats.h"
 #include "zrpcd/qzcclient.h"
 #include "zrpcd/qzcclient.capnp.h"
 
@@ -18,18 +23,82 @@
 static struct QZCReply *qzcclient_msg_to_reply(zmq_msg_t *msg);
 static struct capn *rc_table_get_entry(void *data, size_t size);
 static void rc_table_init();
+static int qzcclient_async_recv (struct qzcclient_sock *sock, int flags);
+
+/* poll period of a thread waiting for replies, in case a wake up is
+ * missed */
+#define QZCCLIENT_POLL_TIMEOUT 100
+
+/* completion of a request of a batch. rep is NULL on failure, and is
+ * owned by callback. called with socket lock held */
+typedef void (*qzcclient_cb_t)(void *arg, struct QZCReply *rep);
+
+/*
+ * synchronous request context. the reply message is handed over by
+ * the thread that received it, and decoded by the waiting thread,
+ * whose reply buffers it then uses.
+ */
+struct qzcclient_sync {
+	int has_msg;
+	zmq_msg_t msg;
+	/* profile, recorded once reply is decoded */
+	int type;
+	int elem;
+	size_t len;
+	size_t size;
+	uint64_t elapsed;
+};
+
+/* pipelined request, sent or waiting for a free window slot */
+struct qzcclient_async_req {
+	uint32_t id;
+	/* encoded request, kept until it is sent */
+	void *buf;
+	size_t len;
+	qzcclient_cb_t func;
+	void *arg;
+	/* synchronous request waiting for its reply, instead of func */
+	struct qzcclient_sync *sync;
+	/* decremented once request is completed */
+	int *pending;
+	/* profile: QZCRequest type, elem id, and time sent */
+	int type;
+	int elem;
+	uint64_t sent;
+	struct qzcclient_async_req *next;
+};
 
 struct qzcclient_sock {
 	void *zmq;
+	/* requests may be sent by several threads */
+	pthread_mutex_t lock;
 	struct qzmqclient_cb *cb;
+	/* pipelined mode (DEALER socket) */
+	int async;
+	int fd;
+	uint32_t next_id;
+	unsigned int window;
+	unsigned int inflight;
+	/* threads waiting for replies: one polls the socket without the
+	 * lock, others sleep until a reply is handed over or polling is
+	 * free. the pipe wakes the polling thread up */
+	pthread_cond_t cond;
+	int polling;
+	int wake[2];
+	/* requests sent, waiting for reply */
+	struct qzcclient_async_req *sent_head, *sent_tail;
+	/* requests waiting for a free window slot */
+	struct qzcclient_async_req *wait_head, *wait_tail;
 };
 
 #define RC_TABLE_NB_ELEM 50
-struct capn rc_table[RC_TABLE_NB_ELEM];
-int rc_table_index = 0;
-int rc_table_cnt = 0;
-int rc_table_index_free = 0;
-int rc_table_inited = 0;
+/* per thread, so that replies are only recycled by the thread
+ * that received them */
+static __thread struct capn rc_table[RC_TABLE_NB_ELEM];
+static __thread int rc_table_index = 0;
+static __thread int rc_table_cnt = 0;
+static __thread int rc_table_index_free = 0;
+static __thread int rc_table_inited = 0;
 int qzcclient_debug = 0;
 /*
  * manages capnproto allocations for some routines
@@ -101,20 +170,79 @@ void qzcclient_init (void)
   rc_table_init();
 }
 
+/* a request has been completed, or socket state changed: waiting
+ * threads check their requests, polling thread included */
+static void qzcclient_async_wake (struct qzcclient_sock *sock)
+{
+  if (!sock->async)
+    return;
+  pthread_cond_broadcast (&sock->cond);
+  if (sock->polling && write (sock->wake[1], "", 1) < 0 && errno != EAGAIN)
+    zrpc_log ("qzcclient wake failed: %s (%d)", strerror (errno), errno);
+}
+
+/* complete all pending asynchronous requests with a NULL reply */
+static void qzcclient_async_fail_all (struct qzcclient_sock *sock)
+{
+  struct qzcclient_async_req *areq;
+
+  while (sock->sent_head || sock->wait_head)
+    {
+      if (sock->sent_head)
+        {
+          areq = sock->sent_head;
+          sock->sent_head = areq->next;
+        }
+      else
+        {
+          areq = sock->wait_head;
+          sock->wait_head = areq->next;
+        }
+      if (areq->buf)
+        ZRPC_FREE (areq->buf);
+      else
+        zrpc_stats_qzc_request (areq->type, areq->elem, areq->len, 0,
+                                zrpc_stats_now () - areq->sent, 1);
+      if (areq->sync == NULL && areq->func)
+        areq->func (areq->arg, NULL);
+      if (areq->pending)
+        (*areq->pending)--;
+      ZRPC_FREE (areq);
+    }
+  sock->sent_tail = sock->wait_tail = NULL;
+  sock->inflight = 0;
+  qzcclient_async_wake (sock);
+}
+
 void qzcclient_close (struct qzcclient_sock *sock)
 {
   if(sock->cb)
     qzmqclient_thread_cancel (sock->cb);
+  if(sock->async)
+    {
+      qzcclient_async_fail_all (sock);
+      pthread_cond_destroy (&sock->cond);
+      pthread_mutex_destroy (&sock->lock);
+      close (sock->wake[0]);
+      close (sock->wake[1]);
+    }
   zmq_close (sock->zmq);
   ZRPC_FREE( sock);
 }
 
-struct qzcclient_sock *qzcclient_connect (const char *url)
+/*
+ * connect to a QZC server with a DEALER socket.
+ * up to window requests may be outstanding at the same time:
+ * requests of several threads, or of a batch, are pipelined.
+ */
+struct qzcclient_sock *qzcclient_connect_window (const char *url, unsigned int window)
 {
   void *qzc_sock;
   struct qzcclient_sock *ret;
+  size_t fd_len;
+  int i;
 
-  qzc_sock = zmq_socket (qzmqclient_context, ZMQ_REQ);
+  qzc_sock = zmq_socket (qzmqclient_context, ZMQ_DEALER);
   if (!qzc_sock)
     {
       zrpc_log ("zmq_socket failed: %s (%d)", strerror (errno), errno);
@@ -129,9 +257,29 @@ struct qzcclient_sock *qzcclient_connect (const char *url)
   ret = ZRPC_CALLOC(sizeof(*ret));
   ret->zmq = qzc_sock;
   ret->cb = NULL;
+  ret->async = 1;
+  ret->window = window ? window : 1;
+  /* socket fd is polled by threads waiting for replies */
+  fd_len = sizeof (ret->fd);
+  if (zmq_getsockopt (qzc_sock, ZMQ_FD, &ret->fd, &fd_len) || pipe (ret->wake))
+    {
+      zrpc_log ("qzcclient_connect failed: %s (%d)", strerror (errno), errno);
+      zmq_close (qzc_sock);
+      ZRPC_FREE (ret);
+      return NULL;
+    }
+  for (i = 0; i < 2; i++)
+    fcntl (ret->wake[i], F_SETFL, fcntl (ret->wake[i], F_GETFL, 0) | O_NONBLOCK);
+  pthread_mutex_init (&ret->lock, NULL);
+  pthread_cond_init (&ret->cond, NULL);
   return ret;
 }
 
+struct qzcclient_sock *qzcclient_connect (const char *url)
+{
+  return qzcclient_connect_window (url, QZCCLIENT_DEFAULT_WINDOW);
+}
+
 struct qzcclient_sock *qzcclient_subscribe (struct thread_master *master, const char *url,
                                 void (*func)(void *arg, void *zmqsock, struct zmq_msg_t *msg))
 {
@@ -164,24 +312,17 @@ struct qzcclient_sock *qzcclient_subscribe (struct thread_master *master, const
   return ret;
 }
 
-/* send QZCrequest and return QZCreply or NULL if timeout */
-struct QZCReply *
-qzcclient_do(struct qzcclient_sock *sock,
-             struct QZCRequest *req_ptr)
+/* encode QZCrequest in buf. return encoded size */
+static ssize_t qzcclient_encode (struct QZCRequest *req_ptr, uint8_t *buf, size_t size)
 {
   struct capn *rc;
   struct capn_segment *cs;
   struct QZCRequest *req, rq;
-  struct QZCReply *rep;
   QZCRequest_ptr p;
-  zmq_msg_t msg;
-  uint8_t buf[4096];
-  ssize_t rs;
-  int ret;
 
   rc = rc_table_get_entry(NULL, 0);
   cs = capn_root(rc).seg;
-  memset(buf, 0, 4096);
+  memset(buf, 0, size);
   if(req_ptr == NULL)
     {
       /* ping request */
@@ -195,47 +336,346 @@ qzcclient_do(struct qzcclient_sock *sock,
   p = new_QZCRequest(cs);
   write_QZCRequest( req, p);
   capn_setp(capn_root(rc), 0, p.p);
-  rs = capn_write_mem(rc, buf, sizeof(buf), 0);
+  return capn_write_mem(rc, buf, size, 0);
+}
 
-  ret = zmq_send (sock->zmq, buf, rs, 0);
-  if (ret < 0)
+/*
+ * send an encoded request. the request id and an empty delimiter
+ * frame are prepended: the REP socket on the server side returns
+ * them unchanged before the reply.
+ */
+static int qzcclient_async_send_msg (struct qzcclient_sock *sock,
+                                     struct qzcclient_async_req *areq)
+{
+  if (zmq_send (sock->zmq, &areq->id, sizeof (areq->id), ZMQ_SNDMORE) < 0 ||
+      zmq_send (sock->zmq, NULL, 0, ZMQ_SNDMORE) < 0 ||
+      zmq_send (sock->zmq, areq->buf, areq->len, 0) < 0)
     {
       zrpc_log ("zmq_send failed: %s (%d)", strerror (errno), errno);
-      return NULL;
+      return -1;
     }
+  ZRPC_FREE (areq->buf);
+  areq->buf = NULL;
+  areq->sent = zrpc_stats_now ();
+  areq->next = NULL;
+  if (sock->sent_tail)
+    sock->sent_tail->next = areq;
+  else
+    sock->sent_head = areq;
+  sock->sent_tail = areq;
+  sock->inflight++;
+  /* sending may consume the edge of a reply the polling thread waits for */
+  if (sock->polling && write (sock->wake[1], "", 1) < 0 && errno != EAGAIN)
+    zrpc_log ("qzcclient wake failed: %s (%d)", strerror (errno), errno);
+  return 0;
+}
+
+/* send waiting requests, as long as window allows it */
+static void qzcclient_async_refill (struct qzcclient_sock *sock)
+{
+  struct qzcclient_async_req *areq;
 
-  if (zmq_msg_init (&msg))
+  while (sock->wait_head && sock->inflight < sock->window)
     {
-      zrpc_log ("zmq_msg_init failed: %s (%d)", strerror (errno), errno);
-      return NULL;
+      areq = sock->wait_head;
+      sock->wait_head = areq->next;
+      if (sock->wait_head == NULL)
+        sock->wait_tail = NULL;
+      if (qzcclient_async_send_msg (sock, areq) < 0)
+        {
+          ZRPC_FREE (areq->buf);
+          if (areq->sync == NULL && areq->func)
+            areq->func (areq->arg, NULL);
+          if (areq->pending)
+            (*areq->pending)--;
+          ZRPC_FREE (areq);
+          qzcclient_async_wake (sock);
+        }
+    }
+}
+
+/* elem id of request, -1 if none. get, create, set and unset
+ * requests all have it in their second word */
+static int qzcclient_req_elem (struct QZCRequest *req)
+{
+  if (req == NULL)
+    return -1;
+  switch (req->which)
+    {
+    case QZCRequest_get:
+    case QZCRequest_create:
+    case QZCRequest_set:
+    case QZCRequest_unset:
+      return (int)capn_read64 (req->get.p, 8);
+    default:
+      return -1;
     }
+}
+
+/*
+ * send QZCrequest without waiting for reply. on completion, either
+ * func is called or the reply is handed over to sync. pending, if
+ * set, counts requests not completed yet. called with sock->lock held.
+ * return the request identifier, 0 on failure.
+ */
+static uint32_t
+qzcclient_send_req (struct qzcclient_sock *sock, struct QZCRequest *req,
+                    qzcclient_cb_t func, void *arg,
+                    struct qzcclient_sync *sync, int *pending)
+{
+  struct qzcclient_async_req *areq;
+  uint8_t buf[4096];
+  ssize_t rs;
+  uint32_t id;
+
+  rs = qzcclient_encode (req, buf, sizeof(buf));
+  if (rs <= 0)
+    {
+      zrpc_log ("qzcclient_send. request encoding failed");
+      return 0;
+    }
+  areq = ZRPC_CALLOC (sizeof (struct qzcclient_async_req));
+  if (++sock->next_id == 0)
+    sock->next_id = 1;
+  areq->id = sock->next_id;
+  areq->buf = ZRPC_MALLOC (rs);
+  memcpy (areq->buf, buf, rs);
+  areq->len = rs;
+  areq->func = func;
+  areq->arg = arg;
+  areq->sync = sync;
+  areq->pending = pending;
+  areq->type = req ? (int)req->which : QZCRequest_ping;
+  areq->elem = qzcclient_req_elem (req);
+  if (sync)
+    {
+      sync->type = areq->type;
+      sync->elem = areq->elem;
+      sync->len = rs;
+    }
+  if (sock->inflight < sock->window && sock->wait_head == NULL)
+    {
+      if (qzcclient_async_send_msg (sock, areq) < 0)
+        {
+          ZRPC_FREE (areq->buf);
+          ZRPC_FREE (areq);
+          return 0;
+        }
+    }
+  else
+    {
+      if (sock->wait_tail)
+        sock->wait_tail->next = areq;
+      else
+        sock->wait_head = areq;
+      sock->wait_tail = areq;
+    }
+  id = areq->id;
+  if (pending)
+    (*pending)++;
+  return id;
+}
+
+/*
+ * receive one reply and complete its request: the reply is handed over
+ * to the waiting thread for a synchronous request, else it is decoded
+ * and passed to the completion callback.
+ * return 1 if a reply has been handled, 0 if no reply is available
+ * (ZMQ_DONTWAIT), -1 on error.
+ */
+static int qzcclient_async_recv (struct qzcclient_sock *sock, int flags)
+{
+  struct qzcclient_async_req *areq, *prev;
+  struct qzcclient_sync *sync;
+  struct QZCReply *rep = NULL;
+  zmq_msg_t msg, reply;
+  uint32_t id = 0;
+  size_t size = 0;
+  int frame = 0, more, ret, has_reply = 0;
+
   do
     {
-      ret = zmq_msg_recv (&msg, sock->zmq, 0);
+      if (zmq_msg_init (&msg))
+        {
+          zrpc_log ("zmq_msg_init failed: %s (%d)", strerror (errno), errno);
+          goto error;
+        }
+      ret = zmq_msg_recv (&msg, sock->zmq, frame ? 0 : flags);
       if (ret < 0)
         {
+          zmq_msg_close (&msg);
+          if (frame == 0 && errno == EAGAIN)
+            return 0;
           zrpc_log ("zmq_msg_recv failed: %s (%d)", strerror (errno), errno);
-          break;
+          goto error;
+        }
+      more = zmq_msg_more (&msg);
+      size += zmq_msg_size (&msg);
+      if (frame == 0 && more && zmq_msg_size (&msg) == sizeof (id))
+        memcpy (&id, zmq_msg_data (&msg), sizeof (id));
+      else if (!more && zmq_msg_size (&msg))
+        {
+          /* decoded once its request is known */
+          zmq_msg_init (&reply);
+          zmq_msg_move (&reply, &msg);
+          has_reply = 1;
         }
-      if (ret >= 0)
-          break;
+      zmq_msg_close (&msg);
+      frame++;
     }
-  while (1);
+  while (more);
 
-  if(ret < 0)
+  /* replies normally come in order, so match is at head */
+  prev = NULL;
+  for (areq = sock->sent_head; areq; prev = areq, areq = areq->next)
+    if (areq->id == id)
+      break;
+  if (areq == NULL)
     {
-      return NULL;
+      zrpc_log ("qzcclient_recv. reply for unknown request %u", id);
+      if (has_reply)
+        zmq_msg_close (&reply);
+      return 1;
     }
-  rep = qzcclient_msg_to_reply(&msg);
-  if(rep == NULL)
+  if (prev)
+    prev->next = areq->next;
+  else
+    sock->sent_head = areq->next;
+  if (sock->sent_tail == areq)
+    sock->sent_tail = prev;
+  sock->inflight--;
+  if (areq->sync)
     {
-      if(qzcclient_debug)
-        zrpc_log ("qzcclient_send. no message reply");
+      /* reply buffers are per thread: the waiting thread decodes it */
+      sync = areq->sync;
+      sync->size = size;
+      sync->elapsed = zrpc_stats_now () - areq->sent;
+      if (has_reply)
+        {
+          zmq_msg_init (&sync->msg);
+          zmq_msg_move (&sync->msg, &reply);
+          zmq_msg_close (&reply);
+          sync->has_msg = 1;
+        }
+      else
+        zrpc_stats_qzc_request (areq->type, areq->elem, areq->len, size,
+                                sync->elapsed, 1);
+    }
+  else
+    {
+      if (has_reply)
+        /* message is closed by the conversion */
+        rep = qzcclient_msg_to_reply (&reply);
+      zrpc_stats_qzc_request (areq->type, areq->elem, areq->len, size,
+                              zrpc_stats_now () - areq->sent,
+                              rep == NULL || rep->error);
+      if (rep == NULL)
+        {
+          if(qzcclient_debug)
+            zrpc_log ("qzcclient_recv. no message reply");
+        }
+      else if (rep->error)
+        {
+          zrpc_log ("qzcclient_recv. reply message error: (%d)", rep->error);
+        }
+      if (areq->func)
+        areq->func (areq->arg, rep);
+      else
+        qzcclient_qzcreply_free (rep);
     }
-  if(rep->error)
+  if (areq->pending)
+    (*areq->pending)--;
+  ZRPC_FREE (areq);
+  qzcclient_async_refill (sock);
+  qzcclient_async_wake (sock);
+  return 1;
+
+ error:
+  if (has_reply)
+    zmq_msg_close (&reply);
+  return -1;
+}
+
+/*
+ * wait until *pending requests are completed, receiving replies
+ * for all threads.
+ * called with sock->lock held. only one thread polls the socket,
+ * without the lock, so that other threads may send meanwhile.
+ * return 0 on success, -1 on error. on error, pending requests
+ * are completed.
+ */
+static int
+qzcclient_wait (struct qzcclient_sock *sock, int *pending)
+{
+  struct pollfd fds[2];
+  char buf[64];
+  int ret;
+
+  while (*pending)
     {
-      zrpc_log ("qzcclient_send. reply message error: (%d)", rep->error);
+      ret = qzcclient_async_recv (sock, ZMQ_DONTWAIT);
+      if (ret < 0)
+        {
+          qzcclient_async_fail_all (sock);
+          return -1;
+        }
+      if (ret > 0)
+        continue;
+      if (sock->polling)
+        {
+          /* woken up by the polling thread once a reply is handled */
+          pthread_cond_wait (&sock->cond, &sock->lock);
+          continue;
+        }
+      sock->polling = 1;
+      pthread_mutex_unlock (&sock->lock);
+      fds[0].fd = sock->fd;
+      fds[0].events = POLLIN;
+      fds[1].fd = sock->wake[0];
+      fds[1].events = POLLIN;
+      if (poll (fds, 2, QZCCLIENT_POLL_TIMEOUT) < 0 && errno != EINTR)
+        zrpc_log ("qzcclient poll failed: %s (%d)", strerror (errno), errno);
+      while (read (sock->wake[0], buf, sizeof (buf)) > 0);
+      pthread_mutex_lock (&sock->lock);
+      sock->polling = 0;
+      /* let another waiting thread poll */
+      pthread_cond_broadcast (&sock->cond);
     }
+  return 0;
+}
+
+/* send QZCrequest and return QZCreply or NULL if failure */
+struct QZCReply *
+qzcclient_do(struct qzcclient_sock *sock,
+             struct QZCRequest *req_ptr)
+{
+  struct qzcclient_sync sync;
+  struct QZCReply *rep = NULL;
+  int pending = 0;
+
+  memset (&sync, 0, sizeof (sync));
+  zrpc_stats_qzc_begin ();
+  /* lock is released while waiting, other threads may send meanwhile */
+  pthread_mutex_lock (&sock->lock);
+  if (qzcclient_send_req (sock, req_ptr, NULL, NULL, &sync, &pending) == 0)
+    {
+      pthread_mutex_unlock (&sock->lock);
+      zrpc_stats_qzc_end ();
+      return NULL;
+    }
+  qzcclient_wait (sock, &pending);
+  pthread_mutex_unlock (&sock->lock);
+  if (sync.has_msg)
+    {
+      rep = qzcclient_msg_to_reply (&sync.msg);
+      zrpc_stats_qzc_request (sync.type, sync.elem, sync.len, sync.size,
+                              sync.elapsed, rep->error);
+      if (rep->error)
+        zrpc_log ("qzcclient_recv. reply message error: (%d)", rep->error);
+    }
+  else if(qzcclient_debug)
+    zrpc_log ("qzcclient_recv. no message reply");
+  zrpc_stats_qzc_end ();
   return rep;
 }
 
@@ -487,6 +927,83 @@ qzcclient_unsetelem (struct qzcclient_sock *sock, uint64_t *nid, int elem, \
   return ret;
 }
 
+static void qzcclient_setelem_batch_done (void *arg, struct QZCReply *rep)
+{
+  struct qzcclient_setelem_entry *entry = arg;
+
+  entry->ret = (rep != NULL && !rep->error);
+  qzcclient_qzcreply_free (rep);
+}
+
+/*
+ * qzc client API. send a batch of QZCSetReq (or QZCUnsetReq if unset
+ * is set) messages, all sharing the same element, data type and context.
+ * all requests are encoded in a single capnp context, and are pipelined
+ * within the socket window. the ret field of each entry is set to 1 if the operation
+ * is successfull, 0 otherwise.
+ * return the number of successfull operations
+ */
+int
+qzcclient_setelem_batch (struct qzcclient_sock *sock, int unset, int elem,
+                         struct qzcclient_setelem_entry *entries, int count,
+                         uint64_t *type_data,
+                         capn_ptr *ctxt, uint64_t *type_ctxt)
+{
+  struct capn rc;
+  struct capn_segment *cs;
+  struct QZCRequest req;
+  struct QZCSetReq sreq;
+  int i, nb_ok = 0, pending;
+
+  if (count <= 0)
+    return 0;
+  /* have to use  local capn_segment - otherwise segfault */
+  capn_init_malloc(&rc);
+  cs = capn_root(&rc).seg;
+  memset(&sreq, 0, sizeof(struct QZCSetReq));
+  sreq.elem = elem;
+  sreq.datatype = *type_data;
+  if(ctxt)
+    {
+      sreq.ctxdata = *ctxt;
+      sreq.ctxtype = *type_ctxt;
+    }
+  zrpc_stats_qzc_begin ();
+  pthread_mutex_lock (&sock->lock);
+  pending = 0;
+  for (i = 0; i < count; i++)
+    {
+      sreq.nid = entries[i].nid;
+      sreq.data = entries[i].data;
+      if (unset)
+        {
+          req.which = QZCRequest_unset;
+          req.unset = new_QZCSetReq(cs);
+          write_QZCSetReq(&sreq, req.unset);
+        }
+      else
+        {
+          req.which = QZCRequest_set;
+          req.set = new_QZCSetReq(cs);
+          write_QZCSetReq(&sreq, req.set);
+        }
+      entries[i].ret = 0;
+      qzcclient_send_req(sock, &req, qzcclient_setelem_batch_done, &entries[i],
+                         NULL, &pending);
+    }
+  /* wait for replies of this batch only */
+  qzcclient_wait(sock, &pending);
+  pthread_mutex_unlock (&sock->lock);
+  zrpc_stats_qzc_end ();
+  for (i = 0; i < count; i++)
+    if (entries[i].ret)
+      nb_ok++;
+  if(qzcclient_debug)
+    zrpc_log ("%sSET batch elem %d: %d/%d OK", unset ? "UN" : "", elem, nb_ok, count);
+  capn_free(&rc);
+  return nb_ok;
+}
+
 void
 qzcclient_qzcgetrep_free(struct QZCGetRep *rep)
 {
@@ -18,6 +18,9 @@
 
 struct qzcclient_sock;
 
+/* default number of outstanding pipelined requests */
+#define QZCCLIENT_DEFAULT_WINDOW 32
+
 void qzcclient_init(void);
 
 void qzcclient_close(struct qzcclient_sock *sock);
@@ -26,6 +29,7 @@ capn_ptr
 qzcclient_msg_to_notification(zmq_msg_t *msg, struct capn *rc);
 
 struct qzcclient_sock *qzcclient_connect (const char *url);
+struct qzcclient_sock *qzcclient_connect_window (const char *url, unsigned int window);
 struct qzcclient_sock *qzcclient_subscribe (struct thread_master *master, const char *url,
                                 void (*func)(void *arg, void *zmqsock, struct zmq_msg_t *msg));
 struct QZCReply *qzcclient_do(struct qzcclient_sock *sock,
@@ -56,6 +60,20 @@ qzcclient_unsetelem (struct qzcclient_sock *sock, uint64_t *nid, int elem, \
                      capn_ptr *data, uint64_t *type_data, \
                      capn_ptr *ctxt, uint64_t *type_ctxt);
 
+/* one entry of a batched set/unset request */
+struct qzcclient_setelem_entry
+{
+  uint64_t nid;
+  capn_ptr data;
+  int ret;
+};
+
+int
+qzcclient_setelem_batch (struct qzcclient_sock *sock, int unset, int elem,
+                         struct qzcclient_setelem_entry *entries, int count,
+                         uint64_t *type_data,
+                         capn_ptr *ctxt, uint64_t *type_ctxt);
+
 void
 qzcclient_qzcreply_free(struct QZCReply *rep);
 
@@ -40,6 +40,8 @@
  const i32 BGP_ERR_ACTIVE = 10
  const i32 BGP_ERR_INACTIVE = 11
  const i32 BGP_ERR_NOT_ITER = 15
+ // notifications can not be replayed, a full getRoutes is needed
+ const i32 BGP_ERR_RESYNC = 16
  const i32 BGP_ERR_PARAM = 100
  
  // supported afi-safi combinations 
@@ -60,7 +62,9 @@
      4: i32 label,
      5: string rd,
      6: string prefix,
-     7: string nexthop
+     7: string nexthop,
+     // notification sequence number, see resumeNotifications()
+     8: optional i64 seq
  }
  
  /*
@@ -75,6 +79,35 @@
      4: optional i32 more
  }
  
+ /*
+  * desired state of a peer, see applyConfig().
+  * ebgpMultihop is 0 for a directly connected peer. no
+  * updateSource means none. VPNv4 address family is enabled
+  * unless vpnv4 is false.
+  */
+ struct PeerConfig {
+     1: string ipAddress,
+     2: i64 asNumber,
+     3: i32 ebgpMultihop,
+     4: optional string updateSource,
+     5: optional bool vpnv4
+ }
+ 
+ // desired state of a vrf. bgpd default is kept without maxPath
+ struct VrfConfig {
+     1: string rd,
+     2: list<string> irts,
+     3: list<string> erts,
+     4: optional i32 maxPath
+ }
+ 
+ // whole configuration wanted by the controller
+ struct ConfigSnapshot {
+     1: list<PeerConfig> peers,
+     2: list<VrfConfig> vrfs,
+     3: list<Update> routes
+ }
+ 
  service BgpConfigurator {
      /*
       * startBgp() starts a bgp instance on the bgp VM. Graceful 
@@ -130,6 +163,41 @@
      i32 enableMultipath(1:af_afi afi, 2:af_safi safi),
      i32 disableMultipath(1:af_afi afi, 2:af_safi safi),
      i32 multipaths(1:string rd, 2:i32 maxPath),
+     /*
+      * pushRoutes() / withdrawRoutes():
+      * batched variants of pushRoute() / withdrawRoute(). each
+      * entry uses the 'prefix', 'nexthop', 'rd' and 'label' fields
+      * of Update. the returned list holds one BGP_ERR code per
+      * entry, in the same order (0 means success).
+      */
+     list<i32> pushRoutes(1:list<Update> routes),
+     list<i32> withdrawRoutes(1:list<Update> routes),
+     /*
+      * resumeNotifications():
+      * route notifications sent with onUpdateBatch() carry a
+      * sequence number. after a reconnection, the controller asks
+      * for notifications starting at 'fromSeq' to be sent again.
+      * returns BGP_ERR_RESYNC if some of them are no longer
+      * retained, in which case a full getRoutes() is needed.
+      * returns BGP_ERR_PARAM if several notification targets are
+      * set and the one of the controller can not be told.
+      */
+     i32 resumeNotifications(1:i64 fromSeq),
+     /*
+      * applyConfig():
+      * bring bgpd to the given configuration, typically after a
+      * controller restart. it is compared with what zrpcd has
+      * configured, and only differences are sent to bgpd: peers
+      * and vrfs missing from the snapshot are deleted, routes
+      * pushed through zrpcd and missing from the snapshot are
+      * withdrawn. every difference is tried; returns the first
+      * BGP_ERR code met, 0 if all went fine.
+      * a request bigger than zrpcd max request size (-M option,
+      * 64 MB by default) is answered with BGP_ERR_PARAM, one per
+      * route for pushRoutes() and withdrawRoutes(): the snapshot
+      * routes may then be sent with pushRoutes() batches.
+      */
+     i32 applyConfig(1:ConfigSnapshot snapshot),
  }
  
  service BgpUpdater {
@@ -143,6 +211,9 @@
    oneway void onStartConfigResyncNotification(),
    // relay to odl a bgp Notification we got from peer 
    oneway void onNotificationSendEvent(1:string prefix, 
-                                       2:byte errCode, 3:byte errSubcode)
+                                       2:byte errCode, 3:byte errSubcode),
+   // several route updates in a single message. type of each
+   // update is either BGP_RT_ADD or BGP_RT_DEL
+   oneway void onUpdateBatch(1:list<Update> updates)
 
 } 
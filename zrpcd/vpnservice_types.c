@@ -42,7 +42,8 @@ enum _UpdateProperties
   PROP_UPDATE_LABEL,
   PROP_UPDATE_RD,
   PROP_UPDATE_PREFIX,
-  PROP_UPDATE_NEXTHOP
+  PROP_UPDATE_NEXTHOP,
+  PROP_UPDATE_SEQ
 };
 
 /* reads a update object */
@@ -203,6 +204,19 @@ update_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
           xfer += ret;
         }
         break;
+      case 8:
+        if (ftype == T_I64)
+        {
+          if ((ret = thrift_protocol_read_i64 (protocol, &this_object->seq, error)) < 0)
+            return -1;
+          xfer += ret;
+          this_object->__isset_seq = TRUE;
+        } else {
+          if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
+            return -1;
+          xfer += ret;
+        }
+        break;
       default:
         if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
           return -1;
@@ -302,6 +316,18 @@ update_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
   if ((ret = thrift_protocol_write_field_end (protocol, error)) < 0)
     return -1;
   xfer += ret;
+  if (this_object->__isset_seq == TRUE) {
+    if ((ret = thrift_protocol_write_field_begin (protocol, "seq", T_I64, 8, error)) < 0)
+      return -1;
+    xfer += ret;
+    if ((ret = thrift_protocol_write_i64 (protocol, this_object->seq, error)) < 0)
+      return -1;
+    xfer += ret;
+
+    if ((ret = thrift_protocol_write_field_end (protocol, error)) < 0)
+      return -1;
+    xfer += ret;
+  }
   if ((ret = thrift_protocol_write_field_stop (protocol, error)) < 0)
     return -1;
   xfer += ret;
@@ -363,6 +389,11 @@ update_set_property (GObject *object,
       self->__isset_nexthop = TRUE;
       break;
 
+    case PROP_UPDATE_SEQ:
+      self->seq = g_value_get_int64 (value);
+      self->__isset_seq = TRUE;
+      break;
+
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, property_id, pspec);
       break;
@@ -407,6 +438,10 @@ update_get_property (GObject *object,
       g_value_set_string (value, self->nexthop);
       break;
 
+    case PROP_UPDATE_SEQ:
+      g_value_set_int64 (value, self->seq);
+      break;
+
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, property_id, pspec);
       break;
@@ -432,6 +467,8 @@ update_instance_init (Update * object)
   object->__isset_prefix = FALSE;
   object->nexthop = NULL;
   object->__isset_nexthop = FALSE;
+  object->seq = 0;
+  object->__isset_seq = FALSE;
 }
 
 static void 
@@ -541,6 +578,17 @@ update_class_init (UpdateClass * cls)
                           NULL,
                           NULL,
                           G_PARAM_READWRITE));
+
+  g_object_class_install_property
+    (gobject_class,
+     PROP_UPDATE_SEQ,
+     g_param_spec_int64 ("seq",
+                         NULL,
+                         NULL,
+                         G_MININT64,
+                         G_MAXINT64,
+                         0,
+                         G_PARAM_READWRITE));
 }
 
 GType
@@ -943,23 +991,19 @@ routes_get_type (void)
   return type;
 }
 
-/* constants */
-
-enum _BgpConfiguratorStartBgpArgsProperties
+enum _PeerConfigProperties
 {
-  PROP_BGP_CONFIGURATOR_START_BGP_ARGS_0,
-  PROP_BGP_CONFIGURATOR_START_BGP_ARGS_AS_NUMBER,
-  PROP_BGP_CONFIGURATOR_START_BGP_ARGS_ROUTER_ID,
-  PROP_BGP_CONFIGURATOR_START_BGP_ARGS_PORT,
-  PROP_BGP_CONFIGURATOR_START_BGP_ARGS_HOLD_TIME,
-  PROP_BGP_CONFIGURATOR_START_BGP_ARGS_KEEP_ALIVE_TIME,
-  PROP_BGP_CONFIGURATOR_START_BGP_ARGS_STALEPATH_TIME,
-  PROP_BGP_CONFIGURATOR_START_BGP_ARGS_ANNOUNCE_FBIT
+  PROP_PEER_CONFIG_0,
+  PROP_PEER_CONFIG_IP_ADDRESS,
+  PROP_PEER_CONFIG_AS_NUMBER,
+  PROP_PEER_CONFIG_EBGP_MULTIHOP,
+  PROP_PEER_CONFIG_UPDATE_SOURCE,
+  PROP_PEER_CONFIG_VPNV4
 };
 
-/* reads a bgp_configurator_start_bgp_args object */
+/* reads a peer_config object */
 static gint32
-bgp_configurator_start_bgp_args_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+peer_config_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
 {
   gint32 ret;
   gint32 xfer = 0;
@@ -968,7 +1012,7 @@ bgp_configurator_start_bgp_args_read (ThriftStruct *object, ThriftProtocol *prot
   gint16 fid;
   guint32 len = 0;
   gpointer data = NULL;
-  BgpConfiguratorStartBgpArgs * this_object = BGP_CONFIGURATOR_START_BGP_ARGS(object);
+  PeerConfig * this_object = PEER_CONFIG(object);
 
   /* satisfy -Wall in case these aren't used */
   THRIFT_UNUSED_VAR (len);
@@ -1007,96 +1051,76 @@ bgp_configurator_start_bgp_args_read (ThriftStruct *object, ThriftProtocol *prot
     switch (fid)
     {
       case 1:
-        if (ftype == T_I64)
-        {
-          if ((ret = thrift_protocol_read_i64 (protocol, &this_object->asNumber, error)) < 0)
-            return -1;
-          xfer += ret;
-          this_object->__isset_asNumber = TRUE;
-        } else {
-          if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
-            return -1;
-          xfer += ret;
-        }
-        break;
-      case 2:
         if (ftype == T_STRING)
         {
-          if (this_object->routerId != NULL)
+          if (this_object->ipAddress != NULL)
           {
-            g_free(this_object->routerId);
-            this_object->routerId = NULL;
+            g_free(this_object->ipAddress);
+            this_object->ipAddress = NULL;
           }
 
-          if ((ret = thrift_protocol_read_string (protocol, &this_object->routerId, error)) < 0)
-            return -1;
-          xfer += ret;
-          this_object->__isset_routerId = TRUE;
-        } else {
-          if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
-            return -1;
-          xfer += ret;
-        }
-        break;
-      case 3:
-        if (ftype == T_I32)
-        {
-          if ((ret = thrift_protocol_read_i32 (protocol, &this_object->port, error)) < 0)
+          if ((ret = thrift_protocol_read_string (protocol, &this_object->ipAddress, error)) < 0)
             return -1;
           xfer += ret;
-          this_object->__isset_port = TRUE;
+          this_object->__isset_ipAddress = TRUE;
         } else {
           if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
             return -1;
           xfer += ret;
         }
         break;
-      case 4:
-        if (ftype == T_I32)
+      case 2:
+        if (ftype == T_I64)
         {
-          if ((ret = thrift_protocol_read_i32 (protocol, &this_object->holdTime, error)) < 0)
+          if ((ret = thrift_protocol_read_i64 (protocol, &this_object->asNumber, error)) < 0)
             return -1;
           xfer += ret;
-          this_object->__isset_holdTime = TRUE;
+          this_object->__isset_asNumber = TRUE;
         } else {
           if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
             return -1;
           xfer += ret;
         }
         break;
-      case 5:
+      case 3:
         if (ftype == T_I32)
         {
-          if ((ret = thrift_protocol_read_i32 (protocol, &this_object->keepAliveTime, error)) < 0)
+          if ((ret = thrift_protocol_read_i32 (protocol, &this_object->ebgpMultihop, error)) < 0)
             return -1;
           xfer += ret;
-          this_object->__isset_keepAliveTime = TRUE;
+          this_object->__isset_ebgpMultihop = TRUE;
         } else {
           if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
             return -1;
           xfer += ret;
         }
         break;
-      case 6:
-        if (ftype == T_I32)
+      case 4:
+        if (ftype == T_STRING)
         {
-          if ((ret = thrift_protocol_read_i32 (protocol, &this_object->stalepathTime, error)) < 0)
+          if (this_object->updateSource != NULL)
+          {
+            g_free(this_object->updateSource);
+            this_object->updateSource = NULL;
+          }
+
+          if ((ret = thrift_protocol_read_string (protocol, &this_object->updateSource, error)) < 0)
             return -1;
           xfer += ret;
-          this_object->__isset_stalepathTime = TRUE;
+          this_object->__isset_updateSource = TRUE;
         } else {
           if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
             return -1;
           xfer += ret;
         }
         break;
-      case 7:
+      case 5:
         if (ftype == T_BOOL)
         {
-          if ((ret = thrift_protocol_read_bool (protocol, &this_object->announceFbit, error)) < 0)
+          if ((ret = thrift_protocol_read_bool (protocol, &this_object->vpnv4, error)) < 0)
             return -1;
           xfer += ret;
-          this_object->__isset_announceFbit = TRUE;
+          this_object->__isset_vpnv4 = TRUE;
         } else {
           if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
             return -1;
@@ -1122,86 +1146,70 @@ bgp_configurator_start_bgp_args_read (ThriftStruct *object, ThriftProtocol *prot
 }
 
 static gint32
-bgp_configurator_start_bgp_args_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+peer_config_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
 {
   gint32 ret;
   gint32 xfer = 0;
 
-  BgpConfiguratorStartBgpArgs * this_object = BGP_CONFIGURATOR_START_BGP_ARGS(object);
+  PeerConfig * this_object = PEER_CONFIG(object);
   THRIFT_UNUSED_VAR (this_object);
-  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorStartBgpArgs", error)) < 0)
-    return -1;
-  xfer += ret;
-  if ((ret = thrift_protocol_write_field_begin (protocol, "asNumber", T_I64, 1, error)) < 0)
-    return -1;
-  xfer += ret;
-  if ((ret = thrift_protocol_write_i64 (protocol, this_object->asNumber, error)) < 0)
-    return -1;
-  xfer += ret;
-
-  if ((ret = thrift_protocol_write_field_end (protocol, error)) < 0)
-    return -1;
-  xfer += ret;
-  if ((ret = thrift_protocol_write_field_begin (protocol, "routerId", T_STRING, 2, error)) < 0)
-    return -1;
-  xfer += ret;
-  if ((ret = thrift_protocol_write_string (protocol, this_object->routerId, error)) < 0)
-    return -1;
-  xfer += ret;
-
-  if ((ret = thrift_protocol_write_field_end (protocol, error)) < 0)
+  if ((ret = thrift_protocol_write_struct_begin (protocol, "PeerConfig", error)) < 0)
     return -1;
   xfer += ret;
-  if ((ret = thrift_protocol_write_field_begin (protocol, "port", T_I32, 3, error)) < 0)
+  if ((ret = thrift_protocol_write_field_begin (protocol, "ipAddress", T_STRING, 1, error)) < 0)
     return -1;
   xfer += ret;
-  if ((ret = thrift_protocol_write_i32 (protocol, this_object->port, error)) < 0)
+  if ((ret = thrift_protocol_write_string (protocol, this_object->ipAddress, error)) < 0)
     return -1;
   xfer += ret;
 
   if ((ret = thrift_protocol_write_field_end (protocol, error)) < 0)
     return -1;
   xfer += ret;
-  if ((ret = thrift_protocol_write_field_begin (protocol, "holdTime", T_I32, 4, error)) < 0)
+  if ((ret = thrift_protocol_write_field_begin (protocol, "asNumber", T_I64, 2, error)) < 0)
     return -1;
   xfer += ret;
-  if ((ret = thrift_protocol_write_i32 (protocol, this_object->holdTime, error)) < 0)
+  if ((ret = thrift_protocol_write_i64 (protocol, this_object->asNumber, error)) < 0)
     return -1;
   xfer += ret;
 
   if ((ret = thrift_protocol_write_field_end (protocol, error)) < 0)
     return -1;
   xfer += ret;
-  if ((ret = thrift_protocol_write_field_begin (protocol, "keepAliveTime", T_I32, 5, error)) < 0)
+  if ((ret = thrift_protocol_write_field_begin (protocol, "ebgpMultihop", T_I32, 3, error)) < 0)
     return -1;
   xfer += ret;
-  if ((ret = thrift_protocol_write_i32 (protocol, this_object->keepAliveTime, error)) < 0)
+  if ((ret = thrift_protocol_write_i32 (protocol, this_object->ebgpMultihop, error)) < 0)
     return -1;
   xfer += ret;
 
   if ((ret = thrift_protocol_write_field_end (protocol, error)) < 0)
     return -1;
   xfer += ret;
-  if ((ret = thrift_protocol_write_field_begin (protocol, "stalepathTime", T_I32, 6, error)) < 0)
-    return -1;
-  xfer += ret;
-  if ((ret = thrift_protocol_write_i32 (protocol, this_object->stalepathTime, error)) < 0)
-    return -1;
-  xfer += ret;
+  if (this_object->__isset_updateSource == TRUE) {
+    if ((ret = thrift_protocol_write_field_begin (protocol, "updateSource", T_STRING, 4, error)) < 0)
+      return -1;
+    xfer += ret;
+    if ((ret = thrift_protocol_write_string (protocol, this_object->updateSource, error)) < 0)
+      return -1;
+    xfer += ret;
 
-  if ((ret = thrift_protocol_write_field_end (protocol, error)) < 0)
-    return -1;
-  xfer += ret;
-  if ((ret = thrift_protocol_write_field_begin (protocol, "announceFbit", T_BOOL, 7, error)) < 0)
-    return -1;
-  xfer += ret;
-  if ((ret = thrift_protocol_write_bool (protocol, this_object->announceFbit, error)) < 0)
-    return -1;
-  xfer += ret;
+    if ((ret = thrift_protocol_write_field_end (protocol, error)) < 0)
+      return -1;
+    xfer += ret;
+  }
+  if (this_object->__isset_vpnv4 == TRUE) {
+    if ((ret = thrift_protocol_write_field_begin (protocol, "vpnv4", T_BOOL, 5, error)) < 0)
+      return -1;
+    xfer += ret;
+    if ((ret = thrift_protocol_write_bool (protocol, this_object->vpnv4, error)) < 0)
+      return -1;
+    xfer += ret;
 
-  if ((ret = thrift_protocol_write_field_end (protocol, error)) < 0)
-    return -1;
-  xfer += ret;
+    if ((ret = thrift_protocol_write_field_end (protocol, error)) < 0)
+      return -1;
+    xfer += ret;
+  }
   if ((ret = thrift_protocol_write_field_stop (protocol, error)) < 0)
     return -1;
   xfer += ret;
@@ -1213,50 +1221,42 @@ bgp_configurator_start_bgp_args_write (ThriftStruct *object, ThriftProtocol *pro
 }
 
 static void
-bgp_configurator_start_bgp_args_set_property (GObject *object,
-                                              guint property_id,
-                                              const GValue *value,
-                                              GParamSpec *pspec)
+peer_config_set_property (GObject *object,
+                          guint property_id,
+                          const GValue *value,
+                          GParamSpec *pspec)
 {
-  BgpConfiguratorStartBgpArgs *self = BGP_CONFIGURATOR_START_BGP_ARGS (object);
+  PeerConfig *self = PEER_CONFIG (object);
 
   switch (property_id)
   {
-    case PROP_BGP_CONFIGURATOR_START_BGP_ARGS_AS_NUMBER:
-      self->asNumber = g_value_get_int64 (value);
-      self->__isset_asNumber = TRUE;
-      break;
-
-    case PROP_BGP_CONFIGURATOR_START_BGP_ARGS_ROUTER_ID:
-      if (self->routerId != NULL)
-        g_free (self->routerId);
-      self->routerId = g_value_dup_string (value);
-      self->__isset_routerId = TRUE;
-      break;
-
-    case PROP_BGP_CONFIGURATOR_START_BGP_ARGS_PORT:
-      self->port = g_value_get_int (value);
-      self->__isset_port = TRUE;
+    case PROP_PEER_CONFIG_IP_ADDRESS:
+      if (self->ipAddress != NULL)
+        g_free (self->ipAddress);
+      self->ipAddress = g_value_dup_string (value);
+      self->__isset_ipAddress = TRUE;
       break;
 
-    case PROP_BGP_CONFIGURATOR_START_BGP_ARGS_HOLD_TIME:
-      self->holdTime = g_value_get_int (value);
-      self->__isset_holdTime = TRUE;
+    case PROP_PEER_CONFIG_AS_NUMBER:
+      self->asNumber = g_value_get_int64 (value);
+      self->__isset_asNumber = TRUE;
       break;
 
-    case PROP_BGP_CONFIGURATOR_START_BGP_ARGS_KEEP_ALIVE_TIME:
-      self->keepAliveTime = g_value_get_int (value);
-      self->__isset_keepAliveTime = TRUE;
+    case PROP_PEER_CONFIG_EBGP_MULTIHOP:
+      self->ebgpMultihop = g_value_get_int (value);
+      self->__isset_ebgpMultihop = TRUE;
       break;
 
-    case PROP_BGP_CONFIGURATOR_START_BGP_ARGS_STALEPATH_TIME:
-      self->stalepathTime = g_value_get_int (value);
-      self->__isset_stalepathTime = TRUE;
+    case PROP_PEER_CONFIG_UPDATE_SOURCE:
+      if (self->updateSource != NULL)
+        g_free (self->updateSource);
+      self->updateSource = g_value_dup_string (value);
+      self->__isset_updateSource = TRUE;
       break;
 
-    case PROP_BGP_CONFIGURATOR_START_BGP_ARGS_ANNOUNCE_FBIT:
-      self->announceFbit = g_value_get_boolean (value);
-      self->__isset_announceFbit = TRUE;
+    case PROP_PEER_CONFIG_VPNV4:
+      self->vpnv4 = g_value_get_boolean (value);
+      self->__isset_vpnv4 = TRUE;
       break;
 
     default:
@@ -1266,41 +1266,33 @@ bgp_configurator_start_bgp_args_set_property (GObject *object,
 }
 
 static void
-bgp_configurator_start_bgp_args_get_property (GObject *object,
-                                              guint property_id,
-                                              GValue *value,
-                                              GParamSpec *pspec)
+peer_config_get_property (GObject *object,
+                          guint property_id,
+                          GValue *value,
+                          GParamSpec *pspec)
 {
-  BgpConfiguratorStartBgpArgs *self = BGP_CONFIGURATOR_START_BGP_ARGS (object);
+  PeerConfig *self = PEER_CONFIG (object);
 
   switch (property_id)
   {
-    case PROP_BGP_CONFIGURATOR_START_BGP_ARGS_AS_NUMBER:
-      g_value_set_int64 (value, self->asNumber);
-      break;
-
-    case PROP_BGP_CONFIGURATOR_START_BGP_ARGS_ROUTER_ID:
-      g_value_set_string (value, self->routerId);
-      break;
-
-    case PROP_BGP_CONFIGURATOR_START_BGP_ARGS_PORT:
-      g_value_set_int (value, self->port);
+    case PROP_PEER_CONFIG_IP_ADDRESS:
+      g_value_set_string (value, self->ipAddress);
       break;
 
-    case PROP_BGP_CONFIGURATOR_START_BGP_ARGS_HOLD_TIME:
-      g_value_set_int (value, self->holdTime);
+    case PROP_PEER_CONFIG_AS_NUMBER:
+      g_value_set_int64 (value, self->asNumber);
       break;
 
-    case PROP_BGP_CONFIGURATOR_START_BGP_ARGS_KEEP_ALIVE_TIME:
-      g_value_set_int (value, self->keepAliveTime);
+    case PROP_PEER_CONFIG_EBGP_MULTIHOP:
+      g_value_set_int (value, self->ebgpMultihop);
       break;
 
-    case PROP_BGP_CONFIGURATOR_START_BGP_ARGS_STALEPATH_TIME:
-      g_value_set_int (value, self->stalepathTime);
+    case PROP_PEER_CONFIG_UPDATE_SOURCE:
+      g_value_set_string (value, self->updateSource);
       break;
 
-    case PROP_BGP_CONFIGURATOR_START_BGP_ARGS_ANNOUNCE_FBIT:
-      g_value_set_boolean (value, self->announceFbit);
+    case PROP_PEER_CONFIG_VPNV4:
+      g_value_set_boolean (value, self->vpnv4);
       break;
 
     default:
@@ -1310,56 +1302,66 @@ bgp_configurator_start_bgp_args_get_property (GObject *object,
 }
 
 static void 
-bgp_configurator_start_bgp_args_instance_init (BgpConfiguratorStartBgpArgs * object)
+peer_config_instance_init (PeerConfig * object)
 {
   /* satisfy -Wall */
   THRIFT_UNUSED_VAR (object);
+  object->ipAddress = NULL;
+  object->__isset_ipAddress = FALSE;
   object->asNumber = 0;
   object->__isset_asNumber = FALSE;
-  object->routerId = NULL;
-  object->__isset_routerId = FALSE;
-  object->port = 0;
-  object->__isset_port = FALSE;
-  object->holdTime = 0;
-  object->__isset_holdTime = FALSE;
-  object->keepAliveTime = 0;
-  object->__isset_keepAliveTime = FALSE;
-  object->stalepathTime = 0;
-  object->__isset_stalepathTime = FALSE;
-  object->announceFbit = 0;
-  object->__isset_announceFbit = FALSE;
+  object->ebgpMultihop = 0;
+  object->__isset_ebgpMultihop = FALSE;
+  object->updateSource = NULL;
+  object->__isset_updateSource = FALSE;
+  object->vpnv4 = 0;
+  object->__isset_vpnv4 = FALSE;
 }
 
 static void 
-bgp_configurator_start_bgp_args_finalize (GObject *object)
+peer_config_finalize (GObject *object)
 {
-  BgpConfiguratorStartBgpArgs *tobject = BGP_CONFIGURATOR_START_BGP_ARGS (object);
+  PeerConfig *tobject = PEER_CONFIG (object);
 
   /* satisfy -Wall in case we don't use tobject */
   THRIFT_UNUSED_VAR (tobject);
-  if (tobject->routerId != NULL)
+  if (tobject->ipAddress != NULL)
   {
-    g_free(tobject->routerId);
-    tobject->routerId = NULL;
+    g_free(tobject->ipAddress);
+    tobject->ipAddress = NULL;
+  }
+  if (tobject->updateSource != NULL)
+  {
+    g_free(tobject->updateSource);
+    tobject->updateSource = NULL;
   }
 }
 
 static void
-bgp_configurator_start_bgp_args_class_init (BgpConfiguratorStartBgpArgsClass * cls)
+peer_config_class_init (PeerConfigClass * cls)
 {
   GObjectClass *gobject_class = G_OBJECT_CLASS (cls);
   ThriftStructClass *struct_class = THRIFT_STRUCT_CLASS (cls);
 
-  struct_class->read = bgp_configurator_start_bgp_args_read;
-  struct_class->write = bgp_configurator_start_bgp_args_write;
+  struct_class->read = peer_config_read;
+  struct_class->write = peer_config_write;
 
-  gobject_class->finalize = bgp_configurator_start_bgp_args_finalize;
-  gobject_class->get_property = bgp_configurator_start_bgp_args_get_property;
-  gobject_class->set_property = bgp_configurator_start_bgp_args_set_property;
+  gobject_class->finalize = peer_config_finalize;
+  gobject_class->get_property = peer_config_get_property;
+  gobject_class->set_property = peer_config_set_property;
 
   g_object_class_install_property
     (gobject_class,
-     PROP_BGP_CONFIGURATOR_START_BGP_ARGS_AS_NUMBER,
+     PROP_PEER_CONFIG_IP_ADDRESS,
+     g_param_spec_string ("ipAddress",
+                          NULL,
+                          NULL,
+                          NULL,
+                          G_PARAM_READWRITE));
+
+  g_object_class_install_property
+    (gobject_class,
+     PROP_PEER_CONFIG_AS_NUMBER,
      g_param_spec_int64 ("asNumber",
                          NULL,
                          NULL,
@@ -1370,8 +1372,3556 @@ bgp_configurator_start_bgp_args_class_init (BgpConfiguratorStartBgpArgsClass * c
 
   g_object_class_install_property
     (gobject_class,
-     PROP_BGP_CONFIGURATOR_START_BGP_ARGS_ROUTER_ID,
-     g_param_spec_string ("routerId",
+     PROP_PEER_CONFIG_EBGP_MULTIHOP,
+     g_param_spec_int ("ebgpMultihop",
+                       NULL,
+                       NULL,
+                       G_MININT32,
+                       G_MAXINT32,
+                       0,
+                       G_PARAM_READWRITE));
+
+  g_object_class_install_property
+    (gobject_class,
+     PROP_PEER_CONFIG_UPDATE_SOURCE,
+     g_param_spec_string ("updateSource",
+                          NULL,
+                          NULL,
+                          NULL,
+                          G_PARAM_READWRITE));
+
+  g_object_class_install_property
+    (gobject_class,
+     PROP_PEER_CONFIG_VPNV4,
+     g_param_spec_boolean ("vpnv4",
+                           NULL,
+                           NULL,
+                           FALSE,
+                           G_PARAM_READWRITE));
+}
+
+GType
+peer_config_get_type (void)
+{
+  static GType type = 0;
+
+  if (type == 0) 
+  {
+    static const GTypeInfo type_info = 
+    {
+      sizeof (PeerConfigClass),
+      NULL, /* base_init */
+      NULL, /* base_finalize */
+      (GClassInitFunc) peer_config_class_init,
+      NULL, /* class_finalize */
+      NULL, /* class_data */
+      sizeof (PeerConfig),
+      0, /* n_preallocs */
+      (GInstanceInitFunc) peer_config_instance_init,
+      NULL, /* value_table */
+    };
+
+    type = g_type_register_static (THRIFT_TYPE_STRUCT, 
+                                   "PeerConfigType",
+                                   &type_info, 0);
+  }
+
+  return type;
+}
+
+enum _VrfConfigProperties
+{
+  PROP_VRF_CONFIG_0,
+  PROP_VRF_CONFIG_RD,
+  PROP_VRF_CONFIG_IRTS,
+  PROP_VRF_CONFIG_ERTS,
+  PROP_VRF_CONFIG_MAX_PATH
+};
+
+/* reads a vrf_config object */
+static gint32
+vrf_config_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+{
+  gint32 ret;
+  gint32 xfer = 0;
+  gchar *name = NULL;
+  ThriftType ftype;
+  gint16 fid;
+  guint32 len = 0;
+  gpointer data = NULL;
+  VrfConfig * this_object = VRF_CONFIG(object);
+
+  /* satisfy -Wall in case these aren't used */
+  THRIFT_UNUSED_VAR (len);
+  THRIFT_UNUSED_VAR (data);
+  THRIFT_UNUSED_VAR (this_object);
+
+  /* read the struct begin marker */
+  if ((ret = thrift_protocol_read_struct_begin (protocol, &name, error)) < 0)
+  {
+    if (name) g_free (name);
+    return -1;
+  }
+  xfer += ret;
+  if (name) g_free (name);
+  name = NULL;
+
+  /* read the struct fields */
+  while (1)
+  {
+    /* read the beginning of a field */
+    if ((ret = thrift_protocol_read_field_begin (protocol, &name, &ftype, &fid, error)) < 0)
+    {
+      if (name) g_free (name);
+      return -1;
+    }
+    xfer += ret;
+    if (name) g_free (name);
+    name = NULL;
+
+    /* break if we get a STOP field */
+    if (ftype == T_STOP)
+    {
+      break;
+    }
+
+    switch (fid)
+    {
+      case 1:
+        if (ftype == T_STRING)
+        {
+          if (this_object->rd != NULL)
+          {
+            g_free(this_object->rd);
+            this_object->rd = NULL;
+          }
+
+          if ((ret = thrift_protocol_read_string (protocol, &this_object->rd, error)) < 0)
+            return -1;
+          xfer += ret;
+          this_object->__isset_rd = TRUE;
+        } else {
+          if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
+            return -1;
+          xfer += ret;
+        }
+        break;
+      case 2:
+        if (ftype == T_LIST)
+        {
+          {
+            guint32 size;
+            guint32 i;
+            ThriftType element_type;
+
+            if ((ret = thrift_protocol_read_list_begin (protocol, &element_type,&size, error)) < 0)
+              return -1;
+            xfer += ret;
+
+            /* iterate through list elements */
+            for (i = 0; i < size; i++)
+            {
+              gchar * _elem40 = NULL;
+              if (_elem40 != NULL)
+              {
+                g_free(_elem40);
+                _elem40 = NULL;
+              }
+
+              if ((ret = thrift_protocol_read_string (protocol, &_elem40, error)) < 0)
+                return -1;
+              xfer += ret;
+              g_ptr_array_add (this_object->irts, _elem40);
+            }
+            if ((ret = thrift_protocol_read_list_end (protocol, error)) < 0)
+              return -1;
+            xfer += ret;
+          }
+          this_object->__isset_irts = TRUE;
+        } else {
+          if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
+            return -1;
+          xfer += ret;
+        }
+        break;
+      case 3:
+        if (ftype == T_LIST)
+        {
+          {
+            guint32 size;
+            guint32 i;
+            ThriftType element_type;
+
+            if ((ret = thrift_protocol_read_list_begin (protocol, &element_type,&size, error)) < 0)
+              return -1;
+            xfer += ret;
+
+            /* iterate through list elements */
+            for (i = 0; i < size; i++)
+            {
+              gchar * _elem41 = NULL;
+              if (_elem41 != NULL)
+              {
+                g_free(_elem41);
+                _elem41 = NULL;
+              }
+
+              if ((ret = thrift_protocol_read_string (protocol, &_elem41, error)) < 0)
+                return -1;
+              xfer += ret;
+              g_ptr_array_add (this_object->erts, _elem41);
+            }
+            if ((ret = thrift_protocol_read_list_end (protocol, error)) < 0)
+              return -1;
+            xfer += ret;
+          }
+          this_object->__isset_erts = TRUE;
+        } else {
+          if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
+            return -1;
+          xfer += ret;
+        }
+        break;
+      case 4:
+        if (ftype == T_I32)
+        {
+          if ((ret = thrift_protocol_read_i32 (protocol, &this_object->maxPath, error)) < 0)
+            return -1;
+          xfer += ret;
+          this_object->__isset_maxPath = TRUE;
+        } else {
+          if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
+            return -1;
+          xfer += ret;
+        }
+        break;
+      default:
+        if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
+          return -1;
+        xfer += ret;
+        break;
+    }
+    if ((ret = thrift_protocol_read_field_end (protocol, error)) < 0)
+      return -1;
+    xfer += ret;
+  }
+
+  if ((ret = thrift_protocol_read_struct_end (protocol, error)) < 0)
+    return -1;
+  xfer += ret;
+
+  return xfer;
+}
+
+static gint32
+vrf_config_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+{
+  gint32 ret;
+  gint32 xfer = 0;
+
+  VrfConfig * this_object = VRF_CONFIG(object);
+  THRIFT_UNUSED_VAR (this_object);
+  if ((ret = thrift_protocol_write_struct_begin (protocol, "VrfConfig", error)) < 0)
+    return -1;
+  xfer += ret;
+  if ((ret = thrift_protocol_write_field_begin (protocol, "rd", T_STRING, 1, error)) < 0)
+    return -1;
+  xfer += ret;
+  if ((ret = thrift_protocol_write_string (protocol, this_object->rd, error)) < 0)
+    return -1;
+  xfer += ret;
+
+  if ((ret = thrift_protocol_write_field_end (protocol, error)) < 0)
+    return -1;
+  xfer += ret;
+  if ((ret = thrift_protocol_write_field_begin (protocol, "irts", T_LIST, 2, error)) < 0)
+    return -1;
+  xfer += ret;
+  {
+    guint i50;
+
+    if ((ret = thrift_protocol_write_list_begin (protocol, T_STRING, (gint32) (this_object->irts ? this_object->irts->len : 0), error)) < 0)
+      return -1;
+    xfer += ret;
+    for (i50 = 0; i50 < (this_object->irts ? this_object->irts->len : 0); i50++)
+    {
+      if ((ret = thrift_protocol_write_string (protocol, ((gchar*)g_ptr_array_index ((GPtrArray *) this_object->irts, i50)), error)) < 0)
+        return -1;
+      xfer += ret;
+
+    }
+    if ((ret = thrift_protocol_write_list_end (protocol, error)) < 0)
+      return -1;
+    xfer += ret;
+  }
+  if ((ret = thrift_protocol_write_field_end (protocol, error)) < 0)
+    return -1;
+  xfer += ret;
+  if ((ret = thrift_protocol_write_field_begin (protocol, "erts", T_LIST, 3, error)) < 0)
+    return -1;
+  xfer += ret;
+  {
+    guint i51;
+
+    if ((ret = thrift_protocol_write_list_begin (protocol, T_STRING, (gint32) (this_object->erts ? this_object->erts->len : 0), error)) < 0)
+      return -1;
+    xfer += ret;
+    for (i51 = 0; i51 < (this_object->erts ? this_object->erts->len : 0); i51++)
+    {
+      if ((ret = thrift_protocol_write_string (protocol, ((gchar*)g_ptr_array_index ((GPtrArray *) this_object->erts, i51)), error)) < 0)
+        return -1;
+      xfer += ret;
+
+    }
+    if ((ret = thrift_protocol_write_list_end (protocol, error)) < 0)
+      return -1;
+    xfer += ret;
+  }
+  if ((ret = thrift_protocol_write_field_end (protocol, error)) < 0)
+    return -1;
+  xfer += ret;
+  if (this_object->__isset_maxPath == TRUE) {
+    if ((ret = thrift_protocol_write_field_begin (protocol, "maxPath", T_I32, 4, error)) < 0)
+      return -1;
+    xfer += ret;
+    if ((ret = thrift_protocol_write_i32 (protocol, this_object->maxPath, error)) < 0)
+      return -1;
+    xfer += ret;
+
+    if ((ret = thrift_protocol_write_field_end (protocol, error)) < 0)
+      return -1;
+    xfer += ret;
+  }
+  if ((ret = thrift_protocol_write_field_stop (protocol, error)) < 0)
+    return -1;
+  xfer += ret;
+  if ((ret = thrift_protocol_write_struct_end (protocol, error)) < 0)
+    return -1;
+  xfer += ret;
+
+  return xfer;
+}
+
+static void
+vrf_config_set_property (GObject *object,
+                         guint property_id,
+                         const GValue *value,
+                         GParamSpec *pspec)
+{
+  VrfConfig *self = VRF_CONFIG (object);
+
+  switch (property_id)
+  {
+    case PROP_VRF_CONFIG_RD:
+      if (self->rd != NULL)
+        g_free (self->rd);
+      self->rd = g_value_dup_string (value);
+      self->__isset_rd = TRUE;
+      break;
+
+    case PROP_VRF_CONFIG_IRTS:
+      if (self->irts != NULL)
+        g_ptr_array_unref (self->irts);
+      self->irts = g_value_dup_boxed (value);
+      self->__isset_irts = TRUE;
+      break;
+
+    case PROP_VRF_CONFIG_ERTS:
+      if (self->erts != NULL)
+        g_ptr_array_unref (self->erts);
+      self->erts = g_value_dup_boxed (value);
+      self->__isset_erts = TRUE;
+      break;
+
+    case PROP_VRF_CONFIG_MAX_PATH:
+      self->maxPath = g_value_get_int (value);
+      self->__isset_maxPath = TRUE;
+      break;
+
+    default:
+      G_OBJECT_WARN_INVALID_PROPERTY_ID (object, property_id, pspec);
+      break;
+  }
+}
+
+static void
+vrf_config_get_property (GObject *object,
+                         guint property_id,
+                         GValue *value,
+                         GParamSpec *pspec)
+{
+  VrfConfig *self = VRF_CONFIG (object);
+
+  switch (property_id)
+  {
+    case PROP_VRF_CONFIG_RD:
+      g_value_set_string (value, self->rd);
+      break;
+
+    case PROP_VRF_CONFIG_IRTS:
+      g_value_set_boxed (value, self->irts);
+      break;
+
+    case PROP_VRF_CONFIG_ERTS:
+      g_value_set_boxed (value, self->erts);
+      break;
+
+    case PROP_VRF_CONFIG_MAX_PATH:
+      g_value_set_int (value, self->maxPath);
+      break;
+
+    default:
+      G_OBJECT_WARN_INVALID_PROPERTY_ID (object, property_id, pspec);
+      break;
+  }
+}
+
+static void 
+vrf_config_instance_init (VrfConfig * object)
+{
+  /* satisfy -Wall */
+  THRIFT_UNUSED_VAR (object);
+  object->rd = NULL;
+  object->__isset_rd = FALSE;
+  object->irts = g_ptr_array_new_with_free_func (g_free);
+  object->__isset_irts = FALSE;
+  object->erts = g_ptr_array_new_with_free_func (g_free);
+  object->__isset_erts = FALSE;
+  object->maxPath = 0;
+  object->__isset_maxPath = FALSE;
+}
+
+static void 
+vrf_config_finalize (GObject *object)
+{
+  VrfConfig *tobject = VRF_CONFIG (object);
+
+  /* satisfy -Wall in case we don't use tobject */
+  THRIFT_UNUSED_VAR (tobject);
+  if (tobject->rd != NULL)
+  {
+    g_free(tobject->rd);
+    tobject->rd = NULL;
+  }
+  if (tobject->irts != NULL)
+  {
+    g_ptr_array_unref (tobject->irts);
+    tobject->irts = NULL;
+  }
+  if (tobject->erts != NULL)
+  {
+    g_ptr_array_unref (tobject->erts);
+    tobject->erts = NULL;
+  }
+}
+
+static void
+vrf_config_class_init (VrfConfigClass * cls)
+{
+  GObjectClass *gobject_class = G_OBJECT_CLASS (cls);
+  ThriftStructClass *struct_class = THRIFT_STRUCT_CLASS (cls);
+
+  struct_class->read = vrf_config_read;
+  struct_class->write = vrf_config_write;
+
+  gobject_class->finalize = vrf_config_finalize;
+  gobject_class->get_property = vrf_config_get_property;
+  gobject_class->set_property = vrf_config_set_property;
+
+  g_object_class_install_property
+    (gobject_class,
+     PROP_VRF_CONFIG_RD,
+     g_param_spec_string ("rd",
+                          NULL,
+                          NULL,
+                          NULL,
+                          G_PARAM_READWRITE));
+
+  g_object_class_install_property
+    (gobject_class,
+     PROP_VRF_CONFIG_IRTS,
+     g_param_spec_boxed ("irts",
+                         NULL,
+                         NULL,
+                         G_TYPE_PTR_ARRAY,
+                         G_PARAM_READWRITE));
+
+  g_object_class_install_property
+    (gobject_class,
+     PROP_VRF_CONFIG_ERTS,
+     g_param_spec_boxed ("erts",
+                         NULL,
+                         NULL,
+                         G_TYPE_PTR_ARRAY,
+                         G_PARAM_READWRITE));
+
+  g_object_class_install_property
+    (gobject_class,
+     PROP_VRF_CONFIG_MAX_PATH,
+     g_param_spec_int ("maxPath",
+                       NULL,
+                       NULL,
+                       G_MININT32,
+                       G_MAXINT32,
+                       0,
+                       G_PARAM_READWRITE));
+}
+
+GType
+vrf_config_get_type (void)
+{
+  static GType type = 0;
+
+  if (type == 0) 
+  {
+    static const GTypeInfo type_info = 
+    {
+      sizeof (VrfConfigClass),
+      NULL, /* base_init */
+      NULL, /* base_finalize */
+      (GClassInitFunc) vrf_config_class_init,
+      NULL, /* class_finalize */
+      NULL, /* class_data */
+      sizeof (VrfConfig),
+      0, /* n_preallocs */
+      (GInstanceInitFunc) vrf_config_instance_init,
+      NULL, /* value_table */
+    };
+
+    type = g_type_register_static (THRIFT_TYPE_STRUCT, 
+                                   "VrfConfigType",
+                                   &type_info, 0);
+  }
+
+  return type;
+}
+
+enum _ConfigSnapshotProperties
+{
+  PROP_CONFIG_SNAPSHOT_0,
+  PROP_CONFIG_SNAPSHOT_PEERS,
+  PROP_CONFIG_SNAPSHOT_VRFS,
+  PROP_CONFIG_SNAPSHOT_ROUTES
+};
+
+/* reads a config_snapshot object */
+static gint32
+config_snapshot_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+{
+  gint32 ret;
+  gint32 xfer = 0;
+  gchar *name = NULL;
+  ThriftType ftype;
+  gint16 fid;
+  guint32 len = 0;
+  gpointer data = NULL;
+  ConfigSnapshot * this_object = CONFIG_SNAPSHOT(object);
+
+  /* satisfy -Wall in case these aren't used */
+  THRIFT_UNUSED_VAR (len);
+  THRIFT_UNUSED_VAR (data);
+  THRIFT_UNUSED_VAR (this_object);
+
+  /* read the struct begin marker */
+  if ((ret = thrift_protocol_read_struct_begin (protocol, &name, error)) < 0)
+  {
+    if (name) g_free (name);
+    return -1;
+  }
+  xfer += ret;
+  if (name) g_free (name);
+  name = NULL;
+
+  /* read the struct fields */
+  while (1)
+  {
+    /* read the beginning of a field */
+    if ((ret = thrift_protocol_read_field_begin (protocol, &name, &ftype, &fid, error)) < 0)
+    {
+      if (name) g_free (name);
+      return -1;
+    }
+    xfer += ret;
+    if (name) g_free (name);
+    name = NULL;
+
+    /* break if we get a STOP field */
+    if (ftype == T_STOP)
+    {
+      break;
+    }
+
+    switch (fid)
+    {
+      case 1:
+        if (ftype == T_LIST)
+        {
+          {
+            guint32 size;
+            guint32 i;
+            ThriftType element_type;
+
+            if ((ret = thrift_protocol_read_list_begin (protocol, &element_type,&size, error)) < 0)
+              return -1;
+            xfer += ret;
+
+            /* iterate through list elements */
+            for (i = 0; i < size; i++)
+            {
+              PeerConfig * _elem42 = NULL;
+              if ( _elem42 != NULL)
+              {
+                g_object_unref (_elem42);
+              }
+              _elem42 = g_object_new (TYPE_PEER_CONFIG, NULL);
+              if ((ret = thrift_struct_read (THRIFT_STRUCT (_elem42), protocol, error)) < 0)
+              {
+                g_object_unref (_elem42);
+                return -1;
+              }
+              xfer += ret;
+              g_ptr_array_add (this_object->peers, _elem42);
+            }
+            if ((ret = thrift_protocol_read_list_end (protocol, error)) < 0)
+              return -1;
+            xfer += ret;
+          }
+          this_object->__isset_peers = TRUE;
+        } else {
+          if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
+            return -1;
+          xfer += ret;
+        }
+        break;
+      case 2:
+        if (ftype == T_LIST)
+        {
+          {
+            guint32 size;
+            guint32 i;
+            ThriftType element_type;
+
+            if ((ret = thrift_protocol_read_list_begin (protocol, &element_type,&size, error)) < 0)
+              return -1;
+            xfer += ret;
+
+            /* iterate through list elements */
+            for (i = 0; i < size; i++)
+            {
+              VrfConfig * _elem43 = NULL;
+              if ( _elem43 != NULL)
+              {
+                g_object_unref (_elem43);
+              }
+              _elem43 = g_object_new (TYPE_VRF_CONFIG, NULL);
+              if ((ret = thrift_struct_read (THRIFT_STRUCT (_elem43), protocol, error)) < 0)
+              {
+                g_object_unref (_elem43);
+                return -1;
+              }
+              xfer += ret;
+              g_ptr_array_add (this_object->vrfs, _elem43);
+            }
+            if ((ret = thrift_protocol_read_list_end (protocol, error)) < 0)
+              return -1;
+            xfer += ret;
+          }
+          this_object->__isset_vrfs = TRUE;
+        } else {
+          if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
+            return -1;
+          xfer += ret;
+        }
+        break;
+      case 3:
+        if (ftype == T_LIST)
+        {
+          {
+            guint32 size;
+            guint32 i;
+            ThriftType element_type;
+
+            if ((ret = thrift_protocol_read_list_begin (protocol, &element_type,&size, error)) < 0)
+              return -1;
+            xfer += ret;
+
+            /* iterate through list elements */
+            for (i = 0; i < size; i++)
+            {
+              Update * _elem44 = NULL;
+              if ( _elem44 != NULL)
+              {
+                g_object_unref (_elem44);
+              }
+              _elem44 = g_object_new (TYPE_UPDATE, NULL);
+              if ((ret = thrift_struct_read (THRIFT_STRUCT (_elem44), protocol, error)) < 0)
+              {
+                g_object_unref (_elem44);
+                return -1;
+              }
+              xfer += ret;
+              g_ptr_array_add (this_object->routes, _elem44);
+            }
+            if ((ret = thrift_protocol_read_list_end (protocol, error)) < 0)
+              return -1;
+            xfer += ret;
+          }
+          this_object->__isset_routes = TRUE;
+        } else {
+          if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
+            return -1;
+          xfer += ret;
+        }
+        break;
+      default:
+        if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
+          return -1;
+        xfer += ret;
+        break;
+    }
+    if ((ret = thrift_protocol_read_field_end (protocol, error)) < 0)
+      return -1;
+    xfer += ret;
+  }
+
+  if ((ret = thrift_protocol_read_struct_end (protocol, error)) < 0)
+    return -1;
+  xfer += ret;
+
+  return xfer;
+}
+
+static gint32
+config_snapshot_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+{
+  gint32 ret;
+  gint32 xfer = 0;
+
+  ConfigSnapshot * this_object = CONFIG_SNAPSHOT(object);
+  THRIFT_UNUSED_VAR (this_object);
+  if ((ret = thrift_protocol_write_struct_begin (protocol, "ConfigSnapshot", error)) < 0)
+    return -1;
+  xfer += ret;
+  if ((ret = thrift_protocol_write_field_begin (protocol, "peers", T_LIST, 1, error)) < 0)
+    return -1;
+  xfer += ret;
+  {
+    guint i52;
+
+    if ((ret = thrift_protocol_write_list_begin (protocol, T_STRUCT, (gint32) (this_object->peers ? this_object->peers->len : 0), error)) < 0)
+      return -1;
+    xfer += ret;
+    for (i52 = 0; i52 < (this_object->peers ? this_object->peers->len : 0); i52++)
+    {
+      if ((ret = thrift_struct_write (THRIFT_STRUCT ((g_ptr_array_index ((GPtrArray *) this_object->peers, i52))), protocol, error)) < 0)
+        return -1;
+      xfer += ret;
+
+    }
+    if ((ret = thrift_protocol_write_list_end (protocol, error)) < 0)
+      return -1;
+    xfer += ret;
+  }
+  if ((ret = thrift_protocol_write_field_end (protocol, error)) < 0)
+    return -1;
+  xfer += ret;
+  if ((ret = thrift_protocol_write_field_begin (protocol, "vrfs", T_LIST, 2, error)) < 0)
+    return -1;
+  xfer += ret;
+  {
+    guint i53;
+
+    if ((ret = thrift_protocol_write_list_begin (protocol, T_STRUCT, (gint32) (this_object->vrfs ? this_object->vrfs->len : 0), error)) < 0)
+      return -1;
+    xfer += ret;
+    for (i53 = 0; i53 < (this_object->vrfs ? this_object->vrfs->len : 0); i53++)
+    {
+      if ((ret = thrift_struct_write (THRIFT_STRUCT ((g_ptr_array_index ((GPtrArray *) this_object->vrfs, i53))), protocol, error)) < 0)
+        return -1;
+      xfer += ret;
+
+    }
+    if ((ret = thrift_protocol_write_list_end (protocol, error)) < 0)
+      return -1;
+    xfer += ret;
+  }
+  if ((ret = thrift_protocol_write_field_end (protocol, error)) < 0)
+    return -1;
+  xfer += ret;
+  if ((ret = thrift_protocol_write_field_begin (protocol, "routes", T_LIST, 3, error)) < 0)
+    return -1;
+  xfer += ret;
+  {
+    guint i54;
+
+    if ((ret = thrift_protocol_write_list_begin (protocol, T_STRUCT, (gint32) (this_object->routes ? this_object->routes->len : 0), error)) < 0)
+      return -1;
+    xfer += ret;
+    for (i54 = 0; i54 < (this_object->routes ? this_object->routes->len : 0); i54++)
+    {
+      if ((ret = thrift_struct_write (THRIFT_STRUCT ((g_ptr_array_index ((GPtrArray *) this_object->routes, i54))), protocol, error)) < 0)
+        return -1;
+      xfer += ret;
+
+    }
+    if ((ret = thrift_protocol_write_list_end (protocol, error)) < 0)
+      return -1;
+    xfer += ret;
+  }
+  if ((ret = thrift_protocol_write_field_end (protocol, error)) < 0)
+    return -1;
+  xfer += ret;
+  if ((ret = thrift_protocol_write_field_stop (protocol, error)) < 0)
+    return -1;
+  xfer += ret;
+  if ((ret = thrift_protocol_write_struct_end (protocol, error)) < 0)
+    return -1;
+  xfer += ret;
+
+  return xfer;
+}
+
+static void
+config_snapshot_set_property (GObject *object,
+                              guint property_id,
+                              const GValue *value,
+                              GParamSpec *pspec)
+{
+  ConfigSnapshot *self = CONFIG_SNAPSHOT (object);
+
+  switch (property_id)
+  {
+    case PROP_CONFIG_SNAPSHOT_PEERS:
+      if (self->peers != NULL)
+        g_ptr_array_unref (self->peers);
+      self->peers = g_value_dup_boxed (value);
+      self->__isset_peers = TRUE;
+      break;
+
+    case PROP_CONFIG_SNAPSHOT_VRFS:
+      if (self->vrfs != NULL)
+        g_ptr_array_unref (self->vrfs);
+      self->vrfs = g_value_dup_boxed (value);
+      self->__isset_vrfs = TRUE;
+      break;
+
+    case PROP_CONFIG_SNAPSHOT_ROUTES:
+      if (self->routes != NULL)
+        g_ptr_array_unref (self->routes);
+      self->routes = g_value_dup_boxed (value);
+      self->__isset_routes = TRUE;
+      break;
+
+    default:
+      G_OBJECT_WARN_INVALID_PROPERTY_ID (object, property_id, pspec);
+      break;
+  }
+}
+
+static void
+config_snapshot_get_property (GObject *object,
+                              guint property_id,
+                              GValue *value,
+                              GParamSpec *pspec)
+{
+  ConfigSnapshot *self = CONFIG_SNAPSHOT (object);
+
+  switch (property_id)
+  {
+    case PROP_CONFIG_SNAPSHOT_PEERS:
+      g_value_set_boxed (value, self->peers);
+      break;
+
+    case PROP_CONFIG_SNAPSHOT_VRFS:
+      g_value_set_boxed (value, self->vrfs);
+      break;
+
+    case PROP_CONFIG_SNAPSHOT_ROUTES:
+      g_value_set_boxed (value, self->routes);
+      break;
+
+    default:
+      G_OBJECT_WARN_INVALID_PROPERTY_ID (object, property_id, pspec);
+      break;
+  }
+}
+
+static void 
+config_snapshot_instance_init (ConfigSnapshot * object)
+{
+  /* satisfy -Wall */
+  THRIFT_UNUSED_VAR (object);
+  object->peers = g_ptr_array_new_with_free_func (g_object_unref);
+  object->__isset_peers = FALSE;
+  object->vrfs = g_ptr_array_new_with_free_func (g_object_unref);
+  object->__isset_vrfs = FALSE;
+  object->routes = g_ptr_array_new_with_free_func (g_object_unref);
+  object->__isset_routes = FALSE;
+}
+
+static void 
+config_snapshot_finalize (GObject *object)
+{
+  ConfigSnapshot *tobject = CONFIG_SNAPSHOT (object);
+
+  /* satisfy -Wall in case we don't use tobject */
+  THRIFT_UNUSED_VAR (tobject);
+  if (tobject->peers != NULL)
+  {
+    g_ptr_array_unref (tobject->peers);
+    tobject->peers = NULL;
+  }
+  if (tobject->vrfs != NULL)
+  {
+    g_ptr_array_unref (tobject->vrfs);
+    tobject->vrfs = NULL;
+  }
+  if (tobject->routes != NULL)
+  {
+    g_ptr_array_unref (tobject->routes);
+    tobject->routes = NULL;
+  }
+}
+
+static void
+config_snapshot_class_init (ConfigSnapshotClass * cls)
+{
+  GObjectClass *gobject_class = G_OBJECT_CLASS (cls);
+  ThriftStructClass *struct_class = THRIFT_STRUCT_CLASS (cls);
+
+  struct_class->read = config_snapshot_read;
+  struct_class->write = config_snapshot_write;
+
+  gobject_class->finalize = config_snapshot_finalize;
+  gobject_class->get_property = config_snapshot_get_property;
+  gobject_class->set_property = config_snapshot_set_property;
+
+  g_object_class_install_property
+    (gobject_class,
+     PROP_CONFIG_SNAPSHOT_PEERS,
+     g_param_spec_boxed ("peers",
+                         NULL,
+                         NULL,
+                         G_TYPE_PTR_ARRAY,
+                         G_PARAM_READWRITE));
+
+  g_object_class_install_property
+    (gobject_class,
+     PROP_CONFIG_SNAPSHOT_VRFS,
+     g_param_spec_boxed ("vrfs",
+                         NULL,
+                         NULL,
+                         G_TYPE_PTR_ARRAY,
+                         G_PARAM_READWRITE));
+
+  g_object_class_install_property
+    (gobject_class,
+     PROP_CONFIG_SNAPSHOT_ROUTES,
+     g_param_spec_boxed ("routes",
+                         NULL,
+                         NULL,
+                         G_TYPE_PTR_ARRAY,
+                         G_PARAM_READWRITE));
+}
+
+GType
+config_snapshot_get_type (void)
+{
+  static GType type = 0;
+
+  if (type == 0) 
+  {
+    static const GTypeInfo type_info = 
+    {
+      sizeof (ConfigSnapshotClass),
+      NULL, /* base_init */
+      NULL, /* base_finalize */
+      (GClassInitFunc) config_snapshot_class_init,
+      NULL, /* class_finalize */
+      NULL, /* class_data */
+      sizeof (ConfigSnapshot),
+      0, /* n_preallocs */
+      (GInstanceInitFunc) config_snapshot_instance_init,
+      NULL, /* value_table */
+    };
+
+    type = g_type_register_static (THRIFT_TYPE_STRUCT, 
+                                   "ConfigSnapshotType",
+                                   &type_info, 0);
+  }
+
+  return type;
+}
+
+/* constants */
+
+enum _BgpConfiguratorStartBgpArgsProperties
+{
+  PROP_BGP_CONFIGURATOR_START_BGP_ARGS_0,
+  PROP_BGP_CONFIGURATOR_START_BGP_ARGS_AS_NUMBER,
+  PROP_BGP_CONFIGURATOR_START_BGP_ARGS_ROUTER_ID,
+  PROP_BGP_CONFIGURATOR_START_BGP_ARGS_PORT,
+  PROP_BGP_CONFIGURATOR_START_BGP_ARGS_HOLD_TIME,
+  PROP_BGP_CONFIGURATOR_START_BGP_ARGS_KEEP_ALIVE_TIME,
+  PROP_BGP_CONFIGURATOR_START_BGP_ARGS_STALEPATH_TIME,
+  PROP_BGP_CONFIGURATOR_START_BGP_ARGS_ANNOUNCE_FBIT
+};
+
+/* reads a bgp_configurator_start_bgp_args object */
+static gint32
+bgp_configurator_start_bgp_args_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+{
+  gint32 ret;
+  gint32 xfer = 0;
+  gchar *name = NULL;
+  ThriftType ftype;
+  gint16 fid;
+  guint32 len = 0;
+  gpointer data = NULL;
+  BgpConfiguratorStartBgpArgs * this_object = BGP_CONFIGURATOR_START_BGP_ARGS(object);
+
+  /* satisfy -Wall in case these aren't used */
+  THRIFT_UNUSED_VAR (len);
+  THRIFT_UNUSED_VAR (data);
+  THRIFT_UNUSED_VAR (this_object);
+
+  /* read the struct begin marker */
+  if ((ret = thrift_protocol_read_struct_begin (protocol, &name, error)) < 0)
+  {
+    if (name) g_free (name);
+    return -1;
+  }
+  xfer += ret;
+  if (name) g_free (name);
+  name = NULL;
+
+  /* read the struct fields */
+  while (1)
+  {
+    /* read the beginning of a field */
+    if ((ret = thrift_protocol_read_field_begin (protocol, &name, &ftype, &fid, error)) < 0)
+    {
+      if (name) g_free (name);
+      return -1;
+    }
+    xfer += ret;
+    if (name) g_free (name);
+    name = NULL;
+
+    /* break if we get a STOP field */
+    if (ftype == T_STOP)
+    {
+      break;
+    }
+
+    switch (fid)
+    {
+      case 1:
+        if (ftype == T_I64)
+        {
+          if ((ret = thrift_protocol_read_i64 (protocol, &this_object->asNumber, error)) < 0)
+            return -1;
+          xfer += ret;
+          this_object->__isset_asNumber = TRUE;
+        } else {
+          if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
+            return -1;
+          xfer += ret;
+        }
+        break;
+      case 2:
+        if (ftype == T_STRING)
+        {
+          if (this_object->routerId != NULL)
+          {
+            g_free(this_object->routerId);
+            this_object->routerId = NULL;
+          }
+
+          if ((ret = thrift_protocol_read_string (protocol, &this_object->routerId, error)) < 0)
+            return -1;
+          xfer += ret;
+          this_object->__isset_routerId = TRUE;
+        } else {
+          if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
+            return -1;
+          xfer += ret;
+        }
+        break;
+      case 3:
+        if (ftype == T_I32)
+        {
+          if ((ret = thrift_protocol_read_i32 (protocol, &this_object->port, error)) < 0)
+            return -1;
+          xfer += ret;
+          this_object->__isset_port = TRUE;
+        } else {
+          if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
+            return -1;
+          xfer += ret;
+        }
+        break;
+      case 4:
+        if (ftype == T_I32)
+        {
+          if ((ret = thrift_protocol_read_i32 (protocol, &this_object->holdTime, error)) < 0)
+            return -1;
+          xfer += ret;
+          this_object->__isset_holdTime = TRUE;
+        } else {
+          if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
+            return -1;
+          xfer += ret;
+        }
+        break;
+      case 5:
+        if (ftype == T_I32)
+        {
+          if ((ret = thrift_protocol_read_i32 (protocol, &this_object->keepAliveTime, error)) < 0)
+            return -1;
+          xfer += ret;
+          this_object->__isset_keepAliveTime = TRUE;
+        } else {
+          if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
+            return -1;
+          xfer += ret;
+        }
+        break;
+      case 6:
+        if (ftype == T_I32)
+        {
+          if ((ret = thrift_protocol_read_i32 (protocol, &this_object->stalepathTime, error)) < 0)
+            return -1;
+          xfer += ret;
+          this_object->__isset_stalepathTime = TRUE;
+        } else {
+          if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
+            return -1;
+          xfer += ret;
+        }
+        break;
+      case 7:
+        if (ftype == T_BOOL)
+        {
+          if ((ret = thrift_protocol_read_bool (protocol, &this_object->announceFbit, error)) < 0)
+            return -1;
+          xfer += ret;
+          this_object->__isset_announceFbit = TRUE;
+        } else {
+          if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
+            return -1;
+          xfer += ret;
+        }
+        break;
+      default:
+        if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
+          return -1;
+        xfer += ret;
+        break;
+    }
+    if ((ret = thrift_protocol_read_field_end (protocol, error)) < 0)
+      return -1;
+    xfer += ret;
+  }
+
+  if ((ret = thrift_protocol_read_struct_end (protocol, error)) < 0)
+    return -1;
+  xfer += ret;
+
+  return xfer;
+}
+
+static gint32
+bgp_configurator_start_bgp_args_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+{
+  gint32 ret;
+  gint32 xfer = 0;
+
+  BgpConfiguratorStartBgpArgs * this_object = BGP_CONFIGURATOR_START_BGP_ARGS(object);
+  THRIFT_UNUSED_VAR (this_object);
+  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorStartBgpArgs", error)) < 0)
+    return -1;
+  xfer += ret;
+  if ((ret = thrift_protocol_write_field_begin (protocol, "asNumber", T_I64, 1, error)) < 0)
+    return -1;
+  xfer += ret;
+  if ((ret = thrift_protocol_write_i64 (protocol, this_object->asNumber, error)) < 0)
+    return -1;
+  xfer += ret;
+
+  if ((ret = thrift_protocol_write_field_end (protocol, error)) < 0)
+    return -1;
+  xfer += ret;
+  if ((ret = thrift_protocol_write_field_begin (protocol, "routerId", T_STRING, 2, error)) < 0)
+    return -1;
+  xfer += ret;
+  if ((ret = thrift_protocol_write_string (protocol, this_object->routerId, error)) < 0)
+    return -1;
+  xfer += ret;
+
+  if ((ret = thrift_protocol_write_field_end (protocol, error)) < 0)
+    return -1;
+  xfer += ret;
+  if ((ret = thrift_protocol_write_field_begin (protocol, "port", T_I32, 3, error)) < 0)
+    return -1;
+  xfer += ret;
+  if ((ret = thrift_protocol_write_i32 (protocol, this_object->port, error)) < 0)
+    return -1;
+  xfer += ret;
+
+  if ((ret = thrift_protocol_write_field_end (protocol, error)) < 0)
+    return -1;
+  xfer += ret;
+  if ((ret = thrift_protocol_write_field_begin (protocol, "holdTime", T_I32, 4, error)) < 0)
+    return -1;
+  xfer += ret;
+  if ((ret = thrift_protocol_write_i32 (protocol, this_object->holdTime, error)) < 0)
+    return -1;
+  xfer += ret;
+
+  if ((ret = thrift_protocol_write_field_end (protocol, error)) < 0)
+    return -1;
+  xfer += ret;
+  if ((ret = thrift_protocol_write_field_begin (protocol, "keepAliveTime", T_I32, 5, error)) < 0)
+    return -1;
+  xfer += ret;
+  if ((ret = thrift_protocol_write_i32 (protocol, this_object->keepAliveTime, error)) < 0)
+    return -1;
+  xfer += ret;
+
+  if ((ret = thrift_protocol_write_field_end (protocol, error)) < 0)
+    return -1;
+  xfer += ret;
+  if ((ret = thrift_protocol_write_field_begin (protocol, "stalepathTime", T_I32, 6, error)) < 0)
+    return -1;
+  xfer += ret;
+  if ((ret = thrift_protocol_write_i32 (protocol, this_object->stalepathTime, error)) < 0)
+    return -1;
+  xfer += ret;
+
+  if ((ret = thrift_protocol_write_field_end (protocol, error)) < 0)
+    return -1;
+  xfer += ret;
+  if ((ret = thrift_protocol_write_field_begin (protocol, "announceFbit", T_BOOL, 7, error)) < 0)
+    return -1;
+  xfer += ret;
+  if ((ret = thrift_protocol_write_bool (protocol, this_object->announceFbit, error)) < 0)
+    return -1;
+  xfer += ret;
+
+  if ((ret = thrift_protocol_write_field_end (protocol, error)) < 0)
+    return -1;
+  xfer += ret;
+  if ((ret = thrift_protocol_write_field_stop (protocol, error)) < 0)
+    return -1;
+  xfer += ret;
+  if ((ret = thrift_protocol_write_struct_end (protocol, error)) < 0)
+    return -1;
+  xfer += ret;
+
+  return xfer;
+}
+
+static void
+bgp_configurator_start_bgp_args_set_property (GObject *object,
+                                              guint property_id,
+                                              const GValue *value,
+                                              GParamSpec *pspec)
+{
+  BgpConfiguratorStartBgpArgs *self = BGP_CONFIGURATOR_START_BGP_ARGS (object);
+
+  switch (property_id)
+  {
+    case PROP_BGP_CONFIGURATOR_START_BGP_ARGS_AS_NUMBER:
+      self->asNumber = g_value_get_int64 (value);
+      self->__isset_asNumber = TRUE;
+      break;
+
+    case PROP_BGP_CONFIGURATOR_START_BGP_ARGS_ROUTER_ID:
+      if (self->routerId != NULL)
+        g_free (self->routerId);
+      self->routerId = g_value_dup_string (value);
+      self->__isset_routerId = TRUE;
+      break;
+
+    case PROP_BGP_CONFIGURATOR_START_BGP_ARGS_PORT:
+      self->port = g_value_get_int (value);
+      self->__isset_port = TRUE;
+      break;
+
+    case PROP_BGP_CONFIGURATOR_START_BGP_ARGS_HOLD_TIME:
+      self->holdTime = g_value_get_int (value);
+      self->__isset_holdTime = TRUE;
+      break;
+
+    case PROP_BGP_CONFIGURATOR_START_BGP_ARGS_KEEP_ALIVE_TIME:
+      self->keepAliveTime = g_value_get_int (value);
+      self->__isset_keepAliveTime = TRUE;
+      break;
+
+    case PROP_BGP_CONFIGURATOR_START_BGP_ARGS_STALEPATH_TIME:
+      self->stalepathTime = g_value_get_int (value);
+      self->__isset_stalepathTime = TRUE;
+      break;
+
+    case PROP_BGP_CONFIGURATOR_START_BGP_ARGS_ANNOUNCE_FBIT:
+      self->announceFbit = g_value_get_boolean (value);
+      self->__isset_announceFbit = TRUE;
+      break;
+
+    default:
+      G_OBJECT_WARN_INVALID_PROPERTY_ID (object, property_id, pspec);
+      break;
+  }
+}
+
+static void
+bgp_configurator_start_bgp_args_get_property (GObject *object,
+                                              guint property_id,
+                                              GValue *value,
+                                              GParamSpec *pspec)
+{
+  BgpConfiguratorStartBgpArgs *self = BGP_CONFIGURATOR_START_BGP_ARGS (object);
+
+  switch (property_id)
+  {
+    case PROP_BGP_CONFIGURATOR_START_BGP_ARGS_AS_NUMBER:
+      g_value_set_int64 (value, self->asNumber);
+      break;
+
+    case PROP_BGP_CONFIGURATOR_START_BGP_ARGS_ROUTER_ID:
+      g_value_set_string (value, self->routerId);
+      break;
+
+    case PROP_BGP_CONFIGURATOR_START_BGP_ARGS_PORT:
+      g_value_set_int (value, self->port);
+      break;
+
+    case PROP_BGP_CONFIGURATOR_START_BGP_ARGS_HOLD_TIME:
+      g_value_set_int (value, self->holdTime);
+      break;
+
+    case PROP_BGP_CONFIGURATOR_START_BGP_ARGS_KEEP_ALIVE_TIME:
+      g_value_set_int (value, self->keepAliveTime);
+      break;
+
+    case PROP_BGP_CONFIGURATOR_START_BGP_ARGS_STALEPATH_TIME:
+      g_value_set_int (value, self->stalepathTime);
+      break;
+
+    case PROP_BGP_CONFIGURATOR_START_BGP_ARGS_ANNOUNCE_FBIT:
+      g_value_set_boolean (value, self->announceFbit);
+      break;
+
+    default:
+      G_OBJECT_WARN_INVALID_PROPERTY_ID (object, property_id, pspec);
+      break;
+  }
+}
+
+static void 
+bgp_configurator_start_bgp_args_instance_init (BgpConfiguratorStartBgpArgs * object)
+{
+  /* satisfy -Wall */
+  THRIFT_UNUSED_VAR (object);
+  object->asNumber = 0;
+  object->__isset_asNumber = FALSE;
+  object->routerId = NULL;
+  object->__isset_routerId = FALSE;
+  object->port = 0;
+  object->__isset_port = FALSE;
+  object->holdTime = 0;
+  object->__isset_holdTime = FALSE;
+  object->keepAliveTime = 0;
+  object->__isset_keepAliveTime = FALSE;
+  object->stalepathTime = 0;
+  object->__isset_stalepathTime = FALSE;
+  object->announceFbit = 0;
+  object->__isset_announceFbit = FALSE;
+}
+
+static void 
+bgp_configurator_start_bgp_args_finalize (GObject *object)
+{
+  BgpConfiguratorStartBgpArgs *tobject = BGP_CONFIGURATOR_START_BGP_ARGS (object);
+
+  /* satisfy -Wall in case we don't use tobject */
+  THRIFT_UNUSED_VAR (tobject);
+  if (tobject->routerId != NULL)
+  {
+    g_free(tobject->routerId);
+    tobject->routerId = NULL;
+  }
+}
+
+static void
+bgp_configurator_start_bgp_args_class_init (BgpConfiguratorStartBgpArgsClass * cls)
+{
+  GObjectClass *gobject_class = G_OBJECT_CLASS (cls);
+  ThriftStructClass *struct_class = THRIFT_STRUCT_CLASS (cls);
+
+  struct_class->read = bgp_configurator_start_bgp_args_read;
+  struct_class->write = bgp_configurator_start_bgp_args_write;
+
+  gobject_class->finalize = bgp_configurator_start_bgp_args_finalize;
+  gobject_class->get_property = bgp_configurator_start_bgp_args_get_property;
+  gobject_class->set_property = bgp_configurator_start_bgp_args_set_property;
+
+  g_object_class_install_property
+    (gobject_class,
+     PROP_BGP_CONFIGURATOR_START_BGP_ARGS_AS_NUMBER,
+     g_param_spec_int64 ("asNumber",
+                         NULL,
+                         NULL,
+                         G_MININT64,
+                         G_MAXINT64,
+                         0,
+                         G_PARAM_READWRITE));
+
+  g_object_class_install_property
+    (gobject_class,
+     PROP_BGP_CONFIGURATOR_START_BGP_ARGS_ROUTER_ID,
+     g_param_spec_string ("routerId",
+                          NULL,
+                          NULL,
+                          NULL,
+                          G_PARAM_READWRITE));
+
+  g_object_class_install_property
+    (gobject_class,
+     PROP_BGP_CONFIGURATOR_START_BGP_ARGS_PORT,
+     g_param_spec_int ("port",
+                       NULL,
+                       NULL,
+                       G_MININT32,
+                       G_MAXINT32,
+                       0,
+                       G_PARAM_READWRITE));
+
+  g_object_class_install_property
+    (gobject_class,
+     PROP_BGP_CONFIGURATOR_START_BGP_ARGS_HOLD_TIME,
+     g_param_spec_int ("holdTime",
+                       NULL,
+                       NULL,
+                       G_MININT32,
+                       G_MAXINT32,
+                       0,
+                       G_PARAM_READWRITE));
+
+  g_object_class_install_property
+    (gobject_class,
+     PROP_BGP_CONFIGURATOR_START_BGP_ARGS_KEEP_ALIVE_TIME,
+     g_param_spec_int ("keepAliveTime",
+                       NULL,
+                       NULL,
+                       G_MININT32,
+                       G_MAXINT32,
+                       0,
+                       G_PARAM_READWRITE));
+
+  g_object_class_install_property
+    (gobject_class,
+     PROP_BGP_CONFIGURATOR_START_BGP_ARGS_STALEPATH_TIME,
+     g_param_spec_int ("stalepathTime",
+                       NULL,
+                       NULL,
+                       G_MININT32,
+                       G_MAXINT32,
+                       0,
+                       G_PARAM_READWRITE));
+
+  g_object_class_install_property
+    (gobject_class,
+     PROP_BGP_CONFIGURATOR_START_BGP_ARGS_ANNOUNCE_FBIT,
+     g_param_spec_boolean ("announceFbit",
+                           NULL,
+                           NULL,
+                           FALSE,
+                           G_PARAM_READWRITE));
+}
+
+GType
+bgp_configurator_start_bgp_args_get_type (void)
+{
+  static GType type = 0;
+
+  if (type == 0) 
+  {
+    static const GTypeInfo type_info = 
+    {
+      sizeof (BgpConfiguratorStartBgpArgsClass),
+      NULL, /* base_init */
+      NULL, /* base_finalize */
+      (GClassInitFunc) bgp_configurator_start_bgp_args_class_init,
+      NULL, /* class_finalize */
+      NULL, /* class_data */
+      sizeof (BgpConfiguratorStartBgpArgs),
+      0, /* n_preallocs */
+      (GInstanceInitFunc) bgp_configurator_start_bgp_args_instance_init,
+      NULL, /* value_table */
+    };
+
+    type = g_type_register_static (THRIFT_TYPE_STRUCT, 
+                                   "BgpConfiguratorStartBgpArgsType",
+                                   &type_info, 0);
+  }
+
+  return type;
+}
+
+enum _BgpConfiguratorStartBgpResultProperties
+{
+  PROP_BGP_CONFIGURATOR_START_BGP_RESULT_0,
+  PROP_BGP_CONFIGURATOR_START_BGP_RESULT_SUCCESS
+};
+
+/* reads a bgp_configurator_start_bgp_result object */
+static gint32
+bgp_configurator_start_bgp_result_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+{
+  gint32 ret;
+  gint32 xfer = 0;
+  gchar *name = NULL;
+  ThriftType ftype;
+  gint16 fid;
+  guint32 len = 0;
+  gpointer data = NULL;
+  BgpConfiguratorStartBgpResult * this_object = BGP_CONFIGURATOR_START_BGP_RESULT(object);
+
+  /* satisfy -Wall in case these aren't used */
+  THRIFT_UNUSED_VAR (len);
+  THRIFT_UNUSED_VAR (data);
+  THRIFT_UNUSED_VAR (this_object);
+
+  /* read the struct begin marker */
+  if ((ret = thrift_protocol_read_struct_begin (protocol, &name, error)) < 0)
+  {
+    if (name) g_free (name);
+    return -1;
+  }
+  xfer += ret;
+  if (name) g_free (name);
+  name = NULL;
+
+  /* read the struct fields */
+  while (1)
+  {
+    /* read the beginning of a field */
+    if ((ret = thrift_protocol_read_field_begin (protocol, &name, &ftype, &fid, error)) < 0)
+    {
+      if (name) g_free (name);
+      return -1;
+    }
+    xfer += ret;
+    if (name) g_free (name);
+    name = NULL;
+
+    /* break if we get a STOP field */
+    if (ftype == T_STOP)
+    {
+      break;
+    }
+
+    switch (fid)
+    {
+      case 0:
+        if (ftype == T_I32)
+        {
+          if ((ret = thrift_protocol_read_i32 (protocol, &this_object->success, error)) < 0)
+            return -1;
+          xfer += ret;
+          this_object->__isset_success = TRUE;
+        } else {
+          if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
+            return -1;
+          xfer += ret;
+        }
+        break;
+      default:
+        if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
+          return -1;
+        xfer += ret;
+        break;
+    }
+    if ((ret = thrift_protocol_read_field_end (protocol, error)) < 0)
+      return -1;
+    xfer += ret;
+  }
+
+  if ((ret = thrift_protocol_read_struct_end (protocol, error)) < 0)
+    return -1;
+  xfer += ret;
+
+  return xfer;
+}
+
+static gint32
+bgp_configurator_start_bgp_result_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+{
+  gint32 ret;
+  gint32 xfer = 0;
+
+  BgpConfiguratorStartBgpResult * this_object = BGP_CONFIGURATOR_START_BGP_RESULT(object);
+  THRIFT_UNUSED_VAR (this_object);
+  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorStartBgpResult", error)) < 0)
+    return -1;
+  xfer += ret;
+  if (this_object->__isset_success == TRUE) {
+    if ((ret = thrift_protocol_write_field_begin (protocol, "success", T_I32, 0, error)) < 0)
+      return -1;
+    xfer += ret;
+    if ((ret = thrift_protocol_write_i32 (protocol, this_object->success, error)) < 0)
+      return -1;
+    xfer += ret;
+
+    if ((ret = thrift_protocol_write_field_end (protocol, error)) < 0)
+      return -1;
+    xfer += ret;
+  }
+  if ((ret = thrift_protocol_write_field_stop (protocol, error)) < 0)
+    return -1;
+  xfer += ret;
+  if ((ret = thrift_protocol_write_struct_end (protocol, error)) < 0)
+    return -1;
+  xfer += ret;
+
+  return xfer;
+}
+
+static void
+bgp_configurator_start_bgp_result_set_property (GObject *object,
+                                                guint property_id,
+                                                const GValue *value,
+                                                GParamSpec *pspec)
+{
+  BgpConfiguratorStartBgpResult *self = BGP_CONFIGURATOR_START_BGP_RESULT (object);
+
+  switch (property_id)
+  {
+    case PROP_BGP_CONFIGURATOR_START_BGP_RESULT_SUCCESS:
+      self->success = g_value_get_int (value);
+      self->__isset_success = TRUE;
+      break;
+
+    default:
+      G_OBJECT_WARN_INVALID_PROPERTY_ID (object, property_id, pspec);
+      break;
+  }
+}
+
+static void
+bgp_configurator_start_bgp_result_get_property (GObject *object,
+                                                guint property_id,
+                                                GValue *value,
+                                                GParamSpec *pspec)
+{
+  BgpConfiguratorStartBgpResult *self = BGP_CONFIGURATOR_START_BGP_RESULT (object);
+
+  switch (property_id)
+  {
+    case PROP_BGP_CONFIGURATOR_START_BGP_RESULT_SUCCESS:
+      g_value_set_int (value, self->success);
+      break;
+
+    default:
+      G_OBJECT_WARN_INVALID_PROPERTY_ID (object, property_id, pspec);
+      break;
+  }
+}
+
+static void 
+bgp_configurator_start_bgp_result_instance_init (BgpConfiguratorStartBgpResult * object)
+{
+  /* satisfy -Wall */
+  THRIFT_UNUSED_VAR (object);
+  object->success = 0;
+  object->__isset_success = FALSE;
+}
+
+static void 
+bgp_configurator_start_bgp_result_finalize (GObject *object)
+{
+  BgpConfiguratorStartBgpResult *tobject = BGP_CONFIGURATOR_START_BGP_RESULT (object);
+
+  /* satisfy -Wall in case we don't use tobject */
+  THRIFT_UNUSED_VAR (tobject);
+}
+
+static void
+bgp_configurator_start_bgp_result_class_init (BgpConfiguratorStartBgpResultClass * cls)
+{
+  GObjectClass *gobject_class = G_OBJECT_CLASS (cls);
+  ThriftStructClass *struct_class = THRIFT_STRUCT_CLASS (cls);
+
+  struct_class->read = bgp_configurator_start_bgp_result_read;
+  struct_class->write = bgp_configurator_start_bgp_result_write;
+
+  gobject_class->finalize = bgp_configurator_start_bgp_result_finalize;
+  gobject_class->get_property = bgp_configurator_start_bgp_result_get_property;
+  gobject_class->set_property = bgp_configurator_start_bgp_result_set_property;
+
+  g_object_class_install_property
+    (gobject_class,
+     PROP_BGP_CONFIGURATOR_START_BGP_RESULT_SUCCESS,
+     g_param_spec_int ("success",
+                       NULL,
+                       NULL,
+                       G_MININT32,
+                       G_MAXINT32,
+                       0,
+                       G_PARAM_READWRITE));
+}
+
+GType
+bgp_configurator_start_bgp_result_get_type (void)
+{
+  static GType type = 0;
+
+  if (type == 0) 
+  {
+    static const GTypeInfo type_info = 
+    {
+      sizeof (BgpConfiguratorStartBgpResultClass),
+      NULL, /* base_init */
+      NULL, /* base_finalize */
+      (GClassInitFunc) bgp_configurator_start_bgp_result_class_init,
+      NULL, /* class_finalize */
+      NULL, /* class_data */
+      sizeof (BgpConfiguratorStartBgpResult),
+      0, /* n_preallocs */
+      (GInstanceInitFunc) bgp_configurator_start_bgp_result_instance_init,
+      NULL, /* value_table */
+    };
+
+    type = g_type_register_static (THRIFT_TYPE_STRUCT, 
+                                   "BgpConfiguratorStartBgpResultType",
+                                   &type_info, 0);
+  }
+
+  return type;
+}
+
+enum _BgpConfiguratorStopBgpArgsProperties
+{
+  PROP_BGP_CONFIGURATOR_STOP_BGP_ARGS_0,
+  PROP_BGP_CONFIGURATOR_STOP_BGP_ARGS_AS_NUMBER
+};
+
+/* reads a bgp_configurator_stop_bgp_args object */
+static gint32
+bgp_configurator_stop_bgp_args_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+{
+  gint32 ret;
+  gint32 xfer = 0;
+  gchar *name = NULL;
+  ThriftType ftype;
+  gint16 fid;
+  guint32 len = 0;
+  gpointer data = NULL;
+  BgpConfiguratorStopBgpArgs * this_object = BGP_CONFIGURATOR_STOP_BGP_ARGS(object);
+
+  /* satisfy -Wall in case these aren't used */
+  THRIFT_UNUSED_VAR (len);
+  THRIFT_UNUSED_VAR (data);
+  THRIFT_UNUSED_VAR (this_object);
+
+  /* read the struct begin marker */
+  if ((ret = thrift_protocol_read_struct_begin (protocol, &name, error)) < 0)
+  {
+    if (name) g_free (name);
+    return -1;
+  }
+  xfer += ret;
+  if (name) g_free (name);
+  name = NULL;
+
+  /* read the struct fields */
+  while (1)
+  {
+    /* read the beginning of a field */
+    if ((ret = thrift_protocol_read_field_begin (protocol, &name, &ftype, &fid, error)) < 0)
+    {
+      if (name) g_free (name);
+      return -1;
+    }
+    xfer += ret;
+    if (name) g_free (name);
+    name = NULL;
+
+    /* break if we get a STOP field */
+    if (ftype == T_STOP)
+    {
+      break;
+    }
+
+    switch (fid)
+    {
+      case 1:
+        if (ftype == T_I64)
+        {
+          if ((ret = thrift_protocol_read_i64 (protocol, &this_object->asNumber, error)) < 0)
+            return -1;
+          xfer += ret;
+          this_object->__isset_asNumber = TRUE;
+        } else {
+          if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
+            return -1;
+          xfer += ret;
+        }
+        break;
+      default:
+        if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
+          return -1;
+        xfer += ret;
+        break;
+    }
+    if ((ret = thrift_protocol_read_field_end (protocol, error)) < 0)
+      return -1;
+    xfer += ret;
+  }
+
+  if ((ret = thrift_protocol_read_struct_end (protocol, error)) < 0)
+    return -1;
+  xfer += ret;
+
+  return xfer;
+}
+
+static gint32
+bgp_configurator_stop_bgp_args_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+{
+  gint32 ret;
+  gint32 xfer = 0;
+
+  BgpConfiguratorStopBgpArgs * this_object = BGP_CONFIGURATOR_STOP_BGP_ARGS(object);
+  THRIFT_UNUSED_VAR (this_object);
+  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorStopBgpArgs", error)) < 0)
+    return -1;
+  xfer += ret;
+  if ((ret = thrift_protocol_write_field_begin (protocol, "asNumber", T_I64, 1, error)) < 0)
+    return -1;
+  xfer += ret;
+  if ((ret = thrift_protocol_write_i64 (protocol, this_object->asNumber, error)) < 0)
+    return -1;
+  xfer += ret;
+
+  if ((ret = thrift_protocol_write_field_end (protocol, error)) < 0)
+    return -1;
+  xfer += ret;
+  if ((ret = thrift_protocol_write_field_stop (protocol, error)) < 0)
+    return -1;
+  xfer += ret;
+  if ((ret = thrift_protocol_write_struct_end (protocol, error)) < 0)
+    return -1;
+  xfer += ret;
+
+  return xfer;
+}
+
+static void
+bgp_configurator_stop_bgp_args_set_property (GObject *object,
+                                             guint property_id,
+                                             const GValue *value,
+                                             GParamSpec *pspec)
+{
+  BgpConfiguratorStopBgpArgs *self = BGP_CONFIGURATOR_STOP_BGP_ARGS (object);
+
+  switch (property_id)
+  {
+    case PROP_BGP_CONFIGURATOR_STOP_BGP_ARGS_AS_NUMBER:
+      self->asNumber = g_value_get_int64 (value);
+      self->__isset_asNumber = TRUE;
+      break;
+
+    default:
+      G_OBJECT_WARN_INVALID_PROPERTY_ID (object, property_id, pspec);
+      break;
+  }
+}
+
+static void
+bgp_configurator_stop_bgp_args_get_property (GObject *object,
+                                             guint property_id,
+                                             GValue *value,
+                                             GParamSpec *pspec)
+{
+  BgpConfiguratorStopBgpArgs *self = BGP_CONFIGURATOR_STOP_BGP_ARGS (object);
+
+  switch (property_id)
+  {
+    case PROP_BGP_CONFIGURATOR_STOP_BGP_ARGS_AS_NUMBER:
+      g_value_set_int64 (value, self->asNumber);
+      break;
+
+    default:
+      G_OBJECT_WARN_INVALID_PROPERTY_ID (object, property_id, pspec);
+      break;
+  }
+}
+
+static void 
+bgp_configurator_stop_bgp_args_instance_init (BgpConfiguratorStopBgpArgs * object)
+{
+  /* satisfy -Wall */
+  THRIFT_UNUSED_VAR (object);
+  object->asNumber = 0;
+  object->__isset_asNumber = FALSE;
+}
+
+static void 
+bgp_configurator_stop_bgp_args_finalize (GObject *object)
+{
+  BgpConfiguratorStopBgpArgs *tobject = BGP_CONFIGURATOR_STOP_BGP_ARGS (object);
+
+  /* satisfy -Wall in case we don't use tobject */
+  THRIFT_UNUSED_VAR (tobject);
+}
+
+static void
+bgp_configurator_stop_bgp_args_class_init (BgpConfiguratorStopBgpArgsClass * cls)
+{
+  GObjectClass *gobject_class = G_OBJECT_CLASS (cls);
+  ThriftStructClass *struct_class = THRIFT_STRUCT_CLASS (cls);
+
+  struct_class->read = bgp_configurator_stop_bgp_args_read;
+  struct_class->write = bgp_configurator_stop_bgp_args_write;
+
+  gobject_class->finalize = bgp_configurator_stop_bgp_args_finalize;
+  gobject_class->get_property = bgp_configurator_stop_bgp_args_get_property;
+  gobject_class->set_property = bgp_configurator_stop_bgp_args_set_property;
+
+  g_object_class_install_property
+    (gobject_class,
+     PROP_BGP_CONFIGURATOR_STOP_BGP_ARGS_AS_NUMBER,
+     g_param_spec_int64 ("asNumber",
+                         NULL,
+                         NULL,
+                         G_MININT64,
+                         G_MAXINT64,
+                         0,
+                         G_PARAM_READWRITE));
+}
+
+GType
+bgp_configurator_stop_bgp_args_get_type (void)
+{
+  static GType type = 0;
+
+  if (type == 0) 
+  {
+    static const GTypeInfo type_info = 
+    {
+      sizeof (BgpConfiguratorStopBgpArgsClass),
+      NULL, /* base_init */
+      NULL, /* base_finalize */
+      (GClassInitFunc) bgp_configurator_stop_bgp_args_class_init,
+      NULL, /* class_finalize */
+      NULL, /* class_data */
+      sizeof (BgpConfiguratorStopBgpArgs),
+      0, /* n_preallocs */
+      (GInstanceInitFunc) bgp_configurator_stop_bgp_args_instance_init,
+      NULL, /* value_table */
+    };
+
+    type = g_type_register_static (THRIFT_TYPE_STRUCT, 
+                                   "BgpConfiguratorStopBgpArgsType",
+                                   &type_info, 0);
+  }
+
+  return type;
+}
+
+enum _BgpConfiguratorStopBgpResultProperties
+{
+  PROP_BGP_CONFIGURATOR_STOP_BGP_RESULT_0,
+  PROP_BGP_CONFIGURATOR_STOP_BGP_RESULT_SUCCESS
+};
+
+/* reads a bgp_configurator_stop_bgp_result object */
+static gint32
+bgp_configurator_stop_bgp_result_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+{
+  gint32 ret;
+  gint32 xfer = 0;
+  gchar *name = NULL;
+  ThriftType ftype;
+  gint16 fid;
+  guint32 len = 0;
+  gpointer data = NULL;
+  BgpConfiguratorStopBgpResult * this_object = BGP_CONFIGURATOR_STOP_BGP_RESULT(object);
+
+  /* satisfy -Wall in case these aren't used */
+  THRIFT_UNUSED_VAR (len);
+  THRIFT_UNUSED_VAR (data);
+  THRIFT_UNUSED_VAR (this_object);
+
+  /* read the struct begin marker */
+  if ((ret = thrift_protocol_read_struct_begin (protocol, &name, error)) < 0)
+  {
+    if (name) g_free (name);
+    return -1;
+  }
+  xfer += ret;
+  if (name) g_free (name);
+  name = NULL;
+
+  /* read the struct fields */
+  while (1)
+  {
+    /* read the beginning of a field */
+    if ((ret = thrift_protocol_read_field_begin (protocol, &name, &ftype, &fid, error)) < 0)
+    {
+      if (name) g_free (name);
+      return -1;
+    }
+    xfer += ret;
+    if (name) g_free (name);
+    name = NULL;
+
+    /* break if we get a STOP field */
+    if (ftype == T_STOP)
+    {
+      break;
+    }
+
+    switch (fid)
+    {
+      case 0:
+        if (ftype == T_I32)
+        {
+          if ((ret = thrift_protocol_read_i32 (protocol, &this_object->success, error)) < 0)
+            return -1;
+          xfer += ret;
+          this_object->__isset_success = TRUE;
+        } else {
+          if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
+            return -1;
+          xfer += ret;
+        }
+        break;
+      default:
+        if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
+          return -1;
+        xfer += ret;
+        break;
+    }
+    if ((ret = thrift_protocol_read_field_end (protocol, error)) < 0)
+      return -1;
+    xfer += ret;
+  }
+
+  if ((ret = thrift_protocol_read_struct_end (protocol, error)) < 0)
+    return -1;
+  xfer += ret;
+
+  return xfer;
+}
+
+static gint32
+bgp_configurator_stop_bgp_result_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+{
+  gint32 ret;
+  gint32 xfer = 0;
+
+  BgpConfiguratorStopBgpResult * this_object = BGP_CONFIGURATOR_STOP_BGP_RESULT(object);
+  THRIFT_UNUSED_VAR (this_object);
+  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorStopBgpResult", error)) < 0)
+    return -1;
+  xfer += ret;
+  if (this_object->__isset_success == TRUE) {
+    if ((ret = thrift_protocol_write_field_begin (protocol, "success", T_I32, 0, error)) < 0)
+      return -1;
+    xfer += ret;
+    if ((ret = thrift_protocol_write_i32 (protocol, this_object->success, error)) < 0)
+      return -1;
+    xfer += ret;
+
+    if ((ret = thrift_protocol_write_field_end (protocol, error)) < 0)
+      return -1;
+    xfer += ret;
+  }
+  if ((ret = thrift_protocol_write_field_stop (protocol, error)) < 0)
+    return -1;
+  xfer += ret;
+  if ((ret = thrift_protocol_write_struct_end (protocol, error)) < 0)
+    return -1;
+  xfer += ret;
+
+  return xfer;
+}
+
+static void
+bgp_configurator_stop_bgp_result_set_property (GObject *object,
+                                               guint property_id,
+                                               const GValue *value,
+                                               GParamSpec *pspec)
+{
+  BgpConfiguratorStopBgpResult *self = BGP_CONFIGURATOR_STOP_BGP_RESULT (object);
+
+  switch (property_id)
+  {
+    case PROP_BGP_CONFIGURATOR_STOP_BGP_RESULT_SUCCESS:
+      self->success = g_value_get_int (value);
+      self->__isset_success = TRUE;
+      break;
+
+    default:
+      G_OBJECT_WARN_INVALID_PROPERTY_ID (object, property_id, pspec);
+      break;
+  }
+}
+
+static void
+bgp_configurator_stop_bgp_result_get_property (GObject *object,
+                                               guint property_id,
+                                               GValue *value,
+                                               GParamSpec *pspec)
+{
+  BgpConfiguratorStopBgpResult *self = BGP_CONFIGURATOR_STOP_BGP_RESULT (object);
+
+  switch (property_id)
+  {
+    case PROP_BGP_CONFIGURATOR_STOP_BGP_RESULT_SUCCESS:
+      g_value_set_int (value, self->success);
+      break;
+
+    default:
+      G_OBJECT_WARN_INVALID_PROPERTY_ID (object, property_id, pspec);
+      break;
+  }
+}
+
+static void 
+bgp_configurator_stop_bgp_result_instance_init (BgpConfiguratorStopBgpResult * object)
+{
+  /* satisfy -Wall */
+  THRIFT_UNUSED_VAR (object);
+  object->success = 0;
+  object->__isset_success = FALSE;
+}
+
+static void 
+bgp_configurator_stop_bgp_result_finalize (GObject *object)
+{
+  BgpConfiguratorStopBgpResult *tobject = BGP_CONFIGURATOR_STOP_BGP_RESULT (object);
+
+  /* satisfy -Wall in case we don't use tobject */
+  THRIFT_UNUSED_VAR (tobject);
+}
+
+static void
+bgp_configurator_stop_bgp_result_class_init (BgpConfiguratorStopBgpResultClass * cls)
+{
+  GObjectClass *gobject_class = G_OBJECT_CLASS (cls);
+  ThriftStructClass *struct_class = THRIFT_STRUCT_CLASS (cls);
+
+  struct_class->read = bgp_configurator_stop_bgp_result_read;
+  struct_class->write = bgp_configurator_stop_bgp_result_write;
+
+  gobject_class->finalize = bgp_configurator_stop_bgp_result_finalize;
+  gobject_class->get_property = bgp_configurator_stop_bgp_result_get_property;
+  gobject_class->set_property = bgp_configurator_stop_bgp_result_set_property;
+
+  g_object_class_install_property
+    (gobject_class,
+     PROP_BGP_CONFIGURATOR_STOP_BGP_RESULT_SUCCESS,
+     g_param_spec_int ("success",
+                       NULL,
+                       NULL,
+                       G_MININT32,
+                       G_MAXINT32,
+                       0,
+                       G_PARAM_READWRITE));
+}
+
+GType
+bgp_configurator_stop_bgp_result_get_type (void)
+{
+  static GType type = 0;
+
+  if (type == 0) 
+  {
+    static const GTypeInfo type_info = 
+    {
+      sizeof (BgpConfiguratorStopBgpResultClass),
+      NULL, /* base_init */
+      NULL, /* base_finalize */
+      (GClassInitFunc) bgp_configurator_stop_bgp_result_class_init,
+      NULL, /* class_finalize */
+      NULL, /* class_data */
+      sizeof (BgpConfiguratorStopBgpResult),
+      0, /* n_preallocs */
+      (GInstanceInitFunc) bgp_configurator_stop_bgp_result_instance_init,
+      NULL, /* value_table */
+    };
+
+    type = g_type_register_static (THRIFT_TYPE_STRUCT, 
+                                   "BgpConfiguratorStopBgpResultType",
+                                   &type_info, 0);
+  }
+
+  return type;
+}
+
+enum _BgpConfiguratorCreatePeerArgsProperties
+{
+  PROP_BGP_CONFIGURATOR_CREATE_PEER_ARGS_0,
+  PROP_BGP_CONFIGURATOR_CREATE_PEER_ARGS_IP_ADDRESS,
+  PROP_BGP_CONFIGURATOR_CREATE_PEER_ARGS_AS_NUMBER
+};
+
+/* reads a bgp_configurator_create_peer_args object */
+static gint32
+bgp_configurator_create_peer_args_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+{
+  gint32 ret;
+  gint32 xfer = 0;
+  gchar *name = NULL;
+  ThriftType ftype;
+  gint16 fid;
+  guint32 len = 0;
+  gpointer data = NULL;
+  BgpConfiguratorCreatePeerArgs * this_object = BGP_CONFIGURATOR_CREATE_PEER_ARGS(object);
+
+  /* satisfy -Wall in case these aren't used */
+  THRIFT_UNUSED_VAR (len);
+  THRIFT_UNUSED_VAR (data);
+  THRIFT_UNUSED_VAR (this_object);
+
+  /* read the struct begin marker */
+  if ((ret = thrift_protocol_read_struct_begin (protocol, &name, error)) < 0)
+  {
+    if (name) g_free (name);
+    return -1;
+  }
+  xfer += ret;
+  if (name) g_free (name);
+  name = NULL;
+
+  /* read the struct fields */
+  while (1)
+  {
+    /* read the beginning of a field */
+    if ((ret = thrift_protocol_read_field_begin (protocol, &name, &ftype, &fid, error)) < 0)
+    {
+      if (name) g_free (name);
+      return -1;
+    }
+    xfer += ret;
+    if (name) g_free (name);
+    name = NULL;
+
+    /* break if we get a STOP field */
+    if (ftype == T_STOP)
+    {
+      break;
+    }
+
+    switch (fid)
+    {
+      case 1:
+        if (ftype == T_STRING)
+        {
+          if (this_object->ipAddress != NULL)
+          {
+            g_free(this_object->ipAddress);
+            this_object->ipAddress = NULL;
+          }
+
+          if ((ret = thrift_protocol_read_string (protocol, &this_object->ipAddress, error)) < 0)
+            return -1;
+          xfer += ret;
+          this_object->__isset_ipAddress = TRUE;
+        } else {
+          if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
+            return -1;
+          xfer += ret;
+        }
+        break;
+      case 2:
+        if (ftype == T_I64)
+        {
+          if ((ret = thrift_protocol_read_i64 (protocol, &this_object->asNumber, error)) < 0)
+            return -1;
+          xfer += ret;
+          this_object->__isset_asNumber = TRUE;
+        } else {
+          if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
+            return -1;
+          xfer += ret;
+        }
+        break;
+      default:
+        if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
+          return -1;
+        xfer += ret;
+        break;
+    }
+    if ((ret = thrift_protocol_read_field_end (protocol, error)) < 0)
+      return -1;
+    xfer += ret;
+  }
+
+  if ((ret = thrift_protocol_read_struct_end (protocol, error)) < 0)
+    return -1;
+  xfer += ret;
+
+  return xfer;
+}
+
+static gint32
+bgp_configurator_create_peer_args_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+{
+  gint32 ret;
+  gint32 xfer = 0;
+
+  BgpConfiguratorCreatePeerArgs * this_object = BGP_CONFIGURATOR_CREATE_PEER_ARGS(object);
+  THRIFT_UNUSED_VAR (this_object);
+  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorCreatePeerArgs", error)) < 0)
+    return -1;
+  xfer += ret;
+  if ((ret = thrift_protocol_write_field_begin (protocol, "ipAddress", T_STRING, 1, error)) < 0)
+    return -1;
+  xfer += ret;
+  if ((ret = thrift_protocol_write_string (protocol, this_object->ipAddress, error)) < 0)
+    return -1;
+  xfer += ret;
+
+  if ((ret = thrift_protocol_write_field_end (protocol, error)) < 0)
+    return -1;
+  xfer += ret;
+  if ((ret = thrift_protocol_write_field_begin (protocol, "asNumber", T_I64, 2, error)) < 0)
+    return -1;
+  xfer += ret;
+  if ((ret = thrift_protocol_write_i64 (protocol, this_object->asNumber, error)) < 0)
+    return -1;
+  xfer += ret;
+
+  if ((ret = thrift_protocol_write_field_end (protocol, error)) < 0)
+    return -1;
+  xfer += ret;
+  if ((ret = thrift_protocol_write_field_stop (protocol, error)) < 0)
+    return -1;
+  xfer += ret;
+  if ((ret = thrift_protocol_write_struct_end (protocol, error)) < 0)
+    return -1;
+  xfer += ret;
+
+  return xfer;
+}
+
+static void
+bgp_configurator_create_peer_args_set_property (GObject *object,
+                                                guint property_id,
+                                                const GValue *value,
+                                                GParamSpec *pspec)
+{
+  BgpConfiguratorCreatePeerArgs *self = BGP_CONFIGURATOR_CREATE_PEER_ARGS (object);
+
+  switch (property_id)
+  {
+    case PROP_BGP_CONFIGURATOR_CREATE_PEER_ARGS_IP_ADDRESS:
+      if (self->ipAddress != NULL)
+        g_free (self->ipAddress);
+      self->ipAddress = g_value_dup_string (value);
+      self->__isset_ipAddress = TRUE;
+      break;
+
+    case PROP_BGP_CONFIGURATOR_CREATE_PEER_ARGS_AS_NUMBER:
+      self->asNumber = g_value_get_int64 (value);
+      self->__isset_asNumber = TRUE;
+      break;
+
+    default:
+      G_OBJECT_WARN_INVALID_PROPERTY_ID (object, property_id, pspec);
+      break;
+  }
+}
+
+static void
+bgp_configurator_create_peer_args_get_property (GObject *object,
+                                                guint property_id,
+                                                GValue *value,
+                                                GParamSpec *pspec)
+{
+  BgpConfiguratorCreatePeerArgs *self = BGP_CONFIGURATOR_CREATE_PEER_ARGS (object);
+
+  switch (property_id)
+  {
+    case PROP_BGP_CONFIGURATOR_CREATE_PEER_ARGS_IP_ADDRESS:
+      g_value_set_string (value, self->ipAddress);
+      break;
+
+    case PROP_BGP_CONFIGURATOR_CREATE_PEER_ARGS_AS_NUMBER:
+      g_value_set_int64 (value, self->asNumber);
+      break;
+
+    default:
+      G_OBJECT_WARN_INVALID_PROPERTY_ID (object, property_id, pspec);
+      break;
+  }
+}
+
+static void 
+bgp_configurator_create_peer_args_instance_init (BgpConfiguratorCreatePeerArgs * object)
+{
+  /* satisfy -Wall */
+  THRIFT_UNUSED_VAR (object);
+  object->ipAddress = NULL;
+  object->__isset_ipAddress = FALSE;
+  object->asNumber = 0;
+  object->__isset_asNumber = FALSE;
+}
+
+static void 
+bgp_configurator_create_peer_args_finalize (GObject *object)
+{
+  BgpConfiguratorCreatePeerArgs *tobject = BGP_CONFIGURATOR_CREATE_PEER_ARGS (object);
+
+  /* satisfy -Wall in case we don't use tobject */
+  THRIFT_UNUSED_VAR (tobject);
+  if (tobject->ipAddress != NULL)
+  {
+    g_free(tobject->ipAddress);
+    tobject->ipAddress = NULL;
+  }
+}
+
+static void
+bgp_configurator_create_peer_args_class_init (BgpConfiguratorCreatePeerArgsClass * cls)
+{
+  GObjectClass *gobject_class = G_OBJECT_CLASS (cls);
+  ThriftStructClass *struct_class = THRIFT_STRUCT_CLASS (cls);
+
+  struct_class->read = bgp_configurator_create_peer_args_read;
+  struct_class->write = bgp_configurator_create_peer_args_write;
+
+  gobject_class->finalize = bgp_configurator_create_peer_args_finalize;
+  gobject_class->get_property = bgp_configurator_create_peer_args_get_property;
+  gobject_class->set_property = bgp_configurator_create_peer_args_set_property;
+
+  g_object_class_install_property
+    (gobject_class,
+     PROP_BGP_CONFIGURATOR_CREATE_PEER_ARGS_IP_ADDRESS,
+     g_param_spec_string ("ipAddress",
+                          NULL,
+                          NULL,
+                          NULL,
+                          G_PARAM_READWRITE));
+
+  g_object_class_install_property
+    (gobject_class,
+     PROP_BGP_CONFIGURATOR_CREATE_PEER_ARGS_AS_NUMBER,
+     g_param_spec_int64 ("asNumber",
+                         NULL,
+                         NULL,
+                         G_MININT64,
+                         G_MAXINT64,
+                         0,
+                         G_PARAM_READWRITE));
+}
+
+GType
+bgp_configurator_create_peer_args_get_type (void)
+{
+  static GType type = 0;
+
+  if (type == 0) 
+  {
+    static const GTypeInfo type_info = 
+    {
+      sizeof (BgpConfiguratorCreatePeerArgsClass),
+      NULL, /* base_init */
+      NULL, /* base_finalize */
+      (GClassInitFunc) bgp_configurator_create_peer_args_class_init,
+      NULL, /* class_finalize */
+      NULL, /* class_data */
+      sizeof (BgpConfiguratorCreatePeerArgs),
+      0, /* n_preallocs */
+      (GInstanceInitFunc) bgp_configurator_create_peer_args_instance_init,
+      NULL, /* value_table */
+    };
+
+    type = g_type_register_static (THRIFT_TYPE_STRUCT, 
+                                   "BgpConfiguratorCreatePeerArgsType",
+                                   &type_info, 0);
+  }
+
+  return type;
+}
+
+enum _BgpConfiguratorCreatePeerResultProperties
+{
+  PROP_BGP_CONFIGURATOR_CREATE_PEER_RESULT_0,
+  PROP_BGP_CONFIGURATOR_CREATE_PEER_RESULT_SUCCESS
+};
+
+/* reads a bgp_configurator_create_peer_result object */
+static gint32
+bgp_configurator_create_peer_result_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+{
+  gint32 ret;
+  gint32 xfer = 0;
+  gchar *name = NULL;
+  ThriftType ftype;
+  gint16 fid;
+  guint32 len = 0;
+  gpointer data = NULL;
+  BgpConfiguratorCreatePeerResult * this_object = BGP_CONFIGURATOR_CREATE_PEER_RESULT(object);
+
+  /* satisfy -Wall in case these aren't used */
+  THRIFT_UNUSED_VAR (len);
+  THRIFT_UNUSED_VAR (data);
+  THRIFT_UNUSED_VAR (this_object);
+
+  /* read the struct begin marker */
+  if ((ret = thrift_protocol_read_struct_begin (protocol, &name, error)) < 0)
+  {
+    if (name) g_free (name);
+    return -1;
+  }
+  xfer += ret;
+  if (name) g_free (name);
+  name = NULL;
+
+  /* read the struct fields */
+  while (1)
+  {
+    /* read the beginning of a field */
+    if ((ret = thrift_protocol_read_field_begin (protocol, &name, &ftype, &fid, error)) < 0)
+    {
+      if (name) g_free (name);
+      return -1;
+    }
+    xfer += ret;
+    if (name) g_free (name);
+    name = NULL;
+
+    /* break if we get a STOP field */
+    if (ftype == T_STOP)
+    {
+      break;
+    }
+
+    switch (fid)
+    {
+      case 0:
+        if (ftype == T_I32)
+        {
+          if ((ret = thrift_protocol_read_i32 (protocol, &this_object->success, error)) < 0)
+            return -1;
+          xfer += ret;
+          this_object->__isset_success = TRUE;
+        } else {
+          if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
+            return -1;
+          xfer += ret;
+        }
+        break;
+      default:
+        if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
+          return -1;
+        xfer += ret;
+        break;
+    }
+    if ((ret = thrift_protocol_read_field_end (protocol, error)) < 0)
+      return -1;
+    xfer += ret;
+  }
+
+  if ((ret = thrift_protocol_read_struct_end (protocol, error)) < 0)
+    return -1;
+  xfer += ret;
+
+  return xfer;
+}
+
+static gint32
+bgp_configurator_create_peer_result_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+{
+  gint32 ret;
+  gint32 xfer = 0;
+
+  BgpConfiguratorCreatePeerResult * this_object = BGP_CONFIGURATOR_CREATE_PEER_RESULT(object);
+  THRIFT_UNUSED_VAR (this_object);
+  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorCreatePeerResult", error)) < 0)
+    return -1;
+  xfer += ret;
+  if (this_object->__isset_success == TRUE) {
+    if ((ret = thrift_protocol_write_field_begin (protocol, "success", T_I32, 0, error)) < 0)
+      return -1;
+    xfer += ret;
+    if ((ret = thrift_protocol_write_i32 (protocol, this_object->success, error)) < 0)
+      return -1;
+    xfer += ret;
+
+    if ((ret = thrift_protocol_write_field_end (protocol, error)) < 0)
+      return -1;
+    xfer += ret;
+  }
+  if ((ret = thrift_protocol_write_field_stop (protocol, error)) < 0)
+    return -1;
+  xfer += ret;
+  if ((ret = thrift_protocol_write_struct_end (protocol, error)) < 0)
+    return -1;
+  xfer += ret;
+
+  return xfer;
+}
+
+static void
+bgp_configurator_create_peer_result_set_property (GObject *object,
+                                                  guint property_id,
+                                                  const GValue *value,
+                                                  GParamSpec *pspec)
+{
+  BgpConfiguratorCreatePeerResult *self = BGP_CONFIGURATOR_CREATE_PEER_RESULT (object);
+
+  switch (property_id)
+  {
+    case PROP_BGP_CONFIGURATOR_CREATE_PEER_RESULT_SUCCESS:
+      self->success = g_value_get_int (value);
+      self->__isset_success = TRUE;
+      break;
+
+    default:
+      G_OBJECT_WARN_INVALID_PROPERTY_ID (object, property_id, pspec);
+      break;
+  }
+}
+
+static void
+bgp_configurator_create_peer_result_get_property (GObject *object,
+                                                  guint property_id,
+                                                  GValue *value,
+                                                  GParamSpec *pspec)
+{
+  BgpConfiguratorCreatePeerResult *self = BGP_CONFIGURATOR_CREATE_PEER_RESULT (object);
+
+  switch (property_id)
+  {
+    case PROP_BGP_CONFIGURATOR_CREATE_PEER_RESULT_SUCCESS:
+      g_value_set_int (value, self->success);
+      break;
+
+    default:
+      G_OBJECT_WARN_INVALID_PROPERTY_ID (object, property_id, pspec);
+      break;
+  }
+}
+
+static void 
+bgp_configurator_create_peer_result_instance_init (BgpConfiguratorCreatePeerResult * object)
+{
+  /* satisfy -Wall */
+  THRIFT_UNUSED_VAR (object);
+  object->success = 0;
+  object->__isset_success = FALSE;
+}
+
+static void 
+bgp_configurator_create_peer_result_finalize (GObject *object)
+{
+  BgpConfiguratorCreatePeerResult *tobject = BGP_CONFIGURATOR_CREATE_PEER_RESULT (object);
+
+  /* satisfy -Wall in case we don't use tobject */
+  THRIFT_UNUSED_VAR (tobject);
+}
+
+static void
+bgp_configurator_create_peer_result_class_init (BgpConfiguratorCreatePeerResultClass * cls)
+{
+  GObjectClass *gobject_class = G_OBJECT_CLASS (cls);
+  ThriftStructClass *struct_class = THRIFT_STRUCT_CLASS (cls);
+
+  struct_class->read = bgp_configurator_create_peer_result_read;
+  struct_class->write = bgp_configurator_create_peer_result_write;
+
+  gobject_class->finalize = bgp_configurator_create_peer_result_finalize;
+  gobject_class->get_property = bgp_configurator_create_peer_result_get_property;
+  gobject_class->set_property = bgp_configurator_create_peer_result_set_property;
+
+  g_object_class_install_property
+    (gobject_class,
+     PROP_BGP_CONFIGURATOR_CREATE_PEER_RESULT_SUCCESS,
+     g_param_spec_int ("success",
+                       NULL,
+                       NULL,
+                       G_MININT32,
+                       G_MAXINT32,
+                       0,
+                       G_PARAM_READWRITE));
+}
+
+GType
+bgp_configurator_create_peer_result_get_type (void)
+{
+  static GType type = 0;
+
+  if (type == 0) 
+  {
+    static const GTypeInfo type_info = 
+    {
+      sizeof (BgpConfiguratorCreatePeerResultClass),
+      NULL, /* base_init */
+      NULL, /* base_finalize */
+      (GClassInitFunc) bgp_configurator_create_peer_result_class_init,
+      NULL, /* class_finalize */
+      NULL, /* class_data */
+      sizeof (BgpConfiguratorCreatePeerResult),
+      0, /* n_preallocs */
+      (GInstanceInitFunc) bgp_configurator_create_peer_result_instance_init,
+      NULL, /* value_table */
+    };
+
+    type = g_type_register_static (THRIFT_TYPE_STRUCT, 
+                                   "BgpConfiguratorCreatePeerResultType",
+                                   &type_info, 0);
+  }
+
+  return type;
+}
+
+enum _BgpConfiguratorDeletePeerArgsProperties
+{
+  PROP_BGP_CONFIGURATOR_DELETE_PEER_ARGS_0,
+  PROP_BGP_CONFIGURATOR_DELETE_PEER_ARGS_IP_ADDRESS
+};
+
+/* reads a bgp_configurator_delete_peer_args object */
+static gint32
+bgp_configurator_delete_peer_args_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+{
+  gint32 ret;
+  gint32 xfer = 0;
+  gchar *name = NULL;
+  ThriftType ftype;
+  gint16 fid;
+  guint32 len = 0;
+  gpointer data = NULL;
+  BgpConfiguratorDeletePeerArgs * this_object = BGP_CONFIGURATOR_DELETE_PEER_ARGS(object);
+
+  /* satisfy -Wall in case these aren't used */
+  THRIFT_UNUSED_VAR (len);
+  THRIFT_UNUSED_VAR (data);
+  THRIFT_UNUSED_VAR (this_object);
+
+  /* read the struct begin marker */
+  if ((ret = thrift_protocol_read_struct_begin (protocol, &name, error)) < 0)
+  {
+    if (name) g_free (name);
+    return -1;
+  }
+  xfer += ret;
+  if (name) g_free (name);
+  name = NULL;
+
+  /* read the struct fields */
+  while (1)
+  {
+    /* read the beginning of a field */
+    if ((ret = thrift_protocol_read_field_begin (protocol, &name, &ftype, &fid, error)) < 0)
+    {
+      if (name) g_free (name);
+      return -1;
+    }
+    xfer += ret;
+    if (name) g_free (name);
+    name = NULL;
+
+    /* break if we get a STOP field */
+    if (ftype == T_STOP)
+    {
+      break;
+    }
+
+    switch (fid)
+    {
+      case 1:
+        if (ftype == T_STRING)
+        {
+          if (this_object->ipAddress != NULL)
+          {
+            g_free(this_object->ipAddress);
+            this_object->ipAddress = NULL;
+          }
+
+          if ((ret = thrift_protocol_read_string (protocol, &this_object->ipAddress, error)) < 0)
+            return -1;
+          xfer += ret;
+          this_object->__isset_ipAddress = TRUE;
+        } else {
+          if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
+            return -1;
+          xfer += ret;
+        }
+        break;
+      default:
+        if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
+          return -1;
+        xfer += ret;
+        break;
+    }
+    if ((ret = thrift_protocol_read_field_end (protocol, error)) < 0)
+      return -1;
+    xfer += ret;
+  }
+
+  if ((ret = thrift_protocol_read_struct_end (protocol, error)) < 0)
+    return -1;
+  xfer += ret;
+
+  return xfer;
+}
+
+static gint32
+bgp_configurator_delete_peer_args_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+{
+  gint32 ret;
+  gint32 xfer = 0;
+
+  BgpConfiguratorDeletePeerArgs * this_object = BGP_CONFIGURATOR_DELETE_PEER_ARGS(object);
+  THRIFT_UNUSED_VAR (this_object);
+  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorDeletePeerArgs", error)) < 0)
+    return -1;
+  xfer += ret;
+  if ((ret = thrift_protocol_write_field_begin (protocol, "ipAddress", T_STRING, 1, error)) < 0)
+    return -1;
+  xfer += ret;
+  if ((ret = thrift_protocol_write_string (protocol, this_object->ipAddress, error)) < 0)
+    return -1;
+  xfer += ret;
+
+  if ((ret = thrift_protocol_write_field_end (protocol, error)) < 0)
+    return -1;
+  xfer += ret;
+  if ((ret = thrift_protocol_write_field_stop (protocol, error)) < 0)
+    return -1;
+  xfer += ret;
+  if ((ret = thrift_protocol_write_struct_end (protocol, error)) < 0)
+    return -1;
+  xfer += ret;
+
+  return xfer;
+}
+
+static void
+bgp_configurator_delete_peer_args_set_property (GObject *object,
+                                                guint property_id,
+                                                const GValue *value,
+                                                GParamSpec *pspec)
+{
+  BgpConfiguratorDeletePeerArgs *self = BGP_CONFIGURATOR_DELETE_PEER_ARGS (object);
+
+  switch (property_id)
+  {
+    case PROP_BGP_CONFIGURATOR_DELETE_PEER_ARGS_IP_ADDRESS:
+      if (self->ipAddress != NULL)
+        g_free (self->ipAddress);
+      self->ipAddress = g_value_dup_string (value);
+      self->__isset_ipAddress = TRUE;
+      break;
+
+    default:
+      G_OBJECT_WARN_INVALID_PROPERTY_ID (object, property_id, pspec);
+      break;
+  }
+}
+
+static void
+bgp_configurator_delete_peer_args_get_property (GObject *object,
+                                                guint property_id,
+                                                GValue *value,
+                                                GParamSpec *pspec)
+{
+  BgpConfiguratorDeletePeerArgs *self = BGP_CONFIGURATOR_DELETE_PEER_ARGS (object);
+
+  switch (property_id)
+  {
+    case PROP_BGP_CONFIGURATOR_DELETE_PEER_ARGS_IP_ADDRESS:
+      g_value_set_string (value, self->ipAddress);
+      break;
+
+    default:
+      G_OBJECT_WARN_INVALID_PROPERTY_ID (object, property_id, pspec);
+      break;
+  }
+}
+
+static void 
+bgp_configurator_delete_peer_args_instance_init (BgpConfiguratorDeletePeerArgs * object)
+{
+  /* satisfy -Wall */
+  THRIFT_UNUSED_VAR (object);
+  object->ipAddress = NULL;
+  object->__isset_ipAddress = FALSE;
+}
+
+static void 
+bgp_configurator_delete_peer_args_finalize (GObject *object)
+{
+  BgpConfiguratorDeletePeerArgs *tobject = BGP_CONFIGURATOR_DELETE_PEER_ARGS (object);
+
+  /* satisfy -Wall in case we don't use tobject */
+  THRIFT_UNUSED_VAR (tobject);
+  if (tobject->ipAddress != NULL)
+  {
+    g_free(tobject->ipAddress);
+    tobject->ipAddress = NULL;
+  }
+}
+
+static void
+bgp_configurator_delete_peer_args_class_init (BgpConfiguratorDeletePeerArgsClass * cls)
+{
+  GObjectClass *gobject_class = G_OBJECT_CLASS (cls);
+  ThriftStructClass *struct_class = THRIFT_STRUCT_CLASS (cls);
+
+  struct_class->read = bgp_configurator_delete_peer_args_read;
+  struct_class->write = bgp_configurator_delete_peer_args_write;
+
+  gobject_class->finalize = bgp_configurator_delete_peer_args_finalize;
+  gobject_class->get_property = bgp_configurator_delete_peer_args_get_property;
+  gobject_class->set_property = bgp_configurator_delete_peer_args_set_property;
+
+  g_object_class_install_property
+    (gobject_class,
+     PROP_BGP_CONFIGURATOR_DELETE_PEER_ARGS_IP_ADDRESS,
+     g_param_spec_string ("ipAddress",
+                          NULL,
+                          NULL,
+                          NULL,
+                          G_PARAM_READWRITE));
+}
+
+GType
+bgp_configurator_delete_peer_args_get_type (void)
+{
+  static GType type = 0;
+
+  if (type == 0) 
+  {
+    static const GTypeInfo type_info = 
+    {
+      sizeof (BgpConfiguratorDeletePeerArgsClass),
+      NULL, /* base_init */
+      NULL, /* base_finalize */
+      (GClassInitFunc) bgp_configurator_delete_peer_args_class_init,
+      NULL, /* class_finalize */
+      NULL, /* class_data */
+      sizeof (BgpConfiguratorDeletePeerArgs),
+      0, /* n_preallocs */
+      (GInstanceInitFunc) bgp_configurator_delete_peer_args_instance_init,
+      NULL, /* value_table */
+    };
+
+    type = g_type_register_static (THRIFT_TYPE_STRUCT, 
+                                   "BgpConfiguratorDeletePeerArgsType",
+                                   &type_info, 0);
+  }
+
+  return type;
+}
+
+enum _BgpConfiguratorDeletePeerResultProperties
+{
+  PROP_BGP_CONFIGURATOR_DELETE_PEER_RESULT_0,
+  PROP_BGP_CONFIGURATOR_DELETE_PEER_RESULT_SUCCESS
+};
+
+/* reads a bgp_configurator_delete_peer_result object */
+static gint32
+bgp_configurator_delete_peer_result_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+{
+  gint32 ret;
+  gint32 xfer = 0;
+  gchar *name = NULL;
+  ThriftType ftype;
+  gint16 fid;
+  guint32 len = 0;
+  gpointer data = NULL;
+  BgpConfiguratorDeletePeerResult * this_object = BGP_CONFIGURATOR_DELETE_PEER_RESULT(object);
+
+  /* satisfy -Wall in case these aren't used */
+  THRIFT_UNUSED_VAR (len);
+  THRIFT_UNUSED_VAR (data);
+  THRIFT_UNUSED_VAR (this_object);
+
+  /* read the struct begin marker */
+  if ((ret = thrift_protocol_read_struct_begin (protocol, &name, error)) < 0)
+  {
+    if (name) g_free (name);
+    return -1;
+  }
+  xfer += ret;
+  if (name) g_free (name);
+  name = NULL;
+
+  /* read the struct fields */
+  while (1)
+  {
+    /* read the beginning of a field */
+    if ((ret = thrift_protocol_read_field_begin (protocol, &name, &ftype, &fid, error)) < 0)
+    {
+      if (name) g_free (name);
+      return -1;
+    }
+    xfer += ret;
+    if (name) g_free (name);
+    name = NULL;
+
+    /* break if we get a STOP field */
+    if (ftype == T_STOP)
+    {
+      break;
+    }
+
+    switch (fid)
+    {
+      case 0:
+        if (ftype == T_I32)
+        {
+          if ((ret = thrift_protocol_read_i32 (protocol, &this_object->success, error)) < 0)
+            return -1;
+          xfer += ret;
+          this_object->__isset_success = TRUE;
+        } else {
+          if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
+            return -1;
+          xfer += ret;
+        }
+        break;
+      default:
+        if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
+          return -1;
+        xfer += ret;
+        break;
+    }
+    if ((ret = thrift_protocol_read_field_end (protocol, error)) < 0)
+      return -1;
+    xfer += ret;
+  }
+
+  if ((ret = thrift_protocol_read_struct_end (protocol, error)) < 0)
+    return -1;
+  xfer += ret;
+
+  return xfer;
+}
+
+static gint32
+bgp_configurator_delete_peer_result_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+{
+  gint32 ret;
+  gint32 xfer = 0;
+
+  BgpConfiguratorDeletePeerResult * this_object = BGP_CONFIGURATOR_DELETE_PEER_RESULT(object);
+  THRIFT_UNUSED_VAR (this_object);
+  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorDeletePeerResult", error)) < 0)
+    return -1;
+  xfer += ret;
+  if (this_object->__isset_success == TRUE) {
+    if ((ret = thrift_protocol_write_field_begin (protocol, "success", T_I32, 0, error)) < 0)
+      return -1;
+    xfer += ret;
+    if ((ret = thrift_protocol_write_i32 (protocol, this_object->success, error)) < 0)
+      return -1;
+    xfer += ret;
+
+    if ((ret = thrift_protocol_write_field_end (protocol, error)) < 0)
+      return -1;
+    xfer += ret;
+  }
+  if ((ret = thrift_protocol_write_field_stop (protocol, error)) < 0)
+    return -1;
+  xfer += ret;
+  if ((ret = thrift_protocol_write_struct_end (protocol, error)) < 0)
+    return -1;
+  xfer += ret;
+
+  return xfer;
+}
+
+static void
+bgp_configurator_delete_peer_result_set_property (GObject *object,
+                                                  guint property_id,
+                                                  const GValue *value,
+                                                  GParamSpec *pspec)
+{
+  BgpConfiguratorDeletePeerResult *self = BGP_CONFIGURATOR_DELETE_PEER_RESULT (object);
+
+  switch (property_id)
+  {
+    case PROP_BGP_CONFIGURATOR_DELETE_PEER_RESULT_SUCCESS:
+      self->success = g_value_get_int (value);
+      self->__isset_success = TRUE;
+      break;
+
+    default:
+      G_OBJECT_WARN_INVALID_PROPERTY_ID (object, property_id, pspec);
+      break;
+  }
+}
+
+static void
+bgp_configurator_delete_peer_result_get_property (GObject *object,
+                                                  guint property_id,
+                                                  GValue *value,
+                                                  GParamSpec *pspec)
+{
+  BgpConfiguratorDeletePeerResult *self = BGP_CONFIGURATOR_DELETE_PEER_RESULT (object);
+
+  switch (property_id)
+  {
+    case PROP_BGP_CONFIGURATOR_DELETE_PEER_RESULT_SUCCESS:
+      g_value_set_int (value, self->success);
+      break;
+
+    default:
+      G_OBJECT_WARN_INVALID_PROPERTY_ID (object, property_id, pspec);
+      break;
+  }
+}
+
+static void 
+bgp_configurator_delete_peer_result_instance_init (BgpConfiguratorDeletePeerResult * object)
+{
+  /* satisfy -Wall */
+  THRIFT_UNUSED_VAR (object);
+  object->success = 0;
+  object->__isset_success = FALSE;
+}
+
+static void 
+bgp_configurator_delete_peer_result_finalize (GObject *object)
+{
+  BgpConfiguratorDeletePeerResult *tobject = BGP_CONFIGURATOR_DELETE_PEER_RESULT (object);
+
+  /* satisfy -Wall in case we don't use tobject */
+  THRIFT_UNUSED_VAR (tobject);
+}
+
+static void
+bgp_configurator_delete_peer_result_class_init (BgpConfiguratorDeletePeerResultClass * cls)
+{
+  GObjectClass *gobject_class = G_OBJECT_CLASS (cls);
+  ThriftStructClass *struct_class = THRIFT_STRUCT_CLASS (cls);
+
+  struct_class->read = bgp_configurator_delete_peer_result_read;
+  struct_class->write = bgp_configurator_delete_peer_result_write;
+
+  gobject_class->finalize = bgp_configurator_delete_peer_result_finalize;
+  gobject_class->get_property = bgp_configurator_delete_peer_result_get_property;
+  gobject_class->set_property = bgp_configurator_delete_peer_result_set_property;
+
+  g_object_class_install_property
+    (gobject_class,
+     PROP_BGP_CONFIGURATOR_DELETE_PEER_RESULT_SUCCESS,
+     g_param_spec_int ("success",
+                       NULL,
+                       NULL,
+                       G_MININT32,
+                       G_MAXINT32,
+                       0,
+                       G_PARAM_READWRITE));
+}
+
+GType
+bgp_configurator_delete_peer_result_get_type (void)
+{
+  static GType type = 0;
+
+  if (type == 0) 
+  {
+    static const GTypeInfo type_info = 
+    {
+      sizeof (BgpConfiguratorDeletePeerResultClass),
+      NULL, /* base_init */
+      NULL, /* base_finalize */
+      (GClassInitFunc) bgp_configurator_delete_peer_result_class_init,
+      NULL, /* class_finalize */
+      NULL, /* class_data */
+      sizeof (BgpConfiguratorDeletePeerResult),
+      0, /* n_preallocs */
+      (GInstanceInitFunc) bgp_configurator_delete_peer_result_instance_init,
+      NULL, /* value_table */
+    };
+
+    type = g_type_register_static (THRIFT_TYPE_STRUCT, 
+                                   "BgpConfiguratorDeletePeerResultType",
+                                   &type_info, 0);
+  }
+
+  return type;
+}
+
+enum _BgpConfiguratorAddVrfArgsProperties
+{
+  PROP_BGP_CONFIGURATOR_ADD_VRF_ARGS_0,
+  PROP_BGP_CONFIGURATOR_ADD_VRF_ARGS_RD,
+  PROP_BGP_CONFIGURATOR_ADD_VRF_ARGS_IRTS,
+  PROP_BGP_CONFIGURATOR_ADD_VRF_ARGS_ERTS
+};
+
+/* reads a bgp_configurator_add_vrf_args object */
+static gint32
+bgp_configurator_add_vrf_args_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+{
+  gint32 ret;
+  gint32 xfer = 0;
+  gchar *name = NULL;
+  ThriftType ftype;
+  gint16 fid;
+  guint32 len = 0;
+  gpointer data = NULL;
+  BgpConfiguratorAddVrfArgs * this_object = BGP_CONFIGURATOR_ADD_VRF_ARGS(object);
+
+  /* satisfy -Wall in case these aren't used */
+  THRIFT_UNUSED_VAR (len);
+  THRIFT_UNUSED_VAR (data);
+  THRIFT_UNUSED_VAR (this_object);
+
+  /* read the struct begin marker */
+  if ((ret = thrift_protocol_read_struct_begin (protocol, &name, error)) < 0)
+  {
+    if (name) g_free (name);
+    return -1;
+  }
+  xfer += ret;
+  if (name) g_free (name);
+  name = NULL;
+
+  /* read the struct fields */
+  while (1)
+  {
+    /* read the beginning of a field */
+    if ((ret = thrift_protocol_read_field_begin (protocol, &name, &ftype, &fid, error)) < 0)
+    {
+      if (name) g_free (name);
+      return -1;
+    }
+    xfer += ret;
+    if (name) g_free (name);
+    name = NULL;
+
+    /* break if we get a STOP field */
+    if (ftype == T_STOP)
+    {
+      break;
+    }
+
+    switch (fid)
+    {
+      case 1:
+        if (ftype == T_STRING)
+        {
+          if (this_object->rd != NULL)
+          {
+            g_free(this_object->rd);
+            this_object->rd = NULL;
+          }
+
+          if ((ret = thrift_protocol_read_string (protocol, &this_object->rd, error)) < 0)
+            return -1;
+          xfer += ret;
+          this_object->__isset_rd = TRUE;
+        } else {
+          if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
+            return -1;
+          xfer += ret;
+        }
+        break;
+      case 2:
+        if (ftype == T_LIST)
+        {
+          {
+            guint32 size;
+            guint32 i;
+            ThriftType element_type;
+
+            if ((ret = thrift_protocol_read_list_begin (protocol, &element_type,&size, error)) < 0)
+              return -1;
+            xfer += ret;
+
+            /* iterate through list elements */
+            for (i = 0; i < size; i++)
+            {
+              gchar * _elem2 = NULL;
+              if (_elem2 != NULL)
+              {
+                g_free(_elem2);
+                _elem2 = NULL;
+              }
+
+              if ((ret = thrift_protocol_read_string (protocol, &_elem2, error)) < 0)
+                return -1;
+              xfer += ret;
+              g_ptr_array_add (this_object->irts, _elem2);
+            }
+            if ((ret = thrift_protocol_read_list_end (protocol, error)) < 0)
+              return -1;
+            xfer += ret;
+          }
+          this_object->__isset_irts = TRUE;
+        } else {
+          if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
+            return -1;
+          xfer += ret;
+        }
+        break;
+      case 3:
+        if (ftype == T_LIST)
+        {
+          {
+            guint32 size;
+            guint32 i;
+            ThriftType element_type;
+
+            if ((ret = thrift_protocol_read_list_begin (protocol, &element_type,&size, error)) < 0)
+              return -1;
+            xfer += ret;
+
+            /* iterate through list elements */
+            for (i = 0; i < size; i++)
+            {
+              gchar * _elem3 = NULL;
+              if (_elem3 != NULL)
+              {
+                g_free(_elem3);
+                _elem3 = NULL;
+              }
+
+              if ((ret = thrift_protocol_read_string (protocol, &_elem3, error)) < 0)
+                return -1;
+              xfer += ret;
+              g_ptr_array_add (this_object->erts, _elem3);
+            }
+            if ((ret = thrift_protocol_read_list_end (protocol, error)) < 0)
+              return -1;
+            xfer += ret;
+          }
+          this_object->__isset_erts = TRUE;
+        } else {
+          if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
+            return -1;
+          xfer += ret;
+        }
+        break;
+      default:
+        if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
+          return -1;
+        xfer += ret;
+        break;
+    }
+    if ((ret = thrift_protocol_read_field_end (protocol, error)) < 0)
+      return -1;
+    xfer += ret;
+  }
+
+  if ((ret = thrift_protocol_read_struct_end (protocol, error)) < 0)
+    return -1;
+  xfer += ret;
+
+  return xfer;
+}
+
+static gint32
+bgp_configurator_add_vrf_args_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+{
+  gint32 ret;
+  gint32 xfer = 0;
+
+  BgpConfiguratorAddVrfArgs * this_object = BGP_CONFIGURATOR_ADD_VRF_ARGS(object);
+  THRIFT_UNUSED_VAR (this_object);
+  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorAddVrfArgs", error)) < 0)
+    return -1;
+  xfer += ret;
+  if ((ret = thrift_protocol_write_field_begin (protocol, "rd", T_STRING, 1, error)) < 0)
+    return -1;
+  xfer += ret;
+  if ((ret = thrift_protocol_write_string (protocol, this_object->rd, error)) < 0)
+    return -1;
+  xfer += ret;
+
+  if ((ret = thrift_protocol_write_field_end (protocol, error)) < 0)
+    return -1;
+  xfer += ret;
+  if ((ret = thrift_protocol_write_field_begin (protocol, "irts", T_LIST, 2, error)) < 0)
+    return -1;
+  xfer += ret;
+  {
+    guint i4;
+
+    if ((ret = thrift_protocol_write_list_begin (protocol, T_STRING, (gint32) (this_object->irts ? this_object->irts->len : 0), error)) < 0)
+      return -1;
+    xfer += ret;
+    for (i4 = 0; i4 < (this_object->irts ? this_object->irts->len : 0); i4++)
+    {
+      if ((ret = thrift_protocol_write_string (protocol, ((gchar*)g_ptr_array_index ((GPtrArray *) this_object->irts, i4)), error)) < 0)
+        return -1;
+      xfer += ret;
+
+    }
+    if ((ret = thrift_protocol_write_list_end (protocol, error)) < 0)
+      return -1;
+    xfer += ret;
+  }
+  if ((ret = thrift_protocol_write_field_end (protocol, error)) < 0)
+    return -1;
+  xfer += ret;
+  if ((ret = thrift_protocol_write_field_begin (protocol, "erts", T_LIST, 3, error)) < 0)
+    return -1;
+  xfer += ret;
+  {
+    guint i5;
+
+    if ((ret = thrift_protocol_write_list_begin (protocol, T_STRING, (gint32) (this_object->erts ? this_object->erts->len : 0), error)) < 0)
+      return -1;
+    xfer += ret;
+    for (i5 = 0; i5 < (this_object->erts ? this_object->erts->len : 0); i5++)
+    {
+      if ((ret = thrift_protocol_write_string (protocol, ((gchar*)g_ptr_array_index ((GPtrArray *) this_object->erts, i5)), error)) < 0)
+        return -1;
+      xfer += ret;
+
+    }
+    if ((ret = thrift_protocol_write_list_end (protocol, error)) < 0)
+      return -1;
+    xfer += ret;
+  }
+  if ((ret = thrift_protocol_write_field_end (protocol, error)) < 0)
+    return -1;
+  xfer += ret;
+  if ((ret = thrift_protocol_write_field_stop (protocol, error)) < 0)
+    return -1;
+  xfer += ret;
+  if ((ret = thrift_protocol_write_struct_end (protocol, error)) < 0)
+    return -1;
+  xfer += ret;
+
+  return xfer;
+}
+
+static void
+bgp_configurator_add_vrf_args_set_property (GObject *object,
+                                            guint property_id,
+                                            const GValue *value,
+                                            GParamSpec *pspec)
+{
+  BgpConfiguratorAddVrfArgs *self = BGP_CONFIGURATOR_ADD_VRF_ARGS (object);
+
+  switch (property_id)
+  {
+    case PROP_BGP_CONFIGURATOR_ADD_VRF_ARGS_RD:
+      if (self->rd != NULL)
+        g_free (self->rd);
+      self->rd = g_value_dup_string (value);
+      self->__isset_rd = TRUE;
+      break;
+
+    case PROP_BGP_CONFIGURATOR_ADD_VRF_ARGS_IRTS:
+      if (self->irts != NULL)
+        g_ptr_array_unref (self->irts);
+      self->irts = g_value_dup_boxed (value);
+      self->__isset_irts = TRUE;
+      break;
+
+    case PROP_BGP_CONFIGURATOR_ADD_VRF_ARGS_ERTS:
+      if (self->erts != NULL)
+        g_ptr_array_unref (self->erts);
+      self->erts = g_value_dup_boxed (value);
+      self->__isset_erts = TRUE;
+      break;
+
+    default:
+      G_OBJECT_WARN_INVALID_PROPERTY_ID (object, property_id, pspec);
+      break;
+  }
+}
+
+static void
+bgp_configurator_add_vrf_args_get_property (GObject *object,
+                                            guint property_id,
+                                            GValue *value,
+                                            GParamSpec *pspec)
+{
+  BgpConfiguratorAddVrfArgs *self = BGP_CONFIGURATOR_ADD_VRF_ARGS (object);
+
+  switch (property_id)
+  {
+    case PROP_BGP_CONFIGURATOR_ADD_VRF_ARGS_RD:
+      g_value_set_string (value, self->rd);
+      break;
+
+    case PROP_BGP_CONFIGURATOR_ADD_VRF_ARGS_IRTS:
+      g_value_set_boxed (value, self->irts);
+      break;
+
+    case PROP_BGP_CONFIGURATOR_ADD_VRF_ARGS_ERTS:
+      g_value_set_boxed (value, self->erts);
+      break;
+
+    default:
+      G_OBJECT_WARN_INVALID_PROPERTY_ID (object, property_id, pspec);
+      break;
+  }
+}
+
+static void 
+bgp_configurator_add_vrf_args_instance_init (BgpConfiguratorAddVrfArgs * object)
+{
+  /* satisfy -Wall */
+  THRIFT_UNUSED_VAR (object);
+  object->rd = NULL;
+  object->__isset_rd = FALSE;
+  object->irts = g_ptr_array_new_with_free_func (g_free);
+  object->__isset_irts = FALSE;
+  object->erts = g_ptr_array_new_with_free_func (g_free);
+  object->__isset_erts = FALSE;
+}
+
+static void 
+bgp_configurator_add_vrf_args_finalize (GObject *object)
+{
+  BgpConfiguratorAddVrfArgs *tobject = BGP_CONFIGURATOR_ADD_VRF_ARGS (object);
+
+  /* satisfy -Wall in case we don't use tobject */
+  THRIFT_UNUSED_VAR (tobject);
+  if (tobject->rd != NULL)
+  {
+    g_free(tobject->rd);
+    tobject->rd = NULL;
+  }
+  if (tobject->irts != NULL)
+  {
+    g_ptr_array_unref (tobject->irts);
+    tobject->irts = NULL;
+  }
+  if (tobject->erts != NULL)
+  {
+    g_ptr_array_unref (tobject->erts);
+    tobject->erts = NULL;
+  }
+}
+
+static void
+bgp_configurator_add_vrf_args_class_init (BgpConfiguratorAddVrfArgsClass * cls)
+{
+  GObjectClass *gobject_class = G_OBJECT_CLASS (cls);
+  ThriftStructClass *struct_class = THRIFT_STRUCT_CLASS (cls);
+
+  struct_class->read = bgp_configurator_add_vrf_args_read;
+  struct_class->write = bgp_configurator_add_vrf_args_write;
+
+  gobject_class->finalize = bgp_configurator_add_vrf_args_finalize;
+  gobject_class->get_property = bgp_configurator_add_vrf_args_get_property;
+  gobject_class->set_property = bgp_configurator_add_vrf_args_set_property;
+
+  g_object_class_install_property
+    (gobject_class,
+     PROP_BGP_CONFIGURATOR_ADD_VRF_ARGS_RD,
+     g_param_spec_string ("rd",
                           NULL,
                           NULL,
                           NULL,
@@ -1379,60 +4929,25 @@ bgp_configurator_start_bgp_args_class_init (BgpConfiguratorStartBgpArgsClass * c
 
   g_object_class_install_property
     (gobject_class,
-     PROP_BGP_CONFIGURATOR_START_BGP_ARGS_PORT,
-     g_param_spec_int ("port",
-                       NULL,
-                       NULL,
-                       G_MININT32,
-                       G_MAXINT32,
-                       0,
-                       G_PARAM_READWRITE));
-
-  g_object_class_install_property
-    (gobject_class,
-     PROP_BGP_CONFIGURATOR_START_BGP_ARGS_HOLD_TIME,
-     g_param_spec_int ("holdTime",
-                       NULL,
-                       NULL,
-                       G_MININT32,
-                       G_MAXINT32,
-                       0,
-                       G_PARAM_READWRITE));
-
-  g_object_class_install_property
-    (gobject_class,
-     PROP_BGP_CONFIGURATOR_START_BGP_ARGS_KEEP_ALIVE_TIME,
-     g_param_spec_int ("keepAliveTime",
-                       NULL,
-                       NULL,
-                       G_MININT32,
-                       G_MAXINT32,
-                       0,
-                       G_PARAM_READWRITE));
-
-  g_object_class_install_property
-    (gobject_class,
-     PROP_BGP_CONFIGURATOR_START_BGP_ARGS_STALEPATH_TIME,
-     g_param_spec_int ("stalepathTime",
-                       NULL,
-                       NULL,
-                       G_MININT32,
-                       G_MAXINT32,
-                       0,
-                       G_PARAM_READWRITE));
+     PROP_BGP_CONFIGURATOR_ADD_VRF_ARGS_IRTS,
+     g_param_spec_boxed ("irts",
+                         NULL,
+                         NULL,
+                         G_TYPE_PTR_ARRAY,
+                         G_PARAM_READWRITE));
 
   g_object_class_install_property
     (gobject_class,
-     PROP_BGP_CONFIGURATOR_START_BGP_ARGS_ANNOUNCE_FBIT,
-     g_param_spec_boolean ("announceFbit",
-                           NULL,
-                           NULL,
-                           FALSE,
-                           G_PARAM_READWRITE));
+     PROP_BGP_CONFIGURATOR_ADD_VRF_ARGS_ERTS,
+     g_param_spec_boxed ("erts",
+                         NULL,
+                         NULL,
+                         G_TYPE_PTR_ARRAY,
+                         G_PARAM_READWRITE));
 }
 
 GType
-bgp_configurator_start_bgp_args_get_type (void)
+bgp_configurator_add_vrf_args_get_type (void)
 {
   static GType type = 0;
 
@@ -1440,35 +4955,35 @@ bgp_configurator_start_bgp_args_get_type (void)
   {
     static const GTypeInfo type_info = 
     {
-      sizeof (BgpConfiguratorStartBgpArgsClass),
+      sizeof (BgpConfiguratorAddVrfArgsClass),
       NULL, /* base_init */
       NULL, /* base_finalize */
-      (GClassInitFunc) bgp_configurator_start_bgp_args_class_init,
+      (GClassInitFunc) bgp_configurator_add_vrf_args_class_init,
       NULL, /* class_finalize */
       NULL, /* class_data */
-      sizeof (BgpConfiguratorStartBgpArgs),
+      sizeof (BgpConfiguratorAddVrfArgs),
       0, /* n_preallocs */
-      (GInstanceInitFunc) bgp_configurator_start_bgp_args_instance_init,
+      (GInstanceInitFunc) bgp_configurator_add_vrf_args_instance_init,
       NULL, /* value_table */
     };
 
     type = g_type_register_static (THRIFT_TYPE_STRUCT, 
-                                   "BgpConfiguratorStartBgpArgsType",
+                                   "BgpConfiguratorAddVrfArgsType",
                                    &type_info, 0);
   }
 
   return type;
 }
 
-enum _BgpConfiguratorStartBgpResultProperties
+enum _BgpConfiguratorAddVrfResultProperties
 {
-  PROP_BGP_CONFIGURATOR_START_BGP_RESULT_0,
-  PROP_BGP_CONFIGURATOR_START_BGP_RESULT_SUCCESS
+  PROP_BGP_CONFIGURATOR_ADD_VRF_RESULT_0,
+  PROP_BGP_CONFIGURATOR_ADD_VRF_RESULT_SUCCESS
 };
 
-/* reads a bgp_configurator_start_bgp_result object */
+/* reads a bgp_configurator_add_vrf_result object */
 static gint32
-bgp_configurator_start_bgp_result_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+bgp_configurator_add_vrf_result_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
 {
   gint32 ret;
   gint32 xfer = 0;
@@ -1477,7 +4992,7 @@ bgp_configurator_start_bgp_result_read (ThriftStruct *object, ThriftProtocol *pr
   gint16 fid;
   guint32 len = 0;
   gpointer data = NULL;
-  BgpConfiguratorStartBgpResult * this_object = BGP_CONFIGURATOR_START_BGP_RESULT(object);
+  BgpConfiguratorAddVrfResult * this_object = BGP_CONFIGURATOR_ADD_VRF_RESULT(object);
 
   /* satisfy -Wall in case these aren't used */
   THRIFT_UNUSED_VAR (len);
@@ -1547,14 +5062,14 @@ bgp_configurator_start_bgp_result_read (ThriftStruct *object, ThriftProtocol *pr
 }
 
 static gint32
-bgp_configurator_start_bgp_result_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+bgp_configurator_add_vrf_result_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
 {
   gint32 ret;
   gint32 xfer = 0;
 
-  BgpConfiguratorStartBgpResult * this_object = BGP_CONFIGURATOR_START_BGP_RESULT(object);
+  BgpConfiguratorAddVrfResult * this_object = BGP_CONFIGURATOR_ADD_VRF_RESULT(object);
   THRIFT_UNUSED_VAR (this_object);
-  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorStartBgpResult", error)) < 0)
+  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorAddVrfResult", error)) < 0)
     return -1;
   xfer += ret;
   if (this_object->__isset_success == TRUE) {
@@ -1580,16 +5095,16 @@ bgp_configurator_start_bgp_result_write (ThriftStruct *object, ThriftProtocol *p
 }
 
 static void
-bgp_configurator_start_bgp_result_set_property (GObject *object,
-                                                guint property_id,
-                                                const GValue *value,
-                                                GParamSpec *pspec)
+bgp_configurator_add_vrf_result_set_property (GObject *object,
+                                              guint property_id,
+                                              const GValue *value,
+                                              GParamSpec *pspec)
 {
-  BgpConfiguratorStartBgpResult *self = BGP_CONFIGURATOR_START_BGP_RESULT (object);
+  BgpConfiguratorAddVrfResult *self = BGP_CONFIGURATOR_ADD_VRF_RESULT (object);
 
   switch (property_id)
   {
-    case PROP_BGP_CONFIGURATOR_START_BGP_RESULT_SUCCESS:
+    case PROP_BGP_CONFIGURATOR_ADD_VRF_RESULT_SUCCESS:
       self->success = g_value_get_int (value);
       self->__isset_success = TRUE;
       break;
@@ -1601,16 +5116,16 @@ bgp_configurator_start_bgp_result_set_property (GObject *object,
 }
 
 static void
-bgp_configurator_start_bgp_result_get_property (GObject *object,
-                                                guint property_id,
-                                                GValue *value,
-                                                GParamSpec *pspec)
+bgp_configurator_add_vrf_result_get_property (GObject *object,
+                                              guint property_id,
+                                              GValue *value,
+                                              GParamSpec *pspec)
 {
-  BgpConfiguratorStartBgpResult *self = BGP_CONFIGURATOR_START_BGP_RESULT (object);
+  BgpConfiguratorAddVrfResult *self = BGP_CONFIGURATOR_ADD_VRF_RESULT (object);
 
   switch (property_id)
   {
-    case PROP_BGP_CONFIGURATOR_START_BGP_RESULT_SUCCESS:
+    case PROP_BGP_CONFIGURATOR_ADD_VRF_RESULT_SUCCESS:
       g_value_set_int (value, self->success);
       break;
 
@@ -1621,7 +5136,7 @@ bgp_configurator_start_bgp_result_get_property (GObject *object,
 }
 
 static void 
-bgp_configurator_start_bgp_result_instance_init (BgpConfiguratorStartBgpResult * object)
+bgp_configurator_add_vrf_result_instance_init (BgpConfiguratorAddVrfResult * object)
 {
   /* satisfy -Wall */
   THRIFT_UNUSED_VAR (object);
@@ -1630,30 +5145,30 @@ bgp_configurator_start_bgp_result_instance_init (BgpConfiguratorStartBgpResult *
 }
 
 static void 
-bgp_configurator_start_bgp_result_finalize (GObject *object)
+bgp_configurator_add_vrf_result_finalize (GObject *object)
 {
-  BgpConfiguratorStartBgpResult *tobject = BGP_CONFIGURATOR_START_BGP_RESULT (object);
+  BgpConfiguratorAddVrfResult *tobject = BGP_CONFIGURATOR_ADD_VRF_RESULT (object);
 
   /* satisfy -Wall in case we don't use tobject */
   THRIFT_UNUSED_VAR (tobject);
 }
 
 static void
-bgp_configurator_start_bgp_result_class_init (BgpConfiguratorStartBgpResultClass * cls)
+bgp_configurator_add_vrf_result_class_init (BgpConfiguratorAddVrfResultClass * cls)
 {
   GObjectClass *gobject_class = G_OBJECT_CLASS (cls);
   ThriftStructClass *struct_class = THRIFT_STRUCT_CLASS (cls);
 
-  struct_class->read = bgp_configurator_start_bgp_result_read;
-  struct_class->write = bgp_configurator_start_bgp_result_write;
+  struct_class->read = bgp_configurator_add_vrf_result_read;
+  struct_class->write = bgp_configurator_add_vrf_result_write;
 
-  gobject_class->finalize = bgp_configurator_start_bgp_result_finalize;
-  gobject_class->get_property = bgp_configurator_start_bgp_result_get_property;
-  gobject_class->set_property = bgp_configurator_start_bgp_result_set_property;
+  gobject_class->finalize = bgp_configurator_add_vrf_result_finalize;
+  gobject_class->get_property = bgp_configurator_add_vrf_result_get_property;
+  gobject_class->set_property = bgp_configurator_add_vrf_result_set_property;
 
   g_object_class_install_property
     (gobject_class,
-     PROP_BGP_CONFIGURATOR_START_BGP_RESULT_SUCCESS,
+     PROP_BGP_CONFIGURATOR_ADD_VRF_RESULT_SUCCESS,
      g_param_spec_int ("success",
                        NULL,
                        NULL,
@@ -1664,7 +5179,7 @@ bgp_configurator_start_bgp_result_class_init (BgpConfiguratorStartBgpResultClass
 }
 
 GType
-bgp_configurator_start_bgp_result_get_type (void)
+bgp_configurator_add_vrf_result_get_type (void)
 {
   static GType type = 0;
 
@@ -1672,35 +5187,35 @@ bgp_configurator_start_bgp_result_get_type (void)
   {
     static const GTypeInfo type_info = 
     {
-      sizeof (BgpConfiguratorStartBgpResultClass),
+      sizeof (BgpConfiguratorAddVrfResultClass),
       NULL, /* base_init */
       NULL, /* base_finalize */
-      (GClassInitFunc) bgp_configurator_start_bgp_result_class_init,
+      (GClassInitFunc) bgp_configurator_add_vrf_result_class_init,
       NULL, /* class_finalize */
       NULL, /* class_data */
-      sizeof (BgpConfiguratorStartBgpResult),
+      sizeof (BgpConfiguratorAddVrfResult),
       0, /* n_preallocs */
-      (GInstanceInitFunc) bgp_configurator_start_bgp_result_instance_init,
+      (GInstanceInitFunc) bgp_configurator_add_vrf_result_instance_init,
       NULL, /* value_table */
     };
 
     type = g_type_register_static (THRIFT_TYPE_STRUCT, 
-                                   "BgpConfiguratorStartBgpResultType",
+                                   "BgpConfiguratorAddVrfResultType",
                                    &type_info, 0);
   }
 
   return type;
 }
 
-enum _BgpConfiguratorStopBgpArgsProperties
+enum _BgpConfiguratorDelVrfArgsProperties
 {
-  PROP_BGP_CONFIGURATOR_STOP_BGP_ARGS_0,
-  PROP_BGP_CONFIGURATOR_STOP_BGP_ARGS_AS_NUMBER
+  PROP_BGP_CONFIGURATOR_DEL_VRF_ARGS_0,
+  PROP_BGP_CONFIGURATOR_DEL_VRF_ARGS_RD
 };
 
-/* reads a bgp_configurator_stop_bgp_args object */
+/* reads a bgp_configurator_del_vrf_args object */
 static gint32
-bgp_configurator_stop_bgp_args_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+bgp_configurator_del_vrf_args_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
 {
   gint32 ret;
   gint32 xfer = 0;
@@ -1709,7 +5224,7 @@ bgp_configurator_stop_bgp_args_read (ThriftStruct *object, ThriftProtocol *proto
   gint16 fid;
   guint32 len = 0;
   gpointer data = NULL;
-  BgpConfiguratorStopBgpArgs * this_object = BGP_CONFIGURATOR_STOP_BGP_ARGS(object);
+  BgpConfiguratorDelVrfArgs * this_object = BGP_CONFIGURATOR_DEL_VRF_ARGS(object);
 
   /* satisfy -Wall in case these aren't used */
   THRIFT_UNUSED_VAR (len);
@@ -1748,12 +5263,18 @@ bgp_configurator_stop_bgp_args_read (ThriftStruct *object, ThriftProtocol *proto
     switch (fid)
     {
       case 1:
-        if (ftype == T_I64)
+        if (ftype == T_STRING)
         {
-          if ((ret = thrift_protocol_read_i64 (protocol, &this_object->asNumber, error)) < 0)
+          if (this_object->rd != NULL)
+          {
+            g_free(this_object->rd);
+            this_object->rd = NULL;
+          }
+
+          if ((ret = thrift_protocol_read_string (protocol, &this_object->rd, error)) < 0)
             return -1;
           xfer += ret;
-          this_object->__isset_asNumber = TRUE;
+          this_object->__isset_rd = TRUE;
         } else {
           if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
             return -1;
@@ -1779,20 +5300,20 @@ bgp_configurator_stop_bgp_args_read (ThriftStruct *object, ThriftProtocol *proto
 }
 
 static gint32
-bgp_configurator_stop_bgp_args_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+bgp_configurator_del_vrf_args_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
 {
   gint32 ret;
   gint32 xfer = 0;
 
-  BgpConfiguratorStopBgpArgs * this_object = BGP_CONFIGURATOR_STOP_BGP_ARGS(object);
+  BgpConfiguratorDelVrfArgs * this_object = BGP_CONFIGURATOR_DEL_VRF_ARGS(object);
   THRIFT_UNUSED_VAR (this_object);
-  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorStopBgpArgs", error)) < 0)
+  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorDelVrfArgs", error)) < 0)
     return -1;
   xfer += ret;
-  if ((ret = thrift_protocol_write_field_begin (protocol, "asNumber", T_I64, 1, error)) < 0)
+  if ((ret = thrift_protocol_write_field_begin (protocol, "rd", T_STRING, 1, error)) < 0)
     return -1;
   xfer += ret;
-  if ((ret = thrift_protocol_write_i64 (protocol, this_object->asNumber, error)) < 0)
+  if ((ret = thrift_protocol_write_string (protocol, this_object->rd, error)) < 0)
     return -1;
   xfer += ret;
 
@@ -1810,18 +5331,20 @@ bgp_configurator_stop_bgp_args_write (ThriftStruct *object, ThriftProtocol *prot
 }
 
 static void
-bgp_configurator_stop_bgp_args_set_property (GObject *object,
-                                             guint property_id,
-                                             const GValue *value,
-                                             GParamSpec *pspec)
+bgp_configurator_del_vrf_args_set_property (GObject *object,
+                                            guint property_id,
+                                            const GValue *value,
+                                            GParamSpec *pspec)
 {
-  BgpConfiguratorStopBgpArgs *self = BGP_CONFIGURATOR_STOP_BGP_ARGS (object);
+  BgpConfiguratorDelVrfArgs *self = BGP_CONFIGURATOR_DEL_VRF_ARGS (object);
 
   switch (property_id)
   {
-    case PROP_BGP_CONFIGURATOR_STOP_BGP_ARGS_AS_NUMBER:
-      self->asNumber = g_value_get_int64 (value);
-      self->__isset_asNumber = TRUE;
+    case PROP_BGP_CONFIGURATOR_DEL_VRF_ARGS_RD:
+      if (self->rd != NULL)
+        g_free (self->rd);
+      self->rd = g_value_dup_string (value);
+      self->__isset_rd = TRUE;
       break;
 
     default:
@@ -1831,17 +5354,17 @@ bgp_configurator_stop_bgp_args_set_property (GObject *object,
 }
 
 static void
-bgp_configurator_stop_bgp_args_get_property (GObject *object,
-                                             guint property_id,
-                                             GValue *value,
-                                             GParamSpec *pspec)
+bgp_configurator_del_vrf_args_get_property (GObject *object,
+                                            guint property_id,
+                                            GValue *value,
+                                            GParamSpec *pspec)
 {
-  BgpConfiguratorStopBgpArgs *self = BGP_CONFIGURATOR_STOP_BGP_ARGS (object);
+  BgpConfiguratorDelVrfArgs *self = BGP_CONFIGURATOR_DEL_VRF_ARGS (object);
 
   switch (property_id)
   {
-    case PROP_BGP_CONFIGURATOR_STOP_BGP_ARGS_AS_NUMBER:
-      g_value_set_int64 (value, self->asNumber);
+    case PROP_BGP_CONFIGURATOR_DEL_VRF_ARGS_RD:
+      g_value_set_string (value, self->rd);
       break;
 
     default:
@@ -1851,50 +5374,53 @@ bgp_configurator_stop_bgp_args_get_property (GObject *object,
 }
 
 static void 
-bgp_configurator_stop_bgp_args_instance_init (BgpConfiguratorStopBgpArgs * object)
+bgp_configurator_del_vrf_args_instance_init (BgpConfiguratorDelVrfArgs * object)
 {
   /* satisfy -Wall */
   THRIFT_UNUSED_VAR (object);
-  object->asNumber = 0;
-  object->__isset_asNumber = FALSE;
+  object->rd = NULL;
+  object->__isset_rd = FALSE;
 }
 
 static void 
-bgp_configurator_stop_bgp_args_finalize (GObject *object)
+bgp_configurator_del_vrf_args_finalize (GObject *object)
 {
-  BgpConfiguratorStopBgpArgs *tobject = BGP_CONFIGURATOR_STOP_BGP_ARGS (object);
+  BgpConfiguratorDelVrfArgs *tobject = BGP_CONFIGURATOR_DEL_VRF_ARGS (object);
 
   /* satisfy -Wall in case we don't use tobject */
   THRIFT_UNUSED_VAR (tobject);
+  if (tobject->rd != NULL)
+  {
+    g_free(tobject->rd);
+    tobject->rd = NULL;
+  }
 }
 
 static void
-bgp_configurator_stop_bgp_args_class_init (BgpConfiguratorStopBgpArgsClass * cls)
+bgp_configurator_del_vrf_args_class_init (BgpConfiguratorDelVrfArgsClass * cls)
 {
   GObjectClass *gobject_class = G_OBJECT_CLASS (cls);
   ThriftStructClass *struct_class = THRIFT_STRUCT_CLASS (cls);
 
-  struct_class->read = bgp_configurator_stop_bgp_args_read;
-  struct_class->write = bgp_configurator_stop_bgp_args_write;
+  struct_class->read = bgp_configurator_del_vrf_args_read;
+  struct_class->write = bgp_configurator_del_vrf_args_write;
 
-  gobject_class->finalize = bgp_configurator_stop_bgp_args_finalize;
-  gobject_class->get_property = bgp_configurator_stop_bgp_args_get_property;
-  gobject_class->set_property = bgp_configurator_stop_bgp_args_set_property;
+  gobject_class->finalize = bgp_configurator_del_vrf_args_finalize;
+  gobject_class->get_property = bgp_configurator_del_vrf_args_get_property;
+  gobject_class->set_property = bgp_configurator_del_vrf_args_set_property;
 
   g_object_class_install_property
     (gobject_class,
-     PROP_BGP_CONFIGURATOR_STOP_BGP_ARGS_AS_NUMBER,
-     g_param_spec_int64 ("asNumber",
-                         NULL,
-                         NULL,
-                         G_MININT64,
-                         G_MAXINT64,
-                         0,
-                         G_PARAM_READWRITE));
+     PROP_BGP_CONFIGURATOR_DEL_VRF_ARGS_RD,
+     g_param_spec_string ("rd",
+                          NULL,
+                          NULL,
+                          NULL,
+                          G_PARAM_READWRITE));
 }
 
 GType
-bgp_configurator_stop_bgp_args_get_type (void)
+bgp_configurator_del_vrf_args_get_type (void)
 {
   static GType type = 0;
 
@@ -1902,35 +5428,35 @@ bgp_configurator_stop_bgp_args_get_type (void)
   {
     static const GTypeInfo type_info = 
     {
-      sizeof (BgpConfiguratorStopBgpArgsClass),
+      sizeof (BgpConfiguratorDelVrfArgsClass),
       NULL, /* base_init */
       NULL, /* base_finalize */
-      (GClassInitFunc) bgp_configurator_stop_bgp_args_class_init,
+      (GClassInitFunc) bgp_configurator_del_vrf_args_class_init,
       NULL, /* class_finalize */
       NULL, /* class_data */
-      sizeof (BgpConfiguratorStopBgpArgs),
+      sizeof (BgpConfiguratorDelVrfArgs),
       0, /* n_preallocs */
-      (GInstanceInitFunc) bgp_configurator_stop_bgp_args_instance_init,
+      (GInstanceInitFunc) bgp_configurator_del_vrf_args_instance_init,
       NULL, /* value_table */
     };
 
     type = g_type_register_static (THRIFT_TYPE_STRUCT, 
-                                   "BgpConfiguratorStopBgpArgsType",
+                                   "BgpConfiguratorDelVrfArgsType",
                                    &type_info, 0);
   }
 
   return type;
 }
 
-enum _BgpConfiguratorStopBgpResultProperties
+enum _BgpConfiguratorDelVrfResultProperties
 {
-  PROP_BGP_CONFIGURATOR_STOP_BGP_RESULT_0,
-  PROP_BGP_CONFIGURATOR_STOP_BGP_RESULT_SUCCESS
+  PROP_BGP_CONFIGURATOR_DEL_VRF_RESULT_0,
+  PROP_BGP_CONFIGURATOR_DEL_VRF_RESULT_SUCCESS
 };
 
-/* reads a bgp_configurator_stop_bgp_result object */
+/* reads a bgp_configurator_del_vrf_result object */
 static gint32
-bgp_configurator_stop_bgp_result_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+bgp_configurator_del_vrf_result_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
 {
   gint32 ret;
   gint32 xfer = 0;
@@ -1939,7 +5465,7 @@ bgp_configurator_stop_bgp_result_read (ThriftStruct *object, ThriftProtocol *pro
   gint16 fid;
   guint32 len = 0;
   gpointer data = NULL;
-  BgpConfiguratorStopBgpResult * this_object = BGP_CONFIGURATOR_STOP_BGP_RESULT(object);
+  BgpConfiguratorDelVrfResult * this_object = BGP_CONFIGURATOR_DEL_VRF_RESULT(object);
 
   /* satisfy -Wall in case these aren't used */
   THRIFT_UNUSED_VAR (len);
@@ -2009,14 +5535,14 @@ bgp_configurator_stop_bgp_result_read (ThriftStruct *object, ThriftProtocol *pro
 }
 
 static gint32
-bgp_configurator_stop_bgp_result_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+bgp_configurator_del_vrf_result_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
 {
   gint32 ret;
   gint32 xfer = 0;
 
-  BgpConfiguratorStopBgpResult * this_object = BGP_CONFIGURATOR_STOP_BGP_RESULT(object);
+  BgpConfiguratorDelVrfResult * this_object = BGP_CONFIGURATOR_DEL_VRF_RESULT(object);
   THRIFT_UNUSED_VAR (this_object);
-  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorStopBgpResult", error)) < 0)
+  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorDelVrfResult", error)) < 0)
     return -1;
   xfer += ret;
   if (this_object->__isset_success == TRUE) {
@@ -2042,16 +5568,16 @@ bgp_configurator_stop_bgp_result_write (ThriftStruct *object, ThriftProtocol *pr
 }
 
 static void
-bgp_configurator_stop_bgp_result_set_property (GObject *object,
-                                               guint property_id,
-                                               const GValue *value,
-                                               GParamSpec *pspec)
+bgp_configurator_del_vrf_result_set_property (GObject *object,
+                                              guint property_id,
+                                              const GValue *value,
+                                              GParamSpec *pspec)
 {
-  BgpConfiguratorStopBgpResult *self = BGP_CONFIGURATOR_STOP_BGP_RESULT (object);
+  BgpConfiguratorDelVrfResult *self = BGP_CONFIGURATOR_DEL_VRF_RESULT (object);
 
   switch (property_id)
   {
-    case PROP_BGP_CONFIGURATOR_STOP_BGP_RESULT_SUCCESS:
+    case PROP_BGP_CONFIGURATOR_DEL_VRF_RESULT_SUCCESS:
       self->success = g_value_get_int (value);
       self->__isset_success = TRUE;
       break;
@@ -2063,16 +5589,16 @@ bgp_configurator_stop_bgp_result_set_property (GObject *object,
 }
 
 static void
-bgp_configurator_stop_bgp_result_get_property (GObject *object,
-                                               guint property_id,
-                                               GValue *value,
-                                               GParamSpec *pspec)
+bgp_configurator_del_vrf_result_get_property (GObject *object,
+                                              guint property_id,
+                                              GValue *value,
+                                              GParamSpec *pspec)
 {
-  BgpConfiguratorStopBgpResult *self = BGP_CONFIGURATOR_STOP_BGP_RESULT (object);
+  BgpConfiguratorDelVrfResult *self = BGP_CONFIGURATOR_DEL_VRF_RESULT (object);
 
   switch (property_id)
   {
-    case PROP_BGP_CONFIGURATOR_STOP_BGP_RESULT_SUCCESS:
+    case PROP_BGP_CONFIGURATOR_DEL_VRF_RESULT_SUCCESS:
       g_value_set_int (value, self->success);
       break;
 
@@ -2083,7 +5609,7 @@ bgp_configurator_stop_bgp_result_get_property (GObject *object,
 }
 
 static void 
-bgp_configurator_stop_bgp_result_instance_init (BgpConfiguratorStopBgpResult * object)
+bgp_configurator_del_vrf_result_instance_init (BgpConfiguratorDelVrfResult * object)
 {
   /* satisfy -Wall */
   THRIFT_UNUSED_VAR (object);
@@ -2092,30 +5618,30 @@ bgp_configurator_stop_bgp_result_instance_init (BgpConfiguratorStopBgpResult * o
 }
 
 static void 
-bgp_configurator_stop_bgp_result_finalize (GObject *object)
+bgp_configurator_del_vrf_result_finalize (GObject *object)
 {
-  BgpConfiguratorStopBgpResult *tobject = BGP_CONFIGURATOR_STOP_BGP_RESULT (object);
+  BgpConfiguratorDelVrfResult *tobject = BGP_CONFIGURATOR_DEL_VRF_RESULT (object);
 
   /* satisfy -Wall in case we don't use tobject */
   THRIFT_UNUSED_VAR (tobject);
 }
 
 static void
-bgp_configurator_stop_bgp_result_class_init (BgpConfiguratorStopBgpResultClass * cls)
+bgp_configurator_del_vrf_result_class_init (BgpConfiguratorDelVrfResultClass * cls)
 {
   GObjectClass *gobject_class = G_OBJECT_CLASS (cls);
   ThriftStructClass *struct_class = THRIFT_STRUCT_CLASS (cls);
 
-  struct_class->read = bgp_configurator_stop_bgp_result_read;
-  struct_class->write = bgp_configurator_stop_bgp_result_write;
+  struct_class->read = bgp_configurator_del_vrf_result_read;
+  struct_class->write = bgp_configurator_del_vrf_result_write;
 
-  gobject_class->finalize = bgp_configurator_stop_bgp_result_finalize;
-  gobject_class->get_property = bgp_configurator_stop_bgp_result_get_property;
-  gobject_class->set_property = bgp_configurator_stop_bgp_result_set_property;
+  gobject_class->finalize = bgp_configurator_del_vrf_result_finalize;
+  gobject_class->get_property = bgp_configurator_del_vrf_result_get_property;
+  gobject_class->set_property = bgp_configurator_del_vrf_result_set_property;
 
   g_object_class_install_property
     (gobject_class,
-     PROP_BGP_CONFIGURATOR_STOP_BGP_RESULT_SUCCESS,
+     PROP_BGP_CONFIGURATOR_DEL_VRF_RESULT_SUCCESS,
      g_param_spec_int ("success",
                        NULL,
                        NULL,
@@ -2126,7 +5652,7 @@ bgp_configurator_stop_bgp_result_class_init (BgpConfiguratorStopBgpResultClass *
 }
 
 GType
-bgp_configurator_stop_bgp_result_get_type (void)
+bgp_configurator_del_vrf_result_get_type (void)
 {
   static GType type = 0;
 
@@ -2134,36 +5660,38 @@ bgp_configurator_stop_bgp_result_get_type (void)
   {
     static const GTypeInfo type_info = 
     {
-      sizeof (BgpConfiguratorStopBgpResultClass),
+      sizeof (BgpConfiguratorDelVrfResultClass),
       NULL, /* base_init */
       NULL, /* base_finalize */
-      (GClassInitFunc) bgp_configurator_stop_bgp_result_class_init,
+      (GClassInitFunc) bgp_configurator_del_vrf_result_class_init,
       NULL, /* class_finalize */
       NULL, /* class_data */
-      sizeof (BgpConfiguratorStopBgpResult),
+      sizeof (BgpConfiguratorDelVrfResult),
       0, /* n_preallocs */
-      (GInstanceInitFunc) bgp_configurator_stop_bgp_result_instance_init,
+      (GInstanceInitFunc) bgp_configurator_del_vrf_result_instance_init,
       NULL, /* value_table */
     };
 
     type = g_type_register_static (THRIFT_TYPE_STRUCT, 
-                                   "BgpConfiguratorStopBgpResultType",
+                                   "BgpConfiguratorDelVrfResultType",
                                    &type_info, 0);
   }
 
   return type;
 }
 
-enum _BgpConfiguratorCreatePeerArgsProperties
+enum _BgpConfiguratorPushRouteArgsProperties
 {
-  PROP_BGP_CONFIGURATOR_CREATE_PEER_ARGS_0,
-  PROP_BGP_CONFIGURATOR_CREATE_PEER_ARGS_IP_ADDRESS,
-  PROP_BGP_CONFIGURATOR_CREATE_PEER_ARGS_AS_NUMBER
+  PROP_BGP_CONFIGURATOR_PUSH_ROUTE_ARGS_0,
+  PROP_BGP_CONFIGURATOR_PUSH_ROUTE_ARGS_PREFIX,
+  PROP_BGP_CONFIGURATOR_PUSH_ROUTE_ARGS_NEXTHOP,
+  PROP_BGP_CONFIGURATOR_PUSH_ROUTE_ARGS_RD,
+  PROP_BGP_CONFIGURATOR_PUSH_ROUTE_ARGS_LABEL
 };
 
-/* reads a bgp_configurator_create_peer_args object */
+/* reads a bgp_configurator_push_route_args object */
 static gint32
-bgp_configurator_create_peer_args_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+bgp_configurator_push_route_args_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
 {
   gint32 ret;
   gint32 xfer = 0;
@@ -2172,7 +5700,7 @@ bgp_configurator_create_peer_args_read (ThriftStruct *object, ThriftProtocol *pr
   gint16 fid;
   guint32 len = 0;
   gpointer data = NULL;
-  BgpConfiguratorCreatePeerArgs * this_object = BGP_CONFIGURATOR_CREATE_PEER_ARGS(object);
+  BgpConfiguratorPushRouteArgs * this_object = BGP_CONFIGURATOR_PUSH_ROUTE_ARGS(object);
 
   /* satisfy -Wall in case these aren't used */
   THRIFT_UNUSED_VAR (len);
@@ -2213,16 +5741,16 @@ bgp_configurator_create_peer_args_read (ThriftStruct *object, ThriftProtocol *pr
       case 1:
         if (ftype == T_STRING)
         {
-          if (this_object->ipAddress != NULL)
+          if (this_object->prefix != NULL)
           {
-            g_free(this_object->ipAddress);
-            this_object->ipAddress = NULL;
+            g_free(this_object->prefix);
+            this_object->prefix = NULL;
           }
 
-          if ((ret = thrift_protocol_read_string (protocol, &this_object->ipAddress, error)) < 0)
+          if ((ret = thrift_protocol_read_string (protocol, &this_object->prefix, error)) < 0)
             return -1;
           xfer += ret;
-          this_object->__isset_ipAddress = TRUE;
+          this_object->__isset_prefix = TRUE;
         } else {
           if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
             return -1;
@@ -2230,12 +5758,50 @@ bgp_configurator_create_peer_args_read (ThriftStruct *object, ThriftProtocol *pr
         }
         break;
       case 2:
-        if (ftype == T_I64)
+        if (ftype == T_STRING)
         {
-          if ((ret = thrift_protocol_read_i64 (protocol, &this_object->asNumber, error)) < 0)
+          if (this_object->nexthop != NULL)
+          {
+            g_free(this_object->nexthop);
+            this_object->nexthop = NULL;
+          }
+
+          if ((ret = thrift_protocol_read_string (protocol, &this_object->nexthop, error)) < 0)
             return -1;
           xfer += ret;
-          this_object->__isset_asNumber = TRUE;
+          this_object->__isset_nexthop = TRUE;
+        } else {
+          if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
+            return -1;
+          xfer += ret;
+        }
+        break;
+      case 3:
+        if (ftype == T_STRING)
+        {
+          if (this_object->rd != NULL)
+          {
+            g_free(this_object->rd);
+            this_object->rd = NULL;
+          }
+
+          if ((ret = thrift_protocol_read_string (protocol, &this_object->rd, error)) < 0)
+            return -1;
+          xfer += ret;
+          this_object->__isset_rd = TRUE;
+        } else {
+          if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
+            return -1;
+          xfer += ret;
+        }
+        break;
+      case 4:
+        if (ftype == T_I32)
+        {
+          if ((ret = thrift_protocol_read_i32 (protocol, &this_object->label, error)) < 0)
+            return -1;
+          xfer += ret;
+          this_object->__isset_label = TRUE;
         } else {
           if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
             return -1;
@@ -2261,30 +5827,50 @@ bgp_configurator_create_peer_args_read (ThriftStruct *object, ThriftProtocol *pr
 }
 
 static gint32
-bgp_configurator_create_peer_args_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+bgp_configurator_push_route_args_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
 {
   gint32 ret;
   gint32 xfer = 0;
 
-  BgpConfiguratorCreatePeerArgs * this_object = BGP_CONFIGURATOR_CREATE_PEER_ARGS(object);
+  BgpConfiguratorPushRouteArgs * this_object = BGP_CONFIGURATOR_PUSH_ROUTE_ARGS(object);
   THRIFT_UNUSED_VAR (this_object);
-  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorCreatePeerArgs", error)) < 0)
+  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorPushRouteArgs", error)) < 0)
     return -1;
   xfer += ret;
-  if ((ret = thrift_protocol_write_field_begin (protocol, "ipAddress", T_STRING, 1, error)) < 0)
+  if ((ret = thrift_protocol_write_field_begin (protocol, "prefix", T_STRING, 1, error)) < 0)
     return -1;
   xfer += ret;
-  if ((ret = thrift_protocol_write_string (protocol, this_object->ipAddress, error)) < 0)
+  if ((ret = thrift_protocol_write_string (protocol, this_object->prefix, error)) < 0)
     return -1;
   xfer += ret;
 
   if ((ret = thrift_protocol_write_field_end (protocol, error)) < 0)
     return -1;
   xfer += ret;
-  if ((ret = thrift_protocol_write_field_begin (protocol, "asNumber", T_I64, 2, error)) < 0)
+  if ((ret = thrift_protocol_write_field_begin (protocol, "nexthop", T_STRING, 2, error)) < 0)
     return -1;
   xfer += ret;
-  if ((ret = thrift_protocol_write_i64 (protocol, this_object->asNumber, error)) < 0)
+  if ((ret = thrift_protocol_write_string (protocol, this_object->nexthop, error)) < 0)
+    return -1;
+  xfer += ret;
+
+  if ((ret = thrift_protocol_write_field_end (protocol, error)) < 0)
+    return -1;
+  xfer += ret;
+  if ((ret = thrift_protocol_write_field_begin (protocol, "rd", T_STRING, 3, error)) < 0)
+    return -1;
+  xfer += ret;
+  if ((ret = thrift_protocol_write_string (protocol, this_object->rd, error)) < 0)
+    return -1;
+  xfer += ret;
+
+  if ((ret = thrift_protocol_write_field_end (protocol, error)) < 0)
+    return -1;
+  xfer += ret;
+  if ((ret = thrift_protocol_write_field_begin (protocol, "label", T_I32, 4, error)) < 0)
+    return -1;
+  xfer += ret;
+  if ((ret = thrift_protocol_write_i32 (protocol, this_object->label, error)) < 0)
     return -1;
   xfer += ret;
 
@@ -2302,25 +5888,39 @@ bgp_configurator_create_peer_args_write (ThriftStruct *object, ThriftProtocol *p
 }
 
 static void
-bgp_configurator_create_peer_args_set_property (GObject *object,
-                                                guint property_id,
-                                                const GValue *value,
-                                                GParamSpec *pspec)
+bgp_configurator_push_route_args_set_property (GObject *object,
+                                               guint property_id,
+                                               const GValue *value,
+                                               GParamSpec *pspec)
 {
-  BgpConfiguratorCreatePeerArgs *self = BGP_CONFIGURATOR_CREATE_PEER_ARGS (object);
+  BgpConfiguratorPushRouteArgs *self = BGP_CONFIGURATOR_PUSH_ROUTE_ARGS (object);
 
   switch (property_id)
   {
-    case PROP_BGP_CONFIGURATOR_CREATE_PEER_ARGS_IP_ADDRESS:
-      if (self->ipAddress != NULL)
-        g_free (self->ipAddress);
-      self->ipAddress = g_value_dup_string (value);
-      self->__isset_ipAddress = TRUE;
+    case PROP_BGP_CONFIGURATOR_PUSH_ROUTE_ARGS_PREFIX:
+      if (self->prefix != NULL)
+        g_free (self->prefix);
+      self->prefix = g_value_dup_string (value);
+      self->__isset_prefix = TRUE;
       break;
 
-    case PROP_BGP_CONFIGURATOR_CREATE_PEER_ARGS_AS_NUMBER:
-      self->asNumber = g_value_get_int64 (value);
-      self->__isset_asNumber = TRUE;
+    case PROP_BGP_CONFIGURATOR_PUSH_ROUTE_ARGS_NEXTHOP:
+      if (self->nexthop != NULL)
+        g_free (self->nexthop);
+      self->nexthop = g_value_dup_string (value);
+      self->__isset_nexthop = TRUE;
+      break;
+
+    case PROP_BGP_CONFIGURATOR_PUSH_ROUTE_ARGS_RD:
+      if (self->rd != NULL)
+        g_free (self->rd);
+      self->rd = g_value_dup_string (value);
+      self->__isset_rd = TRUE;
+      break;
+
+    case PROP_BGP_CONFIGURATOR_PUSH_ROUTE_ARGS_LABEL:
+      self->label = g_value_get_int (value);
+      self->__isset_label = TRUE;
       break;
 
     default:
@@ -2330,21 +5930,29 @@ bgp_configurator_create_peer_args_set_property (GObject *object,
 }
 
 static void
-bgp_configurator_create_peer_args_get_property (GObject *object,
-                                                guint property_id,
-                                                GValue *value,
-                                                GParamSpec *pspec)
+bgp_configurator_push_route_args_get_property (GObject *object,
+                                               guint property_id,
+                                               GValue *value,
+                                               GParamSpec *pspec)
 {
-  BgpConfiguratorCreatePeerArgs *self = BGP_CONFIGURATOR_CREATE_PEER_ARGS (object);
+  BgpConfiguratorPushRouteArgs *self = BGP_CONFIGURATOR_PUSH_ROUTE_ARGS (object);
 
   switch (property_id)
   {
-    case PROP_BGP_CONFIGURATOR_CREATE_PEER_ARGS_IP_ADDRESS:
-      g_value_set_string (value, self->ipAddress);
+    case PROP_BGP_CONFIGURATOR_PUSH_ROUTE_ARGS_PREFIX:
+      g_value_set_string (value, self->prefix);
       break;
 
-    case PROP_BGP_CONFIGURATOR_CREATE_PEER_ARGS_AS_NUMBER:
-      g_value_set_int64 (value, self->asNumber);
+    case PROP_BGP_CONFIGURATOR_PUSH_ROUTE_ARGS_NEXTHOP:
+      g_value_set_string (value, self->nexthop);
+      break;
+
+    case PROP_BGP_CONFIGURATOR_PUSH_ROUTE_ARGS_RD:
+      g_value_set_string (value, self->rd);
+      break;
+
+    case PROP_BGP_CONFIGURATOR_PUSH_ROUTE_ARGS_LABEL:
+      g_value_set_int (value, self->label);
       break;
 
     default:
@@ -2354,47 +5962,61 @@ bgp_configurator_create_peer_args_get_property (GObject *object,
 }
 
 static void 
-bgp_configurator_create_peer_args_instance_init (BgpConfiguratorCreatePeerArgs * object)
+bgp_configurator_push_route_args_instance_init (BgpConfiguratorPushRouteArgs * object)
 {
   /* satisfy -Wall */
   THRIFT_UNUSED_VAR (object);
-  object->ipAddress = NULL;
-  object->__isset_ipAddress = FALSE;
-  object->asNumber = 0;
-  object->__isset_asNumber = FALSE;
+  object->prefix = NULL;
+  object->__isset_prefix = FALSE;
+  object->nexthop = NULL;
+  object->__isset_nexthop = FALSE;
+  object->rd = NULL;
+  object->__isset_rd = FALSE;
+  object->label = 0;
+  object->__isset_label = FALSE;
 }
 
 static void 
-bgp_configurator_create_peer_args_finalize (GObject *object)
+bgp_configurator_push_route_args_finalize (GObject *object)
 {
-  BgpConfiguratorCreatePeerArgs *tobject = BGP_CONFIGURATOR_CREATE_PEER_ARGS (object);
+  BgpConfiguratorPushRouteArgs *tobject = BGP_CONFIGURATOR_PUSH_ROUTE_ARGS (object);
 
   /* satisfy -Wall in case we don't use tobject */
   THRIFT_UNUSED_VAR (tobject);
-  if (tobject->ipAddress != NULL)
+  if (tobject->prefix != NULL)
   {
-    g_free(tobject->ipAddress);
-    tobject->ipAddress = NULL;
+    g_free(tobject->prefix);
+    tobject->prefix = NULL;
+  }
+  if (tobject->nexthop != NULL)
+  {
+    g_free(tobject->nexthop);
+    tobject->nexthop = NULL;
+  }
+  if (tobject->rd != NULL)
+  {
+    g_free(tobject->rd);
+    tobject->rd = NULL;
   }
 }
 
 static void
-bgp_configurator_create_peer_args_class_init (BgpConfiguratorCreatePeerArgsClass * cls)
+bgp_configurator_push_route_args_class_init (BgpConfiguratorPushRouteArgsClass * cls)
 {
   GObjectClass *gobject_class = G_OBJECT_CLASS (cls);
   ThriftStructClass *struct_class = THRIFT_STRUCT_CLASS (cls);
 
-  struct_class->read = bgp_configurator_create_peer_args_read;
-  struct_class->write = bgp_configurator_create_peer_args_write;
+  struct_class->read = bgp_configurator_push_route_args_read;
+  struct_class->write = bgp_configurator_push_route_args_write;
 
-  gobject_class->finalize = bgp_configurator_create_peer_args_finalize;
-  gobject_class->get_property = bgp_configurator_create_peer_args_get_property;
-  gobject_class->set_property = bgp_configurator_create_peer_args_set_property;
+  gobject_class->finalize = bgp_configurator_push_route_args_finalize;
+  gobject_class->get_property = bgp_configurator_push_route_args_get_property;
+  gobject_class->set_property = bgp_configurator_push_route_args_set_property;
 
   g_object_class_install_property
     (gobject_class,
-     PROP_BGP_CONFIGURATOR_CREATE_PEER_ARGS_IP_ADDRESS,
-     g_param_spec_string ("ipAddress",
+     PROP_BGP_CONFIGURATOR_PUSH_ROUTE_ARGS_PREFIX,
+     g_param_spec_string ("prefix",
                           NULL,
                           NULL,
                           NULL,
@@ -2402,18 +6024,36 @@ bgp_configurator_create_peer_args_class_init (BgpConfiguratorCreatePeerArgsClass
 
   g_object_class_install_property
     (gobject_class,
-     PROP_BGP_CONFIGURATOR_CREATE_PEER_ARGS_AS_NUMBER,
-     g_param_spec_int64 ("asNumber",
-                         NULL,
-                         NULL,
-                         G_MININT64,
-                         G_MAXINT64,
-                         0,
-                         G_PARAM_READWRITE));
+     PROP_BGP_CONFIGURATOR_PUSH_ROUTE_ARGS_NEXTHOP,
+     g_param_spec_string ("nexthop",
+                          NULL,
+                          NULL,
+                          NULL,
+                          G_PARAM_READWRITE));
+
+  g_object_class_install_property
+    (gobject_class,
+     PROP_BGP_CONFIGURATOR_PUSH_ROUTE_ARGS_RD,
+     g_param_spec_string ("rd",
+                          NULL,
+                          NULL,
+                          NULL,
+                          G_PARAM_READWRITE));
+
+  g_object_class_install_property
+    (gobject_class,
+     PROP_BGP_CONFIGURATOR_PUSH_ROUTE_ARGS_LABEL,
+     g_param_spec_int ("label",
+                       NULL,
+                       NULL,
+                       G_MININT32,
+                       G_MAXINT32,
+                       0,
+                       G_PARAM_READWRITE));
 }
 
 GType
-bgp_configurator_create_peer_args_get_type (void)
+bgp_configurator_push_route_args_get_type (void)
 {
   static GType type = 0;
 
@@ -2421,35 +6061,35 @@ bgp_configurator_create_peer_args_get_type (void)
   {
     static const GTypeInfo type_info = 
     {
-      sizeof (BgpConfiguratorCreatePeerArgsClass),
+      sizeof (BgpConfiguratorPushRouteArgsClass),
       NULL, /* base_init */
       NULL, /* base_finalize */
-      (GClassInitFunc) bgp_configurator_create_peer_args_class_init,
+      (GClassInitFunc) bgp_configurator_push_route_args_class_init,
       NULL, /* class_finalize */
       NULL, /* class_data */
-      sizeof (BgpConfiguratorCreatePeerArgs),
+      sizeof (BgpConfiguratorPushRouteArgs),
       0, /* n_preallocs */
-      (GInstanceInitFunc) bgp_configurator_create_peer_args_instance_init,
+      (GInstanceInitFunc) bgp_configurator_push_route_args_instance_init,
       NULL, /* value_table */
     };
 
     type = g_type_register_static (THRIFT_TYPE_STRUCT, 
-                                   "BgpConfiguratorCreatePeerArgsType",
+                                   "BgpConfiguratorPushRouteArgsType",
                                    &type_info, 0);
   }
 
   return type;
 }
 
-enum _BgpConfiguratorCreatePeerResultProperties
+enum _BgpConfiguratorPushRouteResultProperties
 {
-  PROP_BGP_CONFIGURATOR_CREATE_PEER_RESULT_0,
-  PROP_BGP_CONFIGURATOR_CREATE_PEER_RESULT_SUCCESS
+  PROP_BGP_CONFIGURATOR_PUSH_ROUTE_RESULT_0,
+  PROP_BGP_CONFIGURATOR_PUSH_ROUTE_RESULT_SUCCESS
 };
 
-/* reads a bgp_configurator_create_peer_result object */
+/* reads a bgp_configurator_push_route_result object */
 static gint32
-bgp_configurator_create_peer_result_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+bgp_configurator_push_route_result_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
 {
   gint32 ret;
   gint32 xfer = 0;
@@ -2458,7 +6098,7 @@ bgp_configurator_create_peer_result_read (ThriftStruct *object, ThriftProtocol *
   gint16 fid;
   guint32 len = 0;
   gpointer data = NULL;
-  BgpConfiguratorCreatePeerResult * this_object = BGP_CONFIGURATOR_CREATE_PEER_RESULT(object);
+  BgpConfiguratorPushRouteResult * this_object = BGP_CONFIGURATOR_PUSH_ROUTE_RESULT(object);
 
   /* satisfy -Wall in case these aren't used */
   THRIFT_UNUSED_VAR (len);
@@ -2528,14 +6168,14 @@ bgp_configurator_create_peer_result_read (ThriftStruct *object, ThriftProtocol *
 }
 
 static gint32
-bgp_configurator_create_peer_result_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+bgp_configurator_push_route_result_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
 {
   gint32 ret;
   gint32 xfer = 0;
 
-  BgpConfiguratorCreatePeerResult * this_object = BGP_CONFIGURATOR_CREATE_PEER_RESULT(object);
+  BgpConfiguratorPushRouteResult * this_object = BGP_CONFIGURATOR_PUSH_ROUTE_RESULT(object);
   THRIFT_UNUSED_VAR (this_object);
-  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorCreatePeerResult", error)) < 0)
+  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorPushRouteResult", error)) < 0)
     return -1;
   xfer += ret;
   if (this_object->__isset_success == TRUE) {
@@ -2561,16 +6201,16 @@ bgp_configurator_create_peer_result_write (ThriftStruct *object, ThriftProtocol
 }
 
 static void
-bgp_configurator_create_peer_result_set_property (GObject *object,
-                                                  guint property_id,
-                                                  const GValue *value,
-                                                  GParamSpec *pspec)
+bgp_configurator_push_route_result_set_property (GObject *object,
+                                                 guint property_id,
+                                                 const GValue *value,
+                                                 GParamSpec *pspec)
 {
-  BgpConfiguratorCreatePeerResult *self = BGP_CONFIGURATOR_CREATE_PEER_RESULT (object);
+  BgpConfiguratorPushRouteResult *self = BGP_CONFIGURATOR_PUSH_ROUTE_RESULT (object);
 
   switch (property_id)
   {
-    case PROP_BGP_CONFIGURATOR_CREATE_PEER_RESULT_SUCCESS:
+    case PROP_BGP_CONFIGURATOR_PUSH_ROUTE_RESULT_SUCCESS:
       self->success = g_value_get_int (value);
       self->__isset_success = TRUE;
       break;
@@ -2582,16 +6222,16 @@ bgp_configurator_create_peer_result_set_property (GObject *object,
 }
 
 static void
-bgp_configurator_create_peer_result_get_property (GObject *object,
-                                                  guint property_id,
-                                                  GValue *value,
-                                                  GParamSpec *pspec)
+bgp_configurator_push_route_result_get_property (GObject *object,
+                                                 guint property_id,
+                                                 GValue *value,
+                                                 GParamSpec *pspec)
 {
-  BgpConfiguratorCreatePeerResult *self = BGP_CONFIGURATOR_CREATE_PEER_RESULT (object);
+  BgpConfiguratorPushRouteResult *self = BGP_CONFIGURATOR_PUSH_ROUTE_RESULT (object);
 
   switch (property_id)
   {
-    case PROP_BGP_CONFIGURATOR_CREATE_PEER_RESULT_SUCCESS:
+    case PROP_BGP_CONFIGURATOR_PUSH_ROUTE_RESULT_SUCCESS:
       g_value_set_int (value, self->success);
       break;
 
@@ -2602,7 +6242,7 @@ bgp_configurator_create_peer_result_get_property (GObject *object,
 }
 
 static void 
-bgp_configurator_create_peer_result_instance_init (BgpConfiguratorCreatePeerResult * object)
+bgp_configurator_push_route_result_instance_init (BgpConfiguratorPushRouteResult * object)
 {
   /* satisfy -Wall */
   THRIFT_UNUSED_VAR (object);
@@ -2611,30 +6251,30 @@ bgp_configurator_create_peer_result_instance_init (BgpConfiguratorCreatePeerResu
 }
 
 static void 
-bgp_configurator_create_peer_result_finalize (GObject *object)
+bgp_configurator_push_route_result_finalize (GObject *object)
 {
-  BgpConfiguratorCreatePeerResult *tobject = BGP_CONFIGURATOR_CREATE_PEER_RESULT (object);
+  BgpConfiguratorPushRouteResult *tobject = BGP_CONFIGURATOR_PUSH_ROUTE_RESULT (object);
 
   /* satisfy -Wall in case we don't use tobject */
   THRIFT_UNUSED_VAR (tobject);
 }
 
 static void
-bgp_configurator_create_peer_result_class_init (BgpConfiguratorCreatePeerResultClass * cls)
+bgp_configurator_push_route_result_class_init (BgpConfiguratorPushRouteResultClass * cls)
 {
   GObjectClass *gobject_class = G_OBJECT_CLASS (cls);
   ThriftStructClass *struct_class = THRIFT_STRUCT_CLASS (cls);
 
-  struct_class->read = bgp_configurator_create_peer_result_read;
-  struct_class->write = bgp_configurator_create_peer_result_write;
+  struct_class->read = bgp_configurator_push_route_result_read;
+  struct_class->write = bgp_configurator_push_route_result_write;
 
-  gobject_class->finalize = bgp_configurator_create_peer_result_finalize;
-  gobject_class->get_property = bgp_configurator_create_peer_result_get_property;
-  gobject_class->set_property = bgp_configurator_create_peer_result_set_property;
+  gobject_class->finalize = bgp_configurator_push_route_result_finalize;
+  gobject_class->get_property = bgp_configurator_push_route_result_get_property;
+  gobject_class->set_property = bgp_configurator_push_route_result_set_property;
 
   g_object_class_install_property
     (gobject_class,
-     PROP_BGP_CONFIGURATOR_CREATE_PEER_RESULT_SUCCESS,
+     PROP_BGP_CONFIGURATOR_PUSH_ROUTE_RESULT_SUCCESS,
      g_param_spec_int ("success",
                        NULL,
                        NULL,
@@ -2645,7 +6285,7 @@ bgp_configurator_create_peer_result_class_init (BgpConfiguratorCreatePeerResultC
 }
 
 GType
-bgp_configurator_create_peer_result_get_type (void)
+bgp_configurator_push_route_result_get_type (void)
 {
   static GType type = 0;
 
@@ -2653,35 +6293,36 @@ bgp_configurator_create_peer_result_get_type (void)
   {
     static const GTypeInfo type_info = 
     {
-      sizeof (BgpConfiguratorCreatePeerResultClass),
+      sizeof (BgpConfiguratorPushRouteResultClass),
       NULL, /* base_init */
       NULL, /* base_finalize */
-      (GClassInitFunc) bgp_configurator_create_peer_result_class_init,
+      (GClassInitFunc) bgp_configurator_push_route_result_class_init,
       NULL, /* class_finalize */
       NULL, /* class_data */
-      sizeof (BgpConfiguratorCreatePeerResult),
+      sizeof (BgpConfiguratorPushRouteResult),
       0, /* n_preallocs */
-      (GInstanceInitFunc) bgp_configurator_create_peer_result_instance_init,
+      (GInstanceInitFunc) bgp_configurator_push_route_result_instance_init,
       NULL, /* value_table */
     };
 
     type = g_type_register_static (THRIFT_TYPE_STRUCT, 
-                                   "BgpConfiguratorCreatePeerResultType",
+                                   "BgpConfiguratorPushRouteResultType",
                                    &type_info, 0);
   }
 
   return type;
 }
 
-enum _BgpConfiguratorDeletePeerArgsProperties
+enum _BgpConfiguratorWithdrawRouteArgsProperties
 {
-  PROP_BGP_CONFIGURATOR_DELETE_PEER_ARGS_0,
-  PROP_BGP_CONFIGURATOR_DELETE_PEER_ARGS_IP_ADDRESS
+  PROP_BGP_CONFIGURATOR_WITHDRAW_ROUTE_ARGS_0,
+  PROP_BGP_CONFIGURATOR_WITHDRAW_ROUTE_ARGS_PREFIX,
+  PROP_BGP_CONFIGURATOR_WITHDRAW_ROUTE_ARGS_RD
 };
 
-/* reads a bgp_configurator_delete_peer_args object */
+/* reads a bgp_configurator_withdraw_route_args object */
 static gint32
-bgp_configurator_delete_peer_args_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+bgp_configurator_withdraw_route_args_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
 {
   gint32 ret;
   gint32 xfer = 0;
@@ -2690,7 +6331,7 @@ bgp_configurator_delete_peer_args_read (ThriftStruct *object, ThriftProtocol *pr
   gint16 fid;
   guint32 len = 0;
   gpointer data = NULL;
-  BgpConfiguratorDeletePeerArgs * this_object = BGP_CONFIGURATOR_DELETE_PEER_ARGS(object);
+  BgpConfiguratorWithdrawRouteArgs * this_object = BGP_CONFIGURATOR_WITHDRAW_ROUTE_ARGS(object);
 
   /* satisfy -Wall in case these aren't used */
   THRIFT_UNUSED_VAR (len);
@@ -2731,16 +6372,35 @@ bgp_configurator_delete_peer_args_read (ThriftStruct *object, ThriftProtocol *pr
       case 1:
         if (ftype == T_STRING)
         {
-          if (this_object->ipAddress != NULL)
+          if (this_object->prefix != NULL)
           {
-            g_free(this_object->ipAddress);
-            this_object->ipAddress = NULL;
+            g_free(this_object->prefix);
+            this_object->prefix = NULL;
           }
 
-          if ((ret = thrift_protocol_read_string (protocol, &this_object->ipAddress, error)) < 0)
+          if ((ret = thrift_protocol_read_string (protocol, &this_object->prefix, error)) < 0)
             return -1;
           xfer += ret;
-          this_object->__isset_ipAddress = TRUE;
+          this_object->__isset_prefix = TRUE;
+        } else {
+          if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
+            return -1;
+          xfer += ret;
+        }
+        break;
+      case 2:
+        if (ftype == T_STRING)
+        {
+          if (this_object->rd != NULL)
+          {
+            g_free(this_object->rd);
+            this_object->rd = NULL;
+          }
+
+          if ((ret = thrift_protocol_read_string (protocol, &this_object->rd, error)) < 0)
+            return -1;
+          xfer += ret;
+          this_object->__isset_rd = TRUE;
         } else {
           if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
             return -1;
@@ -2766,20 +6426,30 @@ bgp_configurator_delete_peer_args_read (ThriftStruct *object, ThriftProtocol *pr
 }
 
 static gint32
-bgp_configurator_delete_peer_args_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+bgp_configurator_withdraw_route_args_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
 {
   gint32 ret;
   gint32 xfer = 0;
 
-  BgpConfiguratorDeletePeerArgs * this_object = BGP_CONFIGURATOR_DELETE_PEER_ARGS(object);
+  BgpConfiguratorWithdrawRouteArgs * this_object = BGP_CONFIGURATOR_WITHDRAW_ROUTE_ARGS(object);
   THRIFT_UNUSED_VAR (this_object);
-  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorDeletePeerArgs", error)) < 0)
+  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorWithdrawRouteArgs", error)) < 0)
     return -1;
   xfer += ret;
-  if ((ret = thrift_protocol_write_field_begin (protocol, "ipAddress", T_STRING, 1, error)) < 0)
+  if ((ret = thrift_protocol_write_field_begin (protocol, "prefix", T_STRING, 1, error)) < 0)
     return -1;
   xfer += ret;
-  if ((ret = thrift_protocol_write_string (protocol, this_object->ipAddress, error)) < 0)
+  if ((ret = thrift_protocol_write_string (protocol, this_object->prefix, error)) < 0)
+    return -1;
+  xfer += ret;
+
+  if ((ret = thrift_protocol_write_field_end (protocol, error)) < 0)
+    return -1;
+  xfer += ret;
+  if ((ret = thrift_protocol_write_field_begin (protocol, "rd", T_STRING, 2, error)) < 0)
+    return -1;
+  xfer += ret;
+  if ((ret = thrift_protocol_write_string (protocol, this_object->rd, error)) < 0)
     return -1;
   xfer += ret;
 
@@ -2797,20 +6467,27 @@ bgp_configurator_delete_peer_args_write (ThriftStruct *object, ThriftProtocol *p
 }
 
 static void
-bgp_configurator_delete_peer_args_set_property (GObject *object,
-                                                guint property_id,
-                                                const GValue *value,
-                                                GParamSpec *pspec)
+bgp_configurator_withdraw_route_args_set_property (GObject *object,
+                                                   guint property_id,
+                                                   const GValue *value,
+                                                   GParamSpec *pspec)
 {
-  BgpConfiguratorDeletePeerArgs *self = BGP_CONFIGURATOR_DELETE_PEER_ARGS (object);
+  BgpConfiguratorWithdrawRouteArgs *self = BGP_CONFIGURATOR_WITHDRAW_ROUTE_ARGS (object);
 
   switch (property_id)
   {
-    case PROP_BGP_CONFIGURATOR_DELETE_PEER_ARGS_IP_ADDRESS:
-      if (self->ipAddress != NULL)
-        g_free (self->ipAddress);
-      self->ipAddress = g_value_dup_string (value);
-      self->__isset_ipAddress = TRUE;
+    case PROP_BGP_CONFIGURATOR_WITHDRAW_ROUTE_ARGS_PREFIX:
+      if (self->prefix != NULL)
+        g_free (self->prefix);
+      self->prefix = g_value_dup_string (value);
+      self->__isset_prefix = TRUE;
+      break;
+
+    case PROP_BGP_CONFIGURATOR_WITHDRAW_ROUTE_ARGS_RD:
+      if (self->rd != NULL)
+        g_free (self->rd);
+      self->rd = g_value_dup_string (value);
+      self->__isset_rd = TRUE;
       break;
 
     default:
@@ -2820,17 +6497,21 @@ bgp_configurator_delete_peer_args_set_property (GObject *object,
 }
 
 static void
-bgp_configurator_delete_peer_args_get_property (GObject *object,
-                                                guint property_id,
-                                                GValue *value,
-                                                GParamSpec *pspec)
+bgp_configurator_withdraw_route_args_get_property (GObject *object,
+                                                   guint property_id,
+                                                   GValue *value,
+                                                   GParamSpec *pspec)
 {
-  BgpConfiguratorDeletePeerArgs *self = BGP_CONFIGURATOR_DELETE_PEER_ARGS (object);
+  BgpConfiguratorWithdrawRouteArgs *self = BGP_CONFIGURATOR_WITHDRAW_ROUTE_ARGS (object);
 
   switch (property_id)
   {
-    case PROP_BGP_CONFIGURATOR_DELETE_PEER_ARGS_IP_ADDRESS:
-      g_value_set_string (value, self->ipAddress);
+    case PROP_BGP_CONFIGURATOR_WITHDRAW_ROUTE_ARGS_PREFIX:
+      g_value_set_string (value, self->prefix);
+      break;
+
+    case PROP_BGP_CONFIGURATOR_WITHDRAW_ROUTE_ARGS_RD:
+      g_value_set_string (value, self->rd);
       break;
 
     default:
@@ -2840,45 +6521,61 @@ bgp_configurator_delete_peer_args_get_property (GObject *object,
 }
 
 static void 
-bgp_configurator_delete_peer_args_instance_init (BgpConfiguratorDeletePeerArgs * object)
+bgp_configurator_withdraw_route_args_instance_init (BgpConfiguratorWithdrawRouteArgs * object)
 {
   /* satisfy -Wall */
   THRIFT_UNUSED_VAR (object);
-  object->ipAddress = NULL;
-  object->__isset_ipAddress = FALSE;
+  object->prefix = NULL;
+  object->__isset_prefix = FALSE;
+  object->rd = NULL;
+  object->__isset_rd = FALSE;
 }
 
 static void 
-bgp_configurator_delete_peer_args_finalize (GObject *object)
+bgp_configurator_withdraw_route_args_finalize (GObject *object)
 {
-  BgpConfiguratorDeletePeerArgs *tobject = BGP_CONFIGURATOR_DELETE_PEER_ARGS (object);
+  BgpConfiguratorWithdrawRouteArgs *tobject = BGP_CONFIGURATOR_WITHDRAW_ROUTE_ARGS (object);
 
   /* satisfy -Wall in case we don't use tobject */
   THRIFT_UNUSED_VAR (tobject);
-  if (tobject->ipAddress != NULL)
+  if (tobject->prefix != NULL)
   {
-    g_free(tobject->ipAddress);
-    tobject->ipAddress = NULL;
+    g_free(tobject->prefix);
+    tobject->prefix = NULL;
+  }
+  if (tobject->rd != NULL)
+  {
+    g_free(tobject->rd);
+    tobject->rd = NULL;
   }
 }
 
 static void
-bgp_configurator_delete_peer_args_class_init (BgpConfiguratorDeletePeerArgsClass * cls)
+bgp_configurator_withdraw_route_args_class_init (BgpConfiguratorWithdrawRouteArgsClass * cls)
 {
   GObjectClass *gobject_class = G_OBJECT_CLASS (cls);
   ThriftStructClass *struct_class = THRIFT_STRUCT_CLASS (cls);
 
-  struct_class->read = bgp_configurator_delete_peer_args_read;
-  struct_class->write = bgp_configurator_delete_peer_args_write;
+  struct_class->read = bgp_configurator_withdraw_route_args_read;
+  struct_class->write = bgp_configurator_withdraw_route_args_write;
 
-  gobject_class->finalize = bgp_configurator_delete_peer_args_finalize;
-  gobject_class->get_property = bgp_configurator_delete_peer_args_get_property;
-  gobject_class->set_property = bgp_configurator_delete_peer_args_set_property;
+  gobject_class->finalize = bgp_configurator_withdraw_route_args_finalize;
+  gobject_class->get_property = bgp_configurator_withdraw_route_args_get_property;
+  gobject_class->set_property = bgp_configurator_withdraw_route_args_set_property;
 
   g_object_class_install_property
     (gobject_class,
-     PROP_BGP_CONFIGURATOR_DELETE_PEER_ARGS_IP_ADDRESS,
-     g_param_spec_string ("ipAddress",
+     PROP_BGP_CONFIGURATOR_WITHDRAW_ROUTE_ARGS_PREFIX,
+     g_param_spec_string ("prefix",
+                          NULL,
+                          NULL,
+                          NULL,
+                          G_PARAM_READWRITE));
+
+  g_object_class_install_property
+    (gobject_class,
+     PROP_BGP_CONFIGURATOR_WITHDRAW_ROUTE_ARGS_RD,
+     g_param_spec_string ("rd",
                           NULL,
                           NULL,
                           NULL,
@@ -2886,7 +6583,7 @@ bgp_configurator_delete_peer_args_class_init (BgpConfiguratorDeletePeerArgsClass
 }
 
 GType
-bgp_configurator_delete_peer_args_get_type (void)
+bgp_configurator_withdraw_route_args_get_type (void)
 {
   static GType type = 0;
 
@@ -2894,35 +6591,35 @@ bgp_configurator_delete_peer_args_get_type (void)
   {
     static const GTypeInfo type_info = 
     {
-      sizeof (BgpConfiguratorDeletePeerArgsClass),
+      sizeof (BgpConfiguratorWithdrawRouteArgsClass),
       NULL, /* base_init */
       NULL, /* base_finalize */
-      (GClassInitFunc) bgp_configurator_delete_peer_args_class_init,
+      (GClassInitFunc) bgp_configurator_withdraw_route_args_class_init,
       NULL, /* class_finalize */
       NULL, /* class_data */
-      sizeof (BgpConfiguratorDeletePeerArgs),
+      sizeof (BgpConfiguratorWithdrawRouteArgs),
       0, /* n_preallocs */
-      (GInstanceInitFunc) bgp_configurator_delete_peer_args_instance_init,
+      (GInstanceInitFunc) bgp_configurator_withdraw_route_args_instance_init,
       NULL, /* value_table */
     };
 
     type = g_type_register_static (THRIFT_TYPE_STRUCT, 
-                                   "BgpConfiguratorDeletePeerArgsType",
+                                   "BgpConfiguratorWithdrawRouteArgsType",
                                    &type_info, 0);
   }
 
   return type;
 }
 
-enum _BgpConfiguratorDeletePeerResultProperties
+enum _BgpConfiguratorWithdrawRouteResultProperties
 {
-  PROP_BGP_CONFIGURATOR_DELETE_PEER_RESULT_0,
-  PROP_BGP_CONFIGURATOR_DELETE_PEER_RESULT_SUCCESS
+  PROP_BGP_CONFIGURATOR_WITHDRAW_ROUTE_RESULT_0,
+  PROP_BGP_CONFIGURATOR_WITHDRAW_ROUTE_RESULT_SUCCESS
 };
 
-/* reads a bgp_configurator_delete_peer_result object */
+/* reads a bgp_configurator_withdraw_route_result object */
 static gint32
-bgp_configurator_delete_peer_result_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+bgp_configurator_withdraw_route_result_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
 {
   gint32 ret;
   gint32 xfer = 0;
@@ -2931,7 +6628,7 @@ bgp_configurator_delete_peer_result_read (ThriftStruct *object, ThriftProtocol *
   gint16 fid;
   guint32 len = 0;
   gpointer data = NULL;
-  BgpConfiguratorDeletePeerResult * this_object = BGP_CONFIGURATOR_DELETE_PEER_RESULT(object);
+  BgpConfiguratorWithdrawRouteResult * this_object = BGP_CONFIGURATOR_WITHDRAW_ROUTE_RESULT(object);
 
   /* satisfy -Wall in case these aren't used */
   THRIFT_UNUSED_VAR (len);
@@ -3001,14 +6698,14 @@ bgp_configurator_delete_peer_result_read (ThriftStruct *object, ThriftProtocol *
 }
 
 static gint32
-bgp_configurator_delete_peer_result_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+bgp_configurator_withdraw_route_result_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
 {
   gint32 ret;
   gint32 xfer = 0;
 
-  BgpConfiguratorDeletePeerResult * this_object = BGP_CONFIGURATOR_DELETE_PEER_RESULT(object);
+  BgpConfiguratorWithdrawRouteResult * this_object = BGP_CONFIGURATOR_WITHDRAW_ROUTE_RESULT(object);
   THRIFT_UNUSED_VAR (this_object);
-  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorDeletePeerResult", error)) < 0)
+  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorWithdrawRouteResult", error)) < 0)
     return -1;
   xfer += ret;
   if (this_object->__isset_success == TRUE) {
@@ -3034,16 +6731,16 @@ bgp_configurator_delete_peer_result_write (ThriftStruct *object, ThriftProtocol
 }
 
 static void
-bgp_configurator_delete_peer_result_set_property (GObject *object,
-                                                  guint property_id,
-                                                  const GValue *value,
-                                                  GParamSpec *pspec)
+bgp_configurator_withdraw_route_result_set_property (GObject *object,
+                                                     guint property_id,
+                                                     const GValue *value,
+                                                     GParamSpec *pspec)
 {
-  BgpConfiguratorDeletePeerResult *self = BGP_CONFIGURATOR_DELETE_PEER_RESULT (object);
+  BgpConfiguratorWithdrawRouteResult *self = BGP_CONFIGURATOR_WITHDRAW_ROUTE_RESULT (object);
 
   switch (property_id)
   {
-    case PROP_BGP_CONFIGURATOR_DELETE_PEER_RESULT_SUCCESS:
+    case PROP_BGP_CONFIGURATOR_WITHDRAW_ROUTE_RESULT_SUCCESS:
       self->success = g_value_get_int (value);
       self->__isset_success = TRUE;
       break;
@@ -3055,16 +6752,16 @@ bgp_configurator_delete_peer_result_set_property (GObject *object,
 }
 
 static void
-bgp_configurator_delete_peer_result_get_property (GObject *object,
-                                                  guint property_id,
-                                                  GValue *value,
-                                                  GParamSpec *pspec)
+bgp_configurator_withdraw_route_result_get_property (GObject *object,
+                                                     guint property_id,
+                                                     GValue *value,
+                                                     GParamSpec *pspec)
 {
-  BgpConfiguratorDeletePeerResult *self = BGP_CONFIGURATOR_DELETE_PEER_RESULT (object);
+  BgpConfiguratorWithdrawRouteResult *self = BGP_CONFIGURATOR_WITHDRAW_ROUTE_RESULT (object);
 
   switch (property_id)
   {
-    case PROP_BGP_CONFIGURATOR_DELETE_PEER_RESULT_SUCCESS:
+    case PROP_BGP_CONFIGURATOR_WITHDRAW_ROUTE_RESULT_SUCCESS:
       g_value_set_int (value, self->success);
       break;
 
@@ -3075,7 +6772,7 @@ bgp_configurator_delete_peer_result_get_property (GObject *object,
 }
 
 static void 
-bgp_configurator_delete_peer_result_instance_init (BgpConfiguratorDeletePeerResult * object)
+bgp_configurator_withdraw_route_result_instance_init (BgpConfiguratorWithdrawRouteResult * object)
 {
   /* satisfy -Wall */
   THRIFT_UNUSED_VAR (object);
@@ -3084,30 +6781,30 @@ bgp_configurator_delete_peer_result_instance_init (BgpConfiguratorDeletePeerResu
 }
 
 static void 
-bgp_configurator_delete_peer_result_finalize (GObject *object)
+bgp_configurator_withdraw_route_result_finalize (GObject *object)
 {
-  BgpConfiguratorDeletePeerResult *tobject = BGP_CONFIGURATOR_DELETE_PEER_RESULT (object);
+  BgpConfiguratorWithdrawRouteResult *tobject = BGP_CONFIGURATOR_WITHDRAW_ROUTE_RESULT (object);
 
   /* satisfy -Wall in case we don't use tobject */
   THRIFT_UNUSED_VAR (tobject);
 }
 
 static void
-bgp_configurator_delete_peer_result_class_init (BgpConfiguratorDeletePeerResultClass * cls)
+bgp_configurator_withdraw_route_result_class_init (BgpConfiguratorWithdrawRouteResultClass * cls)
 {
   GObjectClass *gobject_class = G_OBJECT_CLASS (cls);
   ThriftStructClass *struct_class = THRIFT_STRUCT_CLASS (cls);
 
-  struct_class->read = bgp_configurator_delete_peer_result_read;
-  struct_class->write = bgp_configurator_delete_peer_result_write;
+  struct_class->read = bgp_configurator_withdraw_route_result_read;
+  struct_class->write = bgp_configurator_withdraw_route_result_write;
 
-  gobject_class->finalize = bgp_configurator_delete_peer_result_finalize;
-  gobject_class->get_property = bgp_configurator_delete_peer_result_get_property;
-  gobject_class->set_property = bgp_configurator_delete_peer_result_set_property;
+  gobject_class->finalize = bgp_configurator_withdraw_route_result_finalize;
+  gobject_class->get_property = bgp_configurator_withdraw_route_result_get_property;
+  gobject_class->set_property = bgp_configurator_withdraw_route_result_set_property;
 
   g_object_class_install_property
     (gobject_class,
-     PROP_BGP_CONFIGURATOR_DELETE_PEER_RESULT_SUCCESS,
+     PROP_BGP_CONFIGURATOR_WITHDRAW_ROUTE_RESULT_SUCCESS,
      g_param_spec_int ("success",
                        NULL,
                        NULL,
@@ -3118,7 +6815,7 @@ bgp_configurator_delete_peer_result_class_init (BgpConfiguratorDeletePeerResultC
 }
 
 GType
-bgp_configurator_delete_peer_result_get_type (void)
+bgp_configurator_withdraw_route_result_get_type (void)
 {
   static GType type = 0;
 
@@ -3126,37 +6823,36 @@ bgp_configurator_delete_peer_result_get_type (void)
   {
     static const GTypeInfo type_info = 
     {
-      sizeof (BgpConfiguratorDeletePeerResultClass),
+      sizeof (BgpConfiguratorWithdrawRouteResultClass),
       NULL, /* base_init */
       NULL, /* base_finalize */
-      (GClassInitFunc) bgp_configurator_delete_peer_result_class_init,
+      (GClassInitFunc) bgp_configurator_withdraw_route_result_class_init,
       NULL, /* class_finalize */
       NULL, /* class_data */
-      sizeof (BgpConfiguratorDeletePeerResult),
+      sizeof (BgpConfiguratorWithdrawRouteResult),
       0, /* n_preallocs */
-      (GInstanceInitFunc) bgp_configurator_delete_peer_result_instance_init,
+      (GInstanceInitFunc) bgp_configurator_withdraw_route_result_instance_init,
       NULL, /* value_table */
     };
 
     type = g_type_register_static (THRIFT_TYPE_STRUCT, 
-                                   "BgpConfiguratorDeletePeerResultType",
+                                   "BgpConfiguratorWithdrawRouteResultType",
                                    &type_info, 0);
   }
 
   return type;
 }
 
-enum _BgpConfiguratorAddVrfArgsProperties
+enum _BgpConfiguratorSetEbgpMultihopArgsProperties
 {
-  PROP_BGP_CONFIGURATOR_ADD_VRF_ARGS_0,
-  PROP_BGP_CONFIGURATOR_ADD_VRF_ARGS_RD,
-  PROP_BGP_CONFIGURATOR_ADD_VRF_ARGS_IRTS,
-  PROP_BGP_CONFIGURATOR_ADD_VRF_ARGS_ERTS
+  PROP_BGP_CONFIGURATOR_SET_EBGP_MULTIHOP_ARGS_0,
+  PROP_BGP_CONFIGURATOR_SET_EBGP_MULTIHOP_ARGS_PEER_IP,
+  PROP_BGP_CONFIGURATOR_SET_EBGP_MULTIHOP_ARGS_N_HOPS
 };
 
-/* reads a bgp_configurator_add_vrf_args object */
+/* reads a bgp_configurator_set_ebgp_multihop_args object */
 static gint32
-bgp_configurator_add_vrf_args_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+bgp_configurator_set_ebgp_multihop_args_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
 {
   gint32 ret;
   gint32 xfer = 0;
@@ -3165,7 +6861,7 @@ bgp_configurator_add_vrf_args_read (ThriftStruct *object, ThriftProtocol *protoc
   gint16 fid;
   guint32 len = 0;
   gpointer data = NULL;
-  BgpConfiguratorAddVrfArgs * this_object = BGP_CONFIGURATOR_ADD_VRF_ARGS(object);
+  BgpConfiguratorSetEbgpMultihopArgs * this_object = BGP_CONFIGURATOR_SET_EBGP_MULTIHOP_ARGS(object);
 
   /* satisfy -Wall in case these aren't used */
   THRIFT_UNUSED_VAR (len);
@@ -3205,93 +6901,30 @@ bgp_configurator_add_vrf_args_read (ThriftStruct *object, ThriftProtocol *protoc
     {
       case 1:
         if (ftype == T_STRING)
-        {
-          if (this_object->rd != NULL)
-          {
-            g_free(this_object->rd);
-            this_object->rd = NULL;
-          }
-
-          if ((ret = thrift_protocol_read_string (protocol, &this_object->rd, error)) < 0)
-            return -1;
-          xfer += ret;
-          this_object->__isset_rd = TRUE;
-        } else {
-          if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
-            return -1;
-          xfer += ret;
-        }
-        break;
-      case 2:
-        if (ftype == T_LIST)
-        {
-          {
-            guint32 size;
-            guint32 i;
-            ThriftType element_type;
-
-            if ((ret = thrift_protocol_read_list_begin (protocol, &element_type,&size, error)) < 0)
-              return -1;
-            xfer += ret;
-
-            /* iterate through list elements */
-            for (i = 0; i < size; i++)
-            {
-              gchar * _elem2 = NULL;
-              if (_elem2 != NULL)
-              {
-                g_free(_elem2);
-                _elem2 = NULL;
-              }
-
-              if ((ret = thrift_protocol_read_string (protocol, &_elem2, error)) < 0)
-                return -1;
-              xfer += ret;
-              g_ptr_array_add (this_object->irts, _elem2);
-            }
-            if ((ret = thrift_protocol_read_list_end (protocol, error)) < 0)
-              return -1;
-            xfer += ret;
-          }
-          this_object->__isset_irts = TRUE;
-        } else {
-          if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
-            return -1;
-          xfer += ret;
-        }
-        break;
-      case 3:
-        if (ftype == T_LIST)
-        {
-          {
-            guint32 size;
-            guint32 i;
-            ThriftType element_type;
-
-            if ((ret = thrift_protocol_read_list_begin (protocol, &element_type,&size, error)) < 0)
-              return -1;
-            xfer += ret;
-
-            /* iterate through list elements */
-            for (i = 0; i < size; i++)
-            {
-              gchar * _elem3 = NULL;
-              if (_elem3 != NULL)
-              {
-                g_free(_elem3);
-                _elem3 = NULL;
-              }
-
-              if ((ret = thrift_protocol_read_string (protocol, &_elem3, error)) < 0)
-                return -1;
-              xfer += ret;
-              g_ptr_array_add (this_object->erts, _elem3);
-            }
-            if ((ret = thrift_protocol_read_list_end (protocol, error)) < 0)
-              return -1;
-            xfer += ret;
+        {
+          if (this_object->peerIp != NULL)
+          {
+            g_free(this_object->peerIp);
+            this_object->peerIp = NULL;
           }
-          this_object->__isset_erts = TRUE;
+
+          if ((ret = thrift_protocol_read_string (protocol, &this_object->peerIp, error)) < 0)
+            return -1;
+          xfer += ret;
+          this_object->__isset_peerIp = TRUE;
+        } else {
+          if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
+            return -1;
+          xfer += ret;
+        }
+        break;
+      case 2:
+        if (ftype == T_I32)
+        {
+          if ((ret = thrift_protocol_read_i32 (protocol, &this_object->nHops, error)) < 0)
+            return -1;
+          xfer += ret;
+          this_object->__isset_nHops = TRUE;
         } else {
           if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
             return -1;
@@ -3317,69 +6950,33 @@ bgp_configurator_add_vrf_args_read (ThriftStruct *object, ThriftProtocol *protoc
 }
 
 static gint32
-bgp_configurator_add_vrf_args_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+bgp_configurator_set_ebgp_multihop_args_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
 {
   gint32 ret;
   gint32 xfer = 0;
 
-  BgpConfiguratorAddVrfArgs * this_object = BGP_CONFIGURATOR_ADD_VRF_ARGS(object);
+  BgpConfiguratorSetEbgpMultihopArgs * this_object = BGP_CONFIGURATOR_SET_EBGP_MULTIHOP_ARGS(object);
   THRIFT_UNUSED_VAR (this_object);
-  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorAddVrfArgs", error)) < 0)
+  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorSetEbgpMultihopArgs", error)) < 0)
     return -1;
   xfer += ret;
-  if ((ret = thrift_protocol_write_field_begin (protocol, "rd", T_STRING, 1, error)) < 0)
+  if ((ret = thrift_protocol_write_field_begin (protocol, "peerIp", T_STRING, 1, error)) < 0)
     return -1;
   xfer += ret;
-  if ((ret = thrift_protocol_write_string (protocol, this_object->rd, error)) < 0)
+  if ((ret = thrift_protocol_write_string (protocol, this_object->peerIp, error)) < 0)
     return -1;
   xfer += ret;
 
   if ((ret = thrift_protocol_write_field_end (protocol, error)) < 0)
     return -1;
   xfer += ret;
-  if ((ret = thrift_protocol_write_field_begin (protocol, "irts", T_LIST, 2, error)) < 0)
-    return -1;
-  xfer += ret;
-  {
-    guint i4;
-
-    if ((ret = thrift_protocol_write_list_begin (protocol, T_STRING, (gint32) (this_object->irts ? this_object->irts->len : 0), error)) < 0)
-      return -1;
-    xfer += ret;
-    for (i4 = 0; i4 < (this_object->irts ? this_object->irts->len : 0); i4++)
-    {
-      if ((ret = thrift_protocol_write_string (protocol, ((gchar*)g_ptr_array_index ((GPtrArray *) this_object->irts, i4)), error)) < 0)
-        return -1;
-      xfer += ret;
-
-    }
-    if ((ret = thrift_protocol_write_list_end (protocol, error)) < 0)
-      return -1;
-    xfer += ret;
-  }
-  if ((ret = thrift_protocol_write_field_end (protocol, error)) < 0)
+  if ((ret = thrift_protocol_write_field_begin (protocol, "nHops", T_I32, 2, error)) < 0)
     return -1;
   xfer += ret;
-  if ((ret = thrift_protocol_write_field_begin (protocol, "erts", T_LIST, 3, error)) < 0)
+  if ((ret = thrift_protocol_write_i32 (protocol, this_object->nHops, error)) < 0)
     return -1;
   xfer += ret;
-  {
-    guint i5;
-
-    if ((ret = thrift_protocol_write_list_begin (protocol, T_STRING, (gint32) (this_object->erts ? this_object->erts->len : 0), error)) < 0)
-      return -1;
-    xfer += ret;
-    for (i5 = 0; i5 < (this_object->erts ? this_object->erts->len : 0); i5++)
-    {
-      if ((ret = thrift_protocol_write_string (protocol, ((gchar*)g_ptr_array_index ((GPtrArray *) this_object->erts, i5)), error)) < 0)
-        return -1;
-      xfer += ret;
 
-    }
-    if ((ret = thrift_protocol_write_list_end (protocol, error)) < 0)
-      return -1;
-    xfer += ret;
-  }
   if ((ret = thrift_protocol_write_field_end (protocol, error)) < 0)
     return -1;
   xfer += ret;
@@ -3394,34 +6991,25 @@ bgp_configurator_add_vrf_args_write (ThriftStruct *object, ThriftProtocol *proto
 }
 
 static void
-bgp_configurator_add_vrf_args_set_property (GObject *object,
-                                            guint property_id,
-                                            const GValue *value,
-                                            GParamSpec *pspec)
+bgp_configurator_set_ebgp_multihop_args_set_property (GObject *object,
+                                                      guint property_id,
+                                                      const GValue *value,
+                                                      GParamSpec *pspec)
 {
-  BgpConfiguratorAddVrfArgs *self = BGP_CONFIGURATOR_ADD_VRF_ARGS (object);
+  BgpConfiguratorSetEbgpMultihopArgs *self = BGP_CONFIGURATOR_SET_EBGP_MULTIHOP_ARGS (object);
 
   switch (property_id)
   {
-    case PROP_BGP_CONFIGURATOR_ADD_VRF_ARGS_RD:
-      if (self->rd != NULL)
-        g_free (self->rd);
-      self->rd = g_value_dup_string (value);
-      self->__isset_rd = TRUE;
-      break;
-
-    case PROP_BGP_CONFIGURATOR_ADD_VRF_ARGS_IRTS:
-      if (self->irts != NULL)
-        g_ptr_array_unref (self->irts);
-      self->irts = g_value_dup_boxed (value);
-      self->__isset_irts = TRUE;
+    case PROP_BGP_CONFIGURATOR_SET_EBGP_MULTIHOP_ARGS_PEER_IP:
+      if (self->peerIp != NULL)
+        g_free (self->peerIp);
+      self->peerIp = g_value_dup_string (value);
+      self->__isset_peerIp = TRUE;
       break;
 
-    case PROP_BGP_CONFIGURATOR_ADD_VRF_ARGS_ERTS:
-      if (self->erts != NULL)
-        g_ptr_array_unref (self->erts);
-      self->erts = g_value_dup_boxed (value);
-      self->__isset_erts = TRUE;
+    case PROP_BGP_CONFIGURATOR_SET_EBGP_MULTIHOP_ARGS_N_HOPS:
+      self->nHops = g_value_get_int (value);
+      self->__isset_nHops = TRUE;
       break;
 
     default:
@@ -3431,25 +7019,21 @@ bgp_configurator_add_vrf_args_set_property (GObject *object,
 }
 
 static void
-bgp_configurator_add_vrf_args_get_property (GObject *object,
-                                            guint property_id,
-                                            GValue *value,
-                                            GParamSpec *pspec)
+bgp_configurator_set_ebgp_multihop_args_get_property (GObject *object,
+                                                      guint property_id,
+                                                      GValue *value,
+                                                      GParamSpec *pspec)
 {
-  BgpConfiguratorAddVrfArgs *self = BGP_CONFIGURATOR_ADD_VRF_ARGS (object);
+  BgpConfiguratorSetEbgpMultihopArgs *self = BGP_CONFIGURATOR_SET_EBGP_MULTIHOP_ARGS (object);
 
   switch (property_id)
   {
-    case PROP_BGP_CONFIGURATOR_ADD_VRF_ARGS_RD:
-      g_value_set_string (value, self->rd);
-      break;
-
-    case PROP_BGP_CONFIGURATOR_ADD_VRF_ARGS_IRTS:
-      g_value_set_boxed (value, self->irts);
+    case PROP_BGP_CONFIGURATOR_SET_EBGP_MULTIHOP_ARGS_PEER_IP:
+      g_value_set_string (value, self->peerIp);
       break;
 
-    case PROP_BGP_CONFIGURATOR_ADD_VRF_ARGS_ERTS:
-      g_value_set_boxed (value, self->erts);
+    case PROP_BGP_CONFIGURATOR_SET_EBGP_MULTIHOP_ARGS_N_HOPS:
+      g_value_set_int (value, self->nHops);
       break;
 
     default:
@@ -3459,59 +7043,47 @@ bgp_configurator_add_vrf_args_get_property (GObject *object,
 }
 
 static void 
-bgp_configurator_add_vrf_args_instance_init (BgpConfiguratorAddVrfArgs * object)
+bgp_configurator_set_ebgp_multihop_args_instance_init (BgpConfiguratorSetEbgpMultihopArgs * object)
 {
   /* satisfy -Wall */
   THRIFT_UNUSED_VAR (object);
-  object->rd = NULL;
-  object->__isset_rd = FALSE;
-  object->irts = g_ptr_array_new_with_free_func (g_free);
-  object->__isset_irts = FALSE;
-  object->erts = g_ptr_array_new_with_free_func (g_free);
-  object->__isset_erts = FALSE;
+  object->peerIp = NULL;
+  object->__isset_peerIp = FALSE;
+  object->nHops = 0;
+  object->__isset_nHops = FALSE;
 }
 
 static void 
-bgp_configurator_add_vrf_args_finalize (GObject *object)
+bgp_configurator_set_ebgp_multihop_args_finalize (GObject *object)
 {
-  BgpConfiguratorAddVrfArgs *tobject = BGP_CONFIGURATOR_ADD_VRF_ARGS (object);
+  BgpConfiguratorSetEbgpMultihopArgs *tobject = BGP_CONFIGURATOR_SET_EBGP_MULTIHOP_ARGS (object);
 
   /* satisfy -Wall in case we don't use tobject */
   THRIFT_UNUSED_VAR (tobject);
-  if (tobject->rd != NULL)
-  {
-    g_free(tobject->rd);
-    tobject->rd = NULL;
-  }
-  if (tobject->irts != NULL)
-  {
-    g_ptr_array_unref (tobject->irts);
-    tobject->irts = NULL;
-  }
-  if (tobject->erts != NULL)
+  if (tobject->peerIp != NULL)
   {
-    g_ptr_array_unref (tobject->erts);
-    tobject->erts = NULL;
+    g_free(tobject->peerIp);
+    tobject->peerIp = NULL;
   }
 }
 
 static void
-bgp_configurator_add_vrf_args_class_init (BgpConfiguratorAddVrfArgsClass * cls)
+bgp_configurator_set_ebgp_multihop_args_class_init (BgpConfiguratorSetEbgpMultihopArgsClass * cls)
 {
   GObjectClass *gobject_class = G_OBJECT_CLASS (cls);
   ThriftStructClass *struct_class = THRIFT_STRUCT_CLASS (cls);
 
-  struct_class->read = bgp_configurator_add_vrf_args_read;
-  struct_class->write = bgp_configurator_add_vrf_args_write;
+  struct_class->read = bgp_configurator_set_ebgp_multihop_args_read;
+  struct_class->write = bgp_configurator_set_ebgp_multihop_args_write;
 
-  gobject_class->finalize = bgp_configurator_add_vrf_args_finalize;
-  gobject_class->get_property = bgp_configurator_add_vrf_args_get_property;
-  gobject_class->set_property = bgp_configurator_add_vrf_args_set_property;
+  gobject_class->finalize = bgp_configurator_set_ebgp_multihop_args_finalize;
+  gobject_class->get_property = bgp_configurator_set_ebgp_multihop_args_get_property;
+  gobject_class->set_property = bgp_configurator_set_ebgp_multihop_args_set_property;
 
   g_object_class_install_property
     (gobject_class,
-     PROP_BGP_CONFIGURATOR_ADD_VRF_ARGS_RD,
-     g_param_spec_string ("rd",
+     PROP_BGP_CONFIGURATOR_SET_EBGP_MULTIHOP_ARGS_PEER_IP,
+     g_param_spec_string ("peerIp",
                           NULL,
                           NULL,
                           NULL,
@@ -3519,25 +7091,18 @@ bgp_configurator_add_vrf_args_class_init (BgpConfiguratorAddVrfArgsClass * cls)
 
   g_object_class_install_property
     (gobject_class,
-     PROP_BGP_CONFIGURATOR_ADD_VRF_ARGS_IRTS,
-     g_param_spec_boxed ("irts",
-                         NULL,
-                         NULL,
-                         G_TYPE_PTR_ARRAY,
-                         G_PARAM_READWRITE));
-
-  g_object_class_install_property
-    (gobject_class,
-     PROP_BGP_CONFIGURATOR_ADD_VRF_ARGS_ERTS,
-     g_param_spec_boxed ("erts",
-                         NULL,
-                         NULL,
-                         G_TYPE_PTR_ARRAY,
-                         G_PARAM_READWRITE));
+     PROP_BGP_CONFIGURATOR_SET_EBGP_MULTIHOP_ARGS_N_HOPS,
+     g_param_spec_int ("nHops",
+                       NULL,
+                       NULL,
+                       G_MININT32,
+                       G_MAXINT32,
+                       0,
+                       G_PARAM_READWRITE));
 }
 
 GType
-bgp_configurator_add_vrf_args_get_type (void)
+bgp_configurator_set_ebgp_multihop_args_get_type (void)
 {
   static GType type = 0;
 
@@ -3545,35 +7110,35 @@ bgp_configurator_add_vrf_args_get_type (void)
   {
     static const GTypeInfo type_info = 
     {
-      sizeof (BgpConfiguratorAddVrfArgsClass),
+      sizeof (BgpConfiguratorSetEbgpMultihopArgsClass),
       NULL, /* base_init */
       NULL, /* base_finalize */
-      (GClassInitFunc) bgp_configurator_add_vrf_args_class_init,
+      (GClassInitFunc) bgp_configurator_set_ebgp_multihop_args_class_init,
       NULL, /* class_finalize */
       NULL, /* class_data */
-      sizeof (BgpConfiguratorAddVrfArgs),
+      sizeof (BgpConfiguratorSetEbgpMultihopArgs),
       0, /* n_preallocs */
-      (GInstanceInitFunc) bgp_configurator_add_vrf_args_instance_init,
+      (GInstanceInitFunc) bgp_configurator_set_ebgp_multihop_args_instance_init,
       NULL, /* value_table */
     };
 
     type = g_type_register_static (THRIFT_TYPE_STRUCT, 
-                                   "BgpConfiguratorAddVrfArgsType",
+                                   "BgpConfiguratorSetEbgpMultihopArgsType",
                                    &type_info, 0);
   }
 
   return type;
 }
 
-enum _BgpConfiguratorAddVrfResultProperties
+enum _BgpConfiguratorSetEbgpMultihopResultProperties
 {
-  PROP_BGP_CONFIGURATOR_ADD_VRF_RESULT_0,
-  PROP_BGP_CONFIGURATOR_ADD_VRF_RESULT_SUCCESS
+  PROP_BGP_CONFIGURATOR_SET_EBGP_MULTIHOP_RESULT_0,
+  PROP_BGP_CONFIGURATOR_SET_EBGP_MULTIHOP_RESULT_SUCCESS
 };
 
-/* reads a bgp_configurator_add_vrf_result object */
+/* reads a bgp_configurator_set_ebgp_multihop_result object */
 static gint32
-bgp_configurator_add_vrf_result_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+bgp_configurator_set_ebgp_multihop_result_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
 {
   gint32 ret;
   gint32 xfer = 0;
@@ -3582,7 +7147,7 @@ bgp_configurator_add_vrf_result_read (ThriftStruct *object, ThriftProtocol *prot
   gint16 fid;
   guint32 len = 0;
   gpointer data = NULL;
-  BgpConfiguratorAddVrfResult * this_object = BGP_CONFIGURATOR_ADD_VRF_RESULT(object);
+  BgpConfiguratorSetEbgpMultihopResult * this_object = BGP_CONFIGURATOR_SET_EBGP_MULTIHOP_RESULT(object);
 
   /* satisfy -Wall in case these aren't used */
   THRIFT_UNUSED_VAR (len);
@@ -3652,14 +7217,14 @@ bgp_configurator_add_vrf_result_read (ThriftStruct *object, ThriftProtocol *prot
 }
 
 static gint32
-bgp_configurator_add_vrf_result_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+bgp_configurator_set_ebgp_multihop_result_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
 {
   gint32 ret;
   gint32 xfer = 0;
 
-  BgpConfiguratorAddVrfResult * this_object = BGP_CONFIGURATOR_ADD_VRF_RESULT(object);
+  BgpConfiguratorSetEbgpMultihopResult * this_object = BGP_CONFIGURATOR_SET_EBGP_MULTIHOP_RESULT(object);
   THRIFT_UNUSED_VAR (this_object);
-  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorAddVrfResult", error)) < 0)
+  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorSetEbgpMultihopResult", error)) < 0)
     return -1;
   xfer += ret;
   if (this_object->__isset_success == TRUE) {
@@ -3685,16 +7250,16 @@ bgp_configurator_add_vrf_result_write (ThriftStruct *object, ThriftProtocol *pro
 }
 
 static void
-bgp_configurator_add_vrf_result_set_property (GObject *object,
-                                              guint property_id,
-                                              const GValue *value,
-                                              GParamSpec *pspec)
+bgp_configurator_set_ebgp_multihop_result_set_property (GObject *object,
+                                                        guint property_id,
+                                                        const GValue *value,
+                                                        GParamSpec *pspec)
 {
-  BgpConfiguratorAddVrfResult *self = BGP_CONFIGURATOR_ADD_VRF_RESULT (object);
+  BgpConfiguratorSetEbgpMultihopResult *self = BGP_CONFIGURATOR_SET_EBGP_MULTIHOP_RESULT (object);
 
   switch (property_id)
   {
-    case PROP_BGP_CONFIGURATOR_ADD_VRF_RESULT_SUCCESS:
+    case PROP_BGP_CONFIGURATOR_SET_EBGP_MULTIHOP_RESULT_SUCCESS:
       self->success = g_value_get_int (value);
       self->__isset_success = TRUE;
       break;
@@ -3706,16 +7271,16 @@ bgp_configurator_add_vrf_result_set_property (GObject *object,
 }
 
 static void
-bgp_configurator_add_vrf_result_get_property (GObject *object,
-                                              guint property_id,
-                                              GValue *value,
-                                              GParamSpec *pspec)
+bgp_configurator_set_ebgp_multihop_result_get_property (GObject *object,
+                                                        guint property_id,
+                                                        GValue *value,
+                                                        GParamSpec *pspec)
 {
-  BgpConfiguratorAddVrfResult *self = BGP_CONFIGURATOR_ADD_VRF_RESULT (object);
+  BgpConfiguratorSetEbgpMultihopResult *self = BGP_CONFIGURATOR_SET_EBGP_MULTIHOP_RESULT (object);
 
   switch (property_id)
   {
-    case PROP_BGP_CONFIGURATOR_ADD_VRF_RESULT_SUCCESS:
+    case PROP_BGP_CONFIGURATOR_SET_EBGP_MULTIHOP_RESULT_SUCCESS:
       g_value_set_int (value, self->success);
       break;
 
@@ -3726,7 +7291,7 @@ bgp_configurator_add_vrf_result_get_property (GObject *object,
 }
 
 static void 
-bgp_configurator_add_vrf_result_instance_init (BgpConfiguratorAddVrfResult * object)
+bgp_configurator_set_ebgp_multihop_result_instance_init (BgpConfiguratorSetEbgpMultihopResult * object)
 {
   /* satisfy -Wall */
   THRIFT_UNUSED_VAR (object);
@@ -3735,30 +7300,30 @@ bgp_configurator_add_vrf_result_instance_init (BgpConfiguratorAddVrfResult * obj
 }
 
 static void 
-bgp_configurator_add_vrf_result_finalize (GObject *object)
+bgp_configurator_set_ebgp_multihop_result_finalize (GObject *object)
 {
-  BgpConfiguratorAddVrfResult *tobject = BGP_CONFIGURATOR_ADD_VRF_RESULT (object);
+  BgpConfiguratorSetEbgpMultihopResult *tobject = BGP_CONFIGURATOR_SET_EBGP_MULTIHOP_RESULT (object);
 
   /* satisfy -Wall in case we don't use tobject */
   THRIFT_UNUSED_VAR (tobject);
 }
 
 static void
-bgp_configurator_add_vrf_result_class_init (BgpConfiguratorAddVrfResultClass * cls)
+bgp_configurator_set_ebgp_multihop_result_class_init (BgpConfiguratorSetEbgpMultihopResultClass * cls)
 {
   GObjectClass *gobject_class = G_OBJECT_CLASS (cls);
   ThriftStructClass *struct_class = THRIFT_STRUCT_CLASS (cls);
 
-  struct_class->read = bgp_configurator_add_vrf_result_read;
-  struct_class->write = bgp_configurator_add_vrf_result_write;
+  struct_class->read = bgp_configurator_set_ebgp_multihop_result_read;
+  struct_class->write = bgp_configurator_set_ebgp_multihop_result_write;
 
-  gobject_class->finalize = bgp_configurator_add_vrf_result_finalize;
-  gobject_class->get_property = bgp_configurator_add_vrf_result_get_property;
-  gobject_class->set_property = bgp_configurator_add_vrf_result_set_property;
+  gobject_class->finalize = bgp_configurator_set_ebgp_multihop_result_finalize;
+  gobject_class->get_property = bgp_configurator_set_ebgp_multihop_result_get_property;
+  gobject_class->set_property = bgp_configurator_set_ebgp_multihop_result_set_property;
 
   g_object_class_install_property
     (gobject_class,
-     PROP_BGP_CONFIGURATOR_ADD_VRF_RESULT_SUCCESS,
+     PROP_BGP_CONFIGURATOR_SET_EBGP_MULTIHOP_RESULT_SUCCESS,
      g_param_spec_int ("success",
                        NULL,
                        NULL,
@@ -3769,7 +7334,7 @@ bgp_configurator_add_vrf_result_class_init (BgpConfiguratorAddVrfResultClass * c
 }
 
 GType
-bgp_configurator_add_vrf_result_get_type (void)
+bgp_configurator_set_ebgp_multihop_result_get_type (void)
 {
   static GType type = 0;
 
@@ -3777,35 +7342,35 @@ bgp_configurator_add_vrf_result_get_type (void)
   {
     static const GTypeInfo type_info = 
     {
-      sizeof (BgpConfiguratorAddVrfResultClass),
+      sizeof (BgpConfiguratorSetEbgpMultihopResultClass),
       NULL, /* base_init */
       NULL, /* base_finalize */
-      (GClassInitFunc) bgp_configurator_add_vrf_result_class_init,
+      (GClassInitFunc) bgp_configurator_set_ebgp_multihop_result_class_init,
       NULL, /* class_finalize */
       NULL, /* class_data */
-      sizeof (BgpConfiguratorAddVrfResult),
+      sizeof (BgpConfiguratorSetEbgpMultihopResult),
       0, /* n_preallocs */
-      (GInstanceInitFunc) bgp_configurator_add_vrf_result_instance_init,
+      (GInstanceInitFunc) bgp_configurator_set_ebgp_multihop_result_instance_init,
       NULL, /* value_table */
     };
 
     type = g_type_register_static (THRIFT_TYPE_STRUCT, 
-                                   "BgpConfiguratorAddVrfResultType",
+                                   "BgpConfiguratorSetEbgpMultihopResultType",
                                    &type_info, 0);
   }
 
   return type;
 }
 
-enum _BgpConfiguratorDelVrfArgsProperties
+enum _BgpConfiguratorUnsetEbgpMultihopArgsProperties
 {
-  PROP_BGP_CONFIGURATOR_DEL_VRF_ARGS_0,
-  PROP_BGP_CONFIGURATOR_DEL_VRF_ARGS_RD
+  PROP_BGP_CONFIGURATOR_UNSET_EBGP_MULTIHOP_ARGS_0,
+  PROP_BGP_CONFIGURATOR_UNSET_EBGP_MULTIHOP_ARGS_PEER_IP
 };
 
-/* reads a bgp_configurator_del_vrf_args object */
+/* reads a bgp_configurator_unset_ebgp_multihop_args object */
 static gint32
-bgp_configurator_del_vrf_args_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+bgp_configurator_unset_ebgp_multihop_args_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
 {
   gint32 ret;
   gint32 xfer = 0;
@@ -3814,7 +7379,7 @@ bgp_configurator_del_vrf_args_read (ThriftStruct *object, ThriftProtocol *protoc
   gint16 fid;
   guint32 len = 0;
   gpointer data = NULL;
-  BgpConfiguratorDelVrfArgs * this_object = BGP_CONFIGURATOR_DEL_VRF_ARGS(object);
+  BgpConfiguratorUnsetEbgpMultihopArgs * this_object = BGP_CONFIGURATOR_UNSET_EBGP_MULTIHOP_ARGS(object);
 
   /* satisfy -Wall in case these aren't used */
   THRIFT_UNUSED_VAR (len);
@@ -3855,16 +7420,16 @@ bgp_configurator_del_vrf_args_read (ThriftStruct *object, ThriftProtocol *protoc
       case 1:
         if (ftype == T_STRING)
         {
-          if (this_object->rd != NULL)
+          if (this_object->peerIp != NULL)
           {
-            g_free(this_object->rd);
-            this_object->rd = NULL;
+            g_free(this_object->peerIp);
+            this_object->peerIp = NULL;
           }
 
-          if ((ret = thrift_protocol_read_string (protocol, &this_object->rd, error)) < 0)
+          if ((ret = thrift_protocol_read_string (protocol, &this_object->peerIp, error)) < 0)
             return -1;
           xfer += ret;
-          this_object->__isset_rd = TRUE;
+          this_object->__isset_peerIp = TRUE;
         } else {
           if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
             return -1;
@@ -3890,20 +7455,20 @@ bgp_configurator_del_vrf_args_read (ThriftStruct *object, ThriftProtocol *protoc
 }
 
 static gint32
-bgp_configurator_del_vrf_args_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+bgp_configurator_unset_ebgp_multihop_args_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
 {
   gint32 ret;
   gint32 xfer = 0;
 
-  BgpConfiguratorDelVrfArgs * this_object = BGP_CONFIGURATOR_DEL_VRF_ARGS(object);
+  BgpConfiguratorUnsetEbgpMultihopArgs * this_object = BGP_CONFIGURATOR_UNSET_EBGP_MULTIHOP_ARGS(object);
   THRIFT_UNUSED_VAR (this_object);
-  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorDelVrfArgs", error)) < 0)
+  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorUnsetEbgpMultihopArgs", error)) < 0)
     return -1;
   xfer += ret;
-  if ((ret = thrift_protocol_write_field_begin (protocol, "rd", T_STRING, 1, error)) < 0)
+  if ((ret = thrift_protocol_write_field_begin (protocol, "peerIp", T_STRING, 1, error)) < 0)
     return -1;
   xfer += ret;
-  if ((ret = thrift_protocol_write_string (protocol, this_object->rd, error)) < 0)
+  if ((ret = thrift_protocol_write_string (protocol, this_object->peerIp, error)) < 0)
     return -1;
   xfer += ret;
 
@@ -3921,20 +7486,20 @@ bgp_configurator_del_vrf_args_write (ThriftStruct *object, ThriftProtocol *proto
 }
 
 static void
-bgp_configurator_del_vrf_args_set_property (GObject *object,
-                                            guint property_id,
-                                            const GValue *value,
-                                            GParamSpec *pspec)
+bgp_configurator_unset_ebgp_multihop_args_set_property (GObject *object,
+                                                        guint property_id,
+                                                        const GValue *value,
+                                                        GParamSpec *pspec)
 {
-  BgpConfiguratorDelVrfArgs *self = BGP_CONFIGURATOR_DEL_VRF_ARGS (object);
+  BgpConfiguratorUnsetEbgpMultihopArgs *self = BGP_CONFIGURATOR_UNSET_EBGP_MULTIHOP_ARGS (object);
 
   switch (property_id)
   {
-    case PROP_BGP_CONFIGURATOR_DEL_VRF_ARGS_RD:
-      if (self->rd != NULL)
-        g_free (self->rd);
-      self->rd = g_value_dup_string (value);
-      self->__isset_rd = TRUE;
+    case PROP_BGP_CONFIGURATOR_UNSET_EBGP_MULTIHOP_ARGS_PEER_IP:
+      if (self->peerIp != NULL)
+        g_free (self->peerIp);
+      self->peerIp = g_value_dup_string (value);
+      self->__isset_peerIp = TRUE;
       break;
 
     default:
@@ -3944,17 +7509,17 @@ bgp_configurator_del_vrf_args_set_property (GObject *object,
 }
 
 static void
-bgp_configurator_del_vrf_args_get_property (GObject *object,
-                                            guint property_id,
-                                            GValue *value,
-                                            GParamSpec *pspec)
+bgp_configurator_unset_ebgp_multihop_args_get_property (GObject *object,
+                                                        guint property_id,
+                                                        GValue *value,
+                                                        GParamSpec *pspec)
 {
-  BgpConfiguratorDelVrfArgs *self = BGP_CONFIGURATOR_DEL_VRF_ARGS (object);
+  BgpConfiguratorUnsetEbgpMultihopArgs *self = BGP_CONFIGURATOR_UNSET_EBGP_MULTIHOP_ARGS (object);
 
   switch (property_id)
   {
-    case PROP_BGP_CONFIGURATOR_DEL_VRF_ARGS_RD:
-      g_value_set_string (value, self->rd);
+    case PROP_BGP_CONFIGURATOR_UNSET_EBGP_MULTIHOP_ARGS_PEER_IP:
+      g_value_set_string (value, self->peerIp);
       break;
 
     default:
@@ -3964,45 +7529,45 @@ bgp_configurator_del_vrf_args_get_property (GObject *object,
 }
 
 static void 
-bgp_configurator_del_vrf_args_instance_init (BgpConfiguratorDelVrfArgs * object)
+bgp_configurator_unset_ebgp_multihop_args_instance_init (BgpConfiguratorUnsetEbgpMultihopArgs * object)
 {
   /* satisfy -Wall */
   THRIFT_UNUSED_VAR (object);
-  object->rd = NULL;
-  object->__isset_rd = FALSE;
+  object->peerIp = NULL;
+  object->__isset_peerIp = FALSE;
 }
 
 static void 
-bgp_configurator_del_vrf_args_finalize (GObject *object)
+bgp_configurator_unset_ebgp_multihop_args_finalize (GObject *object)
 {
-  BgpConfiguratorDelVrfArgs *tobject = BGP_CONFIGURATOR_DEL_VRF_ARGS (object);
+  BgpConfiguratorUnsetEbgpMultihopArgs *tobject = BGP_CONFIGURATOR_UNSET_EBGP_MULTIHOP_ARGS (object);
 
   /* satisfy -Wall in case we don't use tobject */
   THRIFT_UNUSED_VAR (tobject);
-  if (tobject->rd != NULL)
+  if (tobject->peerIp != NULL)
   {
-    g_free(tobject->rd);
-    tobject->rd = NULL;
+    g_free(tobject->peerIp);
+    tobject->peerIp = NULL;
   }
 }
 
 static void
-bgp_configurator_del_vrf_args_class_init (BgpConfiguratorDelVrfArgsClass * cls)
+bgp_configurator_unset_ebgp_multihop_args_class_init (BgpConfiguratorUnsetEbgpMultihopArgsClass * cls)
 {
   GObjectClass *gobject_class = G_OBJECT_CLASS (cls);
   ThriftStructClass *struct_class = THRIFT_STRUCT_CLASS (cls);
 
-  struct_class->read = bgp_configurator_del_vrf_args_read;
-  struct_class->write = bgp_configurator_del_vrf_args_write;
+  struct_class->read = bgp_configurator_unset_ebgp_multihop_args_read;
+  struct_class->write = bgp_configurator_unset_ebgp_multihop_args_write;
 
-  gobject_class->finalize = bgp_configurator_del_vrf_args_finalize;
-  gobject_class->get_property = bgp_configurator_del_vrf_args_get_property;
-  gobject_class->set_property = bgp_configurator_del_vrf_args_set_property;
+  gobject_class->finalize = bgp_configurator_unset_ebgp_multihop_args_finalize;
+  gobject_class->get_property = bgp_configurator_unset_ebgp_multihop_args_get_property;
+  gobject_class->set_property = bgp_configurator_unset_ebgp_multihop_args_set_property;
 
   g_object_class_install_property
     (gobject_class,
-     PROP_BGP_CONFIGURATOR_DEL_VRF_ARGS_RD,
-     g_param_spec_string ("rd",
+     PROP_BGP_CONFIGURATOR_UNSET_EBGP_MULTIHOP_ARGS_PEER_IP,
+     g_param_spec_string ("peerIp",
                           NULL,
                           NULL,
                           NULL,
@@ -4010,7 +7575,7 @@ bgp_configurator_del_vrf_args_class_init (BgpConfiguratorDelVrfArgsClass * cls)
 }
 
 GType
-bgp_configurator_del_vrf_args_get_type (void)
+bgp_configurator_unset_ebgp_multihop_args_get_type (void)
 {
   static GType type = 0;
 
@@ -4018,35 +7583,35 @@ bgp_configurator_del_vrf_args_get_type (void)
   {
     static const GTypeInfo type_info = 
     {
-      sizeof (BgpConfiguratorDelVrfArgsClass),
+      sizeof (BgpConfiguratorUnsetEbgpMultihopArgsClass),
       NULL, /* base_init */
       NULL, /* base_finalize */
-      (GClassInitFunc) bgp_configurator_del_vrf_args_class_init,
+      (GClassInitFunc) bgp_configurator_unset_ebgp_multihop_args_class_init,
       NULL, /* class_finalize */
       NULL, /* class_data */
-      sizeof (BgpConfiguratorDelVrfArgs),
+      sizeof (BgpConfiguratorUnsetEbgpMultihopArgs),
       0, /* n_preallocs */
-      (GInstanceInitFunc) bgp_configurator_del_vrf_args_instance_init,
+      (GInstanceInitFunc) bgp_configurator_unset_ebgp_multihop_args_instance_init,
       NULL, /* value_table */
     };
 
     type = g_type_register_static (THRIFT_TYPE_STRUCT, 
-                                   "BgpConfiguratorDelVrfArgsType",
+                                   "BgpConfiguratorUnsetEbgpMultihopArgsType",
                                    &type_info, 0);
   }
 
   return type;
 }
 
-enum _BgpConfiguratorDelVrfResultProperties
+enum _BgpConfiguratorUnsetEbgpMultihopResultProperties
 {
-  PROP_BGP_CONFIGURATOR_DEL_VRF_RESULT_0,
-  PROP_BGP_CONFIGURATOR_DEL_VRF_RESULT_SUCCESS
+  PROP_BGP_CONFIGURATOR_UNSET_EBGP_MULTIHOP_RESULT_0,
+  PROP_BGP_CONFIGURATOR_UNSET_EBGP_MULTIHOP_RESULT_SUCCESS
 };
 
-/* reads a bgp_configurator_del_vrf_result object */
+/* reads a bgp_configurator_unset_ebgp_multihop_result object */
 static gint32
-bgp_configurator_del_vrf_result_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+bgp_configurator_unset_ebgp_multihop_result_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
 {
   gint32 ret;
   gint32 xfer = 0;
@@ -4055,7 +7620,7 @@ bgp_configurator_del_vrf_result_read (ThriftStruct *object, ThriftProtocol *prot
   gint16 fid;
   guint32 len = 0;
   gpointer data = NULL;
-  BgpConfiguratorDelVrfResult * this_object = BGP_CONFIGURATOR_DEL_VRF_RESULT(object);
+  BgpConfiguratorUnsetEbgpMultihopResult * this_object = BGP_CONFIGURATOR_UNSET_EBGP_MULTIHOP_RESULT(object);
 
   /* satisfy -Wall in case these aren't used */
   THRIFT_UNUSED_VAR (len);
@@ -4125,14 +7690,14 @@ bgp_configurator_del_vrf_result_read (ThriftStruct *object, ThriftProtocol *prot
 }
 
 static gint32
-bgp_configurator_del_vrf_result_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+bgp_configurator_unset_ebgp_multihop_result_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
 {
   gint32 ret;
   gint32 xfer = 0;
 
-  BgpConfiguratorDelVrfResult * this_object = BGP_CONFIGURATOR_DEL_VRF_RESULT(object);
+  BgpConfiguratorUnsetEbgpMultihopResult * this_object = BGP_CONFIGURATOR_UNSET_EBGP_MULTIHOP_RESULT(object);
   THRIFT_UNUSED_VAR (this_object);
-  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorDelVrfResult", error)) < 0)
+  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorUnsetEbgpMultihopResult", error)) < 0)
     return -1;
   xfer += ret;
   if (this_object->__isset_success == TRUE) {
@@ -4158,16 +7723,16 @@ bgp_configurator_del_vrf_result_write (ThriftStruct *object, ThriftProtocol *pro
 }
 
 static void
-bgp_configurator_del_vrf_result_set_property (GObject *object,
-                                              guint property_id,
-                                              const GValue *value,
-                                              GParamSpec *pspec)
+bgp_configurator_unset_ebgp_multihop_result_set_property (GObject *object,
+                                                          guint property_id,
+                                                          const GValue *value,
+                                                          GParamSpec *pspec)
 {
-  BgpConfiguratorDelVrfResult *self = BGP_CONFIGURATOR_DEL_VRF_RESULT (object);
+  BgpConfiguratorUnsetEbgpMultihopResult *self = BGP_CONFIGURATOR_UNSET_EBGP_MULTIHOP_RESULT (object);
 
   switch (property_id)
   {
-    case PROP_BGP_CONFIGURATOR_DEL_VRF_RESULT_SUCCESS:
+    case PROP_BGP_CONFIGURATOR_UNSET_EBGP_MULTIHOP_RESULT_SUCCESS:
       self->success = g_value_get_int (value);
       self->__isset_success = TRUE;
       break;
@@ -4179,16 +7744,16 @@ bgp_configurator_del_vrf_result_set_property (GObject *object,
 }
 
 static void
-bgp_configurator_del_vrf_result_get_property (GObject *object,
-                                              guint property_id,
-                                              GValue *value,
-                                              GParamSpec *pspec)
+bgp_configurator_unset_ebgp_multihop_result_get_property (GObject *object,
+                                                          guint property_id,
+                                                          GValue *value,
+                                                          GParamSpec *pspec)
 {
-  BgpConfiguratorDelVrfResult *self = BGP_CONFIGURATOR_DEL_VRF_RESULT (object);
+  BgpConfiguratorUnsetEbgpMultihopResult *self = BGP_CONFIGURATOR_UNSET_EBGP_MULTIHOP_RESULT (object);
 
   switch (property_id)
   {
-    case PROP_BGP_CONFIGURATOR_DEL_VRF_RESULT_SUCCESS:
+    case PROP_BGP_CONFIGURATOR_UNSET_EBGP_MULTIHOP_RESULT_SUCCESS:
       g_value_set_int (value, self->success);
       break;
 
@@ -4199,7 +7764,7 @@ bgp_configurator_del_vrf_result_get_property (GObject *object,
 }
 
 static void 
-bgp_configurator_del_vrf_result_instance_init (BgpConfiguratorDelVrfResult * object)
+bgp_configurator_unset_ebgp_multihop_result_instance_init (BgpConfiguratorUnsetEbgpMultihopResult * object)
 {
   /* satisfy -Wall */
   THRIFT_UNUSED_VAR (object);
@@ -4208,30 +7773,30 @@ bgp_configurator_del_vrf_result_instance_init (BgpConfiguratorDelVrfResult * obj
 }
 
 static void 
-bgp_configurator_del_vrf_result_finalize (GObject *object)
+bgp_configurator_unset_ebgp_multihop_result_finalize (GObject *object)
 {
-  BgpConfiguratorDelVrfResult *tobject = BGP_CONFIGURATOR_DEL_VRF_RESULT (object);
+  BgpConfiguratorUnsetEbgpMultihopResult *tobject = BGP_CONFIGURATOR_UNSET_EBGP_MULTIHOP_RESULT (object);
 
   /* satisfy -Wall in case we don't use tobject */
   THRIFT_UNUSED_VAR (tobject);
 }
 
 static void
-bgp_configurator_del_vrf_result_class_init (BgpConfiguratorDelVrfResultClass * cls)
+bgp_configurator_unset_ebgp_multihop_result_class_init (BgpConfiguratorUnsetEbgpMultihopResultClass * cls)
 {
   GObjectClass *gobject_class = G_OBJECT_CLASS (cls);
   ThriftStructClass *struct_class = THRIFT_STRUCT_CLASS (cls);
 
-  struct_class->read = bgp_configurator_del_vrf_result_read;
-  struct_class->write = bgp_configurator_del_vrf_result_write;
+  struct_class->read = bgp_configurator_unset_ebgp_multihop_result_read;
+  struct_class->write = bgp_configurator_unset_ebgp_multihop_result_write;
 
-  gobject_class->finalize = bgp_configurator_del_vrf_result_finalize;
-  gobject_class->get_property = bgp_configurator_del_vrf_result_get_property;
-  gobject_class->set_property = bgp_configurator_del_vrf_result_set_property;
+  gobject_class->finalize = bgp_configurator_unset_ebgp_multihop_result_finalize;
+  gobject_class->get_property = bgp_configurator_unset_ebgp_multihop_result_get_property;
+  gobject_class->set_property = bgp_configurator_unset_ebgp_multihop_result_set_property;
 
   g_object_class_install_property
     (gobject_class,
-     PROP_BGP_CONFIGURATOR_DEL_VRF_RESULT_SUCCESS,
+     PROP_BGP_CONFIGURATOR_UNSET_EBGP_MULTIHOP_RESULT_SUCCESS,
      g_param_spec_int ("success",
                        NULL,
                        NULL,
@@ -4242,7 +7807,7 @@ bgp_configurator_del_vrf_result_class_init (BgpConfiguratorDelVrfResultClass * c
 }
 
 GType
-bgp_configurator_del_vrf_result_get_type (void)
+bgp_configurator_unset_ebgp_multihop_result_get_type (void)
 {
   static GType type = 0;
 
@@ -4250,38 +7815,36 @@ bgp_configurator_del_vrf_result_get_type (void)
   {
     static const GTypeInfo type_info = 
     {
-      sizeof (BgpConfiguratorDelVrfResultClass),
+      sizeof (BgpConfiguratorUnsetEbgpMultihopResultClass),
       NULL, /* base_init */
       NULL, /* base_finalize */
-      (GClassInitFunc) bgp_configurator_del_vrf_result_class_init,
+      (GClassInitFunc) bgp_configurator_unset_ebgp_multihop_result_class_init,
       NULL, /* class_finalize */
       NULL, /* class_data */
-      sizeof (BgpConfiguratorDelVrfResult),
+      sizeof (BgpConfiguratorUnsetEbgpMultihopResult),
       0, /* n_preallocs */
-      (GInstanceInitFunc) bgp_configurator_del_vrf_result_instance_init,
+      (GInstanceInitFunc) bgp_configurator_unset_ebgp_multihop_result_instance_init,
       NULL, /* value_table */
     };
 
     type = g_type_register_static (THRIFT_TYPE_STRUCT, 
-                                   "BgpConfiguratorDelVrfResultType",
+                                   "BgpConfiguratorUnsetEbgpMultihopResultType",
                                    &type_info, 0);
   }
 
   return type;
 }
 
-enum _BgpConfiguratorPushRouteArgsProperties
+enum _BgpConfiguratorSetUpdateSourceArgsProperties
 {
-  PROP_BGP_CONFIGURATOR_PUSH_ROUTE_ARGS_0,
-  PROP_BGP_CONFIGURATOR_PUSH_ROUTE_ARGS_PREFIX,
-  PROP_BGP_CONFIGURATOR_PUSH_ROUTE_ARGS_NEXTHOP,
-  PROP_BGP_CONFIGURATOR_PUSH_ROUTE_ARGS_RD,
-  PROP_BGP_CONFIGURATOR_PUSH_ROUTE_ARGS_LABEL
+  PROP_BGP_CONFIGURATOR_SET_UPDATE_SOURCE_ARGS_0,
+  PROP_BGP_CONFIGURATOR_SET_UPDATE_SOURCE_ARGS_PEER_IP,
+  PROP_BGP_CONFIGURATOR_SET_UPDATE_SOURCE_ARGS_SRC_IP
 };
 
-/* reads a bgp_configurator_push_route_args object */
+/* reads a bgp_configurator_set_update_source_args object */
 static gint32
-bgp_configurator_push_route_args_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+bgp_configurator_set_update_source_args_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
 {
   gint32 ret;
   gint32 xfer = 0;
@@ -4290,7 +7853,7 @@ bgp_configurator_push_route_args_read (ThriftStruct *object, ThriftProtocol *pro
   gint16 fid;
   guint32 len = 0;
   gpointer data = NULL;
-  BgpConfiguratorPushRouteArgs * this_object = BGP_CONFIGURATOR_PUSH_ROUTE_ARGS(object);
+  BgpConfiguratorSetUpdateSourceArgs * this_object = BGP_CONFIGURATOR_SET_UPDATE_SOURCE_ARGS(object);
 
   /* satisfy -Wall in case these aren't used */
   THRIFT_UNUSED_VAR (len);
@@ -4331,67 +7894,35 @@ bgp_configurator_push_route_args_read (ThriftStruct *object, ThriftProtocol *pro
       case 1:
         if (ftype == T_STRING)
         {
-          if (this_object->prefix != NULL)
-          {
-            g_free(this_object->prefix);
-            this_object->prefix = NULL;
-          }
-
-          if ((ret = thrift_protocol_read_string (protocol, &this_object->prefix, error)) < 0)
-            return -1;
-          xfer += ret;
-          this_object->__isset_prefix = TRUE;
-        } else {
-          if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
-            return -1;
-          xfer += ret;
-        }
-        break;
-      case 2:
-        if (ftype == T_STRING)
-        {
-          if (this_object->nexthop != NULL)
-          {
-            g_free(this_object->nexthop);
-            this_object->nexthop = NULL;
+          if (this_object->peerIp != NULL)
+          {
+            g_free(this_object->peerIp);
+            this_object->peerIp = NULL;
           }
 
-          if ((ret = thrift_protocol_read_string (protocol, &this_object->nexthop, error)) < 0)
+          if ((ret = thrift_protocol_read_string (protocol, &this_object->peerIp, error)) < 0)
             return -1;
           xfer += ret;
-          this_object->__isset_nexthop = TRUE;
+          this_object->__isset_peerIp = TRUE;
         } else {
           if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
             return -1;
           xfer += ret;
         }
         break;
-      case 3:
+      case 2:
         if (ftype == T_STRING)
         {
-          if (this_object->rd != NULL)
+          if (this_object->srcIp != NULL)
           {
-            g_free(this_object->rd);
-            this_object->rd = NULL;
+            g_free(this_object->srcIp);
+            this_object->srcIp = NULL;
           }
 
-          if ((ret = thrift_protocol_read_string (protocol, &this_object->rd, error)) < 0)
-            return -1;
-          xfer += ret;
-          this_object->__isset_rd = TRUE;
-        } else {
-          if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
-            return -1;
-          xfer += ret;
-        }
-        break;
-      case 4:
-        if (ftype == T_I32)
-        {
-          if ((ret = thrift_protocol_read_i32 (protocol, &this_object->label, error)) < 0)
+          if ((ret = thrift_protocol_read_string (protocol, &this_object->srcIp, error)) < 0)
             return -1;
           xfer += ret;
-          this_object->__isset_label = TRUE;
+          this_object->__isset_srcIp = TRUE;
         } else {
           if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
             return -1;
@@ -4417,50 +7948,30 @@ bgp_configurator_push_route_args_read (ThriftStruct *object, ThriftProtocol *pro
 }
 
 static gint32
-bgp_configurator_push_route_args_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+bgp_configurator_set_update_source_args_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
 {
   gint32 ret;
   gint32 xfer = 0;
 
-  BgpConfiguratorPushRouteArgs * this_object = BGP_CONFIGURATOR_PUSH_ROUTE_ARGS(object);
+  BgpConfiguratorSetUpdateSourceArgs * this_object = BGP_CONFIGURATOR_SET_UPDATE_SOURCE_ARGS(object);
   THRIFT_UNUSED_VAR (this_object);
-  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorPushRouteArgs", error)) < 0)
-    return -1;
-  xfer += ret;
-  if ((ret = thrift_protocol_write_field_begin (protocol, "prefix", T_STRING, 1, error)) < 0)
-    return -1;
-  xfer += ret;
-  if ((ret = thrift_protocol_write_string (protocol, this_object->prefix, error)) < 0)
-    return -1;
-  xfer += ret;
-
-  if ((ret = thrift_protocol_write_field_end (protocol, error)) < 0)
-    return -1;
-  xfer += ret;
-  if ((ret = thrift_protocol_write_field_begin (protocol, "nexthop", T_STRING, 2, error)) < 0)
-    return -1;
-  xfer += ret;
-  if ((ret = thrift_protocol_write_string (protocol, this_object->nexthop, error)) < 0)
-    return -1;
-  xfer += ret;
-
-  if ((ret = thrift_protocol_write_field_end (protocol, error)) < 0)
+  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorSetUpdateSourceArgs", error)) < 0)
     return -1;
   xfer += ret;
-  if ((ret = thrift_protocol_write_field_begin (protocol, "rd", T_STRING, 3, error)) < 0)
+  if ((ret = thrift_protocol_write_field_begin (protocol, "peerIp", T_STRING, 1, error)) < 0)
     return -1;
   xfer += ret;
-  if ((ret = thrift_protocol_write_string (protocol, this_object->rd, error)) < 0)
+  if ((ret = thrift_protocol_write_string (protocol, this_object->peerIp, error)) < 0)
     return -1;
   xfer += ret;
 
   if ((ret = thrift_protocol_write_field_end (protocol, error)) < 0)
     return -1;
   xfer += ret;
-  if ((ret = thrift_protocol_write_field_begin (protocol, "label", T_I32, 4, error)) < 0)
+  if ((ret = thrift_protocol_write_field_begin (protocol, "srcIp", T_STRING, 2, error)) < 0)
     return -1;
   xfer += ret;
-  if ((ret = thrift_protocol_write_i32 (protocol, this_object->label, error)) < 0)
+  if ((ret = thrift_protocol_write_string (protocol, this_object->srcIp, error)) < 0)
     return -1;
   xfer += ret;
 
@@ -4478,39 +7989,27 @@ bgp_configurator_push_route_args_write (ThriftStruct *object, ThriftProtocol *pr
 }
 
 static void
-bgp_configurator_push_route_args_set_property (GObject *object,
-                                               guint property_id,
-                                               const GValue *value,
-                                               GParamSpec *pspec)
+bgp_configurator_set_update_source_args_set_property (GObject *object,
+                                                      guint property_id,
+                                                      const GValue *value,
+                                                      GParamSpec *pspec)
 {
-  BgpConfiguratorPushRouteArgs *self = BGP_CONFIGURATOR_PUSH_ROUTE_ARGS (object);
+  BgpConfiguratorSetUpdateSourceArgs *self = BGP_CONFIGURATOR_SET_UPDATE_SOURCE_ARGS (object);
 
   switch (property_id)
   {
-    case PROP_BGP_CONFIGURATOR_PUSH_ROUTE_ARGS_PREFIX:
-      if (self->prefix != NULL)
-        g_free (self->prefix);
-      self->prefix = g_value_dup_string (value);
-      self->__isset_prefix = TRUE;
-      break;
-
-    case PROP_BGP_CONFIGURATOR_PUSH_ROUTE_ARGS_NEXTHOP:
-      if (self->nexthop != NULL)
-        g_free (self->nexthop);
-      self->nexthop = g_value_dup_string (value);
-      self->__isset_nexthop = TRUE;
-      break;
-
-    case PROP_BGP_CONFIGURATOR_PUSH_ROUTE_ARGS_RD:
-      if (self->rd != NULL)
-        g_free (self->rd);
-      self->rd = g_value_dup_string (value);
-      self->__isset_rd = TRUE;
+    case PROP_BGP_CONFIGURATOR_SET_UPDATE_SOURCE_ARGS_PEER_IP:
+      if (self->peerIp != NULL)
+        g_free (self->peerIp);
+      self->peerIp = g_value_dup_string (value);
+      self->__isset_peerIp = TRUE;
       break;
 
-    case PROP_BGP_CONFIGURATOR_PUSH_ROUTE_ARGS_LABEL:
-      self->label = g_value_get_int (value);
-      self->__isset_label = TRUE;
+    case PROP_BGP_CONFIGURATOR_SET_UPDATE_SOURCE_ARGS_SRC_IP:
+      if (self->srcIp != NULL)
+        g_free (self->srcIp);
+      self->srcIp = g_value_dup_string (value);
+      self->__isset_srcIp = TRUE;
       break;
 
     default:
@@ -4520,29 +8019,21 @@ bgp_configurator_push_route_args_set_property (GObject *object,
 }
 
 static void
-bgp_configurator_push_route_args_get_property (GObject *object,
-                                               guint property_id,
-                                               GValue *value,
-                                               GParamSpec *pspec)
+bgp_configurator_set_update_source_args_get_property (GObject *object,
+                                                      guint property_id,
+                                                      GValue *value,
+                                                      GParamSpec *pspec)
 {
-  BgpConfiguratorPushRouteArgs *self = BGP_CONFIGURATOR_PUSH_ROUTE_ARGS (object);
+  BgpConfiguratorSetUpdateSourceArgs *self = BGP_CONFIGURATOR_SET_UPDATE_SOURCE_ARGS (object);
 
   switch (property_id)
   {
-    case PROP_BGP_CONFIGURATOR_PUSH_ROUTE_ARGS_PREFIX:
-      g_value_set_string (value, self->prefix);
-      break;
-
-    case PROP_BGP_CONFIGURATOR_PUSH_ROUTE_ARGS_NEXTHOP:
-      g_value_set_string (value, self->nexthop);
-      break;
-
-    case PROP_BGP_CONFIGURATOR_PUSH_ROUTE_ARGS_RD:
-      g_value_set_string (value, self->rd);
+    case PROP_BGP_CONFIGURATOR_SET_UPDATE_SOURCE_ARGS_PEER_IP:
+      g_value_set_string (value, self->peerIp);
       break;
 
-    case PROP_BGP_CONFIGURATOR_PUSH_ROUTE_ARGS_LABEL:
-      g_value_set_int (value, self->label);
+    case PROP_BGP_CONFIGURATOR_SET_UPDATE_SOURCE_ARGS_SRC_IP:
+      g_value_set_string (value, self->srcIp);
       break;
 
     default:
@@ -4552,70 +8043,52 @@ bgp_configurator_push_route_args_get_property (GObject *object,
 }
 
 static void 
-bgp_configurator_push_route_args_instance_init (BgpConfiguratorPushRouteArgs * object)
+bgp_configurator_set_update_source_args_instance_init (BgpConfiguratorSetUpdateSourceArgs * object)
 {
   /* satisfy -Wall */
   THRIFT_UNUSED_VAR (object);
-  object->prefix = NULL;
-  object->__isset_prefix = FALSE;
-  object->nexthop = NULL;
-  object->__isset_nexthop = FALSE;
-  object->rd = NULL;
-  object->__isset_rd = FALSE;
-  object->label = 0;
-  object->__isset_label = FALSE;
+  object->peerIp = NULL;
+  object->__isset_peerIp = FALSE;
+  object->srcIp = NULL;
+  object->__isset_srcIp = FALSE;
 }
 
 static void 
-bgp_configurator_push_route_args_finalize (GObject *object)
+bgp_configurator_set_update_source_args_finalize (GObject *object)
 {
-  BgpConfiguratorPushRouteArgs *tobject = BGP_CONFIGURATOR_PUSH_ROUTE_ARGS (object);
+  BgpConfiguratorSetUpdateSourceArgs *tobject = BGP_CONFIGURATOR_SET_UPDATE_SOURCE_ARGS (object);
 
   /* satisfy -Wall in case we don't use tobject */
   THRIFT_UNUSED_VAR (tobject);
-  if (tobject->prefix != NULL)
-  {
-    g_free(tobject->prefix);
-    tobject->prefix = NULL;
-  }
-  if (tobject->nexthop != NULL)
+  if (tobject->peerIp != NULL)
   {
-    g_free(tobject->nexthop);
-    tobject->nexthop = NULL;
+    g_free(tobject->peerIp);
+    tobject->peerIp = NULL;
   }
-  if (tobject->rd != NULL)
+  if (tobject->srcIp != NULL)
   {
-    g_free(tobject->rd);
-    tobject->rd = NULL;
+    g_free(tobject->srcIp);
+    tobject->srcIp = NULL;
   }
 }
 
 static void
-bgp_configurator_push_route_args_class_init (BgpConfiguratorPushRouteArgsClass * cls)
+bgp_configurator_set_update_source_args_class_init (BgpConfiguratorSetUpdateSourceArgsClass * cls)
 {
   GObjectClass *gobject_class = G_OBJECT_CLASS (cls);
   ThriftStructClass *struct_class = THRIFT_STRUCT_CLASS (cls);
 
-  struct_class->read = bgp_configurator_push_route_args_read;
-  struct_class->write = bgp_configurator_push_route_args_write;
-
-  gobject_class->finalize = bgp_configurator_push_route_args_finalize;
-  gobject_class->get_property = bgp_configurator_push_route_args_get_property;
-  gobject_class->set_property = bgp_configurator_push_route_args_set_property;
+  struct_class->read = bgp_configurator_set_update_source_args_read;
+  struct_class->write = bgp_configurator_set_update_source_args_write;
 
-  g_object_class_install_property
-    (gobject_class,
-     PROP_BGP_CONFIGURATOR_PUSH_ROUTE_ARGS_PREFIX,
-     g_param_spec_string ("prefix",
-                          NULL,
-                          NULL,
-                          NULL,
-                          G_PARAM_READWRITE));
+  gobject_class->finalize = bgp_configurator_set_update_source_args_finalize;
+  gobject_class->get_property = bgp_configurator_set_update_source_args_get_property;
+  gobject_class->set_property = bgp_configurator_set_update_source_args_set_property;
 
   g_object_class_install_property
     (gobject_class,
-     PROP_BGP_CONFIGURATOR_PUSH_ROUTE_ARGS_NEXTHOP,
-     g_param_spec_string ("nexthop",
+     PROP_BGP_CONFIGURATOR_SET_UPDATE_SOURCE_ARGS_PEER_IP,
+     g_param_spec_string ("peerIp",
                           NULL,
                           NULL,
                           NULL,
@@ -4623,27 +8096,16 @@ bgp_configurator_push_route_args_class_init (BgpConfiguratorPushRouteArgsClass *
 
   g_object_class_install_property
     (gobject_class,
-     PROP_BGP_CONFIGURATOR_PUSH_ROUTE_ARGS_RD,
-     g_param_spec_string ("rd",
+     PROP_BGP_CONFIGURATOR_SET_UPDATE_SOURCE_ARGS_SRC_IP,
+     g_param_spec_string ("srcIp",
                           NULL,
                           NULL,
                           NULL,
                           G_PARAM_READWRITE));
-
-  g_object_class_install_property
-    (gobject_class,
-     PROP_BGP_CONFIGURATOR_PUSH_ROUTE_ARGS_LABEL,
-     g_param_spec_int ("label",
-                       NULL,
-                       NULL,
-                       G_MININT32,
-                       G_MAXINT32,
-                       0,
-                       G_PARAM_READWRITE));
 }
 
 GType
-bgp_configurator_push_route_args_get_type (void)
+bgp_configurator_set_update_source_args_get_type (void)
 {
   static GType type = 0;
 
@@ -4651,35 +8113,35 @@ bgp_configurator_push_route_args_get_type (void)
   {
     static const GTypeInfo type_info = 
     {
-      sizeof (BgpConfiguratorPushRouteArgsClass),
+      sizeof (BgpConfiguratorSetUpdateSourceArgsClass),
       NULL, /* base_init */
       NULL, /* base_finalize */
-      (GClassInitFunc) bgp_configurator_push_route_args_class_init,
+      (GClassInitFunc) bgp_configurator_set_update_source_args_class_init,
       NULL, /* class_finalize */
       NULL, /* class_data */
-      sizeof (BgpConfiguratorPushRouteArgs),
+      sizeof (BgpConfiguratorSetUpdateSourceArgs),
       0, /* n_preallocs */
-      (GInstanceInitFunc) bgp_configurator_push_route_args_instance_init,
+      (GInstanceInitFunc) bgp_configurator_set_update_source_args_instance_init,
       NULL, /* value_table */
     };
 
     type = g_type_register_static (THRIFT_TYPE_STRUCT, 
-                                   "BgpConfiguratorPushRouteArgsType",
+                                   "BgpConfiguratorSetUpdateSourceArgsType",
                                    &type_info, 0);
   }
 
   return type;
 }
 
-enum _BgpConfiguratorPushRouteResultProperties
+enum _BgpConfiguratorSetUpdateSourceResultProperties
 {
-  PROP_BGP_CONFIGURATOR_PUSH_ROUTE_RESULT_0,
-  PROP_BGP_CONFIGURATOR_PUSH_ROUTE_RESULT_SUCCESS
+  PROP_BGP_CONFIGURATOR_SET_UPDATE_SOURCE_RESULT_0,
+  PROP_BGP_CONFIGURATOR_SET_UPDATE_SOURCE_RESULT_SUCCESS
 };
 
-/* reads a bgp_configurator_push_route_result object */
+/* reads a bgp_configurator_set_update_source_result object */
 static gint32
-bgp_configurator_push_route_result_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+bgp_configurator_set_update_source_result_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
 {
   gint32 ret;
   gint32 xfer = 0;
@@ -4688,7 +8150,7 @@ bgp_configurator_push_route_result_read (ThriftStruct *object, ThriftProtocol *p
   gint16 fid;
   guint32 len = 0;
   gpointer data = NULL;
-  BgpConfiguratorPushRouteResult * this_object = BGP_CONFIGURATOR_PUSH_ROUTE_RESULT(object);
+  BgpConfiguratorSetUpdateSourceResult * this_object = BGP_CONFIGURATOR_SET_UPDATE_SOURCE_RESULT(object);
 
   /* satisfy -Wall in case these aren't used */
   THRIFT_UNUSED_VAR (len);
@@ -4758,14 +8220,14 @@ bgp_configurator_push_route_result_read (ThriftStruct *object, ThriftProtocol *p
 }
 
 static gint32
-bgp_configurator_push_route_result_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+bgp_configurator_set_update_source_result_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
 {
   gint32 ret;
   gint32 xfer = 0;
 
-  BgpConfiguratorPushRouteResult * this_object = BGP_CONFIGURATOR_PUSH_ROUTE_RESULT(object);
+  BgpConfiguratorSetUpdateSourceResult * this_object = BGP_CONFIGURATOR_SET_UPDATE_SOURCE_RESULT(object);
   THRIFT_UNUSED_VAR (this_object);
-  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorPushRouteResult", error)) < 0)
+  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorSetUpdateSourceResult", error)) < 0)
     return -1;
   xfer += ret;
   if (this_object->__isset_success == TRUE) {
@@ -4791,16 +8253,16 @@ bgp_configurator_push_route_result_write (ThriftStruct *object, ThriftProtocol *
 }
 
 static void
-bgp_configurator_push_route_result_set_property (GObject *object,
-                                                 guint property_id,
-                                                 const GValue *value,
-                                                 GParamSpec *pspec)
+bgp_configurator_set_update_source_result_set_property (GObject *object,
+                                                        guint property_id,
+                                                        const GValue *value,
+                                                        GParamSpec *pspec)
 {
-  BgpConfiguratorPushRouteResult *self = BGP_CONFIGURATOR_PUSH_ROUTE_RESULT (object);
+  BgpConfiguratorSetUpdateSourceResult *self = BGP_CONFIGURATOR_SET_UPDATE_SOURCE_RESULT (object);
 
   switch (property_id)
   {
-    case PROP_BGP_CONFIGURATOR_PUSH_ROUTE_RESULT_SUCCESS:
+    case PROP_BGP_CONFIGURATOR_SET_UPDATE_SOURCE_RESULT_SUCCESS:
       self->success = g_value_get_int (value);
       self->__isset_success = TRUE;
       break;
@@ -4812,16 +8274,16 @@ bgp_configurator_push_route_result_set_property (GObject *object,
 }
 
 static void
-bgp_configurator_push_route_result_get_property (GObject *object,
-                                                 guint property_id,
-                                                 GValue *value,
-                                                 GParamSpec *pspec)
+bgp_configurator_set_update_source_result_get_property (GObject *object,
+                                                        guint property_id,
+                                                        GValue *value,
+                                                        GParamSpec *pspec)
 {
-  BgpConfiguratorPushRouteResult *self = BGP_CONFIGURATOR_PUSH_ROUTE_RESULT (object);
+  BgpConfiguratorSetUpdateSourceResult *self = BGP_CONFIGURATOR_SET_UPDATE_SOURCE_RESULT (object);
 
   switch (property_id)
   {
-    case PROP_BGP_CONFIGURATOR_PUSH_ROUTE_RESULT_SUCCESS:
+    case PROP_BGP_CONFIGURATOR_SET_UPDATE_SOURCE_RESULT_SUCCESS:
       g_value_set_int (value, self->success);
       break;
 
@@ -4832,7 +8294,7 @@ bgp_configurator_push_route_result_get_property (GObject *object,
 }
 
 static void 
-bgp_configurator_push_route_result_instance_init (BgpConfiguratorPushRouteResult * object)
+bgp_configurator_set_update_source_result_instance_init (BgpConfiguratorSetUpdateSourceResult * object)
 {
   /* satisfy -Wall */
   THRIFT_UNUSED_VAR (object);
@@ -4841,30 +8303,30 @@ bgp_configurator_push_route_result_instance_init (BgpConfiguratorPushRouteResult
 }
 
 static void 
-bgp_configurator_push_route_result_finalize (GObject *object)
+bgp_configurator_set_update_source_result_finalize (GObject *object)
 {
-  BgpConfiguratorPushRouteResult *tobject = BGP_CONFIGURATOR_PUSH_ROUTE_RESULT (object);
+  BgpConfiguratorSetUpdateSourceResult *tobject = BGP_CONFIGURATOR_SET_UPDATE_SOURCE_RESULT (object);
 
   /* satisfy -Wall in case we don't use tobject */
   THRIFT_UNUSED_VAR (tobject);
 }
 
 static void
-bgp_configurator_push_route_result_class_init (BgpConfiguratorPushRouteResultClass * cls)
+bgp_configurator_set_update_source_result_class_init (BgpConfiguratorSetUpdateSourceResultClass * cls)
 {
   GObjectClass *gobject_class = G_OBJECT_CLASS (cls);
   ThriftStructClass *struct_class = THRIFT_STRUCT_CLASS (cls);
 
-  struct_class->read = bgp_configurator_push_route_result_read;
-  struct_class->write = bgp_configurator_push_route_result_write;
+  struct_class->read = bgp_configurator_set_update_source_result_read;
+  struct_class->write = bgp_configurator_set_update_source_result_write;
 
-  gobject_class->finalize = bgp_configurator_push_route_result_finalize;
-  gobject_class->get_property = bgp_configurator_push_route_result_get_property;
-  gobject_class->set_property = bgp_configurator_push_route_result_set_property;
+  gobject_class->finalize = bgp_configurator_set_update_source_result_finalize;
+  gobject_class->get_property = bgp_configurator_set_update_source_result_get_property;
+  gobject_class->set_property = bgp_configurator_set_update_source_result_set_property;
 
   g_object_class_install_property
     (gobject_class,
-     PROP_BGP_CONFIGURATOR_PUSH_ROUTE_RESULT_SUCCESS,
+     PROP_BGP_CONFIGURATOR_SET_UPDATE_SOURCE_RESULT_SUCCESS,
      g_param_spec_int ("success",
                        NULL,
                        NULL,
@@ -4875,7 +8337,7 @@ bgp_configurator_push_route_result_class_init (BgpConfiguratorPushRouteResultCla
 }
 
 GType
-bgp_configurator_push_route_result_get_type (void)
+bgp_configurator_set_update_source_result_get_type (void)
 {
   static GType type = 0;
 
@@ -4883,36 +8345,35 @@ bgp_configurator_push_route_result_get_type (void)
   {
     static const GTypeInfo type_info = 
     {
-      sizeof (BgpConfiguratorPushRouteResultClass),
+      sizeof (BgpConfiguratorSetUpdateSourceResultClass),
       NULL, /* base_init */
       NULL, /* base_finalize */
-      (GClassInitFunc) bgp_configurator_push_route_result_class_init,
+      (GClassInitFunc) bgp_configurator_set_update_source_result_class_init,
       NULL, /* class_finalize */
       NULL, /* class_data */
-      sizeof (BgpConfiguratorPushRouteResult),
+      sizeof (BgpConfiguratorSetUpdateSourceResult),
       0, /* n_preallocs */
-      (GInstanceInitFunc) bgp_configurator_push_route_result_instance_init,
+      (GInstanceInitFunc) bgp_configurator_set_update_source_result_instance_init,
       NULL, /* value_table */
     };
 
     type = g_type_register_static (THRIFT_TYPE_STRUCT, 
-                                   "BgpConfiguratorPushRouteResultType",
+                                   "BgpConfiguratorSetUpdateSourceResultType",
                                    &type_info, 0);
   }
 
   return type;
 }
 
-enum _BgpConfiguratorWithdrawRouteArgsProperties
+enum _BgpConfiguratorUnsetUpdateSourceArgsProperties
 {
-  PROP_BGP_CONFIGURATOR_WITHDRAW_ROUTE_ARGS_0,
-  PROP_BGP_CONFIGURATOR_WITHDRAW_ROUTE_ARGS_PREFIX,
-  PROP_BGP_CONFIGURATOR_WITHDRAW_ROUTE_ARGS_RD
+  PROP_BGP_CONFIGURATOR_UNSET_UPDATE_SOURCE_ARGS_0,
+  PROP_BGP_CONFIGURATOR_UNSET_UPDATE_SOURCE_ARGS_PEER_IP
 };
 
-/* reads a bgp_configurator_withdraw_route_args object */
+/* reads a bgp_configurator_unset_update_source_args object */
 static gint32
-bgp_configurator_withdraw_route_args_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+bgp_configurator_unset_update_source_args_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
 {
   gint32 ret;
   gint32 xfer = 0;
@@ -4921,7 +8382,7 @@ bgp_configurator_withdraw_route_args_read (ThriftStruct *object, ThriftProtocol
   gint16 fid;
   guint32 len = 0;
   gpointer data = NULL;
-  BgpConfiguratorWithdrawRouteArgs * this_object = BGP_CONFIGURATOR_WITHDRAW_ROUTE_ARGS(object);
+  BgpConfiguratorUnsetUpdateSourceArgs * this_object = BGP_CONFIGURATOR_UNSET_UPDATE_SOURCE_ARGS(object);
 
   /* satisfy -Wall in case these aren't used */
   THRIFT_UNUSED_VAR (len);
@@ -4962,35 +8423,16 @@ bgp_configurator_withdraw_route_args_read (ThriftStruct *object, ThriftProtocol
       case 1:
         if (ftype == T_STRING)
         {
-          if (this_object->prefix != NULL)
-          {
-            g_free(this_object->prefix);
-            this_object->prefix = NULL;
-          }
-
-          if ((ret = thrift_protocol_read_string (protocol, &this_object->prefix, error)) < 0)
-            return -1;
-          xfer += ret;
-          this_object->__isset_prefix = TRUE;
-        } else {
-          if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
-            return -1;
-          xfer += ret;
-        }
-        break;
-      case 2:
-        if (ftype == T_STRING)
-        {
-          if (this_object->rd != NULL)
+          if (this_object->peerIp != NULL)
           {
-            g_free(this_object->rd);
-            this_object->rd = NULL;
+            g_free(this_object->peerIp);
+            this_object->peerIp = NULL;
           }
 
-          if ((ret = thrift_protocol_read_string (protocol, &this_object->rd, error)) < 0)
+          if ((ret = thrift_protocol_read_string (protocol, &this_object->peerIp, error)) < 0)
             return -1;
           xfer += ret;
-          this_object->__isset_rd = TRUE;
+          this_object->__isset_peerIp = TRUE;
         } else {
           if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
             return -1;
@@ -5016,30 +8458,20 @@ bgp_configurator_withdraw_route_args_read (ThriftStruct *object, ThriftProtocol
 }
 
 static gint32
-bgp_configurator_withdraw_route_args_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+bgp_configurator_unset_update_source_args_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
 {
   gint32 ret;
   gint32 xfer = 0;
 
-  BgpConfiguratorWithdrawRouteArgs * this_object = BGP_CONFIGURATOR_WITHDRAW_ROUTE_ARGS(object);
+  BgpConfiguratorUnsetUpdateSourceArgs * this_object = BGP_CONFIGURATOR_UNSET_UPDATE_SOURCE_ARGS(object);
   THRIFT_UNUSED_VAR (this_object);
-  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorWithdrawRouteArgs", error)) < 0)
-    return -1;
-  xfer += ret;
-  if ((ret = thrift_protocol_write_field_begin (protocol, "prefix", T_STRING, 1, error)) < 0)
-    return -1;
-  xfer += ret;
-  if ((ret = thrift_protocol_write_string (protocol, this_object->prefix, error)) < 0)
-    return -1;
-  xfer += ret;
-
-  if ((ret = thrift_protocol_write_field_end (protocol, error)) < 0)
+  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorUnsetUpdateSourceArgs", error)) < 0)
     return -1;
   xfer += ret;
-  if ((ret = thrift_protocol_write_field_begin (protocol, "rd", T_STRING, 2, error)) < 0)
+  if ((ret = thrift_protocol_write_field_begin (protocol, "peerIp", T_STRING, 1, error)) < 0)
     return -1;
   xfer += ret;
-  if ((ret = thrift_protocol_write_string (protocol, this_object->rd, error)) < 0)
+  if ((ret = thrift_protocol_write_string (protocol, this_object->peerIp, error)) < 0)
     return -1;
   xfer += ret;
 
@@ -5057,27 +8489,20 @@ bgp_configurator_withdraw_route_args_write (ThriftStruct *object, ThriftProtocol
 }
 
 static void
-bgp_configurator_withdraw_route_args_set_property (GObject *object,
-                                                   guint property_id,
-                                                   const GValue *value,
-                                                   GParamSpec *pspec)
+bgp_configurator_unset_update_source_args_set_property (GObject *object,
+                                                        guint property_id,
+                                                        const GValue *value,
+                                                        GParamSpec *pspec)
 {
-  BgpConfiguratorWithdrawRouteArgs *self = BGP_CONFIGURATOR_WITHDRAW_ROUTE_ARGS (object);
+  BgpConfiguratorUnsetUpdateSourceArgs *self = BGP_CONFIGURATOR_UNSET_UPDATE_SOURCE_ARGS (object);
 
   switch (property_id)
   {
-    case PROP_BGP_CONFIGURATOR_WITHDRAW_ROUTE_ARGS_PREFIX:
-      if (self->prefix != NULL)
-        g_free (self->prefix);
-      self->prefix = g_value_dup_string (value);
-      self->__isset_prefix = TRUE;
-      break;
-
-    case PROP_BGP_CONFIGURATOR_WITHDRAW_ROUTE_ARGS_RD:
-      if (self->rd != NULL)
-        g_free (self->rd);
-      self->rd = g_value_dup_string (value);
-      self->__isset_rd = TRUE;
+    case PROP_BGP_CONFIGURATOR_UNSET_UPDATE_SOURCE_ARGS_PEER_IP:
+      if (self->peerIp != NULL)
+        g_free (self->peerIp);
+      self->peerIp = g_value_dup_string (value);
+      self->__isset_peerIp = TRUE;
       break;
 
     default:
@@ -5087,21 +8512,17 @@ bgp_configurator_withdraw_route_args_set_property (GObject *object,
 }
 
 static void
-bgp_configurator_withdraw_route_args_get_property (GObject *object,
-                                                   guint property_id,
-                                                   GValue *value,
-                                                   GParamSpec *pspec)
+bgp_configurator_unset_update_source_args_get_property (GObject *object,
+                                                        guint property_id,
+                                                        GValue *value,
+                                                        GParamSpec *pspec)
 {
-  BgpConfiguratorWithdrawRouteArgs *self = BGP_CONFIGURATOR_WITHDRAW_ROUTE_ARGS (object);
+  BgpConfiguratorUnsetUpdateSourceArgs *self = BGP_CONFIGURATOR_UNSET_UPDATE_SOURCE_ARGS (object);
 
   switch (property_id)
   {
-    case PROP_BGP_CONFIGURATOR_WITHDRAW_ROUTE_ARGS_PREFIX:
-      g_value_set_string (value, self->prefix);
-      break;
-
-    case PROP_BGP_CONFIGURATOR_WITHDRAW_ROUTE_ARGS_RD:
-      g_value_set_string (value, self->rd);
+    case PROP_BGP_CONFIGURATOR_UNSET_UPDATE_SOURCE_ARGS_PEER_IP:
+      g_value_set_string (value, self->peerIp);
       break;
 
     default:
@@ -5111,61 +8532,45 @@ bgp_configurator_withdraw_route_args_get_property (GObject *object,
 }
 
 static void 
-bgp_configurator_withdraw_route_args_instance_init (BgpConfiguratorWithdrawRouteArgs * object)
+bgp_configurator_unset_update_source_args_instance_init (BgpConfiguratorUnsetUpdateSourceArgs * object)
 {
   /* satisfy -Wall */
   THRIFT_UNUSED_VAR (object);
-  object->prefix = NULL;
-  object->__isset_prefix = FALSE;
-  object->rd = NULL;
-  object->__isset_rd = FALSE;
+  object->peerIp = NULL;
+  object->__isset_peerIp = FALSE;
 }
 
 static void 
-bgp_configurator_withdraw_route_args_finalize (GObject *object)
+bgp_configurator_unset_update_source_args_finalize (GObject *object)
 {
-  BgpConfiguratorWithdrawRouteArgs *tobject = BGP_CONFIGURATOR_WITHDRAW_ROUTE_ARGS (object);
+  BgpConfiguratorUnsetUpdateSourceArgs *tobject = BGP_CONFIGURATOR_UNSET_UPDATE_SOURCE_ARGS (object);
 
   /* satisfy -Wall in case we don't use tobject */
   THRIFT_UNUSED_VAR (tobject);
-  if (tobject->prefix != NULL)
-  {
-    g_free(tobject->prefix);
-    tobject->prefix = NULL;
-  }
-  if (tobject->rd != NULL)
+  if (tobject->peerIp != NULL)
   {
-    g_free(tobject->rd);
-    tobject->rd = NULL;
+    g_free(tobject->peerIp);
+    tobject->peerIp = NULL;
   }
 }
 
 static void
-bgp_configurator_withdraw_route_args_class_init (BgpConfiguratorWithdrawRouteArgsClass * cls)
+bgp_configurator_unset_update_source_args_class_init (BgpConfiguratorUnsetUpdateSourceArgsClass * cls)
 {
   GObjectClass *gobject_class = G_OBJECT_CLASS (cls);
   ThriftStructClass *struct_class = THRIFT_STRUCT_CLASS (cls);
 
-  struct_class->read = bgp_configurator_withdraw_route_args_read;
-  struct_class->write = bgp_configurator_withdraw_route_args_write;
-
-  gobject_class->finalize = bgp_configurator_withdraw_route_args_finalize;
-  gobject_class->get_property = bgp_configurator_withdraw_route_args_get_property;
-  gobject_class->set_property = bgp_configurator_withdraw_route_args_set_property;
+  struct_class->read = bgp_configurator_unset_update_source_args_read;
+  struct_class->write = bgp_configurator_unset_update_source_args_write;
 
-  g_object_class_install_property
-    (gobject_class,
-     PROP_BGP_CONFIGURATOR_WITHDRAW_ROUTE_ARGS_PREFIX,
-     g_param_spec_string ("prefix",
-                          NULL,
-                          NULL,
-                          NULL,
-                          G_PARAM_READWRITE));
+  gobject_class->finalize = bgp_configurator_unset_update_source_args_finalize;
+  gobject_class->get_property = bgp_configurator_unset_update_source_args_get_property;
+  gobject_class->set_property = bgp_configurator_unset_update_source_args_set_property;
 
   g_object_class_install_property
     (gobject_class,
-     PROP_BGP_CONFIGURATOR_WITHDRAW_ROUTE_ARGS_RD,
-     g_param_spec_string ("rd",
+     PROP_BGP_CONFIGURATOR_UNSET_UPDATE_SOURCE_ARGS_PEER_IP,
+     g_param_spec_string ("peerIp",
                           NULL,
                           NULL,
                           NULL,
@@ -5173,7 +8578,7 @@ bgp_configurator_withdraw_route_args_class_init (BgpConfiguratorWithdrawRouteArg
 }
 
 GType
-bgp_configurator_withdraw_route_args_get_type (void)
+bgp_configurator_unset_update_source_args_get_type (void)
 {
   static GType type = 0;
 
@@ -5181,35 +8586,35 @@ bgp_configurator_withdraw_route_args_get_type (void)
   {
     static const GTypeInfo type_info = 
     {
-      sizeof (BgpConfiguratorWithdrawRouteArgsClass),
+      sizeof (BgpConfiguratorUnsetUpdateSourceArgsClass),
       NULL, /* base_init */
       NULL, /* base_finalize */
-      (GClassInitFunc) bgp_configurator_withdraw_route_args_class_init,
+      (GClassInitFunc) bgp_configurator_unset_update_source_args_class_init,
       NULL, /* class_finalize */
       NULL, /* class_data */
-      sizeof (BgpConfiguratorWithdrawRouteArgs),
+      sizeof (BgpConfiguratorUnsetUpdateSourceArgs),
       0, /* n_preallocs */
-      (GInstanceInitFunc) bgp_configurator_withdraw_route_args_instance_init,
+      (GInstanceInitFunc) bgp_configurator_unset_update_source_args_instance_init,
       NULL, /* value_table */
     };
 
     type = g_type_register_static (THRIFT_TYPE_STRUCT, 
-                                   "BgpConfiguratorWithdrawRouteArgsType",
+                                   "BgpConfiguratorUnsetUpdateSourceArgsType",
                                    &type_info, 0);
   }
 
   return type;
 }
 
-enum _BgpConfiguratorWithdrawRouteResultProperties
+enum _BgpConfiguratorUnsetUpdateSourceResultProperties
 {
-  PROP_BGP_CONFIGURATOR_WITHDRAW_ROUTE_RESULT_0,
-  PROP_BGP_CONFIGURATOR_WITHDRAW_ROUTE_RESULT_SUCCESS
+  PROP_BGP_CONFIGURATOR_UNSET_UPDATE_SOURCE_RESULT_0,
+  PROP_BGP_CONFIGURATOR_UNSET_UPDATE_SOURCE_RESULT_SUCCESS
 };
 
-/* reads a bgp_configurator_withdraw_route_result object */
+/* reads a bgp_configurator_unset_update_source_result object */
 static gint32
-bgp_configurator_withdraw_route_result_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+bgp_configurator_unset_update_source_result_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
 {
   gint32 ret;
   gint32 xfer = 0;
@@ -5218,7 +8623,7 @@ bgp_configurator_withdraw_route_result_read (ThriftStruct *object, ThriftProtoco
   gint16 fid;
   guint32 len = 0;
   gpointer data = NULL;
-  BgpConfiguratorWithdrawRouteResult * this_object = BGP_CONFIGURATOR_WITHDRAW_ROUTE_RESULT(object);
+  BgpConfiguratorUnsetUpdateSourceResult * this_object = BGP_CONFIGURATOR_UNSET_UPDATE_SOURCE_RESULT(object);
 
   /* satisfy -Wall in case these aren't used */
   THRIFT_UNUSED_VAR (len);
@@ -5288,14 +8693,14 @@ bgp_configurator_withdraw_route_result_read (ThriftStruct *object, ThriftProtoco
 }
 
 static gint32
-bgp_configurator_withdraw_route_result_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+bgp_configurator_unset_update_source_result_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
 {
   gint32 ret;
   gint32 xfer = 0;
 
-  BgpConfiguratorWithdrawRouteResult * this_object = BGP_CONFIGURATOR_WITHDRAW_ROUTE_RESULT(object);
+  BgpConfiguratorUnsetUpdateSourceResult * this_object = BGP_CONFIGURATOR_UNSET_UPDATE_SOURCE_RESULT(object);
   THRIFT_UNUSED_VAR (this_object);
-  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorWithdrawRouteResult", error)) < 0)
+  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorUnsetUpdateSourceResult", error)) < 0)
     return -1;
   xfer += ret;
   if (this_object->__isset_success == TRUE) {
@@ -5321,16 +8726,16 @@ bgp_configurator_withdraw_route_result_write (ThriftStruct *object, ThriftProtoc
 }
 
 static void
-bgp_configurator_withdraw_route_result_set_property (GObject *object,
-                                                     guint property_id,
-                                                     const GValue *value,
-                                                     GParamSpec *pspec)
+bgp_configurator_unset_update_source_result_set_property (GObject *object,
+                                                          guint property_id,
+                                                          const GValue *value,
+                                                          GParamSpec *pspec)
 {
-  BgpConfiguratorWithdrawRouteResult *self = BGP_CONFIGURATOR_WITHDRAW_ROUTE_RESULT (object);
+  BgpConfiguratorUnsetUpdateSourceResult *self = BGP_CONFIGURATOR_UNSET_UPDATE_SOURCE_RESULT (object);
 
   switch (property_id)
   {
-    case PROP_BGP_CONFIGURATOR_WITHDRAW_ROUTE_RESULT_SUCCESS:
+    case PROP_BGP_CONFIGURATOR_UNSET_UPDATE_SOURCE_RESULT_SUCCESS:
       self->success = g_value_get_int (value);
       self->__isset_success = TRUE;
       break;
@@ -5342,16 +8747,16 @@ bgp_configurator_withdraw_route_result_set_property (GObject *object,
 }
 
 static void
-bgp_configurator_withdraw_route_result_get_property (GObject *object,
-                                                     guint property_id,
-                                                     GValue *value,
-                                                     GParamSpec *pspec)
+bgp_configurator_unset_update_source_result_get_property (GObject *object,
+                                                          guint property_id,
+                                                          GValue *value,
+                                                          GParamSpec *pspec)
 {
-  BgpConfiguratorWithdrawRouteResult *self = BGP_CONFIGURATOR_WITHDRAW_ROUTE_RESULT (object);
+  BgpConfiguratorUnsetUpdateSourceResult *self = BGP_CONFIGURATOR_UNSET_UPDATE_SOURCE_RESULT (object);
 
   switch (property_id)
   {
-    case PROP_BGP_CONFIGURATOR_WITHDRAW_ROUTE_RESULT_SUCCESS:
+    case PROP_BGP_CONFIGURATOR_UNSET_UPDATE_SOURCE_RESULT_SUCCESS:
       g_value_set_int (value, self->success);
       break;
 
@@ -5362,7 +8767,7 @@ bgp_configurator_withdraw_route_result_get_property (GObject *object,
 }
 
 static void 
-bgp_configurator_withdraw_route_result_instance_init (BgpConfiguratorWithdrawRouteResult * object)
+bgp_configurator_unset_update_source_result_instance_init (BgpConfiguratorUnsetUpdateSourceResult * object)
 {
   /* satisfy -Wall */
   THRIFT_UNUSED_VAR (object);
@@ -5371,30 +8776,30 @@ bgp_configurator_withdraw_route_result_instance_init (BgpConfiguratorWithdrawRou
 }
 
 static void 
-bgp_configurator_withdraw_route_result_finalize (GObject *object)
+bgp_configurator_unset_update_source_result_finalize (GObject *object)
 {
-  BgpConfiguratorWithdrawRouteResult *tobject = BGP_CONFIGURATOR_WITHDRAW_ROUTE_RESULT (object);
+  BgpConfiguratorUnsetUpdateSourceResult *tobject = BGP_CONFIGURATOR_UNSET_UPDATE_SOURCE_RESULT (object);
 
   /* satisfy -Wall in case we don't use tobject */
   THRIFT_UNUSED_VAR (tobject);
 }
 
 static void
-bgp_configurator_withdraw_route_result_class_init (BgpConfiguratorWithdrawRouteResultClass * cls)
+bgp_configurator_unset_update_source_result_class_init (BgpConfiguratorUnsetUpdateSourceResultClass * cls)
 {
   GObjectClass *gobject_class = G_OBJECT_CLASS (cls);
   ThriftStructClass *struct_class = THRIFT_STRUCT_CLASS (cls);
 
-  struct_class->read = bgp_configurator_withdraw_route_result_read;
-  struct_class->write = bgp_configurator_withdraw_route_result_write;
+  struct_class->read = bgp_configurator_unset_update_source_result_read;
+  struct_class->write = bgp_configurator_unset_update_source_result_write;
 
-  gobject_class->finalize = bgp_configurator_withdraw_route_result_finalize;
-  gobject_class->get_property = bgp_configurator_withdraw_route_result_get_property;
-  gobject_class->set_property = bgp_configurator_withdraw_route_result_set_property;
+  gobject_class->finalize = bgp_configurator_unset_update_source_result_finalize;
+  gobject_class->get_property = bgp_configurator_unset_update_source_result_get_property;
+  gobject_class->set_property = bgp_configurator_unset_update_source_result_set_property;
 
   g_object_class_install_property
     (gobject_class,
-     PROP_BGP_CONFIGURATOR_WITHDRAW_ROUTE_RESULT_SUCCESS,
+     PROP_BGP_CONFIGURATOR_UNSET_UPDATE_SOURCE_RESULT_SUCCESS,
      g_param_spec_int ("success",
                        NULL,
                        NULL,
@@ -5405,7 +8810,7 @@ bgp_configurator_withdraw_route_result_class_init (BgpConfiguratorWithdrawRouteR
 }
 
 GType
-bgp_configurator_withdraw_route_result_get_type (void)
+bgp_configurator_unset_update_source_result_get_type (void)
 {
   static GType type = 0;
 
@@ -5413,36 +8818,37 @@ bgp_configurator_withdraw_route_result_get_type (void)
   {
     static const GTypeInfo type_info = 
     {
-      sizeof (BgpConfiguratorWithdrawRouteResultClass),
+      sizeof (BgpConfiguratorUnsetUpdateSourceResultClass),
       NULL, /* base_init */
       NULL, /* base_finalize */
-      (GClassInitFunc) bgp_configurator_withdraw_route_result_class_init,
+      (GClassInitFunc) bgp_configurator_unset_update_source_result_class_init,
       NULL, /* class_finalize */
       NULL, /* class_data */
-      sizeof (BgpConfiguratorWithdrawRouteResult),
+      sizeof (BgpConfiguratorUnsetUpdateSourceResult),
       0, /* n_preallocs */
-      (GInstanceInitFunc) bgp_configurator_withdraw_route_result_instance_init,
+      (GInstanceInitFunc) bgp_configurator_unset_update_source_result_instance_init,
       NULL, /* value_table */
     };
 
     type = g_type_register_static (THRIFT_TYPE_STRUCT, 
-                                   "BgpConfiguratorWithdrawRouteResultType",
+                                   "BgpConfiguratorUnsetUpdateSourceResultType",
                                    &type_info, 0);
   }
 
   return type;
 }
 
-enum _BgpConfiguratorSetEbgpMultihopArgsProperties
+enum _BgpConfiguratorEnableAddressFamilyArgsProperties
 {
-  PROP_BGP_CONFIGURATOR_SET_EBGP_MULTIHOP_ARGS_0,
-  PROP_BGP_CONFIGURATOR_SET_EBGP_MULTIHOP_ARGS_PEER_IP,
-  PROP_BGP_CONFIGURATOR_SET_EBGP_MULTIHOP_ARGS_N_HOPS
+  PROP_BGP_CONFIGURATOR_ENABLE_ADDRESS_FAMILY_ARGS_0,
+  PROP_BGP_CONFIGURATOR_ENABLE_ADDRESS_FAMILY_ARGS_PEER_IP,
+  PROP_BGP_CONFIGURATOR_ENABLE_ADDRESS_FAMILY_ARGS_AFI,
+  PROP_BGP_CONFIGURATOR_ENABLE_ADDRESS_FAMILY_ARGS_SAFI
 };
 
-/* reads a bgp_configurator_set_ebgp_multihop_args object */
+/* reads a bgp_configurator_enable_address_family_args object */
 static gint32
-bgp_configurator_set_ebgp_multihop_args_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+bgp_configurator_enable_address_family_args_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
 {
   gint32 ret;
   gint32 xfer = 0;
@@ -5451,7 +8857,7 @@ bgp_configurator_set_ebgp_multihop_args_read (ThriftStruct *object, ThriftProtoc
   gint16 fid;
   guint32 len = 0;
   gpointer data = NULL;
-  BgpConfiguratorSetEbgpMultihopArgs * this_object = BGP_CONFIGURATOR_SET_EBGP_MULTIHOP_ARGS(object);
+  BgpConfiguratorEnableAddressFamilyArgs * this_object = BGP_CONFIGURATOR_ENABLE_ADDRESS_FAMILY_ARGS(object);
 
   /* satisfy -Wall in case these aren't used */
   THRIFT_UNUSED_VAR (len);
@@ -5511,10 +8917,27 @@ bgp_configurator_set_ebgp_multihop_args_read (ThriftStruct *object, ThriftProtoc
       case 2:
         if (ftype == T_I32)
         {
-          if ((ret = thrift_protocol_read_i32 (protocol, &this_object->nHops, error)) < 0)
+          gint32 ecast6;
+          if ((ret = thrift_protocol_read_i32 (protocol, &ecast6, error)) < 0)
             return -1;
           xfer += ret;
-          this_object->__isset_nHops = TRUE;
+          this_object->afi = (af_afi)ecast6;
+          this_object->__isset_afi = TRUE;
+        } else {
+          if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
+            return -1;
+          xfer += ret;
+        }
+        break;
+      case 3:
+        if (ftype == T_I32)
+        {
+          gint32 ecast7;
+          if ((ret = thrift_protocol_read_i32 (protocol, &ecast7, error)) < 0)
+            return -1;
+          xfer += ret;
+          this_object->safi = (af_safi)ecast7;
+          this_object->__isset_safi = TRUE;
         } else {
           if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
             return -1;
@@ -5540,14 +8963,14 @@ bgp_configurator_set_ebgp_multihop_args_read (ThriftStruct *object, ThriftProtoc
 }
 
 static gint32
-bgp_configurator_set_ebgp_multihop_args_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+bgp_configurator_enable_address_family_args_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
 {
   gint32 ret;
   gint32 xfer = 0;
 
-  BgpConfiguratorSetEbgpMultihopArgs * this_object = BGP_CONFIGURATOR_SET_EBGP_MULTIHOP_ARGS(object);
+  BgpConfiguratorEnableAddressFamilyArgs * this_object = BGP_CONFIGURATOR_ENABLE_ADDRESS_FAMILY_ARGS(object);
   THRIFT_UNUSED_VAR (this_object);
-  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorSetEbgpMultihopArgs", error)) < 0)
+  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorEnableAddressFamilyArgs", error)) < 0)
     return -1;
   xfer += ret;
   if ((ret = thrift_protocol_write_field_begin (protocol, "peerIp", T_STRING, 1, error)) < 0)
@@ -5560,10 +8983,20 @@ bgp_configurator_set_ebgp_multihop_args_write (ThriftStruct *object, ThriftProto
   if ((ret = thrift_protocol_write_field_end (protocol, error)) < 0)
     return -1;
   xfer += ret;
-  if ((ret = thrift_protocol_write_field_begin (protocol, "nHops", T_I32, 2, error)) < 0)
+  if ((ret = thrift_protocol_write_field_begin (protocol, "afi", T_I32, 2, error)) < 0)
     return -1;
   xfer += ret;
-  if ((ret = thrift_protocol_write_i32 (protocol, this_object->nHops, error)) < 0)
+  if ((ret = thrift_protocol_write_i32 (protocol, (gint32) this_object->afi, error)) < 0)
+    return -1;
+  xfer += ret;
+
+  if ((ret = thrift_protocol_write_field_end (protocol, error)) < 0)
+    return -1;
+  xfer += ret;
+  if ((ret = thrift_protocol_write_field_begin (protocol, "safi", T_I32, 3, error)) < 0)
+    return -1;
+  xfer += ret;
+  if ((ret = thrift_protocol_write_i32 (protocol, (gint32) this_object->safi, error)) < 0)
     return -1;
   xfer += ret;
 
@@ -5581,25 +9014,30 @@ bgp_configurator_set_ebgp_multihop_args_write (ThriftStruct *object, ThriftProto
 }
 
 static void
-bgp_configurator_set_ebgp_multihop_args_set_property (GObject *object,
-                                                      guint property_id,
-                                                      const GValue *value,
-                                                      GParamSpec *pspec)
+bgp_configurator_enable_address_family_args_set_property (GObject *object,
+                                                          guint property_id,
+                                                          const GValue *value,
+                                                          GParamSpec *pspec)
 {
-  BgpConfiguratorSetEbgpMultihopArgs *self = BGP_CONFIGURATOR_SET_EBGP_MULTIHOP_ARGS (object);
+  BgpConfiguratorEnableAddressFamilyArgs *self = BGP_CONFIGURATOR_ENABLE_ADDRESS_FAMILY_ARGS (object);
 
   switch (property_id)
   {
-    case PROP_BGP_CONFIGURATOR_SET_EBGP_MULTIHOP_ARGS_PEER_IP:
+    case PROP_BGP_CONFIGURATOR_ENABLE_ADDRESS_FAMILY_ARGS_PEER_IP:
       if (self->peerIp != NULL)
         g_free (self->peerIp);
       self->peerIp = g_value_dup_string (value);
       self->__isset_peerIp = TRUE;
       break;
 
-    case PROP_BGP_CONFIGURATOR_SET_EBGP_MULTIHOP_ARGS_N_HOPS:
-      self->nHops = g_value_get_int (value);
-      self->__isset_nHops = TRUE;
+    case PROP_BGP_CONFIGURATOR_ENABLE_ADDRESS_FAMILY_ARGS_AFI:
+      self->afi = g_value_get_int (value);
+      self->__isset_afi = TRUE;
+      break;
+
+    case PROP_BGP_CONFIGURATOR_ENABLE_ADDRESS_FAMILY_ARGS_SAFI:
+      self->safi = g_value_get_int (value);
+      self->__isset_safi = TRUE;
       break;
 
     default:
@@ -5609,21 +9047,25 @@ bgp_configurator_set_ebgp_multihop_args_set_property (GObject *object,
 }
 
 static void
-bgp_configurator_set_ebgp_multihop_args_get_property (GObject *object,
-                                                      guint property_id,
-                                                      GValue *value,
-                                                      GParamSpec *pspec)
+bgp_configurator_enable_address_family_args_get_property (GObject *object,
+                                                          guint property_id,
+                                                          GValue *value,
+                                                          GParamSpec *pspec)
 {
-  BgpConfiguratorSetEbgpMultihopArgs *self = BGP_CONFIGURATOR_SET_EBGP_MULTIHOP_ARGS (object);
+  BgpConfiguratorEnableAddressFamilyArgs *self = BGP_CONFIGURATOR_ENABLE_ADDRESS_FAMILY_ARGS (object);
 
   switch (property_id)
   {
-    case PROP_BGP_CONFIGURATOR_SET_EBGP_MULTIHOP_ARGS_PEER_IP:
+    case PROP_BGP_CONFIGURATOR_ENABLE_ADDRESS_FAMILY_ARGS_PEER_IP:
       g_value_set_string (value, self->peerIp);
       break;
 
-    case PROP_BGP_CONFIGURATOR_SET_EBGP_MULTIHOP_ARGS_N_HOPS:
-      g_value_set_int (value, self->nHops);
+    case PROP_BGP_CONFIGURATOR_ENABLE_ADDRESS_FAMILY_ARGS_AFI:
+      g_value_set_int (value, self->afi);
+      break;
+
+    case PROP_BGP_CONFIGURATOR_ENABLE_ADDRESS_FAMILY_ARGS_SAFI:
+      g_value_set_int (value, self->safi);
       break;
 
     default:
@@ -5633,20 +9075,20 @@ bgp_configurator_set_ebgp_multihop_args_get_property (GObject *object,
 }
 
 static void 
-bgp_configurator_set_ebgp_multihop_args_instance_init (BgpConfiguratorSetEbgpMultihopArgs * object)
+bgp_configurator_enable_address_family_args_instance_init (BgpConfiguratorEnableAddressFamilyArgs * object)
 {
   /* satisfy -Wall */
   THRIFT_UNUSED_VAR (object);
   object->peerIp = NULL;
   object->__isset_peerIp = FALSE;
-  object->nHops = 0;
-  object->__isset_nHops = FALSE;
+  object->__isset_afi = FALSE;
+  object->__isset_safi = FALSE;
 }
 
 static void 
-bgp_configurator_set_ebgp_multihop_args_finalize (GObject *object)
+bgp_configurator_enable_address_family_args_finalize (GObject *object)
 {
-  BgpConfiguratorSetEbgpMultihopArgs *tobject = BGP_CONFIGURATOR_SET_EBGP_MULTIHOP_ARGS (object);
+  BgpConfiguratorEnableAddressFamilyArgs *tobject = BGP_CONFIGURATOR_ENABLE_ADDRESS_FAMILY_ARGS (object);
 
   /* satisfy -Wall in case we don't use tobject */
   THRIFT_UNUSED_VAR (tobject);
@@ -5658,21 +9100,21 @@ bgp_configurator_set_ebgp_multihop_args_finalize (GObject *object)
 }
 
 static void
-bgp_configurator_set_ebgp_multihop_args_class_init (BgpConfiguratorSetEbgpMultihopArgsClass * cls)
+bgp_configurator_enable_address_family_args_class_init (BgpConfiguratorEnableAddressFamilyArgsClass * cls)
 {
   GObjectClass *gobject_class = G_OBJECT_CLASS (cls);
   ThriftStructClass *struct_class = THRIFT_STRUCT_CLASS (cls);
 
-  struct_class->read = bgp_configurator_set_ebgp_multihop_args_read;
-  struct_class->write = bgp_configurator_set_ebgp_multihop_args_write;
+  struct_class->read = bgp_configurator_enable_address_family_args_read;
+  struct_class->write = bgp_configurator_enable_address_family_args_write;
 
-  gobject_class->finalize = bgp_configurator_set_ebgp_multihop_args_finalize;
-  gobject_class->get_property = bgp_configurator_set_ebgp_multihop_args_get_property;
-  gobject_class->set_property = bgp_configurator_set_ebgp_multihop_args_set_property;
+  gobject_class->finalize = bgp_configurator_enable_address_family_args_finalize;
+  gobject_class->get_property = bgp_configurator_enable_address_family_args_get_property;
+  gobject_class->set_property = bgp_configurator_enable_address_family_args_set_property;
 
   g_object_class_install_property
     (gobject_class,
-     PROP_BGP_CONFIGURATOR_SET_EBGP_MULTIHOP_ARGS_PEER_IP,
+     PROP_BGP_CONFIGURATOR_ENABLE_ADDRESS_FAMILY_ARGS_PEER_IP,
      g_param_spec_string ("peerIp",
                           NULL,
                           NULL,
@@ -5681,18 +9123,29 @@ bgp_configurator_set_ebgp_multihop_args_class_init (BgpConfiguratorSetEbgpMultih
 
   g_object_class_install_property
     (gobject_class,
-     PROP_BGP_CONFIGURATOR_SET_EBGP_MULTIHOP_ARGS_N_HOPS,
-     g_param_spec_int ("nHops",
+     PROP_BGP_CONFIGURATOR_ENABLE_ADDRESS_FAMILY_ARGS_AFI,
+     g_param_spec_int ("afi",
                        NULL,
                        NULL,
-                       G_MININT32,
-                       G_MAXINT32,
-                       0,
+                       1,
+                       1,
+                       1,
+                       G_PARAM_READWRITE));
+
+  g_object_class_install_property
+    (gobject_class,
+     PROP_BGP_CONFIGURATOR_ENABLE_ADDRESS_FAMILY_ARGS_SAFI,
+     g_param_spec_int ("safi",
+                       NULL,
+                       NULL,
+                       4,
+                       5,
+                       4,
                        G_PARAM_READWRITE));
 }
 
 GType
-bgp_configurator_set_ebgp_multihop_args_get_type (void)
+bgp_configurator_enable_address_family_args_get_type (void)
 {
   static GType type = 0;
 
@@ -5700,35 +9153,35 @@ bgp_configurator_set_ebgp_multihop_args_get_type (void)
   {
     static const GTypeInfo type_info = 
     {
-      sizeof (BgpConfiguratorSetEbgpMultihopArgsClass),
+      sizeof (BgpConfiguratorEnableAddressFamilyArgsClass),
       NULL, /* base_init */
       NULL, /* base_finalize */
-      (GClassInitFunc) bgp_configurator_set_ebgp_multihop_args_class_init,
+      (GClassInitFunc) bgp_configurator_enable_address_family_args_class_init,
       NULL, /* class_finalize */
       NULL, /* class_data */
-      sizeof (BgpConfiguratorSetEbgpMultihopArgs),
+      sizeof (BgpConfiguratorEnableAddressFamilyArgs),
       0, /* n_preallocs */
-      (GInstanceInitFunc) bgp_configurator_set_ebgp_multihop_args_instance_init,
+      (GInstanceInitFunc) bgp_configurator_enable_address_family_args_instance_init,
       NULL, /* value_table */
     };
 
     type = g_type_register_static (THRIFT_TYPE_STRUCT, 
-                                   "BgpConfiguratorSetEbgpMultihopArgsType",
+                                   "BgpConfiguratorEnableAddressFamilyArgsType",
                                    &type_info, 0);
   }
 
   return type;
 }
 
-enum _BgpConfiguratorSetEbgpMultihopResultProperties
+enum _BgpConfiguratorEnableAddressFamilyResultProperties
 {
-  PROP_BGP_CONFIGURATOR_SET_EBGP_MULTIHOP_RESULT_0,
-  PROP_BGP_CONFIGURATOR_SET_EBGP_MULTIHOP_RESULT_SUCCESS
+  PROP_BGP_CONFIGURATOR_ENABLE_ADDRESS_FAMILY_RESULT_0,
+  PROP_BGP_CONFIGURATOR_ENABLE_ADDRESS_FAMILY_RESULT_SUCCESS
 };
 
-/* reads a bgp_configurator_set_ebgp_multihop_result object */
+/* reads a bgp_configurator_enable_address_family_result object */
 static gint32
-bgp_configurator_set_ebgp_multihop_result_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+bgp_configurator_enable_address_family_result_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
 {
   gint32 ret;
   gint32 xfer = 0;
@@ -5737,7 +9190,7 @@ bgp_configurator_set_ebgp_multihop_result_read (ThriftStruct *object, ThriftProt
   gint16 fid;
   guint32 len = 0;
   gpointer data = NULL;
-  BgpConfiguratorSetEbgpMultihopResult * this_object = BGP_CONFIGURATOR_SET_EBGP_MULTIHOP_RESULT(object);
+  BgpConfiguratorEnableAddressFamilyResult * this_object = BGP_CONFIGURATOR_ENABLE_ADDRESS_FAMILY_RESULT(object);
 
   /* satisfy -Wall in case these aren't used */
   THRIFT_UNUSED_VAR (len);
@@ -5807,14 +9260,14 @@ bgp_configurator_set_ebgp_multihop_result_read (ThriftStruct *object, ThriftProt
 }
 
 static gint32
-bgp_configurator_set_ebgp_multihop_result_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+bgp_configurator_enable_address_family_result_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
 {
   gint32 ret;
   gint32 xfer = 0;
 
-  BgpConfiguratorSetEbgpMultihopResult * this_object = BGP_CONFIGURATOR_SET_EBGP_MULTIHOP_RESULT(object);
+  BgpConfiguratorEnableAddressFamilyResult * this_object = BGP_CONFIGURATOR_ENABLE_ADDRESS_FAMILY_RESULT(object);
   THRIFT_UNUSED_VAR (this_object);
-  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorSetEbgpMultihopResult", error)) < 0)
+  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorEnableAddressFamilyResult", error)) < 0)
     return -1;
   xfer += ret;
   if (this_object->__isset_success == TRUE) {
@@ -5840,16 +9293,16 @@ bgp_configurator_set_ebgp_multihop_result_write (ThriftStruct *object, ThriftPro
 }
 
 static void
-bgp_configurator_set_ebgp_multihop_result_set_property (GObject *object,
-                                                        guint property_id,
-                                                        const GValue *value,
-                                                        GParamSpec *pspec)
+bgp_configurator_enable_address_family_result_set_property (GObject *object,
+                                                            guint property_id,
+                                                            const GValue *value,
+                                                            GParamSpec *pspec)
 {
-  BgpConfiguratorSetEbgpMultihopResult *self = BGP_CONFIGURATOR_SET_EBGP_MULTIHOP_RESULT (object);
+  BgpConfiguratorEnableAddressFamilyResult *self = BGP_CONFIGURATOR_ENABLE_ADDRESS_FAMILY_RESULT (object);
 
   switch (property_id)
   {
-    case PROP_BGP_CONFIGURATOR_SET_EBGP_MULTIHOP_RESULT_SUCCESS:
+    case PROP_BGP_CONFIGURATOR_ENABLE_ADDRESS_FAMILY_RESULT_SUCCESS:
       self->success = g_value_get_int (value);
       self->__isset_success = TRUE;
       break;
@@ -5861,16 +9314,16 @@ bgp_configurator_set_ebgp_multihop_result_set_property (GObject *object,
 }
 
 static void
-bgp_configurator_set_ebgp_multihop_result_get_property (GObject *object,
-                                                        guint property_id,
-                                                        GValue *value,
-                                                        GParamSpec *pspec)
+bgp_configurator_enable_address_family_result_get_property (GObject *object,
+                                                            guint property_id,
+                                                            GValue *value,
+                                                            GParamSpec *pspec)
 {
-  BgpConfiguratorSetEbgpMultihopResult *self = BGP_CONFIGURATOR_SET_EBGP_MULTIHOP_RESULT (object);
+  BgpConfiguratorEnableAddressFamilyResult *self = BGP_CONFIGURATOR_ENABLE_ADDRESS_FAMILY_RESULT (object);
 
   switch (property_id)
   {
-    case PROP_BGP_CONFIGURATOR_SET_EBGP_MULTIHOP_RESULT_SUCCESS:
+    case PROP_BGP_CONFIGURATOR_ENABLE_ADDRESS_FAMILY_RESULT_SUCCESS:
       g_value_set_int (value, self->success);
       break;
 
@@ -5881,7 +9334,7 @@ bgp_configurator_set_ebgp_multihop_result_get_property (GObject *object,
 }
 
 static void 
-bgp_configurator_set_ebgp_multihop_result_instance_init (BgpConfiguratorSetEbgpMultihopResult * object)
+bgp_configurator_enable_address_family_result_instance_init (BgpConfiguratorEnableAddressFamilyResult * object)
 {
   /* satisfy -Wall */
   THRIFT_UNUSED_VAR (object);
@@ -5890,30 +9343,30 @@ bgp_configurator_set_ebgp_multihop_result_instance_init (BgpConfiguratorSetEbgpM
 }
 
 static void 
-bgp_configurator_set_ebgp_multihop_result_finalize (GObject *object)
+bgp_configurator_enable_address_family_result_finalize (GObject *object)
 {
-  BgpConfiguratorSetEbgpMultihopResult *tobject = BGP_CONFIGURATOR_SET_EBGP_MULTIHOP_RESULT (object);
+  BgpConfiguratorEnableAddressFamilyResult *tobject = BGP_CONFIGURATOR_ENABLE_ADDRESS_FAMILY_RESULT (object);
 
   /* satisfy -Wall in case we don't use tobject */
   THRIFT_UNUSED_VAR (tobject);
 }
 
 static void
-bgp_configurator_set_ebgp_multihop_result_class_init (BgpConfiguratorSetEbgpMultihopResultClass * cls)
+bgp_configurator_enable_address_family_result_class_init (BgpConfiguratorEnableAddressFamilyResultClass * cls)
 {
   GObjectClass *gobject_class = G_OBJECT_CLASS (cls);
   ThriftStructClass *struct_class = THRIFT_STRUCT_CLASS (cls);
 
-  struct_class->read = bgp_configurator_set_ebgp_multihop_result_read;
-  struct_class->write = bgp_configurator_set_ebgp_multihop_result_write;
+  struct_class->read = bgp_configurator_enable_address_family_result_read;
+  struct_class->write = bgp_configurator_enable_address_family_result_write;
 
-  gobject_class->finalize = bgp_configurator_set_ebgp_multihop_result_finalize;
-  gobject_class->get_property = bgp_configurator_set_ebgp_multihop_result_get_property;
-  gobject_class->set_property = bgp_configurator_set_ebgp_multihop_result_set_property;
+  gobject_class->finalize = bgp_configurator_enable_address_family_result_finalize;
+  gobject_class->get_property = bgp_configurator_enable_address_family_result_get_property;
+  gobject_class->set_property = bgp_configurator_enable_address_family_result_set_property;
 
   g_object_class_install_property
     (gobject_class,
-     PROP_BGP_CONFIGURATOR_SET_EBGP_MULTIHOP_RESULT_SUCCESS,
+     PROP_BGP_CONFIGURATOR_ENABLE_ADDRESS_FAMILY_RESULT_SUCCESS,
      g_param_spec_int ("success",
                        NULL,
                        NULL,
@@ -5924,7 +9377,7 @@ bgp_configurator_set_ebgp_multihop_result_class_init (BgpConfiguratorSetEbgpMult
 }
 
 GType
-bgp_configurator_set_ebgp_multihop_result_get_type (void)
+bgp_configurator_enable_address_family_result_get_type (void)
 {
   static GType type = 0;
 
@@ -5932,35 +9385,37 @@ bgp_configurator_set_ebgp_multihop_result_get_type (void)
   {
     static const GTypeInfo type_info = 
     {
-      sizeof (BgpConfiguratorSetEbgpMultihopResultClass),
+      sizeof (BgpConfiguratorEnableAddressFamilyResultClass),
       NULL, /* base_init */
       NULL, /* base_finalize */
-      (GClassInitFunc) bgp_configurator_set_ebgp_multihop_result_class_init,
+      (GClassInitFunc) bgp_configurator_enable_address_family_result_class_init,
       NULL, /* class_finalize */
       NULL, /* class_data */
-      sizeof (BgpConfiguratorSetEbgpMultihopResult),
+      sizeof (BgpConfiguratorEnableAddressFamilyResult),
       0, /* n_preallocs */
-      (GInstanceInitFunc) bgp_configurator_set_ebgp_multihop_result_instance_init,
+      (GInstanceInitFunc) bgp_configurator_enable_address_family_result_instance_init,
       NULL, /* value_table */
     };
 
     type = g_type_register_static (THRIFT_TYPE_STRUCT, 
-                                   "BgpConfiguratorSetEbgpMultihopResultType",
+                                   "BgpConfiguratorEnableAddressFamilyResultType",
                                    &type_info, 0);
   }
 
   return type;
 }
 
-enum _BgpConfiguratorUnsetEbgpMultihopArgsProperties
+enum _BgpConfiguratorDisableAddressFamilyArgsProperties
 {
-  PROP_BGP_CONFIGURATOR_UNSET_EBGP_MULTIHOP_ARGS_0,
-  PROP_BGP_CONFIGURATOR_UNSET_EBGP_MULTIHOP_ARGS_PEER_IP
+  PROP_BGP_CONFIGURATOR_DISABLE_ADDRESS_FAMILY_ARGS_0,
+  PROP_BGP_CONFIGURATOR_DISABLE_ADDRESS_FAMILY_ARGS_PEER_IP,
+  PROP_BGP_CONFIGURATOR_DISABLE_ADDRESS_FAMILY_ARGS_AFI,
+  PROP_BGP_CONFIGURATOR_DISABLE_ADDRESS_FAMILY_ARGS_SAFI
 };
 
-/* reads a bgp_configurator_unset_ebgp_multihop_args object */
+/* reads a bgp_configurator_disable_address_family_args object */
 static gint32
-bgp_configurator_unset_ebgp_multihop_args_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+bgp_configurator_disable_address_family_args_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
 {
   gint32 ret;
   gint32 xfer = 0;
@@ -5969,7 +9424,7 @@ bgp_configurator_unset_ebgp_multihop_args_read (ThriftStruct *object, ThriftProt
   gint16 fid;
   guint32 len = 0;
   gpointer data = NULL;
-  BgpConfiguratorUnsetEbgpMultihopArgs * this_object = BGP_CONFIGURATOR_UNSET_EBGP_MULTIHOP_ARGS(object);
+  BgpConfiguratorDisableAddressFamilyArgs * this_object = BGP_CONFIGURATOR_DISABLE_ADDRESS_FAMILY_ARGS(object);
 
   /* satisfy -Wall in case these aren't used */
   THRIFT_UNUSED_VAR (len);
@@ -6026,6 +9481,36 @@ bgp_configurator_unset_ebgp_multihop_args_read (ThriftStruct *object, ThriftProt
           xfer += ret;
         }
         break;
+      case 2:
+        if (ftype == T_I32)
+        {
+          gint32 ecast8;
+          if ((ret = thrift_protocol_read_i32 (protocol, &ecast8, error)) < 0)
+            return -1;
+          xfer += ret;
+          this_object->afi = (af_afi)ecast8;
+          this_object->__isset_afi = TRUE;
+        } else {
+          if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
+            return -1;
+          xfer += ret;
+        }
+        break;
+      case 3:
+        if (ftype == T_I32)
+        {
+          gint32 ecast9;
+          if ((ret = thrift_protocol_read_i32 (protocol, &ecast9, error)) < 0)
+            return -1;
+          xfer += ret;
+          this_object->safi = (af_safi)ecast9;
+          this_object->__isset_safi = TRUE;
+        } else {
+          if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
+            return -1;
+          xfer += ret;
+        }
+        break;
       default:
         if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
           return -1;
@@ -6045,14 +9530,14 @@ bgp_configurator_unset_ebgp_multihop_args_read (ThriftStruct *object, ThriftProt
 }
 
 static gint32
-bgp_configurator_unset_ebgp_multihop_args_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+bgp_configurator_disable_address_family_args_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
 {
   gint32 ret;
   gint32 xfer = 0;
 
-  BgpConfiguratorUnsetEbgpMultihopArgs * this_object = BGP_CONFIGURATOR_UNSET_EBGP_MULTIHOP_ARGS(object);
+  BgpConfiguratorDisableAddressFamilyArgs * this_object = BGP_CONFIGURATOR_DISABLE_ADDRESS_FAMILY_ARGS(object);
   THRIFT_UNUSED_VAR (this_object);
-  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorUnsetEbgpMultihopArgs", error)) < 0)
+  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorDisableAddressFamilyArgs", error)) < 0)
     return -1;
   xfer += ret;
   if ((ret = thrift_protocol_write_field_begin (protocol, "peerIp", T_STRING, 1, error)) < 0)
@@ -6062,6 +9547,26 @@ bgp_configurator_unset_ebgp_multihop_args_write (ThriftStruct *object, ThriftPro
     return -1;
   xfer += ret;
 
+  if ((ret = thrift_protocol_write_field_end (protocol, error)) < 0)
+    return -1;
+  xfer += ret;
+  if ((ret = thrift_protocol_write_field_begin (protocol, "afi", T_I32, 2, error)) < 0)
+    return -1;
+  xfer += ret;
+  if ((ret = thrift_protocol_write_i32 (protocol, (gint32) this_object->afi, error)) < 0)
+    return -1;
+  xfer += ret;
+
+  if ((ret = thrift_protocol_write_field_end (protocol, error)) < 0)
+    return -1;
+  xfer += ret;
+  if ((ret = thrift_protocol_write_field_begin (protocol, "safi", T_I32, 3, error)) < 0)
+    return -1;
+  xfer += ret;
+  if ((ret = thrift_protocol_write_i32 (protocol, (gint32) this_object->safi, error)) < 0)
+    return -1;
+  xfer += ret;
+
   if ((ret = thrift_protocol_write_field_end (protocol, error)) < 0)
     return -1;
   xfer += ret;
@@ -6076,22 +9581,32 @@ bgp_configurator_unset_ebgp_multihop_args_write (ThriftStruct *object, ThriftPro
 }
 
 static void
-bgp_configurator_unset_ebgp_multihop_args_set_property (GObject *object,
-                                                        guint property_id,
-                                                        const GValue *value,
-                                                        GParamSpec *pspec)
+bgp_configurator_disable_address_family_args_set_property (GObject *object,
+                                                           guint property_id,
+                                                           const GValue *value,
+                                                           GParamSpec *pspec)
 {
-  BgpConfiguratorUnsetEbgpMultihopArgs *self = BGP_CONFIGURATOR_UNSET_EBGP_MULTIHOP_ARGS (object);
+  BgpConfiguratorDisableAddressFamilyArgs *self = BGP_CONFIGURATOR_DISABLE_ADDRESS_FAMILY_ARGS (object);
 
   switch (property_id)
   {
-    case PROP_BGP_CONFIGURATOR_UNSET_EBGP_MULTIHOP_ARGS_PEER_IP:
+    case PROP_BGP_CONFIGURATOR_DISABLE_ADDRESS_FAMILY_ARGS_PEER_IP:
       if (self->peerIp != NULL)
         g_free (self->peerIp);
       self->peerIp = g_value_dup_string (value);
       self->__isset_peerIp = TRUE;
       break;
 
+    case PROP_BGP_CONFIGURATOR_DISABLE_ADDRESS_FAMILY_ARGS_AFI:
+      self->afi = g_value_get_int (value);
+      self->__isset_afi = TRUE;
+      break;
+
+    case PROP_BGP_CONFIGURATOR_DISABLE_ADDRESS_FAMILY_ARGS_SAFI:
+      self->safi = g_value_get_int (value);
+      self->__isset_safi = TRUE;
+      break;
+
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, property_id, pspec);
       break;
@@ -6099,19 +9614,27 @@ bgp_configurator_unset_ebgp_multihop_args_set_property (GObject *object,
 }
 
 static void
-bgp_configurator_unset_ebgp_multihop_args_get_property (GObject *object,
-                                                        guint property_id,
-                                                        GValue *value,
-                                                        GParamSpec *pspec)
+bgp_configurator_disable_address_family_args_get_property (GObject *object,
+                                                           guint property_id,
+                                                           GValue *value,
+                                                           GParamSpec *pspec)
 {
-  BgpConfiguratorUnsetEbgpMultihopArgs *self = BGP_CONFIGURATOR_UNSET_EBGP_MULTIHOP_ARGS (object);
+  BgpConfiguratorDisableAddressFamilyArgs *self = BGP_CONFIGURATOR_DISABLE_ADDRESS_FAMILY_ARGS (object);
 
   switch (property_id)
   {
-    case PROP_BGP_CONFIGURATOR_UNSET_EBGP_MULTIHOP_ARGS_PEER_IP:
+    case PROP_BGP_CONFIGURATOR_DISABLE_ADDRESS_FAMILY_ARGS_PEER_IP:
       g_value_set_string (value, self->peerIp);
       break;
 
+    case PROP_BGP_CONFIGURATOR_DISABLE_ADDRESS_FAMILY_ARGS_AFI:
+      g_value_set_int (value, self->afi);
+      break;
+
+    case PROP_BGP_CONFIGURATOR_DISABLE_ADDRESS_FAMILY_ARGS_SAFI:
+      g_value_set_int (value, self->safi);
+      break;
+
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, property_id, pspec);
       break;
@@ -6119,18 +9642,20 @@ bgp_configurator_unset_ebgp_multihop_args_get_property (GObject *object,
 }
 
 static void 
-bgp_configurator_unset_ebgp_multihop_args_instance_init (BgpConfiguratorUnsetEbgpMultihopArgs * object)
+bgp_configurator_disable_address_family_args_instance_init (BgpConfiguratorDisableAddressFamilyArgs * object)
 {
   /* satisfy -Wall */
   THRIFT_UNUSED_VAR (object);
   object->peerIp = NULL;
   object->__isset_peerIp = FALSE;
+  object->__isset_afi = FALSE;
+  object->__isset_safi = FALSE;
 }
 
 static void 
-bgp_configurator_unset_ebgp_multihop_args_finalize (GObject *object)
+bgp_configurator_disable_address_family_args_finalize (GObject *object)
 {
-  BgpConfiguratorUnsetEbgpMultihopArgs *tobject = BGP_CONFIGURATOR_UNSET_EBGP_MULTIHOP_ARGS (object);
+  BgpConfiguratorDisableAddressFamilyArgs *tobject = BGP_CONFIGURATOR_DISABLE_ADDRESS_FAMILY_ARGS (object);
 
   /* satisfy -Wall in case we don't use tobject */
   THRIFT_UNUSED_VAR (tobject);
@@ -6142,30 +9667,52 @@ bgp_configurator_unset_ebgp_multihop_args_finalize (GObject *object)
 }
 
 static void
-bgp_configurator_unset_ebgp_multihop_args_class_init (BgpConfiguratorUnsetEbgpMultihopArgsClass * cls)
+bgp_configurator_disable_address_family_args_class_init (BgpConfiguratorDisableAddressFamilyArgsClass * cls)
 {
   GObjectClass *gobject_class = G_OBJECT_CLASS (cls);
   ThriftStructClass *struct_class = THRIFT_STRUCT_CLASS (cls);
 
-  struct_class->read = bgp_configurator_unset_ebgp_multihop_args_read;
-  struct_class->write = bgp_configurator_unset_ebgp_multihop_args_write;
+  struct_class->read = bgp_configurator_disable_address_family_args_read;
+  struct_class->write = bgp_configurator_disable_address_family_args_write;
 
-  gobject_class->finalize = bgp_configurator_unset_ebgp_multihop_args_finalize;
-  gobject_class->get_property = bgp_configurator_unset_ebgp_multihop_args_get_property;
-  gobject_class->set_property = bgp_configurator_unset_ebgp_multihop_args_set_property;
+  gobject_class->finalize = bgp_configurator_disable_address_family_args_finalize;
+  gobject_class->get_property = bgp_configurator_disable_address_family_args_get_property;
+  gobject_class->set_property = bgp_configurator_disable_address_family_args_set_property;
 
   g_object_class_install_property
     (gobject_class,
-     PROP_BGP_CONFIGURATOR_UNSET_EBGP_MULTIHOP_ARGS_PEER_IP,
+     PROP_BGP_CONFIGURATOR_DISABLE_ADDRESS_FAMILY_ARGS_PEER_IP,
      g_param_spec_string ("peerIp",
                           NULL,
                           NULL,
                           NULL,
                           G_PARAM_READWRITE));
+
+  g_object_class_install_property
+    (gobject_class,
+     PROP_BGP_CONFIGURATOR_DISABLE_ADDRESS_FAMILY_ARGS_AFI,
+     g_param_spec_int ("afi",
+                       NULL,
+                       NULL,
+                       1,
+                       1,
+                       1,
+                       G_PARAM_READWRITE));
+
+  g_object_class_install_property
+    (gobject_class,
+     PROP_BGP_CONFIGURATOR_DISABLE_ADDRESS_FAMILY_ARGS_SAFI,
+     g_param_spec_int ("safi",
+                       NULL,
+                       NULL,
+                       4,
+                       5,
+                       4,
+                       G_PARAM_READWRITE));
 }
 
 GType
-bgp_configurator_unset_ebgp_multihop_args_get_type (void)
+bgp_configurator_disable_address_family_args_get_type (void)
 {
   static GType type = 0;
 
@@ -6173,35 +9720,35 @@ bgp_configurator_unset_ebgp_multihop_args_get_type (void)
   {
     static const GTypeInfo type_info = 
     {
-      sizeof (BgpConfiguratorUnsetEbgpMultihopArgsClass),
+      sizeof (BgpConfiguratorDisableAddressFamilyArgsClass),
       NULL, /* base_init */
       NULL, /* base_finalize */
-      (GClassInitFunc) bgp_configurator_unset_ebgp_multihop_args_class_init,
+      (GClassInitFunc) bgp_configurator_disable_address_family_args_class_init,
       NULL, /* class_finalize */
       NULL, /* class_data */
-      sizeof (BgpConfiguratorUnsetEbgpMultihopArgs),
+      sizeof (BgpConfiguratorDisableAddressFamilyArgs),
       0, /* n_preallocs */
-      (GInstanceInitFunc) bgp_configurator_unset_ebgp_multihop_args_instance_init,
+      (GInstanceInitFunc) bgp_configurator_disable_address_family_args_instance_init,
       NULL, /* value_table */
     };
 
     type = g_type_register_static (THRIFT_TYPE_STRUCT, 
-                                   "BgpConfiguratorUnsetEbgpMultihopArgsType",
+                                   "BgpConfiguratorDisableAddressFamilyArgsType",
                                    &type_info, 0);
   }
 
   return type;
 }
 
-enum _BgpConfiguratorUnsetEbgpMultihopResultProperties
+enum _BgpConfiguratorDisableAddressFamilyResultProperties
 {
-  PROP_BGP_CONFIGURATOR_UNSET_EBGP_MULTIHOP_RESULT_0,
-  PROP_BGP_CONFIGURATOR_UNSET_EBGP_MULTIHOP_RESULT_SUCCESS
+  PROP_BGP_CONFIGURATOR_DISABLE_ADDRESS_FAMILY_RESULT_0,
+  PROP_BGP_CONFIGURATOR_DISABLE_ADDRESS_FAMILY_RESULT_SUCCESS
 };
 
-/* reads a bgp_configurator_unset_ebgp_multihop_result object */
+/* reads a bgp_configurator_disable_address_family_result object */
 static gint32
-bgp_configurator_unset_ebgp_multihop_result_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+bgp_configurator_disable_address_family_result_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
 {
   gint32 ret;
   gint32 xfer = 0;
@@ -6210,7 +9757,7 @@ bgp_configurator_unset_ebgp_multihop_result_read (ThriftStruct *object, ThriftPr
   gint16 fid;
   guint32 len = 0;
   gpointer data = NULL;
-  BgpConfiguratorUnsetEbgpMultihopResult * this_object = BGP_CONFIGURATOR_UNSET_EBGP_MULTIHOP_RESULT(object);
+  BgpConfiguratorDisableAddressFamilyResult * this_object = BGP_CONFIGURATOR_DISABLE_ADDRESS_FAMILY_RESULT(object);
 
   /* satisfy -Wall in case these aren't used */
   THRIFT_UNUSED_VAR (len);
@@ -6280,14 +9827,14 @@ bgp_configurator_unset_ebgp_multihop_result_read (ThriftStruct *object, ThriftPr
 }
 
 static gint32
-bgp_configurator_unset_ebgp_multihop_result_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+bgp_configurator_disable_address_family_result_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
 {
   gint32 ret;
   gint32 xfer = 0;
 
-  BgpConfiguratorUnsetEbgpMultihopResult * this_object = BGP_CONFIGURATOR_UNSET_EBGP_MULTIHOP_RESULT(object);
+  BgpConfiguratorDisableAddressFamilyResult * this_object = BGP_CONFIGURATOR_DISABLE_ADDRESS_FAMILY_RESULT(object);
   THRIFT_UNUSED_VAR (this_object);
-  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorUnsetEbgpMultihopResult", error)) < 0)
+  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorDisableAddressFamilyResult", error)) < 0)
     return -1;
   xfer += ret;
   if (this_object->__isset_success == TRUE) {
@@ -6313,16 +9860,16 @@ bgp_configurator_unset_ebgp_multihop_result_write (ThriftStruct *object, ThriftP
 }
 
 static void
-bgp_configurator_unset_ebgp_multihop_result_set_property (GObject *object,
-                                                          guint property_id,
-                                                          const GValue *value,
-                                                          GParamSpec *pspec)
+bgp_configurator_disable_address_family_result_set_property (GObject *object,
+                                                             guint property_id,
+                                                             const GValue *value,
+                                                             GParamSpec *pspec)
 {
-  BgpConfiguratorUnsetEbgpMultihopResult *self = BGP_CONFIGURATOR_UNSET_EBGP_MULTIHOP_RESULT (object);
+  BgpConfiguratorDisableAddressFamilyResult *self = BGP_CONFIGURATOR_DISABLE_ADDRESS_FAMILY_RESULT (object);
 
   switch (property_id)
   {
-    case PROP_BGP_CONFIGURATOR_UNSET_EBGP_MULTIHOP_RESULT_SUCCESS:
+    case PROP_BGP_CONFIGURATOR_DISABLE_ADDRESS_FAMILY_RESULT_SUCCESS:
       self->success = g_value_get_int (value);
       self->__isset_success = TRUE;
       break;
@@ -6334,16 +9881,16 @@ bgp_configurator_unset_ebgp_multihop_result_set_property (GObject *object,
 }
 
 static void
-bgp_configurator_unset_ebgp_multihop_result_get_property (GObject *object,
-                                                          guint property_id,
-                                                          GValue *value,
-                                                          GParamSpec *pspec)
+bgp_configurator_disable_address_family_result_get_property (GObject *object,
+                                                             guint property_id,
+                                                             GValue *value,
+                                                             GParamSpec *pspec)
 {
-  BgpConfiguratorUnsetEbgpMultihopResult *self = BGP_CONFIGURATOR_UNSET_EBGP_MULTIHOP_RESULT (object);
+  BgpConfiguratorDisableAddressFamilyResult *self = BGP_CONFIGURATOR_DISABLE_ADDRESS_FAMILY_RESULT (object);
 
   switch (property_id)
   {
-    case PROP_BGP_CONFIGURATOR_UNSET_EBGP_MULTIHOP_RESULT_SUCCESS:
+    case PROP_BGP_CONFIGURATOR_DISABLE_ADDRESS_FAMILY_RESULT_SUCCESS:
       g_value_set_int (value, self->success);
       break;
 
@@ -6354,7 +9901,7 @@ bgp_configurator_unset_ebgp_multihop_result_get_property (GObject *object,
 }
 
 static void 
-bgp_configurator_unset_ebgp_multihop_result_instance_init (BgpConfiguratorUnsetEbgpMultihopResult * object)
+bgp_configurator_disable_address_family_result_instance_init (BgpConfiguratorDisableAddressFamilyResult * object)
 {
   /* satisfy -Wall */
   THRIFT_UNUSED_VAR (object);
@@ -6363,30 +9910,30 @@ bgp_configurator_unset_ebgp_multihop_result_instance_init (BgpConfiguratorUnsetE
 }
 
 static void 
-bgp_configurator_unset_ebgp_multihop_result_finalize (GObject *object)
+bgp_configurator_disable_address_family_result_finalize (GObject *object)
 {
-  BgpConfiguratorUnsetEbgpMultihopResult *tobject = BGP_CONFIGURATOR_UNSET_EBGP_MULTIHOP_RESULT (object);
+  BgpConfiguratorDisableAddressFamilyResult *tobject = BGP_CONFIGURATOR_DISABLE_ADDRESS_FAMILY_RESULT (object);
 
   /* satisfy -Wall in case we don't use tobject */
   THRIFT_UNUSED_VAR (tobject);
 }
 
 static void
-bgp_configurator_unset_ebgp_multihop_result_class_init (BgpConfiguratorUnsetEbgpMultihopResultClass * cls)
+bgp_configurator_disable_address_family_result_class_init (BgpConfiguratorDisableAddressFamilyResultClass * cls)
 {
   GObjectClass *gobject_class = G_OBJECT_CLASS (cls);
   ThriftStructClass *struct_class = THRIFT_STRUCT_CLASS (cls);
 
-  struct_class->read = bgp_configurator_unset_ebgp_multihop_result_read;
-  struct_class->write = bgp_configurator_unset_ebgp_multihop_result_write;
+  struct_class->read = bgp_configurator_disable_address_family_result_read;
+  struct_class->write = bgp_configurator_disable_address_family_result_write;
 
-  gobject_class->finalize = bgp_configurator_unset_ebgp_multihop_result_finalize;
-  gobject_class->get_property = bgp_configurator_unset_ebgp_multihop_result_get_property;
-  gobject_class->set_property = bgp_configurator_unset_ebgp_multihop_result_set_property;
+  gobject_class->finalize = bgp_configurator_disable_address_family_result_finalize;
+  gobject_class->get_property = bgp_configurator_disable_address_family_result_get_property;
+  gobject_class->set_property = bgp_configurator_disable_address_family_result_set_property;
 
   g_object_class_install_property
     (gobject_class,
-     PROP_BGP_CONFIGURATOR_UNSET_EBGP_MULTIHOP_RESULT_SUCCESS,
+     PROP_BGP_CONFIGURATOR_DISABLE_ADDRESS_FAMILY_RESULT_SUCCESS,
      g_param_spec_int ("success",
                        NULL,
                        NULL,
@@ -6397,7 +9944,7 @@ bgp_configurator_unset_ebgp_multihop_result_class_init (BgpConfiguratorUnsetEbgp
 }
 
 GType
-bgp_configurator_unset_ebgp_multihop_result_get_type (void)
+bgp_configurator_disable_address_family_result_get_type (void)
 {
   static GType type = 0;
 
@@ -6405,36 +9952,36 @@ bgp_configurator_unset_ebgp_multihop_result_get_type (void)
   {
     static const GTypeInfo type_info = 
     {
-      sizeof (BgpConfiguratorUnsetEbgpMultihopResultClass),
+      sizeof (BgpConfiguratorDisableAddressFamilyResultClass),
       NULL, /* base_init */
       NULL, /* base_finalize */
-      (GClassInitFunc) bgp_configurator_unset_ebgp_multihop_result_class_init,
+      (GClassInitFunc) bgp_configurator_disable_address_family_result_class_init,
       NULL, /* class_finalize */
       NULL, /* class_data */
-      sizeof (BgpConfiguratorUnsetEbgpMultihopResult),
+      sizeof (BgpConfiguratorDisableAddressFamilyResult),
       0, /* n_preallocs */
-      (GInstanceInitFunc) bgp_configurator_unset_ebgp_multihop_result_instance_init,
+      (GInstanceInitFunc) bgp_configurator_disable_address_family_result_instance_init,
       NULL, /* value_table */
     };
 
     type = g_type_register_static (THRIFT_TYPE_STRUCT, 
-                                   "BgpConfiguratorUnsetEbgpMultihopResultType",
+                                   "BgpConfiguratorDisableAddressFamilyResultType",
                                    &type_info, 0);
   }
 
   return type;
 }
 
-enum _BgpConfiguratorSetUpdateSourceArgsProperties
+enum _BgpConfiguratorSetLogConfigArgsProperties
 {
-  PROP_BGP_CONFIGURATOR_SET_UPDATE_SOURCE_ARGS_0,
-  PROP_BGP_CONFIGURATOR_SET_UPDATE_SOURCE_ARGS_PEER_IP,
-  PROP_BGP_CONFIGURATOR_SET_UPDATE_SOURCE_ARGS_SRC_IP
+  PROP_BGP_CONFIGURATOR_SET_LOG_CONFIG_ARGS_0,
+  PROP_BGP_CONFIGURATOR_SET_LOG_CONFIG_ARGS_LOG_FILE_NAME,
+  PROP_BGP_CONFIGURATOR_SET_LOG_CONFIG_ARGS_LOG_LEVEL
 };
 
-/* reads a bgp_configurator_set_update_source_args object */
+/* reads a bgp_configurator_set_log_config_args object */
 static gint32
-bgp_configurator_set_update_source_args_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+bgp_configurator_set_log_config_args_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
 {
   gint32 ret;
   gint32 xfer = 0;
@@ -6443,7 +9990,7 @@ bgp_configurator_set_update_source_args_read (ThriftStruct *object, ThriftProtoc
   gint16 fid;
   guint32 len = 0;
   gpointer data = NULL;
-  BgpConfiguratorSetUpdateSourceArgs * this_object = BGP_CONFIGURATOR_SET_UPDATE_SOURCE_ARGS(object);
+  BgpConfiguratorSetLogConfigArgs * this_object = BGP_CONFIGURATOR_SET_LOG_CONFIG_ARGS(object);
 
   /* satisfy -Wall in case these aren't used */
   THRIFT_UNUSED_VAR (len);
@@ -6484,16 +10031,16 @@ bgp_configurator_set_update_source_args_read (ThriftStruct *object, ThriftProtoc
       case 1:
         if (ftype == T_STRING)
         {
-          if (this_object->peerIp != NULL)
+          if (this_object->logFileName != NULL)
           {
-            g_free(this_object->peerIp);
-            this_object->peerIp = NULL;
+            g_free(this_object->logFileName);
+            this_object->logFileName = NULL;
           }
 
-          if ((ret = thrift_protocol_read_string (protocol, &this_object->peerIp, error)) < 0)
+          if ((ret = thrift_protocol_read_string (protocol, &this_object->logFileName, error)) < 0)
             return -1;
           xfer += ret;
-          this_object->__isset_peerIp = TRUE;
+          this_object->__isset_logFileName = TRUE;
         } else {
           if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
             return -1;
@@ -6503,16 +10050,16 @@ bgp_configurator_set_update_source_args_read (ThriftStruct *object, ThriftProtoc
       case 2:
         if (ftype == T_STRING)
         {
-          if (this_object->srcIp != NULL)
+          if (this_object->logLevel != NULL)
           {
-            g_free(this_object->srcIp);
-            this_object->srcIp = NULL;
+            g_free(this_object->logLevel);
+            this_object->logLevel = NULL;
           }
 
-          if ((ret = thrift_protocol_read_string (protocol, &this_object->srcIp, error)) < 0)
+          if ((ret = thrift_protocol_read_string (protocol, &this_object->logLevel, error)) < 0)
             return -1;
           xfer += ret;
-          this_object->__isset_srcIp = TRUE;
+          this_object->__isset_logLevel = TRUE;
         } else {
           if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
             return -1;
@@ -6538,30 +10085,30 @@ bgp_configurator_set_update_source_args_read (ThriftStruct *object, ThriftProtoc
 }
 
 static gint32
-bgp_configurator_set_update_source_args_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+bgp_configurator_set_log_config_args_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
 {
   gint32 ret;
   gint32 xfer = 0;
 
-  BgpConfiguratorSetUpdateSourceArgs * this_object = BGP_CONFIGURATOR_SET_UPDATE_SOURCE_ARGS(object);
+  BgpConfiguratorSetLogConfigArgs * this_object = BGP_CONFIGURATOR_SET_LOG_CONFIG_ARGS(object);
   THRIFT_UNUSED_VAR (this_object);
-  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorSetUpdateSourceArgs", error)) < 0)
+  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorSetLogConfigArgs", error)) < 0)
     return -1;
   xfer += ret;
-  if ((ret = thrift_protocol_write_field_begin (protocol, "peerIp", T_STRING, 1, error)) < 0)
+  if ((ret = thrift_protocol_write_field_begin (protocol, "logFileName", T_STRING, 1, error)) < 0)
     return -1;
   xfer += ret;
-  if ((ret = thrift_protocol_write_string (protocol, this_object->peerIp, error)) < 0)
+  if ((ret = thrift_protocol_write_string (protocol, this_object->logFileName, error)) < 0)
     return -1;
   xfer += ret;
 
   if ((ret = thrift_protocol_write_field_end (protocol, error)) < 0)
     return -1;
   xfer += ret;
-  if ((ret = thrift_protocol_write_field_begin (protocol, "srcIp", T_STRING, 2, error)) < 0)
+  if ((ret = thrift_protocol_write_field_begin (protocol, "logLevel", T_STRING, 2, error)) < 0)
     return -1;
   xfer += ret;
-  if ((ret = thrift_protocol_write_string (protocol, this_object->srcIp, error)) < 0)
+  if ((ret = thrift_protocol_write_string (protocol, this_object->logLevel, error)) < 0)
     return -1;
   xfer += ret;
 
@@ -6579,27 +10126,27 @@ bgp_configurator_set_update_source_args_write (ThriftStruct *object, ThriftProto
 }
 
 static void
-bgp_configurator_set_update_source_args_set_property (GObject *object,
-                                                      guint property_id,
-                                                      const GValue *value,
-                                                      GParamSpec *pspec)
+bgp_configurator_set_log_config_args_set_property (GObject *object,
+                                                   guint property_id,
+                                                   const GValue *value,
+                                                   GParamSpec *pspec)
 {
-  BgpConfiguratorSetUpdateSourceArgs *self = BGP_CONFIGURATOR_SET_UPDATE_SOURCE_ARGS (object);
+  BgpConfiguratorSetLogConfigArgs *self = BGP_CONFIGURATOR_SET_LOG_CONFIG_ARGS (object);
 
   switch (property_id)
   {
-    case PROP_BGP_CONFIGURATOR_SET_UPDATE_SOURCE_ARGS_PEER_IP:
-      if (self->peerIp != NULL)
-        g_free (self->peerIp);
-      self->peerIp = g_value_dup_string (value);
-      self->__isset_peerIp = TRUE;
+    case PROP_BGP_CONFIGURATOR_SET_LOG_CONFIG_ARGS_LOG_FILE_NAME:
+      if (self->logFileName != NULL)
+        g_free (self->logFileName);
+      self->logFileName = g_value_dup_string (value);
+      self->__isset_logFileName = TRUE;
       break;
 
-    case PROP_BGP_CONFIGURATOR_SET_UPDATE_SOURCE_ARGS_SRC_IP:
-      if (self->srcIp != NULL)
-        g_free (self->srcIp);
-      self->srcIp = g_value_dup_string (value);
-      self->__isset_srcIp = TRUE;
+    case PROP_BGP_CONFIGURATOR_SET_LOG_CONFIG_ARGS_LOG_LEVEL:
+      if (self->logLevel != NULL)
+        g_free (self->logLevel);
+      self->logLevel = g_value_dup_string (value);
+      self->__isset_logLevel = TRUE;
       break;
 
     default:
@@ -6609,21 +10156,21 @@ bgp_configurator_set_update_source_args_set_property (GObject *object,
 }
 
 static void
-bgp_configurator_set_update_source_args_get_property (GObject *object,
-                                                      guint property_id,
-                                                      GValue *value,
-                                                      GParamSpec *pspec)
+bgp_configurator_set_log_config_args_get_property (GObject *object,
+                                                   guint property_id,
+                                                   GValue *value,
+                                                   GParamSpec *pspec)
 {
-  BgpConfiguratorSetUpdateSourceArgs *self = BGP_CONFIGURATOR_SET_UPDATE_SOURCE_ARGS (object);
+  BgpConfiguratorSetLogConfigArgs *self = BGP_CONFIGURATOR_SET_LOG_CONFIG_ARGS (object);
 
   switch (property_id)
   {
-    case PROP_BGP_CONFIGURATOR_SET_UPDATE_SOURCE_ARGS_PEER_IP:
-      g_value_set_string (value, self->peerIp);
+    case PROP_BGP_CONFIGURATOR_SET_LOG_CONFIG_ARGS_LOG_FILE_NAME:
+      g_value_set_string (value, self->logFileName);
       break;
 
-    case PROP_BGP_CONFIGURATOR_SET_UPDATE_SOURCE_ARGS_SRC_IP:
-      g_value_set_string (value, self->srcIp);
+    case PROP_BGP_CONFIGURATOR_SET_LOG_CONFIG_ARGS_LOG_LEVEL:
+      g_value_set_string (value, self->logLevel);
       break;
 
     default:
@@ -6633,52 +10180,52 @@ bgp_configurator_set_update_source_args_get_property (GObject *object,
 }
 
 static void 
-bgp_configurator_set_update_source_args_instance_init (BgpConfiguratorSetUpdateSourceArgs * object)
+bgp_configurator_set_log_config_args_instance_init (BgpConfiguratorSetLogConfigArgs * object)
 {
   /* satisfy -Wall */
   THRIFT_UNUSED_VAR (object);
-  object->peerIp = NULL;
-  object->__isset_peerIp = FALSE;
-  object->srcIp = NULL;
-  object->__isset_srcIp = FALSE;
+  object->logFileName = NULL;
+  object->__isset_logFileName = FALSE;
+  object->logLevel = NULL;
+  object->__isset_logLevel = FALSE;
 }
 
 static void 
-bgp_configurator_set_update_source_args_finalize (GObject *object)
+bgp_configurator_set_log_config_args_finalize (GObject *object)
 {
-  BgpConfiguratorSetUpdateSourceArgs *tobject = BGP_CONFIGURATOR_SET_UPDATE_SOURCE_ARGS (object);
+  BgpConfiguratorSetLogConfigArgs *tobject = BGP_CONFIGURATOR_SET_LOG_CONFIG_ARGS (object);
 
   /* satisfy -Wall in case we don't use tobject */
   THRIFT_UNUSED_VAR (tobject);
-  if (tobject->peerIp != NULL)
+  if (tobject->logFileName != NULL)
   {
-    g_free(tobject->peerIp);
-    tobject->peerIp = NULL;
+    g_free(tobject->logFileName);
+    tobject->logFileName = NULL;
   }
-  if (tobject->srcIp != NULL)
+  if (tobject->logLevel != NULL)
   {
-    g_free(tobject->srcIp);
-    tobject->srcIp = NULL;
+    g_free(tobject->logLevel);
+    tobject->logLevel = NULL;
   }
 }
 
 static void
-bgp_configurator_set_update_source_args_class_init (BgpConfiguratorSetUpdateSourceArgsClass * cls)
+bgp_configurator_set_log_config_args_class_init (BgpConfiguratorSetLogConfigArgsClass * cls)
 {
   GObjectClass *gobject_class = G_OBJECT_CLASS (cls);
   ThriftStructClass *struct_class = THRIFT_STRUCT_CLASS (cls);
 
-  struct_class->read = bgp_configurator_set_update_source_args_read;
-  struct_class->write = bgp_configurator_set_update_source_args_write;
+  struct_class->read = bgp_configurator_set_log_config_args_read;
+  struct_class->write = bgp_configurator_set_log_config_args_write;
 
-  gobject_class->finalize = bgp_configurator_set_update_source_args_finalize;
-  gobject_class->get_property = bgp_configurator_set_update_source_args_get_property;
-  gobject_class->set_property = bgp_configurator_set_update_source_args_set_property;
+  gobject_class->finalize = bgp_configurator_set_log_config_args_finalize;
+  gobject_class->get_property = bgp_configurator_set_log_config_args_get_property;
+  gobject_class->set_property = bgp_configurator_set_log_config_args_set_property;
 
   g_object_class_install_property
     (gobject_class,
-     PROP_BGP_CONFIGURATOR_SET_UPDATE_SOURCE_ARGS_PEER_IP,
-     g_param_spec_string ("peerIp",
+     PROP_BGP_CONFIGURATOR_SET_LOG_CONFIG_ARGS_LOG_FILE_NAME,
+     g_param_spec_string ("logFileName",
                           NULL,
                           NULL,
                           NULL,
@@ -6686,8 +10233,8 @@ bgp_configurator_set_update_source_args_class_init (BgpConfiguratorSetUpdateSour
 
   g_object_class_install_property
     (gobject_class,
-     PROP_BGP_CONFIGURATOR_SET_UPDATE_SOURCE_ARGS_SRC_IP,
-     g_param_spec_string ("srcIp",
+     PROP_BGP_CONFIGURATOR_SET_LOG_CONFIG_ARGS_LOG_LEVEL,
+     g_param_spec_string ("logLevel",
                           NULL,
                           NULL,
                           NULL,
@@ -6695,7 +10242,7 @@ bgp_configurator_set_update_source_args_class_init (BgpConfiguratorSetUpdateSour
 }
 
 GType
-bgp_configurator_set_update_source_args_get_type (void)
+bgp_configurator_set_log_config_args_get_type (void)
 {
   static GType type = 0;
 
@@ -6703,35 +10250,35 @@ bgp_configurator_set_update_source_args_get_type (void)
   {
     static const GTypeInfo type_info = 
     {
-      sizeof (BgpConfiguratorSetUpdateSourceArgsClass),
+      sizeof (BgpConfiguratorSetLogConfigArgsClass),
       NULL, /* base_init */
       NULL, /* base_finalize */
-      (GClassInitFunc) bgp_configurator_set_update_source_args_class_init,
+      (GClassInitFunc) bgp_configurator_set_log_config_args_class_init,
       NULL, /* class_finalize */
       NULL, /* class_data */
-      sizeof (BgpConfiguratorSetUpdateSourceArgs),
+      sizeof (BgpConfiguratorSetLogConfigArgs),
       0, /* n_preallocs */
-      (GInstanceInitFunc) bgp_configurator_set_update_source_args_instance_init,
+      (GInstanceInitFunc) bgp_configurator_set_log_config_args_instance_init,
       NULL, /* value_table */
     };
 
     type = g_type_register_static (THRIFT_TYPE_STRUCT, 
-                                   "BgpConfiguratorSetUpdateSourceArgsType",
+                                   "BgpConfiguratorSetLogConfigArgsType",
                                    &type_info, 0);
   }
 
   return type;
 }
 
-enum _BgpConfiguratorSetUpdateSourceResultProperties
+enum _BgpConfiguratorSetLogConfigResultProperties
 {
-  PROP_BGP_CONFIGURATOR_SET_UPDATE_SOURCE_RESULT_0,
-  PROP_BGP_CONFIGURATOR_SET_UPDATE_SOURCE_RESULT_SUCCESS
+  PROP_BGP_CONFIGURATOR_SET_LOG_CONFIG_RESULT_0,
+  PROP_BGP_CONFIGURATOR_SET_LOG_CONFIG_RESULT_SUCCESS
 };
 
-/* reads a bgp_configurator_set_update_source_result object */
+/* reads a bgp_configurator_set_log_config_result object */
 static gint32
-bgp_configurator_set_update_source_result_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+bgp_configurator_set_log_config_result_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
 {
   gint32 ret;
   gint32 xfer = 0;
@@ -6740,7 +10287,7 @@ bgp_configurator_set_update_source_result_read (ThriftStruct *object, ThriftProt
   gint16 fid;
   guint32 len = 0;
   gpointer data = NULL;
-  BgpConfiguratorSetUpdateSourceResult * this_object = BGP_CONFIGURATOR_SET_UPDATE_SOURCE_RESULT(object);
+  BgpConfiguratorSetLogConfigResult * this_object = BGP_CONFIGURATOR_SET_LOG_CONFIG_RESULT(object);
 
   /* satisfy -Wall in case these aren't used */
   THRIFT_UNUSED_VAR (len);
@@ -6810,14 +10357,14 @@ bgp_configurator_set_update_source_result_read (ThriftStruct *object, ThriftProt
 }
 
 static gint32
-bgp_configurator_set_update_source_result_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+bgp_configurator_set_log_config_result_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
 {
   gint32 ret;
   gint32 xfer = 0;
 
-  BgpConfiguratorSetUpdateSourceResult * this_object = BGP_CONFIGURATOR_SET_UPDATE_SOURCE_RESULT(object);
+  BgpConfiguratorSetLogConfigResult * this_object = BGP_CONFIGURATOR_SET_LOG_CONFIG_RESULT(object);
   THRIFT_UNUSED_VAR (this_object);
-  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorSetUpdateSourceResult", error)) < 0)
+  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorSetLogConfigResult", error)) < 0)
     return -1;
   xfer += ret;
   if (this_object->__isset_success == TRUE) {
@@ -6843,16 +10390,16 @@ bgp_configurator_set_update_source_result_write (ThriftStruct *object, ThriftPro
 }
 
 static void
-bgp_configurator_set_update_source_result_set_property (GObject *object,
-                                                        guint property_id,
-                                                        const GValue *value,
-                                                        GParamSpec *pspec)
+bgp_configurator_set_log_config_result_set_property (GObject *object,
+                                                     guint property_id,
+                                                     const GValue *value,
+                                                     GParamSpec *pspec)
 {
-  BgpConfiguratorSetUpdateSourceResult *self = BGP_CONFIGURATOR_SET_UPDATE_SOURCE_RESULT (object);
+  BgpConfiguratorSetLogConfigResult *self = BGP_CONFIGURATOR_SET_LOG_CONFIG_RESULT (object);
 
   switch (property_id)
   {
-    case PROP_BGP_CONFIGURATOR_SET_UPDATE_SOURCE_RESULT_SUCCESS:
+    case PROP_BGP_CONFIGURATOR_SET_LOG_CONFIG_RESULT_SUCCESS:
       self->success = g_value_get_int (value);
       self->__isset_success = TRUE;
       break;
@@ -6864,16 +10411,16 @@ bgp_configurator_set_update_source_result_set_property (GObject *object,
 }
 
 static void
-bgp_configurator_set_update_source_result_get_property (GObject *object,
-                                                        guint property_id,
-                                                        GValue *value,
-                                                        GParamSpec *pspec)
+bgp_configurator_set_log_config_result_get_property (GObject *object,
+                                                     guint property_id,
+                                                     GValue *value,
+                                                     GParamSpec *pspec)
 {
-  BgpConfiguratorSetUpdateSourceResult *self = BGP_CONFIGURATOR_SET_UPDATE_SOURCE_RESULT (object);
+  BgpConfiguratorSetLogConfigResult *self = BGP_CONFIGURATOR_SET_LOG_CONFIG_RESULT (object);
 
   switch (property_id)
   {
-    case PROP_BGP_CONFIGURATOR_SET_UPDATE_SOURCE_RESULT_SUCCESS:
+    case PROP_BGP_CONFIGURATOR_SET_LOG_CONFIG_RESULT_SUCCESS:
       g_value_set_int (value, self->success);
       break;
 
@@ -6884,7 +10431,7 @@ bgp_configurator_set_update_source_result_get_property (GObject *object,
 }
 
 static void 
-bgp_configurator_set_update_source_result_instance_init (BgpConfiguratorSetUpdateSourceResult * object)
+bgp_configurator_set_log_config_result_instance_init (BgpConfiguratorSetLogConfigResult * object)
 {
   /* satisfy -Wall */
   THRIFT_UNUSED_VAR (object);
@@ -6893,30 +10440,30 @@ bgp_configurator_set_update_source_result_instance_init (BgpConfiguratorSetUpdat
 }
 
 static void 
-bgp_configurator_set_update_source_result_finalize (GObject *object)
+bgp_configurator_set_log_config_result_finalize (GObject *object)
 {
-  BgpConfiguratorSetUpdateSourceResult *tobject = BGP_CONFIGURATOR_SET_UPDATE_SOURCE_RESULT (object);
+  BgpConfiguratorSetLogConfigResult *tobject = BGP_CONFIGURATOR_SET_LOG_CONFIG_RESULT (object);
 
   /* satisfy -Wall in case we don't use tobject */
   THRIFT_UNUSED_VAR (tobject);
 }
 
 static void
-bgp_configurator_set_update_source_result_class_init (BgpConfiguratorSetUpdateSourceResultClass * cls)
+bgp_configurator_set_log_config_result_class_init (BgpConfiguratorSetLogConfigResultClass * cls)
 {
   GObjectClass *gobject_class = G_OBJECT_CLASS (cls);
   ThriftStructClass *struct_class = THRIFT_STRUCT_CLASS (cls);
 
-  struct_class->read = bgp_configurator_set_update_source_result_read;
-  struct_class->write = bgp_configurator_set_update_source_result_write;
+  struct_class->read = bgp_configurator_set_log_config_result_read;
+  struct_class->write = bgp_configurator_set_log_config_result_write;
 
-  gobject_class->finalize = bgp_configurator_set_update_source_result_finalize;
-  gobject_class->get_property = bgp_configurator_set_update_source_result_get_property;
-  gobject_class->set_property = bgp_configurator_set_update_source_result_set_property;
+  gobject_class->finalize = bgp_configurator_set_log_config_result_finalize;
+  gobject_class->get_property = bgp_configurator_set_log_config_result_get_property;
+  gobject_class->set_property = bgp_configurator_set_log_config_result_set_property;
 
   g_object_class_install_property
     (gobject_class,
-     PROP_BGP_CONFIGURATOR_SET_UPDATE_SOURCE_RESULT_SUCCESS,
+     PROP_BGP_CONFIGURATOR_SET_LOG_CONFIG_RESULT_SUCCESS,
      g_param_spec_int ("success",
                        NULL,
                        NULL,
@@ -6927,7 +10474,7 @@ bgp_configurator_set_update_source_result_class_init (BgpConfiguratorSetUpdateSo
 }
 
 GType
-bgp_configurator_set_update_source_result_get_type (void)
+bgp_configurator_set_log_config_result_get_type (void)
 {
   static GType type = 0;
 
@@ -6935,35 +10482,35 @@ bgp_configurator_set_update_source_result_get_type (void)
   {
     static const GTypeInfo type_info = 
     {
-      sizeof (BgpConfiguratorSetUpdateSourceResultClass),
+      sizeof (BgpConfiguratorSetLogConfigResultClass),
       NULL, /* base_init */
       NULL, /* base_finalize */
-      (GClassInitFunc) bgp_configurator_set_update_source_result_class_init,
+      (GClassInitFunc) bgp_configurator_set_log_config_result_class_init,
       NULL, /* class_finalize */
       NULL, /* class_data */
-      sizeof (BgpConfiguratorSetUpdateSourceResult),
+      sizeof (BgpConfiguratorSetLogConfigResult),
       0, /* n_preallocs */
-      (GInstanceInitFunc) bgp_configurator_set_update_source_result_instance_init,
+      (GInstanceInitFunc) bgp_configurator_set_log_config_result_instance_init,
       NULL, /* value_table */
     };
 
     type = g_type_register_static (THRIFT_TYPE_STRUCT, 
-                                   "BgpConfiguratorSetUpdateSourceResultType",
+                                   "BgpConfiguratorSetLogConfigResultType",
                                    &type_info, 0);
   }
 
   return type;
 }
 
-enum _BgpConfiguratorUnsetUpdateSourceArgsProperties
+enum _BgpConfiguratorEnableGracefulRestartArgsProperties
 {
-  PROP_BGP_CONFIGURATOR_UNSET_UPDATE_SOURCE_ARGS_0,
-  PROP_BGP_CONFIGURATOR_UNSET_UPDATE_SOURCE_ARGS_PEER_IP
+  PROP_BGP_CONFIGURATOR_ENABLE_GRACEFUL_RESTART_ARGS_0,
+  PROP_BGP_CONFIGURATOR_ENABLE_GRACEFUL_RESTART_ARGS_STALEPATH_TIME
 };
 
-/* reads a bgp_configurator_unset_update_source_args object */
+/* reads a bgp_configurator_enable_graceful_restart_args object */
 static gint32
-bgp_configurator_unset_update_source_args_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+bgp_configurator_enable_graceful_restart_args_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
 {
   gint32 ret;
   gint32 xfer = 0;
@@ -6972,7 +10519,7 @@ bgp_configurator_unset_update_source_args_read (ThriftStruct *object, ThriftProt
   gint16 fid;
   guint32 len = 0;
   gpointer data = NULL;
-  BgpConfiguratorUnsetUpdateSourceArgs * this_object = BGP_CONFIGURATOR_UNSET_UPDATE_SOURCE_ARGS(object);
+  BgpConfiguratorEnableGracefulRestartArgs * this_object = BGP_CONFIGURATOR_ENABLE_GRACEFUL_RESTART_ARGS(object);
 
   /* satisfy -Wall in case these aren't used */
   THRIFT_UNUSED_VAR (len);
@@ -7011,18 +10558,12 @@ bgp_configurator_unset_update_source_args_read (ThriftStruct *object, ThriftProt
     switch (fid)
     {
       case 1:
-        if (ftype == T_STRING)
+        if (ftype == T_I32)
         {
-          if (this_object->peerIp != NULL)
-          {
-            g_free(this_object->peerIp);
-            this_object->peerIp = NULL;
-          }
-
-          if ((ret = thrift_protocol_read_string (protocol, &this_object->peerIp, error)) < 0)
+          if ((ret = thrift_protocol_read_i32 (protocol, &this_object->stalepathTime, error)) < 0)
             return -1;
           xfer += ret;
-          this_object->__isset_peerIp = TRUE;
+          this_object->__isset_stalepathTime = TRUE;
         } else {
           if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
             return -1;
@@ -7048,20 +10589,20 @@ bgp_configurator_unset_update_source_args_read (ThriftStruct *object, ThriftProt
 }
 
 static gint32
-bgp_configurator_unset_update_source_args_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+bgp_configurator_enable_graceful_restart_args_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
 {
   gint32 ret;
   gint32 xfer = 0;
 
-  BgpConfiguratorUnsetUpdateSourceArgs * this_object = BGP_CONFIGURATOR_UNSET_UPDATE_SOURCE_ARGS(object);
+  BgpConfiguratorEnableGracefulRestartArgs * this_object = BGP_CONFIGURATOR_ENABLE_GRACEFUL_RESTART_ARGS(object);
   THRIFT_UNUSED_VAR (this_object);
-  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorUnsetUpdateSourceArgs", error)) < 0)
+  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorEnableGracefulRestartArgs", error)) < 0)
     return -1;
   xfer += ret;
-  if ((ret = thrift_protocol_write_field_begin (protocol, "peerIp", T_STRING, 1, error)) < 0)
+  if ((ret = thrift_protocol_write_field_begin (protocol, "stalepathTime", T_I32, 1, error)) < 0)
     return -1;
   xfer += ret;
-  if ((ret = thrift_protocol_write_string (protocol, this_object->peerIp, error)) < 0)
+  if ((ret = thrift_protocol_write_i32 (protocol, this_object->stalepathTime, error)) < 0)
     return -1;
   xfer += ret;
 
@@ -7079,20 +10620,18 @@ bgp_configurator_unset_update_source_args_write (ThriftStruct *object, ThriftPro
 }
 
 static void
-bgp_configurator_unset_update_source_args_set_property (GObject *object,
-                                                        guint property_id,
-                                                        const GValue *value,
-                                                        GParamSpec *pspec)
+bgp_configurator_enable_graceful_restart_args_set_property (GObject *object,
+                                                            guint property_id,
+                                                            const GValue *value,
+                                                            GParamSpec *pspec)
 {
-  BgpConfiguratorUnsetUpdateSourceArgs *self = BGP_CONFIGURATOR_UNSET_UPDATE_SOURCE_ARGS (object);
+  BgpConfiguratorEnableGracefulRestartArgs *self = BGP_CONFIGURATOR_ENABLE_GRACEFUL_RESTART_ARGS (object);
 
   switch (property_id)
   {
-    case PROP_BGP_CONFIGURATOR_UNSET_UPDATE_SOURCE_ARGS_PEER_IP:
-      if (self->peerIp != NULL)
-        g_free (self->peerIp);
-      self->peerIp = g_value_dup_string (value);
-      self->__isset_peerIp = TRUE;
+    case PROP_BGP_CONFIGURATOR_ENABLE_GRACEFUL_RESTART_ARGS_STALEPATH_TIME:
+      self->stalepathTime = g_value_get_int (value);
+      self->__isset_stalepathTime = TRUE;
       break;
 
     default:
@@ -7102,17 +10641,17 @@ bgp_configurator_unset_update_source_args_set_property (GObject *object,
 }
 
 static void
-bgp_configurator_unset_update_source_args_get_property (GObject *object,
-                                                        guint property_id,
-                                                        GValue *value,
-                                                        GParamSpec *pspec)
+bgp_configurator_enable_graceful_restart_args_get_property (GObject *object,
+                                                            guint property_id,
+                                                            GValue *value,
+                                                            GParamSpec *pspec)
 {
-  BgpConfiguratorUnsetUpdateSourceArgs *self = BGP_CONFIGURATOR_UNSET_UPDATE_SOURCE_ARGS (object);
+  BgpConfiguratorEnableGracefulRestartArgs *self = BGP_CONFIGURATOR_ENABLE_GRACEFUL_RESTART_ARGS (object);
 
   switch (property_id)
   {
-    case PROP_BGP_CONFIGURATOR_UNSET_UPDATE_SOURCE_ARGS_PEER_IP:
-      g_value_set_string (value, self->peerIp);
+    case PROP_BGP_CONFIGURATOR_ENABLE_GRACEFUL_RESTART_ARGS_STALEPATH_TIME:
+      g_value_set_int (value, self->stalepathTime);
       break;
 
     default:
@@ -7122,53 +10661,50 @@ bgp_configurator_unset_update_source_args_get_property (GObject *object,
 }
 
 static void 
-bgp_configurator_unset_update_source_args_instance_init (BgpConfiguratorUnsetUpdateSourceArgs * object)
+bgp_configurator_enable_graceful_restart_args_instance_init (BgpConfiguratorEnableGracefulRestartArgs * object)
 {
   /* satisfy -Wall */
   THRIFT_UNUSED_VAR (object);
-  object->peerIp = NULL;
-  object->__isset_peerIp = FALSE;
+  object->stalepathTime = 0;
+  object->__isset_stalepathTime = FALSE;
 }
 
 static void 
-bgp_configurator_unset_update_source_args_finalize (GObject *object)
+bgp_configurator_enable_graceful_restart_args_finalize (GObject *object)
 {
-  BgpConfiguratorUnsetUpdateSourceArgs *tobject = BGP_CONFIGURATOR_UNSET_UPDATE_SOURCE_ARGS (object);
+  BgpConfiguratorEnableGracefulRestartArgs *tobject = BGP_CONFIGURATOR_ENABLE_GRACEFUL_RESTART_ARGS (object);
 
   /* satisfy -Wall in case we don't use tobject */
   THRIFT_UNUSED_VAR (tobject);
-  if (tobject->peerIp != NULL)
-  {
-    g_free(tobject->peerIp);
-    tobject->peerIp = NULL;
-  }
 }
 
 static void
-bgp_configurator_unset_update_source_args_class_init (BgpConfiguratorUnsetUpdateSourceArgsClass * cls)
+bgp_configurator_enable_graceful_restart_args_class_init (BgpConfiguratorEnableGracefulRestartArgsClass * cls)
 {
   GObjectClass *gobject_class = G_OBJECT_CLASS (cls);
   ThriftStructClass *struct_class = THRIFT_STRUCT_CLASS (cls);
 
-  struct_class->read = bgp_configurator_unset_update_source_args_read;
-  struct_class->write = bgp_configurator_unset_update_source_args_write;
+  struct_class->read = bgp_configurator_enable_graceful_restart_args_read;
+  struct_class->write = bgp_configurator_enable_graceful_restart_args_write;
 
-  gobject_class->finalize = bgp_configurator_unset_update_source_args_finalize;
-  gobject_class->get_property = bgp_configurator_unset_update_source_args_get_property;
-  gobject_class->set_property = bgp_configurator_unset_update_source_args_set_property;
+  gobject_class->finalize = bgp_configurator_enable_graceful_restart_args_finalize;
+  gobject_class->get_property = bgp_configurator_enable_graceful_restart_args_get_property;
+  gobject_class->set_property = bgp_configurator_enable_graceful_restart_args_set_property;
 
   g_object_class_install_property
     (gobject_class,
-     PROP_BGP_CONFIGURATOR_UNSET_UPDATE_SOURCE_ARGS_PEER_IP,
-     g_param_spec_string ("peerIp",
-                          NULL,
-                          NULL,
-                          NULL,
-                          G_PARAM_READWRITE));
+     PROP_BGP_CONFIGURATOR_ENABLE_GRACEFUL_RESTART_ARGS_STALEPATH_TIME,
+     g_param_spec_int ("stalepathTime",
+                       NULL,
+                       NULL,
+                       G_MININT32,
+                       G_MAXINT32,
+                       0,
+                       G_PARAM_READWRITE));
 }
 
 GType
-bgp_configurator_unset_update_source_args_get_type (void)
+bgp_configurator_enable_graceful_restart_args_get_type (void)
 {
   static GType type = 0;
 
@@ -7176,35 +10712,35 @@ bgp_configurator_unset_update_source_args_get_type (void)
   {
     static const GTypeInfo type_info = 
     {
-      sizeof (BgpConfiguratorUnsetUpdateSourceArgsClass),
+      sizeof (BgpConfiguratorEnableGracefulRestartArgsClass),
       NULL, /* base_init */
       NULL, /* base_finalize */
-      (GClassInitFunc) bgp_configurator_unset_update_source_args_class_init,
+      (GClassInitFunc) bgp_configurator_enable_graceful_restart_args_class_init,
       NULL, /* class_finalize */
       NULL, /* class_data */
-      sizeof (BgpConfiguratorUnsetUpdateSourceArgs),
+      sizeof (BgpConfiguratorEnableGracefulRestartArgs),
       0, /* n_preallocs */
-      (GInstanceInitFunc) bgp_configurator_unset_update_source_args_instance_init,
+      (GInstanceInitFunc) bgp_configurator_enable_graceful_restart_args_instance_init,
       NULL, /* value_table */
     };
 
     type = g_type_register_static (THRIFT_TYPE_STRUCT, 
-                                   "BgpConfiguratorUnsetUpdateSourceArgsType",
+                                   "BgpConfiguratorEnableGracefulRestartArgsType",
                                    &type_info, 0);
   }
 
   return type;
 }
 
-enum _BgpConfiguratorUnsetUpdateSourceResultProperties
+enum _BgpConfiguratorEnableGracefulRestartResultProperties
 {
-  PROP_BGP_CONFIGURATOR_UNSET_UPDATE_SOURCE_RESULT_0,
-  PROP_BGP_CONFIGURATOR_UNSET_UPDATE_SOURCE_RESULT_SUCCESS
+  PROP_BGP_CONFIGURATOR_ENABLE_GRACEFUL_RESTART_RESULT_0,
+  PROP_BGP_CONFIGURATOR_ENABLE_GRACEFUL_RESTART_RESULT_SUCCESS
 };
 
-/* reads a bgp_configurator_unset_update_source_result object */
+/* reads a bgp_configurator_enable_graceful_restart_result object */
 static gint32
-bgp_configurator_unset_update_source_result_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+bgp_configurator_enable_graceful_restart_result_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
 {
   gint32 ret;
   gint32 xfer = 0;
@@ -7213,7 +10749,7 @@ bgp_configurator_unset_update_source_result_read (ThriftStruct *object, ThriftPr
   gint16 fid;
   guint32 len = 0;
   gpointer data = NULL;
-  BgpConfiguratorUnsetUpdateSourceResult * this_object = BGP_CONFIGURATOR_UNSET_UPDATE_SOURCE_RESULT(object);
+  BgpConfiguratorEnableGracefulRestartResult * this_object = BGP_CONFIGURATOR_ENABLE_GRACEFUL_RESTART_RESULT(object);
 
   /* satisfy -Wall in case these aren't used */
   THRIFT_UNUSED_VAR (len);
@@ -7283,14 +10819,14 @@ bgp_configurator_unset_update_source_result_read (ThriftStruct *object, ThriftPr
 }
 
 static gint32
-bgp_configurator_unset_update_source_result_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+bgp_configurator_enable_graceful_restart_result_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
 {
   gint32 ret;
   gint32 xfer = 0;
 
-  BgpConfiguratorUnsetUpdateSourceResult * this_object = BGP_CONFIGURATOR_UNSET_UPDATE_SOURCE_RESULT(object);
+  BgpConfiguratorEnableGracefulRestartResult * this_object = BGP_CONFIGURATOR_ENABLE_GRACEFUL_RESTART_RESULT(object);
   THRIFT_UNUSED_VAR (this_object);
-  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorUnsetUpdateSourceResult", error)) < 0)
+  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorEnableGracefulRestartResult", error)) < 0)
     return -1;
   xfer += ret;
   if (this_object->__isset_success == TRUE) {
@@ -7316,16 +10852,16 @@ bgp_configurator_unset_update_source_result_write (ThriftStruct *object, ThriftP
 }
 
 static void
-bgp_configurator_unset_update_source_result_set_property (GObject *object,
-                                                          guint property_id,
-                                                          const GValue *value,
-                                                          GParamSpec *pspec)
+bgp_configurator_enable_graceful_restart_result_set_property (GObject *object,
+                                                              guint property_id,
+                                                              const GValue *value,
+                                                              GParamSpec *pspec)
 {
-  BgpConfiguratorUnsetUpdateSourceResult *self = BGP_CONFIGURATOR_UNSET_UPDATE_SOURCE_RESULT (object);
+  BgpConfiguratorEnableGracefulRestartResult *self = BGP_CONFIGURATOR_ENABLE_GRACEFUL_RESTART_RESULT (object);
 
   switch (property_id)
   {
-    case PROP_BGP_CONFIGURATOR_UNSET_UPDATE_SOURCE_RESULT_SUCCESS:
+    case PROP_BGP_CONFIGURATOR_ENABLE_GRACEFUL_RESTART_RESULT_SUCCESS:
       self->success = g_value_get_int (value);
       self->__isset_success = TRUE;
       break;
@@ -7337,16 +10873,16 @@ bgp_configurator_unset_update_source_result_set_property (GObject *object,
 }
 
 static void
-bgp_configurator_unset_update_source_result_get_property (GObject *object,
-                                                          guint property_id,
-                                                          GValue *value,
-                                                          GParamSpec *pspec)
+bgp_configurator_enable_graceful_restart_result_get_property (GObject *object,
+                                                              guint property_id,
+                                                              GValue *value,
+                                                              GParamSpec *pspec)
 {
-  BgpConfiguratorUnsetUpdateSourceResult *self = BGP_CONFIGURATOR_UNSET_UPDATE_SOURCE_RESULT (object);
+  BgpConfiguratorEnableGracefulRestartResult *self = BGP_CONFIGURATOR_ENABLE_GRACEFUL_RESTART_RESULT (object);
 
   switch (property_id)
   {
-    case PROP_BGP_CONFIGURATOR_UNSET_UPDATE_SOURCE_RESULT_SUCCESS:
+    case PROP_BGP_CONFIGURATOR_ENABLE_GRACEFUL_RESTART_RESULT_SUCCESS:
       g_value_set_int (value, self->success);
       break;
 
@@ -7357,7 +10893,7 @@ bgp_configurator_unset_update_source_result_get_property (GObject *object,
 }
 
 static void 
-bgp_configurator_unset_update_source_result_instance_init (BgpConfiguratorUnsetUpdateSourceResult * object)
+bgp_configurator_enable_graceful_restart_result_instance_init (BgpConfiguratorEnableGracefulRestartResult * object)
 {
   /* satisfy -Wall */
   THRIFT_UNUSED_VAR (object);
@@ -7366,30 +10902,30 @@ bgp_configurator_unset_update_source_result_instance_init (BgpConfiguratorUnsetU
 }
 
 static void 
-bgp_configurator_unset_update_source_result_finalize (GObject *object)
+bgp_configurator_enable_graceful_restart_result_finalize (GObject *object)
 {
-  BgpConfiguratorUnsetUpdateSourceResult *tobject = BGP_CONFIGURATOR_UNSET_UPDATE_SOURCE_RESULT (object);
+  BgpConfiguratorEnableGracefulRestartResult *tobject = BGP_CONFIGURATOR_ENABLE_GRACEFUL_RESTART_RESULT (object);
 
   /* satisfy -Wall in case we don't use tobject */
   THRIFT_UNUSED_VAR (tobject);
 }
 
 static void
-bgp_configurator_unset_update_source_result_class_init (BgpConfiguratorUnsetUpdateSourceResultClass * cls)
+bgp_configurator_enable_graceful_restart_result_class_init (BgpConfiguratorEnableGracefulRestartResultClass * cls)
 {
   GObjectClass *gobject_class = G_OBJECT_CLASS (cls);
   ThriftStructClass *struct_class = THRIFT_STRUCT_CLASS (cls);
 
-  struct_class->read = bgp_configurator_unset_update_source_result_read;
-  struct_class->write = bgp_configurator_unset_update_source_result_write;
+  struct_class->read = bgp_configurator_enable_graceful_restart_result_read;
+  struct_class->write = bgp_configurator_enable_graceful_restart_result_write;
 
-  gobject_class->finalize = bgp_configurator_unset_update_source_result_finalize;
-  gobject_class->get_property = bgp_configurator_unset_update_source_result_get_property;
-  gobject_class->set_property = bgp_configurator_unset_update_source_result_set_property;
+  gobject_class->finalize = bgp_configurator_enable_graceful_restart_result_finalize;
+  gobject_class->get_property = bgp_configurator_enable_graceful_restart_result_get_property;
+  gobject_class->set_property = bgp_configurator_enable_graceful_restart_result_set_property;
 
   g_object_class_install_property
     (gobject_class,
-     PROP_BGP_CONFIGURATOR_UNSET_UPDATE_SOURCE_RESULT_SUCCESS,
+     PROP_BGP_CONFIGURATOR_ENABLE_GRACEFUL_RESTART_RESULT_SUCCESS,
      g_param_spec_int ("success",
                        NULL,
                        NULL,
@@ -7400,7 +10936,7 @@ bgp_configurator_unset_update_source_result_class_init (BgpConfiguratorUnsetUpda
 }
 
 GType
-bgp_configurator_unset_update_source_result_get_type (void)
+bgp_configurator_enable_graceful_restart_result_get_type (void)
 {
   static GType type = 0;
 
@@ -7408,37 +10944,29 @@ bgp_configurator_unset_update_source_result_get_type (void)
   {
     static const GTypeInfo type_info = 
     {
-      sizeof (BgpConfiguratorUnsetUpdateSourceResultClass),
+      sizeof (BgpConfiguratorEnableGracefulRestartResultClass),
       NULL, /* base_init */
       NULL, /* base_finalize */
-      (GClassInitFunc) bgp_configurator_unset_update_source_result_class_init,
+      (GClassInitFunc) bgp_configurator_enable_graceful_restart_result_class_init,
       NULL, /* class_finalize */
       NULL, /* class_data */
-      sizeof (BgpConfiguratorUnsetUpdateSourceResult),
+      sizeof (BgpConfiguratorEnableGracefulRestartResult),
       0, /* n_preallocs */
-      (GInstanceInitFunc) bgp_configurator_unset_update_source_result_instance_init,
+      (GInstanceInitFunc) bgp_configurator_enable_graceful_restart_result_instance_init,
       NULL, /* value_table */
     };
 
     type = g_type_register_static (THRIFT_TYPE_STRUCT, 
-                                   "BgpConfiguratorUnsetUpdateSourceResultType",
+                                   "BgpConfiguratorEnableGracefulRestartResultType",
                                    &type_info, 0);
   }
 
   return type;
 }
 
-enum _BgpConfiguratorEnableAddressFamilyArgsProperties
-{
-  PROP_BGP_CONFIGURATOR_ENABLE_ADDRESS_FAMILY_ARGS_0,
-  PROP_BGP_CONFIGURATOR_ENABLE_ADDRESS_FAMILY_ARGS_PEER_IP,
-  PROP_BGP_CONFIGURATOR_ENABLE_ADDRESS_FAMILY_ARGS_AFI,
-  PROP_BGP_CONFIGURATOR_ENABLE_ADDRESS_FAMILY_ARGS_SAFI
-};
-
-/* reads a bgp_configurator_enable_address_family_args object */
+/* reads a bgp_configurator_disable_graceful_restart_args object */
 static gint32
-bgp_configurator_enable_address_family_args_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+bgp_configurator_disable_graceful_restart_args_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
 {
   gint32 ret;
   gint32 xfer = 0;
@@ -7447,7 +10975,7 @@ bgp_configurator_enable_address_family_args_read (ThriftStruct *object, ThriftPr
   gint16 fid;
   guint32 len = 0;
   gpointer data = NULL;
-  BgpConfiguratorEnableAddressFamilyArgs * this_object = BGP_CONFIGURATOR_ENABLE_ADDRESS_FAMILY_ARGS(object);
+  BgpConfiguratorDisableGracefulRestartArgs * this_object = BGP_CONFIGURATOR_DISABLE_GRACEFUL_RESTART_ARGS(object);
 
   /* satisfy -Wall in case these aren't used */
   THRIFT_UNUSED_VAR (len);
@@ -7485,55 +11013,6 @@ bgp_configurator_enable_address_family_args_read (ThriftStruct *object, ThriftPr
 
     switch (fid)
     {
-      case 1:
-        if (ftype == T_STRING)
-        {
-          if (this_object->peerIp != NULL)
-          {
-            g_free(this_object->peerIp);
-            this_object->peerIp = NULL;
-          }
-
-          if ((ret = thrift_protocol_read_string (protocol, &this_object->peerIp, error)) < 0)
-            return -1;
-          xfer += ret;
-          this_object->__isset_peerIp = TRUE;
-        } else {
-          if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
-            return -1;
-          xfer += ret;
-        }
-        break;
-      case 2:
-        if (ftype == T_I32)
-        {
-          gint32 ecast6;
-          if ((ret = thrift_protocol_read_i32 (protocol, &ecast6, error)) < 0)
-            return -1;
-          xfer += ret;
-          this_object->afi = (af_afi)ecast6;
-          this_object->__isset_afi = TRUE;
-        } else {
-          if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
-            return -1;
-          xfer += ret;
-        }
-        break;
-      case 3:
-        if (ftype == T_I32)
-        {
-          gint32 ecast7;
-          if ((ret = thrift_protocol_read_i32 (protocol, &ecast7, error)) < 0)
-            return -1;
-          xfer += ret;
-          this_object->safi = (af_safi)ecast7;
-          this_object->__isset_safi = TRUE;
-        } else {
-          if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
-            return -1;
-          xfer += ret;
-        }
-        break;
       default:
         if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
           return -1;
@@ -7543,54 +11022,24 @@ bgp_configurator_enable_address_family_args_read (ThriftStruct *object, ThriftPr
     if ((ret = thrift_protocol_read_field_end (protocol, error)) < 0)
       return -1;
     xfer += ret;
-  }
-
-  if ((ret = thrift_protocol_read_struct_end (protocol, error)) < 0)
-    return -1;
-  xfer += ret;
-
-  return xfer;
-}
-
-static gint32
-bgp_configurator_enable_address_family_args_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
-{
-  gint32 ret;
-  gint32 xfer = 0;
-
-  BgpConfiguratorEnableAddressFamilyArgs * this_object = BGP_CONFIGURATOR_ENABLE_ADDRESS_FAMILY_ARGS(object);
-  THRIFT_UNUSED_VAR (this_object);
-  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorEnableAddressFamilyArgs", error)) < 0)
-    return -1;
-  xfer += ret;
-  if ((ret = thrift_protocol_write_field_begin (protocol, "peerIp", T_STRING, 1, error)) < 0)
-    return -1;
-  xfer += ret;
-  if ((ret = thrift_protocol_write_string (protocol, this_object->peerIp, error)) < 0)
-    return -1;
-  xfer += ret;
-
-  if ((ret = thrift_protocol_write_field_end (protocol, error)) < 0)
-    return -1;
-  xfer += ret;
-  if ((ret = thrift_protocol_write_field_begin (protocol, "afi", T_I32, 2, error)) < 0)
-    return -1;
-  xfer += ret;
-  if ((ret = thrift_protocol_write_i32 (protocol, (gint32) this_object->afi, error)) < 0)
-    return -1;
-  xfer += ret;
-
-  if ((ret = thrift_protocol_write_field_end (protocol, error)) < 0)
-    return -1;
-  xfer += ret;
-  if ((ret = thrift_protocol_write_field_begin (protocol, "safi", T_I32, 3, error)) < 0)
-    return -1;
-  xfer += ret;
-  if ((ret = thrift_protocol_write_i32 (protocol, (gint32) this_object->safi, error)) < 0)
+  }
+
+  if ((ret = thrift_protocol_read_struct_end (protocol, error)) < 0)
     return -1;
   xfer += ret;
 
-  if ((ret = thrift_protocol_write_field_end (protocol, error)) < 0)
+  return xfer;
+}
+
+static gint32
+bgp_configurator_disable_graceful_restart_args_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+{
+  gint32 ret;
+  gint32 xfer = 0;
+
+  BgpConfiguratorDisableGracefulRestartArgs * this_object = BGP_CONFIGURATOR_DISABLE_GRACEFUL_RESTART_ARGS(object);
+  THRIFT_UNUSED_VAR (this_object);
+  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorDisableGracefulRestartArgs", error)) < 0)
     return -1;
   xfer += ret;
   if ((ret = thrift_protocol_write_field_stop (protocol, error)) < 0)
@@ -7603,139 +11052,36 @@ bgp_configurator_enable_address_family_args_write (ThriftStruct *object, ThriftP
   return xfer;
 }
 
-static void
-bgp_configurator_enable_address_family_args_set_property (GObject *object,
-                                                          guint property_id,
-                                                          const GValue *value,
-                                                          GParamSpec *pspec)
-{
-  BgpConfiguratorEnableAddressFamilyArgs *self = BGP_CONFIGURATOR_ENABLE_ADDRESS_FAMILY_ARGS (object);
-
-  switch (property_id)
-  {
-    case PROP_BGP_CONFIGURATOR_ENABLE_ADDRESS_FAMILY_ARGS_PEER_IP:
-      if (self->peerIp != NULL)
-        g_free (self->peerIp);
-      self->peerIp = g_value_dup_string (value);
-      self->__isset_peerIp = TRUE;
-      break;
-
-    case PROP_BGP_CONFIGURATOR_ENABLE_ADDRESS_FAMILY_ARGS_AFI:
-      self->afi = g_value_get_int (value);
-      self->__isset_afi = TRUE;
-      break;
-
-    case PROP_BGP_CONFIGURATOR_ENABLE_ADDRESS_FAMILY_ARGS_SAFI:
-      self->safi = g_value_get_int (value);
-      self->__isset_safi = TRUE;
-      break;
-
-    default:
-      G_OBJECT_WARN_INVALID_PROPERTY_ID (object, property_id, pspec);
-      break;
-  }
-}
-
-static void
-bgp_configurator_enable_address_family_args_get_property (GObject *object,
-                                                          guint property_id,
-                                                          GValue *value,
-                                                          GParamSpec *pspec)
-{
-  BgpConfiguratorEnableAddressFamilyArgs *self = BGP_CONFIGURATOR_ENABLE_ADDRESS_FAMILY_ARGS (object);
-
-  switch (property_id)
-  {
-    case PROP_BGP_CONFIGURATOR_ENABLE_ADDRESS_FAMILY_ARGS_PEER_IP:
-      g_value_set_string (value, self->peerIp);
-      break;
-
-    case PROP_BGP_CONFIGURATOR_ENABLE_ADDRESS_FAMILY_ARGS_AFI:
-      g_value_set_int (value, self->afi);
-      break;
-
-    case PROP_BGP_CONFIGURATOR_ENABLE_ADDRESS_FAMILY_ARGS_SAFI:
-      g_value_set_int (value, self->safi);
-      break;
-
-    default:
-      G_OBJECT_WARN_INVALID_PROPERTY_ID (object, property_id, pspec);
-      break;
-  }
-}
-
 static void 
-bgp_configurator_enable_address_family_args_instance_init (BgpConfiguratorEnableAddressFamilyArgs * object)
+bgp_configurator_disable_graceful_restart_args_instance_init (BgpConfiguratorDisableGracefulRestartArgs * object)
 {
   /* satisfy -Wall */
   THRIFT_UNUSED_VAR (object);
-  object->peerIp = NULL;
-  object->__isset_peerIp = FALSE;
-  object->__isset_afi = FALSE;
-  object->__isset_safi = FALSE;
 }
 
 static void 
-bgp_configurator_enable_address_family_args_finalize (GObject *object)
+bgp_configurator_disable_graceful_restart_args_finalize (GObject *object)
 {
-  BgpConfiguratorEnableAddressFamilyArgs *tobject = BGP_CONFIGURATOR_ENABLE_ADDRESS_FAMILY_ARGS (object);
+  BgpConfiguratorDisableGracefulRestartArgs *tobject = BGP_CONFIGURATOR_DISABLE_GRACEFUL_RESTART_ARGS (object);
 
   /* satisfy -Wall in case we don't use tobject */
   THRIFT_UNUSED_VAR (tobject);
-  if (tobject->peerIp != NULL)
-  {
-    g_free(tobject->peerIp);
-    tobject->peerIp = NULL;
-  }
 }
 
 static void
-bgp_configurator_enable_address_family_args_class_init (BgpConfiguratorEnableAddressFamilyArgsClass * cls)
+bgp_configurator_disable_graceful_restart_args_class_init (BgpConfiguratorDisableGracefulRestartArgsClass * cls)
 {
   GObjectClass *gobject_class = G_OBJECT_CLASS (cls);
   ThriftStructClass *struct_class = THRIFT_STRUCT_CLASS (cls);
 
-  struct_class->read = bgp_configurator_enable_address_family_args_read;
-  struct_class->write = bgp_configurator_enable_address_family_args_write;
-
-  gobject_class->finalize = bgp_configurator_enable_address_family_args_finalize;
-  gobject_class->get_property = bgp_configurator_enable_address_family_args_get_property;
-  gobject_class->set_property = bgp_configurator_enable_address_family_args_set_property;
-
-  g_object_class_install_property
-    (gobject_class,
-     PROP_BGP_CONFIGURATOR_ENABLE_ADDRESS_FAMILY_ARGS_PEER_IP,
-     g_param_spec_string ("peerIp",
-                          NULL,
-                          NULL,
-                          NULL,
-                          G_PARAM_READWRITE));
-
-  g_object_class_install_property
-    (gobject_class,
-     PROP_BGP_CONFIGURATOR_ENABLE_ADDRESS_FAMILY_ARGS_AFI,
-     g_param_spec_int ("afi",
-                       NULL,
-                       NULL,
-                       1,
-                       1,
-                       1,
-                       G_PARAM_READWRITE));
+  struct_class->read = bgp_configurator_disable_graceful_restart_args_read;
+  struct_class->write = bgp_configurator_disable_graceful_restart_args_write;
 
-  g_object_class_install_property
-    (gobject_class,
-     PROP_BGP_CONFIGURATOR_ENABLE_ADDRESS_FAMILY_ARGS_SAFI,
-     g_param_spec_int ("safi",
-                       NULL,
-                       NULL,
-                       4,
-                       5,
-                       4,
-                       G_PARAM_READWRITE));
+  gobject_class->finalize = bgp_configurator_disable_graceful_restart_args_finalize;
 }
 
 GType
-bgp_configurator_enable_address_family_args_get_type (void)
+bgp_configurator_disable_graceful_restart_args_get_type (void)
 {
   static GType type = 0;
 
@@ -7743,35 +11089,35 @@ bgp_configurator_enable_address_family_args_get_type (void)
   {
     static const GTypeInfo type_info = 
     {
-      sizeof (BgpConfiguratorEnableAddressFamilyArgsClass),
+      sizeof (BgpConfiguratorDisableGracefulRestartArgsClass),
       NULL, /* base_init */
       NULL, /* base_finalize */
-      (GClassInitFunc) bgp_configurator_enable_address_family_args_class_init,
+      (GClassInitFunc) bgp_configurator_disable_graceful_restart_args_class_init,
       NULL, /* class_finalize */
       NULL, /* class_data */
-      sizeof (BgpConfiguratorEnableAddressFamilyArgs),
+      sizeof (BgpConfiguratorDisableGracefulRestartArgs),
       0, /* n_preallocs */
-      (GInstanceInitFunc) bgp_configurator_enable_address_family_args_instance_init,
+      (GInstanceInitFunc) bgp_configurator_disable_graceful_restart_args_instance_init,
       NULL, /* value_table */
     };
 
     type = g_type_register_static (THRIFT_TYPE_STRUCT, 
-                                   "BgpConfiguratorEnableAddressFamilyArgsType",
+                                   "BgpConfiguratorDisableGracefulRestartArgsType",
                                    &type_info, 0);
   }
 
   return type;
 }
 
-enum _BgpConfiguratorEnableAddressFamilyResultProperties
+enum _BgpConfiguratorDisableGracefulRestartResultProperties
 {
-  PROP_BGP_CONFIGURATOR_ENABLE_ADDRESS_FAMILY_RESULT_0,
-  PROP_BGP_CONFIGURATOR_ENABLE_ADDRESS_FAMILY_RESULT_SUCCESS
+  PROP_BGP_CONFIGURATOR_DISABLE_GRACEFUL_RESTART_RESULT_0,
+  PROP_BGP_CONFIGURATOR_DISABLE_GRACEFUL_RESTART_RESULT_SUCCESS
 };
 
-/* reads a bgp_configurator_enable_address_family_result object */
+/* reads a bgp_configurator_disable_graceful_restart_result object */
 static gint32
-bgp_configurator_enable_address_family_result_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+bgp_configurator_disable_graceful_restart_result_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
 {
   gint32 ret;
   gint32 xfer = 0;
@@ -7780,7 +11126,7 @@ bgp_configurator_enable_address_family_result_read (ThriftStruct *object, Thrift
   gint16 fid;
   guint32 len = 0;
   gpointer data = NULL;
-  BgpConfiguratorEnableAddressFamilyResult * this_object = BGP_CONFIGURATOR_ENABLE_ADDRESS_FAMILY_RESULT(object);
+  BgpConfiguratorDisableGracefulRestartResult * this_object = BGP_CONFIGURATOR_DISABLE_GRACEFUL_RESTART_RESULT(object);
 
   /* satisfy -Wall in case these aren't used */
   THRIFT_UNUSED_VAR (len);
@@ -7850,14 +11196,14 @@ bgp_configurator_enable_address_family_result_read (ThriftStruct *object, Thrift
 }
 
 static gint32
-bgp_configurator_enable_address_family_result_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+bgp_configurator_disable_graceful_restart_result_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
 {
   gint32 ret;
   gint32 xfer = 0;
 
-  BgpConfiguratorEnableAddressFamilyResult * this_object = BGP_CONFIGURATOR_ENABLE_ADDRESS_FAMILY_RESULT(object);
+  BgpConfiguratorDisableGracefulRestartResult * this_object = BGP_CONFIGURATOR_DISABLE_GRACEFUL_RESTART_RESULT(object);
   THRIFT_UNUSED_VAR (this_object);
-  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorEnableAddressFamilyResult", error)) < 0)
+  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorDisableGracefulRestartResult", error)) < 0)
     return -1;
   xfer += ret;
   if (this_object->__isset_success == TRUE) {
@@ -7883,16 +11229,16 @@ bgp_configurator_enable_address_family_result_write (ThriftStruct *object, Thrif
 }
 
 static void
-bgp_configurator_enable_address_family_result_set_property (GObject *object,
-                                                            guint property_id,
-                                                            const GValue *value,
-                                                            GParamSpec *pspec)
+bgp_configurator_disable_graceful_restart_result_set_property (GObject *object,
+                                                               guint property_id,
+                                                               const GValue *value,
+                                                               GParamSpec *pspec)
 {
-  BgpConfiguratorEnableAddressFamilyResult *self = BGP_CONFIGURATOR_ENABLE_ADDRESS_FAMILY_RESULT (object);
+  BgpConfiguratorDisableGracefulRestartResult *self = BGP_CONFIGURATOR_DISABLE_GRACEFUL_RESTART_RESULT (object);
 
   switch (property_id)
   {
-    case PROP_BGP_CONFIGURATOR_ENABLE_ADDRESS_FAMILY_RESULT_SUCCESS:
+    case PROP_BGP_CONFIGURATOR_DISABLE_GRACEFUL_RESTART_RESULT_SUCCESS:
       self->success = g_value_get_int (value);
       self->__isset_success = TRUE;
       break;
@@ -7904,16 +11250,16 @@ bgp_configurator_enable_address_family_result_set_property (GObject *object,
 }
 
 static void
-bgp_configurator_enable_address_family_result_get_property (GObject *object,
-                                                            guint property_id,
-                                                            GValue *value,
-                                                            GParamSpec *pspec)
+bgp_configurator_disable_graceful_restart_result_get_property (GObject *object,
+                                                               guint property_id,
+                                                               GValue *value,
+                                                               GParamSpec *pspec)
 {
-  BgpConfiguratorEnableAddressFamilyResult *self = BGP_CONFIGURATOR_ENABLE_ADDRESS_FAMILY_RESULT (object);
+  BgpConfiguratorDisableGracefulRestartResult *self = BGP_CONFIGURATOR_DISABLE_GRACEFUL_RESTART_RESULT (object);
 
   switch (property_id)
   {
-    case PROP_BGP_CONFIGURATOR_ENABLE_ADDRESS_FAMILY_RESULT_SUCCESS:
+    case PROP_BGP_CONFIGURATOR_DISABLE_GRACEFUL_RESTART_RESULT_SUCCESS:
       g_value_set_int (value, self->success);
       break;
 
@@ -7924,7 +11270,7 @@ bgp_configurator_enable_address_family_result_get_property (GObject *object,
 }
 
 static void 
-bgp_configurator_enable_address_family_result_instance_init (BgpConfiguratorEnableAddressFamilyResult * object)
+bgp_configurator_disable_graceful_restart_result_instance_init (BgpConfiguratorDisableGracefulRestartResult * object)
 {
   /* satisfy -Wall */
   THRIFT_UNUSED_VAR (object);
@@ -7933,30 +11279,30 @@ bgp_configurator_enable_address_family_result_instance_init (BgpConfiguratorEnab
 }
 
 static void 
-bgp_configurator_enable_address_family_result_finalize (GObject *object)
+bgp_configurator_disable_graceful_restart_result_finalize (GObject *object)
 {
-  BgpConfiguratorEnableAddressFamilyResult *tobject = BGP_CONFIGURATOR_ENABLE_ADDRESS_FAMILY_RESULT (object);
+  BgpConfiguratorDisableGracefulRestartResult *tobject = BGP_CONFIGURATOR_DISABLE_GRACEFUL_RESTART_RESULT (object);
 
   /* satisfy -Wall in case we don't use tobject */
   THRIFT_UNUSED_VAR (tobject);
 }
 
 static void
-bgp_configurator_enable_address_family_result_class_init (BgpConfiguratorEnableAddressFamilyResultClass * cls)
+bgp_configurator_disable_graceful_restart_result_class_init (BgpConfiguratorDisableGracefulRestartResultClass * cls)
 {
   GObjectClass *gobject_class = G_OBJECT_CLASS (cls);
   ThriftStructClass *struct_class = THRIFT_STRUCT_CLASS (cls);
 
-  struct_class->read = bgp_configurator_enable_address_family_result_read;
-  struct_class->write = bgp_configurator_enable_address_family_result_write;
+  struct_class->read = bgp_configurator_disable_graceful_restart_result_read;
+  struct_class->write = bgp_configurator_disable_graceful_restart_result_write;
 
-  gobject_class->finalize = bgp_configurator_enable_address_family_result_finalize;
-  gobject_class->get_property = bgp_configurator_enable_address_family_result_get_property;
-  gobject_class->set_property = bgp_configurator_enable_address_family_result_set_property;
+  gobject_class->finalize = bgp_configurator_disable_graceful_restart_result_finalize;
+  gobject_class->get_property = bgp_configurator_disable_graceful_restart_result_get_property;
+  gobject_class->set_property = bgp_configurator_disable_graceful_restart_result_set_property;
 
   g_object_class_install_property
     (gobject_class,
-     PROP_BGP_CONFIGURATOR_ENABLE_ADDRESS_FAMILY_RESULT_SUCCESS,
+     PROP_BGP_CONFIGURATOR_DISABLE_GRACEFUL_RESTART_RESULT_SUCCESS,
      g_param_spec_int ("success",
                        NULL,
                        NULL,
@@ -7967,7 +11313,7 @@ bgp_configurator_enable_address_family_result_class_init (BgpConfiguratorEnableA
 }
 
 GType
-bgp_configurator_enable_address_family_result_get_type (void)
+bgp_configurator_disable_graceful_restart_result_get_type (void)
 {
   static GType type = 0;
 
@@ -7975,37 +11321,36 @@ bgp_configurator_enable_address_family_result_get_type (void)
   {
     static const GTypeInfo type_info = 
     {
-      sizeof (BgpConfiguratorEnableAddressFamilyResultClass),
+      sizeof (BgpConfiguratorDisableGracefulRestartResultClass),
       NULL, /* base_init */
       NULL, /* base_finalize */
-      (GClassInitFunc) bgp_configurator_enable_address_family_result_class_init,
+      (GClassInitFunc) bgp_configurator_disable_graceful_restart_result_class_init,
       NULL, /* class_finalize */
       NULL, /* class_data */
-      sizeof (BgpConfiguratorEnableAddressFamilyResult),
+      sizeof (BgpConfiguratorDisableGracefulRestartResult),
       0, /* n_preallocs */
-      (GInstanceInitFunc) bgp_configurator_enable_address_family_result_instance_init,
+      (GInstanceInitFunc) bgp_configurator_disable_graceful_restart_result_instance_init,
       NULL, /* value_table */
     };
 
     type = g_type_register_static (THRIFT_TYPE_STRUCT, 
-                                   "BgpConfiguratorEnableAddressFamilyResultType",
+                                   "BgpConfiguratorDisableGracefulRestartResultType",
                                    &type_info, 0);
   }
 
   return type;
 }
 
-enum _BgpConfiguratorDisableAddressFamilyArgsProperties
+enum _BgpConfiguratorGetRoutesArgsProperties
 {
-  PROP_BGP_CONFIGURATOR_DISABLE_ADDRESS_FAMILY_ARGS_0,
-  PROP_BGP_CONFIGURATOR_DISABLE_ADDRESS_FAMILY_ARGS_PEER_IP,
-  PROP_BGP_CONFIGURATOR_DISABLE_ADDRESS_FAMILY_ARGS_AFI,
-  PROP_BGP_CONFIGURATOR_DISABLE_ADDRESS_FAMILY_ARGS_SAFI
+  PROP_BGP_CONFIGURATOR_GET_ROUTES_ARGS_0,
+  PROP_BGP_CONFIGURATOR_GET_ROUTES_ARGS_OPTYPE,
+  PROP_BGP_CONFIGURATOR_GET_ROUTES_ARGS_WIN_SIZE
 };
 
-/* reads a bgp_configurator_disable_address_family_args object */
+/* reads a bgp_configurator_get_routes_args object */
 static gint32
-bgp_configurator_disable_address_family_args_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+bgp_configurator_get_routes_args_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
 {
   gint32 ret;
   gint32 xfer = 0;
@@ -8014,7 +11359,7 @@ bgp_configurator_disable_address_family_args_read (ThriftStruct *object, ThriftP
   gint16 fid;
   guint32 len = 0;
   gpointer data = NULL;
-  BgpConfiguratorDisableAddressFamilyArgs * this_object = BGP_CONFIGURATOR_DISABLE_ADDRESS_FAMILY_ARGS(object);
+  BgpConfiguratorGetRoutesArgs * this_object = BGP_CONFIGURATOR_GET_ROUTES_ARGS(object);
 
   /* satisfy -Wall in case these aren't used */
   THRIFT_UNUSED_VAR (len);
@@ -8050,51 +11395,28 @@ bgp_configurator_disable_address_family_args_read (ThriftStruct *object, ThriftP
       break;
     }
 
-    switch (fid)
-    {
-      case 1:
-        if (ftype == T_STRING)
-        {
-          if (this_object->peerIp != NULL)
-          {
-            g_free(this_object->peerIp);
-            this_object->peerIp = NULL;
-          }
-
-          if ((ret = thrift_protocol_read_string (protocol, &this_object->peerIp, error)) < 0)
-            return -1;
-          xfer += ret;
-          this_object->__isset_peerIp = TRUE;
-        } else {
-          if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
-            return -1;
-          xfer += ret;
-        }
-        break;
-      case 2:
+    switch (fid)
+    {
+      case 1:
         if (ftype == T_I32)
         {
-          gint32 ecast8;
-          if ((ret = thrift_protocol_read_i32 (protocol, &ecast8, error)) < 0)
+          if ((ret = thrift_protocol_read_i32 (protocol, &this_object->optype, error)) < 0)
             return -1;
           xfer += ret;
-          this_object->afi = (af_afi)ecast8;
-          this_object->__isset_afi = TRUE;
+          this_object->__isset_optype = TRUE;
         } else {
           if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
             return -1;
           xfer += ret;
         }
         break;
-      case 3:
+      case 2:
         if (ftype == T_I32)
         {
-          gint32 ecast9;
-          if ((ret = thrift_protocol_read_i32 (protocol, &ecast9, error)) < 0)
+          if ((ret = thrift_protocol_read_i32 (protocol, &this_object->winSize, error)) < 0)
             return -1;
           xfer += ret;
-          this_object->safi = (af_safi)ecast9;
-          this_object->__isset_safi = TRUE;
+          this_object->__isset_winSize = TRUE;
         } else {
           if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
             return -1;
@@ -8120,40 +11442,30 @@ bgp_configurator_disable_address_family_args_read (ThriftStruct *object, ThriftP
 }
 
 static gint32
-bgp_configurator_disable_address_family_args_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+bgp_configurator_get_routes_args_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
 {
   gint32 ret;
   gint32 xfer = 0;
 
-  BgpConfiguratorDisableAddressFamilyArgs * this_object = BGP_CONFIGURATOR_DISABLE_ADDRESS_FAMILY_ARGS(object);
+  BgpConfiguratorGetRoutesArgs * this_object = BGP_CONFIGURATOR_GET_ROUTES_ARGS(object);
   THRIFT_UNUSED_VAR (this_object);
-  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorDisableAddressFamilyArgs", error)) < 0)
-    return -1;
-  xfer += ret;
-  if ((ret = thrift_protocol_write_field_begin (protocol, "peerIp", T_STRING, 1, error)) < 0)
-    return -1;
-  xfer += ret;
-  if ((ret = thrift_protocol_write_string (protocol, this_object->peerIp, error)) < 0)
-    return -1;
-  xfer += ret;
-
-  if ((ret = thrift_protocol_write_field_end (protocol, error)) < 0)
+  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorGetRoutesArgs", error)) < 0)
     return -1;
   xfer += ret;
-  if ((ret = thrift_protocol_write_field_begin (protocol, "afi", T_I32, 2, error)) < 0)
+  if ((ret = thrift_protocol_write_field_begin (protocol, "optype", T_I32, 1, error)) < 0)
     return -1;
   xfer += ret;
-  if ((ret = thrift_protocol_write_i32 (protocol, (gint32) this_object->afi, error)) < 0)
+  if ((ret = thrift_protocol_write_i32 (protocol, this_object->optype, error)) < 0)
     return -1;
   xfer += ret;
 
   if ((ret = thrift_protocol_write_field_end (protocol, error)) < 0)
     return -1;
   xfer += ret;
-  if ((ret = thrift_protocol_write_field_begin (protocol, "safi", T_I32, 3, error)) < 0)
+  if ((ret = thrift_protocol_write_field_begin (protocol, "winSize", T_I32, 2, error)) < 0)
     return -1;
   xfer += ret;
-  if ((ret = thrift_protocol_write_i32 (protocol, (gint32) this_object->safi, error)) < 0)
+  if ((ret = thrift_protocol_write_i32 (protocol, this_object->winSize, error)) < 0)
     return -1;
   xfer += ret;
 
@@ -8171,30 +11483,23 @@ bgp_configurator_disable_address_family_args_write (ThriftStruct *object, Thrift
 }
 
 static void
-bgp_configurator_disable_address_family_args_set_property (GObject *object,
-                                                           guint property_id,
-                                                           const GValue *value,
-                                                           GParamSpec *pspec)
+bgp_configurator_get_routes_args_set_property (GObject *object,
+                                               guint property_id,
+                                               const GValue *value,
+                                               GParamSpec *pspec)
 {
-  BgpConfiguratorDisableAddressFamilyArgs *self = BGP_CONFIGURATOR_DISABLE_ADDRESS_FAMILY_ARGS (object);
+  BgpConfiguratorGetRoutesArgs *self = BGP_CONFIGURATOR_GET_ROUTES_ARGS (object);
 
   switch (property_id)
   {
-    case PROP_BGP_CONFIGURATOR_DISABLE_ADDRESS_FAMILY_ARGS_PEER_IP:
-      if (self->peerIp != NULL)
-        g_free (self->peerIp);
-      self->peerIp = g_value_dup_string (value);
-      self->__isset_peerIp = TRUE;
-      break;
-
-    case PROP_BGP_CONFIGURATOR_DISABLE_ADDRESS_FAMILY_ARGS_AFI:
-      self->afi = g_value_get_int (value);
-      self->__isset_afi = TRUE;
+    case PROP_BGP_CONFIGURATOR_GET_ROUTES_ARGS_OPTYPE:
+      self->optype = g_value_get_int (value);
+      self->__isset_optype = TRUE;
       break;
 
-    case PROP_BGP_CONFIGURATOR_DISABLE_ADDRESS_FAMILY_ARGS_SAFI:
-      self->safi = g_value_get_int (value);
-      self->__isset_safi = TRUE;
+    case PROP_BGP_CONFIGURATOR_GET_ROUTES_ARGS_WIN_SIZE:
+      self->winSize = g_value_get_int (value);
+      self->__isset_winSize = TRUE;
       break;
 
     default:
@@ -8204,25 +11509,21 @@ bgp_configurator_disable_address_family_args_set_property (GObject *object,
 }
 
 static void
-bgp_configurator_disable_address_family_args_get_property (GObject *object,
-                                                           guint property_id,
-                                                           GValue *value,
-                                                           GParamSpec *pspec)
+bgp_configurator_get_routes_args_get_property (GObject *object,
+                                               guint property_id,
+                                               GValue *value,
+                                               GParamSpec *pspec)
 {
-  BgpConfiguratorDisableAddressFamilyArgs *self = BGP_CONFIGURATOR_DISABLE_ADDRESS_FAMILY_ARGS (object);
+  BgpConfiguratorGetRoutesArgs *self = BGP_CONFIGURATOR_GET_ROUTES_ARGS (object);
 
   switch (property_id)
   {
-    case PROP_BGP_CONFIGURATOR_DISABLE_ADDRESS_FAMILY_ARGS_PEER_IP:
-      g_value_set_string (value, self->peerIp);
-      break;
-
-    case PROP_BGP_CONFIGURATOR_DISABLE_ADDRESS_FAMILY_ARGS_AFI:
-      g_value_set_int (value, self->afi);
+    case PROP_BGP_CONFIGURATOR_GET_ROUTES_ARGS_OPTYPE:
+      g_value_set_int (value, self->optype);
       break;
 
-    case PROP_BGP_CONFIGURATOR_DISABLE_ADDRESS_FAMILY_ARGS_SAFI:
-      g_value_set_int (value, self->safi);
+    case PROP_BGP_CONFIGURATOR_GET_ROUTES_ARGS_WIN_SIZE:
+      g_value_set_int (value, self->winSize);
       break;
 
     default:
@@ -8232,77 +11533,63 @@ bgp_configurator_disable_address_family_args_get_property (GObject *object,
 }
 
 static void 
-bgp_configurator_disable_address_family_args_instance_init (BgpConfiguratorDisableAddressFamilyArgs * object)
+bgp_configurator_get_routes_args_instance_init (BgpConfiguratorGetRoutesArgs * object)
 {
   /* satisfy -Wall */
   THRIFT_UNUSED_VAR (object);
-  object->peerIp = NULL;
-  object->__isset_peerIp = FALSE;
-  object->__isset_afi = FALSE;
-  object->__isset_safi = FALSE;
+  object->optype = 0;
+  object->__isset_optype = FALSE;
+  object->winSize = 0;
+  object->__isset_winSize = FALSE;
 }
 
 static void 
-bgp_configurator_disable_address_family_args_finalize (GObject *object)
+bgp_configurator_get_routes_args_finalize (GObject *object)
 {
-  BgpConfiguratorDisableAddressFamilyArgs *tobject = BGP_CONFIGURATOR_DISABLE_ADDRESS_FAMILY_ARGS (object);
+  BgpConfiguratorGetRoutesArgs *tobject = BGP_CONFIGURATOR_GET_ROUTES_ARGS (object);
 
   /* satisfy -Wall in case we don't use tobject */
   THRIFT_UNUSED_VAR (tobject);
-  if (tobject->peerIp != NULL)
-  {
-    g_free(tobject->peerIp);
-    tobject->peerIp = NULL;
-  }
 }
 
 static void
-bgp_configurator_disable_address_family_args_class_init (BgpConfiguratorDisableAddressFamilyArgsClass * cls)
+bgp_configurator_get_routes_args_class_init (BgpConfiguratorGetRoutesArgsClass * cls)
 {
   GObjectClass *gobject_class = G_OBJECT_CLASS (cls);
   ThriftStructClass *struct_class = THRIFT_STRUCT_CLASS (cls);
 
-  struct_class->read = bgp_configurator_disable_address_family_args_read;
-  struct_class->write = bgp_configurator_disable_address_family_args_write;
-
-  gobject_class->finalize = bgp_configurator_disable_address_family_args_finalize;
-  gobject_class->get_property = bgp_configurator_disable_address_family_args_get_property;
-  gobject_class->set_property = bgp_configurator_disable_address_family_args_set_property;
+  struct_class->read = bgp_configurator_get_routes_args_read;
+  struct_class->write = bgp_configurator_get_routes_args_write;
 
-  g_object_class_install_property
-    (gobject_class,
-     PROP_BGP_CONFIGURATOR_DISABLE_ADDRESS_FAMILY_ARGS_PEER_IP,
-     g_param_spec_string ("peerIp",
-                          NULL,
-                          NULL,
-                          NULL,
-                          G_PARAM_READWRITE));
+  gobject_class->finalize = bgp_configurator_get_routes_args_finalize;
+  gobject_class->get_property = bgp_configurator_get_routes_args_get_property;
+  gobject_class->set_property = bgp_configurator_get_routes_args_set_property;
 
   g_object_class_install_property
     (gobject_class,
-     PROP_BGP_CONFIGURATOR_DISABLE_ADDRESS_FAMILY_ARGS_AFI,
-     g_param_spec_int ("afi",
+     PROP_BGP_CONFIGURATOR_GET_ROUTES_ARGS_OPTYPE,
+     g_param_spec_int ("optype",
                        NULL,
                        NULL,
-                       1,
-                       1,
-                       1,
+                       G_MININT32,
+                       G_MAXINT32,
+                       0,
                        G_PARAM_READWRITE));
 
   g_object_class_install_property
     (gobject_class,
-     PROP_BGP_CONFIGURATOR_DISABLE_ADDRESS_FAMILY_ARGS_SAFI,
-     g_param_spec_int ("safi",
+     PROP_BGP_CONFIGURATOR_GET_ROUTES_ARGS_WIN_SIZE,
+     g_param_spec_int ("winSize",
                        NULL,
                        NULL,
-                       4,
-                       5,
-                       4,
+                       G_MININT32,
+                       G_MAXINT32,
+                       0,
                        G_PARAM_READWRITE));
 }
 
 GType
-bgp_configurator_disable_address_family_args_get_type (void)
+bgp_configurator_get_routes_args_get_type (void)
 {
   static GType type = 0;
 
@@ -8310,35 +11597,35 @@ bgp_configurator_disable_address_family_args_get_type (void)
   {
     static const GTypeInfo type_info = 
     {
-      sizeof (BgpConfiguratorDisableAddressFamilyArgsClass),
+      sizeof (BgpConfiguratorGetRoutesArgsClass),
       NULL, /* base_init */
       NULL, /* base_finalize */
-      (GClassInitFunc) bgp_configurator_disable_address_family_args_class_init,
+      (GClassInitFunc) bgp_configurator_get_routes_args_class_init,
       NULL, /* class_finalize */
       NULL, /* class_data */
-      sizeof (BgpConfiguratorDisableAddressFamilyArgs),
+      sizeof (BgpConfiguratorGetRoutesArgs),
       0, /* n_preallocs */
-      (GInstanceInitFunc) bgp_configurator_disable_address_family_args_instance_init,
+      (GInstanceInitFunc) bgp_configurator_get_routes_args_instance_init,
       NULL, /* value_table */
     };
 
     type = g_type_register_static (THRIFT_TYPE_STRUCT, 
-                                   "BgpConfiguratorDisableAddressFamilyArgsType",
+                                   "BgpConfiguratorGetRoutesArgsType",
                                    &type_info, 0);
   }
 
   return type;
 }
 
-enum _BgpConfiguratorDisableAddressFamilyResultProperties
+enum _BgpConfiguratorGetRoutesResultProperties
 {
-  PROP_BGP_CONFIGURATOR_DISABLE_ADDRESS_FAMILY_RESULT_0,
-  PROP_BGP_CONFIGURATOR_DISABLE_ADDRESS_FAMILY_RESULT_SUCCESS
+  PROP_BGP_CONFIGURATOR_GET_ROUTES_RESULT_0,
+  PROP_BGP_CONFIGURATOR_GET_ROUTES_RESULT_SUCCESS
 };
 
-/* reads a bgp_configurator_disable_address_family_result object */
+/* reads a bgp_configurator_get_routes_result object */
 static gint32
-bgp_configurator_disable_address_family_result_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+bgp_configurator_get_routes_result_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
 {
   gint32 ret;
   gint32 xfer = 0;
@@ -8347,7 +11634,7 @@ bgp_configurator_disable_address_family_result_read (ThriftStruct *object, Thrif
   gint16 fid;
   guint32 len = 0;
   gpointer data = NULL;
-  BgpConfiguratorDisableAddressFamilyResult * this_object = BGP_CONFIGURATOR_DISABLE_ADDRESS_FAMILY_RESULT(object);
+  BgpConfiguratorGetRoutesResult * this_object = BGP_CONFIGURATOR_GET_ROUTES_RESULT(object);
 
   /* satisfy -Wall in case these aren't used */
   THRIFT_UNUSED_VAR (len);
@@ -8386,10 +11673,12 @@ bgp_configurator_disable_address_family_result_read (ThriftStruct *object, Thrif
     switch (fid)
     {
       case 0:
-        if (ftype == T_I32)
+        if (ftype == T_STRUCT)
         {
-          if ((ret = thrift_protocol_read_i32 (protocol, &this_object->success, error)) < 0)
+          if ((ret = thrift_struct_read (THRIFT_STRUCT (this_object->success), protocol, error)) < 0)
+          {
             return -1;
+          }
           xfer += ret;
           this_object->__isset_success = TRUE;
         } else {
@@ -8417,21 +11706,21 @@ bgp_configurator_disable_address_family_result_read (ThriftStruct *object, Thrif
 }
 
 static gint32
-bgp_configurator_disable_address_family_result_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+bgp_configurator_get_routes_result_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
 {
   gint32 ret;
   gint32 xfer = 0;
 
-  BgpConfiguratorDisableAddressFamilyResult * this_object = BGP_CONFIGURATOR_DISABLE_ADDRESS_FAMILY_RESULT(object);
+  BgpConfiguratorGetRoutesResult * this_object = BGP_CONFIGURATOR_GET_ROUTES_RESULT(object);
   THRIFT_UNUSED_VAR (this_object);
-  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorDisableAddressFamilyResult", error)) < 0)
+  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorGetRoutesResult", error)) < 0)
     return -1;
   xfer += ret;
   if (this_object->__isset_success == TRUE) {
-    if ((ret = thrift_protocol_write_field_begin (protocol, "success", T_I32, 0, error)) < 0)
+    if ((ret = thrift_protocol_write_field_begin (protocol, "success", T_STRUCT, 0, error)) < 0)
       return -1;
     xfer += ret;
-    if ((ret = thrift_protocol_write_i32 (protocol, this_object->success, error)) < 0)
+    if ((ret = thrift_struct_write (THRIFT_STRUCT (this_object->success), protocol, error)) < 0)
       return -1;
     xfer += ret;
 
@@ -8450,17 +11739,19 @@ bgp_configurator_disable_address_family_result_write (ThriftStruct *object, Thri
 }
 
 static void
-bgp_configurator_disable_address_family_result_set_property (GObject *object,
-                                                             guint property_id,
-                                                             const GValue *value,
-                                                             GParamSpec *pspec)
+bgp_configurator_get_routes_result_set_property (GObject *object,
+                                                 guint property_id,
+                                                 const GValue *value,
+                                                 GParamSpec *pspec)
 {
-  BgpConfiguratorDisableAddressFamilyResult *self = BGP_CONFIGURATOR_DISABLE_ADDRESS_FAMILY_RESULT (object);
+  BgpConfiguratorGetRoutesResult *self = BGP_CONFIGURATOR_GET_ROUTES_RESULT (object);
 
   switch (property_id)
   {
-    case PROP_BGP_CONFIGURATOR_DISABLE_ADDRESS_FAMILY_RESULT_SUCCESS:
-      self->success = g_value_get_int (value);
+    case PROP_BGP_CONFIGURATOR_GET_ROUTES_RESULT_SUCCESS:
+      if (self->success != NULL)
+        g_object_unref (self->success);
+      self->success = g_value_dup_object (value);
       self->__isset_success = TRUE;
       break;
 
@@ -8471,17 +11762,17 @@ bgp_configurator_disable_address_family_result_set_property (GObject *object,
 }
 
 static void
-bgp_configurator_disable_address_family_result_get_property (GObject *object,
-                                                             guint property_id,
-                                                             GValue *value,
-                                                             GParamSpec *pspec)
+bgp_configurator_get_routes_result_get_property (GObject *object,
+                                                 guint property_id,
+                                                 GValue *value,
+                                                 GParamSpec *pspec)
 {
-  BgpConfiguratorDisableAddressFamilyResult *self = BGP_CONFIGURATOR_DISABLE_ADDRESS_FAMILY_RESULT (object);
+  BgpConfiguratorGetRoutesResult *self = BGP_CONFIGURATOR_GET_ROUTES_RESULT (object);
 
   switch (property_id)
   {
-    case PROP_BGP_CONFIGURATOR_DISABLE_ADDRESS_FAMILY_RESULT_SUCCESS:
-      g_value_set_int (value, self->success);
+    case PROP_BGP_CONFIGURATOR_GET_ROUTES_RESULT_SUCCESS:
+      g_value_set_object (value, self->success);
       break;
 
     default:
@@ -8491,50 +11782,53 @@ bgp_configurator_disable_address_family_result_get_property (GObject *object,
 }
 
 static void 
-bgp_configurator_disable_address_family_result_instance_init (BgpConfiguratorDisableAddressFamilyResult * object)
+bgp_configurator_get_routes_result_instance_init (BgpConfiguratorGetRoutesResult * object)
 {
   /* satisfy -Wall */
   THRIFT_UNUSED_VAR (object);
-  object->success = 0;
+  object->success = g_object_new (TYPE_ROUTES, NULL);
   object->__isset_success = FALSE;
 }
 
 static void 
-bgp_configurator_disable_address_family_result_finalize (GObject *object)
+bgp_configurator_get_routes_result_finalize (GObject *object)
 {
-  BgpConfiguratorDisableAddressFamilyResult *tobject = BGP_CONFIGURATOR_DISABLE_ADDRESS_FAMILY_RESULT (object);
+  BgpConfiguratorGetRoutesResult *tobject = BGP_CONFIGURATOR_GET_ROUTES_RESULT (object);
 
   /* satisfy -Wall in case we don't use tobject */
   THRIFT_UNUSED_VAR (tobject);
+  if (tobject->success != NULL)
+  {
+    g_object_unref(tobject->success);
+    tobject->success = NULL;
+  }
 }
 
 static void
-bgp_configurator_disable_address_family_result_class_init (BgpConfiguratorDisableAddressFamilyResultClass * cls)
+bgp_configurator_get_routes_result_class_init (BgpConfiguratorGetRoutesResultClass * cls)
 {
   GObjectClass *gobject_class = G_OBJECT_CLASS (cls);
   ThriftStructClass *struct_class = THRIFT_STRUCT_CLASS (cls);
 
-  struct_class->read = bgp_configurator_disable_address_family_result_read;
-  struct_class->write = bgp_configurator_disable_address_family_result_write;
+  struct_class->read = bgp_configurator_get_routes_result_read;
+  struct_class->write = bgp_configurator_get_routes_result_write;
 
-  gobject_class->finalize = bgp_configurator_disable_address_family_result_finalize;
-  gobject_class->get_property = bgp_configurator_disable_address_family_result_get_property;
-  gobject_class->set_property = bgp_configurator_disable_address_family_result_set_property;
+  gobject_class->finalize = bgp_configurator_get_routes_result_finalize;
+  gobject_class->get_property = bgp_configurator_get_routes_result_get_property;
+  gobject_class->set_property = bgp_configurator_get_routes_result_set_property;
 
   g_object_class_install_property
-    (gobject_class,
-     PROP_BGP_CONFIGURATOR_DISABLE_ADDRESS_FAMILY_RESULT_SUCCESS,
-     g_param_spec_int ("success",
-                       NULL,
-                       NULL,
-                       G_MININT32,
-                       G_MAXINT32,
-                       0,
-                       G_PARAM_READWRITE));
+    (gobject_class,
+     PROP_BGP_CONFIGURATOR_GET_ROUTES_RESULT_SUCCESS,
+     g_param_spec_object ("success",
+                         NULL,
+                         NULL,
+                         TYPE_ROUTES,
+                         G_PARAM_READWRITE));
 }
 
 GType
-bgp_configurator_disable_address_family_result_get_type (void)
+bgp_configurator_get_routes_result_get_type (void)
 {
   static GType type = 0;
 
@@ -8542,36 +11836,36 @@ bgp_configurator_disable_address_family_result_get_type (void)
   {
     static const GTypeInfo type_info = 
     {
-      sizeof (BgpConfiguratorDisableAddressFamilyResultClass),
+      sizeof (BgpConfiguratorGetRoutesResultClass),
       NULL, /* base_init */
       NULL, /* base_finalize */
-      (GClassInitFunc) bgp_configurator_disable_address_family_result_class_init,
+      (GClassInitFunc) bgp_configurator_get_routes_result_class_init,
       NULL, /* class_finalize */
       NULL, /* class_data */
-      sizeof (BgpConfiguratorDisableAddressFamilyResult),
+      sizeof (BgpConfiguratorGetRoutesResult),
       0, /* n_preallocs */
-      (GInstanceInitFunc) bgp_configurator_disable_address_family_result_instance_init,
+      (GInstanceInitFunc) bgp_configurator_get_routes_result_instance_init,
       NULL, /* value_table */
     };
 
     type = g_type_register_static (THRIFT_TYPE_STRUCT, 
-                                   "BgpConfiguratorDisableAddressFamilyResultType",
+                                   "BgpConfiguratorGetRoutesResultType",
                                    &type_info, 0);
   }
 
   return type;
 }
 
-enum _BgpConfiguratorSetLogConfigArgsProperties
+enum _BgpConfiguratorEnableMultipathArgsProperties
 {
-  PROP_BGP_CONFIGURATOR_SET_LOG_CONFIG_ARGS_0,
-  PROP_BGP_CONFIGURATOR_SET_LOG_CONFIG_ARGS_LOG_FILE_NAME,
-  PROP_BGP_CONFIGURATOR_SET_LOG_CONFIG_ARGS_LOG_LEVEL
+  PROP_BGP_CONFIGURATOR_ENABLE_MULTIPATH_ARGS_0,
+  PROP_BGP_CONFIGURATOR_ENABLE_MULTIPATH_ARGS_AFI,
+  PROP_BGP_CONFIGURATOR_ENABLE_MULTIPATH_ARGS_SAFI
 };
 
-/* reads a bgp_configurator_set_log_config_args object */
+/* reads a bgp_configurator_enable_multipath_args object */
 static gint32
-bgp_configurator_set_log_config_args_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+bgp_configurator_enable_multipath_args_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
 {
   gint32 ret;
   gint32 xfer = 0;
@@ -8580,7 +11874,7 @@ bgp_configurator_set_log_config_args_read (ThriftStruct *object, ThriftProtocol
   gint16 fid;
   guint32 len = 0;
   gpointer data = NULL;
-  BgpConfiguratorSetLogConfigArgs * this_object = BGP_CONFIGURATOR_SET_LOG_CONFIG_ARGS(object);
+  BgpConfiguratorEnableMultipathArgs * this_object = BGP_CONFIGURATOR_ENABLE_MULTIPATH_ARGS(object);
 
   /* satisfy -Wall in case these aren't used */
   THRIFT_UNUSED_VAR (len);
@@ -8619,18 +11913,14 @@ bgp_configurator_set_log_config_args_read (ThriftStruct *object, ThriftProtocol
     switch (fid)
     {
       case 1:
-        if (ftype == T_STRING)
+        if (ftype == T_I32)
         {
-          if (this_object->logFileName != NULL)
-          {
-            g_free(this_object->logFileName);
-            this_object->logFileName = NULL;
-          }
-
-          if ((ret = thrift_protocol_read_string (protocol, &this_object->logFileName, error)) < 0)
+          gint32 ecast10;
+          if ((ret = thrift_protocol_read_i32 (protocol, &ecast10, error)) < 0)
             return -1;
           xfer += ret;
-          this_object->__isset_logFileName = TRUE;
+          this_object->afi = (af_afi)ecast10;
+          this_object->__isset_afi = TRUE;
         } else {
           if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
             return -1;
@@ -8638,18 +11928,14 @@ bgp_configurator_set_log_config_args_read (ThriftStruct *object, ThriftProtocol
         }
         break;
       case 2:
-        if (ftype == T_STRING)
+        if (ftype == T_I32)
         {
-          if (this_object->logLevel != NULL)
-          {
-            g_free(this_object->logLevel);
-            this_object->logLevel = NULL;
-          }
-
-          if ((ret = thrift_protocol_read_string (protocol, &this_object->logLevel, error)) < 0)
+          gint32 ecast11;
+          if ((ret = thrift_protocol_read_i32 (protocol, &ecast11, error)) < 0)
             return -1;
           xfer += ret;
-          this_object->__isset_logLevel = TRUE;
+          this_object->safi = (af_safi)ecast11;
+          this_object->__isset_safi = TRUE;
         } else {
           if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
             return -1;
@@ -8675,30 +11961,30 @@ bgp_configurator_set_log_config_args_read (ThriftStruct *object, ThriftProtocol
 }
 
 static gint32
-bgp_configurator_set_log_config_args_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+bgp_configurator_enable_multipath_args_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
 {
   gint32 ret;
   gint32 xfer = 0;
 
-  BgpConfiguratorSetLogConfigArgs * this_object = BGP_CONFIGURATOR_SET_LOG_CONFIG_ARGS(object);
+  BgpConfiguratorEnableMultipathArgs * this_object = BGP_CONFIGURATOR_ENABLE_MULTIPATH_ARGS(object);
   THRIFT_UNUSED_VAR (this_object);
-  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorSetLogConfigArgs", error)) < 0)
+  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorEnableMultipathArgs", error)) < 0)
     return -1;
   xfer += ret;
-  if ((ret = thrift_protocol_write_field_begin (protocol, "logFileName", T_STRING, 1, error)) < 0)
+  if ((ret = thrift_protocol_write_field_begin (protocol, "afi", T_I32, 1, error)) < 0)
     return -1;
   xfer += ret;
-  if ((ret = thrift_protocol_write_string (protocol, this_object->logFileName, error)) < 0)
+  if ((ret = thrift_protocol_write_i32 (protocol, (gint32) this_object->afi, error)) < 0)
     return -1;
   xfer += ret;
 
   if ((ret = thrift_protocol_write_field_end (protocol, error)) < 0)
     return -1;
   xfer += ret;
-  if ((ret = thrift_protocol_write_field_begin (protocol, "logLevel", T_STRING, 2, error)) < 0)
+  if ((ret = thrift_protocol_write_field_begin (protocol, "safi", T_I32, 2, error)) < 0)
     return -1;
   xfer += ret;
-  if ((ret = thrift_protocol_write_string (protocol, this_object->logLevel, error)) < 0)
+  if ((ret = thrift_protocol_write_i32 (protocol, (gint32) this_object->safi, error)) < 0)
     return -1;
   xfer += ret;
 
@@ -8716,27 +12002,23 @@ bgp_configurator_set_log_config_args_write (ThriftStruct *object, ThriftProtocol
 }
 
 static void
-bgp_configurator_set_log_config_args_set_property (GObject *object,
-                                                   guint property_id,
-                                                   const GValue *value,
-                                                   GParamSpec *pspec)
+bgp_configurator_enable_multipath_args_set_property (GObject *object,
+                                                     guint property_id,
+                                                     const GValue *value,
+                                                     GParamSpec *pspec)
 {
-  BgpConfiguratorSetLogConfigArgs *self = BGP_CONFIGURATOR_SET_LOG_CONFIG_ARGS (object);
+  BgpConfiguratorEnableMultipathArgs *self = BGP_CONFIGURATOR_ENABLE_MULTIPATH_ARGS (object);
 
   switch (property_id)
   {
-    case PROP_BGP_CONFIGURATOR_SET_LOG_CONFIG_ARGS_LOG_FILE_NAME:
-      if (self->logFileName != NULL)
-        g_free (self->logFileName);
-      self->logFileName = g_value_dup_string (value);
-      self->__isset_logFileName = TRUE;
+    case PROP_BGP_CONFIGURATOR_ENABLE_MULTIPATH_ARGS_AFI:
+      self->afi = g_value_get_int (value);
+      self->__isset_afi = TRUE;
       break;
 
-    case PROP_BGP_CONFIGURATOR_SET_LOG_CONFIG_ARGS_LOG_LEVEL:
-      if (self->logLevel != NULL)
-        g_free (self->logLevel);
-      self->logLevel = g_value_dup_string (value);
-      self->__isset_logLevel = TRUE;
+    case PROP_BGP_CONFIGURATOR_ENABLE_MULTIPATH_ARGS_SAFI:
+      self->safi = g_value_get_int (value);
+      self->__isset_safi = TRUE;
       break;
 
     default:
@@ -8746,21 +12028,21 @@ bgp_configurator_set_log_config_args_set_property (GObject *object,
 }
 
 static void
-bgp_configurator_set_log_config_args_get_property (GObject *object,
-                                                   guint property_id,
-                                                   GValue *value,
-                                                   GParamSpec *pspec)
+bgp_configurator_enable_multipath_args_get_property (GObject *object,
+                                                     guint property_id,
+                                                     GValue *value,
+                                                     GParamSpec *pspec)
 {
-  BgpConfiguratorSetLogConfigArgs *self = BGP_CONFIGURATOR_SET_LOG_CONFIG_ARGS (object);
+  BgpConfiguratorEnableMultipathArgs *self = BGP_CONFIGURATOR_ENABLE_MULTIPATH_ARGS (object);
 
   switch (property_id)
   {
-    case PROP_BGP_CONFIGURATOR_SET_LOG_CONFIG_ARGS_LOG_FILE_NAME:
-      g_value_set_string (value, self->logFileName);
+    case PROP_BGP_CONFIGURATOR_ENABLE_MULTIPATH_ARGS_AFI:
+      g_value_set_int (value, self->afi);
       break;
 
-    case PROP_BGP_CONFIGURATOR_SET_LOG_CONFIG_ARGS_LOG_LEVEL:
-      g_value_set_string (value, self->logLevel);
+    case PROP_BGP_CONFIGURATOR_ENABLE_MULTIPATH_ARGS_SAFI:
+      g_value_set_int (value, self->safi);
       break;
 
     default:
@@ -8770,69 +12052,61 @@ bgp_configurator_set_log_config_args_get_property (GObject *object,
 }
 
 static void 
-bgp_configurator_set_log_config_args_instance_init (BgpConfiguratorSetLogConfigArgs * object)
+bgp_configurator_enable_multipath_args_instance_init (BgpConfiguratorEnableMultipathArgs * object)
 {
   /* satisfy -Wall */
   THRIFT_UNUSED_VAR (object);
-  object->logFileName = NULL;
-  object->__isset_logFileName = FALSE;
-  object->logLevel = NULL;
-  object->__isset_logLevel = FALSE;
+  object->__isset_afi = FALSE;
+  object->__isset_safi = FALSE;
 }
 
 static void 
-bgp_configurator_set_log_config_args_finalize (GObject *object)
+bgp_configurator_enable_multipath_args_finalize (GObject *object)
 {
-  BgpConfiguratorSetLogConfigArgs *tobject = BGP_CONFIGURATOR_SET_LOG_CONFIG_ARGS (object);
+  BgpConfiguratorEnableMultipathArgs *tobject = BGP_CONFIGURATOR_ENABLE_MULTIPATH_ARGS (object);
 
   /* satisfy -Wall in case we don't use tobject */
   THRIFT_UNUSED_VAR (tobject);
-  if (tobject->logFileName != NULL)
-  {
-    g_free(tobject->logFileName);
-    tobject->logFileName = NULL;
-  }
-  if (tobject->logLevel != NULL)
-  {
-    g_free(tobject->logLevel);
-    tobject->logLevel = NULL;
-  }
 }
 
 static void
-bgp_configurator_set_log_config_args_class_init (BgpConfiguratorSetLogConfigArgsClass * cls)
+bgp_configurator_enable_multipath_args_class_init (BgpConfiguratorEnableMultipathArgsClass * cls)
 {
   GObjectClass *gobject_class = G_OBJECT_CLASS (cls);
   ThriftStructClass *struct_class = THRIFT_STRUCT_CLASS (cls);
 
-  struct_class->read = bgp_configurator_set_log_config_args_read;
-  struct_class->write = bgp_configurator_set_log_config_args_write;
+  struct_class->read = bgp_configurator_enable_multipath_args_read;
+  struct_class->write = bgp_configurator_enable_multipath_args_write;
 
-  gobject_class->finalize = bgp_configurator_set_log_config_args_finalize;
-  gobject_class->get_property = bgp_configurator_set_log_config_args_get_property;
-  gobject_class->set_property = bgp_configurator_set_log_config_args_set_property;
+  gobject_class->finalize = bgp_configurator_enable_multipath_args_finalize;
+  gobject_class->get_property = bgp_configurator_enable_multipath_args_get_property;
+  gobject_class->set_property = bgp_configurator_enable_multipath_args_set_property;
 
   g_object_class_install_property
     (gobject_class,
-     PROP_BGP_CONFIGURATOR_SET_LOG_CONFIG_ARGS_LOG_FILE_NAME,
-     g_param_spec_string ("logFileName",
-                          NULL,
-                          NULL,
-                          NULL,
-                          G_PARAM_READWRITE));
+     PROP_BGP_CONFIGURATOR_ENABLE_MULTIPATH_ARGS_AFI,
+     g_param_spec_int ("afi",
+                       NULL,
+                       NULL,
+                       1,
+                       1,
+                       1,
+                       G_PARAM_READWRITE));
 
   g_object_class_install_property
     (gobject_class,
-     PROP_BGP_CONFIGURATOR_SET_LOG_CONFIG_ARGS_LOG_LEVEL,
-     g_param_spec_string ("logLevel",
-                          NULL,
-                          NULL,
-                          NULL,
-                          G_PARAM_READWRITE));
+     PROP_BGP_CONFIGURATOR_ENABLE_MULTIPATH_ARGS_SAFI,
+     g_param_spec_int ("safi",
+                       NULL,
+                       NULL,
+                       4,
+                       5,
+                       4,
+                       G_PARAM_READWRITE));
 }
 
 GType
-bgp_configurator_set_log_config_args_get_type (void)
+bgp_configurator_enable_multipath_args_get_type (void)
 {
   static GType type = 0;
 
@@ -8840,35 +12114,35 @@ bgp_configurator_set_log_config_args_get_type (void)
   {
     static const GTypeInfo type_info = 
     {
-      sizeof (BgpConfiguratorSetLogConfigArgsClass),
+      sizeof (BgpConfiguratorEnableMultipathArgsClass),
       NULL, /* base_init */
       NULL, /* base_finalize */
-      (GClassInitFunc) bgp_configurator_set_log_config_args_class_init,
+      (GClassInitFunc) bgp_configurator_enable_multipath_args_class_init,
       NULL, /* class_finalize */
       NULL, /* class_data */
-      sizeof (BgpConfiguratorSetLogConfigArgs),
+      sizeof (BgpConfiguratorEnableMultipathArgs),
       0, /* n_preallocs */
-      (GInstanceInitFunc) bgp_configurator_set_log_config_args_instance_init,
+      (GInstanceInitFunc) bgp_configurator_enable_multipath_args_instance_init,
       NULL, /* value_table */
     };
 
     type = g_type_register_static (THRIFT_TYPE_STRUCT, 
-                                   "BgpConfiguratorSetLogConfigArgsType",
+                                   "BgpConfiguratorEnableMultipathArgsType",
                                    &type_info, 0);
   }
 
   return type;
 }
 
-enum _BgpConfiguratorSetLogConfigResultProperties
+enum _BgpConfiguratorEnableMultipathResultProperties
 {
-  PROP_BGP_CONFIGURATOR_SET_LOG_CONFIG_RESULT_0,
-  PROP_BGP_CONFIGURATOR_SET_LOG_CONFIG_RESULT_SUCCESS
+  PROP_BGP_CONFIGURATOR_ENABLE_MULTIPATH_RESULT_0,
+  PROP_BGP_CONFIGURATOR_ENABLE_MULTIPATH_RESULT_SUCCESS
 };
 
-/* reads a bgp_configurator_set_log_config_result object */
+/* reads a bgp_configurator_enable_multipath_result object */
 static gint32
-bgp_configurator_set_log_config_result_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+bgp_configurator_enable_multipath_result_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
 {
   gint32 ret;
   gint32 xfer = 0;
@@ -8877,7 +12151,7 @@ bgp_configurator_set_log_config_result_read (ThriftStruct *object, ThriftProtoco
   gint16 fid;
   guint32 len = 0;
   gpointer data = NULL;
-  BgpConfiguratorSetLogConfigResult * this_object = BGP_CONFIGURATOR_SET_LOG_CONFIG_RESULT(object);
+  BgpConfiguratorEnableMultipathResult * this_object = BGP_CONFIGURATOR_ENABLE_MULTIPATH_RESULT(object);
 
   /* satisfy -Wall in case these aren't used */
   THRIFT_UNUSED_VAR (len);
@@ -8947,14 +12221,14 @@ bgp_configurator_set_log_config_result_read (ThriftStruct *object, ThriftProtoco
 }
 
 static gint32
-bgp_configurator_set_log_config_result_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+bgp_configurator_enable_multipath_result_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
 {
   gint32 ret;
   gint32 xfer = 0;
 
-  BgpConfiguratorSetLogConfigResult * this_object = BGP_CONFIGURATOR_SET_LOG_CONFIG_RESULT(object);
+  BgpConfiguratorEnableMultipathResult * this_object = BGP_CONFIGURATOR_ENABLE_MULTIPATH_RESULT(object);
   THRIFT_UNUSED_VAR (this_object);
-  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorSetLogConfigResult", error)) < 0)
+  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorEnableMultipathResult", error)) < 0)
     return -1;
   xfer += ret;
   if (this_object->__isset_success == TRUE) {
@@ -8980,16 +12254,16 @@ bgp_configurator_set_log_config_result_write (ThriftStruct *object, ThriftProtoc
 }
 
 static void
-bgp_configurator_set_log_config_result_set_property (GObject *object,
-                                                     guint property_id,
-                                                     const GValue *value,
-                                                     GParamSpec *pspec)
+bgp_configurator_enable_multipath_result_set_property (GObject *object,
+                                                       guint property_id,
+                                                       const GValue *value,
+                                                       GParamSpec *pspec)
 {
-  BgpConfiguratorSetLogConfigResult *self = BGP_CONFIGURATOR_SET_LOG_CONFIG_RESULT (object);
+  BgpConfiguratorEnableMultipathResult *self = BGP_CONFIGURATOR_ENABLE_MULTIPATH_RESULT (object);
 
   switch (property_id)
   {
-    case PROP_BGP_CONFIGURATOR_SET_LOG_CONFIG_RESULT_SUCCESS:
+    case PROP_BGP_CONFIGURATOR_ENABLE_MULTIPATH_RESULT_SUCCESS:
       self->success = g_value_get_int (value);
       self->__isset_success = TRUE;
       break;
@@ -9001,16 +12275,16 @@ bgp_configurator_set_log_config_result_set_property (GObject *object,
 }
 
 static void
-bgp_configurator_set_log_config_result_get_property (GObject *object,
-                                                     guint property_id,
-                                                     GValue *value,
-                                                     GParamSpec *pspec)
+bgp_configurator_enable_multipath_result_get_property (GObject *object,
+                                                       guint property_id,
+                                                       GValue *value,
+                                                       GParamSpec *pspec)
 {
-  BgpConfiguratorSetLogConfigResult *self = BGP_CONFIGURATOR_SET_LOG_CONFIG_RESULT (object);
+  BgpConfiguratorEnableMultipathResult *self = BGP_CONFIGURATOR_ENABLE_MULTIPATH_RESULT (object);
 
   switch (property_id)
   {
-    case PROP_BGP_CONFIGURATOR_SET_LOG_CONFIG_RESULT_SUCCESS:
+    case PROP_BGP_CONFIGURATOR_ENABLE_MULTIPATH_RESULT_SUCCESS:
       g_value_set_int (value, self->success);
       break;
 
@@ -9021,7 +12295,7 @@ bgp_configurator_set_log_config_result_get_property (GObject *object,
 }
 
 static void 
-bgp_configurator_set_log_config_result_instance_init (BgpConfiguratorSetLogConfigResult * object)
+bgp_configurator_enable_multipath_result_instance_init (BgpConfiguratorEnableMultipathResult * object)
 {
   /* satisfy -Wall */
   THRIFT_UNUSED_VAR (object);
@@ -9030,30 +12304,30 @@ bgp_configurator_set_log_config_result_instance_init (BgpConfiguratorSetLogConfi
 }
 
 static void 
-bgp_configurator_set_log_config_result_finalize (GObject *object)
+bgp_configurator_enable_multipath_result_finalize (GObject *object)
 {
-  BgpConfiguratorSetLogConfigResult *tobject = BGP_CONFIGURATOR_SET_LOG_CONFIG_RESULT (object);
+  BgpConfiguratorEnableMultipathResult *tobject = BGP_CONFIGURATOR_ENABLE_MULTIPATH_RESULT (object);
 
   /* satisfy -Wall in case we don't use tobject */
   THRIFT_UNUSED_VAR (tobject);
 }
 
 static void
-bgp_configurator_set_log_config_result_class_init (BgpConfiguratorSetLogConfigResultClass * cls)
+bgp_configurator_enable_multipath_result_class_init (BgpConfiguratorEnableMultipathResultClass * cls)
 {
   GObjectClass *gobject_class = G_OBJECT_CLASS (cls);
   ThriftStructClass *struct_class = THRIFT_STRUCT_CLASS (cls);
 
-  struct_class->read = bgp_configurator_set_log_config_result_read;
-  struct_class->write = bgp_configurator_set_log_config_result_write;
+  struct_class->read = bgp_configurator_enable_multipath_result_read;
+  struct_class->write = bgp_configurator_enable_multipath_result_write;
 
-  gobject_class->finalize = bgp_configurator_set_log_config_result_finalize;
-  gobject_class->get_property = bgp_configurator_set_log_config_result_get_property;
-  gobject_class->set_property = bgp_configurator_set_log_config_result_set_property;
+  gobject_class->finalize = bgp_configurator_enable_multipath_result_finalize;
+  gobject_class->get_property = bgp_configurator_enable_multipath_result_get_property;
+  gobject_class->set_property = bgp_configurator_enable_multipath_result_set_property;
 
   g_object_class_install_property
     (gobject_class,
-     PROP_BGP_CONFIGURATOR_SET_LOG_CONFIG_RESULT_SUCCESS,
+     PROP_BGP_CONFIGURATOR_ENABLE_MULTIPATH_RESULT_SUCCESS,
      g_param_spec_int ("success",
                        NULL,
                        NULL,
@@ -9064,7 +12338,7 @@ bgp_configurator_set_log_config_result_class_init (BgpConfiguratorSetLogConfigRe
 }
 
 GType
-bgp_configurator_set_log_config_result_get_type (void)
+bgp_configurator_enable_multipath_result_get_type (void)
 {
   static GType type = 0;
 
@@ -9072,35 +12346,36 @@ bgp_configurator_set_log_config_result_get_type (void)
   {
     static const GTypeInfo type_info = 
     {
-      sizeof (BgpConfiguratorSetLogConfigResultClass),
+      sizeof (BgpConfiguratorEnableMultipathResultClass),
       NULL, /* base_init */
       NULL, /* base_finalize */
-      (GClassInitFunc) bgp_configurator_set_log_config_result_class_init,
+      (GClassInitFunc) bgp_configurator_enable_multipath_result_class_init,
       NULL, /* class_finalize */
       NULL, /* class_data */
-      sizeof (BgpConfiguratorSetLogConfigResult),
+      sizeof (BgpConfiguratorEnableMultipathResult),
       0, /* n_preallocs */
-      (GInstanceInitFunc) bgp_configurator_set_log_config_result_instance_init,
+      (GInstanceInitFunc) bgp_configurator_enable_multipath_result_instance_init,
       NULL, /* value_table */
     };
 
     type = g_type_register_static (THRIFT_TYPE_STRUCT, 
-                                   "BgpConfiguratorSetLogConfigResultType",
+                                   "BgpConfiguratorEnableMultipathResultType",
                                    &type_info, 0);
   }
 
   return type;
 }
 
-enum _BgpConfiguratorEnableGracefulRestartArgsProperties
+enum _BgpConfiguratorDisableMultipathArgsProperties
 {
-  PROP_BGP_CONFIGURATOR_ENABLE_GRACEFUL_RESTART_ARGS_0,
-  PROP_BGP_CONFIGURATOR_ENABLE_GRACEFUL_RESTART_ARGS_STALEPATH_TIME
+  PROP_BGP_CONFIGURATOR_DISABLE_MULTIPATH_ARGS_0,
+  PROP_BGP_CONFIGURATOR_DISABLE_MULTIPATH_ARGS_AFI,
+  PROP_BGP_CONFIGURATOR_DISABLE_MULTIPATH_ARGS_SAFI
 };
 
-/* reads a bgp_configurator_enable_graceful_restart_args object */
+/* reads a bgp_configurator_disable_multipath_args object */
 static gint32
-bgp_configurator_enable_graceful_restart_args_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+bgp_configurator_disable_multipath_args_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
 {
   gint32 ret;
   gint32 xfer = 0;
@@ -9109,7 +12384,7 @@ bgp_configurator_enable_graceful_restart_args_read (ThriftStruct *object, Thrift
   gint16 fid;
   guint32 len = 0;
   gpointer data = NULL;
-  BgpConfiguratorEnableGracefulRestartArgs * this_object = BGP_CONFIGURATOR_ENABLE_GRACEFUL_RESTART_ARGS(object);
+  BgpConfiguratorDisableMultipathArgs * this_object = BGP_CONFIGURATOR_DISABLE_MULTIPATH_ARGS(object);
 
   /* satisfy -Wall in case these aren't used */
   THRIFT_UNUSED_VAR (len);
@@ -9150,10 +12425,27 @@ bgp_configurator_enable_graceful_restart_args_read (ThriftStruct *object, Thrift
       case 1:
         if (ftype == T_I32)
         {
-          if ((ret = thrift_protocol_read_i32 (protocol, &this_object->stalepathTime, error)) < 0)
+          gint32 ecast12;
+          if ((ret = thrift_protocol_read_i32 (protocol, &ecast12, error)) < 0)
             return -1;
           xfer += ret;
-          this_object->__isset_stalepathTime = TRUE;
+          this_object->afi = (af_afi)ecast12;
+          this_object->__isset_afi = TRUE;
+        } else {
+          if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
+            return -1;
+          xfer += ret;
+        }
+        break;
+      case 2:
+        if (ftype == T_I32)
+        {
+          gint32 ecast13;
+          if ((ret = thrift_protocol_read_i32 (protocol, &ecast13, error)) < 0)
+            return -1;
+          xfer += ret;
+          this_object->safi = (af_safi)ecast13;
+          this_object->__isset_safi = TRUE;
         } else {
           if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
             return -1;
@@ -9179,20 +12471,30 @@ bgp_configurator_enable_graceful_restart_args_read (ThriftStruct *object, Thrift
 }
 
 static gint32
-bgp_configurator_enable_graceful_restart_args_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+bgp_configurator_disable_multipath_args_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
 {
   gint32 ret;
   gint32 xfer = 0;
 
-  BgpConfiguratorEnableGracefulRestartArgs * this_object = BGP_CONFIGURATOR_ENABLE_GRACEFUL_RESTART_ARGS(object);
+  BgpConfiguratorDisableMultipathArgs * this_object = BGP_CONFIGURATOR_DISABLE_MULTIPATH_ARGS(object);
   THRIFT_UNUSED_VAR (this_object);
-  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorEnableGracefulRestartArgs", error)) < 0)
+  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorDisableMultipathArgs", error)) < 0)
     return -1;
   xfer += ret;
-  if ((ret = thrift_protocol_write_field_begin (protocol, "stalepathTime", T_I32, 1, error)) < 0)
+  if ((ret = thrift_protocol_write_field_begin (protocol, "afi", T_I32, 1, error)) < 0)
     return -1;
   xfer += ret;
-  if ((ret = thrift_protocol_write_i32 (protocol, this_object->stalepathTime, error)) < 0)
+  if ((ret = thrift_protocol_write_i32 (protocol, (gint32) this_object->afi, error)) < 0)
+    return -1;
+  xfer += ret;
+
+  if ((ret = thrift_protocol_write_field_end (protocol, error)) < 0)
+    return -1;
+  xfer += ret;
+  if ((ret = thrift_protocol_write_field_begin (protocol, "safi", T_I32, 2, error)) < 0)
+    return -1;
+  xfer += ret;
+  if ((ret = thrift_protocol_write_i32 (protocol, (gint32) this_object->safi, error)) < 0)
     return -1;
   xfer += ret;
 
@@ -9210,18 +12512,23 @@ bgp_configurator_enable_graceful_restart_args_write (ThriftStruct *object, Thrif
 }
 
 static void
-bgp_configurator_enable_graceful_restart_args_set_property (GObject *object,
-                                                            guint property_id,
-                                                            const GValue *value,
-                                                            GParamSpec *pspec)
+bgp_configurator_disable_multipath_args_set_property (GObject *object,
+                                                      guint property_id,
+                                                      const GValue *value,
+                                                      GParamSpec *pspec)
 {
-  BgpConfiguratorEnableGracefulRestartArgs *self = BGP_CONFIGURATOR_ENABLE_GRACEFUL_RESTART_ARGS (object);
+  BgpConfiguratorDisableMultipathArgs *self = BGP_CONFIGURATOR_DISABLE_MULTIPATH_ARGS (object);
 
   switch (property_id)
   {
-    case PROP_BGP_CONFIGURATOR_ENABLE_GRACEFUL_RESTART_ARGS_STALEPATH_TIME:
-      self->stalepathTime = g_value_get_int (value);
-      self->__isset_stalepathTime = TRUE;
+    case PROP_BGP_CONFIGURATOR_DISABLE_MULTIPATH_ARGS_AFI:
+      self->afi = g_value_get_int (value);
+      self->__isset_afi = TRUE;
+      break;
+
+    case PROP_BGP_CONFIGURATOR_DISABLE_MULTIPATH_ARGS_SAFI:
+      self->safi = g_value_get_int (value);
+      self->__isset_safi = TRUE;
       break;
 
     default:
@@ -9231,17 +12538,21 @@ bgp_configurator_enable_graceful_restart_args_set_property (GObject *object,
 }
 
 static void
-bgp_configurator_enable_graceful_restart_args_get_property (GObject *object,
-                                                            guint property_id,
-                                                            GValue *value,
-                                                            GParamSpec *pspec)
+bgp_configurator_disable_multipath_args_get_property (GObject *object,
+                                                      guint property_id,
+                                                      GValue *value,
+                                                      GParamSpec *pspec)
 {
-  BgpConfiguratorEnableGracefulRestartArgs *self = BGP_CONFIGURATOR_ENABLE_GRACEFUL_RESTART_ARGS (object);
+  BgpConfiguratorDisableMultipathArgs *self = BGP_CONFIGURATOR_DISABLE_MULTIPATH_ARGS (object);
 
   switch (property_id)
   {
-    case PROP_BGP_CONFIGURATOR_ENABLE_GRACEFUL_RESTART_ARGS_STALEPATH_TIME:
-      g_value_set_int (value, self->stalepathTime);
+    case PROP_BGP_CONFIGURATOR_DISABLE_MULTIPATH_ARGS_AFI:
+      g_value_set_int (value, self->afi);
+      break;
+
+    case PROP_BGP_CONFIGURATOR_DISABLE_MULTIPATH_ARGS_SAFI:
+      g_value_set_int (value, self->safi);
       break;
 
     default:
@@ -9251,50 +12562,61 @@ bgp_configurator_enable_graceful_restart_args_get_property (GObject *object,
 }
 
 static void 
-bgp_configurator_enable_graceful_restart_args_instance_init (BgpConfiguratorEnableGracefulRestartArgs * object)
+bgp_configurator_disable_multipath_args_instance_init (BgpConfiguratorDisableMultipathArgs * object)
 {
   /* satisfy -Wall */
   THRIFT_UNUSED_VAR (object);
-  object->stalepathTime = 0;
-  object->__isset_stalepathTime = FALSE;
+  object->__isset_afi = FALSE;
+  object->__isset_safi = FALSE;
 }
 
 static void 
-bgp_configurator_enable_graceful_restart_args_finalize (GObject *object)
+bgp_configurator_disable_multipath_args_finalize (GObject *object)
 {
-  BgpConfiguratorEnableGracefulRestartArgs *tobject = BGP_CONFIGURATOR_ENABLE_GRACEFUL_RESTART_ARGS (object);
+  BgpConfiguratorDisableMultipathArgs *tobject = BGP_CONFIGURATOR_DISABLE_MULTIPATH_ARGS (object);
 
   /* satisfy -Wall in case we don't use tobject */
   THRIFT_UNUSED_VAR (tobject);
 }
 
 static void
-bgp_configurator_enable_graceful_restart_args_class_init (BgpConfiguratorEnableGracefulRestartArgsClass * cls)
+bgp_configurator_disable_multipath_args_class_init (BgpConfiguratorDisableMultipathArgsClass * cls)
 {
   GObjectClass *gobject_class = G_OBJECT_CLASS (cls);
   ThriftStructClass *struct_class = THRIFT_STRUCT_CLASS (cls);
 
-  struct_class->read = bgp_configurator_enable_graceful_restart_args_read;
-  struct_class->write = bgp_configurator_enable_graceful_restart_args_write;
+  struct_class->read = bgp_configurator_disable_multipath_args_read;
+  struct_class->write = bgp_configurator_disable_multipath_args_write;
 
-  gobject_class->finalize = bgp_configurator_enable_graceful_restart_args_finalize;
-  gobject_class->get_property = bgp_configurator_enable_graceful_restart_args_get_property;
-  gobject_class->set_property = bgp_configurator_enable_graceful_restart_args_set_property;
+  gobject_class->finalize = bgp_configurator_disable_multipath_args_finalize;
+  gobject_class->get_property = bgp_configurator_disable_multipath_args_get_property;
+  gobject_class->set_property = bgp_configurator_disable_multipath_args_set_property;
 
   g_object_class_install_property
     (gobject_class,
-     PROP_BGP_CONFIGURATOR_ENABLE_GRACEFUL_RESTART_ARGS_STALEPATH_TIME,
-     g_param_spec_int ("stalepathTime",
+     PROP_BGP_CONFIGURATOR_DISABLE_MULTIPATH_ARGS_AFI,
+     g_param_spec_int ("afi",
                        NULL,
                        NULL,
-                       G_MININT32,
-                       G_MAXINT32,
-                       0,
+                       1,
+                       1,
+                       1,
+                       G_PARAM_READWRITE));
+
+  g_object_class_install_property
+    (gobject_class,
+     PROP_BGP_CONFIGURATOR_DISABLE_MULTIPATH_ARGS_SAFI,
+     g_param_spec_int ("safi",
+                       NULL,
+                       NULL,
+                       4,
+                       5,
+                       4,
                        G_PARAM_READWRITE));
 }
 
 GType
-bgp_configurator_enable_graceful_restart_args_get_type (void)
+bgp_configurator_disable_multipath_args_get_type (void)
 {
   static GType type = 0;
 
@@ -9302,35 +12624,35 @@ bgp_configurator_enable_graceful_restart_args_get_type (void)
   {
     static const GTypeInfo type_info = 
     {
-      sizeof (BgpConfiguratorEnableGracefulRestartArgsClass),
+      sizeof (BgpConfiguratorDisableMultipathArgsClass),
       NULL, /* base_init */
       NULL, /* base_finalize */
-      (GClassInitFunc) bgp_configurator_enable_graceful_restart_args_class_init,
+      (GClassInitFunc) bgp_configurator_disable_multipath_args_class_init,
       NULL, /* class_finalize */
       NULL, /* class_data */
-      sizeof (BgpConfiguratorEnableGracefulRestartArgs),
+      sizeof (BgpConfiguratorDisableMultipathArgs),
       0, /* n_preallocs */
-      (GInstanceInitFunc) bgp_configurator_enable_graceful_restart_args_instance_init,
+      (GInstanceInitFunc) bgp_configurator_disable_multipath_args_instance_init,
       NULL, /* value_table */
     };
 
     type = g_type_register_static (THRIFT_TYPE_STRUCT, 
-                                   "BgpConfiguratorEnableGracefulRestartArgsType",
+                                   "BgpConfiguratorDisableMultipathArgsType",
                                    &type_info, 0);
   }
 
   return type;
 }
 
-enum _BgpConfiguratorEnableGracefulRestartResultProperties
+enum _BgpConfiguratorDisableMultipathResultProperties
 {
-  PROP_BGP_CONFIGURATOR_ENABLE_GRACEFUL_RESTART_RESULT_0,
-  PROP_BGP_CONFIGURATOR_ENABLE_GRACEFUL_RESTART_RESULT_SUCCESS
+  PROP_BGP_CONFIGURATOR_DISABLE_MULTIPATH_RESULT_0,
+  PROP_BGP_CONFIGURATOR_DISABLE_MULTIPATH_RESULT_SUCCESS
 };
 
-/* reads a bgp_configurator_enable_graceful_restart_result object */
+/* reads a bgp_configurator_disable_multipath_result object */
 static gint32
-bgp_configurator_enable_graceful_restart_result_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+bgp_configurator_disable_multipath_result_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
 {
   gint32 ret;
   gint32 xfer = 0;
@@ -9339,7 +12661,7 @@ bgp_configurator_enable_graceful_restart_result_read (ThriftStruct *object, Thri
   gint16 fid;
   guint32 len = 0;
   gpointer data = NULL;
-  BgpConfiguratorEnableGracefulRestartResult * this_object = BGP_CONFIGURATOR_ENABLE_GRACEFUL_RESTART_RESULT(object);
+  BgpConfiguratorDisableMultipathResult * this_object = BGP_CONFIGURATOR_DISABLE_MULTIPATH_RESULT(object);
 
   /* satisfy -Wall in case these aren't used */
   THRIFT_UNUSED_VAR (len);
@@ -9409,14 +12731,14 @@ bgp_configurator_enable_graceful_restart_result_read (ThriftStruct *object, Thri
 }
 
 static gint32
-bgp_configurator_enable_graceful_restart_result_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+bgp_configurator_disable_multipath_result_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
 {
   gint32 ret;
   gint32 xfer = 0;
 
-  BgpConfiguratorEnableGracefulRestartResult * this_object = BGP_CONFIGURATOR_ENABLE_GRACEFUL_RESTART_RESULT(object);
+  BgpConfiguratorDisableMultipathResult * this_object = BGP_CONFIGURATOR_DISABLE_MULTIPATH_RESULT(object);
   THRIFT_UNUSED_VAR (this_object);
-  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorEnableGracefulRestartResult", error)) < 0)
+  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorDisableMultipathResult", error)) < 0)
     return -1;
   xfer += ret;
   if (this_object->__isset_success == TRUE) {
@@ -9442,16 +12764,16 @@ bgp_configurator_enable_graceful_restart_result_write (ThriftStruct *object, Thr
 }
 
 static void
-bgp_configurator_enable_graceful_restart_result_set_property (GObject *object,
-                                                              guint property_id,
-                                                              const GValue *value,
-                                                              GParamSpec *pspec)
+bgp_configurator_disable_multipath_result_set_property (GObject *object,
+                                                        guint property_id,
+                                                        const GValue *value,
+                                                        GParamSpec *pspec)
 {
-  BgpConfiguratorEnableGracefulRestartResult *self = BGP_CONFIGURATOR_ENABLE_GRACEFUL_RESTART_RESULT (object);
+  BgpConfiguratorDisableMultipathResult *self = BGP_CONFIGURATOR_DISABLE_MULTIPATH_RESULT (object);
 
   switch (property_id)
   {
-    case PROP_BGP_CONFIGURATOR_ENABLE_GRACEFUL_RESTART_RESULT_SUCCESS:
+    case PROP_BGP_CONFIGURATOR_DISABLE_MULTIPATH_RESULT_SUCCESS:
       self->success = g_value_get_int (value);
       self->__isset_success = TRUE;
       break;
@@ -9463,16 +12785,16 @@ bgp_configurator_enable_graceful_restart_result_set_property (GObject *object,
 }
 
 static void
-bgp_configurator_enable_graceful_restart_result_get_property (GObject *object,
-                                                              guint property_id,
-                                                              GValue *value,
-                                                              GParamSpec *pspec)
+bgp_configurator_disable_multipath_result_get_property (GObject *object,
+                                                        guint property_id,
+                                                        GValue *value,
+                                                        GParamSpec *pspec)
 {
-  BgpConfiguratorEnableGracefulRestartResult *self = BGP_CONFIGURATOR_ENABLE_GRACEFUL_RESTART_RESULT (object);
+  BgpConfiguratorDisableMultipathResult *self = BGP_CONFIGURATOR_DISABLE_MULTIPATH_RESULT (object);
 
   switch (property_id)
   {
-    case PROP_BGP_CONFIGURATOR_ENABLE_GRACEFUL_RESTART_RESULT_SUCCESS:
+    case PROP_BGP_CONFIGURATOR_DISABLE_MULTIPATH_RESULT_SUCCESS:
       g_value_set_int (value, self->success);
       break;
 
@@ -9483,7 +12805,7 @@ bgp_configurator_enable_graceful_restart_result_get_property (GObject *object,
 }
 
 static void 
-bgp_configurator_enable_graceful_restart_result_instance_init (BgpConfiguratorEnableGracefulRestartResult * object)
+bgp_configurator_disable_multipath_result_instance_init (BgpConfiguratorDisableMultipathResult * object)
 {
   /* satisfy -Wall */
   THRIFT_UNUSED_VAR (object);
@@ -9492,30 +12814,30 @@ bgp_configurator_enable_graceful_restart_result_instance_init (BgpConfiguratorEn
 }
 
 static void 
-bgp_configurator_enable_graceful_restart_result_finalize (GObject *object)
+bgp_configurator_disable_multipath_result_finalize (GObject *object)
 {
-  BgpConfiguratorEnableGracefulRestartResult *tobject = BGP_CONFIGURATOR_ENABLE_GRACEFUL_RESTART_RESULT (object);
+  BgpConfiguratorDisableMultipathResult *tobject = BGP_CONFIGURATOR_DISABLE_MULTIPATH_RESULT (object);
 
   /* satisfy -Wall in case we don't use tobject */
   THRIFT_UNUSED_VAR (tobject);
 }
 
 static void
-bgp_configurator_enable_graceful_restart_result_class_init (BgpConfiguratorEnableGracefulRestartResultClass * cls)
+bgp_configurator_disable_multipath_result_class_init (BgpConfiguratorDisableMultipathResultClass * cls)
 {
   GObjectClass *gobject_class = G_OBJECT_CLASS (cls);
   ThriftStructClass *struct_class = THRIFT_STRUCT_CLASS (cls);
 
-  struct_class->read = bgp_configurator_enable_graceful_restart_result_read;
-  struct_class->write = bgp_configurator_enable_graceful_restart_result_write;
+  struct_class->read = bgp_configurator_disable_multipath_result_read;
+  struct_class->write = bgp_configurator_disable_multipath_result_write;
 
-  gobject_class->finalize = bgp_configurator_enable_graceful_restart_result_finalize;
-  gobject_class->get_property = bgp_configurator_enable_graceful_restart_result_get_property;
-  gobject_class->set_property = bgp_configurator_enable_graceful_restart_result_set_property;
+  gobject_class->finalize = bgp_configurator_disable_multipath_result_finalize;
+  gobject_class->get_property = bgp_configurator_disable_multipath_result_get_property;
+  gobject_class->set_property = bgp_configurator_disable_multipath_result_set_property;
 
   g_object_class_install_property
     (gobject_class,
-     PROP_BGP_CONFIGURATOR_ENABLE_GRACEFUL_RESTART_RESULT_SUCCESS,
+     PROP_BGP_CONFIGURATOR_DISABLE_MULTIPATH_RESULT_SUCCESS,
      g_param_spec_int ("success",
                        NULL,
                        NULL,
@@ -9526,7 +12848,7 @@ bgp_configurator_enable_graceful_restart_result_class_init (BgpConfiguratorEnabl
 }
 
 GType
-bgp_configurator_enable_graceful_restart_result_get_type (void)
+bgp_configurator_disable_multipath_result_get_type (void)
 {
   static GType type = 0;
 
@@ -9534,29 +12856,36 @@ bgp_configurator_enable_graceful_restart_result_get_type (void)
   {
     static const GTypeInfo type_info = 
     {
-      sizeof (BgpConfiguratorEnableGracefulRestartResultClass),
+      sizeof (BgpConfiguratorDisableMultipathResultClass),
       NULL, /* base_init */
       NULL, /* base_finalize */
-      (GClassInitFunc) bgp_configurator_enable_graceful_restart_result_class_init,
+      (GClassInitFunc) bgp_configurator_disable_multipath_result_class_init,
       NULL, /* class_finalize */
       NULL, /* class_data */
-      sizeof (BgpConfiguratorEnableGracefulRestartResult),
+      sizeof (BgpConfiguratorDisableMultipathResult),
       0, /* n_preallocs */
-      (GInstanceInitFunc) bgp_configurator_enable_graceful_restart_result_instance_init,
+      (GInstanceInitFunc) bgp_configurator_disable_multipath_result_instance_init,
       NULL, /* value_table */
     };
 
     type = g_type_register_static (THRIFT_TYPE_STRUCT, 
-                                   "BgpConfiguratorEnableGracefulRestartResultType",
+                                   "BgpConfiguratorDisableMultipathResultType",
                                    &type_info, 0);
   }
 
   return type;
 }
 
-/* reads a bgp_configurator_disable_graceful_restart_args object */
+enum _BgpConfiguratorMultipathsArgsProperties
+{
+  PROP_BGP_CONFIGURATOR_MULTIPATHS_ARGS_0,
+  PROP_BGP_CONFIGURATOR_MULTIPATHS_ARGS_RD,
+  PROP_BGP_CONFIGURATOR_MULTIPATHS_ARGS_MAX_PATH
+};
+
+/* reads a bgp_configurator_multipaths_args object */
 static gint32
-bgp_configurator_disable_graceful_restart_args_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+bgp_configurator_multipaths_args_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
 {
   gint32 ret;
   gint32 xfer = 0;
@@ -9565,7 +12894,7 @@ bgp_configurator_disable_graceful_restart_args_read (ThriftStruct *object, Thrif
   gint16 fid;
   guint32 len = 0;
   gpointer data = NULL;
-  BgpConfiguratorDisableGracefulRestartArgs * this_object = BGP_CONFIGURATOR_DISABLE_GRACEFUL_RESTART_ARGS(object);
+  BgpConfiguratorMultipathsArgs * this_object = BGP_CONFIGURATOR_MULTIPATHS_ARGS(object);
 
   /* satisfy -Wall in case these aren't used */
   THRIFT_UNUSED_VAR (len);
@@ -9601,8 +12930,40 @@ bgp_configurator_disable_graceful_restart_args_read (ThriftStruct *object, Thrif
       break;
     }
 
-    switch (fid)
-    {
+    switch (fid)
+    {
+      case 1:
+        if (ftype == T_STRING)
+        {
+          if (this_object->rd != NULL)
+          {
+            g_free(this_object->rd);
+            this_object->rd = NULL;
+          }
+
+          if ((ret = thrift_protocol_read_string (protocol, &this_object->rd, error)) < 0)
+            return -1;
+          xfer += ret;
+          this_object->__isset_rd = TRUE;
+        } else {
+          if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
+            return -1;
+          xfer += ret;
+        }
+        break;
+      case 2:
+        if (ftype == T_I32)
+        {
+          if ((ret = thrift_protocol_read_i32 (protocol, &this_object->maxPath, error)) < 0)
+            return -1;
+          xfer += ret;
+          this_object->__isset_maxPath = TRUE;
+        } else {
+          if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
+            return -1;
+          xfer += ret;
+        }
+        break;
       default:
         if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
           return -1;
@@ -9622,14 +12983,34 @@ bgp_configurator_disable_graceful_restart_args_read (ThriftStruct *object, Thrif
 }
 
 static gint32
-bgp_configurator_disable_graceful_restart_args_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+bgp_configurator_multipaths_args_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
 {
   gint32 ret;
   gint32 xfer = 0;
 
-  BgpConfiguratorDisableGracefulRestartArgs * this_object = BGP_CONFIGURATOR_DISABLE_GRACEFUL_RESTART_ARGS(object);
+  BgpConfiguratorMultipathsArgs * this_object = BGP_CONFIGURATOR_MULTIPATHS_ARGS(object);
   THRIFT_UNUSED_VAR (this_object);
-  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorDisableGracefulRestartArgs", error)) < 0)
+  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorMultipathsArgs", error)) < 0)
+    return -1;
+  xfer += ret;
+  if ((ret = thrift_protocol_write_field_begin (protocol, "rd", T_STRING, 1, error)) < 0)
+    return -1;
+  xfer += ret;
+  if ((ret = thrift_protocol_write_string (protocol, this_object->rd, error)) < 0)
+    return -1;
+  xfer += ret;
+
+  if ((ret = thrift_protocol_write_field_end (protocol, error)) < 0)
+    return -1;
+  xfer += ret;
+  if ((ret = thrift_protocol_write_field_begin (protocol, "maxPath", T_I32, 2, error)) < 0)
+    return -1;
+  xfer += ret;
+  if ((ret = thrift_protocol_write_i32 (protocol, this_object->maxPath, error)) < 0)
+    return -1;
+  xfer += ret;
+
+  if ((ret = thrift_protocol_write_field_end (protocol, error)) < 0)
     return -1;
   xfer += ret;
   if ((ret = thrift_protocol_write_field_stop (protocol, error)) < 0)
@@ -9642,36 +13023,119 @@ bgp_configurator_disable_graceful_restart_args_write (ThriftStruct *object, Thri
   return xfer;
 }
 
+static void
+bgp_configurator_multipaths_args_set_property (GObject *object,
+                                               guint property_id,
+                                               const GValue *value,
+                                               GParamSpec *pspec)
+{
+  BgpConfiguratorMultipathsArgs *self = BGP_CONFIGURATOR_MULTIPATHS_ARGS (object);
+
+  switch (property_id)
+  {
+    case PROP_BGP_CONFIGURATOR_MULTIPATHS_ARGS_RD:
+      if (self->rd != NULL)
+        g_free (self->rd);
+      self->rd = g_value_dup_string (value);
+      self->__isset_rd = TRUE;
+      break;
+
+    case PROP_BGP_CONFIGURATOR_MULTIPATHS_ARGS_MAX_PATH:
+      self->maxPath = g_value_get_int (value);
+      self->__isset_maxPath = TRUE;
+      break;
+
+    default:
+      G_OBJECT_WARN_INVALID_PROPERTY_ID (object, property_id, pspec);
+      break;
+  }
+}
+
+static void
+bgp_configurator_multipaths_args_get_property (GObject *object,
+                                               guint property_id,
+                                               GValue *value,
+                                               GParamSpec *pspec)
+{
+  BgpConfiguratorMultipathsArgs *self = BGP_CONFIGURATOR_MULTIPATHS_ARGS (object);
+
+  switch (property_id)
+  {
+    case PROP_BGP_CONFIGURATOR_MULTIPATHS_ARGS_RD:
+      g_value_set_string (value, self->rd);
+      break;
+
+    case PROP_BGP_CONFIGURATOR_MULTIPATHS_ARGS_MAX_PATH:
+      g_value_set_int (value, self->maxPath);
+      break;
+
+    default:
+      G_OBJECT_WARN_INVALID_PROPERTY_ID (object, property_id, pspec);
+      break;
+  }
+}
+
 static void 
-bgp_configurator_disable_graceful_restart_args_instance_init (BgpConfiguratorDisableGracefulRestartArgs * object)
+bgp_configurator_multipaths_args_instance_init (BgpConfiguratorMultipathsArgs * object)
 {
   /* satisfy -Wall */
   THRIFT_UNUSED_VAR (object);
+  object->rd = NULL;
+  object->__isset_rd = FALSE;
+  object->maxPath = 0;
+  object->__isset_maxPath = FALSE;
 }
 
 static void 
-bgp_configurator_disable_graceful_restart_args_finalize (GObject *object)
+bgp_configurator_multipaths_args_finalize (GObject *object)
 {
-  BgpConfiguratorDisableGracefulRestartArgs *tobject = BGP_CONFIGURATOR_DISABLE_GRACEFUL_RESTART_ARGS (object);
+  BgpConfiguratorMultipathsArgs *tobject = BGP_CONFIGURATOR_MULTIPATHS_ARGS (object);
 
   /* satisfy -Wall in case we don't use tobject */
   THRIFT_UNUSED_VAR (tobject);
+  if (tobject->rd != NULL)
+  {
+    g_free(tobject->rd);
+    tobject->rd = NULL;
+  }
 }
 
 static void
-bgp_configurator_disable_graceful_restart_args_class_init (BgpConfiguratorDisableGracefulRestartArgsClass * cls)
+bgp_configurator_multipaths_args_class_init (BgpConfiguratorMultipathsArgsClass * cls)
 {
   GObjectClass *gobject_class = G_OBJECT_CLASS (cls);
   ThriftStructClass *struct_class = THRIFT_STRUCT_CLASS (cls);
 
-  struct_class->read = bgp_configurator_disable_graceful_restart_args_read;
-  struct_class->write = bgp_configurator_disable_graceful_restart_args_write;
+  struct_class->read = bgp_configurator_multipaths_args_read;
+  struct_class->write = bgp_configurator_multipaths_args_write;
 
-  gobject_class->finalize = bgp_configurator_disable_graceful_restart_args_finalize;
+  gobject_class->finalize = bgp_configurator_multipaths_args_finalize;
+  gobject_class->get_property = bgp_configurator_multipaths_args_get_property;
+  gobject_class->set_property = bgp_configurator_multipaths_args_set_property;
+
+  g_object_class_install_property
+    (gobject_class,
+     PROP_BGP_CONFIGURATOR_MULTIPATHS_ARGS_RD,
+     g_param_spec_string ("rd",
+                          NULL,
+                          NULL,
+                          NULL,
+                          G_PARAM_READWRITE));
+
+  g_object_class_install_property
+    (gobject_class,
+     PROP_BGP_CONFIGURATOR_MULTIPATHS_ARGS_MAX_PATH,
+     g_param_spec_int ("maxPath",
+                       NULL,
+                       NULL,
+                       G_MININT32,
+                       G_MAXINT32,
+                       0,
+                       G_PARAM_READWRITE));
 }
 
 GType
-bgp_configurator_disable_graceful_restart_args_get_type (void)
+bgp_configurator_multipaths_args_get_type (void)
 {
   static GType type = 0;
 
@@ -9679,35 +13143,35 @@ bgp_configurator_disable_graceful_restart_args_get_type (void)
   {
     static const GTypeInfo type_info = 
     {
-      sizeof (BgpConfiguratorDisableGracefulRestartArgsClass),
+      sizeof (BgpConfiguratorMultipathsArgsClass),
       NULL, /* base_init */
       NULL, /* base_finalize */
-      (GClassInitFunc) bgp_configurator_disable_graceful_restart_args_class_init,
+      (GClassInitFunc) bgp_configurator_multipaths_args_class_init,
       NULL, /* class_finalize */
       NULL, /* class_data */
-      sizeof (BgpConfiguratorDisableGracefulRestartArgs),
+      sizeof (BgpConfiguratorMultipathsArgs),
       0, /* n_preallocs */
-      (GInstanceInitFunc) bgp_configurator_disable_graceful_restart_args_instance_init,
+      (GInstanceInitFunc) bgp_configurator_multipaths_args_instance_init,
       NULL, /* value_table */
     };
 
     type = g_type_register_static (THRIFT_TYPE_STRUCT, 
-                                   "BgpConfiguratorDisableGracefulRestartArgsType",
+                                   "BgpConfiguratorMultipathsArgsType",
                                    &type_info, 0);
   }
 
   return type;
 }
 
-enum _BgpConfiguratorDisableGracefulRestartResultProperties
+enum _BgpConfiguratorMultipathsResultProperties
 {
-  PROP_BGP_CONFIGURATOR_DISABLE_GRACEFUL_RESTART_RESULT_0,
-  PROP_BGP_CONFIGURATOR_DISABLE_GRACEFUL_RESTART_RESULT_SUCCESS
+  PROP_BGP_CONFIGURATOR_MULTIPATHS_RESULT_0,
+  PROP_BGP_CONFIGURATOR_MULTIPATHS_RESULT_SUCCESS
 };
 
-/* reads a bgp_configurator_disable_graceful_restart_result object */
+/* reads a bgp_configurator_multipaths_result object */
 static gint32
-bgp_configurator_disable_graceful_restart_result_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+bgp_configurator_multipaths_result_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
 {
   gint32 ret;
   gint32 xfer = 0;
@@ -9716,7 +13180,7 @@ bgp_configurator_disable_graceful_restart_result_read (ThriftStruct *object, Thr
   gint16 fid;
   guint32 len = 0;
   gpointer data = NULL;
-  BgpConfiguratorDisableGracefulRestartResult * this_object = BGP_CONFIGURATOR_DISABLE_GRACEFUL_RESTART_RESULT(object);
+  BgpConfiguratorMultipathsResult * this_object = BGP_CONFIGURATOR_MULTIPATHS_RESULT(object);
 
   /* satisfy -Wall in case these aren't used */
   THRIFT_UNUSED_VAR (len);
@@ -9786,14 +13250,14 @@ bgp_configurator_disable_graceful_restart_result_read (ThriftStruct *object, Thr
 }
 
 static gint32
-bgp_configurator_disable_graceful_restart_result_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+bgp_configurator_multipaths_result_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
 {
   gint32 ret;
   gint32 xfer = 0;
 
-  BgpConfiguratorDisableGracefulRestartResult * this_object = BGP_CONFIGURATOR_DISABLE_GRACEFUL_RESTART_RESULT(object);
+  BgpConfiguratorMultipathsResult * this_object = BGP_CONFIGURATOR_MULTIPATHS_RESULT(object);
   THRIFT_UNUSED_VAR (this_object);
-  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorDisableGracefulRestartResult", error)) < 0)
+  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorMultipathsResult", error)) < 0)
     return -1;
   xfer += ret;
   if (this_object->__isset_success == TRUE) {
@@ -9819,16 +13283,16 @@ bgp_configurator_disable_graceful_restart_result_write (ThriftStruct *object, Th
 }
 
 static void
-bgp_configurator_disable_graceful_restart_result_set_property (GObject *object,
-                                                               guint property_id,
-                                                               const GValue *value,
-                                                               GParamSpec *pspec)
+bgp_configurator_multipaths_result_set_property (GObject *object,
+                                                 guint property_id,
+                                                 const GValue *value,
+                                                 GParamSpec *pspec)
 {
-  BgpConfiguratorDisableGracefulRestartResult *self = BGP_CONFIGURATOR_DISABLE_GRACEFUL_RESTART_RESULT (object);
+  BgpConfiguratorMultipathsResult *self = BGP_CONFIGURATOR_MULTIPATHS_RESULT (object);
 
   switch (property_id)
   {
-    case PROP_BGP_CONFIGURATOR_DISABLE_GRACEFUL_RESTART_RESULT_SUCCESS:
+    case PROP_BGP_CONFIGURATOR_MULTIPATHS_RESULT_SUCCESS:
       self->success = g_value_get_int (value);
       self->__isset_success = TRUE;
       break;
@@ -9840,16 +13304,16 @@ bgp_configurator_disable_graceful_restart_result_set_property (GObject *object,
 }
 
 static void
-bgp_configurator_disable_graceful_restart_result_get_property (GObject *object,
-                                                               guint property_id,
-                                                               GValue *value,
-                                                               GParamSpec *pspec)
+bgp_configurator_multipaths_result_get_property (GObject *object,
+                                                 guint property_id,
+                                                 GValue *value,
+                                                 GParamSpec *pspec)
 {
-  BgpConfiguratorDisableGracefulRestartResult *self = BGP_CONFIGURATOR_DISABLE_GRACEFUL_RESTART_RESULT (object);
+  BgpConfiguratorMultipathsResult *self = BGP_CONFIGURATOR_MULTIPATHS_RESULT (object);
 
   switch (property_id)
   {
-    case PROP_BGP_CONFIGURATOR_DISABLE_GRACEFUL_RESTART_RESULT_SUCCESS:
+    case PROP_BGP_CONFIGURATOR_MULTIPATHS_RESULT_SUCCESS:
       g_value_set_int (value, self->success);
       break;
 
@@ -9860,7 +13324,7 @@ bgp_configurator_disable_graceful_restart_result_get_property (GObject *object,
 }
 
 static void 
-bgp_configurator_disable_graceful_restart_result_instance_init (BgpConfiguratorDisableGracefulRestartResult * object)
+bgp_configurator_multipaths_result_instance_init (BgpConfiguratorMultipathsResult * object)
 {
   /* satisfy -Wall */
   THRIFT_UNUSED_VAR (object);
@@ -9869,30 +13333,30 @@ bgp_configurator_disable_graceful_restart_result_instance_init (BgpConfiguratorD
 }
 
 static void 
-bgp_configurator_disable_graceful_restart_result_finalize (GObject *object)
+bgp_configurator_multipaths_result_finalize (GObject *object)
 {
-  BgpConfiguratorDisableGracefulRestartResult *tobject = BGP_CONFIGURATOR_DISABLE_GRACEFUL_RESTART_RESULT (object);
+  BgpConfiguratorMultipathsResult *tobject = BGP_CONFIGURATOR_MULTIPATHS_RESULT (object);
 
   /* satisfy -Wall in case we don't use tobject */
   THRIFT_UNUSED_VAR (tobject);
 }
 
 static void
-bgp_configurator_disable_graceful_restart_result_class_init (BgpConfiguratorDisableGracefulRestartResultClass * cls)
+bgp_configurator_multipaths_result_class_init (BgpConfiguratorMultipathsResultClass * cls)
 {
   GObjectClass *gobject_class = G_OBJECT_CLASS (cls);
   ThriftStructClass *struct_class = THRIFT_STRUCT_CLASS (cls);
 
-  struct_class->read = bgp_configurator_disable_graceful_restart_result_read;
-  struct_class->write = bgp_configurator_disable_graceful_restart_result_write;
+  struct_class->read = bgp_configurator_multipaths_result_read;
+  struct_class->write = bgp_configurator_multipaths_result_write;
 
-  gobject_class->finalize = bgp_configurator_disable_graceful_restart_result_finalize;
-  gobject_class->get_property = bgp_configurator_disable_graceful_restart_result_get_property;
-  gobject_class->set_property = bgp_configurator_disable_graceful_restart_result_set_property;
+  gobject_class->finalize = bgp_configurator_multipaths_result_finalize;
+  gobject_class->get_property = bgp_configurator_multipaths_result_get_property;
+  gobject_class->set_property = bgp_configurator_multipaths_result_set_property;
 
   g_object_class_install_property
     (gobject_class,
-     PROP_BGP_CONFIGURATOR_DISABLE_GRACEFUL_RESTART_RESULT_SUCCESS,
+     PROP_BGP_CONFIGURATOR_MULTIPATHS_RESULT_SUCCESS,
      g_param_spec_int ("success",
                        NULL,
                        NULL,
@@ -9903,7 +13367,7 @@ bgp_configurator_disable_graceful_restart_result_class_init (BgpConfiguratorDisa
 }
 
 GType
-bgp_configurator_disable_graceful_restart_result_get_type (void)
+bgp_configurator_multipaths_result_get_type (void)
 {
   static GType type = 0;
 
@@ -9911,36 +13375,35 @@ bgp_configurator_disable_graceful_restart_result_get_type (void)
   {
     static const GTypeInfo type_info = 
     {
-      sizeof (BgpConfiguratorDisableGracefulRestartResultClass),
+      sizeof (BgpConfiguratorMultipathsResultClass),
       NULL, /* base_init */
       NULL, /* base_finalize */
-      (GClassInitFunc) bgp_configurator_disable_graceful_restart_result_class_init,
+      (GClassInitFunc) bgp_configurator_multipaths_result_class_init,
       NULL, /* class_finalize */
       NULL, /* class_data */
-      sizeof (BgpConfiguratorDisableGracefulRestartResult),
+      sizeof (BgpConfiguratorMultipathsResult),
       0, /* n_preallocs */
-      (GInstanceInitFunc) bgp_configurator_disable_graceful_restart_result_instance_init,
+      (GInstanceInitFunc) bgp_configurator_multipaths_result_instance_init,
       NULL, /* value_table */
     };
 
     type = g_type_register_static (THRIFT_TYPE_STRUCT, 
-                                   "BgpConfiguratorDisableGracefulRestartResultType",
+                                   "BgpConfiguratorMultipathsResultType",
                                    &type_info, 0);
   }
 
   return type;
 }
 
-enum _BgpConfiguratorGetRoutesArgsProperties
+enum _BgpConfiguratorPushRoutesArgsProperties
 {
-  PROP_BGP_CONFIGURATOR_GET_ROUTES_ARGS_0,
-  PROP_BGP_CONFIGURATOR_GET_ROUTES_ARGS_OPTYPE,
-  PROP_BGP_CONFIGURATOR_GET_ROUTES_ARGS_WIN_SIZE
+  PROP_BGP_CONFIGURATOR_PUSH_ROUTES_ARGS_0,
+  PROP_BGP_CONFIGURATOR_PUSH_ROUTES_ARGS_ROUTES
 };
 
-/* reads a bgp_configurator_get_routes_args object */
+/* reads a bgp_configurator_push_routes_args object */
 static gint32
-bgp_configurator_get_routes_args_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+bgp_configurator_push_routes_args_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
 {
   gint32 ret;
   gint32 xfer = 0;
@@ -9949,7 +13412,7 @@ bgp_configurator_get_routes_args_read (ThriftStruct *object, ThriftProtocol *pro
   gint16 fid;
   guint32 len = 0;
   gpointer data = NULL;
-  BgpConfiguratorGetRoutesArgs * this_object = BGP_CONFIGURATOR_GET_ROUTES_ARGS(object);
+  BgpConfiguratorPushRoutesArgs * this_object = BGP_CONFIGURATOR_PUSH_ROUTES_ARGS(object);
 
   /* satisfy -Wall in case these aren't used */
   THRIFT_UNUSED_VAR (len);
@@ -9988,25 +13451,39 @@ bgp_configurator_get_routes_args_read (ThriftStruct *object, ThriftProtocol *pro
     switch (fid)
     {
       case 1:
-        if (ftype == T_I32)
-        {
-          if ((ret = thrift_protocol_read_i32 (protocol, &this_object->optype, error)) < 0)
-            return -1;
-          xfer += ret;
-          this_object->__isset_optype = TRUE;
-        } else {
-          if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
-            return -1;
-          xfer += ret;
-        }
-        break;
-      case 2:
-        if (ftype == T_I32)
+        if (ftype == T_LIST)
         {
-          if ((ret = thrift_protocol_read_i32 (protocol, &this_object->winSize, error)) < 0)
-            return -1;
-          xfer += ret;
-          this_object->__isset_winSize = TRUE;
+          {
+            guint32 size;
+            guint32 i;
+            ThriftType element_type;
+
+            if ((ret = thrift_protocol_read_list_begin (protocol, &element_type,&size, error)) < 0)
+              return -1;
+            xfer += ret;
+
+            /* iterate through list elements */
+            for (i = 0; i < size; i++)
+            {
+              Update * _elem17 = NULL;
+              if ( _elem17 != NULL)
+              {
+                g_object_unref (_elem17);
+              }
+              _elem17 = g_object_new (TYPE_UPDATE, NULL);
+              if ((ret = thrift_struct_read (THRIFT_STRUCT (_elem17), protocol, error)) < 0)
+              {
+                g_object_unref (_elem17);
+                return -1;
+              }
+              xfer += ret;
+              g_ptr_array_add (this_object->routes, _elem17);
+            }
+            if ((ret = thrift_protocol_read_list_end (protocol, error)) < 0)
+              return -1;
+            xfer += ret;
+          }
+          this_object->__isset_routes = TRUE;
         } else {
           if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
             return -1;
@@ -10032,33 +13509,36 @@ bgp_configurator_get_routes_args_read (ThriftStruct *object, ThriftProtocol *pro
 }
 
 static gint32
-bgp_configurator_get_routes_args_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+bgp_configurator_push_routes_args_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
 {
   gint32 ret;
   gint32 xfer = 0;
 
-  BgpConfiguratorGetRoutesArgs * this_object = BGP_CONFIGURATOR_GET_ROUTES_ARGS(object);
+  BgpConfiguratorPushRoutesArgs * this_object = BGP_CONFIGURATOR_PUSH_ROUTES_ARGS(object);
   THRIFT_UNUSED_VAR (this_object);
-  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorGetRoutesArgs", error)) < 0)
-    return -1;
-  xfer += ret;
-  if ((ret = thrift_protocol_write_field_begin (protocol, "optype", T_I32, 1, error)) < 0)
+  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorPushRoutesArgs", error)) < 0)
     return -1;
   xfer += ret;
-  if ((ret = thrift_protocol_write_i32 (protocol, this_object->optype, error)) < 0)
+  if ((ret = thrift_protocol_write_field_begin (protocol, "routes", T_LIST, 1, error)) < 0)
     return -1;
   xfer += ret;
+  {
+    guint i18;
 
-  if ((ret = thrift_protocol_write_field_end (protocol, error)) < 0)
-    return -1;
-  xfer += ret;
-  if ((ret = thrift_protocol_write_field_begin (protocol, "winSize", T_I32, 2, error)) < 0)
-    return -1;
-  xfer += ret;
-  if ((ret = thrift_protocol_write_i32 (protocol, this_object->winSize, error)) < 0)
-    return -1;
-  xfer += ret;
+    if ((ret = thrift_protocol_write_list_begin (protocol, T_STRUCT, (gint32) (this_object->routes ? this_object->routes->len : 0), error)) < 0)
+      return -1;
+    xfer += ret;
+    for (i18 = 0; i18 < (this_object->routes ? this_object->routes->len : 0); i18++)
+    {
+      if ((ret = thrift_struct_write (THRIFT_STRUCT ((g_ptr_array_index ((GPtrArray *) this_object->routes, i18))), protocol, error)) < 0)
+        return -1;
+      xfer += ret;
 
+    }
+    if ((ret = thrift_protocol_write_list_end (protocol, error)) < 0)
+      return -1;
+    xfer += ret;
+  }
   if ((ret = thrift_protocol_write_field_end (protocol, error)) < 0)
     return -1;
   xfer += ret;
@@ -10073,23 +13553,20 @@ bgp_configurator_get_routes_args_write (ThriftStruct *object, ThriftProtocol *pr
 }
 
 static void
-bgp_configurator_get_routes_args_set_property (GObject *object,
-                                               guint property_id,
-                                               const GValue *value,
-                                               GParamSpec *pspec)
+bgp_configurator_push_routes_args_set_property (GObject *object,
+                                                guint property_id,
+                                                const GValue *value,
+                                                GParamSpec *pspec)
 {
-  BgpConfiguratorGetRoutesArgs *self = BGP_CONFIGURATOR_GET_ROUTES_ARGS (object);
+  BgpConfiguratorPushRoutesArgs *self = BGP_CONFIGURATOR_PUSH_ROUTES_ARGS (object);
 
   switch (property_id)
   {
-    case PROP_BGP_CONFIGURATOR_GET_ROUTES_ARGS_OPTYPE:
-      self->optype = g_value_get_int (value);
-      self->__isset_optype = TRUE;
-      break;
-
-    case PROP_BGP_CONFIGURATOR_GET_ROUTES_ARGS_WIN_SIZE:
-      self->winSize = g_value_get_int (value);
-      self->__isset_winSize = TRUE;
+    case PROP_BGP_CONFIGURATOR_PUSH_ROUTES_ARGS_ROUTES:
+      if (self->routes != NULL)
+        g_ptr_array_unref (self->routes);
+      self->routes = g_value_dup_boxed (value);
+      self->__isset_routes = TRUE;
       break;
 
     default:
@@ -10099,21 +13576,17 @@ bgp_configurator_get_routes_args_set_property (GObject *object,
 }
 
 static void
-bgp_configurator_get_routes_args_get_property (GObject *object,
-                                               guint property_id,
-                                               GValue *value,
-                                               GParamSpec *pspec)
+bgp_configurator_push_routes_args_get_property (GObject *object,
+                                                guint property_id,
+                                                GValue *value,
+                                                GParamSpec *pspec)
 {
-  BgpConfiguratorGetRoutesArgs *self = BGP_CONFIGURATOR_GET_ROUTES_ARGS (object);
+  BgpConfiguratorPushRoutesArgs *self = BGP_CONFIGURATOR_PUSH_ROUTES_ARGS (object);
 
   switch (property_id)
   {
-    case PROP_BGP_CONFIGURATOR_GET_ROUTES_ARGS_OPTYPE:
-      g_value_set_int (value, self->optype);
-      break;
-
-    case PROP_BGP_CONFIGURATOR_GET_ROUTES_ARGS_WIN_SIZE:
-      g_value_set_int (value, self->winSize);
+    case PROP_BGP_CONFIGURATOR_PUSH_ROUTES_ARGS_ROUTES:
+      g_value_set_boxed (value, self->routes);
       break;
 
     default:
@@ -10123,63 +13596,53 @@ bgp_configurator_get_routes_args_get_property (GObject *object,
 }
 
 static void 
-bgp_configurator_get_routes_args_instance_init (BgpConfiguratorGetRoutesArgs * object)
+bgp_configurator_push_routes_args_instance_init (BgpConfiguratorPushRoutesArgs * object)
 {
   /* satisfy -Wall */
   THRIFT_UNUSED_VAR (object);
-  object->optype = 0;
-  object->__isset_optype = FALSE;
-  object->winSize = 0;
-  object->__isset_winSize = FALSE;
+  object->routes = g_ptr_array_new_with_free_func (g_object_unref);
+  object->__isset_routes = FALSE;
 }
 
 static void 
-bgp_configurator_get_routes_args_finalize (GObject *object)
+bgp_configurator_push_routes_args_finalize (GObject *object)
 {
-  BgpConfiguratorGetRoutesArgs *tobject = BGP_CONFIGURATOR_GET_ROUTES_ARGS (object);
+  BgpConfiguratorPushRoutesArgs *tobject = BGP_CONFIGURATOR_PUSH_ROUTES_ARGS (object);
 
   /* satisfy -Wall in case we don't use tobject */
   THRIFT_UNUSED_VAR (tobject);
+  if (tobject->routes != NULL)
+  {
+    g_ptr_array_unref (tobject->routes);
+    tobject->routes = NULL;
+  }
 }
 
 static void
-bgp_configurator_get_routes_args_class_init (BgpConfiguratorGetRoutesArgsClass * cls)
+bgp_configurator_push_routes_args_class_init (BgpConfiguratorPushRoutesArgsClass * cls)
 {
   GObjectClass *gobject_class = G_OBJECT_CLASS (cls);
   ThriftStructClass *struct_class = THRIFT_STRUCT_CLASS (cls);
 
-  struct_class->read = bgp_configurator_get_routes_args_read;
-  struct_class->write = bgp_configurator_get_routes_args_write;
-
-  gobject_class->finalize = bgp_configurator_get_routes_args_finalize;
-  gobject_class->get_property = bgp_configurator_get_routes_args_get_property;
-  gobject_class->set_property = bgp_configurator_get_routes_args_set_property;
+  struct_class->read = bgp_configurator_push_routes_args_read;
+  struct_class->write = bgp_configurator_push_routes_args_write;
 
-  g_object_class_install_property
-    (gobject_class,
-     PROP_BGP_CONFIGURATOR_GET_ROUTES_ARGS_OPTYPE,
-     g_param_spec_int ("optype",
-                       NULL,
-                       NULL,
-                       G_MININT32,
-                       G_MAXINT32,
-                       0,
-                       G_PARAM_READWRITE));
+  gobject_class->finalize = bgp_configurator_push_routes_args_finalize;
+  gobject_class->get_property = bgp_configurator_push_routes_args_get_property;
+  gobject_class->set_property = bgp_configurator_push_routes_args_set_property;
 
   g_object_class_install_property
     (gobject_class,
-     PROP_BGP_CONFIGURATOR_GET_ROUTES_ARGS_WIN_SIZE,
-     g_param_spec_int ("winSize",
-                       NULL,
-                       NULL,
-                       G_MININT32,
-                       G_MAXINT32,
-                       0,
-                       G_PARAM_READWRITE));
+     PROP_BGP_CONFIGURATOR_PUSH_ROUTES_ARGS_ROUTES,
+     g_param_spec_boxed ("routes",
+                         NULL,
+                         NULL,
+                         G_TYPE_PTR_ARRAY,
+                         G_PARAM_READWRITE));
 }
 
 GType
-bgp_configurator_get_routes_args_get_type (void)
+bgp_configurator_push_routes_args_get_type (void)
 {
   static GType type = 0;
 
@@ -10187,35 +13650,35 @@ bgp_configurator_get_routes_args_get_type (void)
   {
     static const GTypeInfo type_info = 
     {
-      sizeof (BgpConfiguratorGetRoutesArgsClass),
+      sizeof (BgpConfiguratorPushRoutesArgsClass),
       NULL, /* base_init */
       NULL, /* base_finalize */
-      (GClassInitFunc) bgp_configurator_get_routes_args_class_init,
+      (GClassInitFunc) bgp_configurator_push_routes_args_class_init,
       NULL, /* class_finalize */
       NULL, /* class_data */
-      sizeof (BgpConfiguratorGetRoutesArgs),
+      sizeof (BgpConfiguratorPushRoutesArgs),
       0, /* n_preallocs */
-      (GInstanceInitFunc) bgp_configurator_get_routes_args_instance_init,
+      (GInstanceInitFunc) bgp_configurator_push_routes_args_instance_init,
       NULL, /* value_table */
     };
 
     type = g_type_register_static (THRIFT_TYPE_STRUCT, 
-                                   "BgpConfiguratorGetRoutesArgsType",
+                                   "BgpConfiguratorPushRoutesArgsType",
                                    &type_info, 0);
   }
 
   return type;
 }
 
-enum _BgpConfiguratorGetRoutesResultProperties
+enum _BgpConfiguratorPushRoutesResultProperties
 {
-  PROP_BGP_CONFIGURATOR_GET_ROUTES_RESULT_0,
-  PROP_BGP_CONFIGURATOR_GET_ROUTES_RESULT_SUCCESS
+  PROP_BGP_CONFIGURATOR_PUSH_ROUTES_RESULT_0,
+  PROP_BGP_CONFIGURATOR_PUSH_ROUTES_RESULT_SUCCESS
 };
 
-/* reads a bgp_configurator_get_routes_result object */
+/* reads a bgp_configurator_push_routes_result object */
 static gint32
-bgp_configurator_get_routes_result_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+bgp_configurator_push_routes_result_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
 {
   gint32 ret;
   gint32 xfer = 0;
@@ -10224,7 +13687,7 @@ bgp_configurator_get_routes_result_read (ThriftStruct *object, ThriftProtocol *p
   gint16 fid;
   guint32 len = 0;
   gpointer data = NULL;
-  BgpConfiguratorGetRoutesResult * this_object = BGP_CONFIGURATOR_GET_ROUTES_RESULT(object);
+  BgpConfiguratorPushRoutesResult * this_object = BGP_CONFIGURATOR_PUSH_ROUTES_RESULT(object);
 
   /* satisfy -Wall in case these aren't used */
   THRIFT_UNUSED_VAR (len);
@@ -10263,13 +13726,30 @@ bgp_configurator_get_routes_result_read (ThriftStruct *object, ThriftProtocol *p
     switch (fid)
     {
       case 0:
-        if (ftype == T_STRUCT)
+        if (ftype == T_LIST)
         {
-          if ((ret = thrift_struct_read (THRIFT_STRUCT (this_object->success), protocol, error)) < 0)
           {
-            return -1;
+            guint32 size;
+            guint32 i;
+            ThriftType element_type;
+
+            if ((ret = thrift_protocol_read_list_begin (protocol, &element_type,&size, error)) < 0)
+              return -1;
+            xfer += ret;
+
+            /* iterate through list elements */
+            for (i = 0; i < size; i++)
+            {
+              gint32 _elem19 = 0;
+              if ((ret = thrift_protocol_read_i32 (protocol, &_elem19, error)) < 0)
+                return -1;
+              xfer += ret;
+              g_array_append_vals (this_object->success, &_elem19, 1);
+            }
+            if ((ret = thrift_protocol_read_list_end (protocol, error)) < 0)
+              return -1;
+            xfer += ret;
           }
-          xfer += ret;
           this_object->__isset_success = TRUE;
         } else {
           if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
@@ -10296,24 +13776,37 @@ bgp_configurator_get_routes_result_read (ThriftStruct *object, ThriftProtocol *p
 }
 
 static gint32
-bgp_configurator_get_routes_result_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+bgp_configurator_push_routes_result_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
 {
   gint32 ret;
   gint32 xfer = 0;
 
-  BgpConfiguratorGetRoutesResult * this_object = BGP_CONFIGURATOR_GET_ROUTES_RESULT(object);
+  BgpConfiguratorPushRoutesResult * this_object = BGP_CONFIGURATOR_PUSH_ROUTES_RESULT(object);
   THRIFT_UNUSED_VAR (this_object);
-  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorGetRoutesResult", error)) < 0)
+  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorPushRoutesResult", error)) < 0)
     return -1;
   xfer += ret;
   if (this_object->__isset_success == TRUE) {
-    if ((ret = thrift_protocol_write_field_begin (protocol, "success", T_STRUCT, 0, error)) < 0)
-      return -1;
-    xfer += ret;
-    if ((ret = thrift_struct_write (THRIFT_STRUCT (this_object->success), protocol, error)) < 0)
+    if ((ret = thrift_protocol_write_field_begin (protocol, "success", T_LIST, 0, error)) < 0)
       return -1;
     xfer += ret;
+    {
+      guint i20;
+
+      if ((ret = thrift_protocol_write_list_begin (protocol, T_I32, (gint32) (this_object->success ? this_object->success->len : 0), error)) < 0)
+        return -1;
+      xfer += ret;
+      for (i20 = 0; i20 < (this_object->success ? this_object->success->len : 0); i20++)
+      {
+        if ((ret = thrift_protocol_write_i32 (protocol, g_array_index (this_object->success, gint32, i20), error)) < 0)
+          return -1;
+        xfer += ret;
 
+      }
+      if ((ret = thrift_protocol_write_list_end (protocol, error)) < 0)
+        return -1;
+      xfer += ret;
+    }
     if ((ret = thrift_protocol_write_field_end (protocol, error)) < 0)
       return -1;
     xfer += ret;
@@ -10329,19 +13822,19 @@ bgp_configurator_get_routes_result_write (ThriftStruct *object, ThriftProtocol *
 }
 
 static void
-bgp_configurator_get_routes_result_set_property (GObject *object,
-                                                 guint property_id,
-                                                 const GValue *value,
-                                                 GParamSpec *pspec)
+bgp_configurator_push_routes_result_set_property (GObject *object,
+                                                  guint property_id,
+                                                  const GValue *value,
+                                                  GParamSpec *pspec)
 {
-  BgpConfiguratorGetRoutesResult *self = BGP_CONFIGURATOR_GET_ROUTES_RESULT (object);
+  BgpConfiguratorPushRoutesResult *self = BGP_CONFIGURATOR_PUSH_ROUTES_RESULT (object);
 
   switch (property_id)
   {
-    case PROP_BGP_CONFIGURATOR_GET_ROUTES_RESULT_SUCCESS:
+    case PROP_BGP_CONFIGURATOR_PUSH_ROUTES_RESULT_SUCCESS:
       if (self->success != NULL)
-        g_object_unref (self->success);
-      self->success = g_value_dup_object (value);
+        g_array_unref (self->success);
+      self->success = g_value_dup_boxed (value);
       self->__isset_success = TRUE;
       break;
 
@@ -10352,17 +13845,17 @@ bgp_configurator_get_routes_result_set_property (GObject *object,
 }
 
 static void
-bgp_configurator_get_routes_result_get_property (GObject *object,
-                                                 guint property_id,
-                                                 GValue *value,
-                                                 GParamSpec *pspec)
+bgp_configurator_push_routes_result_get_property (GObject *object,
+                                                  guint property_id,
+                                                  GValue *value,
+                                                  GParamSpec *pspec)
 {
-  BgpConfiguratorGetRoutesResult *self = BGP_CONFIGURATOR_GET_ROUTES_RESULT (object);
+  BgpConfiguratorPushRoutesResult *self = BGP_CONFIGURATOR_PUSH_ROUTES_RESULT (object);
 
   switch (property_id)
   {
-    case PROP_BGP_CONFIGURATOR_GET_ROUTES_RESULT_SUCCESS:
-      g_value_set_object (value, self->success);
+    case PROP_BGP_CONFIGURATOR_PUSH_ROUTES_RESULT_SUCCESS:
+      g_value_set_boxed (value, self->success);
       break;
 
     default:
@@ -10372,53 +13865,53 @@ bgp_configurator_get_routes_result_get_property (GObject *object,
 }
 
 static void 
-bgp_configurator_get_routes_result_instance_init (BgpConfiguratorGetRoutesResult * object)
+bgp_configurator_push_routes_result_instance_init (BgpConfiguratorPushRoutesResult * object)
 {
   /* satisfy -Wall */
   THRIFT_UNUSED_VAR (object);
-  object->success = g_object_new (TYPE_ROUTES, NULL);
+  object->success = g_array_new (0, 1, sizeof (gint32));
   object->__isset_success = FALSE;
 }
 
 static void 
-bgp_configurator_get_routes_result_finalize (GObject *object)
+bgp_configurator_push_routes_result_finalize (GObject *object)
 {
-  BgpConfiguratorGetRoutesResult *tobject = BGP_CONFIGURATOR_GET_ROUTES_RESULT (object);
+  BgpConfiguratorPushRoutesResult *tobject = BGP_CONFIGURATOR_PUSH_ROUTES_RESULT (object);
 
   /* satisfy -Wall in case we don't use tobject */
   THRIFT_UNUSED_VAR (tobject);
   if (tobject->success != NULL)
   {
-    g_object_unref(tobject->success);
+    g_array_unref (tobject->success);
     tobject->success = NULL;
   }
 }
 
 static void
-bgp_configurator_get_routes_result_class_init (BgpConfiguratorGetRoutesResultClass * cls)
+bgp_configurator_push_routes_result_class_init (BgpConfiguratorPushRoutesResultClass * cls)
 {
   GObjectClass *gobject_class = G_OBJECT_CLASS (cls);
   ThriftStructClass *struct_class = THRIFT_STRUCT_CLASS (cls);
 
-  struct_class->read = bgp_configurator_get_routes_result_read;
-  struct_class->write = bgp_configurator_get_routes_result_write;
+  struct_class->read = bgp_configurator_push_routes_result_read;
+  struct_class->write = bgp_configurator_push_routes_result_write;
 
-  gobject_class->finalize = bgp_configurator_get_routes_result_finalize;
-  gobject_class->get_property = bgp_configurator_get_routes_result_get_property;
-  gobject_class->set_property = bgp_configurator_get_routes_result_set_property;
+  gobject_class->finalize = bgp_configurator_push_routes_result_finalize;
+  gobject_class->get_property = bgp_configurator_push_routes_result_get_property;
+  gobject_class->set_property = bgp_configurator_push_routes_result_set_property;
 
   g_object_class_install_property
     (gobject_class,
-     PROP_BGP_CONFIGURATOR_GET_ROUTES_RESULT_SUCCESS,
-     g_param_spec_object ("success",
+     PROP_BGP_CONFIGURATOR_PUSH_ROUTES_RESULT_SUCCESS,
+     g_param_spec_boxed ("success",
                          NULL,
                          NULL,
-                         TYPE_ROUTES,
+                         G_TYPE_ARRAY,
                          G_PARAM_READWRITE));
 }
 
 GType
-bgp_configurator_get_routes_result_get_type (void)
+bgp_configurator_push_routes_result_get_type (void)
 {
   static GType type = 0;
 
@@ -10426,36 +13919,35 @@ bgp_configurator_get_routes_result_get_type (void)
   {
     static const GTypeInfo type_info = 
     {
-      sizeof (BgpConfiguratorGetRoutesResultClass),
+      sizeof (BgpConfiguratorPushRoutesResultClass),
       NULL, /* base_init */
       NULL, /* base_finalize */
-      (GClassInitFunc) bgp_configurator_get_routes_result_class_init,
+      (GClassInitFunc) bgp_configurator_push_routes_result_class_init,
       NULL, /* class_finalize */
       NULL, /* class_data */
-      sizeof (BgpConfiguratorGetRoutesResult),
+      sizeof (BgpConfiguratorPushRoutesResult),
       0, /* n_preallocs */
-      (GInstanceInitFunc) bgp_configurator_get_routes_result_instance_init,
+      (GInstanceInitFunc) bgp_configurator_push_routes_result_instance_init,
       NULL, /* value_table */
     };
 
     type = g_type_register_static (THRIFT_TYPE_STRUCT, 
-                                   "BgpConfiguratorGetRoutesResultType",
+                                   "BgpConfiguratorPushRoutesResultType",
                                    &type_info, 0);
   }
 
   return type;
 }
 
-enum _BgpConfiguratorEnableMultipathArgsProperties
+enum _BgpConfiguratorWithdrawRoutesArgsProperties
 {
-  PROP_BGP_CONFIGURATOR_ENABLE_MULTIPATH_ARGS_0,
-  PROP_BGP_CONFIGURATOR_ENABLE_MULTIPATH_ARGS_AFI,
-  PROP_BGP_CONFIGURATOR_ENABLE_MULTIPATH_ARGS_SAFI
+  PROP_BGP_CONFIGURATOR_WITHDRAW_ROUTES_ARGS_0,
+  PROP_BGP_CONFIGURATOR_WITHDRAW_ROUTES_ARGS_ROUTES
 };
 
-/* reads a bgp_configurator_enable_multipath_args object */
+/* reads a bgp_configurator_withdraw_routes_args object */
 static gint32
-bgp_configurator_enable_multipath_args_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+bgp_configurator_withdraw_routes_args_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
 {
   gint32 ret;
   gint32 xfer = 0;
@@ -10464,7 +13956,7 @@ bgp_configurator_enable_multipath_args_read (ThriftStruct *object, ThriftProtoco
   gint16 fid;
   guint32 len = 0;
   gpointer data = NULL;
-  BgpConfiguratorEnableMultipathArgs * this_object = BGP_CONFIGURATOR_ENABLE_MULTIPATH_ARGS(object);
+  BgpConfiguratorWithdrawRoutesArgs * this_object = BGP_CONFIGURATOR_WITHDRAW_ROUTES_ARGS(object);
 
   /* satisfy -Wall in case these aren't used */
   THRIFT_UNUSED_VAR (len);
@@ -10503,29 +13995,39 @@ bgp_configurator_enable_multipath_args_read (ThriftStruct *object, ThriftProtoco
     switch (fid)
     {
       case 1:
-        if (ftype == T_I32)
-        {
-          gint32 ecast10;
-          if ((ret = thrift_protocol_read_i32 (protocol, &ecast10, error)) < 0)
-            return -1;
-          xfer += ret;
-          this_object->afi = (af_afi)ecast10;
-          this_object->__isset_afi = TRUE;
-        } else {
-          if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
-            return -1;
-          xfer += ret;
-        }
-        break;
-      case 2:
-        if (ftype == T_I32)
+        if (ftype == T_LIST)
         {
-          gint32 ecast11;
-          if ((ret = thrift_protocol_read_i32 (protocol, &ecast11, error)) < 0)
-            return -1;
-          xfer += ret;
-          this_object->safi = (af_safi)ecast11;
-          this_object->__isset_safi = TRUE;
+          {
+            guint32 size;
+            guint32 i;
+            ThriftType element_type;
+
+            if ((ret = thrift_protocol_read_list_begin (protocol, &element_type,&size, error)) < 0)
+              return -1;
+            xfer += ret;
+
+            /* iterate through list elements */
+            for (i = 0; i < size; i++)
+            {
+              Update * _elem23 = NULL;
+              if ( _elem23 != NULL)
+              {
+                g_object_unref (_elem23);
+              }
+              _elem23 = g_object_new (TYPE_UPDATE, NULL);
+              if ((ret = thrift_struct_read (THRIFT_STRUCT (_elem23), protocol, error)) < 0)
+              {
+                g_object_unref (_elem23);
+                return -1;
+              }
+              xfer += ret;
+              g_ptr_array_add (this_object->routes, _elem23);
+            }
+            if ((ret = thrift_protocol_read_list_end (protocol, error)) < 0)
+              return -1;
+            xfer += ret;
+          }
+          this_object->__isset_routes = TRUE;
         } else {
           if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
             return -1;
@@ -10551,33 +14053,36 @@ bgp_configurator_enable_multipath_args_read (ThriftStruct *object, ThriftProtoco
 }
 
 static gint32
-bgp_configurator_enable_multipath_args_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+bgp_configurator_withdraw_routes_args_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
 {
   gint32 ret;
   gint32 xfer = 0;
 
-  BgpConfiguratorEnableMultipathArgs * this_object = BGP_CONFIGURATOR_ENABLE_MULTIPATH_ARGS(object);
+  BgpConfiguratorWithdrawRoutesArgs * this_object = BGP_CONFIGURATOR_WITHDRAW_ROUTES_ARGS(object);
   THRIFT_UNUSED_VAR (this_object);
-  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorEnableMultipathArgs", error)) < 0)
-    return -1;
-  xfer += ret;
-  if ((ret = thrift_protocol_write_field_begin (protocol, "afi", T_I32, 1, error)) < 0)
+  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorWithdrawRoutesArgs", error)) < 0)
     return -1;
   xfer += ret;
-  if ((ret = thrift_protocol_write_i32 (protocol, (gint32) this_object->afi, error)) < 0)
+  if ((ret = thrift_protocol_write_field_begin (protocol, "routes", T_LIST, 1, error)) < 0)
     return -1;
   xfer += ret;
+  {
+    guint i24;
 
-  if ((ret = thrift_protocol_write_field_end (protocol, error)) < 0)
-    return -1;
-  xfer += ret;
-  if ((ret = thrift_protocol_write_field_begin (protocol, "safi", T_I32, 2, error)) < 0)
-    return -1;
-  xfer += ret;
-  if ((ret = thrift_protocol_write_i32 (protocol, (gint32) this_object->safi, error)) < 0)
-    return -1;
-  xfer += ret;
+    if ((ret = thrift_protocol_write_list_begin (protocol, T_STRUCT, (gint32) (this_object->routes ? this_object->routes->len : 0), error)) < 0)
+      return -1;
+    xfer += ret;
+    for (i24 = 0; i24 < (this_object->routes ? this_object->routes->len : 0); i24++)
+    {
+      if ((ret = thrift_struct_write (THRIFT_STRUCT ((g_ptr_array_index ((GPtrArray *) this_object->routes, i24))), protocol, error)) < 0)
+        return -1;
+      xfer += ret;
 
+    }
+    if ((ret = thrift_protocol_write_list_end (protocol, error)) < 0)
+      return -1;
+    xfer += ret;
+  }
   if ((ret = thrift_protocol_write_field_end (protocol, error)) < 0)
     return -1;
   xfer += ret;
@@ -10592,23 +14097,20 @@ bgp_configurator_enable_multipath_args_write (ThriftStruct *object, ThriftProtoc
 }
 
 static void
-bgp_configurator_enable_multipath_args_set_property (GObject *object,
-                                                     guint property_id,
-                                                     const GValue *value,
-                                                     GParamSpec *pspec)
+bgp_configurator_withdraw_routes_args_set_property (GObject *object,
+                                                    guint property_id,
+                                                    const GValue *value,
+                                                    GParamSpec *pspec)
 {
-  BgpConfiguratorEnableMultipathArgs *self = BGP_CONFIGURATOR_ENABLE_MULTIPATH_ARGS (object);
+  BgpConfiguratorWithdrawRoutesArgs *self = BGP_CONFIGURATOR_WITHDRAW_ROUTES_ARGS (object);
 
   switch (property_id)
   {
-    case PROP_BGP_CONFIGURATOR_ENABLE_MULTIPATH_ARGS_AFI:
-      self->afi = g_value_get_int (value);
-      self->__isset_afi = TRUE;
-      break;
-
-    case PROP_BGP_CONFIGURATOR_ENABLE_MULTIPATH_ARGS_SAFI:
-      self->safi = g_value_get_int (value);
-      self->__isset_safi = TRUE;
+    case PROP_BGP_CONFIGURATOR_WITHDRAW_ROUTES_ARGS_ROUTES:
+      if (self->routes != NULL)
+        g_ptr_array_unref (self->routes);
+      self->routes = g_value_dup_boxed (value);
+      self->__isset_routes = TRUE;
       break;
 
     default:
@@ -10618,21 +14120,17 @@ bgp_configurator_enable_multipath_args_set_property (GObject *object,
 }
 
 static void
-bgp_configurator_enable_multipath_args_get_property (GObject *object,
-                                                     guint property_id,
-                                                     GValue *value,
-                                                     GParamSpec *pspec)
+bgp_configurator_withdraw_routes_args_get_property (GObject *object,
+                                                    guint property_id,
+                                                    GValue *value,
+                                                    GParamSpec *pspec)
 {
-  BgpConfiguratorEnableMultipathArgs *self = BGP_CONFIGURATOR_ENABLE_MULTIPATH_ARGS (object);
+  BgpConfiguratorWithdrawRoutesArgs *self = BGP_CONFIGURATOR_WITHDRAW_ROUTES_ARGS (object);
 
   switch (property_id)
   {
-    case PROP_BGP_CONFIGURATOR_ENABLE_MULTIPATH_ARGS_AFI:
-      g_value_set_int (value, self->afi);
-      break;
-
-    case PROP_BGP_CONFIGURATOR_ENABLE_MULTIPATH_ARGS_SAFI:
-      g_value_set_int (value, self->safi);
+    case PROP_BGP_CONFIGURATOR_WITHDRAW_ROUTES_ARGS_ROUTES:
+      g_value_set_boxed (value, self->routes);
       break;
 
     default:
@@ -10642,61 +14140,53 @@ bgp_configurator_enable_multipath_args_get_property (GObject *object,
 }
 
 static void 
-bgp_configurator_enable_multipath_args_instance_init (BgpConfiguratorEnableMultipathArgs * object)
+bgp_configurator_withdraw_routes_args_instance_init (BgpConfiguratorWithdrawRoutesArgs * object)
 {
   /* satisfy -Wall */
   THRIFT_UNUSED_VAR (object);
-  object->__isset_afi = FALSE;
-  object->__isset_safi = FALSE;
+  object->routes = g_ptr_array_new_with_free_func (g_object_unref);
+  object->__isset_routes = FALSE;
 }
 
 static void 
-bgp_configurator_enable_multipath_args_finalize (GObject *object)
+bgp_configurator_withdraw_routes_args_finalize (GObject *object)
 {
-  BgpConfiguratorEnableMultipathArgs *tobject = BGP_CONFIGURATOR_ENABLE_MULTIPATH_ARGS (object);
+  BgpConfiguratorWithdrawRoutesArgs *tobject = BGP_CONFIGURATOR_WITHDRAW_ROUTES_ARGS (object);
 
   /* satisfy -Wall in case we don't use tobject */
   THRIFT_UNUSED_VAR (tobject);
+  if (tobject->routes != NULL)
+  {
+    g_ptr_array_unref (tobject->routes);
+    tobject->routes = NULL;
+  }
 }
 
 static void
-bgp_configurator_enable_multipath_args_class_init (BgpConfiguratorEnableMultipathArgsClass * cls)
+bgp_configurator_withdraw_routes_args_class_init (BgpConfiguratorWithdrawRoutesArgsClass * cls)
 {
   GObjectClass *gobject_class = G_OBJECT_CLASS (cls);
   ThriftStructClass *struct_class = THRIFT_STRUCT_CLASS (cls);
 
-  struct_class->read = bgp_configurator_enable_multipath_args_read;
-  struct_class->write = bgp_configurator_enable_multipath_args_write;
-
-  gobject_class->finalize = bgp_configurator_enable_multipath_args_finalize;
-  gobject_class->get_property = bgp_configurator_enable_multipath_args_get_property;
-  gobject_class->set_property = bgp_configurator_enable_multipath_args_set_property;
+  struct_class->read = bgp_configurator_withdraw_routes_args_read;
+  struct_class->write = bgp_configurator_withdraw_routes_args_write;
 
-  g_object_class_install_property
-    (gobject_class,
-     PROP_BGP_CONFIGURATOR_ENABLE_MULTIPATH_ARGS_AFI,
-     g_param_spec_int ("afi",
-                       NULL,
-                       NULL,
-                       1,
-                       1,
-                       1,
-                       G_PARAM_READWRITE));
+  gobject_class->finalize = bgp_configurator_withdraw_routes_args_finalize;
+  gobject_class->get_property = bgp_configurator_withdraw_routes_args_get_property;
+  gobject_class->set_property = bgp_configurator_withdraw_routes_args_set_property;
 
   g_object_class_install_property
     (gobject_class,
-     PROP_BGP_CONFIGURATOR_ENABLE_MULTIPATH_ARGS_SAFI,
-     g_param_spec_int ("safi",
-                       NULL,
-                       NULL,
-                       4,
-                       5,
-                       4,
-                       G_PARAM_READWRITE));
+     PROP_BGP_CONFIGURATOR_WITHDRAW_ROUTES_ARGS_ROUTES,
+     g_param_spec_boxed ("routes",
+                         NULL,
+                         NULL,
+                         G_TYPE_PTR_ARRAY,
+                         G_PARAM_READWRITE));
 }
 
 GType
-bgp_configurator_enable_multipath_args_get_type (void)
+bgp_configurator_withdraw_routes_args_get_type (void)
 {
   static GType type = 0;
 
@@ -10704,35 +14194,35 @@ bgp_configurator_enable_multipath_args_get_type (void)
   {
     static const GTypeInfo type_info = 
     {
-      sizeof (BgpConfiguratorEnableMultipathArgsClass),
+      sizeof (BgpConfiguratorWithdrawRoutesArgsClass),
       NULL, /* base_init */
       NULL, /* base_finalize */
-      (GClassInitFunc) bgp_configurator_enable_multipath_args_class_init,
+      (GClassInitFunc) bgp_configurator_withdraw_routes_args_class_init,
       NULL, /* class_finalize */
       NULL, /* class_data */
-      sizeof (BgpConfiguratorEnableMultipathArgs),
+      sizeof (BgpConfiguratorWithdrawRoutesArgs),
       0, /* n_preallocs */
-      (GInstanceInitFunc) bgp_configurator_enable_multipath_args_instance_init,
+      (GInstanceInitFunc) bgp_configurator_withdraw_routes_args_instance_init,
       NULL, /* value_table */
     };
 
     type = g_type_register_static (THRIFT_TYPE_STRUCT, 
-                                   "BgpConfiguratorEnableMultipathArgsType",
+                                   "BgpConfiguratorWithdrawRoutesArgsType",
                                    &type_info, 0);
   }
 
   return type;
 }
 
-enum _BgpConfiguratorEnableMultipathResultProperties
+enum _BgpConfiguratorWithdrawRoutesResultProperties
 {
-  PROP_BGP_CONFIGURATOR_ENABLE_MULTIPATH_RESULT_0,
-  PROP_BGP_CONFIGURATOR_ENABLE_MULTIPATH_RESULT_SUCCESS
+  PROP_BGP_CONFIGURATOR_WITHDRAW_ROUTES_RESULT_0,
+  PROP_BGP_CONFIGURATOR_WITHDRAW_ROUTES_RESULT_SUCCESS
 };
 
-/* reads a bgp_configurator_enable_multipath_result object */
+/* reads a bgp_configurator_withdraw_routes_result object */
 static gint32
-bgp_configurator_enable_multipath_result_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+bgp_configurator_withdraw_routes_result_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
 {
   gint32 ret;
   gint32 xfer = 0;
@@ -10741,7 +14231,7 @@ bgp_configurator_enable_multipath_result_read (ThriftStruct *object, ThriftProto
   gint16 fid;
   guint32 len = 0;
   gpointer data = NULL;
-  BgpConfiguratorEnableMultipathResult * this_object = BGP_CONFIGURATOR_ENABLE_MULTIPATH_RESULT(object);
+  BgpConfiguratorWithdrawRoutesResult * this_object = BGP_CONFIGURATOR_WITHDRAW_ROUTES_RESULT(object);
 
   /* satisfy -Wall in case these aren't used */
   THRIFT_UNUSED_VAR (len);
@@ -10780,11 +14270,30 @@ bgp_configurator_enable_multipath_result_read (ThriftStruct *object, ThriftProto
     switch (fid)
     {
       case 0:
-        if (ftype == T_I32)
+        if (ftype == T_LIST)
         {
-          if ((ret = thrift_protocol_read_i32 (protocol, &this_object->success, error)) < 0)
-            return -1;
-          xfer += ret;
+          {
+            guint32 size;
+            guint32 i;
+            ThriftType element_type;
+
+            if ((ret = thrift_protocol_read_list_begin (protocol, &element_type,&size, error)) < 0)
+              return -1;
+            xfer += ret;
+
+            /* iterate through list elements */
+            for (i = 0; i < size; i++)
+            {
+              gint32 _elem25 = 0;
+              if ((ret = thrift_protocol_read_i32 (protocol, &_elem25, error)) < 0)
+                return -1;
+              xfer += ret;
+              g_array_append_vals (this_object->success, &_elem25, 1);
+            }
+            if ((ret = thrift_protocol_read_list_end (protocol, error)) < 0)
+              return -1;
+            xfer += ret;
+          }
           this_object->__isset_success = TRUE;
         } else {
           if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
@@ -10811,24 +14320,37 @@ bgp_configurator_enable_multipath_result_read (ThriftStruct *object, ThriftProto
 }
 
 static gint32
-bgp_configurator_enable_multipath_result_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+bgp_configurator_withdraw_routes_result_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
 {
   gint32 ret;
   gint32 xfer = 0;
 
-  BgpConfiguratorEnableMultipathResult * this_object = BGP_CONFIGURATOR_ENABLE_MULTIPATH_RESULT(object);
+  BgpConfiguratorWithdrawRoutesResult * this_object = BGP_CONFIGURATOR_WITHDRAW_ROUTES_RESULT(object);
   THRIFT_UNUSED_VAR (this_object);
-  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorEnableMultipathResult", error)) < 0)
+  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorWithdrawRoutesResult", error)) < 0)
     return -1;
   xfer += ret;
   if (this_object->__isset_success == TRUE) {
-    if ((ret = thrift_protocol_write_field_begin (protocol, "success", T_I32, 0, error)) < 0)
-      return -1;
-    xfer += ret;
-    if ((ret = thrift_protocol_write_i32 (protocol, this_object->success, error)) < 0)
+    if ((ret = thrift_protocol_write_field_begin (protocol, "success", T_LIST, 0, error)) < 0)
       return -1;
     xfer += ret;
+    {
+      guint i26;
+
+      if ((ret = thrift_protocol_write_list_begin (protocol, T_I32, (gint32) (this_object->success ? this_object->success->len : 0), error)) < 0)
+        return -1;
+      xfer += ret;
+      for (i26 = 0; i26 < (this_object->success ? this_object->success->len : 0); i26++)
+      {
+        if ((ret = thrift_protocol_write_i32 (protocol, g_array_index (this_object->success, gint32, i26), error)) < 0)
+          return -1;
+        xfer += ret;
 
+      }
+      if ((ret = thrift_protocol_write_list_end (protocol, error)) < 0)
+        return -1;
+      xfer += ret;
+    }
     if ((ret = thrift_protocol_write_field_end (protocol, error)) < 0)
       return -1;
     xfer += ret;
@@ -10844,17 +14366,19 @@ bgp_configurator_enable_multipath_result_write (ThriftStruct *object, ThriftProt
 }
 
 static void
-bgp_configurator_enable_multipath_result_set_property (GObject *object,
-                                                       guint property_id,
-                                                       const GValue *value,
-                                                       GParamSpec *pspec)
+bgp_configurator_withdraw_routes_result_set_property (GObject *object,
+                                                      guint property_id,
+                                                      const GValue *value,
+                                                      GParamSpec *pspec)
 {
-  BgpConfiguratorEnableMultipathResult *self = BGP_CONFIGURATOR_ENABLE_MULTIPATH_RESULT (object);
+  BgpConfiguratorWithdrawRoutesResult *self = BGP_CONFIGURATOR_WITHDRAW_ROUTES_RESULT (object);
 
   switch (property_id)
   {
-    case PROP_BGP_CONFIGURATOR_ENABLE_MULTIPATH_RESULT_SUCCESS:
-      self->success = g_value_get_int (value);
+    case PROP_BGP_CONFIGURATOR_WITHDRAW_ROUTES_RESULT_SUCCESS:
+      if (self->success != NULL)
+        g_array_unref (self->success);
+      self->success = g_value_dup_boxed (value);
       self->__isset_success = TRUE;
       break;
 
@@ -10865,17 +14389,17 @@ bgp_configurator_enable_multipath_result_set_property (GObject *object,
 }
 
 static void
-bgp_configurator_enable_multipath_result_get_property (GObject *object,
-                                                       guint property_id,
-                                                       GValue *value,
-                                                       GParamSpec *pspec)
+bgp_configurator_withdraw_routes_result_get_property (GObject *object,
+                                                      guint property_id,
+                                                      GValue *value,
+                                                      GParamSpec *pspec)
 {
-  BgpConfiguratorEnableMultipathResult *self = BGP_CONFIGURATOR_ENABLE_MULTIPATH_RESULT (object);
+  BgpConfiguratorWithdrawRoutesResult *self = BGP_CONFIGURATOR_WITHDRAW_ROUTES_RESULT (object);
 
   switch (property_id)
   {
-    case PROP_BGP_CONFIGURATOR_ENABLE_MULTIPATH_RESULT_SUCCESS:
-      g_value_set_int (value, self->success);
+    case PROP_BGP_CONFIGURATOR_WITHDRAW_ROUTES_RESULT_SUCCESS:
+      g_value_set_boxed (value, self->success);
       break;
 
     default:
@@ -10885,50 +14409,53 @@ bgp_configurator_enable_multipath_result_get_property (GObject *object,
 }
 
 static void 
-bgp_configurator_enable_multipath_result_instance_init (BgpConfiguratorEnableMultipathResult * object)
+bgp_configurator_withdraw_routes_result_instance_init (BgpConfiguratorWithdrawRoutesResult * object)
 {
   /* satisfy -Wall */
   THRIFT_UNUSED_VAR (object);
-  object->success = 0;
+  object->success = g_array_new (0, 1, sizeof (gint32));
   object->__isset_success = FALSE;
 }
 
 static void 
-bgp_configurator_enable_multipath_result_finalize (GObject *object)
+bgp_configurator_withdraw_routes_result_finalize (GObject *object)
 {
-  BgpConfiguratorEnableMultipathResult *tobject = BGP_CONFIGURATOR_ENABLE_MULTIPATH_RESULT (object);
+  BgpConfiguratorWithdrawRoutesResult *tobject = BGP_CONFIGURATOR_WITHDRAW_ROUTES_RESULT (object);
 
   /* satisfy -Wall in case we don't use tobject */
   THRIFT_UNUSED_VAR (tobject);
+  if (tobject->success != NULL)
+  {
+    g_array_unref (tobject->success);
+    tobject->success = NULL;
+  }
 }
 
 static void
-bgp_configurator_enable_multipath_result_class_init (BgpConfiguratorEnableMultipathResultClass * cls)
+bgp_configurator_withdraw_routes_result_class_init (BgpConfiguratorWithdrawRoutesResultClass * cls)
 {
   GObjectClass *gobject_class = G_OBJECT_CLASS (cls);
   ThriftStructClass *struct_class = THRIFT_STRUCT_CLASS (cls);
 
-  struct_class->read = bgp_configurator_enable_multipath_result_read;
-  struct_class->write = bgp_configurator_enable_multipath_result_write;
+  struct_class->read = bgp_configurator_withdraw_routes_result_read;
+  struct_class->write = bgp_configurator_withdraw_routes_result_write;
 
-  gobject_class->finalize = bgp_configurator_enable_multipath_result_finalize;
-  gobject_class->get_property = bgp_configurator_enable_multipath_result_get_property;
-  gobject_class->set_property = bgp_configurator_enable_multipath_result_set_property;
+  gobject_class->finalize = bgp_configurator_withdraw_routes_result_finalize;
+  gobject_class->get_property = bgp_configurator_withdraw_routes_result_get_property;
+  gobject_class->set_property = bgp_configurator_withdraw_routes_result_set_property;
 
   g_object_class_install_property
     (gobject_class,
-     PROP_BGP_CONFIGURATOR_ENABLE_MULTIPATH_RESULT_SUCCESS,
-     g_param_spec_int ("success",
-                       NULL,
-                       NULL,
-                       G_MININT32,
-                       G_MAXINT32,
-                       0,
-                       G_PARAM_READWRITE));
+     PROP_BGP_CONFIGURATOR_WITHDRAW_ROUTES_RESULT_SUCCESS,
+     g_param_spec_boxed ("success",
+                         NULL,
+                         NULL,
+                         G_TYPE_ARRAY,
+                         G_PARAM_READWRITE));
 }
 
 GType
-bgp_configurator_enable_multipath_result_get_type (void)
+bgp_configurator_withdraw_routes_result_get_type (void)
 {
   static GType type = 0;
 
@@ -10936,36 +14463,35 @@ bgp_configurator_enable_multipath_result_get_type (void)
   {
     static const GTypeInfo type_info = 
     {
-      sizeof (BgpConfiguratorEnableMultipathResultClass),
+      sizeof (BgpConfiguratorWithdrawRoutesResultClass),
       NULL, /* base_init */
       NULL, /* base_finalize */
-      (GClassInitFunc) bgp_configurator_enable_multipath_result_class_init,
+      (GClassInitFunc) bgp_configurator_withdraw_routes_result_class_init,
       NULL, /* class_finalize */
       NULL, /* class_data */
-      sizeof (BgpConfiguratorEnableMultipathResult),
+      sizeof (BgpConfiguratorWithdrawRoutesResult),
       0, /* n_preallocs */
-      (GInstanceInitFunc) bgp_configurator_enable_multipath_result_instance_init,
+      (GInstanceInitFunc) bgp_configurator_withdraw_routes_result_instance_init,
       NULL, /* value_table */
     };
 
     type = g_type_register_static (THRIFT_TYPE_STRUCT, 
-                                   "BgpConfiguratorEnableMultipathResultType",
+                                   "BgpConfiguratorWithdrawRoutesResultType",
                                    &type_info, 0);
   }
 
   return type;
 }
 
-enum _BgpConfiguratorDisableMultipathArgsProperties
+enum _BgpConfiguratorResumeNotificationsArgsProperties
 {
-  PROP_BGP_CONFIGURATOR_DISABLE_MULTIPATH_ARGS_0,
-  PROP_BGP_CONFIGURATOR_DISABLE_MULTIPATH_ARGS_AFI,
-  PROP_BGP_CONFIGURATOR_DISABLE_MULTIPATH_ARGS_SAFI
+  PROP_BGP_CONFIGURATOR_RESUME_NOTIFICATIONS_ARGS_0,
+  PROP_BGP_CONFIGURATOR_RESUME_NOTIFICATIONS_ARGS_FROM_SEQ
 };
 
-/* reads a bgp_configurator_disable_multipath_args object */
+/* reads a bgp_configurator_resume_notifications_args object */
 static gint32
-bgp_configurator_disable_multipath_args_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+bgp_configurator_resume_notifications_args_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
 {
   gint32 ret;
   gint32 xfer = 0;
@@ -10974,7 +14500,7 @@ bgp_configurator_disable_multipath_args_read (ThriftStruct *object, ThriftProtoc
   gint16 fid;
   guint32 len = 0;
   gpointer data = NULL;
-  BgpConfiguratorDisableMultipathArgs * this_object = BGP_CONFIGURATOR_DISABLE_MULTIPATH_ARGS(object);
+  BgpConfiguratorResumeNotificationsArgs * this_object = BGP_CONFIGURATOR_RESUME_NOTIFICATIONS_ARGS(object);
 
   /* satisfy -Wall in case these aren't used */
   THRIFT_UNUSED_VAR (len);
@@ -11013,29 +14539,12 @@ bgp_configurator_disable_multipath_args_read (ThriftStruct *object, ThriftProtoc
     switch (fid)
     {
       case 1:
-        if (ftype == T_I32)
-        {
-          gint32 ecast12;
-          if ((ret = thrift_protocol_read_i32 (protocol, &ecast12, error)) < 0)
-            return -1;
-          xfer += ret;
-          this_object->afi = (af_afi)ecast12;
-          this_object->__isset_afi = TRUE;
-        } else {
-          if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
-            return -1;
-          xfer += ret;
-        }
-        break;
-      case 2:
-        if (ftype == T_I32)
+        if (ftype == T_I64)
         {
-          gint32 ecast13;
-          if ((ret = thrift_protocol_read_i32 (protocol, &ecast13, error)) < 0)
+          if ((ret = thrift_protocol_read_i64 (protocol, &this_object->fromSeq, error)) < 0)
             return -1;
           xfer += ret;
-          this_object->safi = (af_safi)ecast13;
-          this_object->__isset_safi = TRUE;
+          this_object->__isset_fromSeq = TRUE;
         } else {
           if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
             return -1;
@@ -11061,30 +14570,20 @@ bgp_configurator_disable_multipath_args_read (ThriftStruct *object, ThriftProtoc
 }
 
 static gint32
-bgp_configurator_disable_multipath_args_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+bgp_configurator_resume_notifications_args_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
 {
   gint32 ret;
   gint32 xfer = 0;
 
-  BgpConfiguratorDisableMultipathArgs * this_object = BGP_CONFIGURATOR_DISABLE_MULTIPATH_ARGS(object);
-  THRIFT_UNUSED_VAR (this_object);
-  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorDisableMultipathArgs", error)) < 0)
-    return -1;
-  xfer += ret;
-  if ((ret = thrift_protocol_write_field_begin (protocol, "afi", T_I32, 1, error)) < 0)
-    return -1;
-  xfer += ret;
-  if ((ret = thrift_protocol_write_i32 (protocol, (gint32) this_object->afi, error)) < 0)
-    return -1;
-  xfer += ret;
-
-  if ((ret = thrift_protocol_write_field_end (protocol, error)) < 0)
+  BgpConfiguratorResumeNotificationsArgs * this_object = BGP_CONFIGURATOR_RESUME_NOTIFICATIONS_ARGS(object);
+  THRIFT_UNUSED_VAR (this_object);
+  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorResumeNotificationsArgs", error)) < 0)
     return -1;
   xfer += ret;
-  if ((ret = thrift_protocol_write_field_begin (protocol, "safi", T_I32, 2, error)) < 0)
+  if ((ret = thrift_protocol_write_field_begin (protocol, "fromSeq", T_I64, 1, error)) < 0)
     return -1;
   xfer += ret;
-  if ((ret = thrift_protocol_write_i32 (protocol, (gint32) this_object->safi, error)) < 0)
+  if ((ret = thrift_protocol_write_i64 (protocol, this_object->fromSeq, error)) < 0)
     return -1;
   xfer += ret;
 
@@ -11102,23 +14601,18 @@ bgp_configurator_disable_multipath_args_write (ThriftStruct *object, ThriftProto
 }
 
 static void
-bgp_configurator_disable_multipath_args_set_property (GObject *object,
-                                                      guint property_id,
-                                                      const GValue *value,
-                                                      GParamSpec *pspec)
+bgp_configurator_resume_notifications_args_set_property (GObject *object,
+                                                         guint property_id,
+                                                         const GValue *value,
+                                                         GParamSpec *pspec)
 {
-  BgpConfiguratorDisableMultipathArgs *self = BGP_CONFIGURATOR_DISABLE_MULTIPATH_ARGS (object);
+  BgpConfiguratorResumeNotificationsArgs *self = BGP_CONFIGURATOR_RESUME_NOTIFICATIONS_ARGS (object);
 
   switch (property_id)
   {
-    case PROP_BGP_CONFIGURATOR_DISABLE_MULTIPATH_ARGS_AFI:
-      self->afi = g_value_get_int (value);
-      self->__isset_afi = TRUE;
-      break;
-
-    case PROP_BGP_CONFIGURATOR_DISABLE_MULTIPATH_ARGS_SAFI:
-      self->safi = g_value_get_int (value);
-      self->__isset_safi = TRUE;
+    case PROP_BGP_CONFIGURATOR_RESUME_NOTIFICATIONS_ARGS_FROM_SEQ:
+      self->fromSeq = g_value_get_int64 (value);
+      self->__isset_fromSeq = TRUE;
       break;
 
     default:
@@ -11128,21 +14622,17 @@ bgp_configurator_disable_multipath_args_set_property (GObject *object,
 }
 
 static void
-bgp_configurator_disable_multipath_args_get_property (GObject *object,
-                                                      guint property_id,
-                                                      GValue *value,
-                                                      GParamSpec *pspec)
+bgp_configurator_resume_notifications_args_get_property (GObject *object,
+                                                         guint property_id,
+                                                         GValue *value,
+                                                         GParamSpec *pspec)
 {
-  BgpConfiguratorDisableMultipathArgs *self = BGP_CONFIGURATOR_DISABLE_MULTIPATH_ARGS (object);
+  BgpConfiguratorResumeNotificationsArgs *self = BGP_CONFIGURATOR_RESUME_NOTIFICATIONS_ARGS (object);
 
   switch (property_id)
   {
-    case PROP_BGP_CONFIGURATOR_DISABLE_MULTIPATH_ARGS_AFI:
-      g_value_set_int (value, self->afi);
-      break;
-
-    case PROP_BGP_CONFIGURATOR_DISABLE_MULTIPATH_ARGS_SAFI:
-      g_value_set_int (value, self->safi);
+    case PROP_BGP_CONFIGURATOR_RESUME_NOTIFICATIONS_ARGS_FROM_SEQ:
+      g_value_set_int64 (value, self->fromSeq);
       break;
 
     default:
@@ -11152,61 +14642,50 @@ bgp_configurator_disable_multipath_args_get_property (GObject *object,
 }
 
 static void 
-bgp_configurator_disable_multipath_args_instance_init (BgpConfiguratorDisableMultipathArgs * object)
+bgp_configurator_resume_notifications_args_instance_init (BgpConfiguratorResumeNotificationsArgs * object)
 {
   /* satisfy -Wall */
   THRIFT_UNUSED_VAR (object);
-  object->__isset_afi = FALSE;
-  object->__isset_safi = FALSE;
+  object->fromSeq = 0;
+  object->__isset_fromSeq = FALSE;
 }
 
 static void 
-bgp_configurator_disable_multipath_args_finalize (GObject *object)
+bgp_configurator_resume_notifications_args_finalize (GObject *object)
 {
-  BgpConfiguratorDisableMultipathArgs *tobject = BGP_CONFIGURATOR_DISABLE_MULTIPATH_ARGS (object);
+  BgpConfiguratorResumeNotificationsArgs *tobject = BGP_CONFIGURATOR_RESUME_NOTIFICATIONS_ARGS (object);
 
   /* satisfy -Wall in case we don't use tobject */
   THRIFT_UNUSED_VAR (tobject);
 }
 
 static void
-bgp_configurator_disable_multipath_args_class_init (BgpConfiguratorDisableMultipathArgsClass * cls)
+bgp_configurator_resume_notifications_args_class_init (BgpConfiguratorResumeNotificationsArgsClass * cls)
 {
   GObjectClass *gobject_class = G_OBJECT_CLASS (cls);
   ThriftStructClass *struct_class = THRIFT_STRUCT_CLASS (cls);
 
-  struct_class->read = bgp_configurator_disable_multipath_args_read;
-  struct_class->write = bgp_configurator_disable_multipath_args_write;
-
-  gobject_class->finalize = bgp_configurator_disable_multipath_args_finalize;
-  gobject_class->get_property = bgp_configurator_disable_multipath_args_get_property;
-  gobject_class->set_property = bgp_configurator_disable_multipath_args_set_property;
+  struct_class->read = bgp_configurator_resume_notifications_args_read;
+  struct_class->write = bgp_configurator_resume_notifications_args_write;
 
-  g_object_class_install_property
-    (gobject_class,
-     PROP_BGP_CONFIGURATOR_DISABLE_MULTIPATH_ARGS_AFI,
-     g_param_spec_int ("afi",
-                       NULL,
-                       NULL,
-                       1,
-                       1,
-                       1,
-                       G_PARAM_READWRITE));
+  gobject_class->finalize = bgp_configurator_resume_notifications_args_finalize;
+  gobject_class->get_property = bgp_configurator_resume_notifications_args_get_property;
+  gobject_class->set_property = bgp_configurator_resume_notifications_args_set_property;
 
   g_object_class_install_property
     (gobject_class,
-     PROP_BGP_CONFIGURATOR_DISABLE_MULTIPATH_ARGS_SAFI,
-     g_param_spec_int ("safi",
-                       NULL,
-                       NULL,
-                       4,
-                       5,
-                       4,
-                       G_PARAM_READWRITE));
+     PROP_BGP_CONFIGURATOR_RESUME_NOTIFICATIONS_ARGS_FROM_SEQ,
+     g_param_spec_int64 ("fromSeq",
+                         NULL,
+                         NULL,
+                         G_MININT64,
+                         G_MAXINT64,
+                         0,
+                         G_PARAM_READWRITE));
 }
 
 GType
-bgp_configurator_disable_multipath_args_get_type (void)
+bgp_configurator_resume_notifications_args_get_type (void)
 {
   static GType type = 0;
 
@@ -11214,35 +14693,35 @@ bgp_configurator_disable_multipath_args_get_type (void)
   {
     static const GTypeInfo type_info = 
     {
-      sizeof (BgpConfiguratorDisableMultipathArgsClass),
+      sizeof (BgpConfiguratorResumeNotificationsArgsClass),
       NULL, /* base_init */
       NULL, /* base_finalize */
-      (GClassInitFunc) bgp_configurator_disable_multipath_args_class_init,
+      (GClassInitFunc) bgp_configurator_resume_notifications_args_class_init,
       NULL, /* class_finalize */
       NULL, /* class_data */
-      sizeof (BgpConfiguratorDisableMultipathArgs),
+      sizeof (BgpConfiguratorResumeNotificationsArgs),
       0, /* n_preallocs */
-      (GInstanceInitFunc) bgp_configurator_disable_multipath_args_instance_init,
+      (GInstanceInitFunc) bgp_configurator_resume_notifications_args_instance_init,
       NULL, /* value_table */
     };
 
     type = g_type_register_static (THRIFT_TYPE_STRUCT, 
-                                   "BgpConfiguratorDisableMultipathArgsType",
+                                   "BgpConfiguratorResumeNotificationsArgsType",
                                    &type_info, 0);
   }
 
   return type;
 }
 
-enum _BgpConfiguratorDisableMultipathResultProperties
+enum _BgpConfiguratorResumeNotificationsResultProperties
 {
-  PROP_BGP_CONFIGURATOR_DISABLE_MULTIPATH_RESULT_0,
-  PROP_BGP_CONFIGURATOR_DISABLE_MULTIPATH_RESULT_SUCCESS
+  PROP_BGP_CONFIGURATOR_RESUME_NOTIFICATIONS_RESULT_0,
+  PROP_BGP_CONFIGURATOR_RESUME_NOTIFICATIONS_RESULT_SUCCESS
 };
 
-/* reads a bgp_configurator_disable_multipath_result object */
+/* reads a bgp_configurator_resume_notifications_result object */
 static gint32
-bgp_configurator_disable_multipath_result_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+bgp_configurator_resume_notifications_result_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
 {
   gint32 ret;
   gint32 xfer = 0;
@@ -11251,7 +14730,7 @@ bgp_configurator_disable_multipath_result_read (ThriftStruct *object, ThriftProt
   gint16 fid;
   guint32 len = 0;
   gpointer data = NULL;
-  BgpConfiguratorDisableMultipathResult * this_object = BGP_CONFIGURATOR_DISABLE_MULTIPATH_RESULT(object);
+  BgpConfiguratorResumeNotificationsResult * this_object = BGP_CONFIGURATOR_RESUME_NOTIFICATIONS_RESULT(object);
 
   /* satisfy -Wall in case these aren't used */
   THRIFT_UNUSED_VAR (len);
@@ -11321,14 +14800,14 @@ bgp_configurator_disable_multipath_result_read (ThriftStruct *object, ThriftProt
 }
 
 static gint32
-bgp_configurator_disable_multipath_result_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+bgp_configurator_resume_notifications_result_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
 {
   gint32 ret;
   gint32 xfer = 0;
 
-  BgpConfiguratorDisableMultipathResult * this_object = BGP_CONFIGURATOR_DISABLE_MULTIPATH_RESULT(object);
+  BgpConfiguratorResumeNotificationsResult * this_object = BGP_CONFIGURATOR_RESUME_NOTIFICATIONS_RESULT(object);
   THRIFT_UNUSED_VAR (this_object);
-  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorDisableMultipathResult", error)) < 0)
+  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorResumeNotificationsResult", error)) < 0)
     return -1;
   xfer += ret;
   if (this_object->__isset_success == TRUE) {
@@ -11354,16 +14833,16 @@ bgp_configurator_disable_multipath_result_write (ThriftStruct *object, ThriftPro
 }
 
 static void
-bgp_configurator_disable_multipath_result_set_property (GObject *object,
-                                                        guint property_id,
-                                                        const GValue *value,
-                                                        GParamSpec *pspec)
+bgp_configurator_resume_notifications_result_set_property (GObject *object,
+                                                           guint property_id,
+                                                           const GValue *value,
+                                                           GParamSpec *pspec)
 {
-  BgpConfiguratorDisableMultipathResult *self = BGP_CONFIGURATOR_DISABLE_MULTIPATH_RESULT (object);
+  BgpConfiguratorResumeNotificationsResult *self = BGP_CONFIGURATOR_RESUME_NOTIFICATIONS_RESULT (object);
 
   switch (property_id)
   {
-    case PROP_BGP_CONFIGURATOR_DISABLE_MULTIPATH_RESULT_SUCCESS:
+    case PROP_BGP_CONFIGURATOR_RESUME_NOTIFICATIONS_RESULT_SUCCESS:
       self->success = g_value_get_int (value);
       self->__isset_success = TRUE;
       break;
@@ -11375,16 +14854,16 @@ bgp_configurator_disable_multipath_result_set_property (GObject *object,
 }
 
 static void
-bgp_configurator_disable_multipath_result_get_property (GObject *object,
-                                                        guint property_id,
-                                                        GValue *value,
-                                                        GParamSpec *pspec)
+bgp_configurator_resume_notifications_result_get_property (GObject *object,
+                                                           guint property_id,
+                                                           GValue *value,
+                                                           GParamSpec *pspec)
 {
-  BgpConfiguratorDisableMultipathResult *self = BGP_CONFIGURATOR_DISABLE_MULTIPATH_RESULT (object);
+  BgpConfiguratorResumeNotificationsResult *self = BGP_CONFIGURATOR_RESUME_NOTIFICATIONS_RESULT (object);
 
   switch (property_id)
   {
-    case PROP_BGP_CONFIGURATOR_DISABLE_MULTIPATH_RESULT_SUCCESS:
+    case PROP_BGP_CONFIGURATOR_RESUME_NOTIFICATIONS_RESULT_SUCCESS:
       g_value_set_int (value, self->success);
       break;
 
@@ -11395,7 +14874,7 @@ bgp_configurator_disable_multipath_result_get_property (GObject *object,
 }
 
 static void 
-bgp_configurator_disable_multipath_result_instance_init (BgpConfiguratorDisableMultipathResult * object)
+bgp_configurator_resume_notifications_result_instance_init (BgpConfiguratorResumeNotificationsResult * object)
 {
   /* satisfy -Wall */
   THRIFT_UNUSED_VAR (object);
@@ -11404,30 +14883,30 @@ bgp_configurator_disable_multipath_result_instance_init (BgpConfiguratorDisableM
 }
 
 static void 
-bgp_configurator_disable_multipath_result_finalize (GObject *object)
+bgp_configurator_resume_notifications_result_finalize (GObject *object)
 {
-  BgpConfiguratorDisableMultipathResult *tobject = BGP_CONFIGURATOR_DISABLE_MULTIPATH_RESULT (object);
+  BgpConfiguratorResumeNotificationsResult *tobject = BGP_CONFIGURATOR_RESUME_NOTIFICATIONS_RESULT (object);
 
   /* satisfy -Wall in case we don't use tobject */
   THRIFT_UNUSED_VAR (tobject);
 }
 
 static void
-bgp_configurator_disable_multipath_result_class_init (BgpConfiguratorDisableMultipathResultClass * cls)
+bgp_configurator_resume_notifications_result_class_init (BgpConfiguratorResumeNotificationsResultClass * cls)
 {
   GObjectClass *gobject_class = G_OBJECT_CLASS (cls);
   ThriftStructClass *struct_class = THRIFT_STRUCT_CLASS (cls);
 
-  struct_class->read = bgp_configurator_disable_multipath_result_read;
-  struct_class->write = bgp_configurator_disable_multipath_result_write;
+  struct_class->read = bgp_configurator_resume_notifications_result_read;
+  struct_class->write = bgp_configurator_resume_notifications_result_write;
 
-  gobject_class->finalize = bgp_configurator_disable_multipath_result_finalize;
-  gobject_class->get_property = bgp_configurator_disable_multipath_result_get_property;
-  gobject_class->set_property = bgp_configurator_disable_multipath_result_set_property;
+  gobject_class->finalize = bgp_configurator_resume_notifications_result_finalize;
+  gobject_class->get_property = bgp_configurator_resume_notifications_result_get_property;
+  gobject_class->set_property = bgp_configurator_resume_notifications_result_set_property;
 
   g_object_class_install_property
     (gobject_class,
-     PROP_BGP_CONFIGURATOR_DISABLE_MULTIPATH_RESULT_SUCCESS,
+     PROP_BGP_CONFIGURATOR_RESUME_NOTIFICATIONS_RESULT_SUCCESS,
      g_param_spec_int ("success",
                        NULL,
                        NULL,
@@ -11438,7 +14917,7 @@ bgp_configurator_disable_multipath_result_class_init (BgpConfiguratorDisableMult
 }
 
 GType
-bgp_configurator_disable_multipath_result_get_type (void)
+bgp_configurator_resume_notifications_result_get_type (void)
 {
   static GType type = 0;
 
@@ -11446,36 +14925,35 @@ bgp_configurator_disable_multipath_result_get_type (void)
   {
     static const GTypeInfo type_info = 
     {
-      sizeof (BgpConfiguratorDisableMultipathResultClass),
+      sizeof (BgpConfiguratorResumeNotificationsResultClass),
       NULL, /* base_init */
       NULL, /* base_finalize */
-      (GClassInitFunc) bgp_configurator_disable_multipath_result_class_init,
+      (GClassInitFunc) bgp_configurator_resume_notifications_result_class_init,
       NULL, /* class_finalize */
       NULL, /* class_data */
-      sizeof (BgpConfiguratorDisableMultipathResult),
+      sizeof (BgpConfiguratorResumeNotificationsResult),
       0, /* n_preallocs */
-      (GInstanceInitFunc) bgp_configurator_disable_multipath_result_instance_init,
+      (GInstanceInitFunc) bgp_configurator_resume_notifications_result_instance_init,
       NULL, /* value_table */
     };
 
     type = g_type_register_static (THRIFT_TYPE_STRUCT, 
-                                   "BgpConfiguratorDisableMultipathResultType",
+                                   "BgpConfiguratorResumeNotificationsResultType",
                                    &type_info, 0);
   }
 
   return type;
 }
 
-enum _BgpConfiguratorMultipathsArgsProperties
+enum _BgpConfiguratorApplyConfigArgsProperties
 {
-  PROP_BGP_CONFIGURATOR_MULTIPATHS_ARGS_0,
-  PROP_BGP_CONFIGURATOR_MULTIPATHS_ARGS_RD,
-  PROP_BGP_CONFIGURATOR_MULTIPATHS_ARGS_MAX_PATH
+  PROP_BGP_CONFIGURATOR_APPLY_CONFIG_ARGS_0,
+  PROP_BGP_CONFIGURATOR_APPLY_CONFIG_ARGS_SNAPSHOT
 };
 
-/* reads a bgp_configurator_multipaths_args object */
+/* reads a bgp_configurator_apply_config_args object */
 static gint32
-bgp_configurator_multipaths_args_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+bgp_configurator_apply_config_args_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
 {
   gint32 ret;
   gint32 xfer = 0;
@@ -11484,7 +14962,7 @@ bgp_configurator_multipaths_args_read (ThriftStruct *object, ThriftProtocol *pro
   gint16 fid;
   guint32 len = 0;
   gpointer data = NULL;
-  BgpConfiguratorMultipathsArgs * this_object = BGP_CONFIGURATOR_MULTIPATHS_ARGS(object);
+  BgpConfiguratorApplyConfigArgs * this_object = BGP_CONFIGURATOR_APPLY_CONFIG_ARGS(object);
 
   /* satisfy -Wall in case these aren't used */
   THRIFT_UNUSED_VAR (len);
@@ -11523,31 +15001,14 @@ bgp_configurator_multipaths_args_read (ThriftStruct *object, ThriftProtocol *pro
     switch (fid)
     {
       case 1:
-        if (ftype == T_STRING)
+        if (ftype == T_STRUCT)
         {
-          if (this_object->rd != NULL)
+          if ((ret = thrift_struct_read (THRIFT_STRUCT (this_object->snapshot), protocol, error)) < 0)
           {
-            g_free(this_object->rd);
-            this_object->rd = NULL;
-          }
-
-          if ((ret = thrift_protocol_read_string (protocol, &this_object->rd, error)) < 0)
-            return -1;
-          xfer += ret;
-          this_object->__isset_rd = TRUE;
-        } else {
-          if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
-            return -1;
-          xfer += ret;
-        }
-        break;
-      case 2:
-        if (ftype == T_I32)
-        {
-          if ((ret = thrift_protocol_read_i32 (protocol, &this_object->maxPath, error)) < 0)
             return -1;
+          }
           xfer += ret;
-          this_object->__isset_maxPath = TRUE;
+          this_object->__isset_snapshot = TRUE;
         } else {
           if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
             return -1;
@@ -11573,30 +15034,20 @@ bgp_configurator_multipaths_args_read (ThriftStruct *object, ThriftProtocol *pro
 }
 
 static gint32
-bgp_configurator_multipaths_args_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+bgp_configurator_apply_config_args_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
 {
   gint32 ret;
   gint32 xfer = 0;
 
-  BgpConfiguratorMultipathsArgs * this_object = BGP_CONFIGURATOR_MULTIPATHS_ARGS(object);
+  BgpConfiguratorApplyConfigArgs * this_object = BGP_CONFIGURATOR_APPLY_CONFIG_ARGS(object);
   THRIFT_UNUSED_VAR (this_object);
-  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorMultipathsArgs", error)) < 0)
-    return -1;
-  xfer += ret;
-  if ((ret = thrift_protocol_write_field_begin (protocol, "rd", T_STRING, 1, error)) < 0)
-    return -1;
-  xfer += ret;
-  if ((ret = thrift_protocol_write_string (protocol, this_object->rd, error)) < 0)
-    return -1;
-  xfer += ret;
-
-  if ((ret = thrift_protocol_write_field_end (protocol, error)) < 0)
+  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorApplyConfigArgs", error)) < 0)
     return -1;
   xfer += ret;
-  if ((ret = thrift_protocol_write_field_begin (protocol, "maxPath", T_I32, 2, error)) < 0)
+  if ((ret = thrift_protocol_write_field_begin (protocol, "snapshot", T_STRUCT, 1, error)) < 0)
     return -1;
   xfer += ret;
-  if ((ret = thrift_protocol_write_i32 (protocol, this_object->maxPath, error)) < 0)
+  if ((ret = thrift_struct_write (THRIFT_STRUCT (this_object->snapshot), protocol, error)) < 0)
     return -1;
   xfer += ret;
 
@@ -11614,25 +15065,20 @@ bgp_configurator_multipaths_args_write (ThriftStruct *object, ThriftProtocol *pr
 }
 
 static void
-bgp_configurator_multipaths_args_set_property (GObject *object,
-                                               guint property_id,
-                                               const GValue *value,
-                                               GParamSpec *pspec)
+bgp_configurator_apply_config_args_set_property (GObject *object,
+                                                 guint property_id,
+                                                 const GValue *value,
+                                                 GParamSpec *pspec)
 {
-  BgpConfiguratorMultipathsArgs *self = BGP_CONFIGURATOR_MULTIPATHS_ARGS (object);
+  BgpConfiguratorApplyConfigArgs *self = BGP_CONFIGURATOR_APPLY_CONFIG_ARGS (object);
 
   switch (property_id)
   {
-    case PROP_BGP_CONFIGURATOR_MULTIPATHS_ARGS_RD:
-      if (self->rd != NULL)
-        g_free (self->rd);
-      self->rd = g_value_dup_string (value);
-      self->__isset_rd = TRUE;
-      break;
-
-    case PROP_BGP_CONFIGURATOR_MULTIPATHS_ARGS_MAX_PATH:
-      self->maxPath = g_value_get_int (value);
-      self->__isset_maxPath = TRUE;
+    case PROP_BGP_CONFIGURATOR_APPLY_CONFIG_ARGS_SNAPSHOT:
+      if (self->snapshot != NULL)
+        g_object_unref (self->snapshot);
+      self->snapshot = g_value_dup_object (value);
+      self->__isset_snapshot = TRUE;
       break;
 
     default:
@@ -11642,21 +15088,17 @@ bgp_configurator_multipaths_args_set_property (GObject *object,
 }
 
 static void
-bgp_configurator_multipaths_args_get_property (GObject *object,
-                                               guint property_id,
-                                               GValue *value,
-                                               GParamSpec *pspec)
+bgp_configurator_apply_config_args_get_property (GObject *object,
+                                                 guint property_id,
+                                                 GValue *value,
+                                                 GParamSpec *pspec)
 {
-  BgpConfiguratorMultipathsArgs *self = BGP_CONFIGURATOR_MULTIPATHS_ARGS (object);
+  BgpConfiguratorApplyConfigArgs *self = BGP_CONFIGURATOR_APPLY_CONFIG_ARGS (object);
 
   switch (property_id)
   {
-    case PROP_BGP_CONFIGURATOR_MULTIPATHS_ARGS_RD:
-      g_value_set_string (value, self->rd);
-      break;
-
-    case PROP_BGP_CONFIGURATOR_MULTIPATHS_ARGS_MAX_PATH:
-      g_value_set_int (value, self->maxPath);
+    case PROP_BGP_CONFIGURATOR_APPLY_CONFIG_ARGS_SNAPSHOT:
+      g_value_set_object (value, self->snapshot);
       break;
 
     default:
@@ -11666,66 +15108,53 @@ bgp_configurator_multipaths_args_get_property (GObject *object,
 }
 
 static void 
-bgp_configurator_multipaths_args_instance_init (BgpConfiguratorMultipathsArgs * object)
+bgp_configurator_apply_config_args_instance_init (BgpConfiguratorApplyConfigArgs * object)
 {
   /* satisfy -Wall */
   THRIFT_UNUSED_VAR (object);
-  object->rd = NULL;
-  object->__isset_rd = FALSE;
-  object->maxPath = 0;
-  object->__isset_maxPath = FALSE;
+  object->snapshot = g_object_new (TYPE_CONFIG_SNAPSHOT, NULL);
+  object->__isset_snapshot = FALSE;
 }
 
 static void 
-bgp_configurator_multipaths_args_finalize (GObject *object)
+bgp_configurator_apply_config_args_finalize (GObject *object)
 {
-  BgpConfiguratorMultipathsArgs *tobject = BGP_CONFIGURATOR_MULTIPATHS_ARGS (object);
+  BgpConfiguratorApplyConfigArgs *tobject = BGP_CONFIGURATOR_APPLY_CONFIG_ARGS (object);
 
   /* satisfy -Wall in case we don't use tobject */
   THRIFT_UNUSED_VAR (tobject);
-  if (tobject->rd != NULL)
+  if (tobject->snapshot != NULL)
   {
-    g_free(tobject->rd);
-    tobject->rd = NULL;
+    g_object_unref(tobject->snapshot);
+    tobject->snapshot = NULL;
   }
 }
 
 static void
-bgp_configurator_multipaths_args_class_init (BgpConfiguratorMultipathsArgsClass * cls)
+bgp_configurator_apply_config_args_class_init (BgpConfiguratorApplyConfigArgsClass * cls)
 {
   GObjectClass *gobject_class = G_OBJECT_CLASS (cls);
   ThriftStructClass *struct_class = THRIFT_STRUCT_CLASS (cls);
 
-  struct_class->read = bgp_configurator_multipaths_args_read;
-  struct_class->write = bgp_configurator_multipaths_args_write;
-
-  gobject_class->finalize = bgp_configurator_multipaths_args_finalize;
-  gobject_class->get_property = bgp_configurator_multipaths_args_get_property;
-  gobject_class->set_property = bgp_configurator_multipaths_args_set_property;
+  struct_class->read = bgp_configurator_apply_config_args_read;
+  struct_class->write = bgp_configurator_apply_config_args_write;
 
-  g_object_class_install_property
-    (gobject_class,
-     PROP_BGP_CONFIGURATOR_MULTIPATHS_ARGS_RD,
-     g_param_spec_string ("rd",
-                          NULL,
-                          NULL,
-                          NULL,
-                          G_PARAM_READWRITE));
+  gobject_class->finalize = bgp_configurator_apply_config_args_finalize;
+  gobject_class->get_property = bgp_configurator_apply_config_args_get_property;
+  gobject_class->set_property = bgp_configurator_apply_config_args_set_property;
 
   g_object_class_install_property
     (gobject_class,
-     PROP_BGP_CONFIGURATOR_MULTIPATHS_ARGS_MAX_PATH,
-     g_param_spec_int ("maxPath",
-                       NULL,
-                       NULL,
-                       G_MININT32,
-                       G_MAXINT32,
-                       0,
-                       G_PARAM_READWRITE));
+     PROP_BGP_CONFIGURATOR_APPLY_CONFIG_ARGS_SNAPSHOT,
+     g_param_spec_object ("snapshot",
+                         NULL,
+                         NULL,
+                         TYPE_CONFIG_SNAPSHOT,
+                         G_PARAM_READWRITE));
 }
 
 GType
-bgp_configurator_multipaths_args_get_type (void)
+bgp_configurator_apply_config_args_get_type (void)
 {
   static GType type = 0;
 
@@ -11733,35 +15162,35 @@ bgp_configurator_multipaths_args_get_type (void)
   {
     static const GTypeInfo type_info = 
     {
-      sizeof (BgpConfiguratorMultipathsArgsClass),
+      sizeof (BgpConfiguratorApplyConfigArgsClass),
       NULL, /* base_init */
       NULL, /* base_finalize */
-      (GClassInitFunc) bgp_configurator_multipaths_args_class_init,
+      (GClassInitFunc) bgp_configurator_apply_config_args_class_init,
       NULL, /* class_finalize */
       NULL, /* class_data */
-      sizeof (BgpConfiguratorMultipathsArgs),
+      sizeof (BgpConfiguratorApplyConfigArgs),
       0, /* n_preallocs */
-      (GInstanceInitFunc) bgp_configurator_multipaths_args_instance_init,
+      (GInstanceInitFunc) bgp_configurator_apply_config_args_instance_init,
       NULL, /* value_table */
     };
 
     type = g_type_register_static (THRIFT_TYPE_STRUCT, 
-                                   "BgpConfiguratorMultipathsArgsType",
+                                   "BgpConfiguratorApplyConfigArgsType",
                                    &type_info, 0);
   }
 
   return type;
 }
 
-enum _BgpConfiguratorMultipathsResultProperties
+enum _BgpConfiguratorApplyConfigResultProperties
 {
-  PROP_BGP_CONFIGURATOR_MULTIPATHS_RESULT_0,
-  PROP_BGP_CONFIGURATOR_MULTIPATHS_RESULT_SUCCESS
+  PROP_BGP_CONFIGURATOR_APPLY_CONFIG_RESULT_0,
+  PROP_BGP_CONFIGURATOR_APPLY_CONFIG_RESULT_SUCCESS
 };
 
-/* reads a bgp_configurator_multipaths_result object */
+/* reads a bgp_configurator_apply_config_result object */
 static gint32
-bgp_configurator_multipaths_result_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+bgp_configurator_apply_config_result_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
 {
   gint32 ret;
   gint32 xfer = 0;
@@ -11770,7 +15199,7 @@ bgp_configurator_multipaths_result_read (ThriftStruct *object, ThriftProtocol *p
   gint16 fid;
   guint32 len = 0;
   gpointer data = NULL;
-  BgpConfiguratorMultipathsResult * this_object = BGP_CONFIGURATOR_MULTIPATHS_RESULT(object);
+  BgpConfiguratorApplyConfigResult * this_object = BGP_CONFIGURATOR_APPLY_CONFIG_RESULT(object);
 
   /* satisfy -Wall in case these aren't used */
   THRIFT_UNUSED_VAR (len);
@@ -11840,14 +15269,14 @@ bgp_configurator_multipaths_result_read (ThriftStruct *object, ThriftProtocol *p
 }
 
 static gint32
-bgp_configurator_multipaths_result_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+bgp_configurator_apply_config_result_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
 {
   gint32 ret;
   gint32 xfer = 0;
 
-  BgpConfiguratorMultipathsResult * this_object = BGP_CONFIGURATOR_MULTIPATHS_RESULT(object);
+  BgpConfiguratorApplyConfigResult * this_object = BGP_CONFIGURATOR_APPLY_CONFIG_RESULT(object);
   THRIFT_UNUSED_VAR (this_object);
-  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorMultipathsResult", error)) < 0)
+  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpConfiguratorApplyConfigResult", error)) < 0)
     return -1;
   xfer += ret;
   if (this_object->__isset_success == TRUE) {
@@ -11873,16 +15302,16 @@ bgp_configurator_multipaths_result_write (ThriftStruct *object, ThriftProtocol *
 }
 
 static void
-bgp_configurator_multipaths_result_set_property (GObject *object,
-                                                 guint property_id,
-                                                 const GValue *value,
-                                                 GParamSpec *pspec)
+bgp_configurator_apply_config_result_set_property (GObject *object,
+                                                   guint property_id,
+                                                   const GValue *value,
+                                                   GParamSpec *pspec)
 {
-  BgpConfiguratorMultipathsResult *self = BGP_CONFIGURATOR_MULTIPATHS_RESULT (object);
+  BgpConfiguratorApplyConfigResult *self = BGP_CONFIGURATOR_APPLY_CONFIG_RESULT (object);
 
   switch (property_id)
   {
-    case PROP_BGP_CONFIGURATOR_MULTIPATHS_RESULT_SUCCESS:
+    case PROP_BGP_CONFIGURATOR_APPLY_CONFIG_RESULT_SUCCESS:
       self->success = g_value_get_int (value);
       self->__isset_success = TRUE;
       break;
@@ -11891,19 +15320,19 @@ bgp_configurator_multipaths_result_set_property (GObject *object,
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, property_id, pspec);
       break;
   }
-}
-
-static void
-bgp_configurator_multipaths_result_get_property (GObject *object,
-                                                 guint property_id,
-                                                 GValue *value,
-                                                 GParamSpec *pspec)
+}
+
+static void
+bgp_configurator_apply_config_result_get_property (GObject *object,
+                                                   guint property_id,
+                                                   GValue *value,
+                                                   GParamSpec *pspec)
 {
-  BgpConfiguratorMultipathsResult *self = BGP_CONFIGURATOR_MULTIPATHS_RESULT (object);
+  BgpConfiguratorApplyConfigResult *self = BGP_CONFIGURATOR_APPLY_CONFIG_RESULT (object);
 
   switch (property_id)
   {
-    case PROP_BGP_CONFIGURATOR_MULTIPATHS_RESULT_SUCCESS:
+    case PROP_BGP_CONFIGURATOR_APPLY_CONFIG_RESULT_SUCCESS:
       g_value_set_int (value, self->success);
       break;
 
@@ -11914,7 +15343,7 @@ bgp_configurator_multipaths_result_get_property (GObject *object,
 }
 
 static void 
-bgp_configurator_multipaths_result_instance_init (BgpConfiguratorMultipathsResult * object)
+bgp_configurator_apply_config_result_instance_init (BgpConfiguratorApplyConfigResult * object)
 {
   /* satisfy -Wall */
   THRIFT_UNUSED_VAR (object);
@@ -11923,30 +15352,30 @@ bgp_configurator_multipaths_result_instance_init (BgpConfiguratorMultipathsResul
 }
 
 static void 
-bgp_configurator_multipaths_result_finalize (GObject *object)
+bgp_configurator_apply_config_result_finalize (GObject *object)
 {
-  BgpConfiguratorMultipathsResult *tobject = BGP_CONFIGURATOR_MULTIPATHS_RESULT (object);
+  BgpConfiguratorApplyConfigResult *tobject = BGP_CONFIGURATOR_APPLY_CONFIG_RESULT (object);
 
   /* satisfy -Wall in case we don't use tobject */
   THRIFT_UNUSED_VAR (tobject);
 }
 
 static void
-bgp_configurator_multipaths_result_class_init (BgpConfiguratorMultipathsResultClass * cls)
+bgp_configurator_apply_config_result_class_init (BgpConfiguratorApplyConfigResultClass * cls)
 {
   GObjectClass *gobject_class = G_OBJECT_CLASS (cls);
   ThriftStructClass *struct_class = THRIFT_STRUCT_CLASS (cls);
 
-  struct_class->read = bgp_configurator_multipaths_result_read;
-  struct_class->write = bgp_configurator_multipaths_result_write;
+  struct_class->read = bgp_configurator_apply_config_result_read;
+  struct_class->write = bgp_configurator_apply_config_result_write;
 
-  gobject_class->finalize = bgp_configurator_multipaths_result_finalize;
-  gobject_class->get_property = bgp_configurator_multipaths_result_get_property;
-  gobject_class->set_property = bgp_configurator_multipaths_result_set_property;
+  gobject_class->finalize = bgp_configurator_apply_config_result_finalize;
+  gobject_class->get_property = bgp_configurator_apply_config_result_get_property;
+  gobject_class->set_property = bgp_configurator_apply_config_result_set_property;
 
   g_object_class_install_property
     (gobject_class,
-     PROP_BGP_CONFIGURATOR_MULTIPATHS_RESULT_SUCCESS,
+     PROP_BGP_CONFIGURATOR_APPLY_CONFIG_RESULT_SUCCESS,
      g_param_spec_int ("success",
                        NULL,
                        NULL,
@@ -11957,7 +15386,7 @@ bgp_configurator_multipaths_result_class_init (BgpConfiguratorMultipathsResultCl
 }
 
 GType
-bgp_configurator_multipaths_result_get_type (void)
+bgp_configurator_apply_config_result_get_type (void)
 {
   static GType type = 0;
 
@@ -11965,20 +15394,20 @@ bgp_configurator_multipaths_result_get_type (void)
   {
     static const GTypeInfo type_info = 
     {
-      sizeof (BgpConfiguratorMultipathsResultClass),
+      sizeof (BgpConfiguratorApplyConfigResultClass),
       NULL, /* base_init */
       NULL, /* base_finalize */
-      (GClassInitFunc) bgp_configurator_multipaths_result_class_init,
+      (GClassInitFunc) bgp_configurator_apply_config_result_class_init,
       NULL, /* class_finalize */
       NULL, /* class_data */
-      sizeof (BgpConfiguratorMultipathsResult),
+      sizeof (BgpConfiguratorApplyConfigResult),
       0, /* n_preallocs */
-      (GInstanceInitFunc) bgp_configurator_multipaths_result_instance_init,
+      (GInstanceInitFunc) bgp_configurator_apply_config_result_instance_init,
       NULL, /* value_table */
     };
 
     type = g_type_register_static (THRIFT_TYPE_STRUCT, 
-                                   "BgpConfiguratorMultipathsResultType",
+                                   "BgpConfiguratorApplyConfigResultType",
                                    &type_info, 0);
   }
 
@@ -13357,3 +16786,278 @@ bgp_updater_on_notification_send_event_args_get_type (void)
   return type;
 }
 
+enum _BgpUpdaterOnUpdateBatchArgsProperties
+{
+  PROP_BGP_UPDATER_ON_UPDATE_BATCH_ARGS_0,
+  PROP_BGP_UPDATER_ON_UPDATE_BATCH_ARGS_UPDATES
+};
+
+/* reads a bgp_updater_on_update_batch_args object */
+static gint32
+bgp_updater_on_update_batch_args_read (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+{
+  gint32 ret;
+  gint32 xfer = 0;
+  gchar *name = NULL;
+  ThriftType ftype;
+  gint16 fid;
+  guint32 len = 0;
+  gpointer data = NULL;
+  BgpUpdaterOnUpdateBatchArgs * this_object = BGP_UPDATER_ON_UPDATE_BATCH_ARGS(object);
+
+  /* satisfy -Wall in case these aren't used */
+  THRIFT_UNUSED_VAR (len);
+  THRIFT_UNUSED_VAR (data);
+  THRIFT_UNUSED_VAR (this_object);
+
+  /* read the struct begin marker */
+  if ((ret = thrift_protocol_read_struct_begin (protocol, &name, error)) < 0)
+  {
+    if (name) g_free (name);
+    return -1;
+  }
+  xfer += ret;
+  if (name) g_free (name);
+  name = NULL;
+
+  /* read the struct fields */
+  while (1)
+  {
+    /* read the beginning of a field */
+    if ((ret = thrift_protocol_read_field_begin (protocol, &name, &ftype, &fid, error)) < 0)
+    {
+      if (name) g_free (name);
+      return -1;
+    }
+    xfer += ret;
+    if (name) g_free (name);
+    name = NULL;
+
+    /* break if we get a STOP field */
+    if (ftype == T_STOP)
+    {
+      break;
+    }
+
+    switch (fid)
+    {
+      case 1:
+        if (ftype == T_LIST)
+        {
+          {
+            guint32 size;
+            guint32 i;
+            ThriftType element_type;
+
+            if ((ret = thrift_protocol_read_list_begin (protocol, &element_type,&size, error)) < 0)
+              return -1;
+            xfer += ret;
+
+            /* iterate through list elements */
+            for (i = 0; i < size; i++)
+            {
+              Update * _elem17 = NULL;
+              if ( _elem17 != NULL)
+              {
+                g_object_unref (_elem17);
+              }
+              _elem17 = g_object_new (TYPE_UPDATE, NULL);
+              if ((ret = thrift_struct_read (THRIFT_STRUCT (_elem17), protocol, error)) < 0)
+              {
+                g_object_unref (_elem17);
+                return -1;
+              }
+              xfer += ret;
+              g_ptr_array_add (this_object->updates, _elem17);
+            }
+            if ((ret = thrift_protocol_read_list_end (protocol, error)) < 0)
+              return -1;
+            xfer += ret;
+          }
+          this_object->__isset_updates = TRUE;
+        } else {
+          if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
+            return -1;
+          xfer += ret;
+        }
+        break;
+      default:
+        if ((ret = thrift_protocol_skip (protocol, ftype, error)) < 0)
+          return -1;
+        xfer += ret;
+        break;
+    }
+    if ((ret = thrift_protocol_read_field_end (protocol, error)) < 0)
+      return -1;
+    xfer += ret;
+  }
+
+  if ((ret = thrift_protocol_read_struct_end (protocol, error)) < 0)
+    return -1;
+  xfer += ret;
+
+  return xfer;
+}
+
+static gint32
+bgp_updater_on_update_batch_args_write (ThriftStruct *object, ThriftProtocol *protocol, GError **error)
+{
+  gint32 ret;
+  gint32 xfer = 0;
+
+  BgpUpdaterOnUpdateBatchArgs * this_object = BGP_UPDATER_ON_UPDATE_BATCH_ARGS(object);
+  THRIFT_UNUSED_VAR (this_object);
+  if ((ret = thrift_protocol_write_struct_begin (protocol, "BgpUpdaterOnUpdateBatchArgs", error)) < 0)
+    return -1;
+  xfer += ret;
+  if ((ret = thrift_protocol_write_field_begin (protocol, "updates", T_LIST, 1, error)) < 0)
+    return -1;
+  xfer += ret;
+  {
+    guint i18;
+
+    if ((ret = thrift_protocol_write_list_begin (protocol, T_STRUCT, (gint32) (this_object->updates ? this_object->updates->len : 0), error)) < 0)
+      return -1;
+    xfer += ret;
+    for (i18 = 0; i18 < (this_object->updates ? this_object->updates->len : 0); i18++)
+    {
+      if ((ret = thrift_struct_write (THRIFT_STRUCT ((g_ptr_array_index ((GPtrArray *) this_object->updates, i18))), protocol, error)) < 0)
+        return -1;
+      xfer += ret;
+
+    }
+    if ((ret = thrift_protocol_write_list_end (protocol, error)) < 0)
+      return -1;
+    xfer += ret;
+  }
+  if ((ret = thrift_protocol_write_field_end (protocol, error)) < 0)
+    return -1;
+  xfer += ret;
+  if ((ret = thrift_protocol_write_field_stop (protocol, error)) < 0)
+    return -1;
+  xfer += ret;
+  if ((ret = thrift_protocol_write_struct_end (protocol, error)) < 0)
+    return -1;
+  xfer += ret;
+
+  return xfer;
+}
+
+static void
+bgp_updater_on_update_batch_args_set_property (GObject *object,
+                                               guint property_id,
+                                               const GValue *value,
+                                               GParamSpec *pspec)
+{
+  BgpUpdaterOnUpdateBatchArgs *self = BGP_UPDATER_ON_UPDATE_BATCH_ARGS (object);
+
+  switch (property_id)
+  {
+    case PROP_BGP_UPDATER_ON_UPDATE_BATCH_ARGS_UPDATES:
+      if (self->updates != NULL)
+        g_ptr_array_unref (self->updates);
+      self->updates = g_value_dup_boxed (value);
+      self->__isset_updates = TRUE;
+      break;
+
+    default:
+      G_OBJECT_WARN_INVALID_PROPERTY_ID (object, property_id, pspec);
+      break;
+  }
+}
+
+static void
+bgp_updater_on_update_batch_args_get_property (GObject *object,
+                                               guint property_id,
+                                               GValue *value,
+                                               GParamSpec *pspec)
+{
+  BgpUpdaterOnUpdateBatchArgs *self = BGP_UPDATER_ON_UPDATE_BATCH_ARGS (object);
+
+  switch (property_id)
+  {
+    case PROP_BGP_UPDATER_ON_UPDATE_BATCH_ARGS_UPDATES:
+      g_value_set_boxed (value, self->updates);
+      break;
+
+    default:
+      G_OBJECT_WARN_INVALID_PROPERTY_ID (object, property_id, pspec);
+      break;
+  }
+}
+
+static void 
+bgp_updater_on_update_batch_args_instance_init (BgpUpdaterOnUpdateBatchArgs * object)
+{
+  /* satisfy -Wall */
+  THRIFT_UNUSED_VAR (object);
+  object->updates = g_ptr_array_new_with_free_func (g_object_unref);
+  object->__isset_updates = FALSE;
+}
+
+static void 
+bgp_updater_on_update_batch_args_finalize (GObject *object)
+{
+  BgpUpdaterOnUpdateBatchArgs *tobject = BGP_UPDATER_ON_UPDATE_BATCH_ARGS (object);
+
+  /* satisfy -Wall in case we don't use tobject */
+  THRIFT_UNUSED_VAR (tobject);
+  if (tobject->updates != NULL)
+  {
+    g_ptr_array_unref (tobject->updates);
+    tobject->updates = NULL;
+  }
+}
+
+static void
+bgp_updater_on_update_batch_args_class_init (BgpUpdaterOnUpdateBatchArgsClass * cls)
+{
+  GObjectClass *gobject_class = G_OBJECT_CLASS (cls);
+  ThriftStructClass *struct_class = THRIFT_STRUCT_CLASS (cls);
+
+  struct_class->read = bgp_updater_on_update_batch_args_read;
+  struct_class->write = bgp_updater_on_update_batch_args_write;
+
+  gobject_class->finalize = bgp_updater_on_update_batch_args_finalize;
+  gobject_class->get_property = bgp_updater_on_update_batch_args_get_property;
+  gobject_class->set_property = bgp_updater_on_update_batch_args_set_property;
+
+  g_object_class_install_property
+    (gobject_class,
+     PROP_BGP_UPDATER_ON_UPDATE_BATCH_ARGS_UPDATES,
+     g_param_spec_boxed ("updates",
+                         NULL,
+                         NULL,
+                         G_TYPE_PTR_ARRAY,
+                         G_PARAM_READWRITE));
+}
+
+GType
+bgp_updater_on_update_batch_args_get_type (void)
+{
+  static GType type = 0;
+
+  if (type == 0) 
+  {
+    static const GTypeInfo type_info = 
+    {
+      sizeof (BgpUpdaterOnUpdateBatchArgsClass),
+      NULL, /* base_init */
+      NULL, /* base_finalize */
+      (GClassInitFunc) bgp_updater_on_update_batch_args_class_init,
+      NULL, /* class_finalize */
+      NULL, /* class_data */
+      sizeof (BgpUpdaterOnUpdateBatchArgs),
+      0, /* n_preallocs */
+      (GInstanceInitFunc) bgp_updater_on_update_batch_args_instance_init,
+      NULL, /* value_table */
+    };
+
+    type = g_type_register_static (THRIFT_TYPE_STRUCT, 
+                                   "BgpUpdaterOnUpdateBatchArgsType",
+                                   &type_info, 0);
+  }
+
+  return type;
+}
+
@@ -55,6 +55,8 @@ struct _Update
   gboolean __isset_prefix;
   gchar * nexthop;
   gboolean __isset_nexthop;
+  gint64 seq;
+  gboolean __isset_seq;
 };
 typedef struct _Update Update;
 
@@ -101,6 +103,99 @@ GType routes_get_type (void);
 #define IS_ROUTES_CLASS(c) (G_TYPE_CHECK_CLASS_TYPE ((c), TYPE_ROUTES))
 #define ROUTES_GET_CLASS(obj) (G_TYPE_INSTANCE_GET_CLASS ((obj), TYPE_ROUTES, RoutesClass))
 
+/* struct PeerConfig */
+struct _PeerConfig
+{ 
+  ThriftStruct parent; 
+
+  /* public */
+  gchar * ipAddress;
+  gboolean __isset_ipAddress;
+  gint64 asNumber;
+  gboolean __isset_asNumber;
+  gint32 ebgpMultihop;
+  gboolean __isset_ebgpMultihop;
+  gchar * updateSource;
+  gboolean __isset_updateSource;
+  gboolean vpnv4;
+  gboolean __isset_vpnv4;
+};
+typedef struct _PeerConfig PeerConfig;
+
+struct _PeerConfigClass
+{
+  ThriftStructClass parent;
+};
+typedef struct _PeerConfigClass PeerConfigClass;
+
+GType peer_config_get_type (void);
+#define TYPE_PEER_CONFIG (peer_config_get_type())
+#define PEER_CONFIG(obj) (G_TYPE_CHECK_INSTANCE_CAST ((obj), TYPE_PEER_CONFIG, PeerConfig))
+#define PEER_CONFIG_CLASS(c) (G_TYPE_CHECK_CLASS_CAST ((c), _TYPE_PEER_CONFIG, PeerConfigClass))
+#define IS_PEER_CONFIG(obj) (G_TYPE_CHECK_INSTANCE_TYPE ((obj), TYPE_PEER_CONFIG))
+#define IS_PEER_CONFIG_CLASS(c) (G_TYPE_CHECK_CLASS_TYPE ((c), TYPE_PEER_CONFIG))
+#define PEER_CONFIG_GET_CLASS(obj) (G_TYPE_INSTANCE_GET_CLASS ((obj), TYPE_PEER_CONFIG, PeerConfigClass))
+
+/* struct VrfConfig */
+struct _VrfConfig
+{ 
+  ThriftStruct parent; 
+
+  /* public */
+  gchar * rd;
+  gboolean __isset_rd;
+  GPtrArray * irts;
+  gboolean __isset_irts;
+  GPtrArray * erts;
+  gboolean __isset_erts;
+  gint32 maxPath;
+  gboolean __isset_maxPath;
+};
+typedef struct _VrfConfig VrfConfig;
+
+struct _VrfConfigClass
+{
+  ThriftStructClass parent;
+};
+typedef struct _VrfConfigClass VrfConfigClass;
+
+GType vrf_config_get_type (void);
+#define TYPE_VRF_CONFIG (vrf_config_get_type())
+#define VRF_CONFIG(obj) (G_TYPE_CHECK_INSTANCE_CAST ((obj), TYPE_VRF_CONFIG, VrfConfig))
+#define VRF_CONFIG_CLASS(c) (G_TYPE_CHECK_CLASS_CAST ((c), _TYPE_VRF_CONFIG, VrfConfigClass))
+#define IS_VRF_CONFIG(obj) (G_TYPE_CHECK_INSTANCE_TYPE ((obj), TYPE_VRF_CONFIG))
+#define IS_VRF_CONFIG_CLASS(c) (G_TYPE_CHECK_CLASS_TYPE ((c), TYPE_VRF_CONFIG))
+#define VRF_CONFIG_GET_CLASS(obj) (G_TYPE_INSTANCE_GET_CLASS ((obj), TYPE_VRF_CONFIG, VrfConfigClass))
+
+/* struct ConfigSnapshot */
+struct _ConfigSnapshot
+{ 
+  ThriftStruct parent; 
+
+  /* public */
+  GPtrArray * peers;
+  gboolean __isset_peers;
+  GPtrArray * vrfs;
+  gboolean __isset_vrfs;
+  GPtrArray * routes;
+  gboolean __isset_routes;
+};
+typedef struct _ConfigSnapshot ConfigSnapshot;
+
+struct _ConfigSnapshotClass
+{
+  ThriftStructClass parent;
+};
+typedef struct _ConfigSnapshotClass ConfigSnapshotClass;
+
+GType config_snapshot_get_type (void);
+#define TYPE_CONFIG_SNAPSHOT (config_snapshot_get_type())
+#define CONFIG_SNAPSHOT(obj) (G_TYPE_CHECK_INSTANCE_CAST ((obj), TYPE_CONFIG_SNAPSHOT, ConfigSnapshot))
+#define CONFIG_SNAPSHOT_CLASS(c) (G_TYPE_CHECK_CLASS_CAST ((c), _TYPE_CONFIG_SNAPSHOT, ConfigSnapshotClass))
+#define IS_CONFIG_SNAPSHOT(obj) (G_TYPE_CHECK_INSTANCE_TYPE ((obj), TYPE_CONFIG_SNAPSHOT))
+#define IS_CONFIG_SNAPSHOT_CLASS(c) (G_TYPE_CHECK_CLASS_TYPE ((c), TYPE_CONFIG_SNAPSHOT))
+#define CONFIG_SNAPSHOT_GET_CLASS(obj) (G_TYPE_INSTANCE_GET_CLASS ((obj), TYPE_CONFIG_SNAPSHOT, ConfigSnapshotClass))
+
 /* constants */
 #define LBL_NO_LABEL 0
 #define LBL_EXPLICIT_NULL 3
@@ -112,6 +207,7 @@ GType routes_get_type (void);
 #define BGP_ERR_ACTIVE 10
 #define BGP_ERR_INACTIVE 11
 #define BGP_ERR_NOT_ITER 15
+#define BGP_ERR_RESYNC 16
 #define BGP_ERR_PARAM 100
 
 /* struct BgpConfiguratorStartBgpArgs */
@@ -1210,6 +1306,206 @@ GType bgp_configurator_multipaths_result_get_type (void);
 #define IS_BGP_CONFIGURATOR_MULTIPATHS_RESULT_CLASS(c) (G_TYPE_CHECK_CLASS_TYPE ((c), TYPE_BGP_CONFIGURATOR_MULTIPATHS_RESULT))
 #define BGP_CONFIGURATOR_MULTIPATHS_RESULT_GET_CLASS(obj) (G_TYPE_INSTANCE_GET_CLASS ((obj), TYPE_BGP_CONFIGURATOR_MULTIPATHS_RESULT, BgpConfiguratorMultipathsResultClass))
 
+/* struct BgpConfiguratorPushRoutesArgs */
+struct _BgpConfiguratorPushRoutesArgs
+{ 
+  ThriftStruct parent; 
+
+  /* public */
+  GPtrArray * routes;
+  gboolean __isset_routes;
+};
+typedef struct _BgpConfiguratorPushRoutesArgs BgpConfiguratorPushRoutesArgs;
+
+struct _BgpConfiguratorPushRoutesArgsClass
+{
+  ThriftStructClass parent;
+};
+typedef struct _BgpConfiguratorPushRoutesArgsClass BgpConfiguratorPushRoutesArgsClass;
+
+GType bgp_configurator_push_routes_args_get_type (void);
+#define TYPE_BGP_CONFIGURATOR_PUSH_ROUTES_ARGS (bgp_configurator_push_routes_args_get_type())
+#define BGP_CONFIGURATOR_PUSH_ROUTES_ARGS(obj) (G_TYPE_CHECK_INSTANCE_CAST ((obj), TYPE_BGP_CONFIGURATOR_PUSH_ROUTES_ARGS, BgpConfiguratorPushRoutesArgs))
+#define BGP_CONFIGURATOR_PUSH_ROUTES_ARGS_CLASS(c) (G_TYPE_CHECK_CLASS_CAST ((c), _TYPE_BGP_CONFIGURATOR_PUSH_ROUTES_ARGS, BgpConfiguratorPushRoutesArgsClass))
+#define IS_BGP_CONFIGURATOR_PUSH_ROUTES_ARGS(obj) (G_TYPE_CHECK_INSTANCE_TYPE ((obj), TYPE_BGP_CONFIGURATOR_PUSH_ROUTES_ARGS))
+#define IS_BGP_CONFIGURATOR_PUSH_ROUTES_ARGS_CLASS(c) (G_TYPE_CHECK_CLASS_TYPE ((c), TYPE_BGP_CONFIGURATOR_PUSH_ROUTES_ARGS))
+#define BGP_CONFIGURATOR_PUSH_ROUTES_ARGS_GET_CLASS(obj) (G_TYPE_INSTANCE_GET_CLASS ((obj), TYPE_BGP_CONFIGURATOR_PUSH_ROUTES_ARGS, BgpConfiguratorPushRoutesArgsClass))
+
+/* struct BgpConfiguratorPushRoutesResult */
+struct _BgpConfiguratorPushRoutesResult
+{ 
+  ThriftStruct parent; 
+
+  /* public */
+  GArray * success;
+  gboolean __isset_success;
+};
+typedef struct _BgpConfiguratorPushRoutesResult BgpConfiguratorPushRoutesResult;
+
+struct _BgpConfiguratorPushRoutesResultClass
+{
+  ThriftStructClass parent;
+};
+typedef struct _BgpConfiguratorPushRoutesResultClass BgpConfiguratorPushRoutesResultClass;
+
+GType bgp_configurator_push_routes_result_get_type (void);
+#define TYPE_BGP_CONFIGURATOR_PUSH_ROUTES_RESULT (bgp_configurator_push_routes_result_get_type())
+#define BGP_CONFIGURATOR_PUSH_ROUTES_RESULT(obj) (G_TYPE_CHECK_INSTANCE_CAST ((obj), TYPE_BGP_CONFIGURATOR_PUSH_ROUTES_RESULT, BgpConfiguratorPushRoutesResult))
+#define BGP_CONFIGURATOR_PUSH_ROUTES_RESULT_CLASS(c) (G_TYPE_CHECK_CLASS_CAST ((c), _TYPE_BGP_CONFIGURATOR_PUSH_ROUTES_RESULT, BgpConfiguratorPushRoutesResultClass))
+#define IS_BGP_CONFIGURATOR_PUSH_ROUTES_RESULT(obj) (G_TYPE_CHECK_INSTANCE_TYPE ((obj), TYPE_BGP_CONFIGURATOR_PUSH_ROUTES_RESULT))
+#define IS_BGP_CONFIGURATOR_PUSH_ROUTES_RESULT_CLASS(c) (G_TYPE_CHECK_CLASS_TYPE ((c), TYPE_BGP_CONFIGURATOR_PUSH_ROUTES_RESULT))
+#define BGP_CONFIGURATOR_PUSH_ROUTES_RESULT_GET_CLASS(obj) (G_TYPE_INSTANCE_GET_CLASS ((obj), TYPE_BGP_CONFIGURATOR_PUSH_ROUTES_RESULT, BgpConfiguratorPushRoutesResultClass))
+
+/* struct BgpConfiguratorWithdrawRoutesArgs */
+struct _BgpConfiguratorWithdrawRoutesArgs
+{ 
+  ThriftStruct parent; 
+
+  /* public */
+  GPtrArray * routes;
+  gboolean __isset_routes;
+};
+typedef struct _BgpConfiguratorWithdrawRoutesArgs BgpConfiguratorWithdrawRoutesArgs;
+
+struct _BgpConfiguratorWithdrawRoutesArgsClass
+{
+  ThriftStructClass parent;
+};
+typedef struct _BgpConfiguratorWithdrawRoutesArgsClass BgpConfiguratorWithdrawRoutesArgsClass;
+
+GType bgp_configurator_withdraw_routes_args_get_type (void);
+#define TYPE_BGP_CONFIGURATOR_WITHDRAW_ROUTES_ARGS (bgp_configurator_withdraw_routes_args_get_type())
+#define BGP_CONFIGURATOR_WITHDRAW_ROUTES_ARGS(obj) (G_TYPE_CHECK_INSTANCE_CAST ((obj), TYPE_BGP_CONFIGURATOR_WITHDRAW_ROUTES_ARGS, BgpConfiguratorWithdrawRoutesArgs))
+#define BGP_CONFIGURATOR_WITHDRAW_ROUTES_ARGS_CLASS(c) (G_TYPE_CHECK_CLASS_CAST ((c), _TYPE_BGP_CONFIGURATOR_WITHDRAW_ROUTES_ARGS, BgpConfiguratorWithdrawRoutesArgsClass))
+#define IS_BGP_CONFIGURATOR_WITHDRAW_ROUTES_ARGS(obj) (G_TYPE_CHECK_INSTANCE_TYPE ((obj), TYPE_BGP_CONFIGURATOR_WITHDRAW_ROUTES_ARGS))
+#define IS_BGP_CONFIGURATOR_WITHDRAW_ROUTES_ARGS_CLASS(c) (G_TYPE_CHECK_CLASS_TYPE ((c), TYPE_BGP_CONFIGURATOR_WITHDRAW_ROUTES_ARGS))
+#define BGP_CONFIGURATOR_WITHDRAW_ROUTES_ARGS_GET_CLASS(obj) (G_TYPE_INSTANCE_GET_CLASS ((obj), TYPE_BGP_CONFIGURATOR_WITHDRAW_ROUTES_ARGS, BgpConfiguratorWithdrawRoutesArgsClass))
+
+/* struct BgpConfiguratorWithdrawRoutesResult */
+struct _BgpConfiguratorWithdrawRoutesResult
+{ 
+  ThriftStruct parent; 
+
+  /* public */
+  GArray * success;
+  gboolean __isset_success;
+};
+typedef struct _BgpConfiguratorWithdrawRoutesResult BgpConfiguratorWithdrawRoutesResult;
+
+struct _BgpConfiguratorWithdrawRoutesResultClass
+{
+  ThriftStructClass parent;
+};
+typedef struct _BgpConfiguratorWithdrawRoutesResultClass BgpConfiguratorWithdrawRoutesResultClass;
+
+GType bgp_configurator_withdraw_routes_result_get_type (void);
+#define TYPE_BGP_CONFIGURATOR_WITHDRAW_ROUTES_RESULT (bgp_configurator_withdraw_routes_result_get_type())
+#define BGP_CONFIGURATOR_WITHDRAW_ROUTES_RESULT(obj) (G_TYPE_CHECK_INSTANCE_CAST ((obj), TYPE_BGP_CONFIGURATOR_WITHDRAW_ROUTES_RESULT, BgpConfiguratorWithdrawRoutesResult))
+#define BGP_CONFIGURATOR_WITHDRAW_ROUTES_RESULT_CLASS(c) (G_TYPE_CHECK_CLASS_CAST ((c), _TYPE_BGP_CONFIGURATOR_WITHDRAW_ROUTES_RESULT, BgpConfiguratorWithdrawRoutesResultClass))
+#define IS_BGP_CONFIGURATOR_WITHDRAW_ROUTES_RESULT(obj) (G_TYPE_CHECK_INSTANCE_TYPE ((obj), TYPE_BGP_CONFIGURATOR_WITHDRAW_ROUTES_RESULT))
+#define IS_BGP_CONFIGURATOR_WITHDRAW_ROUTES_RESULT_CLASS(c) (G_TYPE_CHECK_CLASS_TYPE ((c), TYPE_BGP_CONFIGURATOR_WITHDRAW_ROUTES_RESULT))
+#define BGP_CONFIGURATOR_WITHDRAW_ROUTES_RESULT_GET_CLASS(obj) (G_TYPE_INSTANCE_GET_CLASS ((obj), TYPE_BGP_CONFIGURATOR_WITHDRAW_ROUTES_RESULT, BgpConfiguratorWithdrawRoutesResultClass))
+
+/* struct BgpConfiguratorResumeNotificationsArgs */
+struct _BgpConfiguratorResumeNotificationsArgs
+{ 
+  ThriftStruct parent; 
+
+  /* public */
+  gint64 fromSeq;
+  gboolean __isset_fromSeq;
+};
+typedef struct _BgpConfiguratorResumeNotificationsArgs BgpConfiguratorResumeNotificationsArgs;
+
+struct _BgpConfiguratorResumeNotificationsArgsClass
+{
+  ThriftStructClass parent;
+};
+typedef struct _BgpConfiguratorResumeNotificationsArgsClass BgpConfiguratorResumeNotificationsArgsClass;
+
+GType bgp_configurator_resume_notifications_args_get_type (void);
+#define TYPE_BGP_CONFIGURATOR_RESUME_NOTIFICATIONS_ARGS (bgp_configurator_resume_notifications_args_get_type())
+#define BGP_CONFIGURATOR_RESUME_NOTIFICATIONS_ARGS(obj) (G_TYPE_CHECK_INSTANCE_CAST ((obj), TYPE_BGP_CONFIGURATOR_RESUME_NOTIFICATIONS_ARGS, BgpConfiguratorResumeNotificationsArgs))
+#define BGP_CONFIGURATOR_RESUME_NOTIFICATIONS_ARGS_CLASS(c) (G_TYPE_CHECK_CLASS_CAST ((c), _TYPE_BGP_CONFIGURATOR_RESUME_NOTIFICATIONS_ARGS, BgpConfiguratorResumeNotificationsArgsClass))
+#define IS_BGP_CONFIGURATOR_RESUME_NOTIFICATIONS_ARGS(obj) (G_TYPE_CHECK_INSTANCE_TYPE ((obj), TYPE_BGP_CONFIGURATOR_RESUME_NOTIFICATIONS_ARGS))
+#define IS_BGP_CONFIGURATOR_RESUME_NOTIFICATIONS_ARGS_CLASS(c) (G_TYPE_CHECK_CLASS_TYPE ((c), TYPE_BGP_CONFIGURATOR_RESUME_NOTIFICATIONS_ARGS))
+#define BGP_CONFIGURATOR_RESUME_NOTIFICATIONS_ARGS_GET_CLASS(obj) (G_TYPE_INSTANCE_GET_CLASS ((obj), TYPE_BGP_CONFIGURATOR_RESUME_NOTIFICATIONS_ARGS, BgpConfiguratorResumeNotificationsArgsClass))
+
+/* struct BgpConfiguratorResumeNotificationsResult */
+struct _BgpConfiguratorResumeNotificationsResult
+{ 
+  ThriftStruct parent; 
+
+  /* public */
+  gint32 success;
+  gboolean __isset_success;
+};
+typedef struct _BgpConfiguratorResumeNotificationsResult BgpConfiguratorResumeNotificationsResult;
+
+struct _BgpConfiguratorResumeNotificationsResultClass
+{
+  ThriftStructClass parent;
+};
+typedef struct _BgpConfiguratorResumeNotificationsResultClass BgpConfiguratorResumeNotificationsResultClass;
+
+GType bgp_configurator_resume_notifications_result_get_type (void);
+#define TYPE_BGP_CONFIGURATOR_RESUME_NOTIFICATIONS_RESULT (bgp_configurator_resume_notifications_result_get_type())
+#define BGP_CONFIGURATOR_RESUME_NOTIFICATIONS_RESULT(obj) (G_TYPE_CHECK_INSTANCE_CAST ((obj), TYPE_BGP_CONFIGURATOR_RESUME_NOTIFICATIONS_RESULT, BgpConfiguratorResumeNotificationsResult))
+#define BGP_CONFIGURATOR_RESUME_NOTIFICATIONS_RESULT_CLASS(c) (G_TYPE_CHECK_CLASS_CAST ((c), _TYPE_BGP_CONFIGURATOR_RESUME_NOTIFICATIONS_RESULT, BgpConfiguratorResumeNotificationsResultClass))
+#define IS_BGP_CONFIGURATOR_RESUME_NOTIFICATIONS_RESULT(obj) (G_TYPE_CHECK_INSTANCE_TYPE ((obj), TYPE_BGP_CONFIGURATOR_RESUME_NOTIFICATIONS_RESULT))
+#define IS_BGP_CONFIGURATOR_RESUME_NOTIFICATIONS_RESULT_CLASS(c) (G_TYPE_CHECK_CLASS_TYPE ((c), TYPE_BGP_CONFIGURATOR_RESUME_NOTIFICATIONS_RESULT))
+#define BGP_CONFIGURATOR_RESUME_NOTIFICATIONS_RESULT_GET_CLASS(obj) (G_TYPE_INSTANCE_GET_CLASS ((obj), TYPE_BGP_CONFIGURATOR_RESUME_NOTIFICATIONS_RESULT, BgpConfiguratorResumeNotificationsResultClass))
+
+/* struct BgpConfiguratorApplyConfigArgs */
+struct _BgpConfiguratorApplyConfigArgs
+{ 
+  ThriftStruct parent; 
+
+  /* public */
+  ConfigSnapshot * snapshot;
+  gboolean __isset_snapshot;
+};
+typedef struct _BgpConfiguratorApplyConfigArgs BgpConfiguratorApplyConfigArgs;
+
+struct _BgpConfiguratorApplyConfigArgsClass
+{
+  ThriftStructClass parent;
+};
+typedef struct _BgpConfiguratorApplyConfigArgsClass BgpConfiguratorApplyConfigArgsClass;
+
+GType bgp_configurator_apply_config_args_get_type (void);
+#define TYPE_BGP_CONFIGURATOR_APPLY_CONFIG_ARGS (bgp_configurator_apply_config_args_get_type())
+#define BGP_CONFIGURATOR_APPLY_CONFIG_ARGS(obj) (G_TYPE_CHECK_INSTANCE_CAST ((obj), TYPE_BGP_CONFIGURATOR_APPLY_CONFIG_ARGS, BgpConfiguratorApplyConfigArgs))
+#define BGP_CONFIGURATOR_APPLY_CONFIG_ARGS_CLASS(c) (G_TYPE_CHECK_CLASS_CAST ((c), _TYPE_BGP_CONFIGURATOR_APPLY_CONFIG_ARGS, BgpConfiguratorApplyConfigArgsClass))
+#define IS_BGP_CONFIGURATOR_APPLY_CONFIG_ARGS(obj) (G_TYPE_CHECK_INSTANCE_TYPE ((obj), TYPE_BGP_CONFIGURATOR_APPLY_CONFIG_ARGS))
+#define IS_BGP_CONFIGURATOR_APPLY_CONFIG_ARGS_CLASS(c) (G_TYPE_CHECK_CLASS_TYPE ((c), TYPE_BGP_CONFIGURATOR_APPLY_CONFIG_ARGS))
+#define BGP_CONFIGURATOR_APPLY_CONFIG_ARGS_GET_CLASS(obj) (G_TYPE_INSTANCE_GET_CLASS ((obj), TYPE_BGP_CONFIGURATOR_APPLY_CONFIG_ARGS, BgpConfiguratorApplyConfigArgsClass))
+
+/* struct BgpConfiguratorApplyConfigResult */
+struct _BgpConfiguratorApplyConfigResult
+{ 
+  ThriftStruct parent; 
+
+  /* public */
+  gint32 success;
+  gboolean __isset_success;
+};
+typedef struct _BgpConfiguratorApplyConfigResult BgpConfiguratorApplyConfigResult;
+
+struct _BgpConfiguratorApplyConfigResultClass
+{
+  ThriftStructClass parent;
+};
+typedef struct _BgpConfiguratorApplyConfigResultClass BgpConfiguratorApplyConfigResultClass;
+
+GType bgp_configurator_apply_config_result_get_type (void);
+#define TYPE_BGP_CONFIGURATOR_APPLY_CONFIG_RESULT (bgp_configurator_apply_config_result_get_type())
+#define BGP_CONFIGURATOR_APPLY_CONFIG_RESULT(obj) (G_TYPE_CHECK_INSTANCE_CAST ((obj), TYPE_BGP_CONFIGURATOR_APPLY_CONFIG_RESULT, BgpConfiguratorApplyConfigResult))
+#define BGP_CONFIGURATOR_APPLY_CONFIG_RESULT_CLASS(c) (G_TYPE_CHECK_CLASS_CAST ((c), _TYPE_BGP_CONFIGURATOR_APPLY_CONFIG_RESULT, BgpConfiguratorApplyConfigResultClass))
+#define IS_BGP_CONFIGURATOR_APPLY_CONFIG_RESULT(obj) (G_TYPE_CHECK_INSTANCE_TYPE ((obj), TYPE_BGP_CONFIGURATOR_APPLY_CONFIG_RESULT))
+#define IS_BGP_CONFIGURATOR_APPLY_CONFIG_RESULT_CLASS(c) (G_TYPE_CHECK_CLASS_TYPE ((c), TYPE_BGP_CONFIGURATOR_APPLY_CONFIG_RESULT))
+#define BGP_CONFIGURATOR_APPLY_CONFIG_RESULT_GET_CLASS(obj) (G_TYPE_INSTANCE_GET_CLASS ((obj), TYPE_BGP_CONFIGURATOR_APPLY_CONFIG_RESULT, BgpConfiguratorApplyConfigResultClass))
+
 /* struct BgpUpdaterOnUpdatePushRouteArgs */
 struct _BgpUpdaterOnUpdatePushRouteArgs
 { 
@@ -1328,4 +1624,29 @@ GType bgp_updater_on_notification_send_event_args_get_type (void);
 #define IS_BGP_UPDATER_ON_NOTIFICATION_SEND_EVENT_ARGS_CLASS(c) (G_TYPE_CHECK_CLASS_TYPE ((c), TYPE_BGP_UPDATER_ON_NOTIFICATION_SEND_EVENT_ARGS))
 #define BGP_UPDATER_ON_NOTIFICATION_SEND_EVENT_ARGS_GET_CLASS(obj) (G_TYPE_INSTANCE_GET_CLASS ((obj), TYPE_BGP_UPDATER_ON_NOTIFICATION_SEND_EVENT_ARGS, BgpUpdaterOnNotificationSendEventArgsClass))
 
+/* struct BgpUpdaterOnUpdateBatchArgs */
+struct _BgpUpdaterOnUpdateBatchArgs
+{ 
+  ThriftStruct parent; 
+
+  /* public */
+  GPtrArray * updates;
+  gboolean __isset_updates;
+};
+typedef struct _BgpUpdaterOnUpdateBatchArgs BgpUpdaterOnUpdateBatchArgs;
+
+struct _BgpUpdaterOnUpdateBatchArgsClass
+{
+  ThriftStructClass parent;
+};
+typedef struct _BgpUpdaterOnUpdateBatchArgsClass BgpUpdaterOnUpdateBatchArgsClass;
+
+GType bgp_updater_on_update_batch_args_get_type (void);
+#define TYPE_BGP_UPDATER_ON_UPDATE_BATCH_ARGS (bgp_updater_on_update_batch_args_get_type())
+#define BGP_UPDATER_ON_UPDATE_BATCH_ARGS(obj) (G_TYPE_CHECK_INSTANCE_CAST ((obj), TYPE_BGP_UPDATER_ON_UPDATE_BATCH_ARGS, BgpUpdaterOnUpdateBatchArgs))
+#define BGP_UPDATER_ON_UPDATE_BATCH_ARGS_CLASS(c) (G_TYPE_CHECK_CLASS_CAST ((c), _TYPE_BGP_UPDATER_ON_UPDATE_BATCH_ARGS, BgpUpdaterOnUpdateBatchArgsClass))
+#define IS_BGP_UPDATER_ON_UPDATE_BATCH_ARGS(obj) (G_TYPE_CHECK_INSTANCE_TYPE ((obj), TYPE_BGP_UPDATER_ON_UPDATE_BATCH_ARGS))
+#define IS_BGP_UPDATER_ON_UPDATE_BATCH_ARGS_CLASS(c) (G_TYPE_CHECK_CLASS_TYPE ((c), TYPE_BGP_UPDATER_ON_UPDATE_BATCH_ARGS))
+#define BGP_UPDATER_ON_UPDATE_BATCH_ARGS_GET_CLASS(obj) (G_TYPE_INSTANCE_GET_CLASS ((obj), TYPE_BGP_UPDATER_ON_UPDATE_BATCH_ARGS, BgpUpdaterOnUpdateBatchArgsClass))
+
 #endif /* VPNSERVICE_TYPES_H */
@@ -0,0 +1,244 @@
+/* zrpc benchmarks
+ * Copyright (c) 2016 6WIND,
+ *
+ * This file is part of ZRPC daemon.
+ *
+ * See the LICENSE file.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "zrpcd/zrpc_memory.h"
+#include "zrpcd/zrpc_thrift_wrapper.h"
+#include "zrpcd/bgp_configurator.h"
+#include "zrpcd/bgp_updater.h"
+#include "zrpcd/zrpc_bgp_configurator.h"
+#include "zrpcd/zrpc_vpnservice.h"
+#include "zrpcd/zrpc_util.h"
+
+/* encoding paths measured by protocol benchmark */
+#define ZRPC_BENCH_GET_ROUTES  0
+#define ZRPC_BENCH_PUSH_ROUTE  1
+
+/* encode nb_routes routes with protocol, either as a getRoutes reply
+ * or as onUpdatePushRoute messages. encoded size, and time spent
+ * building and encoding messages are returned */
+static void zrpc_bench_protocol (int protocol, int path, uint32_t nb_routes,
+                                 uint64_t *bytes, uint64_t *usecs)
+{
+  char rd[ZRPC_UTIL_RDRT_LEN], prefix[INET_ADDRSTRLEN], nexthop[INET_ADDRSTRLEN];
+  ThriftMemoryBuffer *buffer;
+  ThriftProtocol *proto;
+  BgpUpdaterIf *client = NULL;
+  Routes *routes = NULL;
+  Update *upd;
+  struct timespec start, end;
+  struct in_addr addr;
+  GError *error = NULL;
+  uint32_t i;
+
+  *bytes = 0;
+  buffer = g_object_new (THRIFT_TYPE_MEMORY_BUFFER,
+                         "buf_size", ZRPC_NOTIF_FRAME_MAX_SIZE,
+                         NULL);
+  proto = zrpc_vpnservice_protocol_new (protocol, buffer);
+  if (path == ZRPC_BENCH_PUSH_ROUTE)
+    client = g_object_new (TYPE_BGP_UPDATER_CLIENT,
+                           "input_protocol",  proto,
+                           "output_protocol", proto,
+                           NULL);
+  else
+    routes = g_object_new (TYPE_ROUTES, NULL);
+  clock_gettime (CLOCK_MONOTONIC, &start);
+  for (i = 0; i < nb_routes; i++)
+    {
+      /* /24 prefixes, 1000 per VRF, with a few nexthops */
+      snprintf (rd, sizeof (rd), "100:%u", i / 1000);
+      addr.s_addr = htonl (0x0a000000 | ((i & 0xffff) << 8));
+      inet_ntop (AF_INET, &addr, prefix, sizeof (prefix));
+      addr.s_addr = htonl (0xc0a80001 + (i & 0xf));
+      inet_ntop (AF_INET, &addr, nexthop, sizeof (nexthop));
+      if (client)
+        {
+          bgp_updater_client_send_on_update_push_route (client, rd, prefix, 24,
+                                                        nexthop, 16 + i, &error);
+          *bytes += buffer->buf->len;
+          g_byte_array_set_size (buffer->buf, 0);
+          continue;
+        }
+      upd = g_object_new (TYPE_UPDATE, NULL);
+      upd->type = BGP_RT_ADD;
+      upd->prefixlen = 24;
+      upd->label = 16 + i;
+      upd->rd = g_strdup (rd);
+      upd->prefix = g_strdup (prefix);
+      upd->nexthop = g_strdup (nexthop);
+      g_ptr_array_add (routes->updates, upd);
+    }
+  if (routes)
+    {
+      thrift_struct_write (THRIFT_STRUCT (routes), proto, &error);
+      *bytes = buffer->buf->len;
+    }
+  clock_gettime (CLOCK_MONOTONIC, &end);
+  *usecs = (uint64_t)(end.tv_sec - start.tv_sec) * 1000000 +
+    (end.tv_nsec - start.tv_nsec) / 1000;
+  if (error)
+    g_error_free (error);
+  if (routes)
+    g_object_unref (routes);
+  if (client)
+    g_object_unref (client);
+  g_object_unref (proto);
+  g_object_unref (buffer);
+}
+
+/* vrf cache as it was before the hash table: a linked list walked
+ * with rd comparisons. only kept to compare with the table */
+struct zrpc_bench_vrf
+{
+  struct zrpc_rd_prefix outbound_rd;
+  struct zrpc_bench_vrf *next;
+};
+
+static uint64_t zrpc_bench_nsecs (struct timespec *start)
+{
+  struct timespec end;
+
+  clock_gettime (CLOCK_MONOTONIC, &end);
+  return (uint64_t)(end.tv_sec - start->tv_sec) * 1000000000 +
+    end.tv_nsec - start->tv_nsec;
+}
+
+/* look up nb_lookups route distinguishers among nb_vrfs ones, in vrf
+ * cache table and in a linked list. time per lookup is returned */
+static void zrpc_bench_vrf_cache (uint32_t nb_vrfs, uint32_t nb_lookups,
+                                  uint64_t *table_ns, uint64_t *list_ns)
+{
+  struct zrpc_vpnservice *setup;
+  struct zrpc_bench_vrf *list = NULL, *node, *node_next;
+  struct zrpc_rd_prefix *rds;
+  struct timespec start;
+  char buf[ZRPC_UTIL_RDRT_LEN];
+  uint32_t i, found = 0;
+
+  setup = ZRPC_CALLOC (sizeof (struct zrpc_vpnservice));
+  rds = ZRPC_CALLOC (nb_vrfs * sizeof (struct zrpc_rd_prefix));
+  for (i = 0; i < nb_vrfs; i++)
+    {
+      snprintf (buf, sizeof (buf), "100:%u", i);
+      zrpc_util_str2rd_prefix (buf, &rds[i]);
+      zrpc_vpnservice_vrf_add (setup, &rds[i], i + 1);
+      node = ZRPC_CALLOC (sizeof (struct zrpc_bench_vrf));
+      node->outbound_rd = rds[i];
+      node->next = list;
+      list = node;
+    }
+  /* same pseudo random sequence of hits for both */
+  clock_gettime (CLOCK_MONOTONIC, &start);
+  for (i = 0; i < nb_lookups; i++)
+    if (zrpc_vpnservice_vrf_lookup (setup, &rds[(i * 2654435761U) % nb_vrfs]))
+      found++;
+  *table_ns = zrpc_bench_nsecs (&start) / nb_lookups;
+  clock_gettime (CLOCK_MONOTONIC, &start);
+  for (i = 0; i < nb_lookups; i++)
+    for (node = list; node; node = node->next)
+      if (zrpc_util_rd_prefix_cmp (&node->outbound_rd,
+                                   &rds[(i * 2654435761U) % nb_vrfs]) == 0)
+        {
+          found++;
+          break;
+        }
+  *list_ns = zrpc_bench_nsecs (&start) / nb_lookups;
+  if (found != 2 * nb_lookups)
+    fprintf (stderr, "vrf cache benchmark: %u lookups out of %u failed\n",
+             2 * nb_lookups - found, 2 * nb_lookups);
+  for (node = list; node; node = node_next)
+    {
+      node_next = node->next;
+      ZRPC_FREE (node);
+    }
+  for (i = 0; i < nb_vrfs; i++)
+    zrpc_vpnservice_vrf_del (setup, &rds[i]);
+  if (setup->bgp_vrf_table.entries)
+    ZRPC_FREE (setup->bgp_vrf_table.entries);
+  zrpc_util_index_free (&setup->bgp_vrf_table.index);
+  ZRPC_FREE (rds);
+  ZRPC_FREE (setup);
+}
+
+static void zrpc_bench_protocols (uint32_t nb_routes)
+{
+  static const char *paths[] = { "getRoutes", "onUpdatePushRoute" };
+  int protocols[] = { ZRPC_PROTOCOL_BINARY, ZRPC_PROTOCOL_COMPACT };
+  uint64_t bytes, usecs;
+  unsigned int i;
+  int path;
+
+  printf ("Protocol  Path                 Bytes/route  Routes/s\n");
+  for (i = 0; i < sizeof (protocols) / sizeof (protocols[0]); i++)
+    {
+      if (zrpc_vpnservice_protocol_get (zrpc_vpnservice_protocol_name (protocols[i])) < 0)
+        continue;
+      for (path = ZRPC_BENCH_GET_ROUTES; path <= ZRPC_BENCH_PUSH_ROUTE; path++)
+        {
+          zrpc_bench_protocol (protocols[i], path, nb_routes, &bytes, &usecs);
+          printf ("%-9s %-20s %11.1f  %llu\n",
+                  zrpc_vpnservice_protocol_name (protocols[i]), paths[path],
+                  (double)bytes / nb_routes,
+                  (unsigned long long)(usecs ? (uint64_t)nb_routes * 1000000 / usecs : 0));
+        }
+    }
+}
+
+static void zrpc_bench_vrf_caches (void)
+{
+  static const uint32_t sizes[] = { 10, 1000, 100000 };
+  uint64_t table_ns, list_ns;
+  unsigned int i;
+
+  printf ("VRFs      Table(ns/lookup)  List(ns/lookup)\n");
+  for (i = 0; i < sizeof (sizes) / sizeof (sizes[0]); i++)
+    {
+      zrpc_bench_vrf_cache (sizes[i], 1000, &table_ns, &list_ns);
+      printf ("%-9u %16llu %16llu\n", sizes[i],
+              (unsigned long long)table_ns, (unsigned long long)list_ns);
+    }
+}
+
+static void usage (const char *progname)
+{
+  fprintf (stderr, "usage: %s [protocol [<1-100000>] | vrf-cache]\n", progname);
+  exit (1);
+}
+
+/* run benchmarks outside of the daemon, as they stall the thread
+ * they run on */
+int main (int argc, char **argv)
+{
+  uint32_t nb_routes = 10000;
+
+#if (!GLIB_CHECK_VERSION (2, 36, 0))
+  g_type_init ();
+#endif
+  if (argc > 3)
+    usage (argv[0]);
+  if (argc > 1 && strcmp (argv[1], "protocol") && strcmp (argv[1], "vrf-cache"))
+    usage (argv[0]);
+  if (argc > 2)
+    {
+      if (strcmp (argv[1], "protocol"))
+        usage (argv[0]);
+      nb_routes = strtoul (argv[2], NULL, 10);
+      if (nb_routes < 1 || nb_routes > 100000)
+        usage (argv[0]);
+    }
+  if (argc == 1 || strcmp (argv[1], "protocol") == 0)
+    zrpc_bench_protocols (nb_routes);
+  if (argc == 1 || strcmp (argv[1], "vrf-cache") == 0)
+    zrpc_bench_vrf_caches ();
+  return 0;
+}
@@ -480,6 +480,28 @@ capn_ptr qcapn_new_VRFTableIter(struct capn_segment *s)
     return capn_new_struct(s, 0, 1);
 }
 
+capn_ptr qcapn_new_VRFTableBulkKey(struct capn_segment *s)
+{
+    return capn_new_struct(s, 16, 0);
+}
+
+void qcapn_VRFTableBulkKey_write(address_family_t afi, uint32_t max_count,
+                                 uint32_t max_bytes, capn_ptr p)
+{
+    capn_resolve(&p);
+    capn_write8(p, 0, afi);
+    capn_write32(p, 4, max_count);
+    capn_write32(p, 8, max_bytes);
+}
+
+/* return the list of BGPVRFRoute structures. entries are
+ * accessed with capn_getp(list, idx, 1), count is list.len */
+capn_ptr qcapn_BGPVRFRouteList_get(capn_ptr p)
+{
+    capn_resolve(&p);
+    return capn_getp(p, 0, 1);
+}
+
 void qcapn_BGPEventVRFRoute_read(struct bgp_event_vrf *s, capn_ptr p)
 {
     uint64_t tmp;
@@ -213,6 +213,11 @@ capn_ptr qcapn_new_BGPVRFRoute(struct capn_segment *s, uint8_t extend_by);
 void qcapn_BGPVRFRoute_read(struct bgp_api_route *s, capn_ptr p);
 void qcapn_BGPVRFRoute_write(const struct bgp_api_route *s, capn_ptr p);
 
+capn_ptr qcapn_new_VRFTableBulkKey(struct capn_segment *s);
+void qcapn_VRFTableBulkKey_write(address_family_t afi, uint32_t max_count,
+                                 uint32_t max_bytes, capn_ptr p);
+capn_ptr qcapn_BGPVRFRouteList_get(capn_ptr p);
+
 void qcapn_BGPEventShut_read(struct bgp_event_shut *s, capn_ptr p);
 
 capn_ptr qcapn_new_BGPPeer(struct capn_segment *s);
@@ -6,6 +6,7 @@
  * See the LICENSE file.
  */
 #include <stdio.h>
+#include <stdlib.h>
 
 #include "zrpcd/zrpc_thrift_wrapper.h"
 #include "zrpcd/zrpc_global.h"
@@ -14,6 +15,7 @@
 #include "zrpcd/bgp_configurator.h"
 #include "zrpcd/zrpc_bgp_configurator.h"
 #include "zrpcd/zrpc_vpnservice.h"
+#include "zrpcd/zrpc_stats.h"
 #include "zrpcd/zrpc_debug.h"
 #include "zrpcd/zrpc_bgp_capnp.h"
 #include "zrpcd/zrpc_util.h"
@@ -98,6 +100,15 @@ instance_bgp_configurator_handler_disable_multipath(BgpConfiguratorIf *iface, gi
 gboolean
 instance_bgp_configurator_handler_multipaths(BgpConfiguratorIf *iface, gint32* _return,
                                              const gchar * rd, const gint32 maxPath, GError **error);
+gboolean
+instance_bgp_configurator_handler_push_routes(BgpConfiguratorIf *iface, GArray ** _return,
+                                              const GPtrArray * routes, GError **error);
+gboolean
+instance_bgp_configurator_handler_withdraw_routes(BgpConfiguratorIf *iface, GArray ** _return,
+                                                  const GPtrArray * routes, GError **error);
+gboolean
+instance_bgp_configurator_handler_resume_notifications(BgpConfiguratorIf *iface, gint32* _return,
+                                                       const gint64 fromSeq, GError **error);
 static void instance_bgp_configurator_handler_finalize(GObject *object);
 
 /*
@@ -189,6 +200,9 @@ uint64_t bgp_ctxttype_afisafi_set_bgp_vrf_3= 0xac25a73c3ff455c0;
 uint64_t bgp_ctxtype_bgpvrfroute = 0xac25a73c3ff455c0;
 /* functions using this node identifier : get_bgp_vrf_2, get_bgp_vrf_3 */
 uint64_t bgp_itertype_bgpvrfroute = 0xeb8ab4f58b7753ee;
+/* handling bulk getRoutes - functions using this node identifier : get_bgp_vrf_5 */
+uint64_t bgp_ctxtype_bgpvrfroute_bulk = 0xd4396263f2608902;
+uint64_t bgp_datatype_bgpvrfroute_bulk = 0xb2edb71ffea5d916;
 
 static const char* af_flag_str[] = {
   "SendCommunity",
@@ -227,54 +241,54 @@ zrpc_af_flag2str(guint32 af_flag)
 
 /*
  * lookup routine that searches for a matching vrf
- * it searches first in the zrpc cache, then if not found,
- * it searches in BGP a vrf context.
- * It returns the capnp node identifier related to peer context,
+ * it searches in the zrpc cache, indexed by route distinguisher.
+ * It returns the capnp node identifier related to vrf context,
  * 0 otherwise.
  */
 static uint64_t
 zrpc_bgp_configurator_find_vrf(struct zrpc_vpnservice *ctxt, struct zrpc_rd_prefix *rd, gint32* _return)
 {
-  struct zrpc_vpnservice_cache_bgpvrf *entry_bgpvrf, *entry_bgpvrf_next;
+  struct zrpc_vpnservice_cache_bgpvrf *entry_bgpvrf;
 
-  /* lookup in cache context, first */
-  for (entry_bgpvrf = ctxt->bgp_vrf_list; entry_bgpvrf; entry_bgpvrf = entry_bgpvrf_next)
-    {
-      entry_bgpvrf_next = entry_bgpvrf->next;
-      if(0 == zrpc_util_rd_prefix_cmp(&(entry_bgpvrf->outbound_rd), rd))
-        {
-          if(IS_ZRPC_DEBUG_CACHE)
-            zrpc_log ("CACHE_VRF: match lookup entry %llx", (long long unsigned int)entry_bgpvrf->bgpvrf_nid);
-          return entry_bgpvrf->bgpvrf_nid; /* match */
-        }
-    }
-  return 0;
+  entry_bgpvrf = zrpc_vpnservice_vrf_lookup(ctxt, rd);
+  if(entry_bgpvrf == NULL)
+    return 0;
+  if(IS_ZRPC_DEBUG_CACHE)
+    zrpc_log ("CACHE_VRF: match lookup entry %llx", (long long unsigned int)entry_bgpvrf->bgpvrf_nid);
+  return entry_bgpvrf->bgpvrf_nid; /* match */
 }
 
 /*
  * lookup routine that searches for a matching peer
- * it searches first in the zrpc cache, then if not found,
- * it searches in BGP a peer context.
+ * it searches in the zrpc cache, indexed by peer address.
  * It returns the capnp node identifier related to peer context,
  * 0 otherwise.
  */
 static uint64_t
 zrpc_bgp_configurator_find_peer(struct zrpc_vpnservice *ctxt, const gchar *peerIp, gint32* _return)
 {
-  struct zrpc_vpnservice_cache_peer *entry_bgppeer, *entry_bgppeer_next;
+  struct zrpc_vpnservice_cache_peer *entry_bgppeer;
+  struct zrpc_vpnservice_peer_key key;
+
+  if(!zrpc_vpnservice_peer_key_set(&key, peerIp))
+    return 0;
+  entry_bgppeer = zrpc_vpnservice_peer_lookup(ctxt, &key);
+  if(entry_bgppeer == NULL)
+    return 0;
+  if(IS_ZRPC_DEBUG_CACHE)
+    zrpc_log ("CACHE_PEER : match lookup entry %s", peerIp);
+  return entry_bgppeer->peer_nid; /* match */
+}
 
-  /* lookup in cache context, first */
-  for (entry_bgppeer = ctxt->bgp_peer_list; entry_bgppeer; entry_bgppeer = entry_bgppeer_next)
-    {
-      entry_bgppeer_next = entry_bgppeer->next;
-      if(0 == strcmp(entry_bgppeer->peerIp, peerIp))
-        {
-          if(IS_ZRPC_DEBUG_CACHE)
-            zrpc_log ("CACHE_PEER : match lookup entry %s", entry_bgppeer->peerIp);
-          return entry_bgppeer->peer_nid; /* match */
-        }
-    }
-  return 0;
+/* peer cache entry, to record attributes set through zrpcd */
+static struct zrpc_vpnservice_cache_peer *
+zrpc_bgp_configurator_peer_entry(struct zrpc_vpnservice *ctxt, const gchar *peerIp)
+{
+  struct zrpc_vpnservice_peer_key key;
+
+  if(!zrpc_vpnservice_peer_key_set(&key, peerIp))
+    return NULL;
+  return zrpc_vpnservice_peer_lookup(ctxt, &key);
 }
 
 /* enable/disable address family bgp neighbor, using capnp */
@@ -290,6 +304,7 @@ zrpc_bgp_afi_config(struct zrpc_vpnservice *ctxt,  gint32* _return, const gchar
   int af, saf;
   int ret;
   struct QZCGetRep *grep_peer;
+  struct zrpc_vpnservice_cache_peer *entry;
 
   if(zrpc_vpnservice_get_bgp_context(ctxt) == NULL || zrpc_vpnservice_get_bgp_context(ctxt)->asNumber == 0)
     {
@@ -368,6 +383,9 @@ zrpc_bgp_afi_config(struct zrpc_vpnservice *ctxt,  gint32* _return, const gchar
       else
         zrpc_log ("disableAddressFamily( %s, afi %d, safi %d) OK", peerIp, afi, safi);
     }
+  entry = zrpc_bgp_configurator_peer_entry(ctxt, peerIp);
+  if(entry)
+    entry->vpnv4 = (TRUE == value);
   *_return = 0;
   capn_free(&rc);
   return TRUE;
@@ -489,6 +507,7 @@ zrpc_bgp_set_multihops(struct zrpc_vpnservice *ctxt,  gint32* _return, const gch
   capn_ptr peer_ctxt;
   struct peer peer;
   struct QZCGetRep *grep_peer;
+  struct zrpc_vpnservice_cache_peer *entry;
 
   memset (&peer, 0, sizeof (struct peer));
   if(zrpc_vpnservice_get_bgp_context(ctxt) == NULL || zrpc_vpnservice_get_bgp_context(ctxt)->asNumber == 0)
@@ -530,6 +549,9 @@ zrpc_bgp_set_multihops(struct zrpc_vpnservice *ctxt,  gint32* _return, const gch
                         2, &peer_ctxt, &bgp_datatype_create_bgp_2, \
                         NULL, NULL))
     {
+      entry = zrpc_bgp_configurator_peer_entry(ctxt, peerIp);
+      if(entry)
+        entry->multihop = nHops;
       if(IS_ZRPC_DEBUG)
         {
           if(nHops == 0)
@@ -623,12 +645,16 @@ instance_bgp_configurator_handler_start_bgp(BgpConfiguratorIf *iface, gint32* _r
   zrpc_vpnservice_get_bgp_context(ctxt)->proc = pid;
   /* creation of capnproto context - bgp configurator */
   /* creation of qzc client context */
-  ctxt->qzc_sock = qzcclient_connect(s_zmq_sock);
+  /* requests are completed by their caller. those of worker threads
+   * and of set batches are pipelined up to the window */
+  ctxt->qzc_sock = qzcclient_connect_window(s_zmq_sock, tm->qzc_window);
   if(ctxt->qzc_sock == NULL)
     {
       *_return = BGP_ERR_FAILED;
       return FALSE;
     }
+  /* bulk route iteration support will be probed on next getRoutes */
+  ctxt->bgp_get_routes_bulk = 0;
   /* send ping msg. wait for pong */
   rep = qzcclient_do(ctxt->qzc_sock, NULL);
   if( rep == NULL || rep->which != QZCReply_pong)
@@ -758,6 +784,28 @@ instance_bgp_configurator_handler_unset_ebgp_multihop(BgpConfiguratorIf *iface,
   return zrpc_bgp_set_multihops(ctxt, _return, peerIp, 0, error);
 }
 
+/* keep the mirror RIB of a vrf in line with a route pushed or
+ * withdrawn through zrpcd */
+static void
+zrpc_bgp_configurator_rib_update (struct zrpc_rib *rib, struct bgp_api_route *inst,
+                                  gboolean withdraw)
+{
+  struct in_addr any;
+
+  if (rib == NULL)
+    return;
+  if (!withdraw)
+    {
+      zrpc_rib_add (rib, &inst->prefix, inst->nexthop, inst->label, ZRPC_RIB_PATH_LOCAL);
+      return;
+    }
+  any.s_addr = 0;
+  /* path not known as pushed by zrpcd, as pushed before a restart:
+   * bgpd withdraws the prefix, whatever its nexthop */
+  if (zrpc_rib_del (rib, &inst->prefix, any, ZRPC_RIB_PATH_LOCAL) == 0)
+    zrpc_rib_del (rib, &inst->prefix, any, 0);
+}
+
 /*
  * Push Route for a given Route Distinguisher.
  * This route contains an IPv4 prefix, as well as an IPv4 nexthop.
@@ -779,6 +827,7 @@ instance_bgp_configurator_handler_push_route(BgpConfiguratorIf *iface, gint32* _
   struct capn_ptr afikey;
   struct capn rc;
   struct capn_segment *cs;
+  struct zrpc_vpnservice_cache_bgpvrf *entry;
   int ret;
 
   zrpc_vpnservice_get_context (&ctxt);
@@ -809,6 +858,16 @@ instance_bgp_configurator_handler_push_route(BgpConfiguratorIf *iface, gint32* _
   inst.label = label;
   inet_aton (nexthop, &inst.nexthop);
   zrpc_util_str2ipv4_prefix(prefix,&inst.prefix);
+  /* same route pushed again, as on controller reconciliation */
+  entry = zrpc_vpnservice_vrf_lookup (ctxt, &rd_inst);
+  if (entry && zrpc_vpnservice_pushed_lookup (entry, &inst.prefix, inst.nexthop, inst.label))
+    {
+      if(IS_ZRPC_DEBUG_CACHE)
+        zrpc_log ("pushRoute(prefix %s, nexthop %s, rd %s, label %d) already pushed",
+                  prefix, nexthop, rd, label);
+      *_return = 0;
+      return TRUE;
+    }
   capn_init_malloc(&rc);
   cs = capn_root(&rc).seg;
   bgpvrfroute = qcapn_new_BGPVRFRoute(cs, 0);
@@ -821,11 +880,21 @@ instance_bgp_configurator_handler_push_route(BgpConfiguratorIf *iface, gint32* _
                            3, &bgpvrfroute, &bgp_datatype_bgpvrfroute,  \
                            &afikey, &bgp_ctxttype_afisafi_set_bgp_vrf_3);
   if(ret == 0)
-    *_return = BGP_ERR_FAILED;
+    {
+      *_return = BGP_ERR_FAILED;
+      /* route state in bgpd is not known anymore */
+      if (entry)
+        zrpc_vpnservice_pushed_del (entry, &inst.prefix);
+    }
   else
     {
       if(IS_ZRPC_DEBUG)
         zrpc_log ("pushRoute(prefix %s, nexthop %s, rd %s, label %d) OK", prefix, nexthop, rd, label);
+      if (entry)
+        {
+          zrpc_bgp_configurator_rib_update (entry->rib, &inst, FALSE);
+          zrpc_vpnservice_pushed_add (entry, &inst.prefix, inst.nexthop, inst.label);
+        }
     }
   capn_free(&rc);
   return ret;
@@ -849,6 +918,7 @@ instance_bgp_configurator_handler_withdraw_route(BgpConfiguratorIf *iface, gint3
   struct capn_ptr afikey;
   struct capn rc;
   struct capn_segment *cs;
+  struct zrpc_vpnservice_cache_bgpvrf *entry;
   int ret;
 
   zrpc_vpnservice_get_context (&ctxt);
@@ -876,6 +946,10 @@ instance_bgp_configurator_handler_withdraw_route(BgpConfiguratorIf *iface, gint3
   /* prepare route entry for AFI=IP */
   memset(&inst, 0, sizeof(struct bgp_api_route));
   zrpc_util_str2ipv4_prefix(prefix,&inst.prefix);
+  /* route is not known as pushed anymore, whatever bgpd answers */
+  entry = zrpc_vpnservice_vrf_lookup (ctxt, &rd_inst);
+  if (entry)
+    zrpc_vpnservice_pushed_del (entry, &inst.prefix);
   capn_init_malloc(&rc);
   cs = capn_root(&rc).seg;
   bgpvrfroute = qcapn_new_BGPVRFRoute(cs, 0);
@@ -893,11 +967,201 @@ instance_bgp_configurator_handler_withdraw_route(BgpConfiguratorIf *iface, gint3
     {
       if(IS_ZRPC_DEBUG)
         zrpc_log ("withdrawRoute(prefix %s, rd %s) OK", prefix, rd);
+      if (entry)
+        zrpc_bgp_configurator_rib_update (entry->rib, &inst, TRUE);
     }
   capn_free(&rc);
   return ret;
 }
 
+/*
+ * Push or Withdraw a batch of routes.
+ * Each entry is handled as with pushRoute() or withdrawRoute(),
+ * but all route entries are encoded in a single capnp context,
+ * VRF lookup is done once per consecutive route distinguisher,
+ * and QZC requests are sent back to back.
+ * One error code per entry is appended to _return, in the same
+ * order as the input list.
+ */
+static gboolean
+zrpc_bgp_configurator_routes_batch(GArray *_return, const GPtrArray * routes,
+                                   gboolean withdraw, GError **error)
+{
+  struct zrpc_vpnservice *ctxt = NULL;
+  struct qzcclient_setelem_entry *entries;
+  struct zrpc_vpnservice_cache_bgpvrf *vrf = NULL;
+  struct bgp_api_route inst, *insts;
+  struct zrpc_vpnservice_cache_bgpvrf **vrfs;
+  struct zrpc_rd_prefix rd_inst;
+  const gchar *prev_rd = NULL;
+  uint64_t bgpvrf_nid = 0;
+  address_family_t afi = ADDRESS_FAMILY_IP;
+  struct capn_ptr afikey;
+  struct capn rc;
+  struct capn_segment *cs;
+  gint32 *codes;
+  gint32 code, dummy;
+  guint *route_idx;
+  guint i, nb_entries = 0, nb_ok = 0, nb_pushed = 0;
+  Update *upd;
+
+  zrpc_vpnservice_get_context (&ctxt);
+  if(!ctxt)
+    return FALSE;
+  if(zrpc_vpnservice_get_bgp_context(ctxt) == NULL || zrpc_vpnservice_get_bgp_context(ctxt)->asNumber == 0)
+    {
+      *error = ERROR_BGP_AS_NOT_STARTED;
+      return FALSE;
+    }
+  if(routes == NULL || routes->len == 0)
+    return TRUE;
+  codes = ZRPC_CALLOC(routes->len * sizeof(gint32));
+  entries = ZRPC_CALLOC(routes->len * sizeof(struct qzcclient_setelem_entry));
+  /* route_idx[n] is the input entry that request n stands for */
+  route_idx = ZRPC_CALLOC(routes->len * sizeof(guint));
+  /* routes and VRFs, to apply successful requests */
+  insts = ZRPC_CALLOC(routes->len * sizeof(struct bgp_api_route));
+  vrfs = ZRPC_CALLOC(routes->len * sizeof(struct zrpc_vpnservice_cache_bgpvrf *));
+  capn_init_malloc(&rc);
+  cs = capn_root(&rc).seg;
+  for (i = 0; i < routes->len; i++)
+    {
+      upd = (Update *)g_ptr_array_index(routes, i);
+      if(upd == NULL || upd->rd == NULL || upd->prefix == NULL ||
+         (!withdraw && upd->nexthop == NULL))
+        {
+          codes[i] = BGP_ERR_PARAM;
+          continue;
+        }
+      /* resolve vrf, only when route distinguisher changes */
+      if(prev_rd == NULL || strcmp(prev_rd, upd->rd))
+        {
+          memset(&rd_inst, 0, sizeof(struct zrpc_rd_prefix));
+          if(zrpc_util_str2rd_prefix((char *)upd->rd, &rd_inst) == 0)
+            bgpvrf_nid = 0;
+          else
+            bgpvrf_nid = zrpc_bgp_configurator_find_vrf(ctxt, &rd_inst, &dummy);
+          vrf = bgpvrf_nid ? zrpc_vpnservice_vrf_lookup(ctxt, &rd_inst) : NULL;
+          prev_rd = upd->rd;
+        }
+      if(bgpvrf_nid == 0)
+        {
+          codes[i] = BGP_ERR_PARAM;
+          continue;
+        }
+      /* prepare route entry for AFI=IP */
+      memset(&inst, 0, sizeof(struct bgp_api_route));
+      if(zrpc_util_str2ipv4_prefix(upd->prefix, &inst.prefix) == 0)
+        {
+          codes[i] = BGP_ERR_PARAM;
+          continue;
+        }
+      if(!withdraw)
+        {
+          inst.label = upd->label;
+          inet_aton (upd->nexthop, &inst.nexthop);
+          /* same route pushed again: nothing to ask bgpd */
+          if(vrf && zrpc_vpnservice_pushed_lookup (vrf, &inst.prefix, inst.nexthop, inst.label))
+            {
+              codes[i] = 0;
+              nb_pushed++;
+              continue;
+            }
+        }
+      /* route is not known as pushed until bgpd answers */
+      if(vrf)
+        zrpc_vpnservice_pushed_del (vrf, &inst.prefix);
+      entries[nb_entries].nid = bgpvrf_nid;
+      entries[nb_entries].data = qcapn_new_BGPVRFRoute(cs, 0);
+      qcapn_BGPVRFRoute_write(&inst, entries[nb_entries].data);
+      route_idx[nb_entries] = i;
+      insts[nb_entries] = inst;
+      vrfs[nb_entries] = vrf;
+      nb_entries++;
+    }
+  /* prepare afi context, shared by all requests */
+  afikey = qcapn_new_AfiKey(cs);
+  capn_write8(afikey, 0, afi);
+  if(nb_entries)
+    {
+      nb_ok = qzcclient_setelem_batch (ctxt->qzc_sock, withdraw, 3,
+                                       entries, nb_entries,
+                                       &bgp_datatype_bgpvrfroute,
+                                       &afikey, &bgp_ctxttype_afisafi_set_bgp_vrf_3);
+      for (i = 0; i < nb_entries; i++)
+        {
+          codes[route_idx[i]] = entries[i].ret ? 0 : BGP_ERR_FAILED;
+          if(entries[i].ret == 0 || vrfs[i] == NULL)
+            continue;
+          zrpc_bgp_configurator_rib_update (vrfs[i]->rib, &insts[i], withdraw);
+          if(!withdraw)
+            zrpc_vpnservice_pushed_add (vrfs[i], &insts[i].prefix,
+                                        insts[i].nexthop, insts[i].label);
+        }
+    }
+  for (i = 0; i < routes->len; i++)
+    {
+      code = codes[i];
+      g_array_append_val(_return, code);
+    }
+  if(IS_ZRPC_DEBUG)
+    zrpc_log ("%s(%u routes) %u OK, %u already pushed",
+              withdraw ? "withdrawRoutes" : "pushRoutes",
+              routes->len, nb_ok, nb_pushed);
+  capn_free(&rc);
+  ZRPC_FREE(vrfs);
+  ZRPC_FREE(insts);
+  ZRPC_FREE(route_idx);
+  ZRPC_FREE(entries);
+  ZRPC_FREE(codes);
+  return TRUE;
+}
+
+/*
+ * Push a list of routes, each one for a given Route Distinguisher.
+ * The result list holds one error code per route.
+ */
+gboolean
+instance_bgp_configurator_handler_push_routes(BgpConfiguratorIf *iface, GArray ** _return,
+                                              const GPtrArray * routes, GError **error)
+{
+  return zrpc_bgp_configurator_routes_batch(*_return, routes, FALSE, error);
+}
+
+/*
+ * Withdraw a list of routes, each one for a given Route Distinguisher.
+ * The result list holds one error code per route.
+ */
+gboolean
+instance_bgp_configurator_handler_withdraw_routes(BgpConfiguratorIf *iface, GArray ** _return,
+                                                  const GPtrArray * routes, GError **error)
+{
+  return zrpc_bgp_configurator_routes_batch(*_return, routes, TRUE, error);
+}
+
+/*
+ * Send again route notifications starting at a given sequence number.
+ * BGP_ERR_RESYNC is returned if they are not all retained anymore.
+ */
+gboolean
+instance_bgp_configurator_handler_resume_notifications(BgpConfiguratorIf *iface, gint32* _return,
+                                                       const gint64 fromSeq, GError **error)
+{
+  struct zrpc_vpnservice *ctxt = NULL;
+
+  zrpc_vpnservice_get_context (&ctxt);
+  if(!ctxt || fromSeq < 0)
+    {
+      *_return = BGP_ERR_PARAM;
+      return TRUE;
+    }
+  *_return = zrpc_vpnservice_notif_resume (ctxt, (uint64_t)fromSeq);
+  if(IS_ZRPC_DEBUG)
+    zrpc_log ("resumeNotifications(%lld) %s", (long long)fromSeq,
+              *_return == 0 ? "OK" : "NOK");
+  return TRUE;
+}
+
 /* 
  * Stop BGP Router for a given AS Number
  * If BGP is already stopped, or give AS is not present, an error is returned
@@ -959,7 +1223,7 @@ instance_bgp_configurator_handler_create_peer(BgpConfiguratorIf *iface, gint32*
   struct capn_ptr bgppeer;
   struct capn rc;
   struct capn_segment *cs;
-  struct zrpc_vpnservice_cache_peer *entry;
+  struct zrpc_vpnservice_peer_key key;
   uint64_t peer_nid;
   gboolean ret = FALSE;
 
@@ -975,7 +1239,7 @@ instance_bgp_configurator_handler_create_peer(BgpConfiguratorIf *iface, gint32*
       *error = ERROR_BGP_AS_NOT_STARTED;
       return FALSE;
     }
-  if(asNumber < 0)
+  if(asNumber < 0 || !zrpc_vpnservice_peer_key_set(&key, routerId))
     {
       *_return = BGP_ERR_PARAM;
       return FALSE;
@@ -1001,14 +1265,9 @@ instance_bgp_configurator_handler_create_peer(BgpConfiguratorIf *iface, gint32*
   if(IS_ZRPC_DEBUG)
     zrpc_log ("createPeer(%s,%u) OK", routerId, (uint32_t)asNumber);
   /* add peer entry in cache */
-  entry = ZRPC_CALLOC(sizeof(struct zrpc_vpnservice_cache_peer));
-  entry->peerIp = ZRPC_STRDUP(routerId);
-  entry->peer_nid = peer_nid;
-  entry->asNumber = (uint32_t )asNumber;
+  zrpc_vpnservice_peer_add(ctxt, &key, peer_nid, (uint32_t )asNumber);
   if(IS_ZRPC_DEBUG_CACHE)
     zrpc_log ("CACHE_PEER : add entry %llx", (long long unsigned int)peer_nid);
-  entry->next = ctxt->bgp_peer_list;
-  ctxt->bgp_peer_list = entry;
   /* set aficfg */
   ret = zrpc_bgp_afi_config(ctxt, _return, routerId,
                             AF_AFI_AFI_IP, AF_SAFI_SAFI_MPLS_VPN, TRUE, error);
@@ -1054,27 +1313,13 @@ instance_bgp_configurator_handler_delete_peer(BgpConfiguratorIf *iface, gint32*
   /* destroy node id */
   if( qzcclient_deletenode(ctxt->qzc_sock, &bgppeer_nid))
     {
-      struct zrpc_vpnservice_cache_peer *entry_bgppeer, *entry_bgppeer_prev, *entry_bgppeer_next;      
+      struct zrpc_vpnservice_peer_key key;
 
-      entry_bgppeer_prev = NULL;
-      for (entry_bgppeer = ctxt->bgp_peer_list; entry_bgppeer; entry_bgppeer = entry_bgppeer_next)
+      zrpc_vpnservice_peer_key_set(&key, peerIp);
+      if(zrpc_vpnservice_peer_del(ctxt, &key))
         {
-          entry_bgppeer_next = entry_bgppeer->next;
-          if(0 == strcmp(entry_bgppeer->peerIp, peerIp))
-            {
-              if(IS_ZRPC_DEBUG_CACHE)
-                zrpc_log ("CACHE_PEER: del entry %llx", (long long unsigned int)entry_bgppeer->peer_nid);
-              if (entry_bgppeer_prev)
-                entry_bgppeer_prev->next = entry_bgppeer_next;
-              else
-                ctxt->bgp_peer_list = entry_bgppeer_next;
-              ZRPC_FREE (entry_bgppeer->peerIp);
-              entry_bgppeer->peerIp = NULL;
-              ZRPC_FREE (entry_bgppeer);
-              break;
-            }
-          else
-            entry_bgppeer_prev = entry_bgppeer;
+          if(IS_ZRPC_DEBUG_CACHE)
+            zrpc_log ("CACHE_PEER: del entry %llx", (long long unsigned int)bgppeer_nid);
         }
       if(IS_ZRPC_DEBUG)
         zrpc_log ("deletePeer(%s) OK", peerIp);
@@ -1083,6 +1328,48 @@ instance_bgp_configurator_handler_delete_peer(BgpConfiguratorIf *iface, gint32*
   return FALSE;
 }
 
+static int
+zrpc_bgp_configurator_key_cmp (const void *a, const void *b)
+{
+  uint64_t key1 = *(const uint64_t *)a, key2 = *(const uint64_t *)b;
+
+  return key1 < key2 ? -1 : key1 > key2;
+}
+
+/* route targets packed in 64 bits and sorted, invalid ones skipped */
+static uint32_t
+zrpc_bgp_configurator_rts_pack (const GPtrArray *rts, uint64_t *out)
+{
+  u_char tmp[8];
+  uint32_t nb = 0;
+  unsigned int i, j;
+
+  for (i = 0; rts && i < rts->len; i++)
+    {
+      if (!zrpc_util_str2rdrt ((char *)g_ptr_array_index(rts, i), tmp, ZRPC_UTIL_RDRT_TYPE_ROUTE_TARGET))
+        continue;
+      out[nb] = 0;
+      for (j = 0; j < 8; j++)
+        out[nb] = (out[nb] << 8) | tmp[j];
+      nb++;
+    }
+  qsort (out, nb, sizeof (uint64_t), zrpc_bgp_configurator_key_cmp);
+  return nb;
+}
+
+/* import then export route targets of a vrf, as kept in vrf cache */
+static uint64_t *
+zrpc_bgp_configurator_rts_get (const GPtrArray *irts, const GPtrArray *erts,
+                               uint32_t *nb_irts, uint32_t *nb_erts)
+{
+  uint64_t *rts;
+
+  rts = ZRPC_CALLOC (((irts ? irts->len : 0) + (erts ? erts->len : 0) + 1) * sizeof (uint64_t));
+  *nb_irts = zrpc_bgp_configurator_rts_pack (irts, rts);
+  *nb_erts = zrpc_bgp_configurator_rts_pack (erts, rts + *nb_irts);
+  return rts;
+}
+
 /*
  * Add a VRF entry for a given route distinguisher
  * Optionally, imported and exported route distinguisher are given.
@@ -1101,7 +1388,6 @@ instance_bgp_configurator_handler_add_vrf(BgpConfiguratorIf *iface, gint32* _ret
   struct capn rc;
   struct capn_segment *cs;
   uint64_t bgpvrf_nid;
-  struct zrpc_vpnservice_cache_bgpvrf *entry;
   struct zrpc_rdrt *rdrt;
 
   /* setup context */
@@ -1140,14 +1426,10 @@ instance_bgp_configurator_handler_add_vrf(BgpConfiguratorIf *iface, gint32* _ret
           *_return = BGP_ERR_FAILED;
           return FALSE;
         }
-      /* add vrf entry in zrpc list */
-      entry = ZRPC_CALLOC (sizeof(struct zrpc_vpnservice_cache_bgpvrf));
-      entry->outbound_rd = instvrf.outbound_rd;
-      entry->bgpvrf_nid = bgpvrf_nid;
+      /* add vrf entry in zrpc cache */
+      zrpc_vpnservice_vrf_add(ctxt, &instvrf.outbound_rd, bgpvrf_nid);
       if(IS_ZRPC_DEBUG_CACHE)
         zrpc_log ("CACHE_VRF: add entry %llx", (long long unsigned int)bgpvrf_nid);
-      entry->next = ctxt->bgp_vrf_list;
-      ctxt->bgp_vrf_list = entry;
       if(IS_ZRPC_DEBUG)
         zrpc_log ("addVrf(%s) OK", rd);
       /* max_mpath has been set in bgpd with a default value owned by bgpd itself
@@ -1214,6 +1496,22 @@ instance_bgp_configurator_handler_add_vrf(BgpConfiguratorIf *iface, gint32* _ret
                            NULL, NULL);
   if(ret == 0)
       *_return = BGP_ERR_FAILED;
+  else
+    {
+      struct zrpc_vpnservice_cache_bgpvrf *entry;
+      struct zrpc_rd_prefix rd_inst;
+      uint32_t nb_irts, nb_erts;
+      uint64_t *rts;
+
+      memset(&rd_inst, 0, sizeof(struct zrpc_rd_prefix));
+      zrpc_util_str2rd_prefix((char *)rd, &rd_inst);
+      entry = zrpc_vpnservice_vrf_lookup(ctxt, &rd_inst);
+      if(entry)
+        {
+          rts = zrpc_bgp_configurator_rts_get (irts, erts, &nb_irts, &nb_erts);
+          zrpc_vpnservice_vrf_set_rts (entry, rts, nb_irts, nb_erts);
+        }
+    }
   if (bgpvrf_ptr->rt_import)
     zrpc_util_rdrt_free (bgpvrf_ptr->rt_import);
   if (bgpvrf_ptr->rt_export)
@@ -1258,28 +1556,15 @@ gboolean instance_bgp_configurator_handler_del_vrf(BgpConfiguratorIf *iface, gin
     }
   if( qzcclient_deletenode(ctxt->qzc_sock, &bgpvrf_nid))
     {
-      struct zrpc_vpnservice_cache_bgpvrf *entry_bgpvrf, *entry_bgpvrf_prev, *entry_bgpvrf_next;      
-
-      entry_bgpvrf_prev = NULL;
-      for (entry_bgpvrf = ctxt->bgp_vrf_list; entry_bgpvrf; entry_bgpvrf = entry_bgpvrf_next)
+      if(zrpc_vpnservice_vrf_del(ctxt, &rd_inst))
         {
-          entry_bgpvrf_next = entry_bgpvrf->next;
-          if(0 == zrpc_util_rd_prefix_cmp(&entry_bgpvrf->outbound_rd, &rd_inst))
+          if(IS_ZRPC_DEBUG_CACHE)
+            zrpc_log ("CACHE_VRF: del entry %llx", (long long unsigned int)bgpvrf_nid);
+          if(IS_ZRPC_DEBUG)
             {
-              if(IS_ZRPC_DEBUG_CACHE)
-                zrpc_log ("CACHE_VRF: del entry %llx", (long long unsigned int)entry_bgpvrf->bgpvrf_nid);
-              if (entry_bgpvrf_prev)
-                entry_bgpvrf_prev->next = entry_bgpvrf_next;
-              else
-                ctxt->bgp_vrf_list = entry_bgpvrf_next;
-              ZRPC_FREE (entry_bgpvrf);
-              if(IS_ZRPC_DEBUG)
-                {
-                  zrpc_log ("delVrf(%s) OK", rd);
-                }
-              return TRUE;
+              zrpc_log ("delVrf(%s) OK", rd);
             }
-          entry_bgpvrf_prev = entry_bgpvrf;
+          return TRUE;
         }
     }
   return FALSE;
@@ -1302,6 +1587,7 @@ instance_bgp_configurator_handler_set_update_source (BgpConfiguratorIf *iface, g
   struct peer peer;
   struct capn rc;
   struct capn_segment *cs;
+  struct zrpc_vpnservice_cache_peer *entry;
 
   zrpc_vpnservice_get_context (&ctxt);
   if(!ctxt)
@@ -1354,6 +1640,13 @@ instance_bgp_configurator_handler_set_update_source (BgpConfiguratorIf *iface, g
                         &peer_ctxt, &bgp_datatype_create_bgp_2, \
                         NULL, NULL))
     {
+      entry = zrpc_bgp_configurator_peer_entry(ctxt, peerIp);
+      if(entry)
+        {
+          memset(&entry->update_source, 0, sizeof(entry->update_source));
+          if(srcIp)
+            zrpc_vpnservice_peer_key_set(&entry->update_source, srcIp);
+        }
       if(IS_ZRPC_DEBUG)
         {
           if(srcIp == 0)
@@ -1495,262 +1788,592 @@ instance_bgp_configurator_handler_disable_graceful_restart (BgpConfiguratorIf *i
   return instance_bgp_configurator_handler_enable_graceful_restart(iface, _return, 0, error);
 }
 
-struct tbliter_v4 *prev_iter_table_ptr = NULL;
-struct tbliter_v4 prev_iter_table_entry;
-gboolean
-instance_bgp_configurator_handler_get_routes (BgpConfiguratorIf *iface, Routes ** _return,
-                                              const gint32 optype, const gint32 winSize, GError **error)
+/*
+ * getRoutes window. updates are appended one prefix at a time, as long
+ * as their serialized size fits in the caller's winSize, and until the
+ * optional time budget is exhausted.
+ */
+struct zrpc_bgp_get_routes_window
+{
+  GPtrArray *updates;
+  /* updates of the prefix being parsed */
+  GPtrArray *group;
+  /* serialized size of updates, and room available */
+  int size;
+  int max_size;
+  /* monotonic deadline in milliseconds, 0 if none */
+  uint64_t deadline;
+};
+
+/* binary protocol size of Routes without updates: errcode and more
+ * fields, updates field and list headers, stop byte */
+#define ZRPC_GET_ROUTES_OVERHEAD          (2 * (3 + 4) + (3 + 5) + 1)
+/* binary protocol size of Update without strings: four i32 fields,
+ * header and length of three string fields, stop byte */
+#define ZRPC_GET_ROUTES_UPDATE_OVERHEAD   (4 * (3 + 4) + 3 * (3 + 4) + 1)
+/* compact protocol size of Routes without updates: errcode and more
+ * fields with 1 byte values, updates field header, list header with
+ * the largest size varint, stop byte */
+#define ZRPC_GET_ROUTES_COMPACT_OVERHEAD  (2 * (1 + 1) + 1 + (1 + 5) + 1)
+
+/* size of an unsigned varint, as written by compact protocol */
+static int
+zrpc_bgp_get_routes_varint_size (uint32_t val)
+{
+  int size = 1;
+
+  while (val >= 0x80)
+    {
+      val >>= 7;
+      size++;
+    }
+  return size;
+}
+
+/* size of a zigzag encoded i32, as written by compact protocol */
+static int
+zrpc_bgp_get_routes_i32_size (gint32 val)
+{
+  return zrpc_bgp_get_routes_varint_size (((uint32_t)val << 1) ^ (uint32_t)(val >> 31));
+}
+
+/* size of an update in configurator protocol */
+static int
+zrpc_bgp_get_routes_update_size (Update *upd)
+{
+  int rd = strlen (upd->rd), prefix = strlen (upd->prefix);
+  int nexthop = strlen (upd->nexthop);
+
+  if (tm->configurator_protocol != ZRPC_PROTOCOL_COMPACT)
+    return ZRPC_GET_ROUTES_UPDATE_OVERHEAD + rd + prefix + nexthop;
+  /* fields are consecutive: 1 byte field headers */
+  return 7 + zrpc_bgp_get_routes_i32_size (upd->type)
+    + zrpc_bgp_get_routes_i32_size (upd->reserved)
+    + zrpc_bgp_get_routes_i32_size (upd->prefixlen)
+    + zrpc_bgp_get_routes_i32_size (upd->label)
+    + zrpc_bgp_get_routes_varint_size (rd) + rd
+    + zrpc_bgp_get_routes_varint_size (prefix) + prefix
+    + zrpc_bgp_get_routes_varint_size (nexthop) + nexthop + 1;
+}
+
+static uint64_t
+zrpc_bgp_get_routes_msec (void)
+{
+  struct timespec ts;
+
+  clock_gettime (CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+/* add an update for a route of a vrf to the current prefix group */
+static void
+zrpc_bgp_get_routes_group_add (struct zrpc_bgp_get_routes_window *win,
+                               struct bgp_api_route *route,
+                               struct zrpc_vpnservice_cache_bgpvrf *entry)
 {
-  struct capn_ptr afikey, iter_table, *iter_table_ptr = NULL;
-  struct capn rc;
-  struct capn_segment *cs;
-  address_family_t afi = ADDRESS_FAMILY_IP;
-  struct zrpc_vpnservice *ctxt = NULL;
-  uint64_t bgpvrf_nid;
-  struct QZCGetRep *grep_route = NULL;
-  struct bgp_api_route inst_route;
-  struct zrpc_vpnservice_cache_bgpvrf *entry, *entry_next, *entry2;
   char rdstr[ZRPC_UTIL_RDRT_LEN];
-  int route_updates_max, route_updates;
   Update *upd;
 
-  zrpc_vpnservice_get_context (&ctxt);
-  if(!ctxt)
+  upd = g_object_new (TYPE_UPDATE, NULL);
+  upd->type = BGP_RT_ADD;
+  upd->prefixlen = route->prefix.prefixlen;
+  upd->prefix = g_strdup(inet_ntop(AF_INET, &(route->prefix.prefix), rdstr, ZRPC_UTIL_RDRT_LEN));
+  upd->nexthop = g_strdup(inet_ntop(AF_INET, &(route->nexthop), rdstr, ZRPC_UTIL_RDRT_LEN));
+  upd->label = route->label;
+  upd->rd = g_strdup(zrpc_util_rd_prefix2str(&(entry->outbound_rd), rdstr, ZRPC_UTIL_RDRT_LEN));
+  g_ptr_array_add(win->group, upd);
+  /* routes read from bgpd fill the mirror RIB until it is synced */
+  if (entry->rib && !entry->rib->synced)
+    zrpc_rib_add (entry->rib, &route->prefix, route->nexthop, route->label, 0);
+}
+
+/*
+ * move current prefix group into the window. if the group does not
+ * fit, it is dropped and 0 is returned : the prefix has to be fetched
+ * again on next call. a group always fits in an empty window.
+ */
+static int
+zrpc_bgp_get_routes_group_commit (struct zrpc_bgp_get_routes_window *win)
+{
+  Update *upd;
+  int size = 0;
+  guint i;
+
+  for (i = 0; i < win->group->len; i++)
     {
-      (*_return)->errcode = BGP_ERR_FAILED;
-      (*_return)->__isset_errcode = TRUE;
-      return FALSE;
+      upd = g_ptr_array_index (win->group, i);
+      size += zrpc_bgp_get_routes_update_size (upd);
     }
-  /* for first getRoutes, setup the list of bgpvrfs entries */
-  if(optype == GET_RTS_INIT)
+  if (win->updates->len && win->size + size > win->max_size)
+    {
+      for (i = 0; i < win->group->len; i++)
+        g_object_unref (g_ptr_array_index (win->group, i));
+      g_ptr_array_set_size (win->group, 0);
+      return 0;
+    }
+  for (i = 0; i < win->group->len; i++)
+    g_ptr_array_add (win->updates, g_ptr_array_index (win->group, i));
+  g_ptr_array_set_size (win->group, 0);
+  win->size += size;
+  return 1;
+}
+
+/* return 1 if no more prefix should be added to the window */
+static int
+zrpc_bgp_get_routes_window_full (struct zrpc_bgp_get_routes_window *win)
+{
+  if (win->size >= win->max_size)
+    return 1;
+  if (win->deadline && win->updates->len &&
+      zrpc_bgp_get_routes_msec () >= win->deadline)
+    return 1;
+  return 0;
+}
+
+/*
+ * bulk variant of the getRoutes vrf walk : each QZC get returns
+ * a list of routes, multipath entries included.
+ * return 1 if the window is full and the vrf has more routes,
+ * 0 if the vrf has been fully parsed, and -1 if bgpd does not
+ * support bulk iteration, or a bulk get failed: the rest of the vrf
+ * has to be read one route at a time, from the cursor position.
+ */
+static int
+zrpc_bgp_get_routes_bulk (struct zrpc_vpnservice *ctxt,
+                          struct zrpc_vpnservice_get_routes_cursor *cursor,
+                          struct zrpc_vpnservice_cache_bgpvrf *entry,
+                          struct zrpc_bgp_get_routes_window *win)
+{
+  struct capn rc;
+  struct capn_segment *cs;
+  struct capn_ptr bulkkey, iter_table, *iter_table_ptr, routes;
+  struct QZCGetRep *grep;
+  struct bgp_api_route inst_route;
+  struct tbliter_v4 iter_entry;
+  struct zrpc_ipv4_prefix group_prefix, last_prefix;
+  uint64_t bgpvrf_nid = entry->bgpvrf_nid;
+  int i, nb_groups;
+
+  do
     {
-      for (entry = ctxt->bgp_get_routes_list; entry; entry = entry_next)
+      /* prepare bulk context : no count limit, only the room left */
+      capn_init_malloc(&rc);
+      cs = capn_root(&rc).seg;
+      bulkkey = qcapn_new_VRFTableBulkKey(cs);
+      qcapn_VRFTableBulkKey_write(ADDRESS_FAMILY_IP, 0,
+                                  MAX(win->max_size - win->size, 0), bulkkey);
+      if(cursor->table_valid)
         {
-          entry_next = entry->next;
-          ZRPC_FREE (entry);
+          iter_entry.prefix = cursor->table_prefix;
+          iter_table = qcapn_new_VRFTableIter(cs);
+          qcapn_VRFTableIter_write(&iter_entry, iter_table);
+          iter_table_ptr = &iter_table;
         }
-      ctxt->bgp_get_routes_list = NULL;
-      for (entry = ctxt->bgp_vrf_list; entry; entry = entry_next)
+      else
         {
-          entry_next = entry->next;
-          entry2 = ZRPC_CALLOC (sizeof(struct zrpc_vpnservice_cache_bgpvrf));
-          entry2->outbound_rd = entry->outbound_rd;
-          entry2->bgpvrf_nid = entry->bgpvrf_nid;
-          entry2->next = ctxt->bgp_get_routes_list;
-          ctxt->bgp_get_routes_list = entry2;
+          iter_table_ptr = NULL;
         }
-      prev_iter_table_ptr = NULL;
-      memset(&prev_iter_table_entry, 0, sizeof(struct tbliter_v4));
-    }
-  /* initialise context */
-  route_updates_max = MAX(winSize/96, 1);
-  route_updates = 0;
-  (*_return)->more = 1;
-  (*_return)->__isset_more = TRUE;
-  (*_return)->errcode = 0;
-  (*_return)->__isset_updates = TRUE;
-  entry2 = NULL;
-  /* parse current vrfs and vrfs not already parsed */
-  for (entry = ctxt->bgp_get_routes_list; entry; entry = entry_next)
-    {
-      unsigned long mpath_iter_ptr = 0;
-
-      entry_next = entry->next;
-      /* remove current bgpvrf entry, all routes have been parsed */
-      if(entry2)
+      grep = qzcclient_getelem (ctxt->qzc_sock, &bgpvrf_nid, 5,
+                                &bulkkey, &bgp_ctxtype_bgpvrfroute_bulk,
+                                iter_table_ptr, &bgp_itertype_bgpvrfroute);
+      capn_free(&rc);
+      if(grep == NULL || grep->datatype != bgp_datatype_bgpvrfroute_bulk)
         {
-          struct zrpc_vpnservice_cache_bgpvrf *entry_curr, *entry_next, *entry_prev;
-          entry_prev = NULL;
-          for (entry_curr = ctxt->bgp_get_routes_list; entry_curr; 
-               entry_curr = entry_next)
+          qzcclient_qzcgetrep_free(grep);
+          if(ctxt->bgp_get_routes_bulk == 0)
             {
-              entry_next = entry_curr->next;
-              if (entry_curr == entry2)
-                {
-                  if (entry_prev)
-                    entry_prev->next = entry_next;
-                  else
-                    ctxt->bgp_get_routes_list = entry_next;
-                  ZRPC_FREE (entry2);
-                  entry2 = NULL;
-                  break;
-                }
+              zrpc_log ("RTS: bulk iteration not supported by bgpd, routes are read one by one");
+              ctxt->bgp_get_routes_bulk = -1;
             }
+          else if(IS_ZRPC_DEBUG)
+            zrpc_log ("RTS: bulk get failed on vrf nid %llx, reading routes one by one",
+                      (long long unsigned int)bgpvrf_nid);
+          return -1;
         }
-      if(IS_ZRPC_DEBUG_CACHE)
-        zrpc_log ("RTS: parsing vrf nid %llx", (long long unsigned int)entry->bgpvrf_nid);
-      bgpvrf_nid = entry->bgpvrf_nid;
-      do
+      ctxt->bgp_get_routes_bulk = 1;
+      routes = qcapn_BGPVRFRouteList_get(grep->data);
+      nb_groups = 0;
+      memset(&group_prefix, 0, sizeof(group_prefix));
+      memset(&last_prefix, 0, sizeof(last_prefix));
+      /* group entries per prefix. last round flushes the last group */
+      for (i = 0; i <= routes.len; i++)
         {
-           /* prepare afi context */
-          capn_init_malloc(&rc);
-          cs = capn_root(&rc).seg;
-          afikey = qcapn_new_AfiKey(cs);
-          capn_resolve(&afikey);
-          capn_write8(afikey, 0, afi);
-	  if(prev_iter_table_ptr)
-	  {
-                 iter_table = qcapn_new_VRFTableIter(cs);
-                 qcapn_VRFTableIter_write(&prev_iter_table_entry, iter_table);
-                 iter_table_ptr = &iter_table;
-	  }
-	  else
-	  {
-                 iter_table_ptr = NULL;
-	  }
-          /* get route entry from the vrf rib table */
-          /* currently entries from the vrf route table XXX */
-          grep_route = qzcclient_getelem (ctxt->qzc_sock, &bgpvrf_nid, 2, \
-                                          &afikey, &bgp_ctxtype_bgpvrfroute, \
-                                          iter_table_ptr, &bgp_itertype_bgpvrfroute);
-          if(grep_route == NULL || grep_route->datatype == 0)
-            {
-              /* goto next vrf */
-              prev_iter_table_ptr = NULL;
-              qzcclient_qzcgetrep_free(grep_route);
-              capn_free(&rc);
-              break;
-            }
-          memset(&inst_route, 0, sizeof(struct bgp_api_route));
-          qcapn_BGPVRFRoute_read(&inst_route, grep_route->data);
-          if(grep_route->datatype != 0)
+          if (i < routes.len)
             {
-              /* if datatype is valid, iter type may be valid. continue */
-              qcapn_BGPVRFRoute_read(&inst_route, grep_route->data);
-
-              /* this is possibly a multipath route, get additionnal data in the
-               same grep_route->data exchange channel to get a pointer to the
-               next bgp_info struct linked to that route.
-               The offset of CAPN_BGPVRF_ROUTE_DEF_SIZE is because such data has a
-               8 bytes offset with usual VRFRoute exchanged via capn'proto */
-              qcapn_BGPVRFInfoIter_read(&mpath_iter_ptr, grep_route->data, CAPN_BGPVRF_ROUTE_DEF_SIZE);
+              memset(&inst_route, 0, sizeof(struct bgp_api_route));
+              qcapn_BGPVRFRoute_read(&inst_route, capn_getp(routes, i, 1));
             }
-
-          if(grep_route->itertype != 0)
-            {
-              memset(&prev_iter_table_entry, 0, sizeof(prev_iter_table_entry));
-              qcapn_VRFTableIter_read(&prev_iter_table_entry, grep_route->nextiter);
-              prev_iter_table_ptr = &prev_iter_table_entry;
-            }
-          else
-            {
-              prev_iter_table_ptr = NULL;
-            }
-          qzcclient_qzcgetrep_free(grep_route);
-          capn_free(&rc);
-          /* bypass route entries with zeroes */
-          if ( (inst_route.nexthop.s_addr == 0) &&              \
-               (inst_route.prefix.prefix.s_addr == 0) &&        \
-               (inst_route.prefix.prefixlen == 0) &&            \
-               (inst_route.label == 0))
+          if (win->group->len &&
+              (i == routes.len ||
+               inst_route.prefix.prefixlen != group_prefix.prefixlen ||
+               inst_route.prefix.prefix.s_addr != group_prefix.prefix.s_addr))
             {
-              if(prev_iter_table_ptr != NULL)
-                {
-                  continue;
-                }
-              else
+              if (!zrpc_bgp_get_routes_group_commit (win))
                 {
-                  /* goto next vrf */
-                  break;
+                  /* resume after the last prefix that fitted */
+                  if (nb_groups)
+                    {
+                      cursor->table_prefix = last_prefix;
+                      cursor->table_valid = 1;
+                    }
+                  qzcclient_qzcgetrep_free(grep);
+                  return 1;
                 }
+              last_prefix = group_prefix;
+              nb_groups++;
             }
-          /* add entry in update */
-          upd = g_object_new (TYPE_UPDATE, NULL);
-          upd->type = BGP_RT_ADD;
-          upd->prefixlen = inst_route.prefix.prefixlen;
-          upd->prefix = g_strdup(inet_ntop(AF_INET, &(inst_route.prefix.prefix), rdstr, ZRPC_UTIL_RDRT_LEN));
-          upd->nexthop = g_strdup(inet_ntop(AF_INET, &(inst_route.nexthop), rdstr, ZRPC_UTIL_RDRT_LEN));
-          upd->label = inst_route.label;
-          upd->rd = g_strdup(zrpc_util_rd_prefix2str(&(entry->outbound_rd), rdstr, ZRPC_UTIL_RDRT_LEN));
-          g_ptr_array_add((*_return)->updates, upd);
-          route_updates++;
-
-          /* multipath specific loop */
-          while (mpath_iter_ptr)
+          if (i < routes.len)
             {
-              struct QZCGetRep *grep_multipath_route = NULL;
-              struct capn_ptr iter_table_bim;
-              struct capn_segment *csi;
-              struct bgp_api_route inst_multipath_route;
-
-               /* prepare context, it will be dedicated to loop on multipath routes attached to a vpnv4 route */
-              capn_init_malloc(&rc);
-              csi = capn_root(&rc).seg;
-              iter_table_bim = qcapn_new_BGPVRFInfoIter(csi);
-              /* provide internal pointer value to the next struct bgp_info of a route is has one */
-              qcapn_BGPVRFInfoIter_write(mpath_iter_ptr, iter_table_bim, 0);
-
-              /* get route entry from the vrf rib table */
-              grep_multipath_route = qzcclient_getelem (ctxt->qzc_sock, &bgpvrf_nid, 4, \
-                                              NULL, NULL, \
-                                              &iter_table_bim, &bgp_itertype_bgpvrfroute);
-              if(grep_multipath_route == NULL || grep_multipath_route->datatype == 0)
-                {
-                  /* goto next prefix */
-                  qzcclient_qzcgetrep_free(grep_multipath_route);
-                  capn_free(&rc);
-                  break;
-                }
-              memset(&inst_multipath_route, 0, sizeof(struct bgp_api_route));
-              qcapn_BGPVRFRoute_read(&inst_multipath_route, grep_multipath_route->data);
-              if(grep_route->datatype != 0)
-                {
-                  /* if datatype is valid, iter type may be valid. continue */
-                  qcapn_BGPVRFRoute_read(&inst_multipath_route, grep_multipath_route->data);
-                }
+              group_prefix = inst_route.prefix;
+              zrpc_bgp_get_routes_group_add (win, &inst_route, entry);
+            }
+        }
+      if(grep->itertype != 0)
+        {
+          memset(&iter_entry, 0, sizeof(iter_entry));
+          qcapn_VRFTableIter_read(&iter_entry, grep->nextiter);
+          cursor->table_prefix = iter_entry.prefix;
+          cursor->table_valid = 1;
+        }
+      else
+        {
+          cursor->table_valid = 0;
+        }
+      qzcclient_qzcgetrep_free(grep);
+      if(!cursor->table_valid)
+        return 0;
+    } while (!zrpc_bgp_get_routes_window_full (win));
+  return 1;
+}
 
-              mpath_iter_ptr = 0;
-              /* look for another multipath entry with that check */
-              if(grep_multipath_route->itertype != 0)
-                {
-                  /* there is another multipath entry after this one, store it into mpath_iter_ptr */
-                  qcapn_BGPVRFInfoIter_read(&mpath_iter_ptr, grep_multipath_route->nextiter, 0);
-                }
+/*
+ * per route variant of the getRoutes vrf walk : one QZC get per
+ * prefix, and one per additional multipath entry.
+ * return 1 if the window is full and the vrf has more routes,
+ * 0 if the vrf has been fully parsed.
+ */
+static int
+zrpc_bgp_get_routes_walk (struct zrpc_vpnservice *ctxt,
+                          struct zrpc_vpnservice_get_routes_cursor *cursor,
+                          struct zrpc_vpnservice_cache_bgpvrf *entry,
+                          struct zrpc_bgp_get_routes_window *win)
+{
+  struct capn_ptr afikey, iter_table, *iter_table_ptr = NULL;
+  struct capn rc;
+  struct capn_segment *cs;
+  address_family_t afi = ADDRESS_FAMILY_IP;
+  uint64_t bgpvrf_nid = entry->bgpvrf_nid;
+  struct QZCGetRep *grep_route = NULL;
+  struct bgp_api_route inst_route;
+  struct tbliter_v4 iter_entry;
+  struct zrpc_ipv4_prefix table_prefix;
+  int table_valid;
+
+  do
+    {
+      unsigned long mpath_iter_ptr = 0;
+
+      /* position to restore if that prefix does not fit */
+      table_prefix = cursor->table_prefix;
+      table_valid = cursor->table_valid;
+      /* prepare afi context */
+      capn_init_malloc(&rc);
+      cs = capn_root(&rc).seg;
+      afikey = qcapn_new_AfiKey(cs);
+      capn_resolve(&afikey);
+      capn_write8(afikey, 0, afi);
+      if(cursor->table_valid)
+        {
+          iter_entry.prefix = cursor->table_prefix;
+          iter_table = qcapn_new_VRFTableIter(cs);
+          qcapn_VRFTableIter_write(&iter_entry, iter_table);
+          iter_table_ptr = &iter_table;
+        }
+      else
+        {
+          iter_table_ptr = NULL;
+        }
+      /* get route entry from the vrf rib table */
+      /* currently entries from the vrf route table XXX */
+      grep_route = qzcclient_getelem (ctxt->qzc_sock, &bgpvrf_nid, 2, \
+                                      &afikey, &bgp_ctxtype_bgpvrfroute, \
+                                      iter_table_ptr, &bgp_itertype_bgpvrfroute);
+      if(grep_route == NULL || grep_route->datatype == 0)
+        {
+          /* goto next vrf */
+          cursor->table_valid = 0;
+          qzcclient_qzcgetrep_free(grep_route);
+          capn_free(&rc);
+          return 0;
+        }
+      memset(&inst_route, 0, sizeof(struct bgp_api_route));
+      qcapn_BGPVRFRoute_read(&inst_route, grep_route->data);
+      /* this is possibly a multipath route, get additionnal data in the
+         same grep_route->data exchange channel to get a pointer to the
+         next bgp_info struct linked to that route.
+         The offset of CAPN_BGPVRF_ROUTE_DEF_SIZE is because such data has a
+         8 bytes offset with usual VRFRoute exchanged via capn'proto */
+      qcapn_BGPVRFInfoIter_read(&mpath_iter_ptr, grep_route->data, CAPN_BGPVRF_ROUTE_DEF_SIZE);
+
+      if(grep_route->itertype != 0)
+        {
+          memset(&iter_entry, 0, sizeof(iter_entry));
+          qcapn_VRFTableIter_read(&iter_entry, grep_route->nextiter);
+          cursor->table_prefix = iter_entry.prefix;
+          cursor->table_valid = 1;
+        }
+      else
+        {
+          cursor->table_valid = 0;
+        }
+      qzcclient_qzcgetrep_free(grep_route);
+      capn_free(&rc);
+      /* bypass route entries with zeroes */
+      if ( (inst_route.nexthop.s_addr == 0) &&              \
+           (inst_route.prefix.prefix.s_addr == 0) &&        \
+           (inst_route.prefix.prefixlen == 0) &&            \
+           (inst_route.label == 0))
+        {
+          if(cursor->table_valid)
+            continue;
+          /* goto next vrf */
+          return 0;
+        }
+      zrpc_bgp_get_routes_group_add (win, &inst_route, entry);
+
+      /* multipath specific loop */
+      while (mpath_iter_ptr)
+        {
+          struct QZCGetRep *grep_multipath_route = NULL;
+          struct capn_ptr iter_table_bim;
+          struct capn_segment *csi;
+          struct bgp_api_route inst_multipath_route;
+
+          /* prepare context, it will be dedicated to loop on multipath routes attached to a vpnv4 route */
+          capn_init_malloc(&rc);
+          csi = capn_root(&rc).seg;
+          iter_table_bim = qcapn_new_BGPVRFInfoIter(csi);
+          /* provide internal pointer value to the next struct bgp_info of a route is has one */
+          qcapn_BGPVRFInfoIter_write(mpath_iter_ptr, iter_table_bim, 0);
+
+          /* get route entry from the vrf rib table */
+          grep_multipath_route = qzcclient_getelem (ctxt->qzc_sock, &bgpvrf_nid, 4, \
+                                                    NULL, NULL, \
+                                                    &iter_table_bim, &bgp_itertype_bgpvrfroute);
+          if(grep_multipath_route == NULL || grep_multipath_route->datatype == 0)
+            {
+              /* goto next prefix */
               qzcclient_qzcgetrep_free(grep_multipath_route);
               capn_free(&rc);
-
-              /* bypass route entries with zeroes */
-              if ( (inst_multipath_route.nexthop.s_addr == 0) &&              \
-                   (inst_multipath_route.prefix.prefix.s_addr == 0) &&        \
-                   (inst_multipath_route.prefix.prefixlen == 0) &&            \
-                   (inst_multipath_route.label == 0))
-                {
-                  break;
-                }
-              /* add entry in update */
-              upd = g_object_new (TYPE_UPDATE, NULL);
-              upd->type = BGP_RT_ADD;
-              upd->prefixlen = inst_route.prefix.prefixlen; /* keep prefix from main loop */
-              upd->prefix = g_strdup(inet_ntop(AF_INET, &(inst_route.prefix.prefix), rdstr, ZRPC_UTIL_RDRT_LEN));
-              upd->nexthop = g_strdup(inet_ntop(AF_INET, &(inst_multipath_route.nexthop), rdstr, ZRPC_UTIL_RDRT_LEN));
-              upd->label = inst_multipath_route.label;
-              upd->rd = g_strdup(zrpc_util_rd_prefix2str(&(entry->outbound_rd), rdstr, ZRPC_UTIL_RDRT_LEN));
-              g_ptr_array_add((*_return)->updates, upd);
-              route_updates++;
-
-              if (!mpath_iter_ptr)
-                break; /* no more nexthop with MULTIPATH flag, go to next prefix */
+              break;
             }
+          memset(&inst_multipath_route, 0, sizeof(struct bgp_api_route));
+          qcapn_BGPVRFRoute_read(&inst_multipath_route, grep_multipath_route->data);
 
-          /* prepare next extraction */
-          if(prev_iter_table_ptr == NULL)
+          mpath_iter_ptr = 0;
+          /* look for another multipath entry with that check */
+          if(grep_multipath_route->itertype != 0)
             {
-              /* goto next vrf */
-              break;
+              /* there is another multipath entry after this one, store it into mpath_iter_ptr */
+              qcapn_BGPVRFInfoIter_read(&mpath_iter_ptr, grep_multipath_route->nextiter, 0);
             }
-          if(route_updates >= route_updates_max)
+          qzcclient_qzcgetrep_free(grep_multipath_route);
+          capn_free(&rc);
+
+          /* bypass route entries with zeroes */
+          if ( (inst_multipath_route.nexthop.s_addr == 0) &&              \
+               (inst_multipath_route.prefix.prefix.s_addr == 0) &&        \
+               (inst_multipath_route.prefix.prefixlen == 0) &&            \
+               (inst_multipath_route.label == 0))
             {
-              /* save last iteration table */
-              return TRUE;
+              break;
             }
-        } while(1);
-      entry2 = entry;
+          /* keep prefix from main loop */
+          inst_multipath_route.prefix = inst_route.prefix;
+          zrpc_bgp_get_routes_group_add (win, &inst_multipath_route, entry);
+        }
+
+      if (!zrpc_bgp_get_routes_group_commit (win))
+        {
+          /* fetch that prefix again on next call */
+          cursor->table_prefix = table_prefix;
+          cursor->table_valid = table_valid;
+          return 1;
+        }
+      /* prepare next extraction */
+      if(!cursor->table_valid)
+        {
+          /* goto next vrf */
+          return 0;
+        }
+    } while (!zrpc_bgp_get_routes_window_full (win));
+  return 1;
+}
+
+/*
+ * mirror RIB variant of the getRoutes vrf walk : routes are read
+ * from local memory, without bgpd round trip.
+ * return 1 if the window is full and the vrf has more routes,
+ * 0 if the vrf has been fully parsed.
+ */
+static int
+zrpc_bgp_get_routes_rib (struct zrpc_vpnservice_get_routes_cursor *cursor,
+                         struct zrpc_vpnservice_cache_bgpvrf *entry,
+                         struct zrpc_bgp_get_routes_window *win)
+{
+  struct zrpc_rib_node *node;
+  struct zrpc_rib_path *paths;
+  struct bgp_api_route route;
+  uint16_t i;
+
+  if (cursor->table_valid)
+    node = zrpc_rib_next (entry->rib, &cursor->table_prefix);
+  else
+    node = zrpc_rib_first (entry->rib);
+  while (node)
+    {
+      memset(&route, 0, sizeof(struct bgp_api_route));
+      zrpc_rib_node_prefix (node, &route.prefix);
+      paths = ZRPC_RIB_NODE_PATHS (node);
+      for (i = 0; i < node->nb_paths; i++)
+        {
+          route.nexthop = paths[i].nexthop;
+          route.label = paths[i].label;
+          zrpc_bgp_get_routes_group_add (win, &route, entry);
+        }
+      if (!zrpc_bgp_get_routes_group_commit (win))
+        return 1;
+      cursor->table_prefix = route.prefix;
+      cursor->table_valid = 1;
+      node = zrpc_rib_next (entry->rib, &route.prefix);
+      if (node && zrpc_bgp_get_routes_window_full (win))
+        return 1;
+    }
+  cursor->table_valid = 0;
+  return 0;
+}
+
+gboolean
+instance_bgp_configurator_handler_get_routes (BgpConfiguratorIf *iface, Routes ** _return,
+                                              const gint32 optype, const gint32 winSize, GError **error)
+{
+  struct zrpc_vpnservice *ctxt = NULL;
+  struct zrpc_vpnservice_get_routes_cursor *cursor;
+  struct zrpc_vpnservice_cache_bgpvrf *vrf;
+  struct zrpc_bgp_get_routes_window win;
+  struct zrpc_rd_prefix *rd;
+  uint64_t mask;
+  uint32_t i;
+  int ret;
+
+  zrpc_vpnservice_get_context (&ctxt);
+  if(!ctxt)
+    {
+      (*_return)->errcode = BGP_ERR_FAILED;
+      (*_return)->__isset_errcode = TRUE;
+      return FALSE;
     }
-  if(route_updates == 0)
+  /* each connection iterates with its own cursor */
+  cursor = zrpc_vpnservice_get_routes_cursor_get (ctxt, zrpc_vpnservice_get_client (),
+                                                  optype == GET_RTS_INIT);
+  if(cursor == NULL)
     {
+      /* GET_RTS_NEXT without GET_RTS_INIT, or cursor reaped */
       (*_return)->errcode = BGP_ERR_NOT_ITER;
       (*_return)->__isset_errcode = TRUE;
+      (*_return)->more = 0;
+      (*_return)->__isset_more = TRUE;
+      return TRUE;
     }
+  /* for first getRoutes, setup the list of bgpvrfs entries */
+  if(optype == GET_RTS_INIT)
+    {
+      /* take a snapshot of the VRFs of the cache, so that VRF
+       * add or delete do not disturb the iteration */
+      if (cursor->vrf_rds)
+        ZRPC_FREE (cursor->vrf_rds);
+      cursor->vrf_rds = NULL;
+      cursor->vrf_count = ctxt->bgp_vrf_table.count;
+      cursor->vrf_index = 0;
+      if (cursor->vrf_count)
+        {
+          cursor->vrf_rds = ZRPC_MALLOC (cursor->vrf_count * sizeof(struct zrpc_rd_prefix));
+          for (i = 0; i < cursor->vrf_count; i++)
+            cursor->vrf_rds[i] = ctxt->bgp_vrf_table.entries[i].outbound_rd;
+        }
+      cursor->table_valid = 0;
+      memset(&cursor->table_prefix, 0, sizeof(struct zrpc_ipv4_prefix));
+    }
+  /* initialise context */
+  (*_return)->more = 1;
+  (*_return)->__isset_more = TRUE;
+  (*_return)->errcode = 0;
+  (*_return)->__isset_updates = TRUE;
+  win.updates = (*_return)->updates;
+  win.group = g_ptr_array_new ();
+  win.size = 0;
+  if (tm->configurator_protocol == ZRPC_PROTOCOL_COMPACT)
+    win.max_size = winSize - ZRPC_GET_ROUTES_COMPACT_OVERHEAD;
+  else
+    win.max_size = winSize - ZRPC_GET_ROUTES_OVERHEAD;
+  win.deadline = 0;
+  if (tm->get_routes_time_budget)
+    win.deadline = zrpc_bgp_get_routes_msec () + tm->get_routes_time_budget;
+  /* parse current vrf and vrfs not already parsed */
+  for (; cursor->vrf_index < cursor->vrf_count; cursor->vrf_index++)
+    {
+      if (zrpc_bgp_get_routes_window_full (&win))
+        {
+          g_ptr_array_free (win.group, TRUE);
+          return TRUE;
+        }
+      rd = &cursor->vrf_rds[cursor->vrf_index];
+      /* vrf may have been removed since the snapshot */
+      vrf = zrpc_vpnservice_vrf_lookup (ctxt, rd);
+      if(vrf == NULL)
+        {
+          cursor->table_valid = 0;
+          continue;
+        }
+      /* routes of other vrfs may be changed meanwhile */
+      mask = zrpc_vpnservice_vrf_lock_mask (rd);
+      zrpc_vpnservice_lock_vrfs (ctxt, mask);
+      if(IS_ZRPC_DEBUG_CACHE)
+        zrpc_log ("RTS: parsing vrf nid %llx", (long long unsigned int)vrf->bgpvrf_nid);
+      /* use mirror RIB if it was synced when vrf walk started */
+      if(cursor->table_from_rib && !(vrf->rib && vrf->rib->synced))
+        cursor->table_valid = 0;
+      if(!cursor->table_valid)
+        cursor->table_from_rib = vrf->rib && vrf->rib->synced;
+      if(cursor->table_from_rib)
+        ret = zrpc_bgp_get_routes_rib (cursor, vrf, &win);
+      else
+        {
+          ret = -1;
+          if(ctxt->bgp_get_routes_bulk >= 0)
+            ret = zrpc_bgp_get_routes_bulk (ctxt, cursor, vrf, &win);
+          /* bulk mode not available, or failed: per route iteration */
+          if(ret < 0)
+            ret = zrpc_bgp_get_routes_walk (ctxt, cursor, vrf, &win);
+          /* a complete walk of bgpd table makes the mirror RIB usable */
+          if(ret == 0 && vrf->rib)
+            vrf->rib->synced = 1;
+        }
+      zrpc_vpnservice_unlock_vrfs (ctxt, mask);
+      if(ret > 0)
+        {
+          g_ptr_array_free (win.group, TRUE);
+          return TRUE;
+        }
+    }
+  g_ptr_array_free (win.group, TRUE);
+  if(win.updates->len == 0)
+    {
+      (*_return)->errcode = BGP_ERR_NOT_ITER;
+      (*_return)->__isset_errcode = TRUE;
+    }
+  /* iteration is over, release cursor */
+  zrpc_vpnservice_get_routes_cursor_del (ctxt, zrpc_vpnservice_get_client ());
   (*_return)->more = 0;
   (*_return)->__isset_more = TRUE;
   return TRUE;
@@ -1891,6 +2514,7 @@ instance_bgp_configurator_handler_multipaths(BgpConfiguratorIf *iface, gint32* _
   uint64_t bgpvrf_nid;
   struct zrpc_rd_prefix rd_inst;
   struct QZCGetRep *grep_vrf;
+  struct zrpc_vpnservice_cache_bgpvrf *entry;
   int ret;
 
   zrpc_vpnservice_get_context (&ctxt);
@@ -1956,6 +2580,9 @@ instance_bgp_configurator_handler_multipaths(BgpConfiguratorIf *iface, gint32* _
   }
   else
   {
+    entry = zrpc_vpnservice_vrf_lookup(ctxt, &rd_inst);
+    if(entry)
+      entry->max_path = maxPath;
     if(IS_ZRPC_DEBUG)
       {
         zrpc_log ("maximum path for VRF %s set to %d", rd, maxPath);
@@ -1965,12 +2592,705 @@ instance_bgp_configurator_handler_multipaths(BgpConfiguratorIf *iface, gint32* _
   return TRUE;
 }
 
+/* applyConfig progress: first error met, and what was changed */
+struct zrpc_bgp_apply
+{
+  gint32 ret;
+  guint peers_added, peers_deleted, peers_changed;
+  guint vrfs_added, vrfs_deleted, vrfs_changed;
+  guint routes_withdrawn;
+};
+
+/* route of the snapshot, by vrf and pushed route key */
+struct zrpc_bgp_apply_route
+{
+  uint64_t rd_key;
+  uint64_t key;
+};
+
+static void
+zrpc_bgp_apply_result (struct zrpc_bgp_apply *apply, gboolean ok,
+                       gint32 code, GError **err)
+{
+  if((!ok || code) && apply->ret == 0)
+    apply->ret = code ? code : BGP_ERR_FAILED;
+  g_clear_error (err);
+}
+
+static int
+zrpc_bgp_apply_peer_cmp (const void *a, const void *b)
+{
+  return memcmp (a, b, sizeof (struct zrpc_vpnservice_peer_key));
+}
+
+static int
+zrpc_bgp_apply_route_cmp (const void *a, const void *b)
+{
+  const struct zrpc_bgp_apply_route *r1 = a, *r2 = b;
+
+  if(r1->rd_key != r2->rd_key)
+    return r1->rd_key < r2->rd_key ? -1 : 1;
+  return r1->key < r2->key ? -1 : r1->key > r2->key;
+}
+
+/*
+ * peers missing from the snapshot are deleted, others are created,
+ * or created again when their AS number changed. only attributes
+ * differing from what was set through zrpcd are sent to bgpd.
+ */
+static void
+zrpc_bgp_apply_peers (struct zrpc_vpnservice *ctxt, BgpConfiguratorIf *iface,
+                      const GPtrArray *peers, struct zrpc_bgp_apply *apply)
+{
+  struct zrpc_vpnservice_peer_table *table = &ctxt->bgp_peer_table;
+  struct zrpc_vpnservice_peer_key *keys, key, src;
+  struct zrpc_vpnservice_cache_peer *entry;
+  char addr[INET6_ADDRSTRLEN];
+  GError *err = NULL;
+  PeerConfig *peer;
+  gboolean ok, added, changed, vpnv4;
+  gint32 code;
+  guint i, nb_keys = 0;
+
+  keys = ZRPC_CALLOC ((peers->len + 1) * sizeof (struct zrpc_vpnservice_peer_key));
+  for (i = 0; i < peers->len; i++)
+    {
+      peer = (PeerConfig *)g_ptr_array_index(peers, i);
+      if(peer && zrpc_vpnservice_peer_key_set (&keys[nb_keys], peer->ipAddress))
+        nb_keys++;
+    }
+  qsort (keys, nb_keys, sizeof (struct zrpc_vpnservice_peer_key), zrpc_bgp_apply_peer_cmp);
+  /* deleting an entry moves the last one in its place: walk backwards */
+  for (i = table->count; i > 0; i--)
+    {
+      key = table->entries[i - 1].key;
+      if(bsearch (&key, keys, nb_keys, sizeof (key), zrpc_bgp_apply_peer_cmp))
+        continue;
+      inet_ntop (key.family, key.addr, addr, sizeof (addr));
+      code = 0;
+      ok = instance_bgp_configurator_handler_delete_peer (iface, &code, addr, &err);
+      zrpc_bgp_apply_result (apply, ok, code, &err);
+      if(ok)
+        apply->peers_deleted++;
+    }
+  ZRPC_FREE (keys);
+
+  for (i = 0; i < peers->len; i++)
+    {
+      peer = (PeerConfig *)g_ptr_array_index(peers, i);
+      if(peer == NULL || peer->asNumber <= 0 ||
+         !zrpc_vpnservice_peer_key_set (&key, peer->ipAddress))
+        {
+          zrpc_bgp_apply_result (apply, FALSE, BGP_ERR_PARAM, &err);
+          continue;
+        }
+      added = changed = FALSE;
+      entry = zrpc_vpnservice_peer_lookup (ctxt, &key);
+      /* AS number of a peer can not be changed */
+      if(entry && entry->asNumber != (uint32_t)peer->asNumber)
+        {
+          code = 0;
+          ok = instance_bgp_configurator_handler_delete_peer (iface, &code, peer->ipAddress, &err);
+          zrpc_bgp_apply_result (apply, ok, code, &err);
+          if(!ok)
+            continue;
+          entry = NULL;
+        }
+      if(entry == NULL)
+        {
+          code = 0;
+          ok = instance_bgp_configurator_handler_create_peer (iface, &code, peer->ipAddress,
+                                                              peer->asNumber, &err);
+          zrpc_bgp_apply_result (apply, ok, code, &err);
+          entry = zrpc_vpnservice_peer_lookup (ctxt, &key);
+          if(entry == NULL)
+            continue;
+          added = TRUE;
+        }
+      if(entry->multihop != peer->ebgpMultihop)
+        {
+          code = 0;
+          ok = zrpc_bgp_set_multihops (ctxt, &code, peer->ipAddress, peer->ebgpMultihop, &err);
+          zrpc_bgp_apply_result (apply, ok, code, &err);
+          changed = TRUE;
+        }
+      memset (&src, 0, sizeof (src));
+      if(peer->__isset_updateSource && peer->updateSource && peer->updateSource[0] &&
+         !zrpc_vpnservice_peer_key_set (&src, peer->updateSource))
+        zrpc_bgp_apply_result (apply, FALSE, BGP_ERR_PARAM, &err);
+      else if(memcmp (&entry->update_source, &src, sizeof (src)))
+        {
+          code = 0;
+          ok = instance_bgp_configurator_handler_set_update_source (iface, &code, peer->ipAddress,
+                                                                   src.family ? peer->updateSource : NULL,
+                                                                   &err);
+          zrpc_bgp_apply_result (apply, ok, code, &err);
+          changed = TRUE;
+        }
+      vpnv4 = peer->__isset_vpnv4 ? peer->vpnv4 : TRUE;
+      if(entry->vpnv4 != (vpnv4 ? 1 : 0))
+        {
+          code = 0;
+          ok = zrpc_bgp_afi_config (ctxt, &code, peer->ipAddress, AF_AFI_AFI_IP,
+                                    AF_SAFI_SAFI_MPLS_VPN, vpnv4, &err);
+          zrpc_bgp_apply_result (apply, ok, code, &err);
+          changed = TRUE;
+        }
+      if(added)
+        apply->peers_added++;
+      else if(changed)
+        apply->peers_changed++;
+    }
+}
+
+/*
+ * vrfs missing from the snapshot are deleted. others are added, or
+ * added again when their route targets changed, which updates them.
+ */
+static void
+zrpc_bgp_apply_vrfs (struct zrpc_vpnservice *ctxt, BgpConfiguratorIf *iface,
+                     const GPtrArray *vrfs, struct zrpc_bgp_apply *apply)
+{
+  struct zrpc_vpnservice_vrf_table *table = &ctxt->bgp_vrf_table;
+  struct zrpc_vpnservice_cache_bgpvrf *entry;
+  struct zrpc_rd_prefix rd;
+  char rd_str[ZRPC_UTIL_RDRT_LEN];
+  uint64_t *keys, *rts, rd_key;
+  uint32_t nb_irts, nb_erts;
+  GError *err = NULL;
+  VrfConfig *vrf;
+  gboolean ok, added;
+  gint32 code;
+  guint i, nb_keys = 0;
+
+  keys = ZRPC_CALLOC ((vrfs->len + 1) * sizeof (uint64_t));
+  for (i = 0; i < vrfs->len; i++)
+    {
+      vrf = (VrfConfig *)g_ptr_array_index(vrfs, i);
+      memset (&rd, 0, sizeof (struct zrpc_rd_prefix));
+      if(vrf && vrf->rd && zrpc_util_str2rd_prefix (vrf->rd, &rd))
+        keys[nb_keys++] = zrpc_vpnservice_rd_key (&rd);
+    }
+  qsort (keys, nb_keys, sizeof (uint64_t), zrpc_bgp_configurator_key_cmp);
+  /* deleting an entry moves the last one in its place: walk backwards */
+  for (i = table->count; i > 0; i--)
+    {
+      rd_key = table->entries[i - 1].rd_key;
+      if(bsearch (&rd_key, keys, nb_keys, sizeof (uint64_t), zrpc_bgp_configurator_key_cmp))
+        continue;
+      zrpc_util_rd_prefix2str (&table->entries[i - 1].outbound_rd, rd_str, sizeof (rd_str));
+      code = 0;
+      ok = instance_bgp_configurator_handler_del_vrf (iface, &code, rd_str, &err);
+      zrpc_bgp_apply_result (apply, ok, code, &err);
+      if(ok)
+        apply->vrfs_deleted++;
+    }
+  ZRPC_FREE (keys);
+
+  for (i = 0; i < vrfs->len; i++)
+    {
+      vrf = (VrfConfig *)g_ptr_array_index(vrfs, i);
+      memset (&rd, 0, sizeof (struct zrpc_rd_prefix));
+      if(vrf == NULL || vrf->rd == NULL || vrf->irts == NULL || vrf->erts == NULL ||
+         zrpc_util_str2rd_prefix (vrf->rd, &rd) == 0)
+        {
+          zrpc_bgp_apply_result (apply, FALSE, BGP_ERR_PARAM, &err);
+          continue;
+        }
+      entry = zrpc_vpnservice_vrf_lookup (ctxt, &rd);
+      rts = zrpc_bgp_configurator_rts_get (vrf->irts, vrf->erts, &nb_irts, &nb_erts);
+      if(entry == NULL || !zrpc_vpnservice_vrf_same_rts (entry, rts, nb_irts, nb_erts))
+        {
+          added = (entry == NULL);
+          code = 0;
+          ok = instance_bgp_configurator_handler_add_vrf (iface, &code, vrf->rd,
+                                                          vrf->irts, vrf->erts, &err);
+          zrpc_bgp_apply_result (apply, ok, code, &err);
+          entry = zrpc_vpnservice_vrf_lookup (ctxt, &rd);
+          if(entry && added)
+            apply->vrfs_added++;
+          else if(entry)
+            apply->vrfs_changed++;
+        }
+      ZRPC_FREE (rts);
+      if(entry && vrf->__isset_maxPath && entry->max_path != vrf->maxPath)
+        {
+          code = 0;
+          ok = instance_bgp_configurator_handler_multipaths (iface, &code, vrf->rd,
+                                                            vrf->maxPath, &err);
+          zrpc_bgp_apply_result (apply, ok, code, &err);
+        }
+    }
+}
+
+/* error codes of a routes batch, counting successful ones */
+static void
+zrpc_bgp_apply_codes (struct zrpc_bgp_apply *apply, gboolean ok,
+                      GArray *codes, guint *nb_ok, GError **err)
+{
+  guint i;
+
+  zrpc_bgp_apply_result (apply, ok, 0, err);
+  for (i = 0; i < codes->len; i++)
+    {
+      zrpc_bgp_apply_result (apply, TRUE, g_array_index(codes, gint32, i), err);
+      if(nb_ok && g_array_index(codes, gint32, i) == 0)
+        (*nb_ok)++;
+    }
+}
+
+/* locks of all VRFs known to zrpcd. the VRF table does not change
+ * while shared lock is held */
+static uint64_t
+zrpc_bgp_apply_vrfs_lock_mask (struct zrpc_vpnservice *ctxt)
+{
+  struct zrpc_vpnservice_vrf_table *table = &ctxt->bgp_vrf_table;
+  uint64_t mask = 0;
+  guint i;
+
+  for (i = 0; i < table->count; i++)
+    mask |= zrpc_vpnservice_vrf_lock_mask (&table->entries[i].outbound_rd);
+  return mask;
+}
+
+/* routes pushed through zrpcd and missing from the snapshot.
+ * called with the locks of all VRFs held */
+static GPtrArray *
+zrpc_bgp_apply_stale_routes (struct zrpc_vpnservice *ctxt, const GPtrArray *routes)
+{
+  struct zrpc_vpnservice_vrf_table *table = &ctxt->bgp_vrf_table;
+  struct zrpc_vpnservice_cache_bgpvrf *entry;
+  struct zrpc_bgp_apply_route *keys, key;
+  struct zrpc_rd_prefix rd;
+  struct zrpc_ipv4_prefix p;
+  const gchar *prev_rd = NULL;
+  char rd_str[ZRPC_UTIL_RDRT_LEN], addr[INET_ADDRSTRLEN], pfx_str[INET_ADDRSTRLEN + 4];
+  gboolean valid_rd = FALSE;
+  uint64_t rd_key = 0;
+  GPtrArray *withdraw;
+  Update *upd;
+  guint i, j, nb_keys = 0;
+
+  keys = ZRPC_CALLOC ((routes->len + 1) * sizeof (struct zrpc_bgp_apply_route));
+  for (i = 0; i < routes->len; i++)
+    {
+      upd = (Update *)g_ptr_array_index(routes, i);
+      if(upd == NULL || upd->rd == NULL || upd->prefix == NULL)
+        continue;
+      if(prev_rd == NULL || strcmp (prev_rd, upd->rd))
+        {
+          memset (&rd, 0, sizeof (struct zrpc_rd_prefix));
+          valid_rd = zrpc_util_str2rd_prefix (upd->rd, &rd) != 0;
+          rd_key = zrpc_vpnservice_rd_key (&rd);
+          prev_rd = upd->rd;
+        }
+      if(!valid_rd || zrpc_util_str2ipv4_prefix (upd->prefix, &p) == 0)
+        continue;
+      keys[nb_keys].rd_key = rd_key;
+      keys[nb_keys].key = zrpc_vpnservice_pushed_key (&p);
+      nb_keys++;
+    }
+  qsort (keys, nb_keys, sizeof (struct zrpc_bgp_apply_route), zrpc_bgp_apply_route_cmp);
+
+  withdraw = g_ptr_array_new_with_free_func (g_object_unref);
+  for (i = 0; i < table->count; i++)
+    {
+      entry = &table->entries[i];
+      if(entry->pushed.count == 0)
+        continue;
+      key.rd_key = entry->rd_key;
+      zrpc_util_rd_prefix2str (&entry->outbound_rd, rd_str, sizeof (rd_str));
+      for (j = 0; j < entry->pushed.count; j++)
+        {
+          key.key = entry->pushed.entries[j].key;
+          if(bsearch (&key, keys, nb_keys, sizeof (key), zrpc_bgp_apply_route_cmp))
+            continue;
+          zrpc_vpnservice_pushed_prefix (key.key, &p);
+          inet_ntop (AF_INET, &p.prefix, addr, sizeof (addr));
+          snprintf (pfx_str, sizeof (pfx_str), "%s/%u", addr, p.prefixlen);
+          upd = g_object_new (TYPE_UPDATE, NULL);
+          upd->rd = g_strdup (rd_str);
+          upd->prefix = g_strdup (pfx_str);
+          g_ptr_array_add (withdraw, upd);
+        }
+    }
+  ZRPC_FREE (keys);
+  return withdraw;
+}
+
+/*
+ * stale routes are withdrawn, then snapshot routes are pushed. routes
+ * already pushed with same nexthop and label are skipped by the batch.
+ */
+static void
+zrpc_bgp_apply_routes (GPtrArray *withdraw, const GPtrArray *routes,
+                       struct zrpc_bgp_apply *apply)
+{
+  GArray *codes;
+  GError *err = NULL;
+  gboolean ok;
+
+  codes = g_array_new (FALSE, TRUE, sizeof (gint32));
+  if(withdraw->len)
+    {
+      ok = zrpc_bgp_configurator_routes_batch (codes, withdraw, TRUE, &err);
+      zrpc_bgp_apply_codes (apply, ok, codes, &apply->routes_withdrawn, &err);
+      g_array_set_size (codes, 0);
+    }
+  ok = zrpc_bgp_configurator_routes_batch (codes, routes, FALSE, &err);
+  zrpc_bgp_apply_codes (apply, ok, codes, NULL, &err);
+  g_array_unref (codes);
+}
+
+/*
+ * first step of applyConfig, run with exclusive lock: peers and VRFs
+ * are brought to the snapshot. *routes is set when routes are to be
+ * applied afterwards, under VRF locks only.
+ */
+static gboolean
+zrpc_bgp_apply_config_tables (BgpConfiguratorIf *iface, gint32* _return,
+                              const ConfigSnapshot * snapshot, struct zrpc_bgp_apply *apply,
+                              gboolean *routes, GError **error)
+{
+  struct zrpc_vpnservice *ctxt = NULL;
+
+  zrpc_vpnservice_get_context (&ctxt);
+  if(!ctxt)
+    {
+      *_return = BGP_ERR_FAILED;
+      return FALSE;
+    }
+  if(zrpc_vpnservice_get_bgp_context(ctxt) == NULL || zrpc_vpnservice_get_bgp_context(ctxt)->asNumber == 0)
+    {
+      *_return = BGP_ERR_INACTIVE;
+      *error = ERROR_BGP_AS_NOT_STARTED;
+      return FALSE;
+    }
+  if(snapshot == NULL || snapshot->peers == NULL ||
+     snapshot->vrfs == NULL || snapshot->routes == NULL)
+    {
+      *_return = BGP_ERR_PARAM;
+      return TRUE;
+    }
+  zrpc_bgp_apply_peers (ctxt, iface, snapshot->peers, apply);
+  zrpc_bgp_apply_vrfs (ctxt, iface, snapshot->vrfs, apply);
+  *routes = TRUE;
+  return TRUE;
+}
+
 static void
   instance_bgp_configurator_handler_finalize(GObject *object)
 {
   G_OBJECT_CLASS (instance_bgp_configurator_handler_parent_class)->finalize (object);
 }
 
+/* handlers may run on worker threads. they are serialized per VRF,
+ * or per peer, and exclusive when they change bgp instance, VRF or
+ * peer tables */
+#define ZRPC_BGP_LOCK_SHARED 0
+#define ZRPC_BGP_LOCK_VRF    1
+#define ZRPC_BGP_LOCK_PEER   2
+#define ZRPC_BGP_LOCK_ALL    3
+
+static struct zrpc_vpnservice *
+zrpc_bgp_configurator_lock (int mode, uint64_t mask)
+{
+  struct zrpc_vpnservice *ctxt = NULL;
+
+  zrpc_vpnservice_get_context (&ctxt);
+  if(!ctxt)
+    return NULL;
+  if(mode == ZRPC_BGP_LOCK_ALL)
+    {
+      zrpc_vpnservice_lock_all (ctxt);
+      return ctxt;
+    }
+  zrpc_vpnservice_lock_shared (ctxt);
+  if(mode == ZRPC_BGP_LOCK_VRF)
+    zrpc_vpnservice_lock_vrfs (ctxt, mask);
+  else if(mode == ZRPC_BGP_LOCK_PEER)
+    zrpc_vpnservice_lock_peers (ctxt, mask);
+  return ctxt;
+}
+
+static void
+zrpc_bgp_configurator_unlock (struct zrpc_vpnservice *ctxt, int mode, uint64_t mask)
+{
+  if(!ctxt)
+    return;
+  if(mode == ZRPC_BGP_LOCK_ALL)
+    {
+      zrpc_vpnservice_unlock_all (ctxt);
+      return;
+    }
+  if(mode == ZRPC_BGP_LOCK_VRF)
+    zrpc_vpnservice_unlock_vrfs (ctxt, mask);
+  else if(mode == ZRPC_BGP_LOCK_PEER)
+    zrpc_vpnservice_unlock_peers (ctxt, mask);
+  zrpc_vpnservice_unlock_shared (ctxt);
+}
+
+/* locks of all VRFs a batch of routes applies to */
+static uint64_t
+zrpc_bgp_configurator_routes_lock_mask (const GPtrArray * routes)
+{
+  const gchar *prev_rd = NULL;
+  uint64_t mask = 0;
+  Update *upd;
+  guint i;
+
+  for (i = 0; routes && i < routes->len; i++)
+    {
+      upd = (Update *)g_ptr_array_index(routes, i);
+      if(upd == NULL || upd->rd == NULL)
+        continue;
+      if(prev_rd == NULL || strcmp(prev_rd, upd->rd))
+        mask |= zrpc_vpnservice_vrf_lock_mask_str (upd->rd);
+      prev_rd = upd->rd;
+    }
+  return mask;
+}
+
+/*
+ * NAME_locked runs handler NAME with lock mode held on mask, and
+ * accounts it in statistics, as failed when it returns FALSE or when
+ * failed is true. params and args are the parenthesized parameters and
+ * arguments of the handler.
+ */
+#define ZRPC_BGP_LOCKED_HANDLER(name, stats, mode, mask, failed, params, args) \
+static gboolean                                                         \
+instance_bgp_configurator_handler_ ## name ## _locked params            \
+{                                                                       \
+  uint64_t lock_mask = (mask);                                          \
+  struct zrpc_vpnservice *ctxt;                                         \
+  struct zrpc_stats_call call;                                          \
+  gboolean ret;                                                         \
+                                                                        \
+  zrpc_stats_begin (&call, stats);                                      \
+  ctxt = zrpc_bgp_configurator_lock (mode, lock_mask);                  \
+  ret = instance_bgp_configurator_handler_ ## name args;                \
+  zrpc_bgp_configurator_unlock (ctxt, mode, lock_mask);                 \
+  zrpc_stats_end (&call, ret == FALSE || (failed));                     \
+  return ret;                                                           \
+}
+
+ZRPC_BGP_LOCKED_HANDLER (create_peer, ZRPC_STATS_CREATE_PEER,
+                         ZRPC_BGP_LOCK_ALL, 0,
+                         *_return != 0,
+                         (BgpConfiguratorIf *iface, gint32* _return, const gchar *routerId,
+                          const gint64 asNumber, GError **error),
+                         (iface, _return, routerId, asNumber, error))
+
+ZRPC_BGP_LOCKED_HANDLER (start_bgp, ZRPC_STATS_START_BGP,
+                         ZRPC_BGP_LOCK_ALL, 0,
+                         *_return != 0,
+                         (BgpConfiguratorIf *iface, gint32* _return, const gint64 asNumber,
+                          const gchar * routerId, const gint32 port, const gint32 holdTime,
+                          const gint32 keepAliveTime, const gint32 stalepathTime,
+                          const gboolean announceFbit, GError **error),
+                         (iface, _return, asNumber, routerId, port, holdTime,
+                          keepAliveTime, stalepathTime, announceFbit, error))
+
+ZRPC_BGP_LOCKED_HANDLER (stop_bgp, ZRPC_STATS_STOP_BGP,
+                         ZRPC_BGP_LOCK_ALL, 0,
+                         *_return != 0,
+                         (BgpConfiguratorIf *iface, gint32* _return, const gint64 asNumber,
+                          GError **error),
+                         (iface, _return, asNumber, error))
+
+ZRPC_BGP_LOCKED_HANDLER (delete_peer, ZRPC_STATS_DELETE_PEER,
+                         ZRPC_BGP_LOCK_ALL, 0,
+                         *_return != 0,
+                         (BgpConfiguratorIf *iface, gint32* _return, const gchar * ipAddress,
+                          GError **error),
+                         (iface, _return, ipAddress, error))
+
+ZRPC_BGP_LOCKED_HANDLER (add_vrf, ZRPC_STATS_ADD_VRF,
+                         ZRPC_BGP_LOCK_ALL, 0,
+                         *_return != 0,
+                         (BgpConfiguratorIf *iface, gint32* _return, const gchar * rd,
+                          const GPtrArray * irts, const GPtrArray * erts, GError **error),
+                         (iface, _return, rd, irts, erts, error))
+
+ZRPC_BGP_LOCKED_HANDLER (del_vrf, ZRPC_STATS_DEL_VRF,
+                         ZRPC_BGP_LOCK_ALL, 0,
+                         *_return != 0,
+                         (BgpConfiguratorIf *iface, gint32* _return, const gchar * rd,
+                          GError **error),
+                         (iface, _return, rd, error))
+
+ZRPC_BGP_LOCKED_HANDLER (push_route, ZRPC_STATS_PUSH_ROUTE,
+                         ZRPC_BGP_LOCK_VRF, zrpc_vpnservice_vrf_lock_mask_str (rd),
+                         *_return != 0,
+                         (BgpConfiguratorIf *iface, gint32* _return, const gchar * prefix,
+                          const gchar * nexthop, const gchar * rd, const gint32 label,
+                          GError **error),
+                         (iface, _return, prefix, nexthop, rd, label, error))
+
+ZRPC_BGP_LOCKED_HANDLER (withdraw_route, ZRPC_STATS_WITHDRAW_ROUTE,
+                         ZRPC_BGP_LOCK_VRF, zrpc_vpnservice_vrf_lock_mask_str (rd),
+                         *_return != 0,
+                         (BgpConfiguratorIf *iface, gint32* _return, const gchar * prefix,
+                          const gchar * rd, GError **error),
+                         (iface, _return, prefix, rd, error))
+
+ZRPC_BGP_LOCKED_HANDLER (set_ebgp_multihop, ZRPC_STATS_SET_EBGP_MULTIHOP,
+                         ZRPC_BGP_LOCK_PEER, zrpc_vpnservice_peer_lock_mask (peerIp),
+                         *_return != 0,
+                         (BgpConfiguratorIf *iface, gint32* _return, const gchar * peerIp,
+                          const gint32 nHops, GError **error),
+                         (iface, _return, peerIp, nHops, error))
+
+ZRPC_BGP_LOCKED_HANDLER (unset_ebgp_multihop, ZRPC_STATS_UNSET_EBGP_MULTIHOP,
+                         ZRPC_BGP_LOCK_PEER, zrpc_vpnservice_peer_lock_mask (peerIp),
+                         *_return != 0,
+                         (BgpConfiguratorIf *iface, gint32* _return, const gchar * peerIp,
+                          GError **error),
+                         (iface, _return, peerIp, error))
+
+ZRPC_BGP_LOCKED_HANDLER (set_update_source, ZRPC_STATS_SET_UPDATE_SOURCE,
+                         ZRPC_BGP_LOCK_PEER, zrpc_vpnservice_peer_lock_mask (peerIp),
+                         *_return != 0,
+                         (BgpConfiguratorIf *iface, gint32* _return, const gchar * peerIp,
+                          const gchar * srcIp, GError **error),
+                         (iface, _return, peerIp, srcIp, error))
+
+ZRPC_BGP_LOCKED_HANDLER (unset_update_source, ZRPC_STATS_UNSET_UPDATE_SOURCE,
+                         ZRPC_BGP_LOCK_PEER, zrpc_vpnservice_peer_lock_mask (peerIp),
+                         *_return != 0,
+                         (BgpConfiguratorIf *iface, gint32* _return, const gchar * peerIp,
+                          GError **error),
+                         (iface, _return, peerIp, error))
+
+ZRPC_BGP_LOCKED_HANDLER (enable_address_family, ZRPC_STATS_ENABLE_ADDRESS_FAMILY,
+                         ZRPC_BGP_LOCK_PEER, zrpc_vpnservice_peer_lock_mask (peerIp),
+                         *_return != 0,
+                         (BgpConfiguratorIf *iface, gint32* _return, const gchar * peerIp,
+                          const af_afi afi, const af_safi safi, GError **error),
+                         (iface, _return, peerIp, afi, safi, error))
+
+ZRPC_BGP_LOCKED_HANDLER (disable_address_family, ZRPC_STATS_DISABLE_ADDRESS_FAMILY,
+                         ZRPC_BGP_LOCK_PEER, zrpc_vpnservice_peer_lock_mask (peerIp),
+                         *_return != 0,
+                         (BgpConfiguratorIf *iface, gint32* _return, const gchar * peerIp,
+                          const af_afi afi, const af_safi safi, GError **error),
+                         (iface, _return, peerIp, afi, safi, error))
+
+ZRPC_BGP_LOCKED_HANDLER (set_log_config, ZRPC_STATS_SET_LOG_CONFIG,
+                         ZRPC_BGP_LOCK_ALL, 0,
+                         *_return != 0,
+                         (BgpConfiguratorIf *iface, gint32* _return, const gchar * logFileName,
+                          const gchar * logLevel, GError **error),
+                         (iface, _return, logFileName, logLevel, error))
+
+ZRPC_BGP_LOCKED_HANDLER (enable_graceful_restart, ZRPC_STATS_ENABLE_GRACEFUL_RESTART,
+                         ZRPC_BGP_LOCK_ALL, 0,
+                         *_return != 0,
+                         (BgpConfiguratorIf *iface, gint32* _return,
+                          const gint32 stalepathTime, GError **error),
+                         (iface, _return, stalepathTime, error))
+
+ZRPC_BGP_LOCKED_HANDLER (disable_graceful_restart, ZRPC_STATS_DISABLE_GRACEFUL_RESTART,
+                         ZRPC_BGP_LOCK_ALL, 0,
+                         *_return != 0,
+                         (BgpConfiguratorIf *iface, gint32* _return, GError **error),
+                         (iface, _return, error))
+
+ZRPC_BGP_LOCKED_HANDLER (get_routes, ZRPC_STATS_GET_ROUTES,
+                         ZRPC_BGP_LOCK_SHARED, 0,
+                         *_return == NULL || (*_return)->errcode != 0,
+                         (BgpConfiguratorIf *iface, Routes ** _return,
+                          const gint32 optype, const gint32 winSize, GError **error),
+                         (iface, _return, optype, winSize, error))
+
+ZRPC_BGP_LOCKED_HANDLER (enable_multipath, ZRPC_STATS_ENABLE_MULTIPATH,
+                         ZRPC_BGP_LOCK_ALL, 0,
+                         *_return != 0,
+                         (BgpConfiguratorIf *iface, gint32* _return, const af_afi afi,
+                          const af_safi safi, GError **error),
+                         (iface, _return, afi, safi, error))
+
+ZRPC_BGP_LOCKED_HANDLER (disable_multipath, ZRPC_STATS_DISABLE_MULTIPATH,
+                         ZRPC_BGP_LOCK_ALL, 0,
+                         *_return != 0,
+                         (BgpConfiguratorIf *iface, gint32* _return, const af_afi afi,
+                          const af_safi safi, GError **error),
+                         (iface, _return, afi, safi, error))
+
+ZRPC_BGP_LOCKED_HANDLER (multipaths, ZRPC_STATS_MULTIPATHS,
+                         ZRPC_BGP_LOCK_VRF, zrpc_vpnservice_vrf_lock_mask_str (rd),
+                         *_return != 0,
+                         (BgpConfiguratorIf *iface, gint32* _return, const gchar * rd,
+                          const gint32 maxPath, GError **error),
+                         (iface, _return, rd, maxPath, error))
+
+ZRPC_BGP_LOCKED_HANDLER (push_routes, ZRPC_STATS_PUSH_ROUTES,
+                         ZRPC_BGP_LOCK_VRF, zrpc_bgp_configurator_routes_lock_mask (routes),
+                         FALSE,
+                         (BgpConfiguratorIf *iface, GArray ** _return,
+                          const GPtrArray * routes, GError **error),
+                         (iface, _return, routes, error))
+
+ZRPC_BGP_LOCKED_HANDLER (withdraw_routes, ZRPC_STATS_WITHDRAW_ROUTES,
+                         ZRPC_BGP_LOCK_VRF, zrpc_bgp_configurator_routes_lock_mask (routes),
+                         FALSE,
+                         (BgpConfiguratorIf *iface, GArray ** _return,
+                          const GPtrArray * routes, GError **error),
+                         (iface, _return, routes, error))
+
+ZRPC_BGP_LOCKED_HANDLER (resume_notifications, ZRPC_STATS_RESUME_NOTIFICATIONS,
+                         ZRPC_BGP_LOCK_SHARED, 0,
+                         *_return != 0,
+                         (BgpConfiguratorIf *iface, gint32* _return, const gint64 fromSeq,
+                          GError **error),
+                         (iface, _return, fromSeq, error))
+
+/*
+ * Bring bgpd to a configuration snapshot, by sending only what
+ * differs from the configuration done through zrpcd.
+ * The first error code met is returned, all differences are tried.
+ * Peers and VRFs are applied with exclusive lock. Stale routes are
+ * then listed and withdrawn, and routes pushed, under the locks of
+ * all VRFs, so that no route call interleaves with the diff.
+ */
+static gboolean
+instance_bgp_configurator_handler_apply_config_locked (BgpConfiguratorIf *iface, gint32* _return,
+                                                       const ConfigSnapshot * snapshot, GError **error)
+{
+  struct zrpc_bgp_apply apply;
+  struct zrpc_vpnservice *ctxt;
+  struct zrpc_stats_call call;
+  GPtrArray *withdraw;
+  gboolean ret, routes = FALSE;
+  uint64_t mask;
+
+  zrpc_stats_begin (&call, ZRPC_STATS_APPLY_CONFIG);
+  memset (&apply, 0, sizeof (struct zrpc_bgp_apply));
+  ctxt = zrpc_bgp_configurator_lock (ZRPC_BGP_LOCK_ALL, 0);
+  ret = zrpc_bgp_apply_config_tables (iface, _return, snapshot, &apply, &routes, error);
+  zrpc_bgp_configurator_unlock (ctxt, ZRPC_BGP_LOCK_ALL, 0);
+  if(routes)
+    {
+      ctxt = zrpc_bgp_configurator_lock (ZRPC_BGP_LOCK_SHARED, 0);
+      mask = zrpc_bgp_apply_vrfs_lock_mask (ctxt) |
+        zrpc_bgp_configurator_routes_lock_mask (snapshot->routes);
+      zrpc_vpnservice_lock_vrfs (ctxt, mask);
+      withdraw = zrpc_bgp_apply_stale_routes (ctxt, snapshot->routes);
+      zrpc_bgp_apply_routes (withdraw, snapshot->routes, &apply);
+      zrpc_vpnservice_unlock_vrfs (ctxt, mask);
+      zrpc_bgp_configurator_unlock (ctxt, ZRPC_BGP_LOCK_SHARED, 0);
+      g_ptr_array_unref (withdraw);
+      if(IS_ZRPC_DEBUG)
+        zrpc_log ("applyConfig: peers +%u -%u ~%u, vrfs +%u -%u ~%u, routes -%u %s",
+                  apply.peers_added, apply.peers_deleted, apply.peers_changed,
+                  apply.vrfs_added, apply.vrfs_deleted, apply.vrfs_changed,
+                  apply.routes_withdrawn, apply.ret == 0 ? "OK" : "NOK");
+      *_return = apply.ret;
+    }
+  zrpc_stats_end (&call, ret == FALSE || *_return != 0);
+  return ret;
+}
+
 /* InstanceBgpConfiguratorHandler's class initializer */
 static void
 instance_bgp_configurator_handler_class_init (InstanceBgpConfiguratorHandlerClass *klass)
@@ -1983,67 +3303,79 @@ instance_bgp_configurator_handler_class_init (InstanceBgpConfiguratorHandlerClas
 
   /* Register our implementations of CalculatorHandler's methods */
   bgp_configurator_handler_class->create_peer =
-    instance_bgp_configurator_handler_create_peer;
+    instance_bgp_configurator_handler_create_peer_locked;
  
   bgp_configurator_handler_class->start_bgp =
-    instance_bgp_configurator_handler_start_bgp;
+    instance_bgp_configurator_handler_start_bgp_locked;
 
   bgp_configurator_handler_class->stop_bgp =
-    instance_bgp_configurator_handler_stop_bgp;
+    instance_bgp_configurator_handler_stop_bgp_locked;
 
   bgp_configurator_handler_class->delete_peer =
-    instance_bgp_configurator_handler_delete_peer;
+    instance_bgp_configurator_handler_delete_peer_locked;
 
   bgp_configurator_handler_class->add_vrf =
-    instance_bgp_configurator_handler_add_vrf;
+    instance_bgp_configurator_handler_add_vrf_locked;
 
   bgp_configurator_handler_class->del_vrf =
-    instance_bgp_configurator_handler_del_vrf;
+    instance_bgp_configurator_handler_del_vrf_locked;
 
   bgp_configurator_handler_class->push_route =
-    instance_bgp_configurator_handler_push_route;
+    instance_bgp_configurator_handler_push_route_locked;
 
   bgp_configurator_handler_class->withdraw_route =
-    instance_bgp_configurator_handler_withdraw_route;
+    instance_bgp_configurator_handler_withdraw_route_locked;
 
  bgp_configurator_handler_class->set_ebgp_multihop =
-   instance_bgp_configurator_handler_set_ebgp_multihop;
+   instance_bgp_configurator_handler_set_ebgp_multihop_locked;
 
  bgp_configurator_handler_class->unset_ebgp_multihop =
-   instance_bgp_configurator_handler_unset_ebgp_multihop;
+   instance_bgp_configurator_handler_unset_ebgp_multihop_locked;
 
  bgp_configurator_handler_class->set_update_source = 
-   instance_bgp_configurator_handler_set_update_source;
+   instance_bgp_configurator_handler_set_update_source_locked;
 
  bgp_configurator_handler_class->unset_update_source = 
-   instance_bgp_configurator_handler_unset_update_source;
+   instance_bgp_configurator_handler_unset_update_source_locked;
 
  bgp_configurator_handler_class->enable_address_family =
-   instance_bgp_configurator_handler_enable_address_family;
+   instance_bgp_configurator_handler_enable_address_family_locked;
 
  bgp_configurator_handler_class->disable_address_family = 
-   instance_bgp_configurator_handler_disable_address_family;
+   instance_bgp_configurator_handler_disable_address_family_locked;
 
  bgp_configurator_handler_class->set_log_config = 
-   instance_bgp_configurator_handler_set_log_config;
+   instance_bgp_configurator_handler_set_log_config_locked;
 
  bgp_configurator_handler_class->enable_graceful_restart = 
-   instance_bgp_configurator_handler_enable_graceful_restart;
+   instance_bgp_configurator_handler_enable_graceful_restart_locked;
 
  bgp_configurator_handler_class->disable_graceful_restart = 
-   instance_bgp_configurator_handler_disable_graceful_restart;
+   instance_bgp_configurator_handler_disable_graceful_restart_locked;
 
  bgp_configurator_handler_class->get_routes = 
-   instance_bgp_configurator_handler_get_routes;
+   instance_bgp_configurator_handler_get_routes_locked;
 
  bgp_configurator_handler_class->enable_multipath =
-   instance_bgp_configurator_handler_enable_multipath;
+   instance_bgp_configurator_handler_enable_multipath_locked;
 
  bgp_configurator_handler_class->disable_multipath =
-   instance_bgp_configurator_handler_disable_multipath;
+   instance_bgp_configurator_handler_disable_multipath_locked;
 
  bgp_configurator_handler_class->multipaths =
-   instance_bgp_configurator_handler_multipaths;
+   instance_bgp_configurator_handler_multipaths_locked;
+
+ bgp_configurator_handler_class->push_routes =
+   instance_bgp_configurator_handler_push_routes_locked;
+
+ bgp_configurator_handler_class->withdraw_routes =
+   instance_bgp_configurator_handler_withdraw_routes_locked;
+
+ bgp_configurator_handler_class->resume_notifications =
+   instance_bgp_configurator_handler_resume_notifications_locked;
+
+ bgp_configurator_handler_class->apply_config =
+   instance_bgp_configurator_handler_apply_config_locked;
 }
 
 /* InstanceBgpConfiguratorHandler's instance initializer (constructor) */
@@ -21,17 +21,15 @@
  * sent when a vpnv4 route is pushed
  */
 gboolean
-zrpc_bgp_updater_on_update_push_route (const gchar * rd, const gchar * prefix, \
+zrpc_bgp_updater_on_update_push_route (BgpUpdaterIf *client, const gchar * rd, const gchar * prefix, \
                                           const gint32 prefixlen, const gchar * nexthop, const gint32 label)
 {
   GError *error = NULL;
   gboolean response;
-  struct zrpc_vpnservice *ctxt = NULL;
 
-  zrpc_vpnservice_get_context (&ctxt);
-  if(!ctxt || !ctxt->bgp_updater_client)
+  if(!client)
       return FALSE;
-  response = bgp_updater_client_send_on_update_push_route(ctxt->bgp_updater_client, \
+  response = bgp_updater_client_send_on_update_push_route(client, \
                                                             rd, prefix, prefixlen, nexthop, label, &error);
   if(IS_ZRPC_DEBUG_NOTIFICATION)
     zrpc_log ("onUpdatePushRoute(rd %s, pfx %s, nh %s, label %d)", \
@@ -44,16 +42,14 @@ zrpc_bgp_updater_on_update_push_route (const gchar * rd, const gchar * prefix, \
  * sent when a vpnv4 route is withdrawn
  */
 gboolean
-zrpc_bgp_updater_on_update_withdraw_route (const gchar * rd, const gchar * prefix, const gint32 prefixlen, const gchar * nexthop,  const gint32 label)
+zrpc_bgp_updater_on_update_withdraw_route (BgpUpdaterIf *client, const gchar * rd, const gchar * prefix, const gint32 prefixlen, const gchar * nexthop,  const gint32 label)
 {
   GError *error = NULL;
   gboolean response;
-  struct zrpc_vpnservice *ctxt = NULL;
 
-  zrpc_vpnservice_get_context (&ctxt);
-  if(!ctxt || !ctxt->bgp_updater_client)
+  if(!client)
       return FALSE;
-  response = bgp_updater_client_on_update_withdraw_route(ctxt->bgp_updater_client, \
+  response = bgp_updater_client_on_update_withdraw_route(client, \
                                                          rd, prefix, prefixlen, nexthop,
                                                          label, &error);
   if(IS_ZRPC_DEBUG_NOTIFICATION)
@@ -68,16 +64,14 @@ zrpc_bgp_updater_on_update_withdraw_route (const gchar * rd, const gchar * prefi
  * available to receive thrift configuration commands
  */
 gboolean
-zrpc_bgp_updater_on_start_config_resync_notification (void)
+zrpc_bgp_updater_on_start_config_resync_notification (BgpUpdaterIf *client)
 {
   GError *error = NULL;
   gboolean response;
-  struct zrpc_vpnservice *ctxt = NULL;
 
-  zrpc_vpnservice_get_context (&ctxt);
-  if(!ctxt || !ctxt->bgp_updater_client)
+  if(!client)
       return FALSE;
-  response = bgp_updater_client_on_start_config_resync_notification(ctxt->bgp_updater_client, &error);
+  response = bgp_updater_client_on_start_config_resync_notification(client, &error);
   if(IS_ZRPC_DEBUG_NOTIFICATION)
     zrpc_log ("onStartConfigResyncNotification()");
   return response;
@@ -87,19 +81,36 @@ zrpc_bgp_updater_on_start_config_resync_notification (void)
  * send event notification message
  */
 gboolean
-zrpc_bgp_updater_on_notification_send_event (const gchar * prefix, const gint8 errCode, const gint8 errSubcode)
+zrpc_bgp_updater_on_notification_send_event (BgpUpdaterIf *client, const gchar * prefix, const gint8 errCode, const gint8 errSubcode)
 {
   GError *error = NULL;
   gboolean response;
-  struct zrpc_vpnservice *ctxt = NULL;
 
-  zrpc_vpnservice_get_context (&ctxt);
-  if(!ctxt || !ctxt->bgp_updater_client)
+  if(!client)
       return FALSE;
-  response = bgp_updater_client_on_notification_send_event(ctxt->bgp_updater_client, \
+  response = bgp_updater_client_on_notification_send_event(client, \
                                                            prefix, errCode, errSubcode, &error); 
   if(IS_ZRPC_DEBUG_NOTIFICATION)
     zrpc_log ("onNotificationSendEvent(%s, errCode %d, errSubCode %d)", \
                 prefix, errCode, errSubcode);
   return response;
 }
+
+/*
+ * several route updates in a single notification message
+ * frame is written and flushed once for the whole batch
+ */
+gboolean
+zrpc_bgp_updater_on_update_batch (BgpUpdaterIf *client, const GPtrArray * updates)
+{
+  GError *error = NULL;
+  gboolean response;
+
+  if(!client)
+      return FALSE;
+  response = bgp_updater_client_on_update_batch(client, \
+                                                updates, &error);
+  if(IS_ZRPC_DEBUG_NOTIFICATION)
+    zrpc_log ("onUpdateBatch(%u updates)", updates->len);
+  return response;
+}
@@ -11,17 +11,20 @@
 
 
 gboolean
-zrpc_bgp_updater_on_notification_send_event (const gchar * prefix, const gint8 errCode, const gint8 errSubcode);
+zrpc_bgp_updater_on_notification_send_event (BgpUpdaterIf *client, const gchar * prefix, const gint8 errCode, const gint8 errSubcode);
 
 gboolean
-zrpc_bgp_updater_on_start_config_resync_notification (void);
+zrpc_bgp_updater_on_start_config_resync_notification (BgpUpdaterIf *client);
 
 gboolean
-zrpc_bgp_updater_on_update_withdraw_route (const gchar * rd, const gchar * prefix, const gint32 prefixlen,
+zrpc_bgp_updater_on_update_withdraw_route (BgpUpdaterIf *client, const gchar * rd, const gchar * prefix, const gint32 prefixlen,
                                               const gchar * nexthop, const gint32 label);
 
 gboolean
-zrpc_bgp_updater_on_update_push_route (const gchar * rd, const gchar * prefix, \
+zrpc_bgp_updater_on_update_push_route (BgpUpdaterIf *client, const gchar * rd, const gchar * prefix, \
                                           const gint32 prefixlen, const gchar * nexthop, const gint32 label);
 
+gboolean
+zrpc_bgp_updater_on_update_batch (BgpUpdaterIf *client, const GPtrArray * updates);
+
 #endif /* _ZRPC_BGP_UPDATER_H */
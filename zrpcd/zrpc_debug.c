@@ -9,10 +9,18 @@
 #include <stdio.h>
 #include <time.h>
 
+#include "thread.h"
 #include "vty.h"
 #include "command.h"
 
+#include "zrpcd/zrpc_thrift_wrapper.h"
+#include "zrpcd/bgp_configurator.h"
+#include "zrpcd/bgp_updater.h"
+#include "zrpcd/zrpc_bgp_configurator.h"
+#include "zrpcd/zrpc_vpnservice.h"
+#include "zrpcd/zrpcd.h"
 #include "zrpcd/zrpc_debug.h"
+#include "zrpcd/zrpc_stats.h"
 
 #define ZRPC_STR "ZRPC Information\n"
 
@@ -131,6 +139,236 @@ DEFUN (no_debug_zrpc_cache,
   return CMD_SUCCESS;
 }
 
+DEFUN (show_zrpc_notifications,
+       show_zrpc_notifications_cmd,
+       "show zrpc notifications",
+       SHOW_STR
+       ZRPC_STR
+       "Notifications sent to BGP updater client\n")
+{
+  struct zrpc_vpnservice *ctxt;
+  struct zrpc_vpnservice_updater *updater;
+  struct zrpc_vpnservice_notif_queue *queue;
+  unsigned int i;
+
+  if (tm->zrpc == NULL || tm->zrpc->zrpc_vpnservice == NULL)
+    return CMD_SUCCESS;
+  ctxt = tm->zrpc->zrpc_vpnservice;
+  vty_out (vty, "BGP updater notifications: received %u%s",
+           ctxt->bgp_update_total, VTY_NEWLINE);
+  vty_out (vty, "  to notification thread: depth %u, size %u, high-water mark %u, dropped %u%s",
+           ctxt->notif_ring.tail - ctxt->notif_ring.head, ctxt->notif_ring.size,
+           ctxt->notif_ring.high_water, ctxt->notif_ring.drops, VTY_NEWLINE);
+  for (i = 0; i < ctxt->nb_updaters; i++)
+    {
+      updater = &ctxt->updaters[i];
+      queue = &updater->notif_queue;
+      vty_out (vty, "BGP updater client %s:%u, %s:%s", updater->address,
+               ctxt->zrpc_notification_port,
+               updater->status == TRUE ? "connected" : "not connected",
+               VTY_NEWLINE);
+      vty_out (vty, "  lost %u, retries %u, monitor %u%s",
+               updater->lost_msgs, updater->retries, updater->monitor,
+               VTY_NEWLINE);
+      if (ctxt->bgp_updater_frames)
+        vty_out (vty, "  messages shared with other clients %llu%s",
+                 (unsigned long long)updater->frames_shared, VTY_NEWLINE);
+      vty_out (vty, "  Notification queue:%s", VTY_NEWLINE);
+      vty_out (vty, "    depth %u, size %u, high-water mark %u%s",
+               queue->tail - queue->head, queue->size,
+               queue->high_water, VTY_NEWLINE);
+      vty_out (vty, "    enqueued %llu, sent %llu, dropped %llu%s",
+               (unsigned long long)queue->enqueued,
+               (unsigned long long)queue->sent,
+               (unsigned long long)queue->drops, VTY_NEWLINE);
+      if (tm->notif_batch_size > 1)
+        vty_out (vty, "    batches %llu, batch size %u, batch delay %uus%s",
+                 (unsigned long long)queue->batches, tm->notif_batch_size,
+                 tm->notif_batch_delay, VTY_NEWLINE);
+      if (tm->notif_coalesce_window)
+        vty_out (vty, "    coalesced %llu, coalescing window %ums%s",
+                 (unsigned long long)queue->coalesced,
+                 tm->notif_coalesce_window, VTY_NEWLINE);
+      if (queue->retained)
+        vty_out (vty, "    next seq %llu, retained %u/%u, resumes %u, replayed %llu%s",
+                 (unsigned long long)queue->next_seq, queue->nb_retained,
+                 queue->retain_size, queue->resumes,
+                 (unsigned long long)queue->replayed, VTY_NEWLINE);
+      if (queue->journal)
+        {
+          vty_out (vty, "  Notification journal %s:%s",
+                   queue->journal->path, VTY_NEWLINE);
+          vty_out (vty, "    depth %u, size %u, high-water mark %u%s",
+                   zrpc_journal_count (queue->journal),
+                   zrpc_journal_size (queue->journal),
+                   queue->journal_high_water, VTY_NEWLINE);
+          vty_out (vty, "    journaled %llu, overflows %u, resyncs %u%s",
+                   (unsigned long long)queue->journaled, queue->overflows,
+                   queue->resyncs, VTY_NEWLINE);
+        }
+    }
+  return CMD_SUCCESS;
+}
+
+DEFUN (show_zrpc_statistics,
+       show_zrpc_statistics_cmd,
+       "show zrpc statistics",
+       SHOW_STR
+       ZRPC_STR
+       "Configurator requests latency\n")
+{
+  struct zrpc_stats_counters counters;
+  char buf[32];
+  int rpc, i, last;
+
+  vty_out (vty, "Call                    Calls     Errors  Avg(us)   Max(us)  bgpd calls  bgpd avg(us)%s",
+           VTY_NEWLINE);
+  for (rpc = 0; rpc < ZRPC_STATS_RPC_MAX; rpc++)
+    {
+      zrpc_stats_get (rpc, &counters);
+      if (counters.calls == 0)
+        continue;
+      vty_out (vty, "%-22s %6llu %10llu %8llu %9llu %11llu %13llu%s",
+               zrpc_stats_name (rpc),
+               (unsigned long long)counters.calls,
+               (unsigned long long)counters.errors,
+               (unsigned long long)(counters.time_us / counters.calls),
+               (unsigned long long)counters.max_us,
+               (unsigned long long)counters.qzc_calls,
+               (unsigned long long)(counters.qzc_calls ?
+                                    counters.qzc_time_us / counters.qzc_calls : 0),
+               VTY_NEWLINE);
+      /* latency histogram, up to the slowest bucket used */
+      for (last = ZRPC_STATS_BUCKETS - 1; last > 0 && !counters.buckets[last]; last--);
+      vty_out (vty, " ");
+      for (i = 0; i <= last; i++)
+        {
+          if (i == ZRPC_STATS_BUCKETS - 1)
+            snprintf (buf, sizeof (buf), ">=%lluus", 1ULL << (i - 1));
+          else
+            snprintf (buf, sizeof (buf), "<%lluus", 1ULL << i);
+          if (counters.buckets[i])
+            vty_out (vty, " %s:%llu", buf, (unsigned long long)counters.buckets[i]);
+        }
+      vty_out (vty, "%s", VTY_NEWLINE);
+    }
+  return CMD_SUCCESS;
+}
+
+DEFUN (clear_zrpc_statistics,
+       clear_zrpc_statistics_cmd,
+       "clear zrpc statistics",
+       CLEAR_STR
+       ZRPC_STR
+       "Configurator requests latency\n")
+{
+  zrpc_stats_clear ();
+  return CMD_SUCCESS;
+}
+
+/* elem id of profile slot */
+static const char *
+zrpc_qzc_profile_elem (int elem, char *buf, size_t size)
+{
+  if (elem == ZRPC_STATS_QZC_ELEMS - 1)
+    return "-";
+  snprintf (buf, size, "%d", elem);
+  return buf;
+}
+
+DEFUN (show_zrpc_qzc_profile,
+       show_zrpc_qzc_profile_cmd,
+       "show zrpc qzc profile",
+       SHOW_STR
+       ZRPC_STR
+       "Requests to bgpd\n"
+       "Round trips per request type and elem id\n")
+{
+  struct zrpc_stats_qzc_snapshot *snapshot;
+  struct zrpc_stats_qzc_counters *counters;
+  char buf[16];
+  int type, elem;
+
+  snapshot = ZRPC_MALLOC (sizeof (*snapshot));
+  zrpc_stats_qzc_snapshot (snapshot);
+  vty_out (vty, "Type        Elem      Calls   Errors  Sent(B)/call  Recv(B)/call  Avg(us)   Max(us)%s",
+           VTY_NEWLINE);
+  for (type = 0; type < ZRPC_STATS_QZC_TYPES; type++)
+    for (elem = 0; elem < ZRPC_STATS_QZC_ELEMS; elem++)
+      {
+        counters = &snapshot->counters[type][elem];
+        if (counters->calls == 0)
+          continue;
+        vty_out (vty, "%-10s %5s %10llu %8llu %13llu %13llu %8llu %9llu%s",
+                 zrpc_stats_qzc_type_name (type),
+                 zrpc_qzc_profile_elem (elem, buf, sizeof (buf)),
+                 (unsigned long long)counters->calls,
+                 (unsigned long long)counters->errors,
+                 (unsigned long long)(counters->bytes_sent / counters->calls),
+                 (unsigned long long)(counters->bytes_received / counters->calls),
+                 (unsigned long long)(counters->time_us / counters->calls),
+                 (unsigned long long)counters->max_us, VTY_NEWLINE);
+      }
+  ZRPC_FREE (snapshot);
+  return CMD_SUCCESS;
+}
+
+DEFUN (show_zrpc_qzc_profile_csv,
+       show_zrpc_qzc_profile_csv_cmd,
+       "show zrpc qzc profile csv",
+       SHOW_STR
+       ZRPC_STR
+       "Requests to bgpd\n"
+       "Round trips per request type and elem id\n"
+       "Dump raw counters, with latency histogram, as CSV\n")
+{
+  struct zrpc_stats_qzc_snapshot *snapshot;
+  struct zrpc_stats_qzc_counters *counters;
+  char buf[16];
+  int type, elem, i;
+
+  snapshot = ZRPC_MALLOC (sizeof (*snapshot));
+  zrpc_stats_qzc_snapshot (snapshot);
+  /* bucket i counts round trips under 2^i us */
+  vty_out (vty, "type,elem,calls,errors,bytes_sent,bytes_received,time_us,max_us");
+  for (i = 0; i < ZRPC_STATS_BUCKETS; i++)
+    vty_out (vty, ",bucket%d", i);
+  vty_out (vty, "%s", VTY_NEWLINE);
+  for (type = 0; type < ZRPC_STATS_QZC_TYPES; type++)
+    for (elem = 0; elem < ZRPC_STATS_QZC_ELEMS; elem++)
+      {
+        counters = &snapshot->counters[type][elem];
+        if (counters->calls == 0)
+          continue;
+        vty_out (vty, "%s,%s,%llu,%llu,%llu,%llu,%llu,%llu",
+                 zrpc_stats_qzc_type_name (type),
+                 zrpc_qzc_profile_elem (elem, buf, sizeof (buf)),
+                 (unsigned long long)counters->calls,
+                 (unsigned long long)counters->errors,
+                 (unsigned long long)counters->bytes_sent,
+                 (unsigned long long)counters->bytes_received,
+                 (unsigned long long)counters->time_us,
+                 (unsigned long long)counters->max_us);
+        for (i = 0; i < ZRPC_STATS_BUCKETS; i++)
+          vty_out (vty, ",%llu", (unsigned long long)counters->buckets[i]);
+        vty_out (vty, "%s", VTY_NEWLINE);
+      }
+  ZRPC_FREE (snapshot);
+  return CMD_SUCCESS;
+}
+
+DEFUN (clear_zrpc_qzc_profile,
+       clear_zrpc_qzc_profile_cmd,
+       "clear zrpc qzc profile",
+       CLEAR_STR
+       ZRPC_STR
+       "Requests to bgpd\n"
+       "Round trips per request type and elem id\n")
+{
+  zrpc_stats_qzc_clear ();
+  return CMD_SUCCESS;
+}
+
 /* Debug node. */
 static struct cmd_node debug_node =
 {
@@ -188,6 +426,12 @@ zrpc_debug_init (void)
   install_element (ENABLE_NODE, &no_debug_zrpc_network_cmd);
   install_element (ENABLE_NODE, &debug_zrpc_cache_cmd);
   install_element (ENABLE_NODE, &no_debug_zrpc_cache_cmd);
+  install_element (ENABLE_NODE, &show_zrpc_notifications_cmd);
+  install_element (ENABLE_NODE, &show_zrpc_statistics_cmd);
+  install_element (ENABLE_NODE, &clear_zrpc_statistics_cmd);
+  install_element (ENABLE_NODE, &show_zrpc_qzc_profile_cmd);
+  install_element (ENABLE_NODE, &show_zrpc_qzc_profile_csv_cmd);
+  install_element (ENABLE_NODE, &clear_zrpc_qzc_profile_cmd);
 
   zrpc_debug |= ZRPC_DEBUG_NOTIFICATION;
   zrpc_debug |= ZRPC_DEBUG;
@@ -29,7 +29,57 @@ struct zrpc_global
   /* zrpcd parameters */
   uint16_t zrpc_notification_port;
   uint16_t zrpc_listen_port;
-  char *zrpc_notification_address;
+  /* unix socket path configurator also listens on, if set */
+  char *zrpc_listen_path;
+  /* BGP updater notification targets. -N may be given several times,
+   * the first one replaces the default address. an absolute path is
+   * a unix socket */
+#define ZRPC_NOTIFICATION_ADDRESS_MAX 8
+  char *zrpc_notification_address[ZRPC_NOTIFICATION_ADDRESS_MAX];
+  unsigned int zrpc_notification_address_count;
+
+  /* thrift protocol of configurator server, and of updater client */
+  int configurator_protocol;
+  int notif_protocol;
+
+  /* number of threads running configurator requests. 0 runs them
+   * in main thread */
+  unsigned int worker_threads;
+
+  /* maximum number of outstanding QZC requests */
+  unsigned int qzc_window;
+
+  /* biggest configurator request accepted, in bytes. bigger ones
+   * are answered with BGP_ERR_PARAM */
+  unsigned int request_max_size;
+
+  /* maximum time spent in one getRoutes call, in ms. 0 for no limit */
+  unsigned int get_routes_time_budget;
+
+  /* size of the notification queue to the BGP updater client */
+  unsigned int notif_queue_size;
+
+  /* onUpdateBatch is used if batch size is greater than 1. routes are
+   * accumulated up to batch size entries or batch delay, in us */
+  unsigned int notif_batch_size;
+  unsigned int notif_batch_delay;
+
+  /* time in ms route notifications are held to merge later updates
+   * of the same prefix. 0 disables coalescing */
+  unsigned int notif_coalesce_window;
+
+  /* number of sent route notifications kept for resumeNotifications.
+   * 0 disables sequence numbers */
+  unsigned int notif_retention;
+
+  /* time in seconds a BGP updater connection may stay silent, or
+   * sent data unacknowledged, before it is declared dead. 0 disables
+   * TCP keepalive */
+  unsigned int notif_keepalive;
+
+  /* memory mapped journal used when notification queue is full */
+  char *notif_journal_path;
+  unsigned int notif_journal_size;
 };
 
 /* Global thread strucutre. */
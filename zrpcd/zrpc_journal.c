@@ -0,0 +1,117 @@
+/* zrpc memory mapped journal
+ * Copyright (c) 2016 6WIND,
+ *
+ * This file is part of ZRPC daemon.
+ *
+ * See the LICENSE file.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include "zrpcd/zrpc_memory.h"
+#include "zrpcd/zrpc_debug.h"
+#include "zrpcd/zrpc_journal.h"
+
+/* create journal file, or truncate existing one. records of a
+ * previous run are not replayed, bgpd sends them again */
+struct zrpc_journal *
+zrpc_journal_open (const char *path, uint32_t record_size, uint32_t nb_records)
+{
+  struct zrpc_journal *journal;
+  uint32_t size = 1;
+  void *map;
+  int fd;
+
+  while (size < nb_records)
+    size <<= 1;
+  fd = open (path, O_RDWR | O_CREAT | O_TRUNC, 0600);
+  if (fd < 0)
+    {
+      zrpc_log ("journal %s: open failed (%s)", path, strerror (errno));
+      return NULL;
+    }
+  journal = ZRPC_CALLOC (sizeof (struct zrpc_journal));
+  journal->map_size = sizeof (struct zrpc_journal_header) + (size_t)size * record_size;
+  if (ftruncate (fd, journal->map_size) < 0)
+    {
+      zrpc_log ("journal %s: resize failed (%s)", path, strerror (errno));
+      close (fd);
+      ZRPC_FREE (journal);
+      return NULL;
+    }
+  map = mmap (NULL, journal->map_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  if (map == MAP_FAILED)
+    {
+      zrpc_log ("journal %s: mmap failed (%s)", path, strerror (errno));
+      close (fd);
+      ZRPC_FREE (journal);
+      return NULL;
+    }
+  journal->fd = fd;
+  journal->path = ZRPC_STRDUP (path);
+  journal->header = map;
+  journal->records = (uint8_t *)map + sizeof (struct zrpc_journal_header);
+  journal->header->magic = ZRPC_JOURNAL_MAGIC;
+  journal->header->version = ZRPC_JOURNAL_VERSION;
+  journal->header->record_size = record_size;
+  journal->header->nb_records = size;
+  zrpc_journal_reset (journal);
+  return journal;
+}
+
+void
+zrpc_journal_close (struct zrpc_journal *journal)
+{
+  if (journal == NULL)
+    return;
+  munmap (journal->header, journal->map_size);
+  close (journal->fd);
+  unlink (journal->path);
+  ZRPC_FREE (journal->path);
+  ZRPC_FREE (journal);
+}
+
+void
+zrpc_journal_reset (struct zrpc_journal *journal)
+{
+  journal->header->head = 0;
+  journal->header->tail = 0;
+}
+
+/* return 1 if record is appended, 0 if journal is full */
+int
+zrpc_journal_append (struct zrpc_journal *journal, const void *record)
+{
+  struct zrpc_journal_header *header = journal->header;
+
+  if (header->tail - header->head == header->nb_records)
+    return 0;
+  memcpy (journal->records +
+          (size_t)(header->tail & (header->nb_records - 1)) * header->record_size,
+          record, header->record_size);
+  header->tail++;
+  return 1;
+}
+
+/* oldest record, or NULL if journal is empty */
+void *
+zrpc_journal_head (struct zrpc_journal *journal)
+{
+  struct zrpc_journal_header *header = journal->header;
+
+  if (header->tail == header->head)
+    return NULL;
+  return journal->records +
+    (size_t)(header->head & (header->nb_records - 1)) * header->record_size;
+}
+
+void
+zrpc_journal_pop (struct zrpc_journal *journal)
+{
+  if (journal->header->tail != journal->header->head)
+    journal->header->head++;
+}
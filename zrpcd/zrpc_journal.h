@@ -0,0 +1,63 @@
+/* zrpc memory mapped journal
+ * Copyright (c) 2016 6WIND,
+ *
+ * This file is part of ZRPC daemon.
+ *
+ * See the LICENSE file.
+ */
+#ifndef _ZRPC_JOURNAL_H
+#define _ZRPC_JOURNAL_H
+
+#include <stdint.h>
+
+/*
+ * bounded FIFO of fixed size records, stored in a memory mapped file.
+ * used to keep notifications while the BGP updater client can not
+ * take them. the header is kept up to date in the file, so that
+ * journal content can be inspected after a crash.
+ */
+#define ZRPC_JOURNAL_MAGIC   0x7a6a726e /* zjrn */
+#define ZRPC_JOURNAL_VERSION 1
+
+struct zrpc_journal_header
+{
+  uint32_t magic;
+  uint32_t version;
+  uint32_t record_size;
+  /* number of records, power of 2 */
+  uint32_t nb_records;
+  /* free running indexes */
+  uint32_t head;
+  uint32_t tail;
+};
+
+struct zrpc_journal
+{
+  char *path;
+  int fd;
+  size_t map_size;
+  struct zrpc_journal_header *header;
+  uint8_t *records;
+};
+
+extern struct zrpc_journal *zrpc_journal_open (const char *path, uint32_t record_size,
+                                               uint32_t nb_records);
+extern void zrpc_journal_close (struct zrpc_journal *journal);
+extern void zrpc_journal_reset (struct zrpc_journal *journal);
+extern int zrpc_journal_append (struct zrpc_journal *journal, const void *record);
+extern void *zrpc_journal_head (struct zrpc_journal *journal);
+extern void zrpc_journal_pop (struct zrpc_journal *journal);
+
+static inline uint32_t
+zrpc_journal_count (struct zrpc_journal *journal)
+{
+  return journal->header->tail - journal->header->head;
+}
+
+static inline uint32_t
+zrpc_journal_size (struct zrpc_journal *journal)
+{
+  return journal->header->nb_records;
+}
+
+#endif /* _ZRPC_JOURNAL_H */
@@ -26,6 +26,8 @@
 #include "zrpcd/bgp_updater.h"
 #include "zrpcd/zrpc_bgp_configurator.h"
 #include "zrpcd/zrpc_vpnservice.h"
+#include "zrpcd/zrpc_request.h"
+#include "zrpcd/qzcclient.h"
 
 static void zrpc_exit (int);
 static void zrpc_sighup (void);
@@ -44,8 +46,23 @@ zrpc_usage (int status)
 Daemon which manages rpc configuration/updates from/to quagga\n\n\
 zrpc configuration across thrift defined model : vpnservice.\n\n\
 -p, --thrift_port           Set thrift's config port number\n\
+-S, --thrift_path           Set thrift's config unix socket path, listened on in addition to port\n\
 -P, --thrift_notif_port     Set thrift's notif update port number\n\
--N, --thrift_notif_address  Set thrift's notif update specified address\n\
+-N, --thrift_notif_address  Set thrift's notif update specified address or unix socket path, may be repeated\n\
+-W, --qzc_window            Set max number of outstanding requests to bgpd\n\
+-T, --routes_time_budget    Set max time in ms spent in one getRoutes call\n\
+-Q, --notif_queue_size      Set max number of notifications queued to thrift client\n\
+-B, --notif_batch_size      Set max number of routes per notification batch, 0 to disable\n\
+-U, --notif_batch_delay     Set max time in us a route waits for its batch to fill up\n\
+-C, --notif_coalesce        Set time in ms route updates of a prefix are merged, 0 to disable\n\
+-J, --notif_journal         Set file used to journal notifications when queue is full\n\
+-L, --notif_journal_size    Set max number of notifications in journal\n\
+-R, --notif_retention       Set number of sent notifications kept for resume, 0 to disable\n\
+-c, --thrift_protocol       Set thrift's config protocol, binary or compact\n\
+-u, --thrift_notif_protocol Set thrift's notif update protocol, binary or compact\n\
+-K, --notif_keepalive       Set time in s a dead notif update connection is detected, 0 to disable\n\
+-w, --workers               Set number of threads running thrift requests, 0 to use main thread\n\
+-M, --request_max_size      Set max size in MB of a thrift request, bigger ones get an exception\n\
 -h, --help                  Display this help and exit\n\n");
   exit (status);
 }
@@ -139,7 +156,7 @@ main (int argc, char **argv)
   zrpc_global_init ();
 
   /* Command line argument treatment. */
-  while ((option = getopt (argc, argv, "A:P:p:N:n:h")) != -1)
+  while ((option = getopt (argc, argv, "A:P:p:S:N:n:W:T:Q:B:U:C:J:L:R:c:u:K:w:M:h")) != -1)
     {
       switch (option)
 	{
@@ -150,10 +167,23 @@ main (int argc, char **argv)
 	  else
 	    tm->zrpc_listen_port = tmp_port;
 	  break;
+	case 'S':
+          if(tm->zrpc_listen_path)
+            free(tm->zrpc_listen_path);
+          tm->zrpc_listen_path = strdup(optarg);
+          break;
 	case 'N':
-          if(tm->zrpc_notification_address)
-            free(tm->zrpc_notification_address);
-          tm->zrpc_notification_address = strdup(optarg);
+          if (tm->zrpc_notification_address_count == 0)
+            {
+              free(tm->zrpc_notification_address[0]);
+              tm->zrpc_notification_address[0] = NULL;
+            }
+          if (tm->zrpc_notification_address_count >= ZRPC_NOTIFICATION_ADDRESS_MAX)
+            {
+              printf ("too many notification addresses, %s ignored\n", optarg);
+              break;
+            }
+          tm->zrpc_notification_address[tm->zrpc_notification_address_count++] = strdup(optarg);
           break;
 	  /* listenon implies -n */
 	case 'n':
@@ -163,6 +193,105 @@ main (int argc, char **argv)
 	  else
 	    tm->zrpc_notification_port = tmp_port;
 	  break;
+	case 'W':
+	  tmp_port = atoi (optarg);
+	  if (tmp_port <= 0)
+	    tm->qzc_window = QZCCLIENT_DEFAULT_WINDOW;
+	  else
+	    tm->qzc_window = tmp_port;
+	  break;
+	case 'T':
+	  tmp_port = atoi (optarg);
+	  if (tmp_port < 0)
+	    tm->get_routes_time_budget = 0;
+	  else
+	    tm->get_routes_time_budget = tmp_port;
+	  break;
+	case 'Q':
+	  tmp_port = atoi (optarg);
+	  if (tmp_port <= 0)
+	    tm->notif_queue_size = ZRPC_NOTIF_QUEUE_DEFAULT_SIZE;
+	  else
+	    tm->notif_queue_size = tmp_port;
+	  break;
+	case 'B':
+	  tmp_port = atoi (optarg);
+	  if (tmp_port < 0)
+	    tm->notif_batch_size = 0;
+	  else
+	    tm->notif_batch_size = tmp_port;
+	  break;
+	case 'U':
+	  tmp_port = atoi (optarg);
+	  if (tmp_port < 0)
+	    tm->notif_batch_delay = ZRPC_NOTIF_BATCH_DEFAULT_DELAY;
+	  else
+	    tm->notif_batch_delay = tmp_port;
+	  break;
+	case 'C':
+	  tmp_port = atoi (optarg);
+	  if (tmp_port < 0)
+	    tm->notif_coalesce_window = 0;
+	  else
+	    tm->notif_coalesce_window = tmp_port;
+	  break;
+	case 'J':
+          if(tm->notif_journal_path)
+            free(tm->notif_journal_path);
+          tm->notif_journal_path = strdup(optarg);
+          break;
+	case 'L':
+	  tmp_port = atoi (optarg);
+	  if (tmp_port <= 0)
+	    tm->notif_journal_size = ZRPC_NOTIF_JOURNAL_DEFAULT_SIZE;
+	  else
+	    tm->notif_journal_size = tmp_port;
+	  break;
+	case 'R':
+	  tmp_port = atoi (optarg);
+	  if (tmp_port < 0)
+	    tm->notif_retention = 0;
+	  else
+	    tm->notif_retention = tmp_port;
+	  break;
+	case 'c':
+	  tm->configurator_protocol = zrpc_vpnservice_protocol_get (optarg);
+	  if (tm->configurator_protocol < 0)
+	    {
+	      printf ("unsupported thrift protocol %s\n", optarg);
+	      zrpc_usage (1);
+	    }
+	  break;
+	case 'u':
+	  tm->notif_protocol = zrpc_vpnservice_protocol_get (optarg);
+	  if (tm->notif_protocol < 0)
+	    {
+	      printf ("unsupported thrift protocol %s\n", optarg);
+	      zrpc_usage (1);
+	    }
+	  break;
+	case 'K':
+	  tmp_port = atoi (optarg);
+	  if (tmp_port < 0)
+	    tm->notif_keepalive = 0;
+	  else
+	    tm->notif_keepalive = tmp_port;
+	  break;
+	case 'w':
+	  tmp_port = atoi (optarg);
+	  if (tmp_port < 0)
+	    tm->worker_threads = 0;
+	  else
+	    tm->worker_threads = tmp_port;
+	  break;
+	case 'M':
+	  tmp_port = atoi (optarg);
+	  /* request lengths are kept in 31 bits */
+	  if (tmp_port <= 0 || tmp_port > 1024)
+	    tm->request_max_size = ZRPC_REQUEST_MAX_SIZE;
+	  else
+	    tm->request_max_size = tmp_port * 1024 * 1024;
+	  break;
 	case 'h':
 	  zrpc_usage (0);
 	  break;
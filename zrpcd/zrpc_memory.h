@@ -15,6 +15,7 @@
 #define ZRPC_STRDUP(_size) strdup(_size)
 #define ZRPC_MALLOC(_size) malloc(_size)
 #define ZRPC_CALLOC(_size) calloc(1, _size)
+#define ZRPC_REALLOC(_ptr, _size) realloc(_ptr, _size)
 #define ZRPC_FREE(_ptr) free(_ptr)
 
 #endif /* _ZRPCD_MEMORY_H */
@@ -5,6 +5,9 @@
  *
  * See the LICENSE file.
  */
+#include <pthread.h>
+#include <poll.h>
+#include <sys/un.h>
 #include "thread.h"
 
 #include <glib-object.h>
@@ -17,6 +20,8 @@
 #include "zrpcd/zrpc_bgp_configurator.h"
 #include "zrpcd/zrpc_bgp_updater.h"
 #include "zrpcd/zrpc_vpnservice.h"
+#include "zrpcd/zrpc_request.h"
+#include "zrpcd/zrpc_stats.h"
 
 /* zrpc listening socket. */
 struct zrpc_listener
@@ -24,9 +29,18 @@ struct zrpc_listener
   /* opaque pointer to zrpc structure */
   void *zrpc;
   struct thread *thread;
+  /* unix socket listener. NULL for thrift server socket */
+  char *path;
+  int fd;
   struct zrpc_listener *next;
 };
 
+/* pending connections on unix socket listener */
+#define ZRPC_UNIX_BACKLOG          1024
+
+/* bytes read at once on a configurator connection */
+#define ZRPC_PACKET_READ_SIZE      65536
+
 /* Update BGP socket send buffer size */
 #define ZRPC_SOCKET_SNDBUF_SIZE    65536
 
@@ -51,6 +65,21 @@ zrpc_update_sock_send_buffer_size (int fd)
     }
 }
 
+/* accept connection on unix socket. returned transport owns it */
+static ThriftTransport *
+zrpc_accept_unix (int fd)
+{
+  ThriftTransport *transport;
+  int sd;
+
+  sd = accept (fd, NULL, NULL);
+  if (sd < 0)
+    return NULL;
+  transport = g_object_new (THRIFT_TYPE_SOCKET, NULL);
+  THRIFT_SOCKET (transport)->sd = sd;
+  return transport;
+}
+
 /* Accept bgp connection. */
 int 
 zrpc_accept (struct thread *thread)
@@ -71,8 +100,11 @@ zrpc_accept (struct thread *thread)
   THREAD_OFF(listener->thread);
   THREAD_READ_ON (tm->global, listener->thread, zrpc_accept, listener, THREAD_FD(thread));
 
-  transport = thrift_server_socket_accept(zrpc->zrpc_vpnservice->bgp_configurator_server_transport,
-                                          &error);
+  if (listener->path)
+    transport = zrpc_accept_unix (THREAD_FD (thread));
+  else
+    transport = thrift_server_socket_accept(zrpc->zrpc_vpnservice->bgp_configurator_server_transport,
+                                            &error);
   if (transport == NULL)
     {
       zrpc_log ("[Error] zrpc server socket accept failed (%u)", errno);
@@ -94,47 +126,194 @@ zrpc_accept (struct thread *thread)
   return 0;
 }
 
-/* BGP read utility function. */
-extern int
-zrpc_read_packet (struct thread *thread)
+/* configurator requests run by worker threads. a connection is
+ * handed to one worker at a time, so that its requests keep their
+ * order */
+struct zrpc_worker_pool
+{
+  pthread_t *threads;
+  unsigned int nb_threads;
+  pthread_mutex_t mutex;
+  pthread_cond_t cond;
+  /* connections with a pending request */
+  struct zrpc_peer *run_head, *run_tail;
+  /* connections whose request is done, handed back to main thread */
+  struct zrpc_peer *done_head, *done_tail;
+  int done_pipe[2];
+  struct thread *done_thread;
+  /* requests being run */
+  unsigned int busy;
+  int stop;
+};
+
+static struct zrpc_worker_pool *zrpc_workers;
+
+/* run requests of connection already received. returns 1 if
+ * connection has to be closed */
+static int
+zrpc_process_packet (struct zrpc_peer *peer)
 {
+  struct zrpc_vpnservice_client *client = peer->peer;
   GError *error = NULL;
-  struct zrpc_peer *peer = THREAD_ARG(thread);
-  struct zrpc_peer *peer_to_parse, *peer_next, *peer_prev;
+  gint32 len;
+  int failed = 0;
 
-  thrift_dispatch_processor_process (peer->peer->server->processor,      \
-                                    peer->peer->protocol,               \
-                                    peer->peer->protocol,               \
-                                    &error);
-  if (error != NULL)
-    {
-      if(IS_ZRPC_DEBUG_NETWORK)
-        zrpc_log("zrpcd_read_packet: close connection (fd %d)", peer->fd);
-      g_clear_error (&error);
-      zrpc_vpnservice_terminate_client(peer->peer); 
-      ZRPC_FREE (peer->peer);
-      peer->peer = NULL;
-      peer->fd = 0;
-      peer_prev = NULL;
-      for (peer_to_parse = peer->zrpc->peer; peer_to_parse; peer_to_parse = peer_next)
+  /* let handlers know which connection the request comes from */
+  zrpc_vpnservice_set_client (client);
+  while ((len = zrpc_request_length (client->request,
+                                     tm->configurator_protocol)) > 0 ||
+         len == ZRPC_REQUEST_TOO_BIG)
+    {
+      guint32 end = client->request->pos + len;
+      struct zrpc_stats_call call;
+
+      /* answered, so that controller may split its request */
+      if (len == ZRPC_REQUEST_TOO_BIG)
         {
-          peer_next = peer_to_parse->next;
-          if (peer_to_parse != peer)
-            continue;
-          if (peer_prev)
-            {
-              peer_prev = peer_next;
-            }
-          else
+          zrpc_log ("zrpcd: request bigger than %u bytes on fd %d, rejected",
+                    tm->request_max_size, peer->fd);
+          if (!zrpc_request_reject (client->request, client->protocol, &error))
             {
-              peer->zrpc->peer = peer_next;
+              g_clear_error (&error);
+              failed = 1;
+              break;
             }
-          peer_to_parse->next = NULL;
-          ZRPC_FREE (peer_to_parse);
-          peer_prev = peer_to_parse;
+          continue;
+        }
+
+      zrpc_stats_begin (&call, ZRPC_STATS_REQUEST);
+      thrift_dispatch_processor_process (client->server->processor,
+                                         client->request_protocol,
+                                         client->protocol,
+                                         &error);
+      zrpc_stats_end (&call, error != NULL);
+      if (error)
+        {
+          g_clear_error (&error);
+          failed = 1;
+          break;
+        }
+      /* decoder and scanner must agree on request length */
+      if (client->request->pos != end)
+        {
+          zrpc_log ("zrpcd: request length mismatch on fd %d", peer->fd);
+          failed = 1;
           break;
         }
+      zrpc_request_buffer_consume (client->request);
+    }
+  zrpc_vpnservice_set_client (NULL);
+  if (len < 0)
+    failed = 1;
+  return failed;
+}
+
+/* read bytes available on connection, without blocking. returns
+ * length of first complete request, or ZRPC_REQUEST_TOO_BIG, 0 if
+ * it is not complete yet, -1 if connection has to be closed */
+static gint32
+zrpc_packet_receive (struct zrpc_peer *peer)
+{
+  struct zrpc_vpnservice_client *client = peer->peer;
+  guint8 buf[ZRPC_PACKET_READ_SIZE];
+  ssize_t ret;
+  gint32 len;
+
+  while (1)
+    {
+      ret = recv (peer->fd, buf, sizeof (buf), MSG_DONTWAIT);
+      if (ret == 0)
+        return -1;
+      if (ret < 0)
+        {
+          if (errno == EINTR)
+            continue;
+          if (errno == EAGAIN || errno == EWOULDBLOCK)
+            break;
+          if(IS_ZRPC_DEBUG_NETWORK)
+            zrpc_log("zrpcd: read failed on fd %d (%s)", peer->fd,
+                     strerror (errno));
+          return -1;
+        }
+      zrpc_request_buffer_append (client->request, buf, ret);
+      if (ret < (ssize_t)sizeof (buf))
+        break;
+    }
+  len = zrpc_request_length (client->request, tm->configurator_protocol);
+  if (len == -1)
+    zrpc_log ("zrpcd: malformed request on fd %d, closing", peer->fd);
+  return len;
+}
+
+static void
+zrpc_peer_close (struct zrpc_peer *peer)
+{
+  struct zrpc_peer *peer_to_parse, *peer_next, *peer_prev;
+  struct zrpc_vpnservice *ctxt = peer->zrpc->zrpc_vpnservice;
+
+  if(IS_ZRPC_DEBUG_NETWORK)
+    zrpc_log("zrpcd_read_packet: close connection (fd %d)", peer->fd);
+  zrpc_vpnservice_get_routes_cursor_del(ctxt, peer->peer);
+  zrpc_vpnservice_terminate_client(peer->peer); 
+  ZRPC_FREE (peer->peer);
+  peer->peer = NULL;
+  peer->fd = 0;
+  peer_prev = NULL;
+  for (peer_to_parse = peer->zrpc->peer; peer_to_parse; peer_to_parse = peer_next)
+    {
+      peer_next = peer_to_parse->next;
+      if (peer_to_parse != peer)
+        {
+          peer_prev = peer_to_parse;
+          continue;
+        }
+      if (peer_prev)
+        peer_prev->next = peer_next;
+      else
+        peer->zrpc->peer = peer_next;
+      peer_to_parse->next = NULL;
+      ZRPC_FREE (peer_to_parse);
+      break;
+    }
+}
+
+/* BGP read utility function. */
+extern int
+zrpc_read_packet (struct thread *thread)
+{
+  struct zrpc_peer *peer = THREAD_ARG(thread);
+  struct zrpc_worker_pool *pool = zrpc_workers;
+  gint32 len;
+
+  peer->t_read = NULL;
+  len = zrpc_packet_receive (peer);
+  if (len == -1)
+    {
+      zrpc_peer_close (peer);
+      return 0;
+    }
+  /* wait for the rest of the request */
+  if (len == 0)
+    {
+      THREAD_READ_ON (tm->global, peer->t_read, zrpc_read_packet, peer, peer->fd);
+      return 0;
     }
+  if (pool)
+    {
+      /* connection is not polled until request is done */
+      pthread_mutex_lock (&pool->mutex);
+      peer->work_next = NULL;
+      if (pool->run_tail)
+        pool->run_tail->work_next = peer;
+      else
+        pool->run_head = peer;
+      pool->run_tail = peer;
+      pthread_cond_signal (&pool->cond);
+      pthread_mutex_unlock (&pool->mutex);
+      return 0;
+    }
+  if (zrpc_process_packet (peer))
+    zrpc_peer_close (peer);
   else 
     {
       peer->t_read = thread_add_read(tm->global, zrpc_read_packet, peer, peer->fd);
@@ -142,6 +321,206 @@ zrpc_read_packet (struct thread *thread)
   return 0;
 }
 
+/* main thread job: poll again connections whose request is done */
+static int
+zrpc_worker_done (struct thread *thread)
+{
+  struct zrpc_worker_pool *pool = THREAD_ARG (thread);
+  struct zrpc_peer *peer, *peer_next;
+  char buf[64];
+
+  pool->done_thread = NULL;
+  while (read (pool->done_pipe[0], buf, sizeof (buf)) > 0);
+  pthread_mutex_lock (&pool->mutex);
+  peer = pool->done_head;
+  pool->done_head = pool->done_tail = NULL;
+  pthread_mutex_unlock (&pool->mutex);
+  for (; peer; peer = peer_next)
+    {
+      peer_next = peer->work_next;
+      peer->work_next = NULL;
+      if (peer->work_failed)
+        zrpc_peer_close (peer);
+      else
+        THREAD_READ_ON (tm->global, peer->t_read, zrpc_read_packet, peer, peer->fd);
+    }
+  /* getRoutes cursors may have been created by workers */
+  if (tm->zrpc && tm->zrpc->zrpc_vpnservice)
+    zrpc_vpnservice_get_routes_cursor_reaper (tm->zrpc->zrpc_vpnservice);
+  THREAD_READ_ON (tm->global, pool->done_thread, zrpc_worker_done,
+                  pool, pool->done_pipe[0]);
+  return 0;
+}
+
+static void *
+zrpc_worker (void *arg)
+{
+  struct zrpc_worker_pool *pool = arg;
+  struct zrpc_peer *peer;
+  int failed;
+
+  zrpc_util_block_signals ();
+  pthread_mutex_lock (&pool->mutex);
+  while (1)
+    {
+      while (!pool->stop && pool->run_head == NULL)
+        pthread_cond_wait (&pool->cond, &pool->mutex);
+      if (pool->stop)
+        break;
+      peer = pool->run_head;
+      pool->run_head = peer->work_next;
+      if (pool->run_head == NULL)
+        pool->run_tail = NULL;
+      pool->busy++;
+      pthread_mutex_unlock (&pool->mutex);
+
+      failed = zrpc_process_packet (peer);
+
+      pthread_mutex_lock (&pool->mutex);
+      pool->busy--;
+      peer->work_failed = failed;
+      peer->work_next = NULL;
+      if (pool->done_tail)
+        pool->done_tail->work_next = peer;
+      else
+        pool->done_head = peer;
+      pool->done_tail = peer;
+      if (write (pool->done_pipe[1], "", 1) < 0 && errno != EAGAIN)
+        zrpc_log ("zrpc worker wakeup failed (%s)", strerror (errno));
+    }
+  pthread_mutex_unlock (&pool->mutex);
+  return NULL;
+}
+
+/* start worker threads running configurator requests. with no worker,
+ * requests are run by main thread */
+void
+zrpc_workers_start (unsigned int nb_threads)
+{
+  struct zrpc_worker_pool *pool;
+  unsigned int i;
+  int ret;
+
+  if (nb_threads == 0 || zrpc_workers)
+    return;
+  pool = ZRPC_CALLOC (sizeof (struct zrpc_worker_pool));
+  if (pipe (pool->done_pipe) < 0)
+    {
+      zrpc_log ("zrpc worker pipe failed (%s)", strerror (errno));
+      ZRPC_FREE (pool);
+      return;
+    }
+  for (i = 0; i < 2; i++)
+    fcntl (pool->done_pipe[i], F_SETFL,
+           fcntl (pool->done_pipe[i], F_GETFL, 0) | O_NONBLOCK);
+  pthread_mutex_init (&pool->mutex, NULL);
+  pthread_cond_init (&pool->cond, NULL);
+  pool->threads = ZRPC_CALLOC (nb_threads * sizeof (pthread_t));
+  for (i = 0; i < nb_threads; i++)
+    {
+      ret = pthread_create (&pool->threads[i], NULL, zrpc_worker, pool);
+      if (ret != 0)
+        {
+          zrpc_log ("zrpc worker creation failed (%s)", strerror (ret));
+          break;
+        }
+      pool->nb_threads++;
+    }
+  THREAD_READ_ON (tm->global, pool->done_thread, zrpc_worker_done,
+                  pool, pool->done_pipe[0]);
+  zrpc_workers = pool;
+  if (IS_ZRPC_DEBUG_NETWORK)
+    zrpc_log ("zrpcd: %u worker threads started", pool->nb_threads);
+}
+
+/* wait for requests being run, and stop worker threads */
+void
+zrpc_workers_stop (void)
+{
+  struct zrpc_worker_pool *pool = zrpc_workers;
+  struct pollfd pfd;
+  unsigned int i;
+  char buf[64];
+
+  if (pool == NULL)
+    return;
+  pthread_mutex_lock (&pool->mutex);
+  pool->stop = 1;
+  pthread_cond_broadcast (&pool->cond);
+  while (pool->busy)
+    {
+      pthread_mutex_unlock (&pool->mutex);
+      /* workers write to done pipe once their request is over. a
+       * request may wait for main thread to be parked */
+      if (tm->zrpc && tm->zrpc->zrpc_vpnservice)
+        zrpc_vpnservice_park_wait (tm->zrpc->zrpc_vpnservice, pool->done_pipe[0]);
+      else
+        {
+          pfd.fd = pool->done_pipe[0];
+          pfd.events = POLLIN;
+          pfd.revents = 0;
+          poll (&pfd, 1, -1);
+        }
+      while (read (pool->done_pipe[0], buf, sizeof (buf)) > 0);
+      pthread_mutex_lock (&pool->mutex);
+    }
+  pthread_mutex_unlock (&pool->mutex);
+  for (i = 0; i < pool->nb_threads; i++)
+    pthread_join (pool->threads[i], NULL);
+  THREAD_OFF (pool->done_thread);
+  close (pool->done_pipe[0]);
+  close (pool->done_pipe[1]);
+  pthread_mutex_destroy (&pool->mutex);
+  pthread_cond_destroy (&pool->cond);
+  ZRPC_FREE (pool->threads);
+  ZRPC_FREE (pool);
+  zrpc_workers = NULL;
+}
+
+/* listen for configurator connections on unix socket path */
+static int
+zrpc_server_listen_unix (struct zrpc *zrpc, const char *path)
+{
+  struct zrpc_listener *listener;
+  struct sockaddr_un addr;
+  int fd;
+
+  memset (&addr, 0, sizeof (addr));
+  addr.sun_family = AF_UNIX;
+  if (strlen (path) >= sizeof (addr.sun_path))
+    {
+      zrpc_log ("zrpc_server_listen : unix socket path %s too long", path);
+      return -1;
+    }
+  strcpy (addr.sun_path, path);
+  fd = socket (AF_UNIX, SOCK_STREAM, 0);
+  if (fd < 0)
+    {
+      zrpc_log ("zrpc_server_listen : unix socket failed (%s)", strerror (errno));
+      return -1;
+    }
+  /* socket file left by a previous run */
+  unlink (path);
+  if (bind (fd, (struct sockaddr *)&addr, sizeof (addr)) < 0 ||
+      listen (fd, ZRPC_UNIX_BACKLOG) < 0)
+    {
+      zrpc_log ("zrpc_server_listen : %s (%s)", path, strerror (errno));
+      close (fd);
+      return -1;
+    }
+  listener = ZRPC_CALLOC (sizeof(*listener));
+  listener->zrpc = zrpc;
+  listener->path = ZRPC_STRDUP (path);
+  listener->fd = fd;
+  listener->thread = NULL;
+  THREAD_READ_ON (tm->global, listener->thread, zrpc_accept, listener, fd);
+  listener->next = tm->listen_sockets;
+  tm->listen_sockets = listener;
+  if (IS_ZRPC_DEBUG_NETWORK)
+    zrpc_log ("zrpcd: listening on %s", path);
+  return 0;
+}
+
 int
 zrpc_server_listen (struct zrpc *zrpc)
 {
@@ -161,6 +540,9 @@ zrpc_server_listen (struct zrpc *zrpc)
       
       listener->next = tm->listen_sockets;
       tm->listen_sockets = listener;
+      /* local controllers may also use a unix socket */
+      if (tm->zrpc_listen_path)
+        zrpc_server_listen_unix (zrpc, tm->zrpc_listen_path);
       return 0;
     }
   zrpc_log("zrpc_server_listen : %s (%d)", error?error->message:"", errno);
@@ -180,7 +562,13 @@ zrpc_close (void)
 
       thread_cancel (listener->thread);
       zrpc = listener->zrpc;
-      if(zrpc->zrpc_vpnservice->bgp_configurator_server_transport)
+      if (listener->path)
+        {
+          close (listener->fd);
+          unlink (listener->path);
+          ZRPC_FREE (listener->path);
+        }
+      else if(zrpc->zrpc_vpnservice->bgp_configurator_server_transport)
         {
           thrift_server_socket_close(zrpc->zrpc_vpnservice->bgp_configurator_server_transport, &error);
           g_object_unref(zrpc->zrpc_vpnservice->bgp_configurator_server_transport);
@@ -194,22 +582,15 @@ zrpc_close (void)
 
 void zrpc_server_socket(struct zrpc *zrpc)
 {
-  gboolean client_ready;
-
 #if (!GLIB_CHECK_VERSION (2, 36, 0))
   g_type_init ();
 #endif
   zrpc_vpnservice_setup_thrift_bgp_configurator_server(zrpc->zrpc_vpnservice);
-  client_ready = zrpc_vpnservice_setup_thrift_bgp_updater_client(zrpc->zrpc_vpnservice);
-  /* send notification to listener */
-  zrpc_bgp_updater_on_start_config_resync_notification ();
+  zrpc_workers_start (tm->worker_threads);
+  /* connection is established in background */
+  zrpc_vpnservice_setup_thrift_bgp_updater_client(zrpc->zrpc_vpnservice);
+  /* send notification to listener, once connected */
+  zrpc_vpnservice_notif_resync (zrpc->zrpc_vpnservice);
   zrpc->zrpc_vpnservice->bgp_update_total++;
-  if(client_ready == FALSE)
-    {
-      if (IS_ZRPC_DEBUG_NOTIFICATION)
-        zrpc_log ("bgp->sdnc message failed to be sent");
-      zrpc->zrpc_vpnservice->bgp_update_lost_msgs++;
-      return;
-    }
   return;
 }
@@ -15,5 +15,7 @@ extern int zrpc_connect (struct zrpc_peer *);
 extern void zrpc_getsockname (struct zrpc_peer *);
 extern int zrpc_accept (struct thread *thread);
 extern int zrpc_read_packet (struct thread *thread);
+extern void zrpc_workers_start (unsigned int nb_threads);
+extern void zrpc_workers_stop (void);
 
 #endif /* _ZRPC_NETWORK_H */
@@ -0,0 +1,640 @@
+/* zrpc thrift request buffer
+ * Copyright (c) 2016 6WIND,
+ *
+ * This file is part of ZRPC daemon.
+ *
+ * See the LICENSE file.
+ */
+#include <glib-object.h>
+#include "zrpcd/zrpc_thrift_wrapper.h"
+#include "zrpcd/bgp_configurator.h"
+#include "zrpcd/bgp_updater.h"
+#include "zrpcd/zrpc_bgp_configurator.h"
+#include "zrpcd/zrpc_vpnservice.h"
+#include "zrpcd/zrpc_memory.h"
+#include "zrpcd/zrpc_request.h"
+
+/* nesting of structs and containers accepted in a request */
+#define ZRPC_REQUEST_MAX_DEPTH 64
+
+/* method name kept to answer a request too big */
+#define ZRPC_REQUEST_NAME_MAX 64
+
+/* compact protocol */
+#define ZRPC_COMPACT_PROTOCOL_ID 0x82
+#define ZRPC_COMPACT_VERSION     1
+#define ZRPC_COMPACT_BOOLEAN_TRUE  1
+#define ZRPC_COMPACT_BOOLEAN_FALSE 2
+#define ZRPC_COMPACT_BYTE          3
+#define ZRPC_COMPACT_I16           4
+#define ZRPC_COMPACT_I32           5
+#define ZRPC_COMPACT_I64           6
+#define ZRPC_COMPACT_DOUBLE        7
+#define ZRPC_COMPACT_BINARY        8
+#define ZRPC_COMPACT_LIST          9
+#define ZRPC_COMPACT_SET           10
+#define ZRPC_COMPACT_MAP           11
+#define ZRPC_COMPACT_STRUCT        12
+
+/* binary protocol */
+#define ZRPC_BINARY_VERSION_MASK 0xffff0000
+#define ZRPC_BINARY_VERSION_1    0x80010000
+
+/* bytes of a request being scanned */
+struct zrpc_request_cursor
+{
+  const guint8 *data;
+  guint32 len;
+  guint32 pos;
+};
+
+#define ZRPC_REQUEST_FRAME_STRUCT 0
+#define ZRPC_REQUEST_FRAME_LIST   1
+#define ZRPC_REQUEST_FRAME_MAP    2
+
+/* struct or container being scanned */
+struct zrpc_request_frame
+{
+  guint8 kind;
+  /* element types. map keys and values alternate */
+  guint8 type[2];
+  /* elements left in list, keys and values left in map */
+  guint32 remaining;
+};
+
+struct zrpc_request_scan
+{
+  /* bytes of request already scanned */
+  guint32 pos;
+  /* message header scanned */
+  int started;
+  /* request length, once complete */
+  guint32 length;
+  int depth;
+  struct zrpc_request_frame frames[ZRPC_REQUEST_MAX_DEPTH];
+  /* request is bigger than max size: its bytes are dropped once
+   * scanned, and it is answered with an error once over */
+  int discard;
+  int rejected;
+  /* bytes of last token still to drop */
+  guint32 skip;
+  /* message header */
+  gchar name[ZRPC_REQUEST_NAME_MAX];
+  gint32 seqid;
+};
+
+G_DEFINE_TYPE (ZrpcRequestBuffer, zrpc_request_buffer, THRIFT_TYPE_TRANSPORT)
+
+static gboolean
+zrpc_request_buffer_is_open (ThriftTransport *transport)
+{
+  return TRUE;
+}
+
+static gboolean
+zrpc_request_buffer_open (ThriftTransport *transport, GError **error)
+{
+  return TRUE;
+}
+
+static gboolean
+zrpc_request_buffer_close (ThriftTransport *transport, GError **error)
+{
+  return TRUE;
+}
+
+/* requests are only decoded once complete: running out of bytes
+ * is an error, not a reason to wait */
+static gint32
+zrpc_request_buffer_read (ThriftTransport *transport, gpointer buf,
+                          guint32 len, GError **error)
+{
+  ZrpcRequestBuffer *request = ZRPC_REQUEST_BUFFER (transport);
+  guint32 give = request->buf->len - request->pos;
+
+  if (give == 0 && len)
+    {
+      g_set_error (error, THRIFT_TRANSPORT_ERROR,
+                   THRIFT_TRANSPORT_ERROR_RECEIVE,
+                   "request truncated");
+      return -1;
+    }
+  if (give > len)
+    give = len;
+  memcpy (buf, request->buf->data + request->pos, give);
+  request->pos += give;
+  return give;
+}
+
+static gboolean
+zrpc_request_buffer_read_end (ThriftTransport *transport, GError **error)
+{
+  return TRUE;
+}
+
+static gboolean
+zrpc_request_buffer_write (ThriftTransport *transport, const gpointer buf,
+                           const guint32 len, GError **error)
+{
+  g_set_error (error, THRIFT_TRANSPORT_ERROR,
+               THRIFT_TRANSPORT_ERROR_SEND,
+               "request buffer is read only");
+  return FALSE;
+}
+
+static gboolean
+zrpc_request_buffer_write_end (ThriftTransport *transport, GError **error)
+{
+  return TRUE;
+}
+
+static gboolean
+zrpc_request_buffer_flush (ThriftTransport *transport, GError **error)
+{
+  return TRUE;
+}
+
+static void
+zrpc_request_buffer_init (ZrpcRequestBuffer *request)
+{
+  request->buf = g_byte_array_new ();
+  request->pos = 0;
+  request->max_size = ZRPC_REQUEST_MAX_SIZE;
+  request->scan = ZRPC_CALLOC (sizeof (struct zrpc_request_scan));
+}
+
+static void
+zrpc_request_buffer_finalize (GObject *object)
+{
+  ZrpcRequestBuffer *request = ZRPC_REQUEST_BUFFER (object);
+
+  if (request->buf)
+    g_byte_array_free (request->buf, TRUE);
+  request->buf = NULL;
+  if (request->scan)
+    ZRPC_FREE (request->scan);
+  request->scan = NULL;
+  G_OBJECT_CLASS (zrpc_request_buffer_parent_class)->finalize (object);
+}
+
+static void
+zrpc_request_buffer_class_init (ZrpcRequestBufferClass *klass)
+{
+  GObjectClass *gobject_class = G_OBJECT_CLASS (klass);
+  ThriftTransportClass *transport_class = THRIFT_TRANSPORT_CLASS (klass);
+
+  gobject_class->finalize = zrpc_request_buffer_finalize;
+  transport_class->is_open = zrpc_request_buffer_is_open;
+  transport_class->open = zrpc_request_buffer_open;
+  transport_class->close = zrpc_request_buffer_close;
+  transport_class->read = zrpc_request_buffer_read;
+  transport_class->read_end = zrpc_request_buffer_read_end;
+  transport_class->write = zrpc_request_buffer_write;
+  transport_class->write_end = zrpc_request_buffer_write_end;
+  transport_class->flush = zrpc_request_buffer_flush;
+}
+
+/* add bytes received on connection */
+void
+zrpc_request_buffer_append (ZrpcRequestBuffer *request,
+                            const guint8 *data, guint32 len)
+{
+  g_byte_array_append (request->buf, data, len);
+}
+
+/* drop bytes of decoded requests */
+void
+zrpc_request_buffer_consume (ZrpcRequestBuffer *request)
+{
+  if (request->pos)
+    g_byte_array_remove_range (request->buf, 0, request->pos);
+  request->pos = 0;
+  /* next request is scanned from its start */
+  memset (request->scan, 0, sizeof (struct zrpc_request_scan));
+}
+
+/* request scanner. walks encoded request without decoding it, as
+ * bytes are received: scan resumes where it stopped, so that a big
+ * request is not rescanned on each read. a token (field header and
+ * primitive value, or container header) is only consumed once it
+ * has been fully received.
+ * functions return 1 if ok, 0 if more bytes are needed, -1 if
+ * request is malformed */
+static int
+zrpc_request_skip (struct zrpc_request_scan *scan,
+                   struct zrpc_request_cursor *cur, guint32 len)
+{
+  guint32 left = cur->len - cur->pos;
+
+  if (left >= len)
+    {
+      cur->pos += len;
+      return 1;
+    }
+  /* no need to wait for bytes that are dropped anyway. skip ends
+   * a token, nothing is read after it */
+  if (scan->discard)
+    {
+      scan->skip = len - left;
+      cur->pos = cur->len;
+      return 1;
+    }
+  return 0;
+}
+
+static int
+zrpc_request_byte (struct zrpc_request_cursor *cur, guint8 *val)
+{
+  if (cur->pos == cur->len)
+    return 0;
+  *val = cur->data[cur->pos++];
+  return 1;
+}
+
+static int
+zrpc_request_i32 (struct zrpc_request_cursor *cur, guint32 *val)
+{
+  const guint8 *p = cur->data + cur->pos;
+
+  if (cur->len - cur->pos < 4)
+    return 0;
+  *val = ((guint32)p[0] << 24) | ((guint32)p[1] << 16) |
+    ((guint32)p[2] << 8) | p[3];
+  cur->pos += 4;
+  return 1;
+}
+
+static int
+zrpc_request_varint (struct zrpc_request_cursor *cur, guint32 *val)
+{
+  guint64 v = 0;
+  guint8 b;
+  int shift = 0, ret;
+
+  do
+    {
+      if (shift >= 64)
+        return -1;
+      if ((ret = zrpc_request_byte (cur, &b)) <= 0)
+        return ret;
+      v |= (guint64)(b & 0x7f) << shift;
+      shift += 7;
+    }
+  while (b & 0x80);
+  /* only sizes are used */
+  *val = v > G_MAXUINT32 ? G_MAXUINT32 : (guint32)v;
+  return 1;
+}
+
+/* enter a struct or container of size elements */
+static int
+zrpc_request_push (struct zrpc_request_scan *scan, guint8 kind,
+                   guint8 type0, guint8 type1, guint32 size)
+{
+  struct zrpc_request_frame *frame;
+
+  if (size > G_MAXUINT32 / 2)
+    return -1;
+  if (scan->depth == ZRPC_REQUEST_MAX_DEPTH)
+    return -1;
+  frame = &scan->frames[scan->depth++];
+  frame->kind = kind;
+  frame->type[0] = type0;
+  frame->type[1] = type1;
+  frame->remaining = kind == ZRPC_REQUEST_FRAME_MAP ? 2 * size : size;
+  return 1;
+}
+
+/* skip a primitive value, or enter a struct or container */
+static int
+zrpc_request_binary_value (struct zrpc_request_scan *scan,
+                           struct zrpc_request_cursor *cur, guint8 type)
+{
+  guint8 ktype, vtype;
+  guint32 size;
+  int ret;
+
+  switch (type)
+    {
+    case T_BOOL:
+    case T_BYTE:
+      return zrpc_request_skip (scan, cur, 1);
+    case T_I16:
+      return zrpc_request_skip (scan, cur, 2);
+    case T_I32:
+      return zrpc_request_skip (scan, cur, 4);
+    case T_I64:
+    case T_DOUBLE:
+      return zrpc_request_skip (scan, cur, 8);
+    case T_STRING:
+      if ((ret = zrpc_request_i32 (cur, &size)) <= 0)
+        return ret;
+      return zrpc_request_skip (scan, cur, size);
+    case T_STRUCT:
+      return zrpc_request_push (scan, ZRPC_REQUEST_FRAME_STRUCT, 0, 0, 0);
+    case T_MAP:
+      if ((ret = zrpc_request_byte (cur, &ktype)) <= 0 ||
+          (ret = zrpc_request_byte (cur, &vtype)) <= 0 ||
+          (ret = zrpc_request_i32 (cur, &size)) <= 0)
+        return ret;
+      return zrpc_request_push (scan, ZRPC_REQUEST_FRAME_MAP,
+                                ktype, vtype, size);
+    case T_SET:
+    case T_LIST:
+      if ((ret = zrpc_request_byte (cur, &vtype)) <= 0 ||
+          (ret = zrpc_request_i32 (cur, &size)) <= 0)
+        return ret;
+      return zrpc_request_push (scan, ZRPC_REQUEST_FRAME_LIST,
+                                vtype, vtype, size);
+    default:
+      return -1;
+    }
+}
+
+/* keep method name of request */
+static int
+zrpc_request_name (struct zrpc_request_scan *scan,
+                   struct zrpc_request_cursor *cur, guint32 len)
+{
+  guint32 copy = MIN (len, ZRPC_REQUEST_NAME_MAX - 1);
+
+  if (cur->len - cur->pos < len)
+    return 0;
+  memcpy (scan->name, cur->data + cur->pos, copy);
+  scan->name[copy] = 0;
+  cur->pos += len;
+  return 1;
+}
+
+static int
+zrpc_request_binary_message (struct zrpc_request_scan *scan,
+                             struct zrpc_request_cursor *cur)
+{
+  guint32 version, size, seqid;
+  guint8 type;
+  int ret;
+
+  if ((ret = zrpc_request_i32 (cur, &version)) <= 0)
+    return ret;
+  if (version & 0x80000000)
+    {
+      if ((version & ZRPC_BINARY_VERSION_MASK) != ZRPC_BINARY_VERSION_1)
+        return -1;
+      /* name, then sequence id */
+      if ((ret = zrpc_request_i32 (cur, &size)) <= 0 ||
+          (ret = zrpc_request_name (scan, cur, size)) <= 0 ||
+          (ret = zrpc_request_i32 (cur, &seqid)) <= 0)
+        return ret;
+    }
+  /* old format: name, type and sequence id */
+  else if ((ret = zrpc_request_name (scan, cur, version)) <= 0 ||
+           (ret = zrpc_request_byte (cur, &type)) <= 0 ||
+           (ret = zrpc_request_i32 (cur, &seqid)) <= 0)
+    return ret;
+  scan->seqid = (gint32)seqid;
+  return 1;
+}
+
+static int
+zrpc_request_compact_value (struct zrpc_request_scan *scan,
+                            struct zrpc_request_cursor *cur,
+                            guint8 type, int in_list)
+{
+  guint8 header;
+  guint32 size;
+  int ret;
+
+  switch (type)
+    {
+    case ZRPC_COMPACT_BOOLEAN_TRUE:
+    case ZRPC_COMPACT_BOOLEAN_FALSE:
+      /* field header holds value, but not list header */
+      return in_list ? zrpc_request_skip (scan, cur, 1) : 1;
+    case ZRPC_COMPACT_BYTE:
+      return zrpc_request_skip (scan, cur, 1);
+    case ZRPC_COMPACT_I16:
+    case ZRPC_COMPACT_I32:
+    case ZRPC_COMPACT_I64:
+      return zrpc_request_varint (cur, &size);
+    case ZRPC_COMPACT_DOUBLE:
+      return zrpc_request_skip (scan, cur, 8);
+    case ZRPC_COMPACT_BINARY:
+      if ((ret = zrpc_request_varint (cur, &size)) <= 0)
+        return ret;
+      return zrpc_request_skip (scan, cur, size);
+    case ZRPC_COMPACT_STRUCT:
+      return zrpc_request_push (scan, ZRPC_REQUEST_FRAME_STRUCT, 0, 0, 0);
+    case ZRPC_COMPACT_MAP:
+      if ((ret = zrpc_request_varint (cur, &size)) <= 0)
+        return ret;
+      /* empty map has no types */
+      header = 0;
+      if (size && (ret = zrpc_request_byte (cur, &header)) <= 0)
+        return ret;
+      return zrpc_request_push (scan, ZRPC_REQUEST_FRAME_MAP,
+                                header >> 4, header & 0x0f, size);
+    case ZRPC_COMPACT_SET:
+    case ZRPC_COMPACT_LIST:
+      if ((ret = zrpc_request_byte (cur, &header)) <= 0)
+        return ret;
+      size = header >> 4;
+      if (size == 15 && (ret = zrpc_request_varint (cur, &size)) <= 0)
+        return ret;
+      return zrpc_request_push (scan, ZRPC_REQUEST_FRAME_LIST,
+                                header & 0x0f, header & 0x0f, size);
+    default:
+      return -1;
+    }
+}
+
+static int
+zrpc_request_compact_message (struct zrpc_request_scan *scan,
+                              struct zrpc_request_cursor *cur)
+{
+  guint8 id, version;
+  guint32 seqid, val;
+  int ret;
+
+  if ((ret = zrpc_request_byte (cur, &id)) <= 0)
+    return ret;
+  if (id != ZRPC_COMPACT_PROTOCOL_ID)
+    return -1;
+  if ((ret = zrpc_request_byte (cur, &version)) <= 0)
+    return ret;
+  if ((version & 0x1f) != ZRPC_COMPACT_VERSION)
+    return -1;
+  /* sequence id, then name */
+  if ((ret = zrpc_request_varint (cur, &seqid)) <= 0 ||
+      (ret = zrpc_request_varint (cur, &val)) <= 0 ||
+      (ret = zrpc_request_name (scan, cur, val)) <= 0)
+    return ret;
+  scan->seqid = (gint32)seqid;
+  return 1;
+}
+
+/* scan next field of innermost struct, or next element of
+ * innermost container. leave it once it is over */
+static int
+zrpc_request_step (struct zrpc_request_scan *scan,
+                   struct zrpc_request_cursor *cur, int protocol)
+{
+  struct zrpc_request_frame *frame = &scan->frames[scan->depth - 1];
+  guint8 header, type;
+  guint32 id;
+  int in_list, ret;
+
+  if (frame->kind == ZRPC_REQUEST_FRAME_STRUCT)
+    {
+      if ((ret = zrpc_request_byte (cur, &header)) <= 0)
+        return ret;
+      if (header == T_STOP)
+        {
+          scan->depth--;
+          return 1;
+        }
+      if (protocol == ZRPC_PROTOCOL_COMPACT)
+        {
+          /* field id is given if it is not a small delta */
+          if ((header >> 4) == 0 &&
+              (ret = zrpc_request_varint (cur, &id)) <= 0)
+            return ret;
+          type = header & 0x0f;
+        }
+      else
+        {
+          /* field id. not dropped partly, value follows */
+          if (cur->len - cur->pos < 2)
+            return 0;
+          cur->pos += 2;
+          type = header;
+        }
+      in_list = 0;
+    }
+  else
+    {
+      if (frame->remaining == 0)
+        {
+          scan->depth--;
+          return 1;
+        }
+      /* key first, remaining count being even */
+      type = frame->type[frame->remaining & 1];
+      in_list = 1;
+    }
+  if (protocol == ZRPC_PROTOCOL_COMPACT)
+    ret = zrpc_request_compact_value (scan, cur, type, in_list);
+  else
+    ret = zrpc_request_binary_value (scan, cur, type);
+  if (ret > 0 && frame->kind != ZRPC_REQUEST_FRAME_STRUCT)
+    frame->remaining--;
+  return ret;
+}
+
+/* drop bytes of request too big already scanned */
+static void
+zrpc_request_drop (ZrpcRequestBuffer *request)
+{
+  struct zrpc_request_scan *scan = request->scan;
+
+  g_byte_array_remove_range (request->buf, request->pos, scan->pos);
+  scan->pos = 0;
+}
+
+/* return length of first request not decoded yet, if it has been
+ * fully received. 0 if more bytes are needed, -1 if request is
+ * malformed. a request bigger than max size is dropped as it is
+ * received, ZRPC_REQUEST_TOO_BIG is returned once it is over: it
+ * is then answered by zrpc_request_reject() */
+gint32
+zrpc_request_length (ZrpcRequestBuffer *request, int protocol)
+{
+  struct zrpc_request_scan *scan = request->scan;
+  struct zrpc_request_cursor cur;
+  guint32 len;
+  int ret;
+
+  if (scan->rejected)
+    return ZRPC_REQUEST_TOO_BIG;
+  if (scan->length)
+    return scan->length;
+  cur.data = request->buf->data + request->pos;
+  cur.len = request->buf->len - request->pos;
+  cur.pos = scan->pos;
+  while (1)
+    {
+      if (scan->skip)
+        {
+          len = MIN (scan->skip, cur.len - cur.pos);
+          cur.pos += len;
+          scan->skip -= len;
+          scan->pos = cur.pos;
+          if (scan->skip)
+            break;
+        }
+      if (scan->started && scan->depth == 0)
+        {
+          if (scan->discard)
+            {
+              zrpc_request_drop (request);
+              scan->rejected = 1;
+              return ZRPC_REQUEST_TOO_BIG;
+            }
+          scan->length = cur.pos;
+          return scan->length;
+        }
+      if (scan->started)
+        ret = zrpc_request_step (scan, &cur, protocol);
+      else
+        {
+          if (protocol == ZRPC_PROTOCOL_COMPACT)
+            ret = zrpc_request_compact_message (scan, &cur);
+          else
+            ret = zrpc_request_binary_message (scan, &cur);
+          if (ret > 0)
+            ret = zrpc_request_push (scan, ZRPC_REQUEST_FRAME_STRUCT, 0, 0, 0);
+          if (ret > 0)
+            scan->started = 1;
+        }
+      if (ret < 0)
+        return -1;
+      if (ret == 0)
+        break;
+      scan->pos = cur.pos;
+    }
+  if (!scan->discard && cur.len >= request->max_size)
+    {
+      /* header is not even there */
+      if (!scan->started)
+        return -1;
+      scan->discard = 1;
+    }
+  if (scan->discard)
+    zrpc_request_drop (request);
+  return 0;
+}
+
+/* answer request too big with an application exception, whatever
+ * the method, on protocol of connection. next request is scanned
+ * afterwards */
+gboolean
+zrpc_request_reject (ZrpcRequestBuffer *request, ThriftProtocol *protocol,
+                     GError **error)
+{
+  struct zrpc_request_scan *scan = request->scan;
+  ThriftApplicationException *xception;
+  gboolean ret;
+
+  xception = g_object_new (THRIFT_TYPE_APPLICATION_EXCEPTION,
+                           "type", THRIFT_APPLICATION_EXCEPTION_ERROR_UNKNOWN,
+                           "message", "request too big",
+                           NULL);
+  ret = thrift_protocol_write_message_begin (protocol, scan->name, T_EXCEPTION,
+                                             scan->seqid, error) != -1 &&
+    thrift_struct_write (THRIFT_STRUCT (xception), protocol, error) != -1 &&
+    thrift_protocol_write_message_end (protocol, error) != -1 &&
+    thrift_transport_write_end (protocol->transport, error) &&
+    thrift_transport_flush (protocol->transport, error);
+  g_object_unref (xception);
+  zrpc_request_buffer_consume (request);
+  return ret;
+}
@@ -0,0 +1,60 @@
+/* zrpc thrift request buffer
+ * Copyright (c) 2016 6WIND,
+ *
+ * This file is part of ZRPC daemon.
+ *
+ * See the LICENSE file.
+ */
+#ifndef _ZRPC_REQUEST_H
+#define _ZRPC_REQUEST_H
+
+G_BEGIN_DECLS
+
+struct zrpc_request_scan;
+
+/* default biggest request accepted from a configurator connection.
+ * bigger requests are answered with an error */
+#define ZRPC_REQUEST_MAX_SIZE (64 * 1024 * 1024)
+
+/* zrpc_request_length() of a request too big, dropped */
+#define ZRPC_REQUEST_TOO_BIG (-2)
+
+#define ZRPC_TYPE_REQUEST_BUFFER \
+  (zrpc_request_buffer_get_type())
+
+#define ZRPC_REQUEST_BUFFER(obj) \
+  (G_TYPE_CHECK_INSTANCE_CAST ((obj),     \
+    ZRPC_TYPE_REQUEST_BUFFER,             \
+    ZrpcRequestBuffer))
+
+/* read only transport over the bytes received on a connection. bytes
+ * are received by zrpcd, and decoded once a whole request is there */
+struct _ZrpcRequestBuffer {
+  ThriftTransport parent;
+  GByteArray *buf;
+  /* bytes already decoded */
+  guint32 pos;
+  /* biggest request accepted */
+  guint32 max_size;
+  /* scan of first request not decoded yet, resumed as bytes come */
+  struct zrpc_request_scan *scan;
+};
+typedef struct _ZrpcRequestBuffer ZrpcRequestBuffer;
+
+struct _ZrpcRequestBufferClass {
+  ThriftTransportClass parent;
+};
+typedef struct _ZrpcRequestBufferClass ZrpcRequestBufferClass;
+
+GType zrpc_request_buffer_get_type (void);
+
+void zrpc_request_buffer_append (ZrpcRequestBuffer *request,
+                                 const guint8 *data, guint32 len);
+void zrpc_request_buffer_consume (ZrpcRequestBuffer *request);
+gint32 zrpc_request_length (ZrpcRequestBuffer *request, int protocol);
+gboolean zrpc_request_reject (ZrpcRequestBuffer *request, ThriftProtocol *protocol,
+                              GError **error);
+
+G_END_DECLS
+
+#endif /* _ZRPC_REQUEST_H */
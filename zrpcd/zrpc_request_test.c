@@ -0,0 +1,265 @@
+/* zrpc thrift request scanner test
+ * Copyright (c) 2016 6WIND,
+ *
+ * This file is part of ZRPC daemon.
+ *
+ * See the LICENSE file.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+#include "zrpcd/zrpc_thrift_wrapper.h"
+#include "zrpcd/bgp_configurator.h"
+#include "zrpcd/bgp_updater.h"
+#include "zrpcd/zrpc_bgp_configurator.h"
+#include "zrpcd/zrpc_vpnservice.h"
+#include "zrpcd/zrpc_request.h"
+
+#define ZRPC_REQUEST_TEST_SEQID 7
+
+/* encode a call with fields of every type. containers have nb_elems
+ * elements */
+static GByteArray *
+zrpc_request_test_encode (int protocol, const gchar *name, guint32 nb_elems)
+{
+  ThriftMemoryBuffer *buffer;
+  ThriftProtocol *proto;
+  GByteArray *data;
+  GError *error = NULL;
+  guint8 blob[40];
+  gchar key[16];
+  guint32 i, j;
+  int ret = 0;
+
+  memset (blob, 0xa5, sizeof (blob));
+  buffer = g_object_new (THRIFT_TYPE_MEMORY_BUFFER, "buf_size", 1 << 20, NULL);
+  proto = zrpc_vpnservice_protocol_new (protocol, buffer);
+  ret |= thrift_protocol_write_message_begin (proto, name, T_CALL,
+                                              ZRPC_REQUEST_TEST_SEQID, &error);
+  ret |= thrift_protocol_write_struct_begin (proto, "args", &error);
+  /* list of structs */
+  ret |= thrift_protocol_write_field_begin (proto, "routes", T_LIST, 1, &error);
+  ret |= thrift_protocol_write_list_begin (proto, T_STRUCT, nb_elems, &error);
+  for (i = 0; i < nb_elems; i++)
+    {
+      ret |= thrift_protocol_write_struct_begin (proto, "route", &error);
+      ret |= thrift_protocol_write_field_begin (proto, "rd", T_STRING, 1, &error);
+      ret |= thrift_protocol_write_string (proto, "100:1", &error);
+      ret |= thrift_protocol_write_field_begin (proto, "prefixlen", T_I32, 2, &error);
+      ret |= thrift_protocol_write_i32 (proto, 24, &error);
+      ret |= thrift_protocol_write_field_begin (proto, "label", T_I64, 3, &error);
+      ret |= thrift_protocol_write_i64 (proto, (gint64)i << 40, &error);
+      ret |= thrift_protocol_write_field_begin (proto, "local", T_BOOL, 4, &error);
+      ret |= thrift_protocol_write_bool (proto, i & 1, &error);
+      /* field id far from previous one */
+      ret |= thrift_protocol_write_field_begin (proto, "weight", T_DOUBLE, 100, &error);
+      ret |= thrift_protocol_write_double (proto, i / 3.0, &error);
+      ret |= thrift_protocol_write_field_begin (proto, "flags", T_BYTE, 101, &error);
+      ret |= thrift_protocol_write_byte (proto, i, &error);
+      ret |= thrift_protocol_write_field_begin (proto, "metric", T_I16, 102, &error);
+      ret |= thrift_protocol_write_i16 (proto, -i, &error);
+      ret |= thrift_protocol_write_field_stop (proto, &error);
+      ret |= thrift_protocol_write_struct_end (proto, &error);
+    }
+  ret |= thrift_protocol_write_list_end (proto, &error);
+  /* map of lists */
+  ret |= thrift_protocol_write_field_begin (proto, "attrs", T_MAP, 2, &error);
+  ret |= thrift_protocol_write_map_begin (proto, T_STRING, T_LIST, nb_elems, &error);
+  for (i = 0; i < nb_elems; i++)
+    {
+      snprintf (key, sizeof (key), "key%u", i);
+      ret |= thrift_protocol_write_string (proto, key, &error);
+      ret |= thrift_protocol_write_list_begin (proto, T_I32, i % 20, &error);
+      for (j = 0; j < i % 20; j++)
+        ret |= thrift_protocol_write_i32 (proto, j * 100000, &error);
+      ret |= thrift_protocol_write_list_end (proto, &error);
+    }
+  ret |= thrift_protocol_write_map_end (proto, &error);
+  /* set of binaries */
+  ret |= thrift_protocol_write_field_begin (proto, "blobs", T_SET, 3, &error);
+  ret |= thrift_protocol_write_set_begin (proto, T_STRING, nb_elems, &error);
+  for (i = 0; i < nb_elems; i++)
+    ret |= thrift_protocol_write_binary (proto, blob, i % sizeof (blob), &error);
+  ret |= thrift_protocol_write_set_end (proto, &error);
+  /* list of bools, one byte each in compact protocol */
+  ret |= thrift_protocol_write_field_begin (proto, "bools", T_LIST, 4, &error);
+  ret |= thrift_protocol_write_list_begin (proto, T_BOOL, nb_elems, &error);
+  for (i = 0; i < nb_elems; i++)
+    ret |= thrift_protocol_write_bool (proto, i % 3 == 0, &error);
+  ret |= thrift_protocol_write_list_end (proto, &error);
+  /* empty struct and map */
+  ret |= thrift_protocol_write_field_begin (proto, "empty", T_STRUCT, 5, &error);
+  ret |= thrift_protocol_write_struct_begin (proto, "empty", &error);
+  ret |= thrift_protocol_write_field_stop (proto, &error);
+  ret |= thrift_protocol_write_struct_end (proto, &error);
+  ret |= thrift_protocol_write_field_begin (proto, "none", T_MAP, 6, &error);
+  ret |= thrift_protocol_write_map_begin (proto, T_STRING, T_I32, 0, &error);
+  ret |= thrift_protocol_write_map_end (proto, &error);
+  ret |= thrift_protocol_write_field_stop (proto, &error);
+  ret |= thrift_protocol_write_struct_end (proto, &error);
+  ret |= thrift_protocol_write_message_end (proto, &error);
+  assert (ret >= 0 && error == NULL);
+  data = g_byte_array_new ();
+  g_byte_array_append (data, buffer->buf->data, buffer->buf->len);
+  g_object_unref (proto);
+  g_object_unref (buffer);
+  return data;
+}
+
+/* request has been decoded: drop it from buffer */
+static void
+zrpc_request_test_decoded (ZrpcRequestBuffer *request, gint32 len)
+{
+  request->pos += len;
+  zrpc_request_buffer_consume (request);
+}
+
+/* receive nb_requests copies of data back to back, in chunks of
+ * random size up to max_chunk. length of a request is given as soon
+ * as its last byte is there */
+static void
+zrpc_request_test_split (int protocol, GByteArray *data, guint32 nb_requests,
+                         guint32 max_chunk)
+{
+  ZrpcRequestBuffer *request;
+  guint32 sent = 0, total = nb_requests * data->len, chunk, done = 0;
+  gint32 len;
+
+  request = g_object_new (ZRPC_TYPE_REQUEST_BUFFER, NULL);
+  while (sent < total)
+    {
+      chunk = 1 + rand () % max_chunk;
+      chunk = MIN (chunk, total - sent);
+      while (chunk)
+        {
+          len = MIN (chunk, data->len - sent % data->len);
+          zrpc_request_buffer_append (request, data->data + sent % data->len, len);
+          sent += len;
+          chunk -= len;
+        }
+      while ((len = zrpc_request_length (request, protocol)) > 0)
+        {
+          assert (len == (gint32)data->len);
+          zrpc_request_test_decoded (request, len);
+          done++;
+        }
+      assert (len == 0);
+      /* whole request received, but not reported */
+      assert (request->buf->len < data->len);
+      assert (request->buf->len == sent - done * data->len);
+    }
+  assert (done == nb_requests);
+  assert (request->buf->len == 0);
+  g_object_unref (request);
+}
+
+/* a request over max size is dropped while received, and answered
+ * with an exception once over. next request is served */
+static void
+zrpc_request_test_too_big (int protocol, GByteArray *big, GByteArray *small)
+{
+  ZrpcRequestBuffer *request;
+  ThriftMemoryBuffer *buffer;
+  ThriftProtocol *proto;
+  ThriftMessageType type;
+  GError *error = NULL;
+  gchar *name = NULL;
+  guint32 sent, chunk;
+  gint32 seqid, len;
+
+  request = g_object_new (ZRPC_TYPE_REQUEST_BUFFER, NULL);
+  request->max_size = 256;
+  assert (small->len < request->max_size && big->len > 4 * request->max_size);
+  for (sent = 0; sent < big->len; sent += chunk)
+    {
+      chunk = 1 + rand () % 64;
+      chunk = MIN (chunk, big->len - sent);
+      zrpc_request_buffer_append (request, big->data + sent, chunk);
+      len = zrpc_request_length (request, protocol);
+      if (sent + chunk < big->len)
+        assert (len == 0);
+      else
+        assert (len == ZRPC_REQUEST_TOO_BIG);
+      assert (request->buf->len < request->max_size + 64);
+    }
+  assert (zrpc_request_length (request, protocol) == ZRPC_REQUEST_TOO_BIG);
+
+  buffer = g_object_new (THRIFT_TYPE_MEMORY_BUFFER, "buf_size", 4096, NULL);
+  proto = zrpc_vpnservice_protocol_new (protocol, buffer);
+  assert (zrpc_request_reject (request, proto, &error) == TRUE);
+  assert (thrift_protocol_read_message_begin (proto, &name, &type, &seqid, &error) > 0);
+  assert (strcmp (name, "pushRoutes") == 0);
+  assert (type == T_EXCEPTION);
+  assert (seqid == ZRPC_REQUEST_TEST_SEQID);
+  g_free (name);
+  g_object_unref (proto);
+  g_object_unref (buffer);
+
+  zrpc_request_buffer_append (request, small->data, small->len);
+  assert (zrpc_request_length (request, protocol) == (gint32)small->len);
+  zrpc_request_test_decoded (request, small->len);
+  assert (request->buf->len == 0);
+  g_object_unref (request);
+}
+
+static void
+zrpc_request_test_malformed (int protocol, const guint8 *data, guint32 len)
+{
+  ZrpcRequestBuffer *request;
+
+  request = g_object_new (ZRPC_TYPE_REQUEST_BUFFER, NULL);
+  zrpc_request_buffer_append (request, data, len);
+  assert (zrpc_request_length (request, protocol) == -1);
+  g_object_unref (request);
+}
+
+static void
+zrpc_request_test_protocol (int protocol)
+{
+  /* unknown version, then unknown field type */
+  static const guint8 binary_version[] = { 0x80, 0x02, 0x00, 0x01, 0, 0, 0, 0 };
+  static const guint8 binary_type[] =
+    { 0x80, 0x01, 0x00, 0x01, 0, 0, 0, 1, 'x', 0, 0, 0, 1, 0x05, 0, 1 };
+  static const guint8 compact_id[] = { 0x81, 0x21, 0x01, 0x01, 'x' };
+  static const guint8 compact_type[] = { 0x82, 0x21, 0x01, 0x01, 'x', 0x1d };
+  GByteArray *small, *big;
+  guint32 chunk;
+
+  small = zrpc_request_test_encode (protocol, "pushRoutes", 1);
+  big = zrpc_request_test_encode (protocol, "pushRoutes", 500);
+  zrpc_request_test_split (protocol, small, 20, 1);
+  zrpc_request_test_split (protocol, big, 3, 1);
+  for (chunk = 2; chunk < 2 * big->len; chunk *= 3)
+    zrpc_request_test_split (protocol, big, 5, chunk);
+  zrpc_request_test_too_big (protocol, big, small);
+  if (protocol == ZRPC_PROTOCOL_COMPACT)
+    {
+      zrpc_request_test_malformed (protocol, compact_id, sizeof (compact_id));
+      zrpc_request_test_malformed (protocol, compact_type, sizeof (compact_type));
+    }
+  else
+    {
+      zrpc_request_test_malformed (protocol, binary_version, sizeof (binary_version));
+      zrpc_request_test_malformed (protocol, binary_type, sizeof (binary_type));
+    }
+  g_byte_array_free (small, TRUE);
+  g_byte_array_free (big, TRUE);
+}
+
+int
+main (int argc, char **argv)
+{
+  srand (argc > 1 ? atoi (argv[1]) : 1);
+#if (!GLIB_CHECK_VERSION (2, 36, 0))
+  g_type_init ();
+#endif
+  zrpc_request_test_protocol (ZRPC_PROTOCOL_BINARY);
+#ifdef HAVE_THRIFT_COMPACT_PROTOCOL
+  zrpc_request_test_protocol (ZRPC_PROTOCOL_COMPACT);
+#endif
+  printf ("zrpc_request_test: ok\n");
+  return 0;
+}
@@ -0,0 +1,331 @@
+/* zrpc mirror RIB
+ * Copyright (c) 2016 6WIND,
+ *
+ * This file is part of ZRPC daemon.
+ *
+ * See the LICENSE file.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <arpa/inet.h>
+#include "zrpcd/zrpc_memory.h"
+#include "zrpcd/zrpc_util.h"
+#include "zrpcd/zrpc_rib.h"
+
+static inline uint32_t
+zrpc_rib_mask (uint8_t prefixlen)
+{
+  return prefixlen ? 0xffffffff << (32 - prefixlen) : 0;
+}
+
+static inline int
+zrpc_rib_bit (uint32_t addr, uint8_t pos)
+{
+  return (addr >> (31 - pos)) & 1;
+}
+
+/* return 1 if node prefix contains addr/prefixlen */
+static inline int
+zrpc_rib_match (struct zrpc_rib_node *node, uint32_t addr, uint8_t prefixlen)
+{
+  return node->prefixlen <= prefixlen &&
+    ((node->addr ^ addr) & zrpc_rib_mask (node->prefixlen)) == 0;
+}
+
+static struct zrpc_rib_node *
+zrpc_rib_node_new (uint32_t addr, uint8_t prefixlen)
+{
+  struct zrpc_rib_node *node;
+
+  node = ZRPC_CALLOC (sizeof (struct zrpc_rib_node));
+  node->addr = addr & zrpc_rib_mask (prefixlen);
+  node->prefixlen = prefixlen;
+  return node;
+}
+
+static void
+zrpc_rib_node_free (struct zrpc_rib_node *node)
+{
+  if (node->nb_paths > 1)
+    ZRPC_FREE (node->u.paths);
+  ZRPC_FREE (node);
+}
+
+/* replace child 'old' of parent with 'node' */
+static void
+zrpc_rib_set_link (struct zrpc_rib *rib, struct zrpc_rib_node *parent,
+                   struct zrpc_rib_node *old, struct zrpc_rib_node *node)
+{
+  if (node)
+    node->parent = parent;
+  if (parent == NULL)
+    rib->top = node;
+  else
+    parent->link[parent->link[1] == old] = node;
+}
+
+/* find node for prefix, create it if needed */
+static struct zrpc_rib_node *
+zrpc_rib_node_get (struct zrpc_rib *rib, uint32_t addr, uint8_t prefixlen)
+{
+  struct zrpc_rib_node *node, *parent = NULL, *branch, *leaf;
+  uint32_t diff;
+  uint8_t common;
+
+  addr &= zrpc_rib_mask (prefixlen);
+  node = rib->top;
+  while (node && zrpc_rib_match (node, addr, prefixlen))
+    {
+      if (node->prefixlen == prefixlen)
+        return node;
+      parent = node;
+      node = node->link[zrpc_rib_bit (addr, node->prefixlen)];
+    }
+  leaf = zrpc_rib_node_new (addr, prefixlen);
+  if (node == NULL)
+    {
+      leaf->parent = parent;
+      if (parent == NULL)
+        rib->top = leaf;
+      else
+        parent->link[zrpc_rib_bit (addr, parent->prefixlen)] = leaf;
+      return leaf;
+    }
+  /* node and prefix diverge: insert above node */
+  diff = node->addr ^ addr;
+  common = diff ? __builtin_clz (diff) : 32;
+  if (common > prefixlen)
+    common = prefixlen;
+  if (common > node->prefixlen)
+    common = node->prefixlen;
+  if (common == prefixlen)
+    {
+      /* new prefix contains node */
+      zrpc_rib_set_link (rib, parent, node, leaf);
+      leaf->link[zrpc_rib_bit (node->addr, prefixlen)] = node;
+      node->parent = leaf;
+      return leaf;
+    }
+  branch = zrpc_rib_node_new (addr, common);
+  zrpc_rib_set_link (rib, parent, node, branch);
+  branch->link[zrpc_rib_bit (node->addr, common)] = node;
+  node->parent = branch;
+  branch->link[zrpc_rib_bit (addr, common)] = leaf;
+  leaf->parent = branch;
+  return leaf;
+}
+
+static struct zrpc_rib_node *
+zrpc_rib_node_lookup (struct zrpc_rib *rib, uint32_t addr, uint8_t prefixlen)
+{
+  struct zrpc_rib_node *node = rib->top;
+
+  addr &= zrpc_rib_mask (prefixlen);
+  while (node && zrpc_rib_match (node, addr, prefixlen))
+    {
+      if (node->prefixlen == prefixlen)
+        return node->nb_paths ? node : NULL;
+      node = node->link[zrpc_rib_bit (addr, node->prefixlen)];
+    }
+  return NULL;
+}
+
+/* remove nodes that have no path, and less than two children */
+static void
+zrpc_rib_node_release (struct zrpc_rib *rib, struct zrpc_rib_node *node)
+{
+  struct zrpc_rib_node *parent, *child;
+
+  while (node && node->nb_paths == 0 &&
+         (node->link[0] == NULL || node->link[1] == NULL))
+    {
+      child = node->link[0] ? node->link[0] : node->link[1];
+      parent = node->parent;
+      zrpc_rib_set_link (rib, parent, node, child);
+      zrpc_rib_node_free (node);
+      node = parent;
+    }
+}
+
+struct zrpc_rib *
+zrpc_rib_new (void)
+{
+  return ZRPC_CALLOC (sizeof (struct zrpc_rib));
+}
+
+static void
+zrpc_rib_free_tree (struct zrpc_rib_node *node)
+{
+  if (node == NULL)
+    return;
+  zrpc_rib_free_tree (node->link[0]);
+  zrpc_rib_free_tree (node->link[1]);
+  zrpc_rib_node_free (node);
+}
+
+void
+zrpc_rib_free (struct zrpc_rib *rib)
+{
+  if (rib == NULL)
+    return;
+  zrpc_rib_free_tree (rib->top);
+  ZRPC_FREE (rib);
+}
+
+/* add or update path of prefix. paths are identified by nexthop.
+ * return 1 if a new path is added */
+int
+zrpc_rib_add (struct zrpc_rib *rib, const struct zrpc_ipv4_prefix *p,
+              struct in_addr nexthop, uint32_t label, uint8_t flags)
+{
+  struct zrpc_rib_node *node;
+  struct zrpc_rib_path *paths, *array;
+  uint16_t i;
+
+  node = zrpc_rib_node_get (rib, ntohl (p->prefix.s_addr), p->prefixlen);
+  paths = ZRPC_RIB_NODE_PATHS (node);
+  for (i = 0; i < node->nb_paths; i++)
+    if (paths[i].nexthop.s_addr == nexthop.s_addr)
+      {
+        paths[i].label = label;
+        paths[i].flags |= flags;
+        return 0;
+      }
+  if (node->nb_paths == 0)
+    {
+      paths = &node->u.path;
+      rib->nb_prefixes++;
+    }
+  else if (node->nb_paths == 1)
+    {
+      array = ZRPC_MALLOC (2 * sizeof (struct zrpc_rib_path));
+      array[0] = node->u.path;
+      node->u.paths = array;
+      paths = array;
+    }
+  else
+    {
+      paths = ZRPC_REALLOC (node->u.paths,
+                            (node->nb_paths + 1) * sizeof (struct zrpc_rib_path));
+      node->u.paths = paths;
+    }
+  paths[node->nb_paths].nexthop = nexthop;
+  paths[node->nb_paths].label = label;
+  paths[node->nb_paths].flags = flags;
+  node->nb_paths++;
+  rib->nb_paths++;
+  return 1;
+}
+
+/* remove paths of prefix having all given flags set, and given
+ * nexthop unless nexthop is 0. return number of paths removed */
+int
+zrpc_rib_del (struct zrpc_rib *rib, const struct zrpc_ipv4_prefix *p,
+              struct in_addr nexthop, uint8_t flags)
+{
+  struct zrpc_rib_node *node;
+  struct zrpc_rib_path *paths, last;
+  uint16_t i;
+  int removed = 0;
+
+  node = zrpc_rib_node_lookup (rib, ntohl (p->prefix.s_addr), p->prefixlen);
+  if (node == NULL)
+    return 0;
+  i = 0;
+  while (i < node->nb_paths)
+    {
+      paths = ZRPC_RIB_NODE_PATHS (node);
+      if ((paths[i].flags & flags) != flags ||
+          (nexthop.s_addr && paths[i].nexthop.s_addr != nexthop.s_addr))
+        {
+          i++;
+          continue;
+        }
+      /* move last path into the hole */
+      paths[i] = paths[node->nb_paths - 1];
+      if (node->nb_paths == 2)
+        {
+          /* back to inline storage */
+          last = paths[0];
+          ZRPC_FREE (paths);
+          node->u.path = last;
+        }
+      node->nb_paths--;
+      removed++;
+    }
+  rib->nb_paths -= removed;
+  if (removed && node->nb_paths == 0)
+    {
+      rib->nb_prefixes--;
+      zrpc_rib_node_release (rib, node);
+    }
+  return removed;
+}
+
+/* first node with paths in pre-order */
+static struct zrpc_rib_node *
+zrpc_rib_node_first (struct zrpc_rib_node *node)
+{
+  /* nodes without path always have two children */
+  while (node && node->nb_paths == 0)
+    node = node->link[0];
+  return node;
+}
+
+/* first node with paths of subtree coming after addr/prefixlen */
+static struct zrpc_rib_node *
+zrpc_rib_node_after (struct zrpc_rib_node *node, uint32_t addr, uint8_t prefixlen)
+{
+  struct zrpc_rib_node *next;
+  uint32_t diff;
+  uint8_t pos;
+
+  if (node == NULL)
+    return NULL;
+  if (!zrpc_rib_match (node, addr, prefixlen))
+    {
+      diff = (node->addr ^ addr) & zrpc_rib_mask (node->prefixlen < prefixlen ? node->prefixlen : prefixlen);
+      /* prefix contains whole subtree */
+      if (diff == 0)
+        return zrpc_rib_node_first (node);
+      pos = __builtin_clz (diff);
+      if (zrpc_rib_bit (node->addr, pos))
+        return zrpc_rib_node_first (node);
+      return NULL;
+    }
+  /* node contains prefix, and comes before it */
+  if (node->prefixlen == prefixlen)
+    {
+      next = zrpc_rib_node_first (node->link[0]);
+      return next ? next : zrpc_rib_node_first (node->link[1]);
+    }
+  if (zrpc_rib_bit (addr, node->prefixlen))
+    return zrpc_rib_node_after (node->link[1], addr, prefixlen);
+  next = zrpc_rib_node_after (node->link[0], addr, prefixlen);
+  return next ? next : zrpc_rib_node_first (node->link[1]);
+}
+
+struct zrpc_rib_node *
+zrpc_rib_first (struct zrpc_rib *rib)
+{
+  return zrpc_rib_node_first (rib->top);
+}
+
+/* return node following prefix p, which needs not be in the RIB */
+struct zrpc_rib_node *
+zrpc_rib_next (struct zrpc_rib *rib, const struct zrpc_ipv4_prefix *p)
+{
+  return zrpc_rib_node_after (rib->top,
+                              ntohl (p->prefix.s_addr) & zrpc_rib_mask (p->prefixlen),
+                              p->prefixlen);
+}
+
+void
+zrpc_rib_node_prefix (struct zrpc_rib_node *node, struct zrpc_ipv4_prefix *p)
+{
+  memset (p, 0, sizeof (struct zrpc_ipv4_prefix));
+  p->family = AF_INET;
+  p->prefixlen = node->prefixlen;
+  p->prefix.s_addr = htonl (node->addr);
+}
@@ -0,0 +1,73 @@
+/* zrpc mirror RIB
+ * Copyright (c) 2016 6WIND,
+ *
+ * This file is part of ZRPC daemon.
+ *
+ * See the LICENSE file.
+ */
+#ifndef _ZRPC_RIB_H
+#define _ZRPC_RIB_H
+
+#include <stdint.h>
+#include <arpa/inet.h>
+#include "zrpcd/zrpc_util.h"
+
+/*
+ * local copy of the routes of a VRF, as notified by bgpd. used to
+ * serve getRoutes without walking bgpd tables.
+ * IPv4 prefixes are stored in a path compressed binary trie. nodes
+ * without path are branching nodes, and always have two children.
+ * walking the trie in pre-order gives prefixes in lexicographic order
+ * of their bits, a prefix coming before its more specifics.
+ */
+struct zrpc_rib_path
+{
+  struct in_addr nexthop;
+  uint32_t label:24;
+  uint32_t flags:8;
+#define ZRPC_RIB_PATH_LOCAL 0x01 /* route pushed through zrpcd */
+};
+
+struct zrpc_rib_node
+{
+  struct zrpc_rib_node *link[2];
+  struct zrpc_rib_node *parent;
+
+  /* prefix, in host byte order */
+  uint32_t addr;
+  uint8_t prefixlen;
+
+  /* paths of prefix. a single path is stored inline */
+  uint16_t nb_paths;
+  union
+  {
+    struct zrpc_rib_path path;
+    struct zrpc_rib_path *paths;
+  } u;
+};
+
+#define ZRPC_RIB_NODE_PATHS(node) \
+  ((node)->nb_paths > 1 ? (node)->u.paths : &(node)->u.path)
+
+struct zrpc_rib
+{
+  struct zrpc_rib_node *top;
+  uint32_t nb_prefixes;
+  uint32_t nb_paths;
+
+  /* set once the RIB holds the whole bgpd VRF table */
+  int synced;
+};
+
+extern struct zrpc_rib *zrpc_rib_new (void);
+extern void zrpc_rib_free (struct zrpc_rib *rib);
+extern int zrpc_rib_add (struct zrpc_rib *rib, const struct zrpc_ipv4_prefix *p,
+                         struct in_addr nexthop, uint32_t label, uint8_t flags);
+extern int zrpc_rib_del (struct zrpc_rib *rib, const struct zrpc_ipv4_prefix *p,
+                         struct in_addr nexthop, uint8_t flags);
+extern struct zrpc_rib_node *zrpc_rib_first (struct zrpc_rib *rib);
+extern struct zrpc_rib_node *zrpc_rib_next (struct zrpc_rib *rib,
+                                            const struct zrpc_ipv4_prefix *p);
+extern void zrpc_rib_node_prefix (struct zrpc_rib_node *node, struct zrpc_ipv4_prefix *p);
+
+#endif /* _ZRPC_RIB_H */
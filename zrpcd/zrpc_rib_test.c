@@ -0,0 +1,236 @@
+/* zrpc mirror RIB test
+ * Copyright (c) 2016 6WIND,
+ *
+ * This file is part of ZRPC daemon.
+ *
+ * See the LICENSE file.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <arpa/inet.h>
+#include "zrpcd/zrpc_util.h"
+#include "zrpcd/zrpc_rib.h"
+
+/* reference model: one entry per path, unsorted */
+struct zrpc_rib_test_path
+{
+  uint32_t addr;
+  uint8_t prefixlen;
+  uint32_t nexthop;
+  uint32_t label;
+  uint8_t flags;
+};
+
+#define ZRPC_RIB_TEST_MAX_PATHS 4096
+static struct zrpc_rib_test_path model[ZRPC_RIB_TEST_MAX_PATHS];
+static unsigned int nb_model;
+
+static uint32_t
+zrpc_rib_test_mask (uint8_t prefixlen)
+{
+  return prefixlen ? 0xffffffff << (32 - prefixlen) : 0;
+}
+
+/* order of a RIB walk: prefix bits, a prefix before its more specifics */
+static int
+zrpc_rib_test_cmp (uint32_t addr1, uint8_t len1, uint32_t addr2, uint8_t len2)
+{
+  if (addr1 != addr2)
+    return addr1 < addr2 ? -1 : 1;
+  return len1 == len2 ? 0 : (len1 < len2 ? -1 : 1);
+}
+
+static void
+zrpc_rib_test_prefix (struct zrpc_ipv4_prefix *p, uint32_t addr, uint8_t prefixlen)
+{
+  memset (p, 0, sizeof (struct zrpc_ipv4_prefix));
+  p->family = AF_INET;
+  p->prefixlen = prefixlen;
+  p->prefix.s_addr = htonl (addr);
+}
+
+/* few distinct bits, so that prefixes often contain each other */
+static void
+zrpc_rib_test_random_prefix (uint32_t *addr, uint8_t *prefixlen)
+{
+  static const uint8_t lens[] = { 0, 8, 9, 16, 23, 24, 25, 32 };
+
+  *prefixlen = lens[rand () % sizeof (lens)];
+  *addr = (0x0a000000 | ((rand () & 0x3) << 22) | ((rand () & 0x3) << 15) |
+           ((rand () & 0x3) << 7) | (rand () & 0x1)) & zrpc_rib_test_mask (*prefixlen);
+}
+
+static int
+zrpc_rib_test_model_find (uint32_t addr, uint8_t prefixlen, uint32_t nexthop)
+{
+  unsigned int i;
+
+  for (i = 0; i < nb_model; i++)
+    if (model[i].addr == addr && model[i].prefixlen == prefixlen &&
+        model[i].nexthop == nexthop)
+      return i;
+  return -1;
+}
+
+static void
+zrpc_rib_test_add (struct zrpc_rib *rib, uint32_t addr, uint8_t prefixlen,
+                   uint32_t nexthop, uint32_t label, uint8_t flags)
+{
+  struct zrpc_ipv4_prefix p;
+  struct in_addr nh;
+  int i, ret;
+
+  zrpc_rib_test_prefix (&p, addr, prefixlen);
+  nh.s_addr = htonl (nexthop);
+  ret = zrpc_rib_add (rib, &p, nh, label, flags);
+  i = zrpc_rib_test_model_find (addr, prefixlen, nexthop);
+  if (i >= 0)
+    {
+      assert (ret == 0);
+      model[i].label = label;
+      model[i].flags |= flags;
+      return;
+    }
+  assert (ret == 1);
+  assert (nb_model < ZRPC_RIB_TEST_MAX_PATHS);
+  model[nb_model].addr = addr;
+  model[nb_model].prefixlen = prefixlen;
+  model[nb_model].nexthop = nexthop;
+  model[nb_model].label = label;
+  model[nb_model].flags = flags;
+  nb_model++;
+}
+
+static void
+zrpc_rib_test_del (struct zrpc_rib *rib, uint32_t addr, uint8_t prefixlen,
+                   uint32_t nexthop, uint8_t flags)
+{
+  struct zrpc_ipv4_prefix p;
+  struct in_addr nh;
+  unsigned int i;
+  int removed = 0;
+
+  zrpc_rib_test_prefix (&p, addr, prefixlen);
+  nh.s_addr = htonl (nexthop);
+  i = 0;
+  while (i < nb_model)
+    {
+      if (model[i].addr != addr || model[i].prefixlen != prefixlen ||
+          (model[i].flags & flags) != flags ||
+          (nexthop && model[i].nexthop != nexthop))
+        {
+          i++;
+          continue;
+        }
+      model[i] = model[--nb_model];
+      removed++;
+    }
+  assert (zrpc_rib_del (rib, &p, nh, flags) == removed);
+}
+
+/* walk RIB and check it holds the paths of model, in order */
+static void
+zrpc_rib_test_check (struct zrpc_rib *rib)
+{
+  struct zrpc_rib_node *node;
+  struct zrpc_rib_path *paths;
+  struct zrpc_ipv4_prefix p;
+  uint32_t addr = 0, nb_prefixes = 0, nb_paths = 0;
+  uint8_t prefixlen = 0;
+  uint16_t j;
+  int i;
+
+  for (node = zrpc_rib_first (rib); node; node = zrpc_rib_next (rib, &p))
+    {
+      zrpc_rib_node_prefix (node, &p);
+      assert (p.family == AF_INET);
+      assert (node->nb_paths > 0);
+      if (nb_prefixes)
+        assert (zrpc_rib_test_cmp (addr, prefixlen, ntohl (p.prefix.s_addr),
+                                   p.prefixlen) < 0);
+      addr = ntohl (p.prefix.s_addr);
+      prefixlen = p.prefixlen;
+      paths = ZRPC_RIB_NODE_PATHS (node);
+      for (j = 0; j < node->nb_paths; j++)
+        {
+          i = zrpc_rib_test_model_find (addr, prefixlen, ntohl (paths[j].nexthop.s_addr));
+          assert (i >= 0);
+          assert (model[i].label == paths[j].label);
+          assert (model[i].flags == paths[j].flags);
+        }
+      nb_prefixes++;
+      nb_paths += node->nb_paths;
+    }
+  assert (nb_paths == nb_model);
+  assert (nb_paths == rib->nb_paths);
+  assert (nb_prefixes == rib->nb_prefixes);
+}
+
+/* next of a prefix not necessarily in RIB is the first greater one */
+static void
+zrpc_rib_test_check_next (struct zrpc_rib *rib, uint32_t addr, uint8_t prefixlen)
+{
+  struct zrpc_rib_node *node;
+  struct zrpc_ipv4_prefix p;
+  unsigned int i, best = nb_model;
+
+  for (i = 0; i < nb_model; i++)
+    if (zrpc_rib_test_cmp (addr, prefixlen, model[i].addr, model[i].prefixlen) < 0 &&
+        (best == nb_model ||
+         zrpc_rib_test_cmp (model[i].addr, model[i].prefixlen,
+                            model[best].addr, model[best].prefixlen) < 0))
+      best = i;
+  zrpc_rib_test_prefix (&p, addr, prefixlen);
+  node = zrpc_rib_next (rib, &p);
+  if (best == nb_model)
+    {
+      assert (node == NULL);
+      return;
+    }
+  assert (node != NULL);
+  assert (node->addr == model[best].addr);
+  assert (node->prefixlen == model[best].prefixlen);
+}
+
+int
+main (int argc, char **argv)
+{
+  struct zrpc_rib *rib;
+  uint32_t addr;
+  uint8_t prefixlen;
+  int round, i;
+
+  srand (argc > 1 ? atoi (argv[1]) : 1);
+  rib = zrpc_rib_new ();
+  assert (zrpc_rib_first (rib) == NULL);
+  for (round = 0; round < 200; round++)
+    {
+      for (i = 0; i < 50; i++)
+        {
+          zrpc_rib_test_random_prefix (&addr, &prefixlen);
+          if (rand () % 3)
+            zrpc_rib_test_add (rib, addr, prefixlen, 1 + rand () % 3,
+                               rand () % 1000, rand () % 2 ? ZRPC_RIB_PATH_LOCAL : 0);
+          else
+            zrpc_rib_test_del (rib, addr, prefixlen, rand () % 2 ? 0 : 1 + rand () % 3,
+                               rand () % 2 ? ZRPC_RIB_PATH_LOCAL : 0);
+        }
+      zrpc_rib_test_check (rib);
+      for (i = 0; i < 20; i++)
+        {
+          zrpc_rib_test_random_prefix (&addr, &prefixlen);
+          zrpc_rib_test_check_next (rib, addr, prefixlen);
+        }
+    }
+  /* drain */
+  while (nb_model)
+    zrpc_rib_test_del (rib, model[0].addr, model[0].prefixlen, 0, 0);
+  zrpc_rib_test_check (rib);
+  assert (rib->top == NULL);
+  zrpc_rib_free (rib);
+  printf ("zrpc_rib_test: ok\n");
+  return 0;
+}
@@ -0,0 +1,230 @@
+/* zrpc configurator request statistics
+ * Copyright (c) 2016 6WIND,
+ *
+ * This file is part of ZRPC daemon.
+ *
+ * See the LICENSE file.
+ */
+#include <string.h>
+#include <time.h>
+
+#include "zrpcd/zrpc_stats.h"
+
+static struct zrpc_stats_counters zrpc_stats[ZRPC_STATS_RPC_MAX];
+
+static const char *zrpc_stats_names[ZRPC_STATS_RPC_MAX] =
+{
+  "request",
+  "createPeer",
+  "startBgp",
+  "stopBgp",
+  "deletePeer",
+  "addVrf",
+  "delVrf",
+  "pushRoute",
+  "withdrawRoute",
+  "setEbgpMultihop",
+  "unsetEbgpMultihop",
+  "setUpdateSource",
+  "unsetUpdateSource",
+  "enableAddressFamily",
+  "disableAddressFamily",
+  "setLogConfig",
+  "enableGracefulRestart",
+  "disableGracefulRestart",
+  "getRoutes",
+  "enableMultipath",
+  "disableMultipath",
+  "multipaths",
+  "pushRoutes",
+  "withdrawRoutes",
+  "resumeNotifications",
+  "applyConfig",
+};
+
+static struct zrpc_stats_qzc_snapshot zrpc_stats_qzc;
+
+/* QZCRequest types */
+static const char *zrpc_stats_qzc_names[ZRPC_STATS_QZC_TYPES] =
+{
+  "ping",
+  "nodeinfo",
+  "wknresolve",
+  "get",
+  "create",
+  "set",
+  "del",
+  "unset",
+};
+
+/* bgpd requests of calling thread. requests made inside another
+ * one, like a batch waiting for its replies, are not counted twice */
+static __thread uint64_t zrpc_stats_qzc_time;
+static __thread uint64_t zrpc_stats_qzc_calls;
+static __thread uint64_t zrpc_stats_qzc_start;
+static __thread int zrpc_stats_qzc_depth;
+
+/* monotonic time in microseconds */
+uint64_t
+zrpc_stats_now (void)
+{
+  struct timespec ts;
+
+  clock_gettime (CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+static int
+zrpc_stats_bucket (uint64_t usecs)
+{
+  int i = 0;
+
+  while (i < ZRPC_STATS_BUCKETS - 1 && usecs >= (1ULL << i))
+    i++;
+  return i;
+}
+
+static void
+zrpc_stats_max (uint64_t *max_us, uint64_t usecs)
+{
+  uint64_t max = __atomic_load_n (max_us, __ATOMIC_RELAXED);
+
+  while (usecs > max &&
+         !__atomic_compare_exchange_n (max_us, &max, usecs, 1,
+                                       __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+}
+
+/* zero counters, words by words */
+static void
+zrpc_stats_zero (uint64_t *counters, size_t size)
+{
+  size_t i;
+
+  for (i = 0; i < size / sizeof (uint64_t); i++)
+    __atomic_store_n (&counters[i], 0, __ATOMIC_RELAXED);
+}
+
+void
+zrpc_stats_begin (struct zrpc_stats_call *call, int rpc)
+{
+  call->rpc = rpc;
+  call->qzc_time_us = zrpc_stats_qzc_time;
+  call->qzc_calls = zrpc_stats_qzc_calls;
+  call->start = zrpc_stats_now ();
+}
+
+void
+zrpc_stats_end (struct zrpc_stats_call *call, int error)
+{
+  struct zrpc_stats_counters *counters;
+  uint64_t usecs, max;
+
+  if (call->rpc < 0 || call->rpc >= ZRPC_STATS_RPC_MAX)
+    return;
+  counters = &zrpc_stats[call->rpc];
+  usecs = zrpc_stats_now () - call->start;
+  __atomic_fetch_add (&counters->calls, 1, __ATOMIC_RELAXED);
+  if (error)
+    __atomic_fetch_add (&counters->errors, 1, __ATOMIC_RELAXED);
+  __atomic_fetch_add (&counters->time_us, usecs, __ATOMIC_RELAXED);
+  __atomic_fetch_add (&counters->qzc_time_us,
+                      zrpc_stats_qzc_time - call->qzc_time_us, __ATOMIC_RELAXED);
+  __atomic_fetch_add (&counters->qzc_calls,
+                      zrpc_stats_qzc_calls - call->qzc_calls, __ATOMIC_RELAXED);
+  __atomic_fetch_add (&counters->buckets[zrpc_stats_bucket (usecs)], 1,
+                      __ATOMIC_RELAXED);
+  zrpc_stats_max (&counters->max_us, usecs);
+}
+
+/* bgpd request of calling thread starts */
+void
+zrpc_stats_qzc_begin (void)
+{
+  if (zrpc_stats_qzc_depth++ == 0)
+    zrpc_stats_qzc_start = zrpc_stats_now ();
+}
+
+void
+zrpc_stats_qzc_end (void)
+{
+  if (--zrpc_stats_qzc_depth)
+    return;
+  zrpc_stats_qzc_time += zrpc_stats_now () - zrpc_stats_qzc_start;
+  zrpc_stats_qzc_calls++;
+}
+
+const char *
+zrpc_stats_name (int rpc)
+{
+  if (rpc < 0 || rpc >= ZRPC_STATS_RPC_MAX)
+    return "unknown";
+  return zrpc_stats_names[rpc];
+}
+
+/* copy of counters of rpc */
+void
+zrpc_stats_get (int rpc, struct zrpc_stats_counters *counters)
+{
+  uint64_t *src = (uint64_t *)&zrpc_stats[rpc];
+  uint64_t *dst = (uint64_t *)counters;
+  size_t i;
+
+  for (i = 0; i < sizeof (*counters) / sizeof (uint64_t); i++)
+    dst[i] = __atomic_load_n (&src[i], __ATOMIC_RELAXED);
+}
+
+/* calls in progress are accounted once done */
+void
+zrpc_stats_clear (void)
+{
+  zrpc_stats_zero ((uint64_t *)zrpc_stats, sizeof (zrpc_stats));
+}
+
+/* reply of bgpd request received, or request failed */
+void
+zrpc_stats_qzc_request (int type, int elem, uint64_t sent, uint64_t received,
+                        uint64_t usecs, int error)
+{
+  struct zrpc_stats_qzc_counters *counters;
+
+  if (type < 0 || type >= ZRPC_STATS_QZC_TYPES)
+    return;
+  if (elem < 0 || elem >= ZRPC_STATS_QZC_ELEMS)
+    elem = ZRPC_STATS_QZC_ELEMS - 1;
+  counters = &zrpc_stats_qzc.counters[type][elem];
+  __atomic_fetch_add (&counters->calls, 1, __ATOMIC_RELAXED);
+  if (error)
+    __atomic_fetch_add (&counters->errors, 1, __ATOMIC_RELAXED);
+  __atomic_fetch_add (&counters->bytes_sent, sent, __ATOMIC_RELAXED);
+  __atomic_fetch_add (&counters->bytes_received, received, __ATOMIC_RELAXED);
+  __atomic_fetch_add (&counters->time_us, usecs, __ATOMIC_RELAXED);
+  __atomic_fetch_add (&counters->buckets[zrpc_stats_bucket (usecs)], 1,
+                      __ATOMIC_RELAXED);
+  zrpc_stats_max (&counters->max_us, usecs);
+}
+
+const char *
+zrpc_stats_qzc_type_name (int type)
+{
+  if (type < 0 || type >= ZRPC_STATS_QZC_TYPES)
+    return "unknown";
+  return zrpc_stats_qzc_names[type];
+}
+
+/* copy of whole bgpd requests profile */
+void
+zrpc_stats_qzc_snapshot (struct zrpc_stats_qzc_snapshot *snapshot)
+{
+  uint64_t *src = (uint64_t *)&zrpc_stats_qzc;
+  uint64_t *dst = (uint64_t *)snapshot;
+  size_t i;
+
+  for (i = 0; i < sizeof (*snapshot) / sizeof (uint64_t); i++)
+    dst[i] = __atomic_load_n (&src[i], __ATOMIC_RELAXED);
+}
+
+void
+zrpc_stats_qzc_clear (void)
+{
+  zrpc_stats_zero ((uint64_t *)&zrpc_stats_qzc, sizeof (zrpc_stats_qzc));
+}
@@ -0,0 +1,108 @@
+/* zrpc configurator request statistics
+ * Copyright (c) 2016 6WIND,
+ *
+ * This file is part of ZRPC daemon.
+ *
+ * See the LICENSE file.
+ */
+#ifndef _ZRPC_STATS_H
+#define _ZRPC_STATS_H
+
+#include <stdint.h>
+
+/* accounted configurator calls. ZRPC_STATS_REQUEST is the whole
+ * request: decoding, handler, and reply */
+enum zrpc_stats_rpc
+{
+  ZRPC_STATS_REQUEST = 0,
+  ZRPC_STATS_CREATE_PEER,
+  ZRPC_STATS_START_BGP,
+  ZRPC_STATS_STOP_BGP,
+  ZRPC_STATS_DELETE_PEER,
+  ZRPC_STATS_ADD_VRF,
+  ZRPC_STATS_DEL_VRF,
+  ZRPC_STATS_PUSH_ROUTE,
+  ZRPC_STATS_WITHDRAW_ROUTE,
+  ZRPC_STATS_SET_EBGP_MULTIHOP,
+  ZRPC_STATS_UNSET_EBGP_MULTIHOP,
+  ZRPC_STATS_SET_UPDATE_SOURCE,
+  ZRPC_STATS_UNSET_UPDATE_SOURCE,
+  ZRPC_STATS_ENABLE_ADDRESS_FAMILY,
+  ZRPC_STATS_DISABLE_ADDRESS_FAMILY,
+  ZRPC_STATS_SET_LOG_CONFIG,
+  ZRPC_STATS_ENABLE_GRACEFUL_RESTART,
+  ZRPC_STATS_DISABLE_GRACEFUL_RESTART,
+  ZRPC_STATS_GET_ROUTES,
+  ZRPC_STATS_ENABLE_MULTIPATH,
+  ZRPC_STATS_DISABLE_MULTIPATH,
+  ZRPC_STATS_MULTIPATHS,
+  ZRPC_STATS_PUSH_ROUTES,
+  ZRPC_STATS_WITHDRAW_ROUTES,
+  ZRPC_STATS_RESUME_NOTIFICATIONS,
+  ZRPC_STATS_APPLY_CONFIG,
+  ZRPC_STATS_RPC_MAX
+};
+
+/* latency histogram: bucket i counts calls under 2^i us, last
+ * bucket counts slower ones */
+#define ZRPC_STATS_BUCKETS 24
+
+/* counters are updated by main and worker threads without lock */
+struct zrpc_stats_counters
+{
+  uint64_t calls;
+  uint64_t errors;
+  uint64_t time_us;
+  uint64_t max_us;
+  /* time and calls of bgpd requests made by call */
+  uint64_t qzc_time_us;
+  uint64_t qzc_calls;
+  uint64_t buckets[ZRPC_STATS_BUCKETS];
+};
+
+/* one call being measured */
+struct zrpc_stats_call
+{
+  int rpc;
+  uint64_t start;
+  uint64_t qzc_time_us;
+  uint64_t qzc_calls;
+};
+
+/* bgpd requests profile, per QZC request type and elem id. last
+ * elem slot gathers higher elem ids, and requests with no elem */
+#define ZRPC_STATS_QZC_TYPES 8
+#define ZRPC_STATS_QZC_ELEMS 16
+
+struct zrpc_stats_qzc_counters
+{
+  uint64_t calls;
+  uint64_t errors;
+  uint64_t bytes_sent;
+  uint64_t bytes_received;
+  /* from request sent to reply received */
+  uint64_t time_us;
+  uint64_t max_us;
+  uint64_t buckets[ZRPC_STATS_BUCKETS];
+};
+
+struct zrpc_stats_qzc_snapshot
+{
+  struct zrpc_stats_qzc_counters counters[ZRPC_STATS_QZC_TYPES][ZRPC_STATS_QZC_ELEMS];
+};
+
+extern uint64_t zrpc_stats_now (void);
+extern void zrpc_stats_begin (struct zrpc_stats_call *call, int rpc);
+extern void zrpc_stats_end (struct zrpc_stats_call *call, int error);
+extern void zrpc_stats_qzc_begin (void);
+extern void zrpc_stats_qzc_end (void);
+extern const char *zrpc_stats_name (int rpc);
+extern void zrpc_stats_get (int rpc, struct zrpc_stats_counters *counters);
+extern void zrpc_stats_clear (void);
+extern void zrpc_stats_qzc_request (int type, int elem, uint64_t sent, uint64_t received,
+                                    uint64_t usecs, int error);
+extern const char *zrpc_stats_qzc_type_name (int type);
+extern void zrpc_stats_qzc_snapshot (struct zrpc_stats_qzc_snapshot *snapshot);
+extern void zrpc_stats_qzc_clear (void);
+
+#endif /* _ZRPC_STATS_H */
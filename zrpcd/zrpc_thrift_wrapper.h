@@ -15,7 +15,11 @@
 #include <thrift/c_glib/transport/thrift_buffered_transport.h>
 #include <thrift/c_glib/transport/thrift_buffered_transport_factory.h>
 #include <thrift/c_glib/transport/thrift_framed_transport.h>
+#include <thrift/c_glib/transport/thrift_memory_buffer.h>
 #include <thrift/c_glib/protocol/thrift_binary_protocol.h>
+#ifdef HAVE_THRIFT_COMPACT_PROTOCOL
+#include <thrift/c_glib/protocol/thrift_compact_protocol.h>
+#endif
 #include <thrift/c_glib/transport/thrift_server_socket.h>
 #include <thrift/c_glib/transport/thrift_socket.h>
 
@@ -16,6 +16,8 @@
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <errno.h>
+#include <signal.h>
+#include <pthread.h>
 
 struct zrpc_rdrt *zrpc_util_append_rdrt_to_list (u_char *incoming_rdrt, struct zrpc_rdrt *rdrt)
 {
@@ -256,6 +258,140 @@ int zrpc_util_rd_prefix_cmp (struct zrpc_rd_prefix *rd_p_1,
   return 0;
 }
 
+/* signals are handled by main thread: block them in calling thread */
+void zrpc_util_block_signals (void)
+{
+  sigset_t sigs;
+
+  sigemptyset (&sigs);
+  sigaddset (&sigs, SIGINT);
+  sigaddset (&sigs, SIGHUP);
+  pthread_sigmask (SIG_BLOCK, &sigs, NULL);
+}
+
+/* 64 bit mix function (murmur3 finalizer) */
+uint32_t zrpc_util_hash64 (uint64_t key)
+{
+  key ^= key >> 33;
+  key *= 0xff51afd7ed558ccdULL;
+  key ^= key >> 33;
+  key *= 0xc4ceb9fe1a85ec53ULL;
+  key ^= key >> 33;
+  return (uint32_t)key;
+}
+
+/* return slot indexing the entry with key, or empty slot where such
+ * entry should be indexed. hash is the hash of key */
+uint32_t zrpc_util_index_slot (const struct zrpc_util_index *index,
+                               const struct zrpc_util_index_ops *ops,
+                               const void *entries, uint32_t hash, const void *key)
+{
+  uint32_t mask = index->nb_slots - 1;
+  uint32_t i = hash & mask;
+
+  while (index->slots[i] && !ops->match (entries, index->slots[i] - 1, key))
+    i = (i + 1) & mask;
+  return i;
+}
+
+/* return slot indexing entry at offset, or empty slot if not indexed */
+uint32_t zrpc_util_index_entry_slot (const struct zrpc_util_index *index,
+                                     const struct zrpc_util_index_ops *ops,
+                                     const void *entries, uint32_t offset)
+{
+  uint32_t mask = index->nb_slots - 1;
+  uint32_t i = ops->hash (entries, offset) & mask;
+
+  while (index->slots[i] && index->slots[i] != offset + 1)
+    i = (i + 1) & mask;
+  return i;
+}
+
+/* allocate nb_slots slots, and index entries 0 to count - 1 */
+void zrpc_util_index_resize (struct zrpc_util_index *index,
+                             const struct zrpc_util_index_ops *ops,
+                             const void *entries, uint32_t count, uint32_t nb_slots)
+{
+  uint32_t i;
+
+  if (index->slots)
+    ZRPC_FREE (index->slots);
+  index->slots = ZRPC_CALLOC (nb_slots * sizeof (uint32_t));
+  index->nb_slots = nb_slots;
+  for (i = 0; i < count; i++)
+    index->slots[zrpc_util_index_entry_slot (index, ops, entries, i)] = i + 1;
+}
+
+/* make room for one more entry, after count dense entries. return
+ * entries, reallocated to nb_slots / 2 entries when index grows */
+void *zrpc_util_index_grow (struct zrpc_util_index *index,
+                            const struct zrpc_util_index_ops *ops,
+                            void *entries, size_t entry_size,
+                            uint32_t count, uint32_t min_slots)
+{
+  uint32_t nb_slots;
+
+  if ((count + 1) * 2 <= index->nb_slots)
+    return entries;
+  nb_slots = index->nb_slots ? index->nb_slots * 2 : min_slots;
+  entries = ZRPC_REALLOC (entries, (nb_slots / 2) * entry_size);
+  zrpc_util_index_resize (index, ops, entries, count, nb_slots);
+  return entries;
+}
+
+/* empty slot. following slots of the probe sequence are shifted back,
+ * so that no tombstone is needed */
+void zrpc_util_index_del (struct zrpc_util_index *index,
+                          const struct zrpc_util_index_ops *ops,
+                          const void *entries, uint32_t slot)
+{
+  uint32_t mask = index->nb_slots - 1;
+  uint32_t i = slot, j, k;
+
+  index->slots[i] = 0;
+  for (j = (i + 1) & mask; index->slots[j]; j = (j + 1) & mask)
+    {
+      k = ops->hash (entries, index->slots[j] - 1) & mask;
+      if ((j > i && (k <= i || k > j)) || (j < i && k <= i && k > j))
+        {
+          index->slots[i] = index->slots[j];
+          index->slots[j] = 0;
+          i = j;
+        }
+    }
+}
+
+/* remove entry indexed at slot from count dense entries: last entry is
+ * moved into the hole */
+void zrpc_util_index_remove (struct zrpc_util_index *index,
+                             const struct zrpc_util_index_ops *ops,
+                             void *entries, size_t entry_size,
+                             uint32_t count, uint32_t slot)
+{
+  uint32_t offset = index->slots[slot] - 1, last = count - 1;
+
+  zrpc_util_index_del (index, ops, entries, slot);
+  if (offset == last)
+    return;
+  memcpy ((char *)entries + offset * entry_size,
+          (char *)entries + last * entry_size, entry_size);
+  index->slots[zrpc_util_index_entry_slot (index, ops, entries, last)] = offset + 1;
+}
+
+void zrpc_util_index_clear (struct zrpc_util_index *index)
+{
+  if (index->slots)
+    memset (index->slots, 0, index->nb_slots * sizeof (uint32_t));
+}
+
+void zrpc_util_index_free (struct zrpc_util_index *index)
+{
+  if (index->slots)
+    ZRPC_FREE (index->slots);
+  index->slots = NULL;
+  index->nb_slots = 0;
+}
+
 #if 0
 /*
  * retrieve installation path where daemon
@@ -10,6 +10,7 @@
 
 #include <arpa/inet.h>
 #include <stdint.h>
+#include <stddef.h>
 
 #ifdef __GNUC__
 #  ifdef __LP64__               /* is m64, 8 byte align */
@@ -87,6 +88,50 @@ extern int zrpc_util_rd_prefix_cmp (struct zrpc_rd_prefix *rd_p_1,
                                         struct zrpc_rd_prefix *rd_p_2);
 struct zrpc_rdrt *zrpc_util_rdrt_import (u_char *vals, int listsize);
 
+/*
+ * open addressing hash index (linear probing) over an array of entries
+ * owned by caller. a slot holds entry offset + 1, 0 meaning empty.
+ * nb_slots is a power of 2, and load factor is kept under 1/2.
+ */
+struct zrpc_util_index
+{
+  uint32_t *slots;
+  uint32_t nb_slots;
+};
+
+struct zrpc_util_index_ops
+{
+  /* hash of entry at offset */
+  uint32_t (*hash) (const void *entries, uint32_t offset);
+  /* return 1 if entry at offset has key */
+  int (*match) (const void *entries, uint32_t offset, const void *key);
+};
+
+extern void zrpc_util_block_signals (void);
+extern uint32_t zrpc_util_hash64 (uint64_t key);
+extern uint32_t zrpc_util_index_slot (const struct zrpc_util_index *index,
+                                      const struct zrpc_util_index_ops *ops,
+                                      const void *entries, uint32_t hash, const void *key);
+extern uint32_t zrpc_util_index_entry_slot (const struct zrpc_util_index *index,
+                                            const struct zrpc_util_index_ops *ops,
+                                            const void *entries, uint32_t offset);
+extern void zrpc_util_index_resize (struct zrpc_util_index *index,
+                                    const struct zrpc_util_index_ops *ops,
+                                    const void *entries, uint32_t count, uint32_t nb_slots);
+extern void *zrpc_util_index_grow (struct zrpc_util_index *index,
+                                   const struct zrpc_util_index_ops *ops,
+                                   void *entries, size_t entry_size,
+                                   uint32_t count, uint32_t min_slots);
+extern void zrpc_util_index_del (struct zrpc_util_index *index,
+                                 const struct zrpc_util_index_ops *ops,
+                                 const void *entries, uint32_t slot);
+extern void zrpc_util_index_remove (struct zrpc_util_index *index,
+                                    const struct zrpc_util_index_ops *ops,
+                                    void *entries, size_t entry_size,
+                                    uint32_t count, uint32_t slot);
+extern void zrpc_util_index_clear (struct zrpc_util_index *index);
+extern void zrpc_util_index_free (struct zrpc_util_index *index);
+
 #if 0
 extern int zrpc_cmd_get_path_prefix_dir(char *path, unsigned int size);
 #endif
@@ -0,0 +1,187 @@
+/* zrpc open addressing index test
+ * Copyright (c) 2016 6WIND,
+ *
+ * This file is part of ZRPC daemon.
+ *
+ * See the LICENSE file.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include "zrpcd/zrpc_util.h"
+
+struct zrpc_util_test_entry
+{
+  uint64_t key;
+  uint32_t value;
+};
+
+#define ZRPC_UTIL_TEST_KEYS 64
+
+/* few hash values, so that probe sequences are long, and wrap around
+ * the end of the slots */
+static uint32_t zrpc_util_test_hash_mask = 0x7;
+static uint32_t zrpc_util_test_hash_base;
+
+static uint32_t
+zrpc_util_test_key_hash (uint64_t key)
+{
+  return zrpc_util_test_hash_base + (zrpc_util_hash64 (key) & zrpc_util_test_hash_mask);
+}
+
+static uint32_t
+zrpc_util_test_hash (const void *entries, uint32_t offset)
+{
+  return zrpc_util_test_key_hash (((const struct zrpc_util_test_entry *)entries)[offset].key);
+}
+
+static int
+zrpc_util_test_match (const void *entries, uint32_t offset, const void *key)
+{
+  return ((const struct zrpc_util_test_entry *)entries)[offset].key == *(const uint64_t *)key;
+}
+
+static const struct zrpc_util_index_ops zrpc_util_test_ops =
+{
+  zrpc_util_test_hash,
+  zrpc_util_test_match,
+};
+
+static uint32_t
+zrpc_util_test_slot (struct zrpc_util_index *index,
+                     struct zrpc_util_test_entry *entries, uint64_t key)
+{
+  return zrpc_util_index_slot (index, &zrpc_util_test_ops, entries,
+                               zrpc_util_test_key_hash (key), &key);
+}
+
+/* every entry is found from its key, at the slot indexing it */
+static void
+zrpc_util_test_check (struct zrpc_util_index *index,
+                      struct zrpc_util_test_entry *entries, uint32_t count,
+                      const int *present)
+{
+  uint32_t i, slot, nb_used = 0;
+  uint64_t key;
+
+  for (i = 0; i < count; i++)
+    {
+      slot = zrpc_util_index_entry_slot (index, &zrpc_util_test_ops, entries, i);
+      assert (index->slots[slot] == i + 1);
+      assert (zrpc_util_test_slot (index, entries, entries[i].key) == slot);
+      assert (entries[i].value == entries[i].key * 3);
+    }
+  for (i = 0; i < index->nb_slots; i++)
+    if (index->slots[i])
+      nb_used++;
+  assert (nb_used == count);
+  for (key = 1; key <= ZRPC_UTIL_TEST_KEYS; key++)
+    if (!present[key - 1] && index->nb_slots)
+      assert (index->slots[zrpc_util_test_slot (index, entries, key)] == 0);
+}
+
+/* dense table: removal moves last entry into the hole */
+static void
+zrpc_util_test_remove (void)
+{
+  struct zrpc_util_index index = { NULL, 0 };
+  struct zrpc_util_test_entry *entries = NULL;
+  int present[ZRPC_UTIL_TEST_KEYS];
+  uint32_t count = 0, slot;
+  uint64_t key;
+  int n;
+
+  memset (present, 0, sizeof (present));
+  for (n = 0; n < 100000; n++)
+    {
+      key = 1 + rand () % ZRPC_UTIL_TEST_KEYS;
+      if (rand () % 2)
+        {
+          if (present[key - 1])
+            continue;
+          entries = zrpc_util_index_grow (&index, &zrpc_util_test_ops, entries,
+                                          sizeof (struct zrpc_util_test_entry), count, 4);
+          slot = zrpc_util_test_slot (&index, entries, key);
+          assert (index.slots[slot] == 0);
+          entries[count].key = key;
+          entries[count].value = key * 3;
+          index.slots[slot] = ++count;
+          present[key - 1] = 1;
+        }
+      else if (count)
+        {
+          slot = zrpc_util_test_slot (&index, entries, key);
+          assert (!index.slots[slot] == !present[key - 1]);
+          if (!present[key - 1])
+            continue;
+          zrpc_util_index_remove (&index, &zrpc_util_test_ops, entries,
+                                  sizeof (struct zrpc_util_test_entry), count, slot);
+          count--;
+          present[key - 1] = 0;
+        }
+      zrpc_util_test_check (&index, entries, count, present);
+    }
+  zrpc_util_index_free (&index);
+  free (entries);
+}
+
+/* entries stay in place, only their slots are deleted */
+static void
+zrpc_util_test_del (void)
+{
+  struct zrpc_util_index index = { NULL, 0 };
+  struct zrpc_util_test_entry entries[ZRPC_UTIL_TEST_KEYS];
+  int present[ZRPC_UTIL_TEST_KEYS];
+  uint32_t i, slot;
+  uint64_t key;
+  int n;
+
+  for (i = 0; i < ZRPC_UTIL_TEST_KEYS; i++)
+    {
+      entries[i].key = i + 1;
+      entries[i].value = (i + 1) * 3;
+    }
+  memset (present, 0, sizeof (present));
+  zrpc_util_index_resize (&index, &zrpc_util_test_ops, entries, 0, 2 * ZRPC_UTIL_TEST_KEYS);
+  for (n = 0; n < 100000; n++)
+    {
+      key = 1 + rand () % ZRPC_UTIL_TEST_KEYS;
+      slot = zrpc_util_test_slot (&index, entries, key);
+      assert (!index.slots[slot] == !present[key - 1]);
+      if (present[key - 1])
+        {
+          zrpc_util_index_del (&index, &zrpc_util_test_ops, entries, slot);
+          present[key - 1] = 0;
+        }
+      else
+        {
+          index.slots[slot] = key;
+          present[key - 1] = 1;
+        }
+      for (i = 0; i < ZRPC_UTIL_TEST_KEYS; i++)
+        if (present[i])
+          assert (index.slots[zrpc_util_test_slot (&index, entries, i + 1)] == i + 1);
+        else
+          assert (index.slots[zrpc_util_test_slot (&index, entries, i + 1)] == 0);
+    }
+  zrpc_util_index_clear (&index);
+  for (i = 0; i < index.nb_slots; i++)
+    assert (index.slots[i] == 0);
+  zrpc_util_index_free (&index);
+}
+
+int
+main (int argc, char **argv)
+{
+  srand (argc > 1 ? atoi (argv[1]) : 1);
+  zrpc_util_test_remove ();
+  zrpc_util_test_del ();
+  /* probe sequences starting near the last slots */
+  zrpc_util_test_hash_base = 0xfffffffc;
+  zrpc_util_test_remove ();
+  zrpc_util_test_del ();
+  printf ("zrpc_util_test: ok\n");
+  return 0;
+}
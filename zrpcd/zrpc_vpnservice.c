@@ -5,6 +5,15 @@
  *
  * See the LICENSE file.
  */
+/* struct ucred, for unix socket peers */
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+#include <poll.h>
+#include <pthread.h>
+#include <netdb.h>
+#include <netinet/tcp.h>
+#include <sys/un.h>
 #include "thread.h"
 
 #include "zrpcd/zrpc_memory.h"
@@ -14,6 +23,7 @@
 #include "zrpcd/zrpc_bgp_configurator.h"
 #include "zrpcd/zrpc_bgp_updater.h"
 #include "zrpcd/zrpc_vpnservice.h"
+#include "zrpcd/zrpc_request.h"
 #include "zrpcd/zrpc_bgp_configurator.h"
 #include "zrpcd/zrpcd.h"
 #include "zrpcd/zrpc_debug.h"
@@ -26,354 +36,2354 @@
 
 static void zrpc_vpnservice_callback (void *arg, void *zmqsock, struct zmq_msg_t *msg);
 
-static void zrpc_transport_check_response(struct zrpc_vpnservice *setup, gboolean response);
+static void zrpc_transport_check_response(struct zrpc_vpnservice_updater *updater, gboolean response);
 static int zrpc_vpnservice_setup_bgp_updater_client_retry (struct thread *thread);
-static int zrpc_vpnservice_setup_bgp_updater_client_monitor (struct thread *thread);
-int zrpc_monitor_retry_job_in_progress;
-static gboolean zrpc_transport_current_status = FALSE;
+static int zrpc_vpnservice_bgp_updater_read (struct thread *thread);
+static int zrpc_vpnservice_bgp_updater_fd (struct zrpc_vpnservice_updater *updater);
+static void zrpc_vpnservice_updater_schedule (struct zrpc_vpnservice_updater *updater);
+static void zrpc_vpnservice_updater_start (struct zrpc_vpnservice *setup);
+static void zrpc_vpnservice_setup_locks (struct zrpc_vpnservice *setup);
+static void zrpc_vpnservice_terminate_locks (struct zrpc_vpnservice *setup);
 
-static void zrpc_transport_check_response(struct zrpc_vpnservice *setup, gboolean response)
+static void zrpc_transport_check_response(struct zrpc_vpnservice_updater *updater, gboolean response)
 {
-  if(zrpc_monitor_retry_job_in_progress)
+  unsigned int delay;
+
+  if(updater->job_in_progress)
     return;
-  if (zrpc_transport_current_status != response)
+  if (updater->status != response)
     {
       if (IS_ZRPC_DEBUG_NOTIFICATION)
         zrpc_log ("bgpUpdater check connection with %s:%u %s",
-                  tm->zrpc_notification_address,
-                  setup->zrpc_notification_port,
+                  updater->address,
+                  updater->setup->zrpc_notification_port,
                   response == TRUE?"OK":"NOK");
     }
-  zrpc_transport_current_status = response;
+  updater->status = response;
   if(response == FALSE)
     {
-      setup->bgp_update_retries++;
-      setup->bgp_updater_client_thread = NULL;
-      THREAD_TIMER_MSEC_ON(tm->global, setup->bgp_updater_client_thread, \
-                           zrpc_vpnservice_setup_bgp_updater_client_retry, \
-                           setup, 1000);
+      updater->retries++;
+      /* exponential backoff, with jitter so that several zrpcd
+       * do not hammer a controller coming back at the same time */
+      if (updater->backoff == 0)
+        updater->backoff = ZRPC_UPDATER_BACKOFF_MIN;
+      delay = updater->backoff / 2 +
+        random () % (updater->backoff / 2 + 1);
+      updater->backoff *= 2;
+      if (updater->backoff > ZRPC_UPDATER_BACKOFF_MAX)
+        updater->backoff = ZRPC_UPDATER_BACKOFF_MAX;
+      THREAD_OFF (updater->read_thread);
+      updater->client_thread = NULL;
+      THREAD_TIMER_MSEC_ON(updater->setup->notif_master, updater->client_thread, \
+                           zrpc_vpnservice_setup_bgp_updater_client_retry, \
+                           updater, delay);
+    }
+  else
+    {
+      updater->backoff = 0;
+      updater->monitor++;
+      /* hangup of controller is seen as soon as it happens */
+      THREAD_READ_ON(updater->setup->notif_master, updater->read_thread,\
+                     zrpc_vpnservice_bgp_updater_read,\
+                     updater, zrpc_vpnservice_bgp_updater_fd (updater));
+    }
+  updater->job_in_progress = 1;
+  /* connection is up: flush notifications queued meanwhile */
+  if (response == TRUE)
+    zrpc_vpnservice_updater_schedule (updater);
+}
+
+static int zrpc_vpnservice_bgp_updater_fd (struct zrpc_vpnservice_updater *updater)
+{
+  ThriftTransport *transport = NULL;
+
+  if (updater->transport)
+    transport = updater->transport->transport;
+  if (transport == NULL || THRIFT_SOCKET (transport)->sd < 0)
+    return 0;
+  return THRIFT_SOCKET (transport)->sd;
+}
+
+/* detect a dead controller even if nothing is sent, and bound the
+ * time sent data may stay unacknowledged */
+static void zrpc_vpnservice_bgp_updater_keepalive (int fd)
+{
+  int val = 1;
+
+  if (tm->notif_keepalive == 0)
+    return;
+  if (setsockopt (fd, SOL_SOCKET, SO_KEEPALIVE, &val, sizeof (val)) < 0)
+    return;
+#ifdef TCP_KEEPIDLE
+  val = tm->notif_keepalive;
+  setsockopt (fd, IPPROTO_TCP, TCP_KEEPIDLE, &val, sizeof (val));
+  val = tm->notif_keepalive / ZRPC_UPDATER_KEEPALIVE_PROBES;
+  if (val == 0)
+    val = 1;
+  setsockopt (fd, IPPROTO_TCP, TCP_KEEPINTVL, &val, sizeof (val));
+  val = ZRPC_UPDATER_KEEPALIVE_PROBES;
+  setsockopt (fd, IPPROTO_TCP, TCP_KEEPCNT, &val, sizeof (val));
+#endif
+#ifdef TCP_USER_TIMEOUT
+  val = tm->notif_keepalive * 1000;
+  setsockopt (fd, IPPROTO_TCP, TCP_USER_TIMEOUT, &val, sizeof (val));
+#endif
+}
+
+/* end of connection attempt. socket is given to thrift on success */
+static void zrpc_vpnservice_bgp_updater_connected (struct zrpc_vpnservice_updater *updater,
+                                                   gboolean response)
+{
+  int fd = updater->connect_fd;
+  struct timeval tv;
+  int flags;
+
+  THREAD_OFF (updater->connect_thread);
+  THREAD_TIMER_OFF (updater->client_thread);
+  updater->connect_fd = -1;
+  if (response == TRUE)
+    {
+      /* thrift socket expects blocking writes. a slow controller
+       * must not block notification thread for long: a send timing
+       * out fails the write, and the connection is reset with the
+       * message still queued. thrift retries short writes */
+      flags = fcntl (fd, F_GETFL, 0);
+      fcntl (fd, F_SETFL, flags & ~O_NONBLOCK);
+      tv.tv_sec = ZRPC_UPDATER_SEND_TIMEOUT / 1000;
+      tv.tv_usec = (ZRPC_UPDATER_SEND_TIMEOUT % 1000) * 1000;
+      setsockopt (fd, SOL_SOCKET, SO_SNDTIMEO, &tv, sizeof (tv));
+      if (!ZRPC_ADDRESS_IS_PATH (updater->address))
+        zrpc_vpnservice_bgp_updater_keepalive (fd);
+      THRIFT_SOCKET (updater->transport->transport)->sd = fd;
+    }
+  else if (fd >= 0)
+    close (fd);
+  updater->job_in_progress = 0;
+  zrpc_transport_check_response(updater, response);
+}
+
+/* pending connect completed, or failed */
+static int zrpc_vpnservice_bgp_updater_connect_done (struct thread *thread)
+{
+  struct zrpc_vpnservice_updater *updater;
+  int err = 0;
+  socklen_t len = sizeof (err);
+
+  updater = THREAD_ARG (thread);
+  updater->connect_thread = NULL;
+  if (getsockopt (THREAD_FD (thread), SOL_SOCKET, SO_ERROR, &err, &len) < 0)
+    err = errno;
+  if (err && IS_ZRPC_DEBUG_NOTIFICATION)
+    zrpc_log ("bgpUpdater connect to %s:%u failed (%s)",
+              updater->address, updater->setup->zrpc_notification_port,
+              strerror (err));
+  zrpc_vpnservice_bgp_updater_connected (updater, err == 0 ? TRUE : FALSE);
+  return 0;
+}
+
+static int zrpc_vpnservice_bgp_updater_connect_timeout (struct thread *thread)
+{
+  struct zrpc_vpnservice_updater *updater;
+
+  updater = THREAD_ARG (thread);
+  updater->client_thread = NULL;
+  if (IS_ZRPC_DEBUG_NOTIFICATION)
+    zrpc_log ("bgpUpdater connect to %s:%u timed out",
+              updater->address, updater->setup->zrpc_notification_port);
+  zrpc_vpnservice_bgp_updater_connected (updater, FALSE);
+  return 0;
+}
+
+/* resolve address of BgpUpdater target, on main thread, as name
+ * resolution may block. returns -1 on failure */
+static int zrpc_vpnservice_bgp_updater_resolve (struct zrpc_vpnservice_updater *updater)
+{
+  struct addrinfo hints, *res = NULL;
+  struct sockaddr_un *sun;
+  char port[8];
+
+  memset (&updater->addr, 0, sizeof (updater->addr));
+  updater->addrlen = 0;
+  if (ZRPC_ADDRESS_IS_PATH (updater->address))
+    {
+      sun = (struct sockaddr_un *)&updater->addr;
+      if (strlen (updater->address) >= sizeof (sun->sun_path))
+        return -1;
+      sun->sun_family = AF_UNIX;
+      strcpy (sun->sun_path, updater->address);
+      updater->addrlen = sizeof (*sun);
+      return 0;
+    }
+  memset (&hints, 0, sizeof (hints));
+  hints.ai_family = AF_UNSPEC;
+  hints.ai_socktype = SOCK_STREAM;
+  snprintf (port, sizeof (port), "%u", updater->setup->zrpc_notification_port);
+  if (getaddrinfo (updater->address, port, &hints, &res) != 0 || res == NULL)
+    return -1;
+  memcpy (&updater->addr, res->ai_addr, res->ai_addrlen);
+  updater->addrlen = res->ai_addrlen;
+  freeaddrinfo (res);
+  return 0;
+}
+
+/* (re)connect thrift transport without blocking the event loop.
+ * outcome is given to zrpc_transport_check_response */
+static void zrpc_vpnservice_bgp_updater_connect (struct zrpc_vpnservice_updater *updater)
+{
+  GError *error = NULL;
+  int fd;
+
+  THREAD_OFF (updater->write_thread);
+  THREAD_TIMER_OFF (updater->batch_timer);
+  THREAD_TIMER_OFF (updater->client_thread);
+  THREAD_OFF (updater->connect_thread);
+  THREAD_OFF (updater->read_thread);
+  if (updater->connect_fd >= 0)
+    close (updater->connect_fd);
+  updater->connect_fd = -1;
+  thrift_transport_close (updater->transport->transport, &error);
+  if (error)
+    g_error_free (error);
+  updater->status = FALSE;
+  updater->job_in_progress = 1;
+
+  if (updater->addrlen == 0)
+    {
+      zrpc_vpnservice_bgp_updater_connected (updater, FALSE);
+      return;
+    }
+  fd = socket (updater->addr.ss_family, SOCK_STREAM, 0);
+  if (fd < 0)
+    {
+      zrpc_vpnservice_bgp_updater_connected (updater, FALSE);
+      return;
+    }
+  fcntl (fd, F_SETFL, fcntl (fd, F_GETFL, 0) | O_NONBLOCK);
+  updater->connect_fd = fd;
+  if (connect (fd, (struct sockaddr *)&updater->addr, updater->addrlen) == 0)
+    {
+      zrpc_vpnservice_bgp_updater_connected (updater, TRUE);
+      return;
+    }
+  /* unix socket connects at once, or fails with a full backlog */
+  if (errno != EINPROGRESS)
+    {
+      zrpc_vpnservice_bgp_updater_connected (updater, FALSE);
+      return;
+    }
+  /* wait for connection, but not for ever */
+  THREAD_WRITE_ON (updater->setup->notif_master, updater->connect_thread,
+                   zrpc_vpnservice_bgp_updater_connect_done, updater, fd);
+  THREAD_TIMER_MSEC_ON (updater->setup->notif_master, updater->client_thread,
+                        zrpc_vpnservice_bgp_updater_connect_timeout, updater,
+                        ZRPC_UPDATER_CONNECT_TIMEOUT);
+}
+
+static int zrpc_vpnservice_setup_bgp_updater_client_retry (struct thread *thread)
+{
+  struct zrpc_vpnservice_updater *updater;
+
+  updater = THREAD_ARG (thread);
+  assert (updater);
+  updater->client_thread = NULL;
+  updater->job_in_progress = 0;
+  zrpc_vpnservice_bgp_updater_connect (updater);
+  return 0;
+}
+
+/* updater socket is readable: controller closed connection, or the
+ * connection failed. BgpUpdater messages are oneway, anything else
+ * received is dropped */
+static int zrpc_vpnservice_bgp_updater_read (struct thread *thread)
+{
+  struct zrpc_vpnservice_updater *updater;
+  char buffer[256];
+  ssize_t ret;
+
+  updater = THREAD_ARG (thread);
+  assert (updater);
+  updater->read_thread = NULL;
+  ret = recv (THREAD_FD (thread), buffer, sizeof (buffer), MSG_DONTWAIT);
+  if (ret > 0 ||
+      (ret < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)))
+    {
+      THREAD_READ_ON (updater->setup->notif_master, updater->read_thread,
+                      zrpc_vpnservice_bgp_updater_read, updater, THREAD_FD (thread));
+      return 0;
+    }
+  if (IS_ZRPC_DEBUG_NOTIFICATION)
+    zrpc_log ("bgpUpdater connection with %s:%u lost (%s)", updater->address,
+              updater->setup->zrpc_notification_port,
+              ret == 0 ? "closed by peer" : strerror (errno));
+  updater->job_in_progress = 0;
+  zrpc_vpnservice_bgp_updater_connect (updater);
+  return 0;
+}
+
+/* apply vrf route notification to the mirror RIB of the vrf */
+static void zrpc_vpnservice_rib_update (struct zrpc_vpnservice *setup, struct bgp_event_vrf *s)
+{
+  struct zrpc_vpnservice_cache_bgpvrf *entry;
+  uint64_t mask;
+
+  /* VRF table only changes while main thread is parked */
+  entry = zrpc_vpnservice_vrf_lookup (setup, &s->outbound_rd);
+  if (entry == NULL || entry->rib == NULL)
+    return;
+  mask = zrpc_vpnservice_vrf_lock_mask (&s->outbound_rd);
+  zrpc_vpnservice_lock_vrfs (setup, mask);
+  if (s->announce & BGP_EVENT_MASK_ANNOUNCE)
+    zrpc_rib_add (entry->rib, &s->prefix, s->nexthop, s->label, 0);
+  else
+    zrpc_rib_del (entry->rib, &s->prefix, s->nexthop, 0);
+  zrpc_vpnservice_unlock_vrfs (setup, mask);
+}
+
+static uint64_t zrpc_vpnservice_msec (void)
+{
+  struct timespec ts;
+
+  clock_gettime (CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+/* time in ms notification has still to be held in the coalescing window */
+static uint64_t zrpc_vpnservice_notif_hold_time (struct zrpc_vpnservice_notif *notif,
+                                                 uint64_t now)
+{
+  uint64_t end;
+
+  if (tm->notif_coalesce_window == 0 || notif->type == ZRPC_NOTIF_SEND_EVENT)
+    return 0;
+  end = notif->stamp + tm->notif_coalesce_window;
+  return end > now ? end - now : 0;
+}
+
+static uint32_t zrpc_vpnservice_notif_hash (struct zrpc_vpnservice_notif *notif)
+{
+  uint64_t key = zrpc_vpnservice_rd_key (&notif->rd);
+
+  key ^= ((uint64_t)ntohl (notif->prefix.s_addr) << 8) | notif->prefixlen;
+  return zrpc_util_hash64 (key);
+}
+
+static int zrpc_vpnservice_notif_same_key (struct zrpc_vpnservice_notif *notif1,
+                                           struct zrpc_vpnservice_notif *notif2)
+{
+  return notif1->prefixlen == notif2->prefixlen &&
+    notif1->prefix.s_addr == notif2->prefix.s_addr &&
+    zrpc_vpnservice_rd_key (&notif1->rd) == zrpc_vpnservice_rd_key (&notif2->rd);
+}
+
+static uint32_t zrpc_vpnservice_notif_entry_hash (const void *entries, uint32_t offset)
+{
+  return zrpc_vpnservice_notif_hash ((struct zrpc_vpnservice_notif *)entries + offset);
+}
+
+static int zrpc_vpnservice_notif_entry_match (const void *entries, uint32_t offset,
+                                              const void *key)
+{
+  return zrpc_vpnservice_notif_same_key ((struct zrpc_vpnservice_notif *)entries + offset,
+                                         (struct zrpc_vpnservice_notif *)key);
+}
+
+static const struct zrpc_util_index_ops zrpc_vpnservice_notif_index_ops =
+{
+  zrpc_vpnservice_notif_entry_hash,
+  zrpc_vpnservice_notif_entry_match,
+};
+
+/* return coalescing slot indexing a queued route notification with same
+ * key as notif, or empty slot where notif should be indexed */
+static uint32_t zrpc_vpnservice_notif_slot (struct zrpc_vpnservice_notif_queue *queue,
+                                            struct zrpc_vpnservice_notif *notif)
+{
+  return zrpc_util_index_slot (&queue->index, &zrpc_vpnservice_notif_index_ops,
+                               queue->ring, zrpc_vpnservice_notif_hash (notif), notif);
+}
+
+/* notification at ring offset is being sent: remove it from index */
+static void zrpc_vpnservice_notif_unindex (struct zrpc_vpnservice_notif_queue *queue,
+                                           uint32_t offset)
+{
+  uint32_t i;
+
+  if (queue->ring[offset].type == ZRPC_NOTIF_SEND_EVENT)
+    return;
+  /* a later notification with another nexthop may own the slot */
+  i = zrpc_util_index_entry_slot (&queue->index, &zrpc_vpnservice_notif_index_ops,
+                                  queue->ring, offset);
+  if (queue->index.slots[i])
+    zrpc_util_index_del (&queue->index, &zrpc_vpnservice_notif_index_ops, queue->ring, i);
+}
+
+/* write encoded message to target */
+static gboolean zrpc_vpnservice_updater_write (struct zrpc_vpnservice_updater *updater,
+                                               GByteArray *data)
+{
+  ThriftTransport *transport = THRIFT_TRANSPORT (updater->transport);
+  GError *error = NULL;
+
+  if (thrift_transport_write (transport, data->data, data->len, &error) &&
+      thrift_transport_flush (transport, &error))
+    return TRUE;
+  if (error)
+    g_error_free (error);
+  return FALSE;
+}
+
+/* return message already encoded for notifications id to id + count - 1,
+ * first one having sequence number seq. NULL if not in cache */
+static struct zrpc_vpnservice_frame *
+zrpc_vpnservice_frame_lookup (struct zrpc_vpnservice *setup, uint64_t id,
+                              uint32_t count, uint64_t seq)
+{
+  struct zrpc_vpnservice_frame *frame;
+
+  if (id == 0 || setup->bgp_updater_frames == NULL)
+    return NULL;
+  frame = &setup->bgp_updater_frames[id & (ZRPC_NOTIF_FRAME_CACHE_SIZE - 1)];
+  if (frame->id != id || frame->count != count || frame->seq != seq)
+    return NULL;
+  return frame;
+}
+
+/* send message just encoded in memory buffer to target. unless id is 0,
+ * message is kept in cache for other targets */
+static gboolean zrpc_vpnservice_frame_send (struct zrpc_vpnservice_updater *updater,
+                                            gboolean encoded, uint64_t id,
+                                            uint32_t count, uint64_t seq)
+{
+  struct zrpc_vpnservice *setup = updater->setup;
+  GByteArray *data = setup->bgp_updater_buffer->buf;
+  struct zrpc_vpnservice_frame *frame;
+  gboolean response = FALSE;
+
+  if (encoded == TRUE)
+    {
+      response = zrpc_vpnservice_updater_write (updater, data);
+      if (id && setup->bgp_updater_frames)
+        {
+          frame = &setup->bgp_updater_frames[id & (ZRPC_NOTIF_FRAME_CACHE_SIZE - 1)];
+          frame->id = id;
+          frame->count = count;
+          frame->seq = seq;
+          g_byte_array_set_size (frame->data, 0);
+          g_byte_array_append (frame->data, data->data, data->len);
+        }
+    }
+  g_byte_array_set_size (data, 0);
+  return response;
+}
+
+/* send one queued notification to the BgpUpdater client */
+static gboolean zrpc_vpnservice_notif_send (struct zrpc_vpnservice_updater *updater,
+                                            struct zrpc_vpnservice_notif *notif)
+{
+  char vrf_rd_str[ZRPC_UTIL_RDRT_LEN], pfx_str[ZRPC_UTIL_IPV6_LEN_MAX], nh_str[ZRPC_UTIL_IPV6_LEN_MAX];
+  BgpUpdaterIf *client = updater->setup->bgp_updater_client;
+  struct zrpc_vpnservice_frame *frame;
+  gboolean encoded;
+
+  frame = zrpc_vpnservice_frame_lookup (updater->setup, notif->id, 1, 0);
+  if (frame)
+    {
+      updater->frames_shared++;
+      return zrpc_vpnservice_updater_write (updater, frame->data);
+    }
+  inet_ntop (AF_INET, &notif->nexthop, nh_str, ZRPC_UTIL_IPV6_LEN_MAX);
+  if (notif->type == ZRPC_NOTIF_SEND_EVENT)
+    encoded = zrpc_bgp_updater_on_notification_send_event(client, nh_str, notif->err_code,
+                                                          notif->err_subcode);
+  else
+    {
+      zrpc_util_rd_prefix2str(&notif->rd, vrf_rd_str, sizeof(vrf_rd_str));
+      inet_ntop (AF_INET, &notif->prefix, pfx_str, ZRPC_UTIL_IPV6_LEN_MAX);
+      if (notif->type == ZRPC_NOTIF_PUSH_ROUTE)
+        encoded = zrpc_bgp_updater_on_update_push_route(client, vrf_rd_str, pfx_str,
+                                                        (const gint32)notif->prefixlen,
+                                                        nh_str, notif->label);
+      else
+        encoded = zrpc_bgp_updater_on_update_withdraw_route(client, vrf_rd_str, pfx_str,
+                                                            (const gint32)notif->prefixlen,
+                                                            nh_str, notif->label);
+    }
+  return zrpc_vpnservice_frame_send (updater, encoded, notif->id, 1, 0);
+}
+
+/* build thrift update for a route notification. seq is set if
+ * retention is enabled */
+static Update *zrpc_vpnservice_notif_update (struct zrpc_vpnservice_notif_queue *queue,
+                                             struct zrpc_vpnservice_notif *notif,
+                                             uint64_t seq)
+{
+  char str[ZRPC_UTIL_RDRT_LEN];
+  Update *upd;
+
+  upd = g_object_new (TYPE_UPDATE, NULL);
+  upd->type = notif->type == ZRPC_NOTIF_PUSH_ROUTE ? BGP_RT_ADD : BGP_RT_DEL;
+  upd->prefixlen = notif->prefixlen;
+  upd->prefix = g_strdup(inet_ntop(AF_INET, &notif->prefix, str, ZRPC_UTIL_RDRT_LEN));
+  upd->nexthop = g_strdup(inet_ntop(AF_INET, &notif->nexthop, str, ZRPC_UTIL_RDRT_LEN));
+  upd->label = notif->label;
+  upd->rd = g_strdup(zrpc_util_rd_prefix2str(&notif->rd, str, ZRPC_UTIL_RDRT_LEN));
+  if (queue->retained)
+    {
+      upd->seq = seq;
+      upd->__isset_seq = TRUE;
+    }
+  return upd;
+}
+
+static uint32_t zrpc_vpnservice_notif_batch_size (void)
+{
+  return tm->notif_batch_size > 1 ? tm->notif_batch_size : 1;
+}
+
+/* send consecutive route notifications from queue head in a single
+ * onUpdateBatch message. returns number of notifications sent,
+ * 0 on failure */
+static uint32_t zrpc_vpnservice_notif_send_batch (struct zrpc_vpnservice_updater *updater,
+                                                  uint64_t now)
+{
+  struct zrpc_vpnservice_notif_queue *queue = &updater->notif_queue;
+  struct zrpc_vpnservice_notif *notif, *first;
+  struct zrpc_vpnservice_frame *frame;
+  GPtrArray *updates;
+  uint32_t index, count = 0;
+  uint64_t id;
+  gboolean response;
+
+  /* batch is shared with other targets only if it is made of
+   * consecutive events, none of them having been merged */
+  first = &queue->ring[queue->head & (queue->size - 1)];
+  id = first->id;
+  for (index = queue->head; index != queue->tail; index++)
+    {
+      notif = &queue->ring[index & (queue->size - 1)];
+      /* events are not part of batches, and keep their order */
+      if (notif->type == ZRPC_NOTIF_SEND_EVENT ||
+          count >= zrpc_vpnservice_notif_batch_size () ||
+          zrpc_vpnservice_notif_hold_time (notif, now))
+        break;
+      if (notif->id != first->id + count)
+        id = 0;
+      count++;
+    }
+  frame = zrpc_vpnservice_frame_lookup (updater->setup, id, count, queue->next_seq);
+  if (frame)
+    {
+      updater->frames_shared++;
+      response = zrpc_vpnservice_updater_write (updater, frame->data);
+      return response == TRUE ? count : 0;
+    }
+  updates = g_ptr_array_new_with_free_func (g_object_unref);
+  for (index = queue->head; index != queue->head + count; index++)
+    g_ptr_array_add (updates, zrpc_vpnservice_notif_update (queue,
+                                                            &queue->ring[index & (queue->size - 1)],
+                                                            queue->next_seq + updates->len));
+  response = zrpc_bgp_updater_on_update_batch (updater->setup->bgp_updater_client, updates);
+  g_ptr_array_unref (updates);
+  response = zrpc_vpnservice_frame_send (updater, response, id, count, queue->next_seq);
+  return response == TRUE ? count : 0;
+}
+
+/* keep sent route notifications for resumeNotifications */
+static void zrpc_vpnservice_notif_retain (struct zrpc_vpnservice_notif_queue *queue,
+                                          uint32_t sent)
+{
+  struct zrpc_vpnservice_notif *notif;
+  uint32_t index;
+
+  if (queue->retained == NULL)
+    return;
+  for (index = queue->head; index != queue->head + sent; index++)
+    {
+      notif = &queue->ring[index & (queue->size - 1)];
+      if (notif->type == ZRPC_NOTIF_SEND_EVENT)
+        continue;
+      queue->retained[queue->next_seq & (queue->retain_size - 1)] = *notif;
+      queue->next_seq++;
+      if (queue->nb_retained < queue->retain_size)
+        queue->nb_retained++;
+    }
+  queue->replay_seq = queue->next_seq;
+}
+
+/* sent notifications at head of queue leave it */
+void zrpc_vpnservice_notif_sent (struct zrpc_vpnservice_notif_queue *queue,
+                                 uint32_t sent)
+{
+  uint32_t index;
+
+  if (queue->index.slots)
+    for (index = queue->head; index != queue->head + sent; index++)
+      zrpc_vpnservice_notif_unindex (queue, index & (queue->size - 1));
+  zrpc_vpnservice_notif_retain (queue, sent);
+  queue->head += sent;
+  queue->sent += sent;
+}
+
+/* send again retained notifications asked by resumeNotifications.
+ * returns 0 on failure */
+static int zrpc_vpnservice_notif_send_replay (struct zrpc_vpnservice_updater *updater)
+{
+  struct zrpc_vpnservice_notif_queue *queue = &updater->notif_queue;
+  GPtrArray *updates;
+  uint64_t seq;
+  gboolean response;
+
+  updates = g_ptr_array_new_with_free_func (g_object_unref);
+  for (seq = queue->replay_seq;
+       seq != queue->next_seq && updates->len < zrpc_vpnservice_notif_batch_size ();
+       seq++)
+    g_ptr_array_add (updates, zrpc_vpnservice_notif_update (queue,
+                                                            &queue->retained[seq & (queue->retain_size - 1)],
+                                                            seq));
+  response = zrpc_bgp_updater_on_update_batch (updater->setup->bgp_updater_client, updates);
+  g_ptr_array_unref (updates);
+  /* replays are specific to a target, they are not cached */
+  if (zrpc_vpnservice_frame_send (updater, response, 0, 0, 0) == FALSE)
+    return 0;
+  queue->replayed += seq - queue->replay_seq;
+  queue->replay_seq = seq;
+  return 1;
+}
+
+/* return 1 if data can be written to fd without blocking */
+static int zrpc_vpnservice_fd_writable (int fd)
+{
+  struct pollfd pfd;
+
+  pfd.fd = fd;
+  pfd.events = POLLOUT;
+  pfd.revents = 0;
+  if (poll (&pfd, 1, 0) <= 0)
+    return 0;
+  return (pfd.revents & POLLOUT) ? 1 : 0;
+}
+
+/* move journaled notifications to queue, as long as there is room */
+static void zrpc_vpnservice_notif_refill (struct zrpc_vpnservice_notif_queue *queue)
+{
+  struct zrpc_vpnservice_notif *notif;
+
+  if (queue->journal == NULL)
+    return;
+  while ((notif = zrpc_journal_head (queue->journal)) != NULL &&
+         zrpc_vpnservice_notif_push (queue, notif))
+    zrpc_journal_pop (queue->journal);
+}
+
+static void zrpc_vpnservice_notif_write_failed (struct zrpc_vpnservice_updater *updater)
+{
+  if (IS_ZRPC_DEBUG_NOTIFICATION)
+    zrpc_log ("bgp->sdnc message to %s failed to be sent", updater->address);
+  /* message stays queued until connection is back. reconnect
+   * after backoff, unless a connection is already pending */
+  if (updater->connect_fd < 0)
+    {
+      THREAD_TIMER_OFF (updater->client_thread);
+      updater->job_in_progress = 0;
+      zrpc_transport_check_response (updater, FALSE);
+    }
+  updater->status = FALSE;
+}
+
+/* writer job: drain the notification queue while socket is writable */
+static int zrpc_vpnservice_notif_write (struct thread *thread)
+{
+  struct zrpc_vpnservice_updater *updater;
+  struct zrpc_vpnservice_notif_queue *queue;
+  struct zrpc_vpnservice_notif *notif;
+  uint32_t sent;
+  uint64_t now;
+  int fd, count = 0;
+  gboolean encoded;
+
+  updater = THREAD_ARG (thread);
+  fd = THREAD_FD (thread);
+  updater->write_thread = NULL;
+  queue = &updater->notif_queue;
+  /* notifications were lost, controller has to resync first */
+  if (queue->resync)
+    {
+      encoded = zrpc_bgp_updater_on_start_config_resync_notification (updater->setup->bgp_updater_client);
+      if (zrpc_vpnservice_frame_send (updater, encoded, 0, 0, 0) == FALSE)
+        {
+          zrpc_vpnservice_notif_write_failed (updater);
+          return 0;
+        }
+      queue->resync = 0;
+      queue->resyncs++;
+    }
+  /* gap asked by controller comes before newer notifications */
+  while (queue->replay_seq != queue->next_seq && count < ZRPC_NOTIF_WRITE_BURST)
+    {
+      if (count && !zrpc_vpnservice_fd_writable (fd))
+        break;
+      if (zrpc_vpnservice_notif_send_replay (updater) == 0)
+        {
+          zrpc_vpnservice_notif_write_failed (updater);
+          return 0;
+        }
+      count++;
+    }
+  now = zrpc_vpnservice_msec ();
+  while (queue->replay_seq == queue->next_seq &&
+         queue->head != queue->tail && count < ZRPC_NOTIF_WRITE_BURST)
+    {
+      /* a slow controller must not block the daemon */
+      if (count && !zrpc_vpnservice_fd_writable (fd))
+        break;
+      notif = &queue->ring[queue->head & (queue->size - 1)];
+      if (zrpc_vpnservice_notif_hold_time (notif, now))
+        break;
+      /* sequence numbers are only carried by onUpdateBatch */
+      if ((tm->notif_batch_size > 1 || queue->retained) &&
+          notif->type != ZRPC_NOTIF_SEND_EVENT)
+        {
+          sent = zrpc_vpnservice_notif_send_batch (updater, now);
+          if (sent)
+            queue->batches++;
+        }
+      else
+        sent = zrpc_vpnservice_notif_send (updater, notif) == TRUE ? 1 : 0;
+      if (sent == 0)
+        {
+          zrpc_vpnservice_notif_write_failed (updater);
+          return 0;
+        }
+      zrpc_vpnservice_notif_sent (queue, sent);
+      count++;
+      zrpc_vpnservice_notif_refill (queue);
+    }
+  zrpc_vpnservice_updater_schedule (updater);
+  return 0;
+}
+
+/* batch delay or coalescing window expired: send what has been
+ * accumulated */
+static int zrpc_vpnservice_notif_batch_expire (struct thread *thread)
+{
+  struct zrpc_vpnservice_updater *updater;
+  int fd;
+
+  updater = THREAD_ARG (thread);
+  updater->batch_timer = NULL;
+  if (updater->status == FALSE)
+    return 0;
+  fd = zrpc_vpnservice_bgp_updater_fd (updater);
+  if (fd <= 0)
+    return 0;
+  THREAD_WRITE_ON (updater->setup->notif_master, updater->write_thread,
+                   zrpc_vpnservice_notif_write, updater, fd);
+  return 0;
+}
+
+/* wake up writer job of target if there is something to send */
+static void zrpc_vpnservice_updater_schedule (struct zrpc_vpnservice_updater *updater)
+{
+  struct zrpc_vpnservice_notif_queue *queue = &updater->notif_queue;
+  uint64_t delay;
+  uint32_t depth;
+  int fd;
+
+  depth = queue->tail - queue->head;
+  if (depth == 0 && !queue->resync && queue->replay_seq == queue->next_seq)
+    return;
+  /* first notification: start connection and its retry mecanism */
+  if (updater->transport == NULL)
+    {
+      zrpc_vpnservice_updater_start (updater->setup);
+      return;
+    }
+  /* writer is woken up again once reconnected */
+  if (updater->status == FALSE)
+    return;
+  /* oldest notification may still be waiting for later updates */
+  delay = 0;
+  if (depth && !queue->resync && queue->replay_seq == queue->next_seq)
+    delay = zrpc_vpnservice_notif_hold_time (&queue->ring[queue->head & (queue->size - 1)],
+                                             zrpc_vpnservice_msec ());
+  /* let a batch fill up, unless it waited long enough */
+  if (delay == 0 && !queue->resync && tm->notif_batch_size > 1 && tm->notif_batch_delay &&
+      depth < tm->notif_batch_size &&
+      updater->write_thread == NULL)
+    delay = (tm->notif_batch_delay + 999) / 1000;
+  if (delay)
+    {
+      THREAD_TIMER_MSEC_ON (updater->setup->notif_master, updater->batch_timer,
+                            zrpc_vpnservice_notif_batch_expire, updater, delay);
+      return;
+    }
+  THREAD_TIMER_OFF (updater->batch_timer);
+  fd = zrpc_vpnservice_bgp_updater_fd (updater);
+  if (fd <= 0)
+    return;
+  THREAD_WRITE_ON (updater->setup->notif_master, updater->write_thread,
+                   zrpc_vpnservice_notif_write, updater, fd);
+}
+
+/* append notification to queue ring. with coalescing, a route
+ * notification replaces the queued one for same rd, prefix and
+ * nexthop. returns 0 if ring is full */
+int zrpc_vpnservice_notif_push (struct zrpc_vpnservice_notif_queue *queue,
+                                struct zrpc_vpnservice_notif *notif)
+{
+  struct zrpc_vpnservice_notif *pending;
+  uint32_t depth, offset, slot = 0;
+
+  if (queue->index.slots && notif->type != ZRPC_NOTIF_SEND_EVENT)
+    {
+      slot = zrpc_vpnservice_notif_slot (queue, notif);
+      if (queue->index.slots[slot])
+        {
+          /* paths with other nexthops are not merged */
+          pending = &queue->ring[queue->index.slots[slot] - 1];
+          if (pending->nexthop.s_addr == notif->nexthop.s_addr)
+            {
+              /* merged notification now has the content of the
+               * newest one */
+              pending->type = notif->type;
+              pending->label = notif->label;
+              pending->id = notif->id;
+              queue->coalesced++;
+              return 1;
+            }
+        }
+    }
+  if (queue->ring == NULL || queue->tail - queue->head == queue->size)
+    return 0;
+  offset = queue->tail & (queue->size - 1);
+  queue->ring[offset] = *notif;
+  if (queue->index.slots && notif->type != ZRPC_NOTIF_SEND_EVENT)
+    queue->index.slots[slot] = offset + 1;
+  queue->tail++;
+  depth = queue->tail - queue->head;
+  if (depth > queue->high_water)
+    queue->high_water = depth;
+  return 1;
+}
+
+/* journal is full, or notification sequence is broken: pending
+ * notifications are useless, as controller has to get all routes
+ * again. resync is requested on next write. dropped is the number of
+ * notifications lost besides queued ones */
+static void zrpc_vpnservice_notif_overflow (struct zrpc_vpnservice_updater *updater,
+                                            uint32_t dropped)
+{
+  struct zrpc_vpnservice_notif_queue *queue = &updater->notif_queue;
+  uint32_t lost;
+
+  lost = queue->tail - queue->head + dropped;
+  if (queue->journal)
+    {
+      lost += zrpc_journal_count (queue->journal);
+      zrpc_journal_reset (queue->journal);
+    }
+  zrpc_log ("notification queue to %s full, %u messages dropped, resync needed",
+            updater->address, lost);
+  queue->drops += lost;
+  updater->lost_msgs += lost;
+  queue->head = queue->tail;
+  zrpc_util_index_clear (&queue->index);
+  /* retained notifications can not be resumed from */
+  queue->nb_retained = 0;
+  queue->replay_seq = queue->next_seq;
+  queue->overflows++;
+  queue->resync = 1;
+}
+
+/* append notification to queue of target, or to journal once queue is
+ * full. without journal, newest notification is dropped if queue is
+ * full. returns 1 if notification is queued */
+static int zrpc_vpnservice_updater_enqueue (struct zrpc_vpnservice_updater *updater,
+                                            struct zrpc_vpnservice_notif *notif)
+{
+  struct zrpc_vpnservice_notif_queue *queue = &updater->notif_queue;
+
+  /* until resync is sent, notifications are useless */
+  if (queue->resync)
+    {
+      queue->drops++;
+      updater->lost_msgs++;
+      return 0;
+    }
+  /* journaled notifications come before this one */
+  if ((queue->journal == NULL || zrpc_journal_count (queue->journal) == 0) &&
+      zrpc_vpnservice_notif_push (queue, notif))
+    {
+      queue->enqueued++;
+      zrpc_vpnservice_updater_schedule (updater);
+      return 1;
+    }
+  if (queue->journal)
+    {
+      if (zrpc_journal_append (queue->journal, notif) == 0)
+        {
+          zrpc_vpnservice_notif_overflow (updater, 1);
+          zrpc_vpnservice_updater_schedule (updater);
+          return 0;
+        }
+      queue->enqueued++;
+      queue->journaled++;
+      if (zrpc_journal_count (queue->journal) > queue->journal_high_water)
+        queue->journal_high_water = zrpc_journal_count (queue->journal);
+      zrpc_vpnservice_updater_schedule (updater);
+      return 1;
+    }
+  /* a hole in sequence numbers would go unnoticed */
+  if (queue->retained)
+    {
+      zrpc_vpnservice_notif_overflow (updater, 1);
+      zrpc_vpnservice_updater_schedule (updater);
+      return 0;
+    }
+  if (IS_ZRPC_DEBUG_NOTIFICATION && queue->drops == 0)
+    zrpc_log ("notification queue to %s full, dropping messages", updater->address);
+  queue->drops++;
+  updater->lost_msgs++;
+  return 0;
+}
+
+/* give notification to every target. each target has its own queue,
+ * so that a slow one does not hold back the others. run by
+ * notification thread */
+static void zrpc_vpnservice_notif_dispatch (struct zrpc_vpnservice *setup,
+                                            struct zrpc_vpnservice_notif *notif)
+{
+  unsigned int i;
+
+  for (i = 0; i < setup->nb_updaters; i++)
+    zrpc_vpnservice_updater_enqueue (&setup->updaters[i], notif);
+}
+
+/* controllers have to send their whole configuration again. this is
+ * sent first once connected, and notifications queued before it are
+ * dropped */
+static void zrpc_vpnservice_notif_reset (struct zrpc_vpnservice *setup)
+{
+  struct zrpc_vpnservice_notif_queue *queue;
+  unsigned int i;
+
+  for (i = 0; i < setup->nb_updaters; i++)
+    {
+      queue = &setup->updaters[i].notif_queue;
+      queue->head = queue->tail;
+      zrpc_util_index_clear (&queue->index);
+      if (queue->journal)
+        zrpc_journal_reset (queue->journal);
+      queue->nb_retained = 0;
+      queue->replay_seq = queue->next_seq;
+      queue->resync = 1;
+      zrpc_vpnservice_updater_schedule (&setup->updaters[i]);
+    }
+}
+
+/* return 1 if both sockets have the same remote address. unix
+ * sockets have no remote address on the accepting side: they match
+ * if the same process is at the other end */
+static int zrpc_vpnservice_same_peer (int fd1, int fd2)
+{
+  struct sockaddr_storage addr1, addr2;
+  socklen_t len1 = sizeof (addr1), len2 = sizeof (addr2);
+  struct ucred cred1, cred2;
+
+  if (fd1 <= 0 || fd2 <= 0 ||
+      getpeername (fd1, (struct sockaddr *)&addr1, &len1) < 0 ||
+      getpeername (fd2, (struct sockaddr *)&addr2, &len2) < 0 ||
+      addr1.ss_family != addr2.ss_family)
+    return 0;
+  if (addr1.ss_family == AF_INET)
+    return ((struct sockaddr_in *)&addr1)->sin_addr.s_addr ==
+      ((struct sockaddr_in *)&addr2)->sin_addr.s_addr;
+  if (addr1.ss_family == AF_INET6)
+    return memcmp (&((struct sockaddr_in6 *)&addr1)->sin6_addr,
+                   &((struct sockaddr_in6 *)&addr2)->sin6_addr,
+                   sizeof (struct in6_addr)) == 0;
+  if (addr1.ss_family == AF_UNIX)
+    {
+      len1 = sizeof (cred1);
+      len2 = sizeof (cred2);
+      return getsockopt (fd1, SOL_SOCKET, SO_PEERCRED, &cred1, &len1) == 0 &&
+        getsockopt (fd2, SOL_SOCKET, SO_PEERCRED, &cred2, &len2) == 0 &&
+        cred1.pid == cred2.pid;
+    }
+  return 0;
+}
+
+/* target of the controller connected on configurator socket fd. else
+ * the only target of the same kind, unix socket path or address, as
+ * the configurator connection. NULL if it can not be told */
+static struct zrpc_vpnservice_updater *
+zrpc_vpnservice_updater_of_client (struct zrpc_vpnservice *setup, int fd)
+{
+  struct zrpc_vpnservice_updater *found = NULL;
+  struct sockaddr_storage addr;
+  socklen_t len = sizeof (addr);
+  unsigned int i, nb_found = 0;
+  int is_unix;
+
+  if (setup->nb_updaters == 1)
+    return &setup->updaters[0];
+  if (fd <= 0 || getsockname (fd, (struct sockaddr *)&addr, &len) < 0)
+    return NULL;
+  for (i = 0; i < setup->nb_updaters; i++)
+    if (zrpc_vpnservice_same_peer (fd, zrpc_vpnservice_bgp_updater_fd (&setup->updaters[i])))
+      return &setup->updaters[i];
+  /* target may not be connected yet */
+  is_unix = addr.ss_family == AF_UNIX;
+  for (i = 0; i < setup->nb_updaters; i++)
+    if (!ZRPC_ADDRESS_IS_PATH (setup->updaters[i].address) == !is_unix)
+      {
+        found = &setup->updaters[i];
+        nb_found++;
+      }
+  return nb_found == 1 ? found : NULL;
+}
+
+/* retained notifications from sequence number from_seq are to be sent
+ * again. returns BGP_ERR_RESYNC if some are not retained anymore, and
+ * BGP_ERR_PARAM if from_seq is not sent yet */
+int zrpc_vpnservice_notif_replay_from (struct zrpc_vpnservice_notif_queue *queue,
+                                       uint64_t from_seq)
+{
+  if (queue->retained == NULL || queue->resync)
+    return BGP_ERR_RESYNC;
+  if (from_seq > queue->next_seq)
+    return BGP_ERR_PARAM;
+  if (from_seq < queue->next_seq - queue->nb_retained)
+    return BGP_ERR_RESYNC;
+  queue->replay_seq = from_seq;
+  queue->resumes++;
+  return 0;
+}
+
+/* replay notifications sent to controller connected on fd from
+ * sequence number from_seq. run by notification thread */
+static int zrpc_vpnservice_updater_resume (struct zrpc_vpnservice *setup, int fd,
+                                           uint64_t from_seq)
+{
+  struct zrpc_vpnservice_updater *updater;
+  int ret;
+
+  if (setup->nb_updaters == 0)
+    return BGP_ERR_RESYNC;
+  updater = zrpc_vpnservice_updater_of_client (setup, fd);
+  /* several targets, none known to be the requester */
+  if (updater == NULL)
+    return BGP_ERR_PARAM;
+  ret = zrpc_vpnservice_notif_replay_from (&updater->notif_queue, from_seq);
+  if (ret)
+    return ret;
+  if (IS_ZRPC_DEBUG_NOTIFICATION)
+    zrpc_log ("resume notifications to %s from seq %llu, %llu to replay",
+              updater->address, (unsigned long long)from_seq,
+              (unsigned long long)(updater->notif_queue.next_seq - from_seq));
+  zrpc_vpnservice_updater_schedule (updater);
+  return 0;
+}
+
+/* wake up notification thread, unless it is already */
+static void zrpc_vpnservice_notif_wake (struct zrpc_vpnservice *setup)
+{
+  char c = 0;
+
+  if (__atomic_exchange_n (&setup->notif_ring.wakeup, 1, __ATOMIC_SEQ_CST) == 0 &&
+      write (setup->notif_pipe[1], &c, 1) < 0 && errno != EAGAIN)
+    zrpc_log ("notification thread wake up failed (%s)", strerror (errno));
+}
+
+/* hand notification over to notification thread. run by main thread,
+ * the only producer. returns 0 if ring is full */
+static int zrpc_vpnservice_notif_ring_push (struct zrpc_vpnservice *setup,
+                                            struct zrpc_vpnservice_notif *notif)
+{
+  struct zrpc_vpnservice_notif_ring *ring = &setup->notif_ring;
+  uint32_t depth;
+
+  depth = ring->tail - __atomic_load_n (&ring->head, __ATOMIC_ACQUIRE);
+  if (depth == ring->size)
+    {
+      /* notification thread resyncs controllers when it sees it */
+      __atomic_store_n (&ring->drops, ring->drops + 1, __ATOMIC_RELEASE);
+      zrpc_vpnservice_notif_wake (setup);
+      return 0;
+    }
+  ring->ring[ring->tail & (ring->size - 1)] = *notif;
+  __atomic_store_n (&ring->tail, ring->tail + 1, __ATOMIC_RELEASE);
+  if (depth + 1 > ring->high_water)
+    ring->high_water = depth + 1;
+  zrpc_vpnservice_notif_wake (setup);
+  return 1;
+}
+
+/* number notification and hand it over to notification thread.
+ * returns 0 if notification is lost */
+int zrpc_vpnservice_notif_enqueue (struct zrpc_vpnservice *setup,
+                                   struct zrpc_vpnservice_notif *notif)
+{
+  notif->id = ++setup->notif_last_id;
+  if (tm->notif_coalesce_window)
+    notif->stamp = zrpc_vpnservice_msec ();
+  return zrpc_vpnservice_notif_ring_push (setup, notif);
+}
+
+/* tell controllers to send their whole configuration again.
+ * notifications given before are dropped */
+void zrpc_vpnservice_notif_resync (struct zrpc_vpnservice *setup)
+{
+  struct zrpc_vpnservice_notif notif;
+
+  memset (&notif, 0, sizeof (struct zrpc_vpnservice_notif));
+  notif.type = ZRPC_NOTIF_RESYNC;
+  zrpc_vpnservice_notif_ring_push (setup, &notif);
+}
+
+/* replay notifications sent to requesting controller from sequence
+ * number from_seq. returns 0, or BGP_ERR_RESYNC if they are not all
+ * retained, or BGP_ERR_PARAM if controller target is unknown. waits
+ * for notification thread to handle request */
+int zrpc_vpnservice_notif_resume (struct zrpc_vpnservice *setup, uint64_t from_seq)
+{
+  struct zrpc_vpnservice_client *client = zrpc_vpnservice_get_client ();
+  int ret;
+
+  if (!setup->notif_thread_running)
+    return BGP_ERR_RESYNC;
+  pthread_mutex_lock (&setup->notif_mutex);
+  /* one request at a time, worker threads may ask concurrently */
+  while (setup->notif_resume_busy)
+    pthread_cond_wait (&setup->notif_cond, &setup->notif_mutex);
+  setup->notif_resume_busy = 1;
+  setup->notif_resume_fd = 0;
+  if (client && client->transport)
+    setup->notif_resume_fd = THRIFT_SOCKET (client->transport)->sd;
+  setup->notif_resume_seq = from_seq;
+  setup->notif_resume_pending = 1;
+  zrpc_vpnservice_notif_wake (setup);
+  while (setup->notif_resume_pending)
+    pthread_cond_wait (&setup->notif_cond, &setup->notif_mutex);
+  ret = setup->notif_resume_ret;
+  setup->notif_resume_busy = 0;
+  pthread_cond_broadcast (&setup->notif_cond);
+  pthread_mutex_unlock (&setup->notif_mutex);
+  return ret;
+}
+
+/* notification thread job: take notifications given by main thread */
+static int zrpc_vpnservice_notif_wakeup (struct thread *thread)
+{
+  struct zrpc_vpnservice *setup;
+  struct zrpc_vpnservice_notif_ring *ring;
+  struct zrpc_vpnservice_notif *notif;
+  uint32_t tail, drops;
+  unsigned int i;
+  char buf[64];
+
+  setup = THREAD_ARG (thread);
+  ring = &setup->notif_ring;
+  setup->notif_wakeup_thread = NULL;
+  while (read (THREAD_FD (thread), buf, sizeof (buf)) > 0)
+    ;
+  /* notifications given from now on wake us up again */
+  __atomic_store_n (&ring->wakeup, 0, __ATOMIC_SEQ_CST);
+  tail = __atomic_load_n (&ring->tail, __ATOMIC_ACQUIRE);
+  while (ring->head != tail)
+    {
+      notif = &ring->ring[ring->head & (ring->size - 1)];
+      if (notif->type == ZRPC_NOTIF_RESYNC)
+        zrpc_vpnservice_notif_reset (setup);
+      else
+        zrpc_vpnservice_notif_dispatch (setup, notif);
+      __atomic_store_n (&ring->head, ring->head + 1, __ATOMIC_RELEASE);
+    }
+  drops = __atomic_load_n (&ring->drops, __ATOMIC_ACQUIRE);
+  if (drops != ring->drops_seen)
+    {
+      for (i = 0; i < setup->nb_updaters; i++)
+        {
+          zrpc_vpnservice_notif_overflow (&setup->updaters[i], drops - ring->drops_seen);
+          zrpc_vpnservice_updater_schedule (&setup->updaters[i]);
+        }
+      ring->drops_seen = drops;
+    }
+  pthread_mutex_lock (&setup->notif_mutex);
+  if (setup->notif_resume_pending)
+    {
+      setup->notif_resume_ret = zrpc_vpnservice_updater_resume (setup, setup->notif_resume_fd,
+                                                                setup->notif_resume_seq);
+      setup->notif_resume_pending = 0;
+      pthread_cond_broadcast (&setup->notif_cond);
+    }
+  pthread_mutex_unlock (&setup->notif_mutex);
+  THREAD_READ_ON (setup->notif_master, setup->notif_wakeup_thread,
+                  zrpc_vpnservice_notif_wakeup, setup, setup->notif_pipe[0]);
+  return 0;
+}
+
+/* notification thread: encodes and sends notifications, and handles
+ * BgpUpdater connections, so that route storms do not delay
+ * configurator requests */
+static void *zrpc_vpnservice_notif_thread (void *arg)
+{
+  struct zrpc_vpnservice *setup = arg;
+  struct thread thread;
+
+  zrpc_util_block_signals ();
+  zrpc_vpnservice_updater_start (setup);
+  THREAD_READ_ON (setup->notif_master, setup->notif_wakeup_thread,
+                  zrpc_vpnservice_notif_wakeup, setup, setup->notif_pipe[0]);
+  while (!__atomic_load_n (&setup->notif_stop, __ATOMIC_ACQUIRE) &&
+         thread_fetch (setup->notif_master, &thread))
+    thread_call (&thread);
+  return NULL;
+}
+
+static void zrpc_vpnservice_notif_thread_stop (struct zrpc_vpnservice *setup)
+{
+  if (!setup->notif_thread_running)
+    return;
+  __atomic_store_n (&setup->notif_stop, 1, __ATOMIC_RELEASE);
+  /* wakeup flag may be set already */
+  if (write (setup->notif_pipe[1], "", 1) < 0 && errno != EAGAIN)
+    zrpc_log ("notification thread stop failed (%s)", strerror (errno));
+  pthread_join (setup->notif_thread, NULL);
+  setup->notif_thread_running = 0;
+  setup->notif_stop = 0;
+  THREAD_OFF (setup->notif_wakeup_thread);
+}
+
+/* queue of size notifications, keeping retention last sent ones,
+ * coalescing notifications if coalesce is set */
+void zrpc_vpnservice_notif_queue_init (struct zrpc_vpnservice_notif_queue *queue,
+                                       uint32_t size, uint32_t retention, int coalesce)
+{
+  memset (queue, 0, sizeof (struct zrpc_vpnservice_notif_queue));
+  queue->size = 1;
+  while (queue->size < size)
+    queue->size <<= 1;
+  queue->ring = ZRPC_MALLOC (queue->size * sizeof (struct zrpc_vpnservice_notif));
+  /* sequence numbers start at 1 */
+  queue->next_seq = 1;
+  queue->replay_seq = 1;
+  if (retention)
+    {
+      queue->retain_size = 1;
+      while (queue->retain_size < retention)
+        queue->retain_size <<= 1;
+      queue->retained = ZRPC_MALLOC (queue->retain_size * sizeof (struct zrpc_vpnservice_notif));
+    }
+  if (coalesce)
+    zrpc_util_index_resize (&queue->index, &zrpc_vpnservice_notif_index_ops,
+                            queue->ring, 0, 2 * queue->size);
+}
+
+void zrpc_vpnservice_notif_queue_free (struct zrpc_vpnservice_notif_queue *queue)
+{
+  if (queue->ring)
+    ZRPC_FREE (queue->ring);
+  zrpc_util_index_free (&queue->index);
+  if (queue->retained)
+    ZRPC_FREE (queue->retained);
+  memset (queue, 0, sizeof (struct zrpc_vpnservice_notif_queue));
+}
+
+static void zrpc_vpnservice_setup_notif_queue (struct zrpc_vpnservice_updater *updater, uint32_t size)
+{
+  struct zrpc_vpnservice_notif_queue *queue = &updater->notif_queue;
+  struct zrpc_vpnservice *setup = updater->setup;
+  char *path;
+
+  zrpc_vpnservice_notif_queue_init (queue, size, tm->notif_retention,
+                                    tm->notif_coalesce_window != 0);
+  if (tm->notif_journal_path == NULL)
+    return;
+  /* one journal file per target */
+  if (setup->nb_updaters == 1)
+    {
+      queue->journal = zrpc_journal_open (tm->notif_journal_path,
+                                          sizeof (struct zrpc_vpnservice_notif),
+                                          tm->notif_journal_size);
+      return;
+    }
+  path = ZRPC_MALLOC (strlen (tm->notif_journal_path) + 12);
+  sprintf (path, "%s.%u", tm->notif_journal_path,
+           (unsigned int)(updater - setup->updaters));
+  queue->journal = zrpc_journal_open (path, sizeof (struct zrpc_vpnservice_notif),
+                                      tm->notif_journal_size);
+  ZRPC_FREE (path);
+}
+
+static void zrpc_vpnservice_terminate_notif_queue (struct zrpc_vpnservice_updater *updater)
+{
+  struct zrpc_vpnservice_notif_queue *queue = &updater->notif_queue;
+
+  THREAD_OFF (updater->write_thread);
+  THREAD_TIMER_OFF (updater->batch_timer);
+  zrpc_journal_close (queue->journal);
+  zrpc_vpnservice_notif_queue_free (queue);
+}
+
+/* one target per configured notification address */
+static void zrpc_vpnservice_setup_updaters (struct zrpc_vpnservice *setup)
+{
+  struct zrpc_vpnservice_updater *updater;
+  struct zrpc_vpnservice_notif_ring *ring;
+  unsigned int i;
+
+  setup->nb_updaters = tm->zrpc_notification_address_count ?
+    tm->zrpc_notification_address_count : 1;
+  setup->updaters = ZRPC_CALLOC (setup->nb_updaters * sizeof (struct zrpc_vpnservice_updater));
+  for (i = 0; i < setup->nb_updaters; i++)
+    {
+      updater = &setup->updaters[i];
+      updater->setup = setup;
+      updater->address = ZRPC_STRDUP (tm->zrpc_notification_address[i]);
+      updater->connect_fd = -1;
+      zrpc_vpnservice_setup_notif_queue (updater, tm->notif_queue_size);
+    }
+  /* encoded messages are only worth keeping for other targets */
+  if (setup->nb_updaters > 1)
+    {
+      setup->bgp_updater_frames = ZRPC_CALLOC (ZRPC_NOTIF_FRAME_CACHE_SIZE *
+                                               sizeof (struct zrpc_vpnservice_frame));
+      for (i = 0; i < ZRPC_NOTIF_FRAME_CACHE_SIZE; i++)
+        setup->bgp_updater_frames[i].data = g_byte_array_new ();
+    }
+  /* hand over from main thread to notification thread */
+  ring = &setup->notif_ring;
+  ring->size = 1;
+  while (ring->size < tm->notif_queue_size)
+    ring->size <<= 1;
+  ring->ring = ZRPC_MALLOC (ring->size * sizeof (struct zrpc_vpnservice_notif));
+  if (pipe (setup->notif_pipe) < 0)
+    zrpc_log ("notification pipe failed (%s)", strerror (errno));
+  for (i = 0; i < 2; i++)
+    fcntl (setup->notif_pipe[i], F_SETFL,
+           fcntl (setup->notif_pipe[i], F_GETFL, 0) | O_NONBLOCK);
+  pthread_mutex_init (&setup->notif_mutex, NULL);
+  pthread_cond_init (&setup->notif_cond, NULL);
+  setup->notif_master = thread_master_create ();
+}
+
+static void zrpc_vpnservice_terminate_updaters (struct zrpc_vpnservice *setup)
+{
+  unsigned int i;
+
+  for (i = 0; i < setup->nb_updaters; i++)
+    {
+      zrpc_vpnservice_terminate_notif_queue (&setup->updaters[i]);
+      ZRPC_FREE (setup->updaters[i].address);
+    }
+  if (setup->updaters)
+    ZRPC_FREE (setup->updaters);
+  setup->updaters = NULL;
+  setup->nb_updaters = 0;
+  if (setup->bgp_updater_frames)
+    {
+      for (i = 0; i < ZRPC_NOTIF_FRAME_CACHE_SIZE; i++)
+        g_byte_array_unref (setup->bgp_updater_frames[i].data);
+      ZRPC_FREE (setup->bgp_updater_frames);
+    }
+  setup->bgp_updater_frames = NULL;
+  if (setup->notif_master)
+    {
+      thread_master_free (setup->notif_master);
+      close (setup->notif_pipe[0]);
+      close (setup->notif_pipe[1]);
+      pthread_mutex_destroy (&setup->notif_mutex);
+      pthread_cond_destroy (&setup->notif_cond);
+    }
+  setup->notif_master = NULL;
+  if (setup->notif_ring.ring)
+    ZRPC_FREE (setup->notif_ring.ring);
+  memset (&setup->notif_ring, 0, sizeof (struct zrpc_vpnservice_notif_ring));
+}
+static void zrpc_vpnservice_callback (void *arg, void *zmqsock, struct zmq_msg_t *message)
+{
+  struct capn rc;
+  capn_ptr p;
+  struct bgp_event_vrf ss;
+  struct bgp_event_vrf *s;
+  struct zrpc_vpnservice *ctxt = NULL;
+  struct zrpc_vpnservice_notif notif;
+
+  zrpc_vpnservice_get_context (&ctxt);
+  if(!ctxt)
+    {
+      return;
+    }
+  ctxt->bgp_update_total++;
+  p = qzcclient_msg_to_notification (message, &rc);
+  s = &ss;
+  memset(s, 0, sizeof(struct bgp_event_vrf));
+  qcapn_BGPEventVRFRoute_read(s, p);
+  capn_free(&rc);
+  memset(&notif, 0, sizeof(struct zrpc_vpnservice_notif));
+  if (s->announce != BGP_EVENT_SHUT)
+    {
+      /* mirror RIB is kept up to date, even if notification is lost */
+      zrpc_vpnservice_rib_update (ctxt, s);
+      if (s->announce & BGP_EVENT_MASK_ANNOUNCE)
+        notif.type = ZRPC_NOTIF_PUSH_ROUTE;
+      else
+        notif.type = ZRPC_NOTIF_WITHDRAW_ROUTE;
+      notif.prefixlen = s->prefix.prefixlen;
+      notif.prefix = s->prefix.prefix;
+      notif.nexthop = s->nexthop;
+      notif.label = s->label;
+      notif.rd = s->outbound_rd;
+    }
+  else
+    {
+      notif.type = ZRPC_NOTIF_SEND_EVENT;
+      notif.nexthop.s_addr = s->nexthop.s_addr;
+      notif.err_code = (uint8_t)s->label;
+      notif.err_subcode = (uint8_t)s->prefix.prefix.s_addr;
+    }
+  zrpc_vpnservice_notif_enqueue (ctxt, &notif);
+  return;
+}
+
+#define SBIN_DIR "/sbin"
+
+void zrpc_vpnservice_setup(struct zrpc_vpnservice *setup)
+{
+  char bgpd_location_path[128];
+  char *ptr = bgpd_location_path;
+
+  setup->zrpc_listen_port = ZRPC_LISTEN_PORT;
+  setup->zrpc_notification_port = ZRPC_NOTIFICATION_PORT;
+  setup->zmq_sock = ZRPC_STRDUP(ZMQ_SOCK);
+  setup->zmq_subscribe_sock = ZRPC_STRDUP(ZMQ_NOTIFY);
+  ptr+=sprintf(ptr, "%s", BGPD_PATH_QUAGGA);
+  ptr+=sprintf(ptr, "%s/bgpd",SBIN_DIR);
+  setup->bgpd_execution_path = ZRPC_STRDUP(bgpd_location_path);
+  zrpc_vpnservice_setup_locks (setup);
+  zrpc_vpnservice_setup_updaters (setup);
+}
+
+void zrpc_vpnservice_terminate(struct zrpc_vpnservice *setup)
+{
+  if(!setup)
+    return;
+  setup->zrpc_listen_port = 0;
+  setup->zrpc_notification_port = 0;
+  ZRPC_FREE(setup->zmq_sock);
+  setup->zmq_sock = NULL;
+  ZRPC_FREE(setup->zmq_subscribe_sock);
+  setup->zmq_subscribe_sock = NULL;
+  ZRPC_FREE(setup->bgpd_execution_path);
+  setup->bgpd_execution_path = NULL;
+  zrpc_vpnservice_get_routes_cursor_flush (setup);
+  zrpc_vpnservice_terminate_updaters (setup);
+  zrpc_vpnservice_terminate_locks (setup);
+}
+
+void zrpc_vpnservice_terminate_thrift_bgp_updater_client (struct zrpc_vpnservice *setup)
+{
+  struct zrpc_vpnservice_updater *updater;
+  unsigned int i;
+
+  if(!setup)
+    return;
+  /* updaters are not used anymore once thread is gone */
+  zrpc_vpnservice_notif_thread_stop (setup);
+  for (i = 0; i < setup->nb_updaters; i++)
+    {
+      updater = &setup->updaters[i];
+      THREAD_OFF (updater->write_thread);
+      THREAD_TIMER_OFF (updater->batch_timer);
+      THREAD_TIMER_OFF (updater->client_thread);
+      THREAD_OFF (updater->connect_thread);
+      THREAD_OFF (updater->read_thread);
+      if (updater->connect_fd >= 0)
+        close (updater->connect_fd);
+      updater->connect_fd = -1;
+      updater->job_in_progress = 0;
+      updater->status = FALSE;
+      if(updater->transport)
+        g_object_unref(updater->transport);
+      updater->transport = NULL;
+      if(updater->socket)
+        g_object_unref(updater->socket);
+      updater->socket = NULL;
+    }
+  if(setup->bgp_updater_client)
+    g_object_unref(setup->bgp_updater_client);
+  setup->bgp_updater_client = NULL;
+  if(setup->bgp_updater_protocol)
+    g_object_unref(setup->bgp_updater_protocol);
+  setup->bgp_updater_protocol = NULL;
+  if(setup->bgp_updater_buffer)
+    g_object_unref(setup->bgp_updater_buffer);
+  setup->bgp_updater_buffer = NULL;
+}
+
+void zrpc_vpnservice_terminate_qzc(struct zrpc_vpnservice *setup)
+{
+  if(!setup)
+    return;
+  if(setup->qzc_subscribe_sock)
+    qzcclient_close (setup->qzc_subscribe_sock);
+  setup->qzc_subscribe_sock = NULL;
+  if(setup->qzc_sock)
+      qzcclient_close (setup->qzc_sock);
+  setup->qzc_sock = NULL;
+
+  qzmqclient_finish();
+}
+
+void zrpc_vpnservice_setup_qzc(struct zrpc_vpnservice *setup)
+{
+  qzcclient_init ();
+  if(setup->zmq_subscribe_sock && setup->qzc_subscribe_sock == NULL )
+    setup->qzc_subscribe_sock = qzcclient_subscribe(tm->global, \
+                                                    setup->zmq_subscribe_sock, \
+                                                    zrpc_vpnservice_callback);
+}
+
+void zrpc_vpnservice_terminate_bgp_context(struct zrpc_vpnservice *setup)
+{
+  if(!setup->bgp_context)
+    return;
+  if(setup->bgp_context->proc)
+    {
+      zrpc_log ("sending SIGINT signal to Bgpd (%d)",setup->bgp_context->proc);
+      kill(setup->bgp_context->proc, SIGINT);
+      setup->bgp_context->proc = 0;
+    }
+  if(setup->bgp_context)
+    {
+      ZRPC_FREE(setup->bgp_context);
+      setup->bgp_context = NULL;
+    }
+  return;
+}
+
+void zrpc_vpnservice_setup_bgp_context(struct zrpc_vpnservice *setup)
+{
+  setup->bgp_context=ZRPC_CALLOC( sizeof(struct zrpc_vpnservice_bgp_context));
+}
+
+struct zrpc_vpnservice_bgp_context *zrpc_vpnservice_get_bgp_context(struct zrpc_vpnservice *setup)
+{
+  return setup->bgp_context;
+}
+
+void zrpc_vpnservice_setup_bgp_cache(struct zrpc_vpnservice *ctxt)
+{
+  memset(&ctxt->bgp_vrf_table, 0, sizeof(struct zrpc_vpnservice_vrf_table));
+  memset(&ctxt->bgp_peer_table, 0, sizeof(struct zrpc_vpnservice_peer_table));
+}
+
+void zrpc_vpnservice_terminate_bgpvrf_cache (struct zrpc_vpnservice *setup)
+{
+  uint32_t i;
+
+  for (i = 0; i < setup->bgp_vrf_table.count; i++)
+    {
+      zrpc_rib_free (setup->bgp_vrf_table.entries[i].rib);
+      zrpc_vpnservice_pushed_flush (&setup->bgp_vrf_table.entries[i]);
+      zrpc_vpnservice_vrf_set_rts (&setup->bgp_vrf_table.entries[i], NULL, 0, 0);
+    }
+  if (setup->bgp_vrf_table.entries)
+    ZRPC_FREE (setup->bgp_vrf_table.entries);
+  zrpc_util_index_free (&setup->bgp_vrf_table.index);
+  memset(&setup->bgp_vrf_table, 0, sizeof(struct zrpc_vpnservice_vrf_table));
+
+  zrpc_vpnservice_get_routes_cursor_flush (setup);
+
+  if (setup->bgp_peer_table.entries)
+    ZRPC_FREE (setup->bgp_peer_table.entries);
+  zrpc_util_index_free (&setup->bgp_peer_table.index);
+  memset(&setup->bgp_peer_table, 0, sizeof(struct zrpc_vpnservice_peer_table));
+}
+
+/* VRF cache hash table */
+#define ZRPC_VRF_TABLE_MIN_SLOTS 64
+
+/* pack route distinguisher value in 64 bits */
+uint64_t zrpc_vpnservice_rd_key (struct zrpc_rd_prefix *rd)
+{
+  uint64_t key = 0;
+  int i;
+
+  for (i = 0; i < ZRPC_UTIL_RDRT_SIZE; i++)
+    key = (key << 8) | rd->val[i];
+  return key;
+}
+
+static uint32_t zrpc_vpnservice_vrf_hash (const void *entries, uint32_t offset)
+{
+  return zrpc_util_hash64 (((const struct zrpc_vpnservice_cache_bgpvrf *)entries)[offset].rd_key);
+}
+
+static int zrpc_vpnservice_vrf_match (const void *entries, uint32_t offset, const void *key)
+{
+  return ((const struct zrpc_vpnservice_cache_bgpvrf *)entries)[offset].rd_key ==
+    *(const uint64_t *)key;
+}
+
+static const struct zrpc_util_index_ops zrpc_vpnservice_vrf_index_ops =
+{
+  zrpc_vpnservice_vrf_hash,
+  zrpc_vpnservice_vrf_match,
+};
+
+/* return slot indexing key, or empty slot where key should be indexed */
+static uint32_t zrpc_vpnservice_vrf_table_slot (struct zrpc_vpnservice_vrf_table *table,
+                                                uint64_t key)
+{
+  return zrpc_util_index_slot (&table->index, &zrpc_vpnservice_vrf_index_ops,
+                               table->entries, zrpc_util_hash64 (key), &key);
+}
+
+struct zrpc_vpnservice_cache_bgpvrf *
+zrpc_vpnservice_vrf_lookup (struct zrpc_vpnservice *setup, struct zrpc_rd_prefix *rd)
+{
+  struct zrpc_vpnservice_vrf_table *table = &setup->bgp_vrf_table;
+  uint32_t i;
+
+  if (table->count == 0)
+    return NULL;
+  i = zrpc_vpnservice_vrf_table_slot (table, zrpc_vpnservice_rd_key (rd));
+  if (table->index.slots[i] == 0)
+    return NULL;
+  return &table->entries[table->index.slots[i] - 1];
+}
+
+struct zrpc_vpnservice_cache_bgpvrf *
+zrpc_vpnservice_vrf_add (struct zrpc_vpnservice *setup, struct zrpc_rd_prefix *rd,
+                         uint64_t bgpvrf_nid)
+{
+  struct zrpc_vpnservice_vrf_table *table = &setup->bgp_vrf_table;
+  struct zrpc_vpnservice_cache_bgpvrf *entry;
+  uint64_t key = zrpc_vpnservice_rd_key (rd);
+  uint32_t i;
+
+  table->entries = zrpc_util_index_grow (&table->index, &zrpc_vpnservice_vrf_index_ops,
+                                         table->entries,
+                                         sizeof (struct zrpc_vpnservice_cache_bgpvrf),
+                                         table->count, ZRPC_VRF_TABLE_MIN_SLOTS);
+  i = zrpc_vpnservice_vrf_table_slot (table, key);
+  if (table->index.slots[i])
+    {
+      entry = &table->entries[table->index.slots[i] - 1];
+      /* vrf created again in bgpd, without its routes and settings */
+      if (entry->bgpvrf_nid != bgpvrf_nid)
+        {
+          zrpc_vpnservice_pushed_flush (entry);
+          zrpc_vpnservice_vrf_set_rts (entry, NULL, 0, 0);
+          entry->max_path = 0;
+        }
+      entry->bgpvrf_nid = bgpvrf_nid;
+      return entry;
+    }
+  entry = &table->entries[table->count];
+  entry->rd_key = key;
+  entry->bgpvrf_nid = bgpvrf_nid;
+  entry->outbound_rd = *rd;
+  entry->rib = zrpc_rib_new ();
+  memset (&entry->pushed, 0, sizeof (entry->pushed));
+  entry->rts = NULL;
+  entry->nb_irts = entry->nb_erts = 0;
+  entry->max_path = 0;
+  table->index.slots[i] = ++table->count;
+  return entry;
+}
+
+/* remove vrf from cache. return 1 if entry was found, 0 otherwise */
+int zrpc_vpnservice_vrf_del (struct zrpc_vpnservice *setup, struct zrpc_rd_prefix *rd)
+{
+  struct zrpc_vpnservice_vrf_table *table = &setup->bgp_vrf_table;
+  uint32_t i, idx;
+
+  if (table->count == 0)
+    return 0;
+  i = zrpc_vpnservice_vrf_table_slot (table, zrpc_vpnservice_rd_key (rd));
+  if (table->index.slots[i] == 0)
+    return 0;
+  idx = table->index.slots[i] - 1;
+  zrpc_rib_free (table->entries[idx].rib);
+  zrpc_vpnservice_pushed_flush (&table->entries[idx]);
+  zrpc_vpnservice_vrf_set_rts (&table->entries[idx], NULL, 0, 0);
+  zrpc_util_index_remove (&table->index, &zrpc_vpnservice_vrf_index_ops, table->entries,
+                          sizeof (struct zrpc_vpnservice_cache_bgpvrf), table->count, i);
+  table->count--;
+  return 1;
+}
+
+/* pushed routes hash table */
+#define ZRPC_PUSHED_TABLE_MIN_SLOTS 64
+
+/* prefix key, never 0. host bits are ignored, as bgpd does */
+uint64_t zrpc_vpnservice_pushed_key (const struct zrpc_ipv4_prefix *p)
+{
+  uint32_t addr = ntohl (p->prefix.s_addr);
+
+  if (p->prefixlen < 32)
+    addr &= ~(0xffffffffU >> p->prefixlen);
+  return (1ULL << 40) | ((uint64_t)addr << 8) | p->prefixlen;
+}
+
+static uint32_t zrpc_vpnservice_pushed_hash (const void *entries, uint32_t offset)
+{
+  return zrpc_util_hash64 (((const struct zrpc_vpnservice_pushed_route *)entries)[offset].key);
+}
+
+static int zrpc_vpnservice_pushed_match (const void *entries, uint32_t offset, const void *key)
+{
+  return ((const struct zrpc_vpnservice_pushed_route *)entries)[offset].key ==
+    *(const uint64_t *)key;
+}
+
+static const struct zrpc_util_index_ops zrpc_vpnservice_pushed_index_ops =
+{
+  zrpc_vpnservice_pushed_hash,
+  zrpc_vpnservice_pushed_match,
+};
+
+/* return slot indexing key, or empty slot where key should be indexed */
+static uint32_t zrpc_vpnservice_pushed_slot (struct zrpc_vpnservice_pushed_table *table,
+                                             uint64_t key)
+{
+  return zrpc_util_index_slot (&table->index, &zrpc_vpnservice_pushed_index_ops,
+                               table->entries, zrpc_util_hash64 (key), &key);
+}
+
+/* return 1 if route has already been pushed with same nexthop and label */
+int zrpc_vpnservice_pushed_lookup (struct zrpc_vpnservice_cache_bgpvrf *vrf,
+                                   const struct zrpc_ipv4_prefix *p,
+                                   struct in_addr nexthop, uint32_t label)
+{
+  struct zrpc_vpnservice_pushed_table *table = &vrf->pushed;
+  struct zrpc_vpnservice_pushed_route *route;
+  uint32_t i;
+
+  if (table->count == 0)
+    return 0;
+  i = zrpc_vpnservice_pushed_slot (table, zrpc_vpnservice_pushed_key (p));
+  if (table->index.slots[i] == 0)
+    return 0;
+  route = &table->entries[table->index.slots[i] - 1];
+  return route->nexthop.s_addr == nexthop.s_addr && route->label == label;
+}
+
+void zrpc_vpnservice_pushed_add (struct zrpc_vpnservice_cache_bgpvrf *vrf,
+                                 const struct zrpc_ipv4_prefix *p,
+                                 struct in_addr nexthop, uint32_t label)
+{
+  struct zrpc_vpnservice_pushed_table *table = &vrf->pushed;
+  struct zrpc_vpnservice_pushed_route *route;
+  uint64_t key = zrpc_vpnservice_pushed_key (p);
+  uint32_t i;
+
+  table->entries = zrpc_util_index_grow (&table->index, &zrpc_vpnservice_pushed_index_ops,
+                                         table->entries,
+                                         sizeof (struct zrpc_vpnservice_pushed_route),
+                                         table->count, ZRPC_PUSHED_TABLE_MIN_SLOTS);
+  i = zrpc_vpnservice_pushed_slot (table, key);
+  if (table->index.slots[i] == 0)
+    {
+      table->entries[table->count].key = key;
+      table->index.slots[i] = ++table->count;
     }
+  route = &table->entries[table->index.slots[i] - 1];
+  route->nexthop = nexthop;
+  route->label = label;
+}
+
+void zrpc_vpnservice_pushed_del (struct zrpc_vpnservice_cache_bgpvrf *vrf,
+                                 const struct zrpc_ipv4_prefix *p)
+{
+  struct zrpc_vpnservice_pushed_table *table = &vrf->pushed;
+  uint32_t i;
+
+  if (table->count == 0)
+    return;
+  i = zrpc_vpnservice_pushed_slot (table, zrpc_vpnservice_pushed_key (p));
+  if (table->index.slots[i] == 0)
+    return;
+  zrpc_util_index_remove (&table->index, &zrpc_vpnservice_pushed_index_ops, table->entries,
+                          sizeof (struct zrpc_vpnservice_pushed_route), table->count, i);
+  table->count--;
+}
+
+void zrpc_vpnservice_pushed_flush (struct zrpc_vpnservice_cache_bgpvrf *vrf)
+{
+  if (vrf->pushed.entries)
+    ZRPC_FREE (vrf->pushed.entries);
+  zrpc_util_index_free (&vrf->pushed.index);
+  memset (&vrf->pushed, 0, sizeof (vrf->pushed));
+}
+
+/* prefix of a pushed route key */
+void zrpc_vpnservice_pushed_prefix (uint64_t key, struct zrpc_ipv4_prefix *p)
+{
+  memset (p, 0, sizeof (struct zrpc_ipv4_prefix));
+  p->family = AF_INET;
+  p->prefixlen = key & 0xff;
+  p->prefix.s_addr = htonl ((uint32_t)(key >> 8));
+}
+
+/* record route targets of vrf. rts is owned by vrf afterwards */
+void zrpc_vpnservice_vrf_set_rts (struct zrpc_vpnservice_cache_bgpvrf *vrf, uint64_t *rts,
+                                  uint32_t nb_irts, uint32_t nb_erts)
+{
+  if (vrf->rts)
+    ZRPC_FREE (vrf->rts);
+  vrf->rts = rts;
+  vrf->nb_irts = nb_irts;
+  vrf->nb_erts = nb_erts;
+}
+
+/* return 1 if vrf has these route targets */
+int zrpc_vpnservice_vrf_same_rts (struct zrpc_vpnservice_cache_bgpvrf *vrf, const uint64_t *rts,
+                                  uint32_t nb_irts, uint32_t nb_erts)
+{
+  if (vrf->nb_irts != nb_irts || vrf->nb_erts != nb_erts)
+    return 0;
+  if (nb_irts + nb_erts == 0)
+    return 1;
+  return memcmp (vrf->rts, rts, (nb_irts + nb_erts) * sizeof (uint64_t)) == 0;
+}
+
+/* peer cache hash table */
+#define ZRPC_PEER_TABLE_MIN_SLOTS 64
+
+/*
+ * convert peer address string to binary key
+ * return 1 if address is a valid IPv4 or IPv6 address, 0 otherwise
+ */
+int zrpc_vpnservice_peer_key_set (struct zrpc_vpnservice_peer_key *key, const char *peerIp)
+{
+  memset(key, 0, sizeof(struct zrpc_vpnservice_peer_key));
+  if (peerIp == NULL)
+    return 0;
+  if (inet_pton (AF_INET, peerIp, key->addr) == 1)
+    key->family = AF_INET;
+  else if (inet_pton (AF_INET6, peerIp, key->addr) == 1)
+    key->family = AF_INET6;
   else
-    {
-      setup->bgp_update_monitor++;
-      setup->bgp_updater_client_thread = NULL;
-      THREAD_TIMER_MSEC_ON(tm->global, setup->bgp_updater_client_thread,\
-                           zrpc_vpnservice_setup_bgp_updater_client_monitor,\
-                           setup, 5000);
+    return 0;
+  return 1;
+}
+
+static uint32_t zrpc_vpnservice_peer_hash (struct zrpc_vpnservice_peer_key *key)
+{
+  uint64_t lo, hi;
+
+  memcpy (&lo, key->addr, sizeof(uint64_t));
+  memcpy (&hi, key->addr + sizeof(uint64_t), sizeof(uint64_t));
+  return zrpc_util_hash64 (lo ^ (hi * 0x9e3779b97f4a7c15ULL) ^ key->family);
+}
+
+static int zrpc_vpnservice_peer_key_cmp (struct zrpc_vpnservice_peer_key *key1,
+                                         struct zrpc_vpnservice_peer_key *key2)
+{
+  return memcmp (key1, key2, sizeof(struct zrpc_vpnservice_peer_key));
+}
+
+static uint32_t zrpc_vpnservice_peer_entry_hash (const void *entries, uint32_t offset)
+{
+  return zrpc_vpnservice_peer_hash (&((struct zrpc_vpnservice_cache_peer *)entries)[offset].key);
+}
+
+static int zrpc_vpnservice_peer_entry_match (const void *entries, uint32_t offset,
+                                             const void *key)
+{
+  return zrpc_vpnservice_peer_key_cmp (&((struct zrpc_vpnservice_cache_peer *)entries)[offset].key,
+                                       (struct zrpc_vpnservice_peer_key *)key) == 0;
+}
+
+static const struct zrpc_util_index_ops zrpc_vpnservice_peer_index_ops =
+{
+  zrpc_vpnservice_peer_entry_hash,
+  zrpc_vpnservice_peer_entry_match,
+};
+
+/* return slot indexing key, or empty slot where key should be indexed */
+static uint32_t zrpc_vpnservice_peer_table_slot (struct zrpc_vpnservice_peer_table *table,
+                                                 struct zrpc_vpnservice_peer_key *key)
+{
+  return zrpc_util_index_slot (&table->index, &zrpc_vpnservice_peer_index_ops,
+                               table->entries, zrpc_vpnservice_peer_hash (key), key);
+}
+
+struct zrpc_vpnservice_cache_peer *
+zrpc_vpnservice_peer_lookup (struct zrpc_vpnservice *setup, struct zrpc_vpnservice_peer_key *key)
+{
+  struct zrpc_vpnservice_peer_table *table = &setup->bgp_peer_table;
+  uint32_t i;
+
+  if (table->count == 0)
+    return NULL;
+  i = zrpc_vpnservice_peer_table_slot (table, key);
+  if (table->index.slots[i] == 0)
+    return NULL;
+  return &table->entries[table->index.slots[i] - 1];
+}
+
+struct zrpc_vpnservice_cache_peer *
+zrpc_vpnservice_peer_add (struct zrpc_vpnservice *setup, struct zrpc_vpnservice_peer_key *key,
+                          uint64_t peer_nid, uint32_t asNumber)
+{
+  struct zrpc_vpnservice_peer_table *table = &setup->bgp_peer_table;
+  struct zrpc_vpnservice_cache_peer *entry;
+  uint32_t i;
 
+  table->entries = zrpc_util_index_grow (&table->index, &zrpc_vpnservice_peer_index_ops,
+                                         table->entries,
+                                         sizeof (struct zrpc_vpnservice_cache_peer),
+                                         table->count, ZRPC_PEER_TABLE_MIN_SLOTS);
+  i = zrpc_vpnservice_peer_table_slot (table, key);
+  if (table->index.slots[i])
+    entry = &table->entries[table->index.slots[i] - 1];
+  else
+    {
+      entry = &table->entries[table->count];
+      entry->key = *key;
+      entry->multihop = 0;
+      memset (&entry->update_source, 0, sizeof (entry->update_source));
+      entry->vpnv4 = 0;
+      table->index.slots[i] = ++table->count;
     }
-  zrpc_monitor_retry_job_in_progress = 1;
+  entry->peer_nid = peer_nid;
+  entry->asNumber = asNumber;
+  return entry;
 }
 
-/* returns status from recv with MSG_PEEK option
- * this permits knowing if socket is available or not.
- * values returned: -1 + EAGAIN => nothing to read, but socket is ok
- *                  0, no errno => nothing to read, but socket is ok
- *                 -1, EAGAIN => nothing to read, but socket is still ok
- *                 -1, ENOTCONN => socket got disconnected
- */
-static int zrpc_vpnservice_bgp_updater_check_connection (struct zrpc_vpnservice *setup)
+/* remove peer from cache. return 1 if entry was found, 0 otherwise */
+int zrpc_vpnservice_peer_del (struct zrpc_vpnservice *setup, struct zrpc_vpnservice_peer_key *key)
 {
-  ThriftTransport *transport = NULL;
-  ThriftSocket *tsocket = NULL;
-  int fd = 0;
-  int ret;
-  char buffer[32];
+  struct zrpc_vpnservice_peer_table *table = &setup->bgp_peer_table;
+  uint32_t i;
 
-  if(!setup)
+  if (table->count == 0)
     return 0;
-  if (setup->bgp_updater_transport)
-    transport = setup->bgp_updater_transport->transport;
-  if (transport)
-    tsocket = THRIFT_SOCKET (transport);
-  if (tsocket)
-    fd = tsocket->sd;
-  if (fd == 0)
-    ret = 0;
-  else
-    ret = recv(fd, buffer, 32, MSG_PEEK | MSG_DONTWAIT);
-  return ret;
+  i = zrpc_vpnservice_peer_table_slot (table, key);
+  if (table->index.slots[i] == 0)
+    return 0;
+  zrpc_util_index_remove (&table->index, &zrpc_vpnservice_peer_index_ops, table->entries,
+                          sizeof (struct zrpc_vpnservice_cache_peer), table->count, i);
+  table->count--;
+  return 1;
 }
 
-static int zrpc_vpnservice_setup_bgp_updater_client_retry (struct thread *thread)
+/* configurator connection whose request is being processed by
+ * calling thread */
+static __thread struct zrpc_vpnservice_client *zrpc_vpnservice_client;
+
+void zrpc_vpnservice_set_client (struct zrpc_vpnservice_client *client)
 {
-  struct zrpc_vpnservice *setup;
-  GError *error = NULL;
-  gboolean response;
+  zrpc_vpnservice_client = client;
+}
 
-  setup = THREAD_ARG (thread);
-  assert (setup);
-  thrift_transport_close (setup->bgp_updater_transport->transport, &error);
-  response = thrift_transport_open (setup->bgp_updater_transport->transport, &error);
-  zrpc_monitor_retry_job_in_progress = 0;
-  zrpc_transport_check_response(setup, response);
-  return 0;
+struct zrpc_vpnservice_client *zrpc_vpnservice_get_client (void)
+{
+  return zrpc_vpnservice_client;
 }
 
-/* detects if remote peer is present or not
- * either relaunch monitor or retry to reconnect
- */
-static int zrpc_vpnservice_setup_bgp_updater_client_monitor (struct thread *thread)
+int zrpc_vpnservice_main_thread (struct zrpc_vpnservice *setup)
 {
-  struct zrpc_vpnservice *setup;
-  GError *error = NULL;
-  gboolean response;
-  int ret;
+  return pthread_equal (pthread_self (), setup->main_thread);
+}
 
-  setup = THREAD_ARG (thread);
-  assert (setup);
-  ret = zrpc_vpnservice_bgp_updater_check_connection (setup);
-  if (ret == 0 ||
-      (ret < 0 && errno != ENOTCONN))
+/* if an exclusive handler asks for it, stay parked until it is done.
+ * main thread only */
+void zrpc_vpnservice_park_serve (struct zrpc_vpnservice *setup)
+{
+  pthread_mutex_lock (&setup->park_lock);
+  if (setup->park_state == ZRPC_VPNSERVICE_PARK_REQUESTED)
     {
-      zrpc_monitor_retry_job_in_progress = 0;
-      zrpc_transport_check_response(setup, 1);
-      return 0;
+      setup->park_state = ZRPC_VPNSERVICE_PARKED;
+      pthread_cond_broadcast (&setup->park_cond);
+      while (setup->park_state == ZRPC_VPNSERVICE_PARKED)
+        pthread_cond_wait (&setup->park_cond, &setup->park_lock);
     }
-  thrift_transport_close (setup->bgp_updater_transport->transport, &error);
-  response = thrift_transport_open (setup->bgp_updater_transport->transport, &error);
-  zrpc_monitor_retry_job_in_progress = 0;
-  zrpc_transport_check_response(setup, response);
+  pthread_mutex_unlock (&setup->park_lock);
+}
+
+/* main thread waits for fd to be readable, staying parked meanwhile
+ * for exclusive handlers asking for it */
+void zrpc_vpnservice_park_wait (struct zrpc_vpnservice *setup, int fd)
+{
+  struct pollfd pfd[2];
+  char buf[16];
+
+  pfd[0].fd = fd;
+  pfd[0].events = POLLIN;
+  pfd[0].revents = 0;
+  pfd[1].fd = setup->park_pipe[0];
+  pfd[1].events = POLLIN;
+  pfd[1].revents = 0;
+  if (poll (pfd, 2, -1) < 0)
+    return;
+  if (pfd[1].revents & POLLIN)
+    while (read (setup->park_pipe[0], buf, sizeof (buf)) > 0);
+  zrpc_vpnservice_park_serve (setup);
+}
+
+static int zrpc_vpnservice_park (struct thread *thread)
+{
+  struct zrpc_vpnservice *setup = THREAD_ARG (thread);
+  char buf[16];
+
+  setup->park_thread = NULL;
+  while (read (setup->park_pipe[0], buf, sizeof (buf)) > 0);
+  zrpc_vpnservice_park_serve (setup);
+  THREAD_READ_ON (tm->global, setup->park_thread, zrpc_vpnservice_park,
+                  setup, setup->park_pipe[0]);
   return 0;
 }
-/* callback function for capnproto bgpupdater notifications */
-static void zrpc_vpnservice_callback (void *arg, void *zmqsock, struct zmq_msg_t *message)
+
+static void zrpc_vpnservice_setup_locks (struct zrpc_vpnservice *setup)
 {
-  struct capn rc;
-  capn_ptr p;
-  struct bgp_event_vrf ss;
-  struct bgp_event_vrf *s;
-  static gboolean client_ready;
-  struct zrpc_vpnservice *ctxt = NULL;
-  struct bgp_event_shut tt;
-  struct bgp_event_shut *t;
-  bool announce;
+  int i;
 
-  zrpc_vpnservice_get_context (&ctxt);
-  if(!ctxt)
+  pthread_rwlock_init (&setup->bgp_lock, NULL);
+  for (i = 0; i < ZRPC_VPNSERVICE_LOCK_STRIPES; i++)
     {
-      return;
-    }
-  ctxt->bgp_update_total++;
-  /* if first time or previous failure, try to reconnect to client */
-  if((ctxt->bgp_updater_client == NULL) || (zrpc_transport_current_status == FALSE))
-    {
-      if(ctxt->bgp_updater_client)
-        zrpc_vpnservice_terminate_thrift_bgp_updater_client(ctxt);
-      /* start the retry mecanism */
-      client_ready = zrpc_vpnservice_setup_thrift_bgp_updater_client(ctxt);
-      zrpc_transport_check_response(ctxt, client_ready);
-      if(client_ready == FALSE)
-        {
-          if (IS_ZRPC_DEBUG_NOTIFICATION)
-            zrpc_log ("bgp->sdnc message failed to be sent");
-          ctxt->bgp_update_lost_msgs++;
-          return;
-        }
+      pthread_mutex_init (&setup->vrf_lock[i], NULL);
+      pthread_mutex_init (&setup->peer_lock[i], NULL);
     }
-  p = qzcclient_msg_to_notification (message, &rc);
-  s = &ss;
-  memset(s, 0, sizeof(struct bgp_event_vrf));
-  qcapn_BGPEventVRFRoute_read(s, p);
-  if (s->announce != BGP_EVENT_SHUT)
+  pthread_mutex_init (&setup->bgp_get_routes_lock, NULL);
+  pthread_mutex_init (&setup->park_mutex, NULL);
+  pthread_mutex_init (&setup->park_lock, NULL);
+  pthread_cond_init (&setup->park_cond, NULL);
+  setup->main_thread = pthread_self ();
+  setup->park_state = ZRPC_VPNSERVICE_RUNNING;
+  if (pipe (setup->park_pipe) < 0)
     {
-      announce = (s->announce & BGP_EVENT_MASK_ANNOUNCE)?TRUE:FALSE;
-      if (announce == TRUE)
-        {
-          char vrf_rd_str[ZRPC_UTIL_RDRT_LEN], pfx_str[ZRPC_UTIL_IPV6_LEN_MAX];
-          struct zrpc_ipv4_prefix *p = (struct zrpc_ipv4_prefix *)&(s->prefix);
+      zrpc_log ("park pipe failed (%s)", strerror (errno));
+      setup->park_pipe[0] = setup->park_pipe[1] = -1;
+      return;
+    }
+  for (i = 0; i < 2; i++)
+    fcntl (setup->park_pipe[i], F_SETFL,
+           fcntl (setup->park_pipe[i], F_GETFL, 0) | O_NONBLOCK);
+  THREAD_READ_ON (tm->global, setup->park_thread, zrpc_vpnservice_park,
+                  setup, setup->park_pipe[0]);
+}
 
-          zrpc_util_rd_prefix2str(&s->outbound_rd, vrf_rd_str, sizeof(vrf_rd_str));
-          inet_ntop (p->family, &p->prefix, pfx_str, ZRPC_UTIL_IPV6_LEN_MAX);
-          zrpc_bgp_updater_on_update_push_route(vrf_rd_str, pfx_str, (const gint32)s->prefix.prefixlen, \
-                                                                  inet_ntoa(s->nexthop), s->label);
-        }
-      else
-        {
-          char vrf_rd_str[ZRPC_UTIL_RDRT_LEN], pfx_str[ZRPC_UTIL_IPV6_LEN_MAX], nh_str[ZRPC_UTIL_IPV6_LEN_MAX];
-          struct zrpc_ipv4_prefix *p = (struct zrpc_ipv4_prefix *)&(s->prefix);
-
-          inet_ntop (p->family, &p->prefix, pfx_str, ZRPC_UTIL_IPV6_LEN_MAX);
-          zrpc_util_rd_prefix2str(&s->outbound_rd, vrf_rd_str, sizeof(vrf_rd_str));
-          inet_ntop (p->family, &s->nexthop, nh_str, ZRPC_UTIL_IPV6_LEN_MAX);
-          zrpc_bgp_updater_on_update_withdraw_route(vrf_rd_str, pfx_str, (const gint32)s->prefix.prefixlen,
-                                                    nh_str, s->label);
-        }
+static void zrpc_vpnservice_terminate_locks (struct zrpc_vpnservice *setup)
+{
+  int i;
+
+  THREAD_OFF (setup->park_thread);
+  if (setup->park_pipe[0] >= 0)
+    {
+      close (setup->park_pipe[0]);
+      close (setup->park_pipe[1]);
     }
-  else
+  setup->park_pipe[0] = setup->park_pipe[1] = -1;
+  pthread_rwlock_destroy (&setup->bgp_lock);
+  for (i = 0; i < ZRPC_VPNSERVICE_LOCK_STRIPES; i++)
     {
-      char ip_str[ZRPC_UTIL_IPV6_LEN_MAX];
-      t = &tt;
-      memset(t, 0, sizeof(struct bgp_event_shut));
-      t->peer.s_addr = s->nexthop.s_addr;
-      t->type = (uint8_t)s->label;
-      t->subtype = (uint8_t)s->prefix.prefix.s_addr;
-      inet_ntop (AF_INET,&(t->peer), ip_str, ZRPC_UTIL_IPV6_LEN_MAX);
-      zrpc_bgp_updater_on_notification_send_event(ip_str, t->type, t->subtype);
+      pthread_mutex_destroy (&setup->vrf_lock[i]);
+      pthread_mutex_destroy (&setup->peer_lock[i]);
     }
-  capn_free(&rc);
-  if(client_ready == FALSE)
-    ctxt->bgp_update_lost_msgs++;
-  return;
+  pthread_mutex_destroy (&setup->bgp_get_routes_lock);
+  pthread_mutex_destroy (&setup->park_mutex);
+  pthread_mutex_destroy (&setup->park_lock);
+  pthread_cond_destroy (&setup->park_cond);
 }
 
-#define SBIN_DIR "/sbin"
+/* lock masks: one bit per lock of VRF or peer */
+uint64_t zrpc_vpnservice_vrf_lock_mask (struct zrpc_rd_prefix *rd)
+{
+  uint32_t h = zrpc_util_hash64 (zrpc_vpnservice_rd_key (rd));
 
-void zrpc_vpnservice_setup(struct zrpc_vpnservice *setup)
+  return 1ULL << (h % ZRPC_VPNSERVICE_LOCK_STRIPES);
+}
+
+uint64_t zrpc_vpnservice_vrf_lock_mask_str (const char *rd)
 {
-  char bgpd_location_path[128];
-  char *ptr = bgpd_location_path;
+  struct zrpc_rd_prefix rd_inst;
 
-  setup->zrpc_listen_port = ZRPC_LISTEN_PORT;
-  setup->zrpc_notification_port = ZRPC_NOTIFICATION_PORT;
-  setup->zmq_sock = ZRPC_STRDUP(ZMQ_SOCK);
-  setup->zmq_subscribe_sock = ZRPC_STRDUP(ZMQ_NOTIFY);
-  ptr+=sprintf(ptr, "%s", BGPD_PATH_QUAGGA);
-  ptr+=sprintf(ptr, "%s/bgpd",SBIN_DIR);
-  setup->bgpd_execution_path = ZRPC_STRDUP(bgpd_location_path);
+  memset (&rd_inst, 0, sizeof (struct zrpc_rd_prefix));
+  if (rd)
+    zrpc_util_str2rd_prefix ((char *)rd, &rd_inst);
+  return zrpc_vpnservice_vrf_lock_mask (&rd_inst);
 }
 
-void zrpc_vpnservice_terminate(struct zrpc_vpnservice *setup)
+uint64_t zrpc_vpnservice_peer_lock_mask (const char *peerIp)
 {
-  if(!setup)
-    return;
-  setup->zrpc_listen_port = 0;
-  setup->zrpc_notification_port = 0;
-  ZRPC_FREE(setup->zmq_sock);
-  setup->zmq_sock = NULL;
-  ZRPC_FREE(setup->zmq_subscribe_sock);
-  setup->zmq_subscribe_sock = NULL;
-  ZRPC_FREE(setup->bgpd_execution_path);
-  setup->bgpd_execution_path = NULL;
+  struct zrpc_vpnservice_peer_key key;
+
+  memset (&key, 0, sizeof (struct zrpc_vpnservice_peer_key));
+  if (peerIp)
+    zrpc_vpnservice_peer_key_set (&key, peerIp);
+  return 1ULL << (zrpc_vpnservice_peer_hash (&key) % ZRPC_VPNSERVICE_LOCK_STRIPES);
 }
 
-void zrpc_vpnservice_terminate_thrift_bgp_updater_client (struct zrpc_vpnservice *setup)
+void zrpc_vpnservice_lock_shared (struct zrpc_vpnservice *setup)
 {
-  if(!setup)
-    return;
-  if(setup->bgp_updater_client)
-    g_object_unref(setup->bgp_updater_client);
-  setup->bgp_updater_client = NULL;
-  if(setup->bgp_updater_protocol)
-    g_object_unref(setup->bgp_updater_protocol);
-  setup->bgp_updater_protocol = NULL;
-  if(setup->bgp_updater_transport)
-    g_object_unref(setup->bgp_updater_transport);
-  setup->bgp_updater_transport = NULL;
-  if(setup->bgp_updater_socket)
-    g_object_unref(setup->bgp_updater_socket);
-  setup->bgp_updater_socket = NULL;
+  pthread_rwlock_rdlock (&setup->bgp_lock);
 }
 
-void zrpc_vpnservice_terminate_qzc(struct zrpc_vpnservice *setup)
+void zrpc_vpnservice_unlock_shared (struct zrpc_vpnservice *setup)
 {
-  if(!setup)
-    return;
-  if(setup->qzc_subscribe_sock)
-    qzcclient_close (setup->qzc_subscribe_sock);
-  setup->qzc_subscribe_sock = NULL;
-  if(setup->qzc_sock)
-      qzcclient_close (setup->qzc_sock);
-  setup->qzc_sock = NULL;
+  pthread_rwlock_unlock (&setup->bgp_lock);
+}
 
-  qzmqclient_finish();
+/* several locks are always taken in the same order */
+static void zrpc_vpnservice_lock_mask (pthread_mutex_t *locks, uint64_t mask, int lock)
+{
+  int i;
+
+  for (i = 0; i < ZRPC_VPNSERVICE_LOCK_STRIPES; i++)
+    {
+      if (!(mask & (1ULL << i)))
+        continue;
+      if (lock)
+        pthread_mutex_lock (&locks[i]);
+      else
+        pthread_mutex_unlock (&locks[i]);
+    }
 }
 
-void zrpc_vpnservice_setup_qzc(struct zrpc_vpnservice *setup)
+void zrpc_vpnservice_lock_vrfs (struct zrpc_vpnservice *setup, uint64_t mask)
 {
-  qzcclient_init ();
-  if(setup->zmq_subscribe_sock && setup->qzc_subscribe_sock == NULL )
-    setup->qzc_subscribe_sock = qzcclient_subscribe(tm->global, \
-                                                    setup->zmq_subscribe_sock, \
-                                                    zrpc_vpnservice_callback);
+  zrpc_vpnservice_lock_mask (setup->vrf_lock, mask, 1);
 }
 
-void zrpc_vpnservice_terminate_bgp_context(struct zrpc_vpnservice *setup)
+void zrpc_vpnservice_unlock_vrfs (struct zrpc_vpnservice *setup, uint64_t mask)
 {
-  if(!setup->bgp_context)
-    return;
-  if(setup->bgp_context->proc)
+  zrpc_vpnservice_lock_mask (setup->vrf_lock, mask, 0);
+}
+
+void zrpc_vpnservice_lock_peers (struct zrpc_vpnservice *setup, uint64_t mask)
+{
+  zrpc_vpnservice_lock_mask (setup->peer_lock, mask, 1);
+}
+
+void zrpc_vpnservice_unlock_peers (struct zrpc_vpnservice *setup, uint64_t mask)
+{
+  zrpc_vpnservice_lock_mask (setup->peer_lock, mask, 0);
+}
+
+/* exclusive access. from a worker thread, main thread is parked first,
+ * so that thread master and main thread data may be changed */
+void zrpc_vpnservice_lock_all (struct zrpc_vpnservice *setup)
+{
+  if (!zrpc_vpnservice_main_thread (setup))
     {
-      zrpc_log ("sending SIGINT signal to Bgpd (%d)",setup->bgp_context->proc);
-      kill(setup->bgp_context->proc, SIGINT);
-      setup->bgp_context->proc = 0;
+      pthread_mutex_lock (&setup->park_mutex);
+      pthread_mutex_lock (&setup->park_lock);
+      setup->park_state = ZRPC_VPNSERVICE_PARK_REQUESTED;
+      if (write (setup->park_pipe[1], "", 1) < 0 && errno != EAGAIN)
+        zrpc_log ("main thread park request failed (%s)", strerror (errno));
+      while (setup->park_state != ZRPC_VPNSERVICE_PARKED)
+        pthread_cond_wait (&setup->park_cond, &setup->park_lock);
+      pthread_mutex_unlock (&setup->park_lock);
     }
-  if(setup->bgp_context)
+  pthread_rwlock_wrlock (&setup->bgp_lock);
+}
+
+void zrpc_vpnservice_unlock_all (struct zrpc_vpnservice *setup)
+{
+  pthread_rwlock_unlock (&setup->bgp_lock);
+  if (!zrpc_vpnservice_main_thread (setup))
     {
-      ZRPC_FREE(setup->bgp_context);
-      setup->bgp_context = NULL;
+      pthread_mutex_lock (&setup->park_lock);
+      setup->park_state = ZRPC_VPNSERVICE_RUNNING;
+      pthread_cond_broadcast (&setup->park_cond);
+      pthread_mutex_unlock (&setup->park_lock);
+      pthread_mutex_unlock (&setup->park_mutex);
     }
-  return;
 }
 
-void zrpc_vpnservice_setup_bgp_context(struct zrpc_vpnservice *setup)
+static time_t
+zrpc_vpnservice_monotime (void)
 {
-  setup->bgp_context=ZRPC_CALLOC( sizeof(struct zrpc_vpnservice_bgp_context));
+  struct timespec ts;
+
+  clock_gettime (CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec;
 }
 
-struct zrpc_vpnservice_bgp_context *zrpc_vpnservice_get_bgp_context(struct zrpc_vpnservice *setup)
+static void
+zrpc_vpnservice_get_routes_cursor_free (struct zrpc_vpnservice_get_routes_cursor *cursor)
 {
-  return setup->bgp_context;
+  if (cursor->vrf_rds)
+    ZRPC_FREE (cursor->vrf_rds);
+  ZRPC_FREE (cursor);
 }
 
-void zrpc_vpnservice_setup_bgp_cache(struct zrpc_vpnservice *ctxt)
+/* periodic job releasing cursors not used for a while */
+static int
+zrpc_vpnservice_get_routes_cursor_reap (struct thread *thread)
+{
+  struct zrpc_vpnservice *setup = THREAD_ARG (thread);
+  struct zrpc_vpnservice_get_routes_cursor *cursor, **prev;
+  time_t now = zrpc_vpnservice_monotime ();
+
+  setup->bgp_get_routes_reaper = NULL;
+  pthread_mutex_lock (&setup->bgp_get_routes_lock);
+  prev = &setup->bgp_get_routes_cursors;
+  while ((cursor = *prev) != NULL)
+    {
+      if (now - cursor->last_used < ZRPC_GET_ROUTES_CURSOR_TIMEOUT)
+        {
+          prev = &cursor->next;
+          continue;
+        }
+      if (IS_ZRPC_DEBUG_CACHE)
+        zrpc_log ("RTS: reaping idle cursor %p", cursor);
+      *prev = cursor->next;
+      zrpc_vpnservice_get_routes_cursor_free (cursor);
+    }
+  pthread_mutex_unlock (&setup->bgp_get_routes_lock);
+  zrpc_vpnservice_get_routes_cursor_reaper (setup);
+  return 0;
+}
+
+/* arm idle cursors reaper, if cursors are present. main thread only */
+void
+zrpc_vpnservice_get_routes_cursor_reaper (struct zrpc_vpnservice *setup)
 {
-  ctxt->bgp_vrf_list = NULL;
-  ctxt->bgp_peer_list = NULL;
+  if (setup->bgp_get_routes_reaper || setup->bgp_get_routes_cursors == NULL)
+    return;
+  THREAD_TIMER_ON (tm->global, setup->bgp_get_routes_reaper,
+                   zrpc_vpnservice_get_routes_cursor_reap,
+                   setup, ZRPC_GET_ROUTES_CURSOR_REAP_INTERVAL);
 }
 
-void zrpc_vpnservice_terminate_bgpvrf_cache (struct zrpc_vpnservice *setup)
+/* return cursor of a connection, and refresh its last use time.
+ * if create is set, a new cursor is allocated if none is found. */
+struct zrpc_vpnservice_get_routes_cursor *
+zrpc_vpnservice_get_routes_cursor_get (struct zrpc_vpnservice *setup,
+                                       struct zrpc_vpnservice_client *client, int create)
+{
+  struct zrpc_vpnservice_get_routes_cursor *cursor;
+
+  pthread_mutex_lock (&setup->bgp_get_routes_lock);
+  for (cursor = setup->bgp_get_routes_cursors; cursor; cursor = cursor->next)
+    if (cursor->client == client)
+      break;
+  if (cursor == NULL && create)
+    {
+      cursor = ZRPC_CALLOC (sizeof (struct zrpc_vpnservice_get_routes_cursor));
+      cursor->client = client;
+      cursor->next = setup->bgp_get_routes_cursors;
+      setup->bgp_get_routes_cursors = cursor;
+    }
+  if (cursor)
+    cursor->last_used = zrpc_vpnservice_monotime ();
+  pthread_mutex_unlock (&setup->bgp_get_routes_lock);
+  /* workers leave it to main thread, once request is done */
+  if (cursor && zrpc_vpnservice_main_thread (setup))
+    zrpc_vpnservice_get_routes_cursor_reaper (setup);
+  return cursor;
+}
+
+/* release cursor of a connection, if any */
+void zrpc_vpnservice_get_routes_cursor_del (struct zrpc_vpnservice *setup,
+                                            struct zrpc_vpnservice_client *client)
 {
-  struct zrpc_vpnservice_cache_bgpvrf *entry_bgpvrf, *entry_bgpvrf_next;
-  struct zrpc_vpnservice_cache_peer *entry_bgppeer, *entry_bgppeer_next;
+  struct zrpc_vpnservice_get_routes_cursor *cursor, **prev;
 
-  setup->bgp_vrf_list = NULL;
-  for (entry_bgpvrf = setup->bgp_vrf_list; entry_bgpvrf; entry_bgpvrf = entry_bgpvrf_next)
+  pthread_mutex_lock (&setup->bgp_get_routes_lock);
+  for (prev = &setup->bgp_get_routes_cursors; (cursor = *prev) != NULL; prev = &cursor->next)
     {
-      entry_bgpvrf_next = entry_bgpvrf->next;
-      ZRPC_FREE (entry_bgpvrf);
+      if (cursor->client != client)
+        continue;
+      *prev = cursor->next;
+      zrpc_vpnservice_get_routes_cursor_free (cursor);
+      break;
     }
+  pthread_mutex_unlock (&setup->bgp_get_routes_lock);
+  /* else reaper stops by itself */
+  if (setup->bgp_get_routes_cursors == NULL && zrpc_vpnservice_main_thread (setup))
+    THREAD_TIMER_OFF (setup->bgp_get_routes_reaper);
+}
 
-  setup->bgp_peer_list = NULL;
-  for (entry_bgppeer = setup->bgp_peer_list; entry_bgppeer; entry_bgppeer = entry_bgppeer_next)
+void zrpc_vpnservice_get_routes_cursor_flush (struct zrpc_vpnservice *setup)
+{
+  struct zrpc_vpnservice_get_routes_cursor *cursor, *cursor_next;
+
+  /* called by main thread, or with main thread parked */
+  pthread_mutex_lock (&setup->bgp_get_routes_lock);
+  for (cursor = setup->bgp_get_routes_cursors; cursor; cursor = cursor_next)
     {
-      entry_bgppeer_next = entry_bgppeer->next;
-      ZRPC_FREE (entry_bgppeer->peerIp);
-      ZRPC_FREE (entry_bgppeer);
+      cursor_next = cursor->next;
+      zrpc_vpnservice_get_routes_cursor_free (cursor);
     }
-  setup->bgp_peer_list = NULL;
+  setup->bgp_get_routes_cursors = NULL;
+  pthread_mutex_unlock (&setup->bgp_get_routes_lock);
+  THREAD_TIMER_OFF (setup->bgp_get_routes_reaper);
 }
 
-gboolean zrpc_vpnservice_setup_thrift_bgp_updater_client (struct zrpc_vpnservice *setup)
+/* create thrift contexts and connect to targets. run by notification
+ * thread */
+static void zrpc_vpnservice_updater_start (struct zrpc_vpnservice *setup)
 {
-  GError *error = NULL;
-  gboolean response;
+  struct zrpc_vpnservice_updater *updater;
+  unsigned int i;
 
-  if(!setup->bgp_updater_socket)
-    setup->bgp_updater_socket =
-      g_object_new (THRIFT_TYPE_SOCKET,
-                    "hostname",  tm->zrpc_notification_address,
-                    "port",      setup->zrpc_notification_port,
-                    NULL);
-  if(!setup->bgp_updater_transport)
-    setup->bgp_updater_transport =
-      g_object_new (THRIFT_TYPE_FRAMED_TRANSPORT,
-                    "transport", setup->bgp_updater_socket,
+  /* notifications are encoded once in memory, then the frame is
+   * written to each target transport */
+  if(!setup->bgp_updater_buffer)
+    setup->bgp_updater_buffer =
+      g_object_new (THRIFT_TYPE_MEMORY_BUFFER,
+                    "buf_size", ZRPC_NOTIF_FRAME_MAX_SIZE,
                     NULL);
   if(!setup->bgp_updater_protocol)
     setup->bgp_updater_protocol  =
-      g_object_new (THRIFT_TYPE_BINARY_PROTOCOL,
-                    "transport", setup->bgp_updater_transport,
-                    NULL);
+      zrpc_vpnservice_protocol_new (tm->notif_protocol,
+                                    setup->bgp_updater_buffer);
   if(!setup->bgp_updater_client)
     setup->bgp_updater_client = 
       g_object_new (TYPE_BGP_UPDATER_CLIENT,
                     "input_protocol",  setup->bgp_updater_protocol,
                     "output_protocol", setup->bgp_updater_protocol,
                     NULL);
-  response = thrift_transport_open (setup->bgp_updater_transport->transport, &error);
-  zrpc_transport_check_response(setup, response);
-  return response;
+  for (i = 0; i < setup->nb_updaters; i++)
+    {
+      updater = &setup->updaters[i];
+      if(!updater->socket)
+        updater->socket =
+          g_object_new (THRIFT_TYPE_SOCKET,
+                        "hostname",  updater->address,
+                        "port",      setup->zrpc_notification_port,
+                        NULL);
+      if(!updater->transport)
+        updater->transport =
+          g_object_new (THRIFT_TYPE_FRAMED_TRANSPORT,
+                        "transport", updater->socket,
+                        NULL);
+      /* connection goes on in background, unless already in progress */
+      if (!updater->job_in_progress)
+        zrpc_vpnservice_bgp_updater_connect (updater);
+    }
+}
+
+/* start notification thread, which connects to BgpUpdater targets.
+ * returns FALSE if it can not be started */
+gboolean zrpc_vpnservice_setup_thrift_bgp_updater_client (struct zrpc_vpnservice *setup)
+{
+  unsigned int i;
+  int ret;
+
+  if (setup->notif_thread_running)
+    return TRUE;
+  for (i = 0; i < setup->nb_updaters; i++)
+    if (zrpc_vpnservice_bgp_updater_resolve (&setup->updaters[i]) < 0)
+      zrpc_log ("bgpUpdater address %s can not be resolved, no notification sent to it",
+                setup->updaters[i].address);
+  ret = pthread_create (&setup->notif_thread, NULL,
+                        zrpc_vpnservice_notif_thread, setup);
+  if (ret != 0)
+    {
+      zrpc_log ("notification thread creation failed (%s)", strerror (ret));
+      return FALSE;
+    }
+  setup->notif_thread_running = 1;
+  return TRUE;
 }
 
 void zrpc_vpnservice_setup_thrift_bgp_configurator_server (struct zrpc_vpnservice *setup)
@@ -446,6 +2456,10 @@ void zrpc_vpnservice_terminate_client(struct zrpc_vpnservice_client *peer)
   g_object_unref(peer->transport_buffered);
   g_object_unref(peer->protocol);
   peer->protocol = NULL;
+  g_object_unref(peer->request_protocol);
+  peer->request_protocol = NULL;
+  g_object_unref(peer->request);
+  peer->request = NULL;
   g_object_unref(peer->simple_server);
   peer->simple_server = NULL;
   peer->server = NULL;
@@ -463,9 +2477,14 @@ void zrpc_vpnservice_setup_client(struct zrpc_vpnservice_client *peer,
                   "transport", transport,
                   NULL);
   peer->protocol =
-    g_object_new (THRIFT_TYPE_BINARY_PROTOCOL,
-                  "transport", peer->transport_buffered,
-                  NULL);
+    zrpc_vpnservice_protocol_new (tm->configurator_protocol,
+                                  peer->transport_buffered);
+  /* requests are read by zrpcd, replies written on socket */
+  peer->request = g_object_new (ZRPC_TYPE_REQUEST_BUFFER, NULL);
+  peer->request->max_size = tm->request_max_size;
+  peer->request_protocol =
+    zrpc_vpnservice_protocol_new (tm->configurator_protocol,
+                                  THRIFT_TRANSPORT (peer->request));
   /* Create the server itself */
   peer->simple_server =
     g_object_new (THRIFT_TYPE_SIMPLE_SERVER,
@@ -475,3 +2494,34 @@ void zrpc_vpnservice_setup_client(struct zrpc_vpnservice_client *peer,
     peer->server = &(peer->simple_server->parent);
   return;
 }
+
+/* return protocol id of name, -1 if unknown or not supported */
+int zrpc_vpnservice_protocol_get (const char *name)
+{
+  if (strcmp (name, "binary") == 0)
+    return ZRPC_PROTOCOL_BINARY;
+#ifdef HAVE_THRIFT_COMPACT_PROTOCOL
+  if (strcmp (name, "compact") == 0)
+    return ZRPC_PROTOCOL_COMPACT;
+#endif
+  return -1;
+}
+
+const char *zrpc_vpnservice_protocol_name (int protocol)
+{
+  return protocol == ZRPC_PROTOCOL_COMPACT ? "compact" : "binary";
+}
+
+/* thrift protocol over transport */
+ThriftProtocol *zrpc_vpnservice_protocol_new (int protocol, gpointer transport)
+{
+#ifdef HAVE_THRIFT_COMPACT_PROTOCOL
+  if (protocol == ZRPC_PROTOCOL_COMPACT)
+    return g_object_new (THRIFT_TYPE_COMPACT_PROTOCOL,
+                         "transport", transport,
+                         NULL);
+#endif
+  return g_object_new (THRIFT_TYPE_BINARY_PROTOCOL,
+                       "transport", transport,
+                       NULL);
+}
@@ -8,8 +8,11 @@
 #ifndef _ZRPC_VPNSERVICE_H
 #define _ZRPC_VPNSERVICE_H
 
+#include <pthread.h>
 #include "zrpcd/zrpc_os_wrapper.h"
 #include "zrpcd/zrpc_util.h"
+#include "zrpcd/zrpc_rib.h"
+#include "zrpcd/zrpc_journal.h"
 
 #define ZRPC_LISTEN_PORT	 7644
 #define ZRPC_NOTIFICATION_PORT 6644
@@ -37,6 +40,9 @@ struct zrpc_vpnservice_client
   ThriftProtocol *protocol;
   ThriftServer *server;
   ThriftSimpleServer *simple_server;
+  /* bytes received, decoded once a whole request is there */
+  struct _ZrpcRequestBuffer *request;
+  ThriftProtocol *request_protocol;
 };
 
 struct zrpc_vpnservice_bgp_context
@@ -46,21 +52,295 @@ struct zrpc_vpnservice_bgp_context
 };
 
 /* zrpc cache contexts */
+/*
+ * routes successfully pushed to bgpd through zrpcd, so that pushing
+ * them again is answered without asking bgpd. entries are kept densely,
+ * indexed on the prefix.
+ */
+struct zrpc_vpnservice_pushed_route
+{
+  uint64_t key;
+  struct in_addr nexthop;
+  uint32_t label;
+};
+
+struct zrpc_vpnservice_pushed_table
+{
+  struct zrpc_vpnservice_pushed_route *entries;
+  struct zrpc_util_index index;
+  uint32_t count;
+};
+
 struct zrpc_vpnservice_cache_bgpvrf
 {
+  uint64_t rd_key;
   uint64_t bgpvrf_nid;
   struct zrpc_rd_prefix outbound_rd;
-  struct zrpc_vpnservice_cache_bgpvrf *next;
+  /* mirror of the vrf routes */
+  struct zrpc_rib *rib;
+  struct zrpc_vpnservice_pushed_table pushed;
+  /* route targets and maximum paths set through zrpcd, compared by
+   * applyConfig. rts holds nb_irts import then nb_erts export
+   * values, each list sorted */
+  uint64_t *rts;
+  uint32_t nb_irts;
+  uint32_t nb_erts;
+  int32_t max_path;
+};
+
+/*
+ * VRF cache. entries are kept densely in the entries array, indexed on
+ * the route distinguisher packed in 64 bits. entry pointers are only
+ * valid until next add or delete.
+ */
+struct zrpc_vpnservice_vrf_table
+{
+  struct zrpc_vpnservice_cache_bgpvrf *entries;
+  struct zrpc_util_index index;
+  uint32_t count;
+};
+
+/* peer address in binary form, used as peer cache key */
+struct zrpc_vpnservice_peer_key
+{
+  uint8_t family;
+  uint8_t addr[16];
 };
 
 struct zrpc_vpnservice_cache_peer
 {
+  struct zrpc_vpnservice_peer_key key;
   uint64_t peer_nid;
   uint32_t asNumber;
-  char *peerIp;
-  struct zrpc_vpnservice_cache_peer *next;
+  /* attributes set through zrpcd, compared by applyConfig. family
+   * of update_source is 0 when unset */
+  int32_t multihop;
+  struct zrpc_vpnservice_peer_key update_source;
+  uint8_t vpnv4;
+};
+
+/*
+ * peer cache. same layout as VRF cache, keyed on peer address.
+ */
+struct zrpc_vpnservice_peer_table
+{
+  struct zrpc_vpnservice_cache_peer *entries;
+  struct zrpc_util_index index;
+  uint32_t count;
+};
+
+/*
+ * getRoutes iteration state. one cursor per configurator connection,
+ * so that several route dumps can run in parallel.
+ */
+struct zrpc_vpnservice_get_routes_cursor
+{
+  /* owner connection */
+  struct zrpc_vpnservice_client *client;
+
+  /* route distinguishers of VRF cache taken at GET_RTS_INIT */
+  struct zrpc_rd_prefix *vrf_rds;
+  uint32_t vrf_count;
+  uint32_t vrf_index;
+
+  /* position in the current VRF table */
+  struct zrpc_ipv4_prefix table_prefix;
+  int table_valid;
+  /* current VRF is read from the mirror RIB, not from bgpd */
+  int table_from_rib;
+
+  /* monotonic time of last use, in seconds */
+  time_t last_used;
+
+  struct zrpc_vpnservice_get_routes_cursor *next;
+};
+
+/* notification relayed from bgpd to the BgpUpdater client */
+struct zrpc_vpnservice_notif
+{
+#define ZRPC_NOTIF_PUSH_ROUTE      1
+#define ZRPC_NOTIF_WITHDRAW_ROUTE  2
+#define ZRPC_NOTIF_SEND_EVENT      3
+/* not a notification: queued ones are dropped and resync is sent */
+#define ZRPC_NOTIF_RESYNC          4
+  uint8_t type;
+  uint8_t prefixlen;
+  uint8_t err_code;
+  uint8_t err_subcode;
+  uint32_t label;
+  struct in_addr prefix;
+  /* nexthop, or peer address for send event */
+  struct in_addr nexthop;
+  struct zrpc_rd_prefix rd;
+  /* enqueue time in ms, used by coalescing */
+  uint64_t stamp;
+  /* event id given when decoded. notifications with same id have the
+   * same content, whatever the target */
+  uint64_t id;
+};
+
+/*
+ * bounded FIFO of notifications. the bgpd subscriber only decodes
+ * and enqueues; a writer job drains the queue to the BgpUpdater
+ * socket, as long as the socket is writable.
+ */
+struct zrpc_vpnservice_notif_queue
+{
+  struct zrpc_vpnservice_notif *ring;
+  /* ring size, power of 2. head and tail are free running */
+  uint32_t size;
+  uint32_t head;
+  uint32_t tail;
+
+  /* coalescing index of queued route notifications on rd, prefix
+   * and prefixlen, 2 * size slots. no slots if coalescing is
+   * disabled */
+  struct zrpc_util_index index;
+
+  /* overflow of the ring, NULL if not configured. notifications in
+   * journal are newer than those in ring */
+  struct zrpc_journal *journal;
+  /* set when notifications were lost: controller has to resync */
+  int resync;
+
+  /* last sent route notifications, indexed by sequence number, for
+   * resumeNotifications. NULL if retention is disabled */
+  struct zrpc_vpnservice_notif *retained;
+  uint32_t retain_size;
+  uint32_t nb_retained;
+  /* sequence number of next route notification sent */
+  uint64_t next_seq;
+  /* next retained notification to send again, next_seq if none */
+  uint64_t replay_seq;
+
+  /* statistics */
+  uint32_t high_water;
+  uint64_t enqueued;
+  uint64_t sent;
+  uint64_t batches;
+  uint64_t drops;
+  uint64_t coalesced;
+  uint64_t journaled;
+  uint32_t journal_high_water;
+  uint32_t overflows;
+  uint32_t resyncs;
+  uint32_t resumes;
+  uint64_t replayed;
+};
+
+#define ZRPC_NOTIF_QUEUE_DEFAULT_SIZE 32768
+/* max notifications written per writer job run */
+#define ZRPC_NOTIF_WRITE_BURST 256
+#define ZRPC_NOTIF_JOURNAL_DEFAULT_SIZE (1 << 20)
+/* default time routes wait for their batch to fill up, in us */
+#define ZRPC_NOTIF_BATCH_DEFAULT_DELAY 1000
+
+/*
+ * notification message encoded for a target, kept so that other
+ * targets write the same frame instead of encoding it again
+ */
+struct zrpc_vpnservice_frame
+{
+  /* id of first notification, 0 if unused */
+  uint64_t id;
+  /* sequence number of first notification, 0 if none */
+  uint64_t seq;
+  uint32_t count;
+  GByteArray *data;
+};
+
+/*
+ * single producer, single consumer ring handing decoded notifications
+ * over from main thread to notification thread. tail is only written
+ * by producer, head by consumer
+ */
+struct zrpc_vpnservice_notif_ring
+{
+  struct zrpc_vpnservice_notif *ring;
+  uint32_t size;
+  uint32_t head __attribute__ ((aligned (64)));
+  uint32_t tail __attribute__ ((aligned (64)));
+  /* producer wrote to wake up pipe, and consumer did not run yet */
+  int wakeup;
+  /* notifications lost because ring was full, and number already
+   * handled by consumer */
+  uint32_t drops;
+  uint32_t drops_seen;
+  uint32_t high_water;
+};
+
+#define ZRPC_NOTIF_FRAME_CACHE_SIZE 64
+#define ZRPC_NOTIF_FRAME_MAX_SIZE (16 << 20)
+
+/*
+ * BgpUpdater client notifications are sent to. each target has its
+ * own connection and queue, so that a slow standby controller never
+ * delays the active one.
+ */
+/* BgpUpdater target given as an absolute path is a unix socket */
+#define ZRPC_ADDRESS_IS_PATH(address) ((address)[0] == '/')
+
+struct zrpc_vpnservice_updater
+{
+  struct zrpc_vpnservice *setup;
+  char *address;
+  /* address resolved when notification thread starts, addrlen is 0
+   * if it could not be */
+  struct sockaddr_storage addr;
+  socklen_t addrlen;
+
+  ThriftSocket *socket;
+  ThriftFramedTransport *transport;
+  /* connection status, as last checked */
+  gboolean status;
+  /* connection is watched by read_thread, or retry or connect job is
+   * pending on client_thread */
+  int job_in_progress;
+  struct thread *client_thread;
+  struct thread *read_thread;
+  struct thread *write_thread;
+  struct thread *batch_timer;
+  /* pending non blocking connect */
+  struct thread *connect_thread;
+  int connect_fd;
+  /* current reconnection backoff, in ms */
+  unsigned int backoff;
+
+  /* notifications waiting to be sent */
+  struct zrpc_vpnservice_notif_queue notif_queue;
+
+  /* statistics */
+  u_int32_t lost_msgs;
+  u_int32_t monitor;
+  u_int32_t retries;
+  uint64_t frames_shared;
 };
 
+/* thrift protocols, for configurator server and updater client */
+#define ZRPC_PROTOCOL_BINARY  0
+#define ZRPC_PROTOCOL_COMPACT 1
+
+/* BgpUpdater reconnection backoff bounds, and connect timeout, in ms */
+#define ZRPC_UPDATER_BACKOFF_MIN 1000
+#define ZRPC_UPDATER_BACKOFF_MAX 30000
+#define ZRPC_UPDATER_CONNECT_TIMEOUT 5000
+/* longest a send to BgpUpdater target may block, in ms */
+#define ZRPC_UPDATER_SEND_TIMEOUT 1000
+/* keepalive probes sent before connection is declared dead */
+#define ZRPC_UPDATER_KEEPALIVE_PROBES 3
+
+/* idle cursors are reaped after that many seconds */
+#define ZRPC_GET_ROUTES_CURSOR_TIMEOUT 300
+#define ZRPC_GET_ROUTES_CURSOR_REAP_INTERVAL 60
+
+/* number of locks VRFs, and peers, are spread on */
+#define ZRPC_VPNSERVICE_LOCK_STRIPES 64
+
+/* main thread park_state */
+#define ZRPC_VPNSERVICE_RUNNING        0
+#define ZRPC_VPNSERVICE_PARK_REQUESTED 1
+#define ZRPC_VPNSERVICE_PARKED         2
+
 struct zrpc_vpnservice
 {
   /* configuration part */
@@ -75,12 +355,37 @@ struct zrpc_vpnservice
   BgpConfiguratorProcessor *bgp_configurator_processor;
   InstanceBgpConfiguratorHandler *bgp_configurator_handler;
 
-  /* zrpc Update Contexts */
+  /* zrpc Update Contexts. notifications are encoded in memory
+   * buffer, then written to every target */
   BgpUpdaterIf *bgp_updater_client;
-  struct thread *bgp_updater_client_thread;
-  ThriftSocket *bgp_updater_socket;
-  ThriftFramedTransport *bgp_updater_transport;
+  ThriftMemoryBuffer *bgp_updater_buffer;
   ThriftProtocol *bgp_updater_protocol;
+  struct zrpc_vpnservice_frame *bgp_updater_frames;
+
+  /* notification targets */
+  struct zrpc_vpnservice_updater *updaters;
+  unsigned int nb_updaters;
+  /* id of last decoded notification */
+  uint64_t notif_last_id;
+
+  /* notification thread. bgpd notifications are decoded by main
+   * thread, and handed over through notif_ring. targets, and thrift
+   * contexts above, are only used by notification thread */
+  pthread_t notif_thread;
+  int notif_thread_running;
+  int notif_stop;
+  struct thread_master *notif_master;
+  struct thread *notif_wakeup_thread;
+  int notif_pipe[2];
+  struct zrpc_vpnservice_notif_ring notif_ring;
+  /* pending resumeNotifications request */
+  pthread_mutex_t notif_mutex;
+  pthread_cond_t notif_cond;
+  int notif_resume_pending;
+  int notif_resume_busy;
+  int notif_resume_fd;
+  uint64_t notif_resume_seq;
+  int notif_resume_ret;
 
   /* bgp context */
   struct zrpc_vpnservice_bgp_context *bgp_context;
@@ -99,14 +404,34 @@ struct zrpc_vpnservice
   struct qzcclient_sock *qzc_subscribe_sock;
   
   /* zrpc cache context for VRF */
-  struct zrpc_vpnservice_cache_bgpvrf *bgp_vrf_list;
-  struct zrpc_vpnservice_cache_peer *bgp_peer_list;
-  struct zrpc_vpnservice_cache_bgpvrf *bgp_get_routes_list;
+  struct zrpc_vpnservice_vrf_table bgp_vrf_table;
+  struct zrpc_vpnservice_peer_table bgp_peer_table;
+
+  /* configurator handlers may run on worker threads. they hold
+   * bgp_lock shared, and the lock of the VRF or peer they apply to.
+   * handlers changing bgp instance, VRF or peer tables hold bgp_lock
+   * exclusive, with main thread parked */
+  pthread_rwlock_t bgp_lock;
+  pthread_mutex_t vrf_lock[ZRPC_VPNSERVICE_LOCK_STRIPES];
+  pthread_mutex_t peer_lock[ZRPC_VPNSERVICE_LOCK_STRIPES];
+  pthread_t main_thread;
+  /* main thread parking: one exclusive handler at a time */
+  pthread_mutex_t park_mutex;
+  pthread_mutex_t park_lock;
+  pthread_cond_t park_cond;
+  int park_state;
+  int park_pipe[2];
+  struct thread *park_thread;
+
+  /* getRoutes cursors, and idle cursors reaper */
+  pthread_mutex_t bgp_get_routes_lock;
+  struct zrpc_vpnservice_get_routes_cursor *bgp_get_routes_cursors;
+  struct thread *bgp_get_routes_reaper;
+  /* bulk route iteration support by bgpd:
+   * 0 not probed yet, 1 supported, -1 not supported */
+  int bgp_get_routes_bulk;
 
   /* bgp updater statistics */
-  u_int32_t bgp_update_lost_msgs;
-  u_int32_t bgp_update_monitor;
-  u_int32_t bgp_update_retries;
   u_int32_t bgp_update_total;
 };
 
@@ -136,4 +461,72 @@ struct zrpc_vpnservice_bgp_context *zrpc_vpnservice_get_bgp_context(struct zrpc_
 void zrpc_vpnservice_setup_bgp_context(struct zrpc_vpnservice *setup);
 void zrpc_vpnservice_terminate_bgp_context(struct zrpc_vpnservice *setup);
 void zrpc_vpnservice_terminate_bgpvrf_cache (struct zrpc_vpnservice *setup);
+struct zrpc_vpnservice_cache_bgpvrf *
+zrpc_vpnservice_vrf_lookup (struct zrpc_vpnservice *setup, struct zrpc_rd_prefix *rd);
+struct zrpc_vpnservice_cache_bgpvrf *
+zrpc_vpnservice_vrf_add (struct zrpc_vpnservice *setup, struct zrpc_rd_prefix *rd,
+                         uint64_t bgpvrf_nid);
+int zrpc_vpnservice_vrf_del (struct zrpc_vpnservice *setup, struct zrpc_rd_prefix *rd);
+int zrpc_vpnservice_pushed_lookup (struct zrpc_vpnservice_cache_bgpvrf *vrf,
+                                   const struct zrpc_ipv4_prefix *p,
+                                   struct in_addr nexthop, uint32_t label);
+void zrpc_vpnservice_pushed_add (struct zrpc_vpnservice_cache_bgpvrf *vrf,
+                                 const struct zrpc_ipv4_prefix *p,
+                                 struct in_addr nexthop, uint32_t label);
+void zrpc_vpnservice_pushed_del (struct zrpc_vpnservice_cache_bgpvrf *vrf,
+                                 const struct zrpc_ipv4_prefix *p);
+void zrpc_vpnservice_pushed_flush (struct zrpc_vpnservice_cache_bgpvrf *vrf);
+uint64_t zrpc_vpnservice_rd_key (struct zrpc_rd_prefix *rd);
+uint64_t zrpc_vpnservice_pushed_key (const struct zrpc_ipv4_prefix *p);
+void zrpc_vpnservice_pushed_prefix (uint64_t key, struct zrpc_ipv4_prefix *p);
+void zrpc_vpnservice_vrf_set_rts (struct zrpc_vpnservice_cache_bgpvrf *vrf, uint64_t *rts,
+                                  uint32_t nb_irts, uint32_t nb_erts);
+int zrpc_vpnservice_vrf_same_rts (struct zrpc_vpnservice_cache_bgpvrf *vrf, const uint64_t *rts,
+                                  uint32_t nb_irts, uint32_t nb_erts);
+int zrpc_vpnservice_peer_key_set (struct zrpc_vpnservice_peer_key *key, const char *peerIp);
+struct zrpc_vpnservice_cache_peer *
+zrpc_vpnservice_peer_lookup (struct zrpc_vpnservice *setup, struct zrpc_vpnservice_peer_key *key);
+struct zrpc_vpnservice_cache_peer *
+zrpc_vpnservice_peer_add (struct zrpc_vpnservice *setup, struct zrpc_vpnservice_peer_key *key,
+                          uint64_t peer_nid, uint32_t asNumber);
+int zrpc_vpnservice_peer_del (struct zrpc_vpnservice *setup, struct zrpc_vpnservice_peer_key *key);
+struct zrpc_vpnservice_get_routes_cursor *
+zrpc_vpnservice_get_routes_cursor_get (struct zrpc_vpnservice *setup,
+                                       struct zrpc_vpnservice_client *client, int create);
+void zrpc_vpnservice_get_routes_cursor_del (struct zrpc_vpnservice *setup,
+                                            struct zrpc_vpnservice_client *client);
+void zrpc_vpnservice_get_routes_cursor_flush (struct zrpc_vpnservice *setup);
+void zrpc_vpnservice_get_routes_cursor_reaper (struct zrpc_vpnservice *setup);
+void zrpc_vpnservice_set_client (struct zrpc_vpnservice_client *client);
+struct zrpc_vpnservice_client *zrpc_vpnservice_get_client (void);
+int zrpc_vpnservice_main_thread (struct zrpc_vpnservice *setup);
+uint64_t zrpc_vpnservice_vrf_lock_mask (struct zrpc_rd_prefix *rd);
+uint64_t zrpc_vpnservice_vrf_lock_mask_str (const char *rd);
+uint64_t zrpc_vpnservice_peer_lock_mask (const char *peerIp);
+void zrpc_vpnservice_lock_shared (struct zrpc_vpnservice *setup);
+void zrpc_vpnservice_unlock_shared (struct zrpc_vpnservice *setup);
+void zrpc_vpnservice_lock_vrfs (struct zrpc_vpnservice *setup, uint64_t mask);
+void zrpc_vpnservice_unlock_vrfs (struct zrpc_vpnservice *setup, uint64_t mask);
+void zrpc_vpnservice_lock_peers (struct zrpc_vpnservice *setup, uint64_t mask);
+void zrpc_vpnservice_unlock_peers (struct zrpc_vpnservice *setup, uint64_t mask);
+void zrpc_vpnservice_lock_all (struct zrpc_vpnservice *setup);
+void zrpc_vpnservice_unlock_all (struct zrpc_vpnservice *setup);
+void zrpc_vpnservice_park_serve (struct zrpc_vpnservice *setup);
+void zrpc_vpnservice_park_wait (struct zrpc_vpnservice *setup, int fd);
+int zrpc_vpnservice_notif_enqueue (struct zrpc_vpnservice *setup,
+                                   struct zrpc_vpnservice_notif *notif);
+void zrpc_vpnservice_notif_queue_init (struct zrpc_vpnservice_notif_queue *queue,
+                                       uint32_t size, uint32_t retention, int coalesce);
+void zrpc_vpnservice_notif_queue_free (struct zrpc_vpnservice_notif_queue *queue);
+int zrpc_vpnservice_notif_push (struct zrpc_vpnservice_notif_queue *queue,
+                                struct zrpc_vpnservice_notif *notif);
+void zrpc_vpnservice_notif_sent (struct zrpc_vpnservice_notif_queue *queue,
+                                 uint32_t sent);
+int zrpc_vpnservice_notif_replay_from (struct zrpc_vpnservice_notif_queue *queue,
+                                       uint64_t from_seq);
+int zrpc_vpnservice_notif_resume (struct zrpc_vpnservice *setup, uint64_t from_seq);
+void zrpc_vpnservice_notif_resync (struct zrpc_vpnservice *setup);
+int zrpc_vpnservice_protocol_get (const char *name);
+const char *zrpc_vpnservice_protocol_name (int protocol);
+ThriftProtocol *zrpc_vpnservice_protocol_new (int protocol, gpointer transport);
 #endif /* _ZRPC_VPNSERVICE_H */
@@ -0,0 +1,238 @@
+/* zrpc notification queue test
+ * Copyright (c) 2016 6WIND,
+ *
+ * This file is part of ZRPC daemon.
+ *
+ * See the LICENSE file.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+#include "zrpcd/zrpc_thrift_wrapper.h"
+#include "zrpcd/bgp_configurator.h"
+#include "zrpcd/bgp_updater.h"
+#include "zrpcd/zrpc_bgp_configurator.h"
+#include "zrpcd/zrpc_vpnservice.h"
+#include "zrpcd/zrpc_util.h"
+
+#define ZRPC_VPNSERVICE_TEST_QUEUE_SIZE 64
+#define ZRPC_VPNSERVICE_TEST_RETENTION  16
+#define ZRPC_VPNSERVICE_TEST_ROUNDS     100000
+
+/* reference model: queued notifications, oldest first */
+static struct zrpc_vpnservice_notif model[ZRPC_VPNSERVICE_TEST_QUEUE_SIZE];
+static uint32_t nb_model;
+static uint64_t last_id;
+
+/* ids of sent route notifications, by sequence number */
+static uint64_t history[ZRPC_VPNSERVICE_TEST_ROUNDS + 1];
+static uint64_t nb_history;
+
+/* few rds, prefixes and nexthops, so that notifications often have
+ * the same key */
+static void
+zrpc_vpnservice_test_notif (struct zrpc_vpnservice_notif *notif)
+{
+  memset (notif, 0, sizeof (struct zrpc_vpnservice_notif));
+  notif->type = rand () % 10 == 0 ? ZRPC_NOTIF_SEND_EVENT :
+    (rand () % 2 ? ZRPC_NOTIF_PUSH_ROUTE : ZRPC_NOTIF_WITHDRAW_ROUTE);
+  notif->rd.family = AF_UNSPEC;
+  notif->rd.prefixlen = 64;
+  notif->rd.val[7] = rand () % 2;
+  notif->prefix.s_addr = htonl (0x0a000000 | ((rand () % 4) << 8));
+  notif->prefixlen = rand () % 2 ? 24 : 32;
+  notif->nexthop.s_addr = htonl (0xc0a80001 + rand () % 2);
+  notif->label = rand () % 1000;
+  notif->id = ++last_id;
+}
+
+static int
+zrpc_vpnservice_test_same_key (struct zrpc_vpnservice_notif *notif1,
+                               struct zrpc_vpnservice_notif *notif2)
+{
+  return notif1->prefixlen == notif2->prefixlen &&
+    notif1->prefix.s_addr == notif2->prefix.s_addr &&
+    memcmp (notif1->rd.val, notif2->rd.val, sizeof (notif1->rd.val)) == 0;
+}
+
+/* push to queue and model. a route notification is merged into the
+ * newest queued one for the same key, if it has the same nexthop */
+static void
+zrpc_vpnservice_test_push (struct zrpc_vpnservice_notif_queue *queue,
+                           struct zrpc_vpnservice_notif *notif, int coalesce)
+{
+  uint64_t coalesced = queue->coalesced;
+  int i, ret;
+
+  ret = zrpc_vpnservice_notif_push (queue, notif);
+  for (i = nb_model - 1; coalesce && notif->type != ZRPC_NOTIF_SEND_EVENT && i >= 0; i--)
+    if (model[i].type != ZRPC_NOTIF_SEND_EVENT &&
+        zrpc_vpnservice_test_same_key (&model[i], notif))
+      break;
+  if (coalesce && notif->type != ZRPC_NOTIF_SEND_EVENT && i >= 0 &&
+      model[i].nexthop.s_addr == notif->nexthop.s_addr)
+    {
+      assert (ret == 1);
+      assert (queue->coalesced == coalesced + 1);
+      model[i].type = notif->type;
+      model[i].label = notif->label;
+      model[i].id = notif->id;
+      return;
+    }
+  assert (queue->coalesced == coalesced);
+  if (nb_model == ZRPC_VPNSERVICE_TEST_QUEUE_SIZE)
+    {
+      assert (ret == 0);
+      return;
+    }
+  assert (ret == 1);
+  model[nb_model++] = *notif;
+}
+
+/* send notifications at head of queue */
+static void
+zrpc_vpnservice_test_send (struct zrpc_vpnservice_notif_queue *queue, uint32_t sent)
+{
+  uint32_t i;
+
+  for (i = 0; i < sent; i++)
+    if (model[i].type != ZRPC_NOTIF_SEND_EVENT)
+      history[++nb_history] = model[i].id;
+  zrpc_vpnservice_notif_sent (queue, sent);
+  memmove (model, model + sent, (nb_model - sent) * sizeof (struct zrpc_vpnservice_notif));
+  nb_model -= sent;
+}
+
+static void
+zrpc_vpnservice_test_check (struct zrpc_vpnservice_notif_queue *queue)
+{
+  struct zrpc_vpnservice_notif *notif;
+  uint32_t i;
+
+  assert (queue->tail - queue->head == nb_model);
+  for (i = 0; i < nb_model; i++)
+    {
+      notif = &queue->ring[(queue->head + i) & (queue->size - 1)];
+      assert (notif->type == model[i].type);
+      assert (notif->id == model[i].id);
+      assert (notif->label == model[i].label);
+      assert (notif->nexthop.s_addr == model[i].nexthop.s_addr);
+      assert (zrpc_vpnservice_test_same_key (notif, &model[i]));
+    }
+}
+
+static void
+zrpc_vpnservice_test_coalesce (int coalesce)
+{
+  struct zrpc_vpnservice_notif_queue queue;
+  struct zrpc_vpnservice_notif notif;
+  int n;
+
+  nb_model = 0;
+  nb_history = 0;
+  zrpc_vpnservice_notif_queue_init (&queue, ZRPC_VPNSERVICE_TEST_QUEUE_SIZE, 0, coalesce);
+  assert (!queue.index.slots == !coalesce);
+  for (n = 0; n < ZRPC_VPNSERVICE_TEST_ROUNDS; n++)
+    {
+      /* fill up, then drain, so that queue is often full */
+      if (rand () % 8 < ((n / 1000) % 2 ? 7 : 2))
+        {
+          zrpc_vpnservice_test_notif (&notif);
+          zrpc_vpnservice_test_push (&queue, &notif, coalesce);
+        }
+      else if (nb_model)
+        zrpc_vpnservice_test_send (&queue, 1 + rand () % (nb_model < 4 ? nb_model : 4));
+      zrpc_vpnservice_test_check (&queue);
+    }
+  assert (coalesce || queue.coalesced == 0);
+  zrpc_vpnservice_notif_queue_free (&queue);
+}
+
+/* resume from from_seq: notifications still retained are sent again,
+ * in sequence order */
+static void
+zrpc_vpnservice_test_replay (struct zrpc_vpnservice_notif_queue *queue, uint64_t from_seq)
+{
+  uint64_t seq, oldest;
+  int ret;
+
+  ret = zrpc_vpnservice_notif_replay_from (queue, from_seq);
+  oldest = nb_history + 1 > ZRPC_VPNSERVICE_TEST_RETENTION ?
+    nb_history + 1 - ZRPC_VPNSERVICE_TEST_RETENTION : 1;
+  assert (queue->next_seq == nb_history + 1);
+  if (from_seq > queue->next_seq)
+    {
+      assert (ret == BGP_ERR_PARAM);
+      return;
+    }
+  if (from_seq < oldest)
+    {
+      assert (ret == BGP_ERR_RESYNC);
+      return;
+    }
+  assert (ret == 0);
+  assert (queue->replay_seq == from_seq);
+  for (seq = queue->replay_seq; seq != queue->next_seq; seq++)
+    assert (queue->retained[seq & (queue->retain_size - 1)].id == history[seq]);
+  /* replay is over */
+  queue->replay_seq = queue->next_seq;
+}
+
+static void
+zrpc_vpnservice_test_resume (void)
+{
+  struct zrpc_vpnservice_notif_queue queue;
+  struct zrpc_vpnservice_notif notif;
+  uint64_t from_seq;
+  int n;
+
+  nb_model = 0;
+  nb_history = 0;
+  /* without retention, controller has to resync */
+  zrpc_vpnservice_notif_queue_init (&queue, ZRPC_VPNSERVICE_TEST_QUEUE_SIZE, 0, 0);
+  assert (zrpc_vpnservice_notif_replay_from (&queue, 1) == BGP_ERR_RESYNC);
+  zrpc_vpnservice_notif_queue_free (&queue);
+
+  zrpc_vpnservice_notif_queue_init (&queue, ZRPC_VPNSERVICE_TEST_QUEUE_SIZE,
+                                    ZRPC_VPNSERVICE_TEST_RETENTION, 0);
+  assert (queue.retain_size == ZRPC_VPNSERVICE_TEST_RETENTION);
+  /* nothing sent yet: resuming from first sequence number is fine */
+  assert (zrpc_vpnservice_notif_replay_from (&queue, 1) == 0);
+  assert (zrpc_vpnservice_notif_replay_from (&queue, 2) == BGP_ERR_PARAM);
+  for (n = 0; n < ZRPC_VPNSERVICE_TEST_ROUNDS; n++)
+    {
+      if (rand () % 2)
+        {
+          zrpc_vpnservice_test_notif (&notif);
+          zrpc_vpnservice_test_push (&queue, &notif, 0);
+        }
+      else if (nb_model)
+        zrpc_vpnservice_test_send (&queue, 1 + rand () % (nb_model < 4 ? nb_model : 4));
+      if (rand () % 4 == 0)
+        {
+          from_seq = nb_history + 2 > ZRPC_VPNSERVICE_TEST_RETENTION + 2 ?
+            nb_history + 2 - ZRPC_VPNSERVICE_TEST_RETENTION - 2 : 0;
+          from_seq += rand () % (ZRPC_VPNSERVICE_TEST_RETENTION + 4);
+          zrpc_vpnservice_test_replay (&queue, from_seq);
+        }
+    }
+  assert (queue.resumes > 0);
+  /* once notifications are lost, retained ones can not be resumed from */
+  queue.resync = 1;
+  assert (zrpc_vpnservice_notif_replay_from (&queue, queue.next_seq) == BGP_ERR_RESYNC);
+  zrpc_vpnservice_notif_queue_free (&queue);
+}
+
+int
+main (int argc, char **argv)
+{
+  srand (argc > 1 ? atoi (argv[1]) : 1);
+  zrpc_vpnservice_test_coalesce (0);
+  zrpc_vpnservice_test_coalesce (1);
+  zrpc_vpnservice_test_resume ();
+  printf ("zrpc_vpnservice_test: ok\n");
+  return 0;
+}
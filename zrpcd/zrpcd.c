@@ -12,9 +12,11 @@
 #include "zrpcd/bgp_updater.h"
 #include "zrpcd/zrpc_bgp_configurator.h"
 #include "zrpcd/zrpc_vpnservice.h"
+#include "zrpcd/zrpc_request.h"
 #include "zrpcd/zrpc_debug.h"
 #include "zrpcd/zrpcd.h"
 #include "zrpcd/zrpc_network.h"
+#include "zrpcd/qzcclient.h"
 #include "zrpcd/zrpc_debug.h"
 
 /* zrpc process wide configuration.  */
@@ -56,6 +58,8 @@ zrpc_delete (struct zrpc *zrpc)
 {
   struct zrpc_peer *peer, *peer_next;
 
+  /* requests in progress use peers and contexts */
+  zrpc_workers_stop ();
   for (peer = zrpc->peer; peer; peer = peer_next)
     {
       peer_next = peer->next;
@@ -93,7 +97,14 @@ zrpc_global_init (void)
   tm->global = thread_master_create ();
   tm->zrpc_listen_port = ZRPC_LISTEN_PORT;
   tm->zrpc_notification_port = ZRPC_NOTIFICATION_PORT;
-  tm->zrpc_notification_address = strdup(ZRPC_CLIENT_ADDRESS);
+  tm->zrpc_notification_address[0] = strdup(ZRPC_CLIENT_ADDRESS);
+  tm->qzc_window = QZCCLIENT_DEFAULT_WINDOW;
+  tm->request_max_size = ZRPC_REQUEST_MAX_SIZE;
+  tm->configurator_protocol = ZRPC_PROTOCOL_BINARY;
+  tm->notif_protocol = ZRPC_PROTOCOL_BINARY;
+  tm->notif_queue_size = ZRPC_NOTIF_QUEUE_DEFAULT_SIZE;
+  tm->notif_batch_delay = ZRPC_NOTIF_BATCH_DEFAULT_DELAY;
+  tm->notif_journal_size = ZRPC_NOTIF_JOURNAL_DEFAULT_SIZE;
 }
 
 
@@ -47,6 +47,10 @@ struct zrpc_peer
   /* thrift context for one thrift connexion */
   struct zrpc_vpnservice_client *peer;
 
+  /* worker pool queue, and result of request run by a worker */
+  struct zrpc_peer *work_next;
+  int work_failed;
+
   struct zrpc_peer *next;
 };
 